@@ -151,6 +151,17 @@ class ENGINE_API UAvoidanceManager : public UObject, public FSelfRegisteringExec
 	/** Only use if you want manual velocity planning. Will not ignore your own volume if you are registered. */
 	FVector GetAvoidanceVelocity(const FNavAvoidanceData& AvoidanceData, float DeltaTime);
 
+	/**
+	 * Batched version of GetAvoidanceVelocityIgnoringUID for systems moving many agents together, the agents are solved in parallel on worker threads.
+	 * Every agent avoids the registered objects as they are when the call is made.
+	 *
+	 * @param Agents			Avoidance data of the agents to solve.
+	 * @param IgnoreUIDs		UID each agent ignores, usually its own. Either empty or one per agent.
+	 * @param DeltaTime			How far forward in time to predict, see DeltaTimeToPredict.
+	 * @param OutVelocities		Receives the avoidance velocity of each agent, one per agent.
+	 */
+	void GetAvoidanceVelocities(TArrayView<const FNavAvoidanceData> Agents, TArrayView<const int32> IgnoreUIDs, float DeltaTime, TArrayView<FVector> OutVelocities);
+
 	/** Update the RVO avoidance data for the participating UMovementComponent */
 	void UpdateRVO(UMovementComponent* MovementComp);
 
@@ -199,6 +210,15 @@ protected:
 	/** This is called by our blueprint-accessible functions, and permits the user to ignore self, or not. Important in case the user isn't in the avoidance manager. */
 	FVector GetAvoidanceVelocity_Internal(const FNavAvoidanceData& AvoidanceData, float DeltaTime, int32 *IgnoreThisUID = NULL);
 
+	/** Solves the avoidance of one agent. Only reads the manager's state, so agents can be solved concurrently as long as each has its own Cones. */
+	FVector CalculateAvoidanceVelocity(const FNavAvoidanceData& AvoidanceData, float DeltaTime, const int32* IgnoreThisUID, float CurrentTime, TArray<FVelocityAvoidanceCone>& Cones, bool bDebugMode) const;
+
+	/** Rebuilds NeighborGrid from the avoidance objects if it wasn't built this frame */
+	void UpdateNeighborGrid();
+
+	/** Calls Visitor for every live avoidance object that may be within Radius of Center in 2D */
+	void ForEachNeighbor(const FVector& Center, float Radius, TFunctionRef<void(int32 AvoidanceUID, const FNavAvoidanceData& OtherObject)> Visitor) const;
+
 	/** All objects currently part of the avoidance solution. This is pretty transient stuff. */
 	TMap<int32, FNavAvoidanceData> AvoidanceObjects;
 
@@ -208,6 +228,33 @@ protected:
 	/** Keeping this here to avoid constant allocation */
 	TArray<FVelocityAvoidanceCone> AllCones;
 
+	struct FNeighborGridEntry
+	{
+		FIntPoint Cell;
+		int32 AvoidanceUID;
+		const FNavAvoidanceData* Data;
+	};
+
+	struct FNeighborGridCell
+	{
+		int32 FirstEntry;
+		int32 NumEntries;
+	};
+
+	/**
+	 * Uniform 2D grid of the live avoidance objects, built once per frame so agents only test the objects in the cells around them.
+	 * Entries point at AvoidanceObjects and are sorted by cell, objects are bucketed by where they were when the grid was built.
+	 */
+	TArray<FNeighborGridEntry> NeighborGridEntries;
+	TMap<FIntPoint, FNeighborGridCell> NeighborGridCells;
+
+	/** Frame NeighborGrid was built in and with which cell size */
+	uint64 NeighborGridFrame;
+	float NeighborGridCellSize;
+
+	/** Set when AvoidanceObjects changed in a way the grid doesn't account for, an object was added or brought back to life */
+	uint32 bNeighborGridDirty : 1;
+
 	/** Provider of navigation edges to consider for avoidance */
 	TWeakObjectPtr<UObject> EdgeProviderOb;
 	INavEdgeProviderInterface* EdgeProviderInterface;
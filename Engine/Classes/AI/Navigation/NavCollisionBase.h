@@ -50,6 +50,12 @@ public:
 	*	collision data, stores it and uploads to DDC */
 	virtual void Setup(class UBodySetup* BodySetup) PURE_VIRTUAL(UNavCollisionBase::Setup, );
 
+	/** Whether Setup may run on a worker thread, i.e. it only reads the body setup and writes this object */
+	virtual bool SupportsParallelSetup() const { return false; }
+
+	/** Calls Setup for each nav collision with the matching body setup, on worker threads for those that support it */
+	static void SetupBatch(TArrayView<UNavCollisionBase* const> NavCollisions, TArrayView<class UBodySetup* const> BodySetups);
+
 	/** Export collision data */
 	virtual bool ExportGeometry(const FTransform& LocalToWorld, FNavigableGeometryExport& GeoExport) const PURE_VIRTUAL(UNavCollisionBase::ExportGeometry, return false; );
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "NavigationDataChunk.generated.h"
 
 /** 
@@ -19,4 +20,33 @@ public:
 	/** Name of NavigationData actor that owns this chunk */
 	UPROPERTY()
 	FName NavigationDataName;
+
+	/** Whether PrepareAttach does any work, chunks that do have it run on a worker thread while their level is being made visible */
+	virtual bool SupportsAsyncPrepareAttach() const { return false; }
+
+	/**
+	 * Gets the chunk's data ready to be attached to its navigation data, e.g. by deserializing and fixing up tiles, so attaching
+	 * it on the game thread is only swapping the prepared data in. Runs on a worker thread, must not touch the world or other objects.
+	 */
+	virtual void PrepareAttach() {}
+
+	/** Starts PrepareAttach on a worker thread, unless the chunk doesn't support it or is already prepared or being prepared */
+	void BeginAsyncPrepareAttach();
+
+	/** Whether no asynchronous preparation is in flight, i.e. EnsurePreparedForAttach won't block */
+	bool IsPrepareAttachComplete() const;
+
+	/** Waits for the asynchronous preparation if there's one, or prepares on this thread if it was never started. Called before attaching. */
+	void EnsurePreparedForAttach();
+
+	/** Marks the prepared data as consumed, once it has been attached or discarded, so the next attach prepares again */
+	void ResetPreparedForAttach() { bPreparedForAttach = false; }
+
+	//~ Begin UObject Interface
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface
+
+private:
+	FGraphEventRef PrepareAttachTask;
+	bool bPreparedForAttach = false;
 };
@@ -19,6 +19,7 @@ class AWorldSettings;
 class ULevel;
 class AController;
 class UNavAreaBase;
+struct FNavigationRelevantData;
 
 ENGINE_API DECLARE_LOG_CATEGORY_EXTERN(LogNavigation, Warning, All);
 ENGINE_API DECLARE_LOG_CATEGORY_EXTERN(LogNavigationDataBuild, Log, All);
@@ -102,6 +103,23 @@ namespace FNavigationSystem
 	/** Discards all navigation data chunks in all sub-levels */
 	ENGINE_API void DiscardNavigationDataChunks(UWorld& InWorld);
 
+	/** Starts preparing the navigation data chunks of a level on worker threads, see UNavigationDataChunk::PrepareAttach */
+	ENGINE_API void BeginPrepareNavigationDataChunks(ULevel& Level);
+
+	/** Whether the navigation data chunks of a level are done preparing. If bWait, blocks until they are. */
+	ENGINE_API bool AreNavigationDataChunksPrepared(ULevel& Level, const bool bWait);
+
+	/** Exports the geometry of one object of GatherNavigationDataBatch into its relevant data, called on worker threads */
+	typedef TFunctionRef<void(UObject& /*Object*/, FNavigationRelevantData& /*Data*/)> FExportNavigationGeometry;
+
+	/**
+	 * Gathers the navigation relevant data of many objects at once, e.g. the components of dirty areas. Bounds, modifiers and
+	 * PrepareGeometryExportSync of the whole batch run on the game thread first, then ExportGeometry runs for every relevant object
+	 * on worker threads, so it must only read the object's collision and write the data it's given.
+	 * OutData matches Objects, with null entries for objects that aren't navigation relevant.
+	 */
+	ENGINE_API void GatherNavigationDataBatch(TArrayView<UObject* const> Objects, TArray<TSharedPtr<FNavigationRelevantData, ESPMode::ThreadSafe>>& OutData, FExportNavigationGeometry ExportGeometry);
+
 	template<typename TNavSys>
 	FORCEINLINE TNavSys* GetCurrent(UWorld* World)
 	{
@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimBoneCompressionCodec.h"
+#include "AnimBoneCompressionCodec_UniformSegments.generated.h"
+
+/**
+ * Compressed data of the uniform segments codec.
+ *
+ * Keys are split into segments of SegmentNumKeys keys, consecutive segments sharing their boundary key, and every
+ * segment of a sequence has the same size. A segment holds, for each component stream (rotation X/Y/Z, translation X/Y/Z
+ * and optionally scale X/Y/Z), the range of every track over the segment followed by each key quantized to 16 bits.
+ * Tracks are padded to a multiple of 8 so every stream of every key starts on an aligned, uniform stride:
+ *
+ *		float	Mins[NumStreams][NumTracksPadded]
+ *		float	Extents[NumStreams][NumTracksPadded]
+ *		uint16	Keys[SegmentNumKeys][NumStreams][NumTracksPadded]
+ */
+struct ENGINE_API FUniformSegmentsCompressedAnimData : public ICompressedAnimData
+{
+	/** Number of tracks of the sequence and the stride they are stored with */
+	int32 NumTracks;
+	int32 NumTracksPadded;
+
+	/** Keys per segment, including the key shared with the next segment */
+	int32 SegmentNumKeys;
+	int32 NumSegments;
+
+	/** Number of component streams per key, 6 or 9 with scale */
+	int32 NumStreams;
+
+	TArrayView<uint8> SegmentData;
+
+	FUniformSegmentsCompressedAnimData()
+		: NumTracks(0)
+		, NumTracksPadded(0)
+		, SegmentNumKeys(0)
+		, NumSegments(0)
+		, NumStreams(0)
+	{}
+
+	bool HasScale() const { return NumStreams == 9; }
+
+	int32 GetSegmentSize() const { return NumStreams * NumTracksPadded * (sizeof(float) * 2 + sizeof(uint16) * SegmentNumKeys); }
+
+	const float* GetSegmentMins(int32 SegmentIndex) const { return (const float*)(SegmentData.GetData() + SegmentIndex * GetSegmentSize()); }
+	const float* GetSegmentExtents(int32 SegmentIndex) const { return GetSegmentMins(SegmentIndex) + NumStreams * NumTracksPadded; }
+	const uint16* GetSegmentKey(int32 SegmentIndex, int32 SegmentKeyIndex) const { return (const uint16*)(GetSegmentExtents(SegmentIndex) + NumStreams * NumTracksPadded) + SegmentKeyIndex * NumStreams * NumTracksPadded; }
+
+	template<typename TArchive>
+	void ByteSwapData(TArrayView<uint8> CompressedData, TArchive& MemoryStream);
+
+	// ICompressedAnimData implementation
+	virtual void SerializeCompressedData(class FArchive& Ar) override;
+	virtual void Bind(const TArrayView<uint8> BulkData) override { SegmentData = BulkData; }
+	virtual int64 GetApproxCompressedSize() const override { return SegmentData.Num(); }
+	virtual FString GetDebugString() const override;
+	virtual bool IsValid() const override { return NumSegments > 0 && SegmentData.Num() == NumSegments * GetSegmentSize(); }
+};
+
+/**
+ * Bone compression codec laid out for wide SIMD decompression: every track is quantized uniformly within fixed-size
+ * segments, so a full pose decodes with the same branchless loop over every track instead of per-track formats.
+ * Trades memory for decompression speed, it doesn't remove keys.
+ */
+UCLASS(meta = (DisplayName = "Uniform Segments"))
+class ENGINE_API UAnimBoneCompressionCodec_UniformSegments : public UAnimBoneCompressionCodec
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Number of keys per segment. Larger segments store fewer ranges but quantize with less precision. */
+	UPROPERTY(Category = Compression, EditAnywhere, meta = (ClampMin = "2", ClampMax = "256"))
+	int32 NumKeysPerSegment;
+
+	//////////////////////////////////////////////////////////////////////////
+
+#if WITH_EDITORONLY_DATA
+	// UAnimBoneCompressionCodec overrides
+	virtual bool Compress(const FCompressibleAnimData& CompressibleAnimData, FCompressibleAnimDataResult& OutResult) override;
+	virtual void PopulateDDCKey(FArchive& Ar) override;
+#endif
+
+	virtual TUniquePtr<ICompressedAnimData> AllocateAnimData() const override;
+	virtual void ByteSwapIn(ICompressedAnimData& AnimData, TArrayView<uint8> CompressedData, FMemoryReader& MemoryStream) const override;
+	virtual void ByteSwapOut(ICompressedAnimData& AnimData, TArrayView<uint8> CompressedData, FMemoryWriter& MemoryStream) const override;
+	virtual void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const override;
+	virtual void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const override;
+};
@@ -30,6 +30,13 @@ class ENGINE_API UAnimBoneCompressionSettings : public UObject
 	/** Any codec (even one that increases the size) with a lower error will be used until it falls below the threshold. */
 	UPROPERTY(Category = Compression, EditAnywhere)
 	bool bForceBelowThreshold;
+
+	/**
+	 * Stops trying codecs once one has an error below the threshold, the best of the codecs up to it is used.
+	 * Order the codecs from the most to the least preferred, the codecs after it are skipped or their results ignored.
+	 */
+	UPROPERTY(Category = Compression, EditAnywhere)
+	bool bStopAtFirstCodecBelowThreshold;
 #endif
 
 	/** Allow us to convert DDC serialized path back into codec object */
@@ -336,6 +336,9 @@ private:
 	UPROPERTY(Transient)
 	TArray<FAnimNotifyEvent> ActiveStateBranchingPoints;
 
+	/** Notifies gathered per slot by HandleEvents, kept so the arrays are reused every tick */
+	TMap<FName, TArray<FAnimNotifyEventReference>> SlotNotifiesScratch;
+
 	UPROPERTY()
 	float Position;
 
@@ -375,6 +378,9 @@ private:
 	UPROPERTY(Transient)
 	int32 DisableRootMotionCount;
 
+	// Section the streamed animations of the next section were last prefetched for
+	int32 PrefetchedSectionIndex;
+
 public:
 	/** Montage to Montage Synchronization.
 	 *
@@ -522,6 +528,9 @@ private:
 
 	float GetRemainingPlayTimeToSectionEnd(const FMontageSubStepper& MontageSubStepper) const;
 
+	/** Requests the streamed animations the section played after SectionIndex starts with */
+	void PrefetchNextSection(int32 SectionIndex, bool bPlayingForward) const;
+
 public:
 	/** static functions that are used by matinee functionality */
 	static UAnimMontage* SetMatineeAnimPositionInner(FName SlotName, USkeletalMeshComponent* SkeletalMeshComponent, UAnimSequenceBase* InAnimSequence, float InPosition, bool bLooping);
@@ -1005,11 +1005,27 @@ struct ENGINE_API FAnimNode_Base
 		ExposedValueHandler = Handler; 
 	}
 
+	/**
+	 * Returns the link to process instead of this node when it is culled by its LOD threshold, or null to process this node as usual.
+	 * Pose links call this before updating or evaluating their node, so a culled node costs nothing at all, not even its own update.
+	 */
+	FPoseLinkBase* GetActiveLODPassThroughLink(FAnimInstanceProxy* AnimInstanceProxy)
+	{
+		FPoseLinkBase* PassThroughLink = GetLODPassThroughLink();
+		return (PassThroughLink && !IsLODEnabled(AnimInstanceProxy)) ? PassThroughLink : nullptr;
+	}
+
 protected:
 	/** return true if enabled, otherwise, return false. This is utility function that can be used per node level */
 	bool IsLODEnabled(FAnimInstanceProxy* AnimInstanceProxy);
 	virtual int32 GetLODThreshold() const { return INDEX_NONE; }
 
+	/**
+	 * Input link standing in for this node above its LOD threshold, e.g. the base pose of a node that only adjusts it.
+	 * It must be the same kind of link as the links pointing to this node: a local space node returns an FPoseLink, a component space node an FComponentSpacePoseLink.
+	 */
+	virtual FPoseLinkBase* GetLODPassThroughLink() { return nullptr; }
+
 	/** Deprecated function */
 	UE_DEPRECATED(4.17, "Please use OnInitializeAnimInstance instead")
 	virtual void RootInitialize(const FAnimInstanceProxy* InProxy) {}
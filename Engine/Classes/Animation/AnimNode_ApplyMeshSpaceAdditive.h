@@ -66,5 +66,6 @@ public:
 	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
 	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
 	virtual int32 GetLODThreshold() const override { return LODThreshold; }
+	virtual FPoseLinkBase* GetLODPassThroughLink() override { return &Base; }
 	// End of FAnimNode_Base interface
 };
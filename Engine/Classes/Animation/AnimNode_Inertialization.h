@@ -153,6 +153,7 @@ struct FInertializationPoseDiff
 
 	FInertializationPoseDiff()
 		: InertializationSpace(EInertializationSpace::Default)
+		, CoefficientsDuration(-1.0f)
 	{
 	}
 
@@ -161,6 +162,7 @@ struct FInertializationPoseDiff
 		BoneDiffs.Empty();
 		CurveDiffs.Empty();
 		InertializationSpace = EInertializationSpace::Default;
+		CoefficientsDuration = -1.0f;
 	}
 
 	// Initialize the pose difference from the current pose and the two previous snapshots
@@ -186,8 +188,31 @@ struct FInertializationPoseDiff
 
 private:
 
+	// Quintic decay curves of the bone translations, rotations and scales (3 per skeleton bone) followed by the curves (1 per CurveID),
+	// as a structure of arrays so that ApplyTo evaluates them 4 at a time. The curves only depend on the duration, not on the elapsed time.
+	struct FInertialCoefficients
+	{
+		TArray<float> A;
+		TArray<float> B;
+		TArray<float> C;
+		TArray<float> D;
+		TArray<float> V0;
+		TArray<float> X0;
+		TArray<float> T1;
+
+		void SetNum(int32 Num);
+		void Set(int32 Index, float x0, float v0, float t1);
+		void Evaluate(float t, TArray<float>& OutValues) const;
+	};
+
 	static float CalcInertialFloat(float x0, float v0, float t, float t1);
 
+	// Computes the coefficients of the curve CalcInertialFloat evaluates, signed, with t1 adjusted to prevent overshoot
+	static void CalcInertialCoefficients(float x0, float v0, float t1, float& OutA, float& OutB, float& OutC, float& OutD, float& OutV0, float& OutX0, float& OutT1);
+
+	// Computes the coefficients of every bone and curve for a duration, the first time it's applied
+	void UpdateCoefficients(float InertializationDuration) const;
+
 	// Bone differences indexed by skeleton bone index
 	TArray<FInertializationBoneDiff> BoneDiffs;
 
@@ -196,6 +221,11 @@ private:
 
 	// Inertialization space (local vs world for situations where we wish to correct a world-space discontinuity such as an abrupt orientation change)
 	EInertializationSpace InertializationSpace;
+
+	// Decay curves of the bone and curve differences, and their values at the elapsed time of the last ApplyTo (scratch storage kept between frames)
+	mutable FInertialCoefficients Coefficients;
+	mutable TArray<float> DecayedValues;
+	mutable float CoefficientsDuration;
 };
 
 
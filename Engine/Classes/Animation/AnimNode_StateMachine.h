@@ -17,6 +17,7 @@ class UBlendProfile;
 struct FAnimNode_AssetPlayerBase;
 struct FAnimNode_StateMachine;
 struct FAnimNode_TransitionPoseEvaluator;
+struct FAnimNode_TransitionResult;
 
 // Information about an active transition on the transition stack
 USTRUCT()
@@ -110,6 +111,61 @@ public:
 	void Clear();
 };
 
+// A transition rule of a state machine instance, resolved once so it's evaluated without looking up nodes or properties
+struct FAnimationCompiledTransitionRule
+{
+	enum class EKind : uint8
+	{
+		// Runs the native delegate or the rule graph, like an uncompiled rule
+		Graph,
+		// The rule graph only copies a bool property of the instance, which is read directly
+		BoolProperty,
+		// Automatic rule based on the time remaining in the animation of the state
+		RemainingTime,
+	};
+
+	FAnimNode_TransitionResult* ResultNode;
+
+	// Exit transition this rule is for, null for the entry rule of a conduit
+	const FBakedStateExitTransition* TransitionRule;
+
+	// Source of BoolProperty rules
+	const FBoolProperty* SourceProperty;
+	const void* SourceAddr;
+
+	int32 NextState;
+
+	EKind Kind;
+	bool bNegateSource;
+	bool bNextStateIsConduit;
+
+	FAnimationCompiledTransitionRule()
+		: ResultNode(nullptr)
+		, TransitionRule(nullptr)
+		, SourceProperty(nullptr)
+		, SourceAddr(nullptr)
+		, NextState(INDEX_NONE)
+		, Kind(EKind::Graph)
+		, bNegateSource(false)
+		, bNextStateIsConduit(false)
+	{}
+};
+
+// The transition rules of a state, see FAnimNode_StateMachine::CompiledTransitionRules
+struct FAnimationCompiledState
+{
+	// Entry rule of a conduit, the ResultNode is null if the state has none
+	FAnimationCompiledTransitionRule EntryRule;
+
+	int32 FirstTransitionRule;
+	int32 NumTransitionRules;
+
+	FAnimationCompiledState()
+		: FirstTransitionRule(0)
+		, NumTransitionRules(0)
+	{}
+};
+
 //@TODO: ANIM: Need to implement WithSerializer and Identical for FAnimationActiveTransitionEntry?
 
 // State machine node
@@ -195,6 +251,14 @@ private:
 
 	TArray<FGraphTraversalCounter> StateCacheBoneCounters;
 
+	// State the streamed animations of the next states were last prefetched for, and time until they're prefetched again
+	int32 PrefetchedState;
+	float PrefetchTimer;
+
+	// Transition rules of every state in priority order, built when the machine is initialized. Empty if any rule couldn't be resolved.
+	TArray<FAnimationCompiledState> CompiledStates;
+	TArray<FAnimationCompiledTransitionRule> CompiledTransitionRules;
+
 public:
 	FAnimNode_StateMachine()
 		: StateMachineIndexInClass(0)
@@ -205,6 +269,8 @@ public:
 		, CurrentState(INDEX_NONE)
 		, ElapsedTime(0.0f)
 		, PRIVATE_MachineDescription(NULL)
+		, PrefetchedState(INDEX_NONE)
+		, PrefetchTimer(0.0f)
 	{
 	}
 
@@ -246,6 +312,18 @@ protected:
 							/*OUT*/ FAnimationPotentialTransition& OutPotentialTransition,
 							/*OUT*/ TArray<int32, TInlineAllocator<4>>& OutVisitedStateIndices);
 
+	// Same as FindValidTransition, using the rules resolved by CompileTransitionRules
+	bool FindValidCompiledTransition(const FAnimationUpdateContext& Context,
+							int32 StateIndex,
+							/*OUT*/ FAnimationPotentialTransition& OutPotentialTransition,
+							/*OUT*/ TArray<int32, TInlineAllocator<4>>& OutVisitedStateIndices);
+
+	// Resolves the transition rules of every state into CompiledStates, so finding a transition doesn't look anything up
+	void CompileTransitionRules(const FAnimationBaseContext& Context);
+
+	// Evaluates a compiled rule and returns whether its transition can be entered
+	bool EvaluateCompiledTransitionRule(const FAnimationUpdateContext& Context, const FAnimationCompiledTransitionRule& Rule, const FBakedAnimationState& StateInfo);
+
 	// Helper function that will update the states associated with a transition
 	void UpdateTransitionStates(const FAnimationUpdateContext& Context, FAnimationActiveTransitionEntry& Transition);
 
@@ -265,6 +343,9 @@ protected:
 
 	void LogInertializationRequestError(const FAnimationUpdateContext& Context, int32 PreviousState, int32 NextState);
 
+	// Requests the streamed animations played by the states the current state can transition to, looking through conduits
+	void PrefetchStreamedTransitionTargets(const FAnimationUpdateContext& Context);
+
 public:
 	friend struct FAnimInstanceProxy;
 };
@@ -216,6 +216,13 @@ public:
 
 	ENGINE_API float GetChunkSizeSeconds(const ITargetPlatform* Platform) const;
 
+	/**
+	 * Requests the chunks needed to start playing at Time before playback needs them.
+	 *
+	 * @param Priority	Importance of the request, see IAnimationStreamingManager::PrefetchChunk
+	 */
+	ENGINE_API void PrefetchChunksAtTime(float Time, float Priority) const;
+
 	private:
 
 #if WITH_EDITOR
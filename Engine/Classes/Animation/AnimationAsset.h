@@ -130,7 +130,14 @@ struct FBlendFilter
 
 	FFIRFilterTimeBased FilterPerAxis[3];
 
+	/** Blend space, blend input and samples of the last update, reused by UBlendSpaceBase::TickAssetPlayer while the input doesn't move */
+	const class UBlendSpaceBase* CachedBlendSpace;
+	FVector CachedBlendInput;
+	TArray<FBlendSampleData> CachedSampleDataList;
+
 	FBlendFilter()
+		: CachedBlendSpace(nullptr)
+		, CachedBlendInput(FVector::ZeroVector)
 	{
 	}
 
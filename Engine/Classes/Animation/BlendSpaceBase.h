@@ -371,6 +371,9 @@ protected:
 	*
 	*/
 	virtual void GetRawSamplesFromBlendInput(const FVector &BlendInput, TArray<FGridBlendSample, TInlineAllocator<4> > & OutBlendSamples) const {}
+
+	/** GetSamplesFromBlendInput, returning the samples cached in the filter when the input is the same as the last time it was called with the filter */
+	bool GetSamplesFromBlendInputCached(const FVector &BlendInput, FBlendFilter* Filter, TArray<FBlendSampleData> & OutSampleDataList) const;
 	/** Let derived blend space decided how to handle scaling */
 	virtual EBlendSpaceAxis GetAxisToScale() const PURE_VIRTUAL(UBlendSpaceBase::GetAxisToScale, return BSA_None;);
 
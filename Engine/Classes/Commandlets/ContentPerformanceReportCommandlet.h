@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+#include "ContentPerformanceReportCommandlet.generated.h"
+
+/**
+ * Loads a map and its streaming levels without running them, and reports what each actor costs: ticking components,
+ * replicated properties, collision bodies, skeletal mesh LODs, material shaders and texture memory. Actors are ranked
+ * by one of these, and the levels are summarized with the textures they reference.
+ *
+ * Usage:
+ *	ContentPerformanceReport -Map=/Game/Maps/MyMap [-SortBy=TextureBytes] [-Top=20] [-Output=Path/Report.csv]
+ */
+UCLASS()
+class UContentPerformanceReportCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -261,6 +261,12 @@ protected:
 
 	/** Removes specified instances */ 
 	void RemoveInstancesInternal(const int32* InstanceIndices, int32 Num);
+
+	/** Instance edits are recorded against the cluster tree by this component itself */
+	virtual bool CanUpdateInstanceRenderDataInline(int32 NumInstancesToUpdate) const override { return false; }
+
+	/** Grows the cluster tree nodes holding a built instance around its new bounds, returns false if the tree should be rebuilt instead */
+	bool RefitClusterTree(int32 RenderIndex, const FBox& NewInstanceBounds, const FVector& NewInstanceScale);
 	
 	/** Gets and approximate number of verts for each LOD to generate heuristics **/
 	int32 GetVertsForLOD(int32 LODIndex);
@@ -35,6 +35,7 @@ struct FInstanceUpdateCmdBuffer
 	{
 		Add,
 		Update,
+		UpdateTransform,
 		Hide,
 		EditorData,
 		LightmapData,
@@ -62,6 +63,8 @@ struct FInstanceUpdateCmdBuffer
 	void HideInstance(int32 RenderIndex);
 	void AddInstance(const FMatrix& InTransform);
 	void UpdateInstance(int32 RenderIndex, const FMatrix& InTransform);
+	/** Unlike UpdateInstance, keeps the random ID, light map and custom data of the instance */
+	void UpdateInstanceTransform(int32 RenderIndex, const FMatrix& InTransform);
 	void SetEditorData(int32 RenderIndex, const FColor& Color, bool bSelected);
 	void SetLightMapData(int32 RenderIndex, const FVector2D& LightmapUVBias);
 	void SetShadowMapData(int32 RenderIndex, const FVector2D& ShadowmapUVBias);
@@ -73,10 +76,14 @@ struct FInstanceUpdateCmdBuffer
 	void Edit();
 	void Reset();
 	int32 NumTotalCommands() const { return NumEdits; };
+
+	/** True if every pending edit was recorded as an inline command, so applying them brings the render data up to date */
+	bool HasOnlyInlineCommands() const { return NumEdits == NumInlineEdits; }
 	
 	TArray<FInstanceUpdateCommand> Cmds;
 	int32 NumAdds;
 	int32 NumEdits;
+	int32 NumInlineEdits;
 };
 
 USTRUCT()
@@ -313,6 +320,7 @@ public:
 	virtual void GetLightAndShadowMapMemoryUsage( int32& LightMapMemoryUsage, int32& ShadowMapMemoryUsage ) const override;
 
 	virtual bool DoCustomNavigableGeometryExport(FNavigableGeometryExport& GeomExport) const override;
+	virtual void GetStaticCollisionStoreInstances(TArray<FTransform>& OutTransforms, TArray<int32>& OutItems) const override;
 	//~ End UPrimitiveComponent Interface
 
 	//~ Begin UNavRelevantInterface Interface
@@ -355,6 +363,20 @@ public:
 	virtual void PropagateLightingScenarioChange() override;
 
 	void GetInstancesMinMaxScale(FVector& MinScale, FVector& MaxScale) const;
+
+protected:
+	/**
+	 * Returns true if updates of NumInstancesToUpdate instances can be recorded as inline commands applied to the current
+	 * render data, rather than rebuilding all of it when the proxy is next created.
+	 */
+	virtual bool CanUpdateInstanceRenderDataInline(int32 NumInstancesToUpdate) const;
+
+	/** Records the new transform of an instance for the render data, inline if bInline or by rebuilding the render data */
+	void UpdateInstanceRenderTransform(int32 InstanceIndex, bool bInline);
+
+	/** Records the new custom data of an instance for the render data, inline if bInline or by rebuilding the render data */
+	void UpdateInstanceRenderCustomData(int32 InstanceIndex, bool bInline);
+
 private:
 
 	/** Sets up new instance data to sensible defaults, creates physics counterparts if possible. */
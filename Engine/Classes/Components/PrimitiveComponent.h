@@ -291,6 +291,24 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Collision)
 	uint8 bMultiBodyOverlap:1;
 
+	/**
+	 * If true, moving this component does not query its overlaps right away. It is queued, and its overlaps (and those of its attach children)
+	 * are updated once after physics has run, and once more at the end of the frame for moves made after that, so a component that moves
+	 * several times in a frame costs a single overlap query. Overlaps that only happened along sweeps in between are not reported.
+	 * Only used in game worlds, when p.AllowDeferredOverlapUpdates is set.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Collision)
+	uint8 bDeferOverlapUpdates:1;
+
+	/**
+	 * If true, a static query only component keeps its simple collision in its world's static collision store instead of creating a physics body,
+	 * which is much cheaper for large numbers of props. Only raycasts see the store: sweeps and overlaps ignore the component, and complex traces
+	 * hit its simple collision. Only used in game worlds, when p.StaticCollisionStore is set and the collision is made of boxes, spheres and capsules.
+	 * Collision settings are read when the physics state is created.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadOnly, Category=Collision)
+	uint8 bUseStaticCollisionStore:1;
+
 	/**
 	 * If true, component sweeps with this component should trace against complex collision during movement (for example, each triangle of a mesh).
 	 * If false, collision will be resolved against simple collision bounds instead.
@@ -925,6 +943,28 @@ public:
 	 */
 	virtual bool UpdateOverlapsImpl(const TOverlapArrayView* NewPendingOverlaps=nullptr, bool bDoNotifies=true, const TOverlapArrayView* OverlapsAtEndLocation=nullptr) override;
 
+	/**
+	 * Queues this component for the next batched overlap update if it defers its overlap updates (see bDeferOverlapUpdates).
+	 * @param bForceDefer	Queue the update even if the component doesn't set bDeferOverlapUpdates (see MOVECOMP_DeferOverlapUpdate).
+	 * @return True if the component was queued (or already was), false if the caller should update overlaps now.
+	 */
+	bool QueueDeferredOverlapUpdate(bool bForceDefer = false);
+
+	/** Updates the overlaps of every component queued by QueueDeferredOverlapUpdate in the given world, once each. */
+	static void FlushDeferredOverlapUpdates(UWorld* World);
+
+	/** Returns true if creating the physics state should register this component with its world's static collision store, see bUseStaticCollisionStore. */
+	bool ShouldUseStaticCollisionStore() const;
+
+	/** Returns true if this component's collision currently lives in its world's static collision store rather than in physics bodies. */
+	bool IsInStaticCollisionStore() const { return bInStaticCollisionStore; }
+
+	/**
+	 * Returns the world transforms at which the static collision store places this component's body setup, and the hit item reported for each.
+	 * A single instance at the component transform by default.
+	 */
+	virtual void GetStaticCollisionStoreInstances(TArray<FTransform>& OutTransforms, TArray<int32>& OutItems) const;
+
 #if WITH_EDITOR
 	/**
 	 * Whether or not the bounds of this component should be considered when focusing the editor camera to an actor with this component in it.
@@ -1588,7 +1628,20 @@ public:
 	/** A fence to track when the primitive is detached from the scene in the rendering thread. */
 	FRenderCommandFence DetachFence;
 
+protected:
+	/** True while this component's collision is registered with its world's static collision store */
+	uint8 bInStaticCollisionStore:1;
+
+	/** Removes this component from its world's static collision store if it is in it */
+	void RemoveFromStaticCollisionStore();
+
+	/** Has the static collision store re-read this component's instances on its next flush */
+	void MarkStaticCollisionStoreDirty();
+
 private:
+	/** True while this component is queued in its world's ComponentsPendingDeferredOverlapUpdate */
+	uint8 bPendingDeferredOverlapUpdate:1;
+
 	/** LOD parent primitive to draw instead of this one (multiple UPrim's will point to the same LODParent ) */
 	UPROPERTY(NonPIEDuplicateTransient)
 	class UPrimitiveComponent* LODParentPrimitive;
@@ -61,4 +61,9 @@ protected:
 public:
 	/** Scene proxy object. Managed by the scene but stored here. */
 	class FRuntimeVirtualTextureSceneProxy* SceneProxy;
+
+private:
+	/** Virtual texture transform last sent to the scene. Every send reallocates the virtual texture and renders all of its pages again. */
+	FTransform SentVirtualTextureTransform;
+	bool bHasSentVirtualTexture = false;
 };
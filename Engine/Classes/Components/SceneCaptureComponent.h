@@ -203,6 +203,9 @@ protected:
 
 	virtual void UpdateSceneCaptureContents(FSceneInterface* Scene) {};
 
+	/** The texture this capture renders to, used by UpdateDeferredCaptures to tell whether the capture is being displayed */
+	virtual UTexture* GetCaptureTexture() const { return nullptr; }
+
 	/**
 	 * The view state holds persistent scene rendering state and enables occlusion culling in scene captures.
 	 * NOTE: This object is used by the rendering thread. When the game thread attempts to destroy it, FDeferredCleanupInterface will keep the object around until the RT is done accessing it.
@@ -210,6 +213,9 @@ protected:
 	 */
 	TIndirectArray<FSceneViewStateReference> ViewStates;
 
+	/** Number of consecutive frames UpdateDeferredCaptures has postponed this capture, see r.SceneCapture.FrameBudgetMS */
+	int32 NumFramesDeferred = 0;
+
 #if WITH_EDITORONLY_DATA
 	/** The mesh used by ProxyMeshComponent */
 	UPROPERTY(transient)
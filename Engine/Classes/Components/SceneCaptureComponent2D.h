@@ -150,6 +150,11 @@ public:
 
 	void UpdateSceneCaptureContents(FSceneInterface* Scene) override;
 
+protected:
+	virtual UTexture* GetCaptureTexture() const override;
+
+public:
+
 #if WITH_EDITORONLY_DATA
 	void UpdateDrawFrustum();
 
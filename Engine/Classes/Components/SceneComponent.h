@@ -85,6 +85,8 @@ enum EMoveComponentFlags
 	MOVECOMP_NeverIgnoreBlockingOverlaps	= 0x0004,	
 	/** avoid dispatching blocking hit events when the hit started in penetration (and is not ignored, see MOVECOMP_NeverIgnoreBlockingOverlaps). */
 	MOVECOMP_DisableBlockingOverlapDispatch	= 0x0008,	
+	/** Queue the overlap update of the move for the next batched update even if the component doesn't set bDeferOverlapUpdates. Used when syncing with physics. */
+	MOVECOMP_DeferOverlapUpdate				= 0x0010,
 };
 
 /** Comparison tolerance for checking if two FQuats are the same when moving SceneComponents. */
@@ -229,6 +231,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category=Rendering)
 	uint8 bUseAttachParentBound:1;
 
+	/**
+	 * If true, moving this component only updates its own transform right away. Its attach children are updated once, in one batched pass,
+	 * at the end of the current tick group, no matter how many times it moved. Until then the children's transforms are stale, so only
+	 * enable this on hierarchies that move several times per frame and whose children are not read back in between.
+	 * Only used in game worlds, and only when SceneComponent.DeferChildTransformUpdates is set.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category=Transform)
+	uint8 bDeferChildTransformUpdates:1;
+
 	/** Clears the skip update overlaps flag. This should be called any time a change to state would prevent the result of UpdateOverlaps. For example attachment, changing collision settings, etc... */
 	void ClearSkipUpdateOverlaps();
 
@@ -257,6 +268,9 @@ private:
 	uint8 bNetUpdateTransform : 1;
 	uint8 bNetUpdateAttachment : 1;
 
+	/** True while this component is queued in its world's DeferredChildTransformUpdates */
+	uint8 bPendingChildTransformUpdate : 1;
+
 public:
 	/** Global flag to enable/disable overlap optimizations, settable with p.SkipUpdateOverlapsOptimEnabled cvar */ 
 	static int32 SkipUpdateOverlapsOptimEnabled;
@@ -899,8 +913,17 @@ private:
 	void PropagateTransformUpdate(bool bTransformChanged, EUpdateTransformFlags UpdateTransformFlags = EUpdateTransformFlags::None, ETeleportType Teleport = ETeleportType::None);
 	void UpdateComponentToWorldWithParent(USceneComponent* Parent, FName SocketName, EUpdateTransformFlags UpdateTransformFlags, const FQuat& RelativeRotationQuat, ETeleportType Teleport = ETeleportType::None);
 
+	/** Updates the attach children now, or queues them for the batched pass if this component defers child transform updates */
+	void UpdateOrDeferChildTransforms(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
 public:
 
+	/**
+	 * Updates the attach children of every component queued by bDeferChildTransformUpdates in the given world.
+	 * The hierarchy below each queued component is walked breadth first, and each child is updated once even if its parent moved several times.
+	 */
+	static void FlushDeferredChildTransformUpdates(UWorld* World);
+
 	/** Queries world and updates overlap tracking state for this component */
 	bool UpdateOverlaps(const TOverlapArrayView* PendingOverlaps = nullptr, bool bDoNotifies = true, const TOverlapArrayView* OverlapsAtEndLocation = nullptr);
 
@@ -1530,6 +1553,14 @@ private:
 	friend struct FResetSceneComponentAfterCopy;
 };
 
+/** A scene component that moved while deferring child transform updates, and the flags its attach children are to be updated with */
+struct FDeferredChildTransformUpdate
+{
+	TWeakObjectPtr<USceneComponent> Component;
+	EUpdateTransformFlags UpdateTransformFlags;
+	ETeleportType Teleport;
+};
+
 
 //////////////////////////////////////////////////////////////////////////
 // USceneComponent inlines
@@ -635,6 +635,9 @@ private:
 
 	uint8 bPostEvaluatingAnimation:1;
 
+	/** See SetAnimationLODOverride */
+	int32 AnimationLODOverride;
+
 public:
 
 	/** Cache AnimCurveUidVersion from Skeleton and this will be used to identify if it needs to be updated */
@@ -1077,6 +1080,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Components|SkeletalMesh")
 	bool GetAllowRigidBodyAnimNode() const { return !bDisableRigidBodyAnimNode; }
 
+	/**
+	 * Sets the LOD anim graph nodes are culled with, instead of following the predicted LOD. INDEX_NONE follows the predicted LOD again.
+	 * Set it from state that server and clients compute the same way, e.g. gameplay significance, so that they evaluate the same nodes.
+	 * Processes that can't render also take the required bones from this LOD, shrinking the evaluated skeleton on dedicated servers.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Components|SkeletalMesh")
+	void SetAnimationLODOverride(int32 InAnimationLODOverride);
+
+	/** Returns the LOD anim graph nodes are culled with, see SetAnimationLODOverride */
+	int32 GetAnimationLODLevel() const { return (AnimationLODOverride != INDEX_NONE) ? AnimationLODOverride : PredictedLODLevel; }
+
+	/** Returns the LOD the required bones are taken from */
+	int32 GetRequiredBonesLODLevel() const;
+
 	/**
 	* Sets whether or not to force tick component in order to update animation and refresh transform for this component
 	* This is supported only in the editor
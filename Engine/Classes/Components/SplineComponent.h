@@ -79,6 +79,12 @@ struct ENGINE_API FSplineCurves
 	UPROPERTY()
 	USplineMetadata* Metadata_DEPRECATED = nullptr;
 
+	/**
+	 * Bounds of the position segments for closest point queries, as a binary tree over consecutive segments: node 1 is the root,
+	 * the children of node N are 2N and 2N+1, and the leaves start at SegmentBoundsTree.Num() / 2. Rebuilt by UpdateSegmentBounds.
+	 */
+	TArray<FBox> SegmentBoundsTree;
+
 	bool operator==(const FSplineCurves& Other) const
 	{
 		return Position == Other.Position && Rotation == Other.Rotation && Scale == Other.Scale;
@@ -97,8 +103,18 @@ struct ENGINE_API FSplineCurves
 	 * @param	bLoopPositionOverride	Whether to override the loop position with LoopPosition
 	 * @param	LoopPosition			The loop position to use instead of the last key
 	 * @param	Scale3D					The world scale to override
+	 * @param	bAdaptiveReparamSteps	Whether ReparamStepsPerSegment is scaled per segment by how much the speed varies along it, down to one step for segments of constant speed
 	 */
-	void UpdateSpline(bool bClosedLoop = false, bool bStationaryEndpoints = false, int32 ReparamStepsPerSegment = 10, bool bLoopPositionOverride = false, float LoopPosition = 0.0f, const FVector& Scale3D = FVector(1.0f));
+	void UpdateSpline(bool bClosedLoop = false, bool bStationaryEndpoints = false, int32 ReparamStepsPerSegment = 10, bool bLoopPositionOverride = false, float LoopPosition = 0.0f, const FVector& Scale3D = FVector(1.0f), bool bAdaptiveReparamSteps = false);
+
+	/** Rebuilds SegmentBoundsTree from the position curve, called by UpdateSpline and after loading */
+	void UpdateSegmentBounds();
+
+	/** Returns the input key of the position closest to a point in local space, only searching segments whose bounds can be closer than the best so far */
+	float FindNearest(const FVector& LocalLocation, float& OutSquaredDistance) const;
+
+	/** Returns the distance along the spline at the start of a reparam table segment, i.e. at a spline point */
+	float GetDistanceAtSegmentStart(int32 SegmentIndex) const;
 
 	/** Returns the length of the specified spline segment up to the parametric value given */
 	float GetSegmentLength(const int32 Index, const float Param, bool bClosedLoop = false, const FVector& Scale3D = FVector(1.0f)) const;
@@ -217,6 +233,10 @@ class ENGINE_API USplineComponent : public UPrimitiveComponent
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = Spline, meta=(ClampMin=4, UIMin=4, ClampMax=100, UIMax=100))
 	int32 ReparamStepsPerSegment;
 
+	/** If set, the steps of each segment scale with how much the speed varies along it, from one for straight segments of constant speed to twice ReparamStepsPerSegment */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = Spline)
+	bool bAdaptiveReparamSteps;
+
 	/** Specifies the duration of the spline in seconds */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spline)
 	float Duration;
@@ -674,6 +694,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Spline)
 	float FindInputKeyClosestToWorldLocation(const FVector& WorldLocation) const;
 
+	/** Given locations in world space, return the input keys closest to each of them. Large batches are split across worker threads. */
+	void FindInputKeysClosestToWorldLocations(TArrayView<const FVector> WorldLocations, TArrayView<float> OutInputKeys) const;
+
 	/** Given a location, in world space, return the point on the curve that is closest to the location. */
 	UFUNCTION(BlueprintCallable, Category=Spline)
 	FVector FindLocationClosestToWorldLocation(const FVector& WorldLocation, ESplineCoordinateSpace::Type CoordinateSpace) const;
@@ -215,6 +215,9 @@ public:
 	/** Same as UpdateMesh, but does not wait until the end of frame and can be used in non-game threads */
 	void UpdateMesh_Concurrent();
 
+	/** UpdateMesh for many spline meshes, e.g. the segments of a road, with their new deformation parameters sent to the render thread in one command */
+	static void UpdateMeshes(TArrayView<USplineMeshComponent* const> Components);
+
 	/** Get the start position of spline in local space */
 	UFUNCTION(BlueprintCallable, Category = SplineMesh)
 	FVector GetStartPosition() const;
@@ -357,6 +360,7 @@ public:
 
 private:
 	void UpdateRenderStateAndCollision_Internal(bool bConcurrent);
+	void UpdateRenderStateAndCollision_Internal(bool bConcurrent, TArray<struct FSplineMeshProxyUpdate>& OutProxyUpdates);
 };
 
 /** Used to store spline mesh data during RerunConstructionScripts */
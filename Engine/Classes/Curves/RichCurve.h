@@ -294,6 +294,15 @@ public:
 	/** Evaluate this rich curve at the specified time */
 	virtual float Eval(float InTime, float InDefaultValue = 0.0f) const final override;
 
+	/**
+	 * Evaluate this rich curve at the specified time, starting the key search from the keys found by the previous call.
+	 * Callers evaluating at increasing times, e.g. once per frame, skip the binary search. Initialize the hint to INDEX_NONE.
+	 */
+	float EvalWithKeyHint(float InTime, int32& InOutKeyHint, float InDefaultValue = 0.0f) const;
+
+	/** Evaluate this rich curve at each of the specified times, which are fastest to evaluate sorted */
+	void EvalBatch(TArrayView<const float> InTimes, TArrayView<float> OutValues, float InDefaultValue = 0.0f) const;
+
 	/** Auto set tangents for any 'auto' keys in curve */
 	void AutoSetTangents(float Tension = 0.f);
 
@@ -320,6 +329,7 @@ public:
 private:
 	void RemoveRedundantKeysInternal(float Tolerance, int32 InStartKeepKey, int32 InEndKeepKey);
 	virtual int32 GetKeyIndex(float KeyTime, float KeyTimeTolerance) const override final;
+	float EvalInternal(float InTime, float InDefaultValue, int32* InOutKeyHint) const;
 
 public:
 
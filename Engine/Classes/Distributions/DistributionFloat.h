@@ -67,6 +67,21 @@ public:
 		*/
 	float GetValue(float F=0.0f, UObject* Data=NULL, struct FRandomStream* InRandomStream = NULL);
 
+	/**
+		* Get the value at the specified F through FastDistribution, the result of GetFastRawDistribution, if it is set.
+		* Lets update loops look for the lookup table once instead of once per particle.
+		*/
+	FORCEINLINE float GetValueFast(const FRawDistribution* FastDistribution, float F, UObject* Data)
+	{
+		if (FastDistribution)
+		{
+			float Value;
+			FastDistribution->GetValue1None(F, &Value);
+			return Value;
+		}
+		return GetValue(F, Data);
+	}
+
 	/**
 		* Get the min and max values
 		*/
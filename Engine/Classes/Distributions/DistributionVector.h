@@ -106,6 +106,21 @@ public:
 	*/
 	FVector GetValue(float F=0.0f, UObject* Data=NULL, int32 LastExtreme=0, struct FRandomStream* InRandomStream = NULL);
 
+	/**
+	* Get the value at the specified F through FastDistribution, the result of GetFastRawDistribution, if it is set.
+	* Lets update loops look for the lookup table once instead of once per particle.
+	*/
+	FORCEINLINE FVector GetValueFast(const FRawDistribution* FastDistribution, float F, UObject* Data)
+	{
+		if (FastDistribution)
+		{
+			FVector Value;
+			FastDistribution->GetValue3None(F, &Value.X);
+			return Value;
+		}
+		return GetValue(F, Data);
+	}
+
 	/**
 	* Get the min and max values
 	*/
@@ -114,6 +114,9 @@ public:
 	TArray< class FOutBunch * >			QueuedExportBunches;				// Bunches that need to be appended to the export list on the next SendBunch call. This list is used for queued RPC's.
 	bool								bHoldQueuedExportBunchesAndGUIDs;	// Don't export QueuedExportBunches or QueuedMustBeMappedGuidsInLastBunch if this is true
 
+	class FNetBitWriter*				BatchedRemoteFunctions = nullptr;	// Unreliable function content blocks waiting to be sent together by FlushBatchedRemoteFunctions
+	TArray< FNetworkGUID >				BatchedMustBeMappedGuids;			// Must be mapped guids for the functions in BatchedRemoteFunctions
+
 #if !UE_BUILD_SHIPPING
 	/** Whether or not to block sending of NMT_ActorChannelFailure (for NetcodeUnitTest) */
 	bool bBlockChannelFailure;
@@ -177,6 +180,12 @@ public:
 	/** Queue a function bunch for this channel to be sent on the next property update. */
 	void QueueRemoteFunctionBunch( UObject* CallTarget, UFunction* Func, FOutBunch &Bunch );
 
+	/** Append an unreliable function bunch to this channel's batch. Batched functions are sent together in a single bunch when the connection ticks. See net.BatchUnreliableRPCs. */
+	void BatchRemoteFunctionBunch( FOutBunch &Bunch );
+
+	/** Send any batched unreliable functions as a single bunch. Must be called before writing anything else to this channel so ordering is preserved. */
+	void FlushBatchedRemoteFunctions();
+
 	/** If not queueing the RPC, prepare the channel for replicating the call.  */
 	void PrepareForRemoteFunction(UObject* TargetObj);
 	
@@ -316,6 +325,9 @@ protected:
 
 	bool ObjectHasReplicator(const TWeakObjectPtr<UObject>& Obj) const;	// returns whether we have already created a replicator for this object or not
 
+	/** Replicates the actor's registered subobject list, skipping dirty tracked entries that have nothing new to send. See AActor::AddReplicatedSubObject */
+	bool ReplicateRegisteredSubObjects(FOutBunch& Bunch, const FReplicationFlags& RepFlags);
+
 	/** Unmap all references to this object, so that if later we receive this object again, we can remap the original references */
 	void MoveMappedObjectToUnmapped( const UObject* Object );
 
@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+
+#include "ActorRegistrySubsystem.generated.h"
+
+class AActor;
+class ULevel;
+
+/**
+ * The Actor registry subsystem keeps the live actors of a game world bucketed by their exact class, in dense arrays that are
+ * kept up to date as actors are spawned and destroyed and as levels are streamed in and out. Class queries only visit the buckets
+ * of matching classes instead of every actor in every level, which is what TActorIterator does.
+ *
+ * Queries apply the same filter as TActorIterator with its default flags (active levels only, pending kill actors skipped),
+ * but the order in which actors are visited is not the order of the level actor lists.
+ */
+UCLASS()
+class ENGINE_API UActorRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Calls Operation on every registered actor that is of class ActorClass or of one of its children.
+	 * Return false from Operation to stop the iteration.
+	 * Actors must not be spawned or destroyed from inside Operation.
+	 */
+	void ForEachActorOfClass(TSubclassOf<AActor> ActorClass, TFunctionRef<bool(AActor*)> Operation) const;
+
+	/** Typed version of ForEachActorOfClass */
+	template<typename ActorType>
+	void ForEachActor(TFunctionRef<bool(ActorType*)> Operation) const
+	{
+		ForEachActorOfClass(ActorType::StaticClass(), [&Operation](AActor* Actor) { return Operation(static_cast<ActorType*>(Actor)); });
+	}
+
+	/** Appends every registered actor that is of class ActorClass or of one of its children to OutActors */
+	void GetActorsOfClass(TSubclassOf<AActor> ActorClass, TArray<AActor*>& OutActors) const;
+
+	/** Returns the number of registered actors of class ActorClass or of one of its children, without filtering by level or pending kill */
+	int32 GetNumActorsOfClass(TSubclassOf<AActor> ActorClass) const;
+
+	/** Starts tracking an actor, no-op if it already is */
+	void AddActor(AActor* Actor);
+
+	/** Stops tracking an actor, no-op if it is not tracked */
+	void RemoveActor(AActor* Actor);
+
+	/** Tracks every actor currently in the level's actor list */
+	void AddLevelActors(ULevel* Level);
+
+	/** Stops tracking every actor of the level */
+	void RemoveLevelActors(ULevel* Level);
+
+	/** Logs the number of actors in each class bucket */
+	void Dump() const;
+
+	//~USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+private:
+
+	/** Live actors of one exact class */
+	struct FClassBucket
+	{
+		UClass* Class;
+		TArray<AActor*> Actors;
+	};
+
+	/** Where an actor lives in the buckets, for swap removal */
+	struct FActorLocation
+	{
+		int32 BucketIndex;
+		int32 ActorIndex;
+	};
+
+	void OnActorSpawned(AActor* Actor);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+	void OnPreGarbageCollect();
+
+	/** Returns the indices of the buckets whose class is ActorClass or a child of it, building and caching the list the first time a class is queried */
+	const TArray<int32>& GetMatchingBuckets(UClass* ActorClass) const;
+
+	/** Same level filter as TActorIterator's OnlyActiveLevels */
+	static bool IsLevelActive(const ULevel* Level);
+
+	/** Drops pending kill actors and empty buckets so that no raw pointer outlives its object across garbage collection */
+	void Compact();
+
+	TArray<FClassBucket> Buckets;
+	TMap<UClass*, int32> BucketIndexByClass;
+	TMap<AActor*, FActorLocation> ActorLocations;
+
+	/** Query class to matching bucket indices. Cleared whenever buckets are added or removed */
+	mutable TMap<UClass*, TArray<int32>> MatchingBucketsCache;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle PreGarbageCollectHandle;
+};
@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Stats/Stats.h"
+
+#include "AnimationPoseSharingSubsystem.generated.h"
+
+class AActor;
+class USkeletalMesh;
+class USkeletalMeshComponent;
+class UAnimSequenceBase;
+
+/**
+ * The animation pose sharing subsystem lets many skeletal mesh components show the same few evaluated poses.
+ * For every registered setup it evaluates one hidden leader component per state and time bucket, each playing the
+ * state's animation with its start offset by a fraction of the animation length. Followers are attached to a leader
+ * through the master pose component and evaluate nothing themselves; they are spread across the buckets so that a
+ * crowd in the same state doesn't move in lockstep.
+ *
+ * Followers close to a player view are promoted back to their own animation, and demoted again once they move out
+ * of PromotionDistance. Followers are re-evaluated a slice at a time, and leaders only tick while they have followers.
+ */
+UCLASS(config=Engine)
+class ENGINE_API UAnimationPoseSharingSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UAnimationPoseSharingSubsystem();
+
+	/**
+	 * Creates the leader components of a sharing setup and returns the index to add followers with.
+	 *
+	 * @param SkeletalMesh		Mesh the leaders are evaluated with, followers need a mesh of the same skeleton
+	 * @param StateAnimations	Looping animation played for each state
+	 * @param NumTimeBuckets	Number of leaders per state, each starting its animation at a different time
+	 */
+	int32 RegisterSetup(USkeletalMesh* SkeletalMesh, const TArray<UAnimSequenceBase*>& StateAnimations, int32 NumTimeBuckets);
+
+	/** Starts sharing a pose of the given setup with Component, in state 0 */
+	void AddFollower(int32 SetupIndex, USkeletalMeshComponent* Component);
+
+	/** Stops sharing a pose with Component, which evaluates its own animation again */
+	void RemoveFollower(USkeletalMeshComponent* Component);
+
+	/**
+	 * Moves a follower to another state.
+	 *
+	 * @param StateTime		If not negative, the follower uses the bucket whose current time is nearest to this time in the state's
+	 *						animation, e.g. to continue a pose. Otherwise the follower keeps its bucket.
+	 */
+	void SetFollowerState(USkeletalMeshComponent* Component, int32 StateIndex, float StateTime = -1.f);
+
+	/** Returns the number of followers, promoted or not */
+	int32 GetNumFollowers() const { return Followers.Num(); }
+
+	/** Logs the setups and how many followers each leader has */
+	void Dump() const;
+
+	/** Followers within this distance of a player view evaluate their own animation, 0 never promotes */
+	UPROPERTY(config)
+	float PromotionDistance;
+
+	/** Seconds it takes to re-evaluate the promotion of every follower once */
+	UPROPERTY(config)
+	float UpdatePeriod;
+
+protected:
+
+	//~FTickableGameObject interface
+	ETickableTickType GetTickableTickType() const override;
+	bool IsTickable() const override;
+	UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	void Tick(float DeltaTime) override;
+	TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UAnimationPoseSharingSubsystem, STATGROUP_Tickables); }
+	//~End of FTickableGameObject interface
+
+	//~USubsystem interface
+	bool ShouldCreateSubsystem(UObject* Outer) const override;
+	void Deinitialize() override;
+	//~End of USubsystem interface
+
+private:
+
+	struct FLeader
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> Component;
+		int32 NumFollowers;
+	};
+
+	struct FSetup
+	{
+		TWeakObjectPtr<AActor> LeaderActor;
+		int32 NumStates;
+		int32 NumTimeBuckets;
+
+		/** NumTimeBuckets leaders per state, states one after the other */
+		TArray<FLeader> Leaders;
+	};
+
+	struct FFollower
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> Component;
+		int32 SetupIndex;
+		int32 StateIndex;
+		int32 TimeBucket;
+		bool bPromoted;
+	};
+
+	int32 GetLeaderIndex(const FFollower& Follower) const { return Follower.StateIndex * Setups[Follower.SetupIndex].NumTimeBuckets + Follower.TimeBucket; }
+
+	/** Sets the follower's leader as its master pose component and counts it on the leader, DetachFollower undoes it */
+	void AttachFollower(FFollower& Follower);
+	void DetachFollower(FFollower& Follower);
+
+	void RemoveFollowerAt(int32 FollowerIndex);
+
+	TArray<FSetup> Setups;
+	TArray<FFollower> Followers;
+	TMap<TWeakObjectPtr<USkeletalMeshComponent>, int32> FollowerIndexByComponent;
+
+	/** Index of the next follower to evaluate, evaluation wraps around the list every UpdatePeriod */
+	int32 NextUpdateIndex;
+
+	/** Fractional number of followers left over from the previous frame's slice */
+	float PendingUpdates;
+};
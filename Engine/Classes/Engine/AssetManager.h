@@ -697,6 +697,9 @@ protected:
 	UPROPERTY()
 	int32 NumberOfSpawnedNotifications;
 
+	/** Names of the blueprint classes, gathered once per bulk scan instead of once per scanned type */
+	TArray<FName> BulkScanBlueprintCoreClassNames;
+
 	/** Redirector maps loaded out of AssetMigrations.ini */
 	TMap<FName, FName> PrimaryAssetTypeRedirects;
 	TMap<FString, FString> PrimaryAssetIdRedirects;
@@ -803,6 +803,15 @@ protected:
 	*/
 	static void InitArrayPropertyFromCustomList(const FArrayProperty* ArrayProperty, const FCustomPropertyListNode* InPropertyList, uint8* DataPtr, const uint8* DefaultDataPtr);
 
+	/**
+	* Helper method to assist with initializing the property of a single node of a property list.
+	*
+	* @param	InPropertyNode		the node whose property will be copied from defaults
+	* @param	DataPtr				destination address (where to start copying values to)
+	* @param	DefaultDataPtr		source address (where to start copying the defaults data from)
+	*/
+	static void InitPropertyFromCustomListNode(const FCustomPropertyListNode* InPropertyNode, uint8* DataPtr, const uint8* DefaultDataPtr);
+
 	/** Check for and handle manual application of default value overrides to component subobjects that were inherited from a nativized parent class */
 	static void CheckAndApplyComponentTemplateOverrides(UObject* InClassDefaultObject);
 
@@ -862,9 +871,18 @@ protected:
 	/** Internal helper method used to recursively build a custom property list from an array property used for post-construct initialization. */
 	bool BuildCustomArrayPropertyListForPostConstruction(FArrayProperty* ArrayProperty, FCustomPropertyListNode*& InPropertyList, const uint8* DataPtr, const uint8* DefaultDataPtr, int32 StartIndex = 0);
 
+	/** Internal helper method used to recursively split the custom property list into memory ranges and nodes, BaseOffset is the offset of InPropertyList's struct in the object. */
+	void CompileCustomPropertyListForPostConstruction(const FCustomPropertyListNode* InPropertyList, int32 BaseOffset);
+
 private:
 	/** List of native class-owned properties that differ from defaults. This is used to optimize property initialization during post-construction by minimizing the number of native class-owned property values that get copied to the new instance. */
 	TIndirectArray<FCustomPropertyListNode> CustomPropertyListForPostConstruction;
+
+	/** Offsets and sizes of the memory ranges holding the plain old data values of the custom property list, adjacent values merged. Copied as-is during post-construction. */
+	TArray<TPair<int32, int32>> CustomPropertyCopyRangesForPostConstruction;
+
+	/** Nodes of the custom property list that aren't plain old data, with the offset of the struct they belong to in the object. */
+	TArray<TPair<const FCustomPropertyListNode*, int32>> CustomPropertyNodesForPostConstruction;
 	/** In some cases UObject::ConditionalPostLoad() code calls PostLoadDefaultObject() on a class that's still being serialized. */
 	FCriticalSection SerializeAndPostLoadCritical;
 };
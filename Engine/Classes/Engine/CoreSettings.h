@@ -132,6 +132,18 @@ extern ENGINE_API float GLevelStreamingActorsUpdateTimeLimit;
 extern ENGINE_API float GPriorityLevelStreamingActorsUpdateExtraTime;
 /** Batching granularity used to register actor components during level streaming. */
 extern ENGINE_API int32 GLevelStreamingComponentsRegistrationGranularity;
+/** Whether render proxies created while registering components during level streaming are added to the scene in one batch per frame. */
+extern ENGINE_API int32 GLevelStreamingBatchRenderStateCreation;
+/** Whether physics state is created in a separate time-sliced step after component registration during level streaming. */
+extern ENGINE_API int32 GLevelStreamingDeferPhysicsStateCreation;
+/** Maximum time to spend creating deferred physics state during level streaming (ms per frame). If this is zero only the overall actor update limit applies. */
+extern ENGINE_API float GLevelStreamingPhysicsStateTimeLimit;
+/** Whether initial overlaps are updated in a separate time-sliced step after actors begin play during level streaming. */
+extern ENGINE_API int32 GLevelStreamingDeferInitialOverlaps;
+/** Maximum time to spend updating deferred initial overlaps during level streaming (ms per frame). If this is zero only the overall actor update limit applies. */
+extern ENGINE_API float GLevelStreamingInitialOverlapsTimeLimit;
+/** Whether the navigation data chunks of a streaming level are prepared on worker threads while the level is being made visible. */
+extern ENGINE_API int32 GLevelStreamingAsyncPrepareNavigationData;
 /** Batching granularity used to unregister actor components during level streaming.  */
 extern ENGINE_API int32 GLevelStreamingComponentsUnregistrationGranularity;
 /** Maximum allowed time to spend for actor unregistration steps during level streaming (ms per frame). If this is 0.0 then we don't timeslice.*/
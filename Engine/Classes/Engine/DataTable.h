@@ -79,6 +79,13 @@ protected:
 
 	/** Called to add rows to the data table */
 	ENGINE_API virtual void AddRowInternal(FName RowName, uint8* RowDataPtr);
+
+	/** Destroys a row and frees it, unless it lives in LoadedRowBlock */
+	void FreeRowData(UScriptStruct& UsingStruct, uint8* RowData);
+
+	/** Single allocation holding every row loaded from a cooked package, in load order. Freed with the table */
+	uint8* LoadedRowBlock = nullptr;
+	SIZE_T LoadedRowBlockSize = 0;
 public:
 
 	virtual const TMap<FName, uint8*>& GetRowMap() const { return RowMap; }
@@ -37,6 +37,8 @@ DECLARE_MULTICAST_DELEGATE(FOnDemoFinishRecordingDelegate);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPauseChannelsDelegate, const bool /* bPaused */);
 
+DECLARE_DELEGATE_RetVal_OneParam(bool, FFilterReplayViewerDelegate, const UNetConnection* /* Connection */);
+
 class FQueuedReplayTask : public TSharedFromThis<FQueuedReplayTask>
 {
 public:
@@ -525,6 +527,9 @@ public:
 	/** PlaybackPackets are used to buffer packets up when we read a demo frame, which we can then process when the time is right */
 	TArray<FPlaybackPacket> PlaybackPackets;
 
+	/** Data buffers of processed playback packets, reused when reading new packets. See demo.PlaybackPacketBufferPoolSize. */
+	TArray<TArray<uint8>> FreePlaybackPacketBuffers;
+
 	/**
 	 * During recording, all unique streaming levels since recording started.
 	 * During playback, all streaming level instances we've created.
@@ -590,6 +595,9 @@ private:
 	/** A player controller that this driver should consider its viewpoint for actor prioritization purposes. */
 	TWeakObjectPtr<APlayerController> ViewerOverride;
 
+	/** When bound, only actors relevant to client connections passing this filter are recorded. See SetReplayViewerFilter. */
+	FFilterReplayViewerDelegate ReplayViewerFilter;
+
 	/** Array of prioritized actors, used in TickDemoRecord. Stored as a member so that its storage doesn't have to be re-allocated each frame. */
 	TArray<FDemoActorPriority> PrioritizedActors;
 
@@ -693,6 +701,12 @@ public:
 	/** Sets the controller to use as the viewpoint for recording prioritization purposes. */
 	void SetViewerOverride(APlayerController* const InViewerOverride ) { ViewerOverride = InViewerOverride; }
 
+	/**
+	 * Limits recording to actors relevant to the server's client connections that pass the filter (e.g. a single team or squad),
+	 * regardless of demo.UseNetRelevancy. Unbind to go back to the default behavior.
+	 */
+	void SetReplayViewerFilter(const FFilterReplayViewerDelegate& InReplayViewerFilter) { ReplayViewerFilter = InReplayViewerFilter; }
+
 	/** Enable or disable prioritization of actors for recording. */
 	void SetActorPrioritizationEnabled(const bool bInPrioritizeActors) { bPrioritizeActors = bInPrioritizeActors; }
 
@@ -726,6 +740,9 @@ public:
 	bool ConditionallyProcessPlaybackPackets();
 	void ProcessAllPlaybackPackets();
 
+	/** Removes the first Count packets from PlaybackPackets, keeping their data buffers for reuse. */
+	void RemoveProcessedPlaybackPackets(int32 Count);
+
 private:
 
 	// Possible values returned by ReadPacket.
@@ -1235,6 +1252,12 @@ protected:
 	void CacheNetGuids();
 	bool SerializeGuidCache(const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
 
+	/** Resolves NetGuidCacheSnapshot on the game thread and starts serializing it on a background task. See demo.AsyncCheckpointGuidCache. */
+	void StartAsyncGuidCacheSerialization();
+
+	/** Appends the result of StartAsyncGuidCacheSerialization to the checkpoint. Returns false while the task is still running. */
+	bool FinishAsyncGuidCacheSerialization(FArchive* CheckpointArchive);
+
 	void NotifyDemoPlaybackFailure(EDemoPlayFailure::Type FailureType);
 
 	TArray<FQueuedDemoPacket> QueuedPacketsBeforeTravel;
@@ -1292,5 +1315,26 @@ private:
 	int32 NextNetGuidForRecording;
 	int32 NumNetGuidsForRecording;
 	FArchivePos NetGuidsCountPos;
+
+	/** A net guid cache entry with everything that needs UObjects resolved, so it can be written off the game thread. */
+	struct FAsyncNetGuidCacheItem
+	{
+		FNetworkGUID NetGuid;
+		FNetworkGUID OuterGUID;
+		FName ObjectName;
+		FString RemappedPathName;	// Only set when NetworkRemapPath changed the name
+		uint32 NetworkChecksum;
+		uint8 Flags;
+	};
+
+	/** Shared with the background task, so the driver can go away while it's still running. */
+	struct FAsyncGuidCacheSerialization
+	{
+		TArray<FAsyncNetGuidCacheItem> Items;
+		TArray<uint8> Data;
+		FThreadSafeBool bCompleted;
+	};
+
+	TSharedPtr<FAsyncGuidCacheSerialization, ESPMode::ThreadSafe> AsyncGuidCacheSerialization;
 /////////////////////////////////////////////////////////////////////////
 };
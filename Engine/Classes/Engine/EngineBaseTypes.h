@@ -161,6 +161,21 @@ struct FTickPrerequisite
 	}
 };
 
+/** Data a tick function declares it reads or writes while ticking, see FTickFunction::SetTickAccess */
+enum class ETickAccess : uint8
+{
+	None			= 0,
+	/** Transforms of the owning actor and its components */
+	ActorTransform	= 1 << 0,
+	/** Movement state of the owning actor, such as velocity and movement components */
+	ActorMovement	= 1 << 1,
+	/** Any other state of the owning actor and its components */
+	ActorState		= 1 << 2,
+	/** Anything outside of the owning actor */
+	World			= 1 << 3,
+};
+ENUM_CLASS_FLAGS(ETickAccess);
+
 /** 
 * Abstract Base class for all tick functions.
 **/
@@ -213,6 +228,13 @@ public:
 	/** If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks" **/
 	uint8 bRunOnAnyThread:1;
 
+	/**
+	 * If true and tick.AllowBatchedTicks is enabled, this tick may run in a single task together with other tick functions of the same class and tick group
+	 * instead of getting its own task. Only ticks without prerequisites are batched. Ticks that depend on this one wait for the whole batch.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Tick", AdvancedDisplay)
+	uint8 bAllowTickBatching:1;
+
 private:
 
 	enum class ETickState : uint8
@@ -229,6 +251,13 @@ private:
 	 **/
 	ETickState TickState;
 
+	/** Whether SetTickAccess was called, see HasDeclaredTickAccess */
+	uint8 bHasDeclaredTickAccess:1;
+
+	/** Data this function reads and writes while ticking, see SetTickAccess */
+	ETickAccess TickReads;
+	ETickAccess TickWrites;
+
 public:
 	/** The frequency in seconds at which this tick function will be executed.  If less than or equal to 0 then it will tick every frame */
 	UPROPERTY(EditDefaultsOnly, Category="Tick", meta=(DisplayName="Tick Interval (secs)"))
@@ -250,6 +279,9 @@ private:
 		/** Cache whether this function was rescheduled as an interval function during StartParallel */
 		bool bWasInterval:1;
 
+		/** Whether TaskPointer points to the batch task this function was queued into rather than its own task */
+		bool bTaskIsBatched:1;
+
 		/** Internal data that indicates the tick group we actually started in (it may have been delayed due to prerequisites) **/
 		TEnumAsByte<enum ETickingGroup> ActualStartTickGroup;
 
@@ -371,6 +403,33 @@ public:
 
 	float GetLastTickGameTime() const { return (InternalData ? InternalData->LastTickGameTimeSeconds : -1.f); }
 
+	/**
+	 * Declares everything this tick reads and writes. When tick.AllowDeclaredAccessParallelTicks is enabled, declared ticks run on worker threads,
+	 * and declared ticks that conflict (one writes what the other reads or writes, on the same actor or both on World) run in queue order.
+	 * Undeclared ticks are not ordered against declared ones, so everything touching the declared data must declare it too.
+	 * Declared ticks are kept within their start tick group.
+	 */
+	void SetTickAccess(ETickAccess InReads, ETickAccess InWrites)
+	{
+		bHasDeclaredTickAccess = true;
+		TickReads = InReads | InWrites;
+		TickWrites = InWrites;
+	}
+
+	/** Removes the declaration done by SetTickAccess, the tick goes back to running as configured by bRunOnAnyThread */
+	void ClearTickAccess()
+	{
+		bHasDeclaredTickAccess = false;
+		TickReads = ETickAccess::None;
+		TickWrites = ETickAccess::None;
+	}
+
+	/** Returns whether SetTickAccess was called */
+	bool HasDeclaredTickAccess() const { return bHasDeclaredTickAccess; }
+
+	ETickAccess GetTickReads() const { return TickReads; }
+	ETickAccess GetTickWrites() const { return TickWrites; }
+
 private:
 	/**
 	 * Queues a tick function for execution from the game thread
@@ -415,6 +474,12 @@ private:
 	{
 		return NAME_None;
 	}
+
+	/** Object that the Actor* flags of SetTickAccess refer to, normally the owning actor. Ticks with no scope only conflict through World */
+	virtual const UObject* GetTickAccessScope() const
+	{
+		return nullptr;
+	}
 	
 	friend class FTickTaskSequencer;
 	friend class FTickTaskManager;
@@ -456,6 +521,7 @@ struct FActorTickFunction : public FTickFunction
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage() override;
 	ENGINE_API virtual FName DiagnosticContext(bool bDetailed) override;
+	ENGINE_API virtual const UObject* GetTickAccessScope() const override;
 };
 
 template<>
@@ -489,6 +555,7 @@ struct FActorComponentTickFunction : public FTickFunction
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage() override;
 	ENGINE_API virtual FName DiagnosticContext(bool bDetailed) override;
+	ENGINE_API virtual const UObject* GetTickAccessScope() const override;
 
 	/**
 	 * Conditionally calls ExecuteTickFunc if registered and a bunch of other criteria are met
@@ -73,6 +73,19 @@ struct ENGINE_API FLatentActionManager
 		/** Map of UUID->Action(s). */
 		FActionList ActionList;
 		bool bProcessedThisFrame = false;
+
+		/** Sum of the delta times this object's actions were processed with. Waiting actions are scheduled against it */
+		double ElapsedTime = 0.0;
+
+		/** Clock time before which none of the actions need an update, 0 if some action is updated every frame */
+		double NextUpdateTime = 0.0;
+
+		/** Advances the clock, returns true if any action is due for an update */
+		bool AdvanceClock(float DeltaTime)
+		{
+			ElapsedTime += DeltaTime;
+			return NextUpdateTime <= ElapsedTime;
+		}
 	};
 	
 	/** Map to convert from object to FActionList. */
@@ -152,6 +165,13 @@ public:
 	 */
 	void AddNewAction(UObject* InActionObject, int32 UUID, FPendingLatentAction* NewAction);
 
+	/**
+	 * To be called after resetting the state of an action found with FindExistingAction.
+	 * If the action was waiting (see FLatentResponse::WaitFor), the wait is cancelled and the time that passed during it is discarded,
+	 * so the action is updated again from the next frame with the usual delta time.
+	 */
+	void RestartAction(UObject* InActionObject, FPendingLatentAction* Action);
+
 	/** Resets the list of objects we have processed the latent action list for.	 */	
 	void BeginFrame();
 
@@ -206,14 +226,14 @@ protected:
 	}
 
 	/** 
-	  * Ticks the latent action for a single UObject.
+	  * Ticks the latent actions of a single UObject that are due, skipping the ones that are still waiting.
 	  *
 	  * @param		DeltaTime			time delta.
-	  * @param		ObjectActionList	the action list for the object
+	  * @param		ObjectActions		the actions for the object, with its clock already advanced by DeltaTime
 	  * @param		InObject			the object itself.
 	  *
 	  */
-	void TickLatentActionForObject(float DeltaTime, FActionList& ObjectActionList, UObject* InObject);
+	void TickLatentActionForObject(float DeltaTime, FObjectActions& ObjectActions, UObject* InObject);
 
 protected:
 	/**List of actions that will be unconditionally removed at the begin of next tick */
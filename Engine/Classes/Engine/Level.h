@@ -606,12 +606,20 @@ public:
 	uint8										bHasRerunConstructionScripts:1;
 	/** Whether the level had its actor cluster created. This doesn't mean that the creation was successful. */
 	uint8										bActorClusterCreated : 1;
+	/** Whether component registration skips physics state, leaving it to IncrementalCreatePhysicsState.	*/
+	uint8										bDeferComponentPhysicsState:1;
+	/** Whether actors beginning play from streaming skip initial overlaps, leaving them to IncrementalUpdateInitialOverlaps. */
+	uint8										bDeferInitialOverlaps:1;
 	/** Whether the actor referenced by CurrentActorIndexForUpdateComponents has called PreRegisterAllComponents */
 	uint8										bHasCurrentActorCalledPreRegister;
 	/** Current index into actors array for updating components.							*/
 	int32										CurrentActorIndexForUpdateComponents;
 	/** Current index into actors array for updating components.							*/
 	int32										CurrentActorIndexForUnregisterComponents;
+	/** Current index into actors array for creating deferred physics state.				*/
+	int32										CurrentActorIndexForPhysicsState;
+	/** Current index into actors array for updating deferred initial overlaps.				*/
+	int32										CurrentActorIndexForInitialOverlaps;
 
 
 	/** Whether the level is currently pending being made visible.							*/
@@ -777,6 +785,22 @@ public:
 	 */
 	void IncrementalUpdateComponents( int32 NumComponentsToUpdate, bool bRerunConstructionScripts, FRegisterComponentContext* Context = nullptr);
 
+	/**
+	 * Creates the physics state that was skipped while registering components with bDeferComponentPhysicsState set.
+	 * Processes one actor per call.
+	 *
+	 * @return true once every actor has been processed, at which point bDeferComponentPhysicsState is cleared
+	 */
+	bool IncrementalCreatePhysicsState();
+
+	/**
+	 * Updates the initial overlaps that were skipped by actors beginning play with bDeferInitialOverlaps set.
+	 * Processes one actor per call.
+	 *
+	 * @return true once every actor has been processed, at which point bDeferInitialOverlaps is cleared
+	 */
+	bool IncrementalUpdateInitialOverlaps();
+
 	/**
 	* Incrementally unregisters all components of actors associated with this level.
 	* This is done at the granularity of actors (individual actors have all of their components unregistered)
@@ -20,6 +20,7 @@
 #include "ProfilingDebugging/Histogram.h"
 #include "Containers/ArrayView.h"
 #include "Containers/CircularBuffer.h"
+#include "Containers/Queue.h"
 #include "Net/Core/Trace/Config.h"
 #include "ReplicationDriver.h"
 #include "Analytics/EngineNetAnalytics.h"
@@ -233,6 +234,13 @@ struct FDelayedIncomingPacket
 #endif //#if DO_ENABLE_NET_TEST
 
 /** Record of channels with data written into each outgoing packet. */
+/** When an actor started and most recently was skipped during replication on a connection. See UNetConnection::GetStarvedActors. */
+struct FActorReplicationStarvation
+{
+	double StarvedSinceTime = 0.0;
+	double LastSkippedTime = 0.0;
+};
+
 struct FWrittenChannelsRecord
 {
 	enum { DefaultInitialSize = 1024 };
@@ -353,6 +361,16 @@ public:
 	/** Clears the actor starvation map */
 	void ResetActorsStarvedByClassTimeMap() { ActorsStarvedByClassTimeMap.Empty(); }
 
+	/** Returns the actors that were prioritized but not replicated on this connection, mapped to when they started being skipped. */
+	TMap<TWeakObjectPtr<AActor>, FActorReplicationStarvation>& GetStarvedActors() { return StarvedActors; }
+	const TMap<TWeakObjectPtr<AActor>, FActorReplicationStarvation>& GetStarvedActors() const { return StarvedActors; }
+
+	/**
+	 * Called when an actor that was previously skipped on this connection replicates again.
+	 * Removes it from the starved actors and records how long it waited.
+	 */
+	ENGINE_API void NotifyStarvedActorReplicated(AActor* Actor, double ElapsedTime);
+
 public:
 	// Connection information.
 
@@ -706,6 +724,9 @@ public:
 	/** A list of replicators that belong to recently dormant actors/objects */
 	TMap< UObject*, TSharedRef< FObjectReplicator > > DormantReplicatorMap;
 
+	/** Viewer locations from the last spatial dormancy wake up check (net.DormancyWakeUpDistance), this connection's viewer first followed by its children. */
+	TArray<FVector, TInlineAllocator<1>> DormancyWakeUpViewLocations;
+
 	
 
 	ENGINE_API FName GetClientWorldPackageName() const { return ClientWorldPackageName; }
@@ -1068,6 +1089,45 @@ public:
 	 */
 	ENGINE_API virtual void ReceivedRawPacket(void* Data,int32 Count);
 
+	/** Actor channels that have batched unreliable RPCs waiting to be sent. See UActorChannel::BatchRemoteFunctionBunch. */
+	TArray<class UActorChannel*> ChannelsWithBatchedRemoteFunctions;
+
+	/** Sends the batched unreliable RPCs for every channel in ChannelsWithBatchedRemoteFunctions. */
+	ENGINE_API void FlushBatchedRemoteFunctions();
+
+	/**
+	 * Returns a copy of Source to keep on a channel's reliable buffer, reusing a previously released bunch (and its payload allocation) when possible.
+	 * Must be released with ReleaseReliableOutBunch. See net.BunchPoolSize.
+	 */
+	ENGINE_API FOutBunch* AllocReliableOutBunch(const FOutBunch& Source);
+
+	/** Returns a bunch from AllocReliableOutBunch to the pool, or deletes it if the pool is full. */
+	ENGINE_API void ReleaseReliableOutBunch(FOutBunch* Bunch);
+
+	/** Returns a copy of Source to queue on a channel, reusing previously released bunch memory when possible. Must be released with ReleaseInBunch. */
+	ENGINE_API FInBunch* AllocInBunch(FInBunch& Source);
+
+	/** Returns a bunch from AllocInBunch to the pool, or deletes it if the pool is full. */
+	ENGINE_API void ReleaseInBunch(FInBunch* Bunch);
+
+	/**
+	 * @return Whether DecodeRawPacket_AnyThread can be used for this connection right now.
+	 * Connection classes that need their ReceivedRawPacket override to see every packet should return false.
+	 */
+	ENGINE_API virtual bool CanDecodeRawPacketsAsync() const;
+
+	/**
+	 * Runs PacketHandler processing for a raw packet and queues the result to be applied by ProcessDecodedRawPackets.
+	 * This may be called from a worker thread, as long as nothing else is sending or receiving on this connection at the same time.
+	 * Packets are applied in the order they were decoded.
+	 *
+	 * @see UNetDriver::ReceiveRawPackets
+	 */
+	ENGINE_API void DecodeRawPacket_AnyThread(uint8* Data, int32 Count);
+
+	/** Applies any packets queued by DecodeRawPacket_AnyThread. Must be called on the game thread. */
+	ENGINE_API void ProcessDecodedRawPackets();
+
 	/** Send a raw bunch */
 	ENGINE_API int32 SendRawBunch(FOutBunch& Bunch, bool InAllowMerge, const FNetTraceCollector* BunchCollector);
 	inline int32 SendRawBunch( FOutBunch& Bunch, bool InAllowMerge ) { return SendRawBunch(Bunch, InAllowMerge, nullptr); }
@@ -1267,6 +1327,22 @@ public:
 	 */
 	ENGINE_API void TrackReplicationForAnalytics(const bool bWasSaturated);
 
+	/** Called when replicating actors for this connection stopped early because its byte or CPU budget ran out. */
+	ENGINE_API void TrackBudgetLimitedReplicationForAnalytics();
+
+	/**
+	 * Returns the current starvation analytics and resets them.
+	 * This would be similar to calls to Get and Reset separately, except that the caller
+	 * will assume ownership of data in this case.
+	 */
+	ENGINE_API void ConsumeStarvationAnalytics(FNetConnectionStarvationAnalytics& Out);
+
+	/** Returns the current starvation analytics. */
+	ENGINE_API const FNetConnectionStarvationAnalytics& GetStarvationAnalytics() const;
+
+	/** Resets the current starvation analytics. */
+	ENGINE_API void ResetStarvationAnalytics();
+
 	/**
 	 * Get the current number of sent packets for which we have received a delivery notification
 	 */
@@ -1305,6 +1381,19 @@ private:
 	UPROPERTY()
 	TArray<UChannel*> ChannelsToTick;
 
+	/** A raw packet that has been through PacketHandler processing by DecodeRawPacket_AnyThread. */
+	struct FDecodedRawPacket
+	{
+		TArray<uint8> Data;
+		bool bHandlerError = false;
+	};
+
+	/** Packets decoded by DecodeRawPacket_AnyThread, waiting for ProcessDecodedRawPackets. The decoding thread is the only producer and the game thread the only consumer. */
+	TQueue<FDecodedRawPacket, EQueueMode::Spsc> DecodedRawPackets;
+
+	/** Handles a raw packet that has already been through PacketHandler processing. */
+	void ReceivedHandledRawPacket(uint8* Data, int32 Count);
+
 	/** Histogram of the received packet time */
 	FHistogram NetConnectionHistogram;
 
@@ -1372,6 +1461,9 @@ private:
 	/** A map of class names to arrays of time differences between replication of actors of that class for each connection */
 	TMap<FString, TArray<float>> ActorsStarvedByClassTimeMap;
 
+	/** Actors that were prioritized but skipped because this connection was saturated or out of budget. See GetStarvedActors. */
+	TMap<TWeakObjectPtr<AActor>, FActorReplicationStarvation> StarvedActors;
+
 	/** Tracks channels that we should ignore when handling special demo data. */
 	TMap<int32, FNetworkGUID> IgnoringChannels;
 	bool bIgnoreAlreadyOpenedChannels;
@@ -1426,6 +1518,16 @@ private:
 
 	FNetConnectionSaturationAnalytics SaturationAnalytics;
 	FNetConnectionPacketAnalytics PacketAnalytics;
+	FNetConnectionStarvationAnalytics StarvationAnalytics;
+
+	/** Released reliable out bunches, kept alive so their payload buffers can be reused. See AllocReliableOutBunch. */
+	TArray<FOutBunch*> FreeReliableOutBunches;
+
+	/** Memory of released (destructed) in bunches. See AllocInBunch. */
+	TArray<void*> FreeInBunchMemory;
+
+	/** Frees everything in FreeReliableOutBunches and FreeInBunchMemory. */
+	void EmptyBunchPools();
 
 	/** Whether or not PacketOrderCache is presently being flushed */
 	bool bFlushingPacketOrderCache;
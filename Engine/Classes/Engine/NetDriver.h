@@ -325,6 +325,7 @@ class FVoicePacket;
 class StatelessConnectHandlerComponent;
 class UNetConnection;
 class UReplicationDriver;
+class UNetUpdateFrequencyScheduler;
 struct FNetworkObjectInfo;
 class UChannel;
 class IAnalyticsProvider;
@@ -558,6 +559,41 @@ struct FCompareFActorPriority
 	}
 };
 
+/**
+ * Per-connection output of the parallel prioritization pass (net.ParallelPrioritizeConnections).
+ * Filled on a task graph worker, then consumed on the game thread by ServerReplicateActors.
+ * Anything that would mutate channels is recorded here instead of being applied on the worker.
+ */
+struct FConnectionPrioritizeResult
+{
+	class UNetConnection*			Connection = nullptr;
+
+	/** Viewers for this connection, built on the game thread before the parallel pass */
+	TArray<struct FNetViewer>		ConnectionViewers;
+
+	TArray<FActorPriority>			PriorityList;
+	TArray<FActorPriority*>			PriorityActors;
+
+	/** Owner-only channels that are no longer relevant and should be closed */
+	TArray<class UActorChannel*>	ChannelsToClose;
+
+	/** Channels whose actors want to start going dormant */
+	TArray<class UActorChannel*>	ChannelsToStartDormant;
+
+	int32							DeletedCount = 0;
+};
+
+/** A raw packet read from a socket that hasn't been handed to its connection yet. See UNetDriver::ReceiveRawPackets. */
+struct FReceivedRawPacket
+{
+	class UNetConnection*	Connection = nullptr;
+
+	/** Packet data. Must stay valid until ReceiveRawPackets returns. */
+	uint8*					Data = nullptr;
+
+	int32					Count = 0;
+};
+
 struct FActorDestructionInfo
 {
 public:
@@ -664,6 +700,10 @@ public:
 	UPROPERTY(Config)
 	FString ReplicationDriverClassName;
 
+	/** Used to specify the UNetUpdateFrequencyScheduler class that decides when actors are next considered for replication. Leave empty to use net.UseAdaptiveNetUpdateFrequency. */
+	UPROPERTY(Config)
+	FString NetUpdateFrequencySchedulerClassName;
+
 	/** @todo document */
 	UPROPERTY(Config)
 	int32 MaxDownloadSize;
@@ -751,6 +791,9 @@ public:
 	 */
 	FConnectionMap MappedClientConnections;
 
+	/** ClientConnections indexed by their ConnectionId, for GetConnectionById. Entries of removed connections are nullptr. */
+	TArray<UNetConnection*> ClientConnectionsById;
+
 	/** Tracks recently disconnected client IP's, and the disconnect time - so they can be cleaned from MappedClientConnections */
 	TArray<FDisconnectedClient> RecentlyDisconnectedClients;
 
@@ -1058,6 +1101,9 @@ public:
 	TSet< FObjectReplicator* >							UnmappedReplicators;
 	TSet< FObjectReplicator* >							AllOwnedReplicators;
 
+	/** Replicators whose RepNotifies are called once at the end of the dispatch, see net.CoalesceRepNotifies */
+	TSet< FObjectReplicator* >							RepNotifyPendingReplicators;
+
 	/** Handles to various registered delegates */
 	FDelegateHandle TickDispatchDelegateHandle;
 	FDelegateHandle PostTickDispatchDelegateHandle;
@@ -1255,6 +1301,13 @@ public:
 	/** handle time update: read and process packets */
 	ENGINE_API virtual void TickDispatch( float DeltaTime );
 
+	/**
+	 * Hands a batch of raw packets read during TickDispatch to their connections, in order.
+	 * When net.DecodePacketsInParallel is enabled, PacketHandler processing for connections that support it runs on worker threads
+	 * (one worker per connection, so per-connection ordering is kept), and the decoded packets are then applied on the game thread.
+	 */
+	ENGINE_API void ReceiveRawPackets(TArrayView<const FReceivedRawPacket> Packets);
+
 	/** PostTickDispatch actions */
 	ENGINE_API virtual void PostTickDispatch();
 
@@ -1276,6 +1329,22 @@ public:
 	ENGINE_API virtual void LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits)
 		PURE_VIRTUAL(UNetDriver::LowLevelSend,);
 
+	/**
+	 * Whether this driver's sockets can batch sends (net.BatchSends). When it returns true, TickFlush calls BeginSendBatch before replicating,
+	 * and EndSendBatch once all connections have flushed. Between the two, connection and driver LowLevelSend implementations may queue packets
+	 * instead of sending them, and EndSendBatch must submit everything that was queued (e.g. using sendmmsg or UDP GSO).
+	 */
+	ENGINE_API virtual bool SupportsSendBatching() const { return false; }
+
+	/** Starts queuing outgoing packets, see SupportsSendBatching */
+	ENGINE_API virtual void BeginSendBatch() {}
+
+	/** Submits all packets queued since BeginSendBatch, see SupportsSendBatching */
+	ENGINE_API virtual void EndSendBatch() {}
+
+	/** Returns true between BeginSendBatch and EndSendBatch */
+	bool IsSendBatchActive() const { return bSendBatchActive; }
+
 	/**
 	 * Process any local talker packets that need to be sent to clients
 	 */
@@ -1326,6 +1395,12 @@ public:
 	/** Flushes actor from NetDriver's dormancy list, but does not change any state on the Actor itself */
 	ENGINE_API void FlushActorDormancy(AActor *Actor, bool bWasDormInitial=false);
 
+	/**
+	 * Flushes a group of actors from NetDriver's dormancy list, but does not change any state on the Actors themselves.
+	 * Equivalent to calling FlushActorDormancy on each actor, but each client connection is only visited once for the whole group.
+	 */
+	ENGINE_API void FlushDormancyForActors(TArrayView<AActor* const> Actors, bool bWasDormInitial=false);
+
 	ENGINE_API void NotifyActorDormancyChange(AActor* Actor, ENetDormancy OldDormancyState);
 
 	/** Forces properties on this actor to do a compare for one frame (rather than share shadow state) */
@@ -1486,6 +1561,11 @@ public:
 	template<class T>
 	T* GetReplicationDriver() { return Cast<T>(ReplicationDriver); }
 
+	/** Explicitly sets the scheduler that decides when actors are next considered for replication. Only used when there is no ReplicationDriver. */
+	ENGINE_API void SetNetUpdateFrequencyScheduler(UNetUpdateFrequencyScheduler* NewScheduler);
+
+	ENGINE_API UNetUpdateFrequencyScheduler* GetNetUpdateFrequencyScheduler() const { return NetUpdateFrequencyScheduler; }
+
 	void RemoveClientConnection(UNetConnection* ClientConnectionToRemove);
 
 	/** Adds (fully initialized, ready to go) client connection to the ClientConnections list + any other game related setup */
@@ -1538,7 +1618,7 @@ public:
 	inline uint32 AllocateConnectionId() { return ConnectionIdHandler.Allocate(); }
 	inline void FreeConnectionId(uint32 Id) { return ConnectionIdHandler.Free(Id); };
 
-	/** Returns the NetConnection associated with the ConnectionId. Slow. */
+	/** Returns the NetConnection associated with the ConnectionId */
 	ENGINE_API UNetConnection* GetConnectionById(uint32 ConnectionId) const;
 
 	/** Returns identifier used for NetTrace */
@@ -1560,8 +1640,21 @@ protected:
 	*/
 	int32 ServerReplicateActors_PrepConnections( const float DeltaSeconds );
 	void ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime );
-	int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors );
+	int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors );
 	int32 ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated );
+	void ServerReplicateActors_MarkUnprocessedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FirstUnprocessedActor, const int32 FinalSortedCount );
+
+	/** Flushes dormancy on connections whose viewers moved within net.DormancyWakeUpDistance of a dormant actor since the last check. */
+	void ServerReplicateActors_WakeDormantActorsNearViewers( const float DeltaSeconds );
+
+	/**
+	 * Thread safe variant of ServerReplicateActors_PrioritizeActors used by net.ParallelPrioritizeConnections.
+	 * Only reads shared state; channel closes and dormancy requests are deferred into OutResult.
+	 */
+	void ServerReplicateActors_PrioritizeActorsForConnection( const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bLowNetBandwidth, FConnectionPrioritizeResult& OutResult );
+
+	/** Builds prioritized lists for all ticked connections in parallel, then applies deferred channel changes on the game thread. */
+	void ServerReplicateActors_PrioritizeConnectionsParallel( const TArray<FNetworkObjectInfo*>& ConsiderList, const int32 NumClientsToTick, const float DeltaSeconds, TArray<FConnectionPrioritizeResult>& OutResults );
 #endif
 
 	/** Used to handle any NetDriver specific cleanup once a level has been removed from the world. */
@@ -1626,9 +1719,18 @@ private:
 
 	void LoadChannelDefinitions();
 
+	/** Last time ServerReplicateActors_WakeDormantActorsNearViewers checked viewer locations, see net.DormancyWakeUpInterval. */
+	double LastDormancyWakeUpTime;
+
+	/** True while TickFlush has a send batch open, see SupportsSendBatching */
+	bool bSendBatchActive;
+
 	UPROPERTY(transient)
 	UReplicationDriver* ReplicationDriver;
 
+	UPROPERTY(transient)
+	UNetUpdateFrequencyScheduler* NetUpdateFrequencyScheduler;
+
 	/** Stores the list of objects to replicate into the replay stream. This should be a TUniquePtr, but it appears the generated.cpp file needs the full definition of the pointed-to type. */
 	TSharedPtr<FNetworkObjectList> NetworkObjects;
 
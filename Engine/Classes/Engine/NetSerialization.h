@@ -17,6 +17,7 @@
 #include "EngineLogs.h"
 #include "Containers/ArrayView.h"
 #include "Net/GuidReferences.h"
+#include "Algo/BinarySearch.h"
 #include "NetSerialization.generated.h"
 
 class Error;
@@ -243,12 +244,12 @@ struct TStructOpsTypeTraits< FExampleArray > : public TStructOpsTypeTraitsBase2<
  *
  *	Fast TArray Replication
  *		Fast TArray Replication is implemented through custom net delta serialization. Instead of a flat TArray buffer to repesent states, it only is concerned
- *		with a TMap of IDs and ReplicationKeys. The IDs map to items in the array, which all have a ReplicationID field defined in FFastArraySerializerItem.
+ *		with a flat list of IDs and ReplicationKeys. The IDs map to items in the array, which all have a ReplicationID field defined in FFastArraySerializerItem.
  *		FFastArraySerializerItem also has a ReplicationKey field. When items are marked dirty with MarkItemDirty, they are given a new ReplicationKey, and assigned
  *		a new ReplicationID if they don't have one.
  *
  *		FastArrayDeltaSerialize (defined below)
- *		During server serialization (writing), we compare the old base state (e.g, the old ID<->Key map) with the current state of the array. If items are missing
+ *		During server serialization (writing), we compare the old base state (e.g, the old ID<->Key lists) with the current state of the array. If items are missing
  *		we write them out as deletes in the bunch. If they are new or changed, they are written out as changed along with their state, serialized via a NetSerialize call.
  *
  *		For example, what actually is written may look like:
@@ -279,10 +280,10 @@ public:
 	virtual bool IsStateEqual(INetDeltaBaseState* OtherState)
 	{
 		FNetFastTArrayBaseState * Other = static_cast<FNetFastTArrayBaseState*>(OtherState);
-		for (auto It = IDToCLMap.CreateIterator(); It; ++It)
+		for (int32 i = 0; i < ItemIDs.Num(); ++i)
 		{
-			auto Ptr = Other->IDToCLMap.Find(It.Key());
-			if (!Ptr || *Ptr != It.Value())
+			const int32 OtherIndex = Other->FindItem(ItemIDs[i]);
+			if (OtherIndex == INDEX_NONE || Other->ItemKeys[OtherIndex] != ItemKeys[i])
 			{
 				return false;
 			}
@@ -290,8 +291,26 @@ public:
 		return true;
 	}
 
-	/** Maps an element's Replication ID to Index. */
-	TMap<int32, int32> IDToCLMap;
+	/** @return The number of items tracked by this state. */
+	int32 NumItems() const
+	{
+		return ItemIDs.Num();
+	}
+
+	/** @return The index of the item with the given Replication ID in ItemIDs / ItemKeys, or INDEX_NONE. */
+	int32 FindItem(const int32 ReplicationID) const
+	{
+		return Algo::BinarySearch(ItemIDs, ReplicationID);
+	}
+
+	/**
+	 * Replication IDs of the items that were sent in this state, sorted ascending.
+	 * Kept parallel to ItemKeys instead of in a map, so a state is two allocations regardless of the item count.
+	 */
+	TArray<int32> ItemIDs;
+
+	/** Replication Keys of the items that were sent in this state, parallel to ItemIDs. */
+	TArray<int32> ItemKeys;
 
 	int32 ArrayReplicationKey;
 
@@ -602,7 +621,7 @@ private:
 		int32 CalcNumItemsForConsideration() const;
 
 		/** Conditionally logs the important state of the serializer. For debug purposes only. */
-		void ConditionalLogSerializerState(const TMap<int32, int32>* OldIDToKeyMap) const;
+		void ConditionalLogSerializerState(const FNetFastTArrayBaseState* OldState) const;
 
 		/**
 		 * Checks to see if the ArrayReplicationKey has changed, and if so creates a new DeltaState that
@@ -612,16 +631,17 @@ private:
 		 * @return	True if the keys were different and a state was created.
 		 *			False if the keys were the same, and we can skip serialization.
 		 */
-		bool ConditionalCreateNewDeltaState(const TMap<int32, int32>& OldIDToKeyMap, const int32 BaseReplicationKey);
+		bool ConditionalCreateNewDeltaState(const FNetFastTArrayBaseState& OldState, const int32 BaseReplicationKey);
 
 		/**
 		 * Iterates over the current set of properties, comparing their keys with our old state, to figure
 		 * out which have changed and need to be serialized. Also populates a list of elements that are
 		 * no longer in our list (by ID).
+		 * NewState receives the sorted IDs and Keys of every item that was considered for writing.
 		 */
 		void BuildChangedAndDeletedBuffers(
-			TMap<int32, int32>& NewIDToKeyMap,
-			const TMap<int32, int32>* OldIDToKeyMap,
+			FNetFastTArrayBaseState& NewState,
+			const FNetFastTArrayBaseState* OldState,
 			TArray<FFastArraySerializer_FastArrayDeltaSerialize_FIdxIDPair, TInlineAllocator<8>>& ChangedElements,
 			TArray<int32, TInlineAllocator<8>>& DeletedElements);
 
@@ -671,6 +691,24 @@ private:
 	int32 CachedNumItems;
 	int32 CachedNumItemsToConsiderForWriting;
 
+	/**
+	 * Scratch buffers reused by every connection's write, so building a delta doesn't allocate per item.
+	 * Only valid for the duration of a single BuildChangedAndDeletedBuffers call.
+	 */
+	struct FDeltaWriteScratch
+	{
+		/** One bit per item in the old base state, set when the item is still present in the array. */
+		TArray<uint32> OldItemPresentBits;
+
+		/** Sort order used when the current items aren't in ascending Replication ID order. */
+		TArray<int32> SortOrder;
+
+		/** Unsorted copy of the new state's keys, used along with SortOrder. */
+		TArray<int32> UnsortedKeys;
+	};
+
+	FDeltaWriteScratch DeltaWriteScratch;
+
 	UPROPERTY(NotReplicated, Transient)
 	EFastArraySerializerDeltaFlags DeltaFlags;
 };
@@ -721,7 +759,7 @@ int32 FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Cal
 };
 
 template<typename Type, typename SerializerType>
-void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::ConditionalLogSerializerState(const TMap<int32, int32>* OldIDToKeyMap) const
+void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::ConditionalLogSerializerState(const FNetFastTArrayBaseState* OldState) const
 {
 	// Log out entire state of current/base state
 	if (UE_LOG_ACTIVE(LogNetFastTArray, Log))
@@ -734,12 +772,12 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Cond
 		UE_LOG(LogNetFastTArray, Log, TEXT("%s"), *CurrentState);
 
 
-		FString ClientStateStr = FString::Printf(TEXT("Client: %d "), Parms.OldState ? ((FNetFastTArrayBaseState*)Parms.OldState)->ArrayReplicationKey : 0);
-		if (OldIDToKeyMap)
+		FString ClientStateStr = FString::Printf(TEXT("Client: %d "), OldState ? OldState->ArrayReplicationKey : 0);
+		if (OldState)
 		{
-			for (const TPair<int32, int32>& KeyValuePair : *OldIDToKeyMap)
+			for (int32 i = 0; i < OldState->NumItems(); ++i)
 			{
-				ClientStateStr += FString::Printf(TEXT("[%d/%d], "), KeyValuePair.Key, KeyValuePair.Value);
+				ClientStateStr += FString::Printf(TEXT("[%d/%d], "), OldState->ItemIDs[i], OldState->ItemKeys[i]);
 			}
 		}
 		UE_LOG(LogNetFastTArray, Log, TEXT("%s"), *ClientStateStr);
@@ -747,7 +785,7 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Cond
 }
 
 template<typename Type, typename SerializerType>
-bool FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::ConditionalCreateNewDeltaState(const TMap<int32, int32>& OldIDToKeyMap, const int32 BaseReplicationKey)
+bool FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::ConditionalCreateNewDeltaState(const FNetFastTArrayBaseState& OldState, const int32 BaseReplicationKey)
 {
 	if (ArraySerializer.ArrayReplicationKey == BaseReplicationKey)
 	{
@@ -760,9 +798,9 @@ bool FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Cond
 			ArraySerializer.CachedNumItemsToConsiderForWriting = CalcNumItemsForConsideration();
 		}
 
-		if (UNLIKELY(OldIDToKeyMap.Num() != ArraySerializer.CachedNumItemsToConsiderForWriting))
+		if (UNLIKELY(OldState.NumItems() != ArraySerializer.CachedNumItemsToConsiderForWriting))
 		{
-			UE_LOG(LogNetFastTArray, Warning, TEXT("OldMap size (%d) does not match item count (%d)"), OldIDToKeyMap.Num(), ArraySerializer.CachedNumItemsToConsiderForWriting);
+			UE_LOG(LogNetFastTArray, Warning, TEXT("OldMap size (%d) does not match item count (%d)"), OldState.NumItems(), ArraySerializer.CachedNumItemsToConsiderForWriting);
 		}
 
 		if (Parms.OldState)
@@ -786,18 +824,32 @@ bool FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Cond
 
 template<typename Type, typename SerializerType>
 void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::BuildChangedAndDeletedBuffers(
-	TMap<int32, int32>& NewIDToKeyMap,
-	const TMap<int32, int32>* OldIDToKeyMap,
+	FNetFastTArrayBaseState& NewState,
+	const FNetFastTArrayBaseState* OldState,
 	TArray<FFastArraySerializer_FastArrayDeltaSerialize_FIdxIDPair, TInlineAllocator<8>>& ChangedElements,
 	TArray<int32, TInlineAllocator<8>>& DeletedElements)
 {
-	ConditionalLogSerializerState(OldIDToKeyMap);
+	ConditionalLogSerializerState(OldState);
 
 	const int32 NumConsideredItems = CalcNumItemsForConsideration();
+	const int32 NumOldItems = OldState ? OldState->NumItems() : 0;
 
-	int32 DeleteCount = (OldIDToKeyMap ? OldIDToKeyMap->Num() : 0) - NumConsideredItems; // Note: this is incremented when we add new items below.
+	int32 DeleteCount = NumOldItems - NumConsideredItems; // Note: this is incremented when we add new items below.
 	UE_LOG(LogNetFastTArray, Log, TEXT("NetSerializeItemDeltaFast: %s. DeleteCount: %d"), *Parms.DebugName, DeleteCount);
 
+	FDeltaWriteScratch& Scratch = ArraySerializer.DeltaWriteScratch;
+
+	TArray<uint32>& OldItemPresentBits = Scratch.OldItemPresentBits;
+	OldItemPresentBits.Reset();
+	OldItemPresentBits.AddZeroed(FMath::DivideAndRoundUp(NumOldItems, 32));
+
+	NewState.ItemIDs.Reset(NumConsideredItems);
+	NewState.ItemKeys.Reset(NumConsideredItems);
+
+	// Items are usually kept in ascending ID order, so try the next old entry before falling back to a binary search.
+	int32 NextOldIndex = 0;
+	bool bNewStateSorted = true;
+
 	//--------------------------------------------
 	// Find out what is new or what has changed
 	//--------------------------------------------
@@ -815,12 +867,38 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Buil
 		{
 			ArraySerializer.MarkItemDirty(Item);
 		}
-		NewIDToKeyMap.Add(Item.ReplicationID, Item.ReplicationKey);
 
-		const int32* OldValuePtr = OldIDToKeyMap ? OldIDToKeyMap->Find(Item.ReplicationID) : NULL;
-		if (OldValuePtr)
+		if (NewState.ItemIDs.Num() > 0 && Item.ReplicationID <= NewState.ItemIDs.Last())
 		{
-			if (*OldValuePtr == Item.ReplicationKey)
+			bNewStateSorted = false;
+		}
+
+		NewState.ItemIDs.Add(Item.ReplicationID);
+		NewState.ItemKeys.Add(Item.ReplicationKey);
+
+		int32 OldIndex = INDEX_NONE;
+		if (OldState)
+		{
+			if (NextOldIndex < NumOldItems && OldState->ItemIDs[NextOldIndex] == Item.ReplicationID)
+			{
+				OldIndex = NextOldIndex;
+			}
+			else
+			{
+				OldIndex = OldState->FindItem(Item.ReplicationID);
+			}
+
+			if (OldIndex != INDEX_NONE)
+			{
+				OldItemPresentBits[OldIndex / 32] |= (1U << (OldIndex & 31));
+				NextOldIndex = OldIndex + 1;
+			}
+		}
+
+		if (OldIndex != INDEX_NONE)
+		{
+			const int32 OldKey = OldState->ItemKeys[OldIndex];
+			if (OldKey == Item.ReplicationKey)
 			{
 				UE_LOG(LogNetFastTArray, Log, TEXT("       Stayed The Same - Skipping"));
 
@@ -829,7 +907,7 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Buil
 			}
 			else
 			{
-				UE_LOG(LogNetFastTArray, Log, TEXT("       Changed! Was: %d. Element ID: %d. %s"), *OldValuePtr, Item.ReplicationID, *Item.GetDebugString());
+				UE_LOG(LogNetFastTArray, Log, TEXT("       Changed! Was: %d. Element ID: %d. %s"), OldKey, Item.ReplicationID, *Item.GetDebugString());
 
 				// Changed
 				ChangedElements.Add(FFastArraySerializer_FastArrayDeltaSerialize_FIdxIDPair(i, Item.ReplicationID));
@@ -847,16 +925,42 @@ void FFastArraySerializer::TFastArraySerializeHelper<Type, SerializerType>::Buil
 		}
 	}
 
+	// The new state is searched by ID on the next write, so restore ascending order if items were reordered.
+	if (!bNewStateSorted)
+	{
+		const int32 NumNewItems = NewState.ItemIDs.Num();
+
+		TArray<int32>& SortOrder = Scratch.SortOrder;
+		SortOrder.Reset(NumNewItems);
+		for (int32 i = 0; i < NumNewItems; ++i)
+		{
+			SortOrder.Add(i);
+		}
+
+		const TArray<int32>& UnsortedIDs = NewState.ItemIDs;
+		SortOrder.Sort([&UnsortedIDs](const int32 A, const int32 B) { return UnsortedIDs[A] < UnsortedIDs[B]; });
+
+		TArray<int32>& UnsortedKeys = Scratch.UnsortedKeys;
+		UnsortedKeys = NewState.ItemKeys;
+
+		// IDs are unique, so sort them in place and pull the keys across through the sort order.
+		NewState.ItemIDs.Sort();
+		for (int32 i = 0; i < NumNewItems; ++i)
+		{
+			NewState.ItemKeys[i] = UnsortedKeys[SortOrder[i]];
+		}
+	}
+
 	// Find out what was deleted
-	if (DeleteCount > 0 && OldIDToKeyMap)
+	if (DeleteCount > 0 && OldState)
 	{
-		for (auto It = OldIDToKeyMap->CreateConstIterator(); It; ++It)
+		for (int32 OldIndex = 0; OldIndex < NumOldItems; ++OldIndex)
 		{
-			if (!NewIDToKeyMap.Contains(It.Key()))
+			if ((OldItemPresentBits[OldIndex / 32] & (1U << (OldIndex & 31))) == 0)
 			{
-				UE_LOG(LogNetFastTArray, Log, TEXT("   Deleting ID: %d"), It.Key());
+				UE_LOG(LogNetFastTArray, Log, TEXT("   Deleting ID: %d"), OldState->ItemIDs[OldIndex]);
 
-				DeletedElements.Add(It.Key());
+				DeletedElements.Add(OldState->ItemIDs[OldIndex]);
 				if (--DeleteCount <= 0)
 				{
 					break;
@@ -1249,19 +1353,18 @@ bool FFastArraySerializer::FastArrayDeltaSerialize(TArray<Type> &Items, FNetDelt
 		check(Parms.Struct);
 		FBitWriter& Writer = *Parms.Writer;
 
-		// Get the old map if its there
-		TMap<int32, int32> * OldMap = nullptr;
+		// Get the old state if its there
+		const FNetFastTArrayBaseState* OldState = static_cast<const FNetFastTArrayBaseState*>(Parms.OldState);
 		int32 BaseReplicationKey = INDEX_NONE;
 
 		// See if the array changed at all. If the ArrayReplicationKey matches we can skip checking individual items
-		if (Parms.OldState)
+		if (OldState)
 		{
-			OldMap = &((FNetFastTArrayBaseState*)Parms.OldState)->IDToCLMap;
-			BaseReplicationKey = ((FNetFastTArrayBaseState*)Parms.OldState)->ArrayReplicationKey;
+			BaseReplicationKey = OldState->ArrayReplicationKey;
 
 			// If we didn't create a new delta state, that implies nothing changed,
 			// so we're done.
-			if (!Helper.ConditionalCreateNewDeltaState(*OldMap, BaseReplicationKey))
+			if (!Helper.ConditionalCreateNewDeltaState(*OldState, BaseReplicationKey))
 			{
 				return false;
 			}
@@ -1272,7 +1375,6 @@ bool FFastArraySerializer::FastArrayDeltaSerialize(TArray<Type> &Items, FNetDelt
 
 		check(Parms.NewState);
 		*Parms.NewState = MakeShareable( NewState );
-		TMap<int32, int32> & NewMap = NewState->IDToCLMap;
 		NewState->ArrayReplicationKey = ArraySerializer.ArrayReplicationKey;
 
 		FFastArraySerializerHeader Header{
@@ -1283,7 +1385,7 @@ bool FFastArraySerializer::FastArrayDeltaSerialize(TArray<Type> &Items, FNetDelt
 
 		TArray<FFastArraySerializer_FastArrayDeltaSerialize_FIdxIDPair, TInlineAllocator<8>> ChangedElements;
 
-		Helper.BuildChangedAndDeletedBuffers(NewMap, OldMap, ChangedElements, Header.DeletedIndices);
+		Helper.BuildChangedAndDeletedBuffers(*NewState, OldState, ChangedElements, Header.DeletedIndices);
 		
 		// Note: we used to early return false here if nothing had changed, but we still need to send
 		// a bunch with the array key / base key, so that clients can look for implicit deletes.
@@ -1552,19 +1654,18 @@ bool FFastArraySerializer::FastArrayDeltaSerialize_DeltaSerializeStructs(TArray<
 		check(Parms.Struct);
 		FBitWriter& Writer = *Parms.Writer;
 
-		// Get the old map if its there
-		TMap<int32, int32>* OldItemMap = nullptr;
+		// Get the old state if its there
+		const FNetFastTArrayBaseState* OldState = static_cast<const FNetFastTArrayBaseState*>(Parms.OldState);
 		int32 BaseReplicationKey = INDEX_NONE;
 		int32 OldChangelistHistory = INDEX_NONE;
 
 		// See if the array changed at all. If the ArrayReplicationKey matches we can skip checking individual items
-		if (Parms.OldState)
+		if (OldState)
 		{
-			OldItemMap = &((FNetFastTArrayBaseState*)Parms.OldState)->IDToCLMap;
-			BaseReplicationKey = ((FNetFastTArrayBaseState*)Parms.OldState)->ArrayReplicationKey;
-			OldChangelistHistory = ((FNetFastTArrayBaseState*)Parms.OldState)->ChangelistHistory;
+			BaseReplicationKey = OldState->ArrayReplicationKey;
+			OldChangelistHistory = OldState->ChangelistHistory;
 
-			if (!Helper.ConditionalCreateNewDeltaState(*OldItemMap, BaseReplicationKey))
+			if (!Helper.ConditionalCreateNewDeltaState(*OldState, BaseReplicationKey))
 			{
 				return false;
 			}
@@ -1578,8 +1679,6 @@ bool FFastArraySerializer::FastArrayDeltaSerialize_DeltaSerializeStructs(TArray<
 		*Parms.NewState = MakeShareable(NewState);
 		NewState->ArrayReplicationKey = ArraySerializer.ArrayReplicationKey;
 
-		TMap<int32, int32>& NewItemMap = NewState->IDToCLMap;
-
 		FFastArraySerializerHeader Header{
 			ArraySerializer.ArrayReplicationKey,
 			BaseReplicationKey,
@@ -1587,7 +1686,7 @@ bool FFastArraySerializer::FastArrayDeltaSerialize_DeltaSerializeStructs(TArray<
 		};
 
 		TArray<FFastArraySerializer_FastArrayDeltaSerialize_FIdxIDPair, TInlineAllocator<8>> ChangedElements;
-		Helper.BuildChangedAndDeletedBuffers(NewItemMap, OldItemMap, ChangedElements, Header.DeletedIndices);
+		Helper.BuildChangedAndDeletedBuffers(*NewState, OldState, ChangedElements, Header.DeletedIndices);
 
 		// Note: we used to early return false here if nothing had changed, but we still need to send
 		// a bunch with the array key / base key, so that clients can look for implicit deletes.
@@ -1684,6 +1783,41 @@ bool FFastArraySerializer::FastArrayDeltaSerialize_DeltaSerializeStructs(TArray<
  *
 */
 
+/**
+ * Serializes three components of NumBits bits each, with exactly the same bit layout as calling SerializeInt(Component, 1 << NumBits) for each of them.
+ * On net (bit) archives, ranges that fit in 64 bits are packed and serialized with a single SerializeBits call instead of bit by bit per component.
+ */
+inline void SerializeVectorComponents(FArchive& Ar, uint32& X, uint32& Y, uint32& Z, const uint32 NumBits)
+{
+#if PLATFORM_LITTLE_ENDIAN
+	if (Ar.IsNetArchive() && NumBits * 3 <= 64)
+	{
+		const uint64 Mask = (uint64(1) << NumBits) - 1;
+
+		uint64 Packed = 0;
+		if (Ar.IsSaving())
+		{
+			Packed = (uint64(X) & Mask) | ((uint64(Y) & Mask) << NumBits) | ((uint64(Z) & Mask) << (NumBits * 2));
+		}
+
+		Ar.SerializeBits(&Packed, NumBits * 3);
+
+		if (Ar.IsLoading())
+		{
+			X = static_cast<uint32>(Packed & Mask);
+			Y = static_cast<uint32>((Packed >> NumBits) & Mask);
+			Z = static_cast<uint32>((Packed >> (NumBits * 2)) & Mask);
+		}
+		return;
+	}
+#endif
+
+	const uint32 Max = 1U << NumBits;
+	Ar.SerializeInt(X, Max);
+	Ar.SerializeInt(Y, Max);
+	Ar.SerializeInt(Z, Max);
+}
+
 template<int32 ScaleFactor, int32 MaxBitsPerComponent>
 bool WritePackedVector(FVector Value, FArchive& Ar)	// Note Value is intended to not be a reference since we are scaling it before serializing!
 {
@@ -1725,9 +1859,7 @@ bool WritePackedVector(FVector Value, FArchive& Ar)	// Note Value is intended to
 	if (DY >= Max) { bClamp=true; DY = static_cast<int32>(DY) > 0 ? Max-1 : 0; }
 	if (DZ >= Max) { bClamp=true; DZ = static_cast<int32>(DZ) > 0 ? Max-1 : 0; }
 	
-	Ar.SerializeInt( DX, Max );
-	Ar.SerializeInt( DY, Max );
-	Ar.SerializeInt( DZ, Max );
+	SerializeVectorComponents( Ar, DX, DY, DZ, Bits + 2 );
 
 	return !bClamp;
 }
@@ -1741,14 +1873,11 @@ bool ReadPackedVector(FVector &Value, FArchive& Ar)
 	Ar.SerializeInt( Bits, MaxBitsPerComponent );
 
 	int32  Bias = 1<<(Bits+1);
-	uint32 Max	= 1<<(Bits+2);
 	uint32 DX	= 0;
 	uint32 DY	= 0;
 	uint32 DZ	= 0;
 	
-	Ar.SerializeInt( DX, Max );
-	Ar.SerializeInt( DY, Max );
-	Ar.SerializeInt( DZ, Max );
+	SerializeVectorComponents( Ar, DX, DY, DZ, Bits + 2 );
 	
 	
 	float fact = (float)ScaleFactor;
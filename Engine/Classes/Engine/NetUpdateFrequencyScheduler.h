@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ *
+ *	===================== Net Update Frequency Scheduler =====================
+ *
+ *	Decides how long the legacy (non ReplicationDriver) UNetDriver::ServerReplicateActors path waits before considering an
+ *	actor for replication again. The default implementation scales each actor's update delta between NetUpdateFrequency and
+ *	MinNetUpdateFrequency using how often its scheduled updates actually send data, how far it is from the nearest viewer
+ *	and how much bandwidth headroom the client connections have.
+ *
+ *	How to enable the scheduler:
+ *
+ *		[/Script/OnlineSubsystemUtils.IpNetDriver]
+ *		NetUpdateFrequencySchedulerClassName="/Script/Engine.NetUpdateFrequencyScheduler"
+ *
+ *	Projects can point NetUpdateFrequencySchedulerClassName at their own subclass and override GetNextUpdateDelta.
+ *	When no class is configured, the net driver keeps using net.UseAdaptiveNetUpdateFrequency.
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "UObject/ObjectMacros.h"
+
+#include "NetUpdateFrequencyScheduler.generated.h"
+
+class AActor;
+class UNetConnection;
+class UNetDriver;
+struct FNetworkObjectInfo;
+
+UCLASS(transient, config=Engine)
+class ENGINE_API UNetUpdateFrequencyScheduler : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNetUpdateFrequencyScheduler();
+
+	/** Called once after the scheduler is created for a server net driver. */
+	virtual void InitForNetDriver(UNetDriver* InNetDriver);
+
+	/**
+	 * Called at the start of UNetDriver::ServerReplicateActors_BuildConsiderList.
+	 * Caches any per frame state (viewer locations, bandwidth headroom) used while scheduling actors.
+	 */
+	virtual void BeginFrame(const TArray<UNetConnection*>& ClientConnections, float DeltaSeconds);
+
+	/**
+	 * Called when an actor is due for an update and needs its next update time scheduled.
+	 *
+	 * @param ActorInfo		The network info of the actor being scheduled.
+	 * @param WorldTime		The current world time in seconds.
+	 *
+	 * @return The number of seconds to wait before the actor is considered again.
+	 */
+	virtual float GetNextUpdateDelta(FNetworkObjectInfo& ActorInfo, double WorldTime);
+
+	/** Called when an actor sent data on a connection. */
+	virtual void NotifyActorReplicated(FNetworkObjectInfo& ActorInfo, UNetConnection* Connection);
+
+protected:
+
+	/** @return The fraction of the [MinDelta, MaxDelta] range to push the actor toward MaxDelta due to distance from the closest viewer. */
+	float GetDistanceAlpha(const AActor* Actor) const;
+
+	/** @return The fraction of the [MinDelta, MaxDelta] range to push the actor toward MaxDelta due to saturated connections. */
+	float GetBandwidthAlpha() const;
+
+	UPROPERTY()
+	UNetDriver* NetDriver;
+
+	/**
+	 * How quickly ObservedChangeRate follows the latest sample, in the range (0, 1].
+	 * Higher values react to bursts faster, lower values smooth out noisy actors.
+	 */
+	UPROPERTY(Config)
+	float ChangeRateSmoothing;
+
+	/**
+	 * Actors whose ObservedChangeRate is at or above this value are treated as hot and replicate at HotActorFrequencyScale * NetUpdateFrequency.
+	 * Set above 1 to disable boosting.
+	 */
+	UPROPERTY(Config)
+	float HotActorChangeRate;
+
+	/** Scale applied to NetUpdateFrequency for hot actors. Values above 1 let hot actors replicate faster than their configured NetUpdateFrequency. */
+	UPROPERTY(Config)
+	float HotActorFrequencyScale;
+
+	/** Distance to the nearest viewer where actors start being pushed toward MinNetUpdateFrequency. */
+	UPROPERTY(Config)
+	float DistanceScaleStart;
+
+	/** Distance to the nearest viewer where actors are fully pushed toward MinNetUpdateFrequency. */
+	UPROPERTY(Config)
+	float DistanceScaleEnd;
+
+	/** Fraction of client connections that can be saturated before actors start being pushed toward MinNetUpdateFrequency. */
+	UPROPERTY(Config)
+	float SaturatedConnectionThreshold;
+
+	/** Cached viewer locations for the current frame. */
+	TArray<FVector> ViewerLocations;
+
+	/** Fraction of client connections that were saturated at the start of the current frame. */
+	float SaturatedConnectionRatio;
+};
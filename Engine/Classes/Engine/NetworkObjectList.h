@@ -57,9 +57,24 @@ struct FNetworkObjectInfo
 	/** Should channel swap roles while calling ReplicateActor */
 	uint8 bSwapRolesOnReplicate : 1;
 
+	/** Is this object currently stored in the owning list's FNetworkRelevancyGrid */
+	uint8 bInRelevancyGrid : 1;
+
+	/** Did this object send anything on any connection since its last update was scheduled. Used by UNetUpdateFrequencyScheduler. */
+	uint8 bReplicatedSinceLastSchedule : 1;
+
 	/** Force this object to be considered relevant for at least one update */
 	uint32 ForceRelevantFrame = 0;
 
+	/** Last relevancy grid frame this object was considered for replication in. Only meaningful when bInRelevancyGrid is set. */
+	uint32 RelevancyGridFrame = 0;
+
+	/** Relevancy grid cell this object is stored in. Only meaningful when bInRelevancyGrid is set. */
+	FIntPoint RelevancyGridCell = FIntPoint::ZeroValue;
+
+	/** Smoothed fraction of scheduled updates that actually sent something. Maintained by UNetUpdateFrequencyScheduler. */
+	float ObservedChangeRate = 1.0f;
+
 	FNetworkObjectInfo()
 		: Actor(nullptr)
 		, NextUpdateTime(0.0)
@@ -70,7 +85,9 @@ struct FNetworkObjectInfo
 		, bPendingNetUpdate(false)
 		, bForceRelevantNextUpdate(false)
 		, bDirtyForReplay(false)
-		, bSwapRolesOnReplicate(false) {}
+		, bSwapRolesOnReplicate(false)
+		, bInRelevancyGrid(false)
+		, bReplicatedSinceLastSchedule(false) {}
 
 	FNetworkObjectInfo(AActor* InActor)
 		: Actor(InActor)
@@ -83,7 +100,9 @@ struct FNetworkObjectInfo
 		, bPendingNetUpdate(false)
 		, bForceRelevantNextUpdate(false)
 		, bDirtyForReplay(false)
-		, bSwapRolesOnReplicate(false) {}
+		, bSwapRolesOnReplicate(false)
+		, bInRelevancyGrid(false)
+		, bReplicatedSinceLastSchedule(false) {}
 
 	void CountBytes(FArchive& Ar) const;
 };
@@ -116,6 +135,80 @@ struct FNetworkObjectKeyFuncs : BaseKeyFuncs<TSharedPtr<FNetworkObjectInfo>, AAc
 	}
 };
 
+/**
+ * Optional 2D spatial hash of replicated actors whose relevancy is purely distance based (net.RelevancyGrid).
+ * Actors are (re)bucketed when they're added to the consider list, so a query only returns objects that are
+ * considered for replication in the current frame. Everything else (always relevant, owner relevant,
+ * attached, or classes with custom IsNetRelevantFor logic) is tracked as a slow path object and still
+ * goes through IsNetRelevantFor for every connection.
+ */
+class ENGINE_API FNetworkRelevancyGrid
+{
+public:
+	/** Starts a new replication frame. Objects that aren't added again this frame are ignored by queries. */
+	void BeginFrame(const float InCellSize);
+
+	/**
+	 * Adds an object from the consider list to the grid, moving it to a new cell if needed.
+	 * If the object can't be culled by distance alone, it's added to the slow path list instead.
+	 *
+	 * @return True if the object was added to the grid.
+	 */
+	bool AddConsideredObject(FNetworkObjectInfo* ObjectInfo);
+
+	/** Removes an object from the grid (for instance, when it's removed from the owning list). */
+	void Remove(FNetworkObjectInfo* ObjectInfo);
+
+	/**
+	 * Gathers objects considered this frame that are stored in any cell within cull range of the given locations.
+	 * Results are appended to OutObjects and may contain duplicates when locations overlap.
+	 */
+	void GatherObjectsNear(TArrayView<const FVector> Locations, TArray<FNetworkObjectInfo*>& OutObjects) const;
+
+	/** Whether the object is stored in the grid and was considered for replication this frame. */
+	bool IsConsideredInGrid(const FNetworkObjectInfo* ObjectInfo) const
+	{
+		return ObjectInfo->bInRelevancyGrid && ObjectInfo->RelevancyGridFrame == Frame;
+	}
+
+	/** Objects considered this frame that must take the per connection IsNetRelevantFor path. */
+	const TArray<FNetworkObjectInfo*>& GetSlowPathObjects() const { return SlowPathObjects; }
+
+	void Reset();
+
+	void CountBytes(FArchive& Ar) const;
+
+private:
+	/** Returns true if the actor's relevancy can be decided purely by distance from the view location. */
+	bool CanCullByDistance(const AActor* Actor) const;
+
+	/** Returns true if the native class of InClass doesn't override AActor::IsNetRelevantFor (or has opted in). */
+	bool UsesDefaultNetRelevancy(const UClass* InClass) const;
+
+	FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	}
+
+	TMap<FIntPoint, TArray<FNetworkObjectInfo*>> Cells;
+
+	TArray<FNetworkObjectInfo*> SlowPathObjects;
+
+	/** Cached per class result of UsesDefaultNetRelevancy */
+	mutable TMap<const UClass*, bool> DefaultRelevancyClassCache;
+
+	/** Native classes opted in through net.RelevancyGrid.DistanceOnlyClasses, and the cvar value they were parsed from */
+	TSet<FName> DistanceOnlyClassNames;
+	FString DistanceOnlyClassesString;
+
+	/** Largest cull distance of any object added to the grid this frame, used as the query radius */
+	float MaxCullDistance = 0.f;
+
+	float CellSize = 0.f;
+
+	uint32 Frame = 0;
+};
+
 /**
  * Stores the list of replicated actors for a given UNetDriver.
  */
@@ -231,11 +324,17 @@ public:
 	/** Force this actor to be relevant for at least one update */
 	void ForceActorRelevantNextUpdate(AActor* const Actor, UNetDriver* NetDriver);
 		
+	/** Spatial index of considered actors, only maintained while net.RelevancyGrid is enabled */
+	FNetworkRelevancyGrid& GetRelevancyGrid() { return RelevancyGrid; }
+	const FNetworkRelevancyGrid& GetRelevancyGrid() const { return RelevancyGrid; }
+
 	void Reset();
 
 	void CountBytes(FArchive& Ar) const;
 
 private:
+	FNetworkRelevancyGrid RelevancyGrid;
+
 	FNetworkObjectSet AllNetworkObjects;
 	FNetworkObjectSet ActiveNetworkObjects;
 	FNetworkObjectSet ObjectsDormantOnAllConnections;
@@ -297,6 +297,13 @@ private:
 	/** Current index used when filling in NetFieldExportGroupPathToIndex/NetFieldExportGroupIndexToPath */
 	int32													UniqueNetFieldExportGroupPathIndex;
 
+	/**
+	 * Server only. Recently exported static, non-package NetGUIDs keyed by their name without its number (e.g. StaticMeshActor for StaticMeshActor_12).
+	 * Once a connection has acked one of these, later exports with a similar name can send a prefix of it plus a suffix instead of the full name.
+	 * Rebuilt for each map, see CleanReferences.
+	 */
+	TMap < FName, TArray< FNetworkGUID, TInlineAllocator< 4 > > >	ExportPathPrefixGUIDs;
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 public:
 
@@ -478,6 +485,12 @@ protected:
 	void			InternalWriteObject( FArchive& Ar, FNetworkGUID NetGUID, UObject* Object, FString ObjectPathName, UObject* ObjectOuter );	
 	FNetworkGUID	InternalLoadObject( FArchive & Ar, UObject *& Object, int InternalLoadObjectRecursionCount );
 
+	/** Writes an exported object name, as a prefix of an acked export's name plus a suffix when possible. See net.ExportPathPrefixes. */
+	void			WriteExportPathName( FArchive& Ar, const FNetworkGUID& NetGUID, const FString& ObjectPathName, const bool bIsPackage );
+
+	/** Reads the remainder of an exported object name written as a prefix reference by WriteExportPathName. */
+	bool			ReadExportPathNamePrefix( FArchive& Ar, FString& OutPathName );
+
 	virtual UObject* ResolvePathAndAssignNetGUID( const FNetworkGUID& NetGUID, const FString& PathName ) override;
 
 	bool	ShouldSendFullPath(const UObject* Object, const FNetworkGUID &NetGUID);
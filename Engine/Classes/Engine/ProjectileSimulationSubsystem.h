@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Stats/Stats.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "Templates/SubclassOf.h"
+
+#include "ProjectileSimulationSubsystem.generated.h"
+
+class AActor;
+
+/** Called when a lightweight projectile hits something. Velocity is the projectile's velocity at the end of the step that hit. */
+DECLARE_DELEGATE_TwoParams(FOnLightweightProjectileImpact, const FHitResult& /*Hit*/, const FVector& /*Velocity*/);
+
+/** Settings shared by every lightweight projectile of one kind, e.g. every bullet of a weapon mode */
+struct FLightweightProjectileType
+{
+	/** Channel the projectile's path is traced on */
+	ECollisionChannel TraceChannel = ECC_WorldDynamic;
+
+	/** Radius of the sphere swept along the projectile's path, 0 uses line traces */
+	float Radius = 0.f;
+
+	/** Multiplier on the world gravity, same as UProjectileMovementComponent::ProjectileGravityScale */
+	float GravityScale = 1.f;
+
+	/** Seconds after which a projectile that has not hit anything is removed */
+	float LifeSpan = 3.f;
+
+	/** Actor spawned at the impact point, facing along the impact normal. Classes implementing IPoolableActorInterface are recycled by the world's actor pool. */
+	TSubclassOf<AActor> ImpactActorClass;
+
+	/** Called for every impact, before the impact actor is spawned */
+	FOnLightweightProjectileImpact OnImpact;
+};
+
+/**
+ * The projectile simulation subsystem moves large numbers of simple projectiles without an actor or a component per projectile.
+ * Projectiles are kept in flat arrays per attribute and integrated together, and the path each one covered during a frame is traced
+ * with the world's async traces. Trace results are read back the next frame, so impacts are reported one frame after the step that hit.
+ * Projectiles don't bounce, home or replicate, use UProjectileMovementComponent for those.
+ */
+UCLASS()
+class ENGINE_API UProjectileSimulationSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Registers a kind of projectile and returns the index to fire it with */
+	int32 RegisterProjectileType(const FLightweightProjectileType& Type);
+
+	/**
+	 * Fires a projectile of a registered type. Its path is first traced at the end of the frame it is fired in.
+	 *
+	 * @param Instigator	Ignored by the projectile's traces, and used as the instigator of the impact actor
+	 */
+	void FireProjectile(int32 TypeIndex, const FVector& Location, const FVector& Velocity, AActor* Instigator = nullptr);
+
+	/** Removes every projectile in flight, without impacts */
+	void ClearProjectiles();
+
+	/** Returns the number of projectiles in flight */
+	int32 GetNumProjectiles() const { return PositionX.Num(); }
+
+	//~USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+protected:
+
+	//~FTickableGameObject interface
+	ETickableTickType GetTickableTickType() const override;
+	bool IsTickable() const override;
+	UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	void Tick(float DeltaTime) override;
+	TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSimulationSubsystem, STATGROUP_Tickables); }
+	//~End of FTickableGameObject interface
+
+private:
+
+	/** Reads back last frame's traces, and reports and removes the projectiles that hit something */
+	void ResolveImpacts(UWorld* World);
+
+	/** Advances every projectile by DeltaTime */
+	void Integrate(float DeltaTime, float GravityZ);
+
+	/** Removes the projectiles whose life span ran out */
+	void RemoveExpired();
+
+	/** Requests an async trace along the step each projectile just took */
+	void RequestTraces(UWorld* World);
+
+	void RemoveProjectileAtSwap(int32 Index);
+
+	TArray<FLightweightProjectileType> Types;
+
+	/** Integrated every frame, one entry per projectile in each array */
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<float> VelocityX;
+	TArray<float> VelocityY;
+	TArray<float> VelocityZ;
+	TArray<float> GravityScales;
+	TArray<float> LifeRemaining;
+
+	/** Only read when tracing and resolving impacts */
+	TArray<FVector> StepStart;
+	TArray<FTraceHandle> TraceHandles;
+	TArray<int32> TypeIndices;
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+};
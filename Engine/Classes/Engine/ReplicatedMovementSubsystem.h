@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Stats/Stats.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "ReplicatedMovementSubsystem.generated.h"
+
+class AActor;
+
+/**
+ * The replicated movement subsystem applies the replicated movement of simulated proxies in one pass per frame, instead of
+ * once per rep notify. Enabled with net.RepMovement.Batch, it only handles actors using AActor::PostNetReceiveLocationAndRotation,
+ * pawns keep their own handling. Every update an actor receives during a frame replaces the previous one, so each actor is moved
+ * at most once per frame. With net.RepMovement.Batch.SmoothingTime the actors are interpolated to the replicated transform over
+ * the next frames instead of snapping to it.
+ */
+UCLASS()
+class ENGINE_API UReplicatedMovementSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Whether simulated proxies of this world should queue their replicated movement instead of applying it */
+	static bool IsBatchingEnabled(const UWorld* World);
+
+	/** Queues the actor to be moved to the location and rotation, which are already rebased onto the local origin */
+	void QueueMovement(AActor* Actor, const FVector& Location, const FRotator& Rotation);
+
+	/** Returns the number of actors whose movement hasn't been fully applied yet */
+	int32 GetNumPendingMovements() const { return PendingMovements.Num(); }
+
+	//~USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+protected:
+
+	//~FTickableGameObject interface
+	ETickableTickType GetTickableTickType() const override;
+	bool IsTickable() const override;
+	UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	void Tick(float DeltaTime) override;
+	TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UReplicatedMovementSubsystem, STATGROUP_Tickables); }
+	//~End of FTickableGameObject interface
+
+private:
+
+	struct FPendingMovement
+	{
+		FVector Location;
+		FRotator Rotation;
+	};
+
+	/** Latest replicated transform of each actor that hasn't reached it yet */
+	TMap<TWeakObjectPtr<AActor>, FPendingMovement> PendingMovements;
+};
@@ -88,6 +88,13 @@ struct ENGINE_API FStreamableHandle : public TSharedFromThis<FStreamableHandle,
 	/** Tells a stalled handle to start its actual request. */
 	void StartStalledHandle();
 
+	/**
+	 * Raises the streaming priority of this handle and its children, assets that are still loading are requested again at the new priority.
+	 * Use it when a background load is needed right away, the async loader moves the already requested packages ahead of lower priority ones.
+	 * Does nothing if NewPriority is not higher than the current priority.
+	 */
+	void RaisePriority(TAsyncLoadPriority NewPriority);
+
 	/** Bind delegate that is called when load completes, only works if loading is in progress. This will overwrite any already bound delegate! */
 	bool BindCompleteDelegate(FStreamableDelegate NewDelegate);
 
@@ -347,6 +354,7 @@ private:
 
 	void RemoveReferencedAsset(const FSoftObjectPath& Target, TSharedRef<FStreamableHandle> Handle);
 	void StartHandleRequests(TSharedRef<FStreamableHandle> Handle);
+	void RaiseHandleRequestsPriority(TSharedRef<FStreamableHandle> Handle);
 	void FindInMemory(FSoftObjectPath& InOutTarget, struct FStreamable* Existing);
 	FSoftObjectPath HandleLoadedRedirector(UObjectRedirector* LoadedRedirector, FSoftObjectPath RequestedPath, struct FStreamable* RequestedStreamable);
 	struct FStreamable* FindStreamable(const FSoftObjectPath& Target) const;
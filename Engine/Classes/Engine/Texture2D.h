@@ -410,6 +410,13 @@ public:
 	 */
 	virtual void RefreshSamplerStates();
 
+	/**
+	 * Applies changes to properties that don't affect the texture data, like the sampler filter, the addressing or the LOD bias.
+	 * Keeps the existing resource and only refreshes its sampler states when possible, the streamer then adjusts the resident
+	 * mips to the new LOD bias. Falls back to UpdateResource() otherwise. Don't use it after modifying the mip data.
+	 */
+	ENGINE_API void UpdateResourceSettings();
+
 	/**
 	 * Returns if the texture is actually being rendered using virtual texturing right now.
 	 * Unlike the 'VirtualTextureStreaming' property which reflects the user's desired state
@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Stats/Stats.h"
+#include "Engine/EngineTypes.h"
+
+#include "TickLODSubsystem.generated.h"
+
+class AActor;
+class UActorComponent;
+
+/**
+ * The Tick LOD subsystem drives the tick interval of registered actors (and optionally their components) from their significance:
+ * the distance to the nearest player view picks an LOD, recently rendered actors are kept one LOD finer, and each LOD maps to a tick interval.
+ * Actors are re-evaluated a slice at a time so the cost is spread across frames. Enable tick.SpreadIntervalTicks so that actors
+ * moving to the same interval on the same frame are given different phases by the tick task manager.
+ */
+UCLASS(config=Engine)
+class ENGINE_API UTickLODSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UTickLODSubsystem();
+
+	/**
+	 * Starts driving the tick interval of the given actor. Its current tick intervals are used as the minimum for every LOD
+	 * and restored when it is unregistered.
+	 *
+	 * @param bIncludeComponents	If true, the actor's ticking components follow the same LOD
+	 */
+	UFUNCTION(BlueprintCallable, Category="Tick")
+	void RegisterActor(AActor* Actor, bool bIncludeComponents = true);
+
+	/** Stops driving the tick interval of the given actor and restores the intervals it had when registered */
+	UFUNCTION(BlueprintCallable, Category="Tick")
+	void UnregisterActor(AActor* Actor);
+
+	/** Distances from the nearest player view at which actors move to the next LOD, in increasing order */
+	UPROPERTY(config)
+	TArray<float> LODDistances;
+
+	/** Tick interval for each LOD, LOD 0 being closest. Should have one more entry than LODDistances, the last entry is used past the last distance */
+	UPROPERTY(config)
+	TArray<float> LODTickIntervals;
+
+	/** Seconds it takes to re-evaluate every registered actor once */
+	UPROPERTY(config)
+	float UpdatePeriod;
+
+	/** Actors rendered within this many seconds are considered on screen */
+	UPROPERTY(config)
+	float RecentlyRenderedTolerance;
+
+protected:
+
+	//~FTickableGameObject interface
+	ETickableTickType GetTickableTickType() const override;
+	bool IsTickable() const override;
+	void Tick(float DeltaTime) override;
+	TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTickLODSubsystem, STATGROUP_Tickables); }
+	//~End of FTickableGameObject interface
+
+	//~USubsystem interface
+	void Deinitialize() override;
+	//~End of USubsystem interface
+
+private:
+
+	struct FRegisteredActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		float BaseTickInterval;
+		TArray<TPair<TWeakObjectPtr<UActorComponent>, float>, TInlineAllocator<4>> Components;
+		int32 LOD;
+	};
+
+	/** Callback for a registered actor's End Play so we can remove it from our known actors */
+	UFUNCTION()
+	void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	/** Returns the LOD for an actor given the current view locations */
+	int32 CalculateLOD(const AActor* Actor, TArrayView<const FVector> ViewLocations) const;
+
+	/** Applies the interval for LOD to the actor and its tracked components */
+	void ApplyLOD(FRegisteredActor& Registered, int32 NewLOD) const;
+
+	/** Puts back the intervals the actor had when it was registered */
+	static void RestoreTickIntervals(FRegisteredActor& Registered);
+
+	TArray<FRegisteredActor> RegisteredActors;
+
+	/** Index of the next actor to evaluate, evaluation wraps around the list every UpdatePeriod */
+	int32 NextUpdateIndex;
+
+	/** Fractional number of actors left over from the previous frame's slice */
+	float PendingUpdates;
+};
@@ -9,6 +9,7 @@
 #include "UObject/Object.h"
 #include "Misc/Guid.h"
 #include "UObject/Class.h"
+#include "UObject/GCObject.h"
 #include "Engine/EngineTypes.h"
 #include "Engine/EngineBaseTypes.h"
 #include "CollisionQueryParams.h"
@@ -21,6 +22,8 @@
 #include "Engine/GameInstance.h"
 #include "Physics/PhysicsInterfaceDeclares.h"
 #include "Particles/WorldPSCPool.h"
+#include "WorldActorPool.h"
+#include "StaticCollisionStore.h"
 #include "Containers/SortedMap.h"
 #include "AudioDeviceManager.h"
 #include "Subsystems/WorldSubsystem.h"
@@ -44,6 +47,7 @@ class FWorldInGamePerformanceTrackers;
 class IInterface_PostProcessVolume;
 class UAISystemBase;
 class UCanvas;
+class UCharacterMovementComponent;
 class UDemoNetDriver;
 class UGameViewportClient;
 class ULevel;
@@ -211,6 +215,32 @@ private:
 	UWorld* World;
 };
 
+/**
+ * Keeps the loaded assets a map depends on alive while the world before it is torn down, so a transition doesn't unload
+ * and then load them again. The dependencies are the map's hard package dependencies in the asset registry, which in cooked
+ * builds is the registry written by the cook. Used by LoadMap and seamless travel when travel.RetainReferencedAssets is set.
+ */
+class ENGINE_API FWorldTransitionAssetRetainer : public FGCObject
+{
+public:
+	/** Retains the public objects of every loaded package the map depends on, other than worlds. Returns the number of packages retained. */
+	int32 Retain(const FString& MapPackageName);
+
+	/** Lets the retained objects be collected again */
+	void Release();
+
+	/** Whether travel.RetainReferencedAssets is set */
+	static bool IsEnabled();
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FWorldTransitionAssetRetainer"); }
+	//~ End FGCObject Interface
+
+private:
+	TArray<UObject*> RetainedObjects;
+};
+
 /** class that encapsulates seamless world traveling */
 class FSeamlessTravelHandler
 {
@@ -237,6 +267,8 @@ private:
 	FName WorldContextHandle;
 	/** Real time which we started traveling at  */
 	double SeamlessTravelStartTime = 0.f;
+	/** Assets of the destination that were loaded when travel started, kept until it has been loaded */
+	TSharedPtr<FWorldTransitionAssetRetainer> RetainedAssets;
 
 	/** copy data between the old world and the new world */
 	void CopyWorldData();
@@ -2133,6 +2165,32 @@ public:
 	 */
 	bool IsTraceHandleValid(const FTraceHandle& Handle, bool bOverlapTrace);
 
+	/**
+	 * Runs a batch of independent traces, or sweeps when CollisionShape is not a line, on worker threads. Queries are split in chunks
+	 * that each run as one task, and one result per query is written to the batch's Hits array, in the order of Starts and Ends.
+	 * Only Test and Single trace types are supported.
+	 *
+	 *	@param	Completion		Whether the batch starts right away and completes within the frame, or starts at the end of the frame with the other async traces
+	 *	@param	InTraceType		Single returns the blocking hit of each query, Test only sets bBlockingHit
+	 *	@param	Starts			Start location of each query
+	 *	@param	Ends			End location of each query, must have as many entries as Starts
+	 *	@param	InDelegate		Delegate run on the game thread when the batch has completed
+	 *	@return the batch, whose results are valid once FBatchedTraceQuery::IsComplete returns true or after FBatchedTraceQuery::WaitForCompletion
+	 */
+	TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe> AsyncBatchTraceByChannel(EBatchedTraceCompletion Completion, EAsyncTraceType InTraceType, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape = FCollisionShape::LineShape, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, const FCollisionResponseParams& ResponseParam = FCollisionResponseParams::DefaultResponseParam, FBatchedTraceDelegate* InDelegate = nullptr);
+
+	/**
+	 * Runs a batch of independent traces, or sweeps when CollisionShape is not a line, against the given object types on worker threads.
+	 * See AsyncBatchTraceByChannel.
+	 */
+	TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe> AsyncBatchTraceByObjectType(EBatchedTraceCompletion Completion, EAsyncTraceType InTraceType, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, const FCollisionObjectQueryParams& ObjectQueryParams, const FCollisionShape& CollisionShape = FCollisionShape::LineShape, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, FBatchedTraceDelegate* InDelegate = nullptr);
+
+private:
+	/** Creates and queues a batched trace, shared by the AsyncBatchTrace functions */
+	TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe> StartBatchedTrace(EBatchedTraceCompletion Completion, EAsyncTraceType InTraceType, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params, const FCollisionResponseParams& ResponseParam, const FCollisionObjectQueryParams& ObjectQueryParams, FBatchedTraceDelegate* InDelegate);
+
+public:
+
 	/** NavigationSystem getter */
 	FORCEINLINE UNavigationSystemBase* GetNavigationSystem() { return NavigationSystem; }
 	/** NavigationSystem const getter */
@@ -3627,12 +3685,40 @@ public:
 
 	FORCEINLINE FWorldPSCPool& GetPSCPool() { return PSCPool; }
 
+	/** Pool of out-of-play actors implementing IPoolableActorInterface, recycled by SpawnActor and DestroyActor. */
+	FORCEINLINE FWorldActorPool& GetActorPool() { return ActorPool; }
+
+	/** Query only static collision kept outside of the physics scene, see UPrimitiveComponent::bUseStaticCollisionStore. Null until a component registers with it. */
+	FORCEINLINE FStaticCollisionStore* GetStaticCollisionStore() const { return StaticCollisionStore.Get(); }
+
+	FStaticCollisionStore& GetOrCreateStaticCollisionStore();
+
 	private:
 
 	UPROPERTY()
 	FWorldPSCPool PSCPool;
 
 	//PSC Pooling END
+
+	/** Not a UPROPERTY: pooled actors are kept alive by their level, the pool only holds weak references. */
+	FWorldActorPool ActorPool;
+
+	/** Components remove themselves from the store when their physics state is destroyed. */
+	TUniquePtr<FStaticCollisionStore> StaticCollisionStore;
+
+public:
+
+	/** Scene components whose attach children still need their transforms updated, see USceneComponent::bDeferChildTransformUpdates */
+	TArray<FDeferredChildTransformUpdate> DeferredChildTransformUpdates;
+
+	/** Primitive components whose overlaps are updated in the next batched pass, see UPrimitiveComponent::bDeferOverlapUpdates */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> ComponentsPendingDeferredOverlapUpdate;
+
+	/** Character movement components with client moves queued on the server, see UCharacterMovementComponent::ProcessQueuedServerMoves */
+	TArray<TWeakObjectPtr<UCharacterMovementComponent>> CharacterMovementComponentsWithQueuedServerMoves;
+
+private:
+
 	FSubsystemCollection<UWorldSubsystem> SubsystemCollection;
 };
 
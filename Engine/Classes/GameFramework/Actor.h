@@ -33,6 +33,30 @@ struct FAttachedActorInfo;
 struct FNetViewer;
 struct FNetworkObjectInfo;
 
+/** Entry in an Actor's registered subobject list, see AActor::AddReplicatedSubObject */
+struct FReplicatedSubObjectInfo
+{
+	FReplicatedSubObjectInfo(UObject* InSubObject, ELifetimeCondition InNetCondition, bool bInDirtyTracked)
+		: SubObject(InSubObject)
+		, NetCondition(InNetCondition)
+		, DirtyKey(1)
+		, bDirtyTracked(bInDirtyTracked)
+	{
+	}
+
+	/** The replicated subobject */
+	TWeakObjectPtr<UObject> SubObject;
+
+	/** Condition evaluated against the channel's replication flags before the subobject is considered */
+	ELifetimeCondition NetCondition;
+
+	/** Bumped every time the subobject is marked dirty. Channels skip dirty tracked subobjects whose key they have already sent */
+	uint32 DirtyKey;
+
+	/** If false, the subobject is compared on every update like it would be through ReplicateSubobjects */
+	uint8 bDirtyTracked:1;
+};
+
 /** Chooses a method for actors to update overlap state (objects it is touching) on initialization, currently only used during level streaming. */
 UENUM(BlueprintType)
 enum class EActorUpdateOverlapsMethod : uint8
@@ -330,6 +354,13 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Replication)
 	uint8 bReplicates:1;
 
+	/**
+	 * If true, actor channels replicate the subobjects registered with AddReplicatedSubObject instead of calling ReplicateSubobjects.
+	 * Replicated components are registered automatically, other subobjects (including those owned by components) must be registered explicitly.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=Replication, AdvancedDisplay)
+	uint8 bReplicateUsingRegisteredSubObjectList:1;
+
 	/** This function should only be used in the constructor of classes that need to set the RemoteRole for backwards compatibility purposes */
 	void SetRemoteRoleForBackwardsCompat(const ENetRole InRemoteRole) { RemoteRole = InRemoteRole; }
 
@@ -447,9 +478,6 @@ private:
 	UPROPERTY(Config, Category = Collision, VisibleAnywhere)
 	EActorUpdateOverlapsMethod DefaultUpdateOverlapsMethodDuringLevelStreaming;
 
-	/** Internal helper to update Overlaps during Actor initialization/BeginPlay correctly based on the UpdateOverlapsMethodDuringLevelStreaming and bGenerateOverlapEventsDuringLevelStreaming settings. */
-	void UpdateInitialOverlaps(bool bFromLevelStreaming);
-
 	/** Describes how much control the remote machine has over the actor. */
 	UPROPERTY(Replicated, Transient)
 	TEnumAsByte<enum ENetRole> RemoteRole;	
@@ -610,6 +638,31 @@ public:
 	/** Method that allows an actor to replicate subobjects on its actor channel */
 	virtual bool ReplicateSubobjects(class UActorChannel *Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags);
 
+	/** Returns true if actor channels replicate this actor's registered subobject list instead of calling ReplicateSubobjects */
+	bool IsUsingRegisteredSubObjectList() const { return bReplicateUsingRegisteredSubObjectList; }
+
+	/** Switches between the registered subobject list and ReplicateSubobjects. Replicated components are (un)registered accordingly */
+	void SetReplicateUsingRegisteredSubObjectList(bool bNewReplicateUsingRegisteredSubObjectList);
+
+	/**
+	 * Registers a subobject to be replicated on this actor's channels when using the registered subobject list.
+	 * Registering an object that is already in the list updates its condition and dirty tracking.
+	 *
+	 * @param SubObject			The subobject to replicate, its outer chain should lead to this actor
+	 * @param NetCondition		Condition evaluated against the channel's replication flags
+	 * @param bDirtyTracked		If true, the subobject is only compared after MarkReplicatedSubObjectDirty was called (or when the channel needs to send everything)
+	 */
+	void AddReplicatedSubObject(UObject* SubObject, ELifetimeCondition NetCondition = COND_None, bool bDirtyTracked = false);
+
+	/** Removes a subobject from the registered list. Its replicator is destroyed on the client the next time the object is deleted */
+	void RemoveReplicatedSubObject(UObject* SubObject);
+
+	/** Flags a dirty tracked subobject so channels compare it on their next update */
+	void MarkReplicatedSubObjectDirty(UObject* SubObject);
+
+	/** Returns the registered subobject list */
+	const TArray<FReplicatedSubObjectInfo>& GetReplicatedSubObjects() const { return ReplicatedSubObjects; }
+
 	/** Called on the actor when a new subobject is dynamically created via replication */
 	virtual void OnSubobjectCreatedFromReplication(UObject *NewSubobject);
 
@@ -1420,6 +1473,12 @@ public:
 	/** Initiate a begin play call on this Actor, will handle calling in the correct order. */
 	void DispatchBeginPlay(bool bFromLevelStreaming = false);
 
+	/**
+	 * Internal helper to update Overlaps during Actor initialization/BeginPlay correctly based on the UpdateOverlapsMethodDuringLevelStreaming and bGenerateOverlapEventsDuringLevelStreaming settings.
+	 * Called by DispatchBeginPlay, or by ULevel::IncrementalUpdateInitialOverlaps when the level defers initial overlaps while streaming in.
+	 */
+	void UpdateInitialOverlaps(bool bFromLevelStreaming);
+
 	/** Returns whether an actor has been initialized for gameplay */
 	bool IsActorInitialized() const { return bActorInitialized; }
 
@@ -2306,6 +2365,12 @@ public:
 	UFUNCTION(BlueprintAuthorityOnly, BlueprintCallable, Category="Networking")
 	void FlushNetDormancy();
 
+	/**
+	 * Calls FlushNetDormancy on a group of actors, flushing them from each net driver's dormancy lists in a single pass.
+	 * Prefer this over flushing actors one at a time when waking up large groups (pickup fields, destructibles, etc.).
+	 */
+	static void FlushNetDormancyForActors(TArrayView<AActor* const> Actors);
+
 	/** Forces properties on this actor to do a compare for one frame (rather than share shadow state) */
 	void ForcePropertyCompare();
 
@@ -3092,6 +3157,14 @@ protected:
 	/** Set of replicated components, stored as an array to save space as this is generally not very large */
 	TArray<UActorComponent*> ReplicatedComponents;
 
+private:
+	/** Keeps the registered subobject list in sync with ReplicatedComponents, does nothing unless bReplicateUsingRegisteredSubObjectList is set */
+	void UpdateReplicatedSubObjectComponent(UActorComponent* Component);
+	void UpdateAllReplicatedSubObjectComponents();
+
+	/** Subobjects replicated when bReplicateUsingRegisteredSubObjectList is set */
+	TArray<FReplicatedSubObjectInfo> ReplicatedSubObjects;
+
 private:
 	/**
 	 * All ActorComponents owned by this Actor. Stored as a Set as actors may have a large number of components
@@ -509,6 +509,16 @@ public:
 	UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly)
 	uint8 bNetworkSkipProxyPredictionOnNetUpdate:1;
 
+	/**
+	 * Whether a walking simulated proxy whose mesh has not been rendered for p.NetProxyNotRenderedTime seconds moves along its velocity
+	 * without sweeps or floor checks. Its floor is found again on the first frame it is simulated normally.
+	 */
+	UPROPERTY(Category="Character Movement (Networking)", EditDefaultsOnly)
+	uint8 bNetworkSkipProxyCollisionWhenNotRendered:1;
+
+	/** Set when a simulated proxy moved without collision, so that its floor is refreshed when it simulates normally again. */
+	uint8 bNetworkProxyMovedWithoutCollision:1;
+
 	/**
 	 * Flag used on the server to determine whether to always replicate ReplicatedServerLastTransformUpdateTimeStamp to clients.
 	 * Normally this is only sent when the network smoothing mode on character movement is set to Linear smoothing (on the server), to save bandwidth.
@@ -848,6 +858,14 @@ public:
 	UPROPERTY(Category="Character Movement: Walking", EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
 	float LedgeCheckThreshold;
 
+	/**
+	 * How long, in seconds, the result of a floor sweep may be reused while the character stays at the same location, with the same capsule size,
+	 * on a base that has not moved. The cached floor is used even when bAlwaysCheckFloor is set, so this bounds how long geometry moving up into
+	 * a stationary character can go unnoticed. 0 disables the cache.
+	 */
+	UPROPERTY(Category="Character Movement: Walking", EditAnywhere, BlueprintReadWrite, AdvancedDisplay, meta=(ClampMin="0", UIMin="0"))
+	float StationaryFloorCacheLifetime;
+
 	/** When exiting water, jump if control pitch angle is this high or above. */
 	UPROPERTY(Category="Character Movement: Swimming", EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
 	float JumpOutOfWaterPitch;
@@ -1120,6 +1138,23 @@ public:
 	/** Last valid projected hit result from raycast to geometry from navmesh */
 	FHitResult CachedProjectedNavMeshHitResult;
 
+	/** Result of the last floor sweep, reused by FindFloor() for stationary characters, see StationaryFloorCacheLifetime */
+	FFindFloorResult CachedFloorSweepResult;
+
+	/** Capsule location and size the cached floor sweep was done with */
+	FVector CachedFloorSweepLocation;
+	FVector2D CachedFloorSweepCapsuleSize;
+
+	/** Floor component of the cached floor sweep, and its transform at the time */
+	TWeakObjectPtr<UPrimitiveComponent> CachedFloorSweepBase;
+	FTransform CachedFloorSweepBaseTransform;
+
+	/** World time of the cached floor sweep, negative when there is no cached floor */
+	float CachedFloorSweepTime;
+
+	/** Returns true if the cached floor sweep is still valid for a capsule at CapsuleLocation */
+	bool CanUseCachedFloorSweep(const FVector& CapsuleLocation) const;
+
 	/** How often we should raycast to project from navmesh to underlying geometry */
 	UPROPERTY(Category="Character Movement: NavMesh Movement", EditAnywhere, BlueprintReadWrite, meta=(editcondition = "bProjectNavMeshWalking"))
 	float NavMeshProjectionInterval;
@@ -2327,6 +2362,15 @@ public:
 	virtual void ServerMoveOld(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags);
 	virtual void ServerMoveOld_Implementation(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags);
 	virtual bool ServerMoveOld_Validate(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags);
+
+	/**
+	 * Simulates the moves queued in the server prediction data by ServerMove_Implementation when p.NetQueueServerMoves is enabled,
+	 * in the order they were received, under a single scoped movement update.
+	 */
+	void ProcessQueuedServerMoves();
+
+	/** Processes the queued server moves of every character of the world. Called by the world once per frame after TickDispatch. */
+	static void ProcessAllQueuedServerMoves(UWorld* World);
 	
 	/** If no client adjustment is needed after processing received ServerMove(), ack the good move so client can remove it from SavedMoves */
 	virtual void ClientAckGoodMove(float TimeStamp);
@@ -2944,6 +2988,27 @@ public:
 	/** Creation time of this prediction data, used to contextualize LifetimeRawTimeDiscrepancy */
 	float WorldCreationTime;
 
+	/** Parameters of a ServerMove() received while p.NetQueueServerMoves is enabled, simulated later by UCharacterMovementComponent::ProcessQueuedServerMoves() */
+	struct FQueuedServerMove
+	{
+		float TimeStamp;
+		FVector_NetQuantize10 Accel;
+		FVector_NetQuantize100 ClientLoc;
+		uint8 MoveFlags;
+		uint8 ClientRoll;
+		uint32 View;
+		TWeakObjectPtr<UPrimitiveComponent> ClientMovementBase;
+		FName ClientBaseBoneName;
+		uint8 ClientMovementMode;
+		bool bIgnoreRootMotion;
+	};
+
+	/** Moves received since the last time the queue was processed, in the order they arrived. Timestamps are verified when the moves are simulated. */
+	TArray<FQueuedServerMove> QueuedServerMoves;
+
+	/** True while QueuedServerMoves is being simulated, so the moves are performed instead of being queued again */
+	bool bProcessingQueuedServerMoves;
+
 	/** Returns time delta to use for the current ServerMove(). Takes into account time discrepancy resolution if active. */
 	float GetServerMoveDeltaTime(float ClientTimeStamp, float ActorTimeDilation) const;
 
@@ -11,6 +11,7 @@
 #include "GameFramework/DamageType.h"
 #include "GameFramework/Info.h"
 #include "Sound/AudioVolume.h"
+#include "Particles/WorldPSCPool.h"
 #include "UObject/ConstructorHelpers.h"
 #include "WorldSettings.generated.h"
 
@@ -577,6 +578,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=World, AdvancedDisplay)
 	FVector DefaultColorScale;
 
+	/** Particle systems to pre-allocate pooled components for when the level is brought up for play, so their first spawn doesn't hitch. */
+	UPROPERTY(EditAnywhere, Category=World, AdvancedDisplay)
+	TArray<FPSCPoolPrewarmEntry> ParticleSystemPoolPrewarm;
+
 	/** Max occlusion distance used by mesh distance fields, overridden if there is a movable skylight. */
 	UPROPERTY(EditAnywhere, Category=Rendering, meta=(UIMin = "500", UIMax = "5000", DisplayName = "Default Max DistanceField Occlusion Distance"))
 	float DefaultMaxDistanceFieldOcclusionDistance;
@@ -0,0 +1,40 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+//=============================================================================
+// IPoolableActorInterface is implemented by actor classes that want to be recycled
+// through the world's actor pool instead of being destroyed and respawned.
+// See FWorldActorPool for how actors are parked and handed back out.
+//=============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/Interface.h"
+#include "PoolableActorInterface.generated.h"
+
+UINTERFACE(MinimalAPI, meta=(CannotImplementInterfaceInBlueprint))
+class UPoolableActorInterface : public UInterface
+{
+	GENERATED_UINTERFACE_BODY()
+};
+
+class ENGINE_API IPoolableActorInterface
+{
+	GENERATED_IINTERFACE_BODY()
+
+	/**
+	 * Called when the actor is destroyed during play and is about to be parked in the actor pool instead.
+	 * Reset any gameplay state here. Components stay registered, with their physics and render state intact.
+	 */
+	virtual void OnReturnedToPool() {}
+
+	/**
+	 * Called when SpawnActor hands this actor back out of the pool, after its transform, owner and instigator have been reapplied.
+	 * This takes the place of construction and BeginPlay for a recycled actor.
+	 */
+	virtual void OnTakenFromPool() {}
+
+	/** Gives the actor a chance to opt out of pooling for a particular destroy, in which case it is destroyed normally. */
+	virtual bool CanReturnToPool() const { return true; }
+};
@@ -31,6 +31,8 @@ struct FDrawToRenderTargetContext
 	FDrawEvent* DrawEvent;
 };
 
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnRenderTargetPixelsRead, bool, bSuccess, const TArray<FColor>&, Pixels);
+
 UCLASS(MinimalAPI, meta=(ScriptName="RenderingLibrary"))
 class UKismetRenderingLibrary : public UBlueprintFunctionLibrary
 {
@@ -100,6 +102,14 @@ class UKismetRenderingLibrary : public UBlueprintFunctionLibrary
 	UFUNCTION(BlueprintCallable, Category = "Rendering", meta = (Keywords = "ReadRenderTarget", WorldContext = "WorldContextObject"))
 	static ENGINE_API FColor ReadRenderTargetUV(UObject* WorldContextObject, UTextureRenderTarget2D* TextureRenderTarget, float U, float V);
 
+	/**
+	* Reads the pixels of a render target without stalling the game thread, OnPixelsRead is called with them a frame or two later.
+	* Reads the whole render target if Width or Height is 0. Supports RGBA8 and RGBA16f render targets.
+	* Pixels are 8-bit per channel [0,255] BGRA in sRGB space, row by row, HDR render targets are assumed to be in linear space.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Rendering", meta = (Keywords = "ReadRenderTarget Async", WorldContext = "WorldContextObject"))
+	static ENGINE_API void ReadRenderTargetPixelsAsync(UObject* WorldContextObject, UTextureRenderTarget2D* TextureRenderTarget, FOnRenderTargetPixelsRead OnPixelsRead, int32 X = 0, int32 Y = 0, int32 Width = 0, int32 Height = 0);
+
 	/**
 	* Incredibly inefficient and slow operation! Read a value as-is from a render target using integer pixel coordinates.
 	*/
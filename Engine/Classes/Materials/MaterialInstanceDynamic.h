@@ -8,6 +8,21 @@
 #include "Materials/MaterialInstance.h"
 #include "MaterialInstanceDynamic.generated.h"
 
+/**
+ * While one is alive on the game thread, the scalar and vector parameter updates of every material instance are gathered and
+ * sent to the rendering thread in a single command when the outermost scope closes, invalidating the uniform expressions of
+ * each instance once instead of once per parameter. Use it around code setting many parameters on many instances in a frame.
+ */
+class ENGINE_API FMaterialInstanceParameterUpdateScope
+{
+public:
+	FMaterialInstanceParameterUpdateScope();
+	~FMaterialInstanceParameterUpdateScope();
+
+	/** Sends the gathered updates to the rendering thread now. Called before anything else is enqueued for an instance that must run after its parameter updates. */
+	static void Flush();
+};
+
 UCLASS(hidecategories=Object, collapsecategories, BlueprintType)
 class ENGINE_API UMaterialInstanceDynamic : public UMaterialInstance
 {
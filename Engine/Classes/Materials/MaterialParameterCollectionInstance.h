@@ -13,6 +13,8 @@
 
 class FMaterialParameterCollectionInstanceResource;
 class UMaterialParameterCollection;
+struct FCollectionScalarParameter;
+struct FCollectionVectorParameter;
 
 /** 
  * Class that stores per-world instance parameter data for a given UMaterialParameterCollection resource. 
@@ -76,9 +78,19 @@ protected:
 
 	/** Boils down the instance overrides and default values into data to be set on the uniform buffer. */
 	void GetParameterData(TArray<FVector4>& ParameterData) const;
+
+	/** Writes a changed parameter into the cached uniform buffer data, and queues the render state update. */
+	void UpdateScalarParameterData(const FCollectionScalarParameter& Parameter, float ParameterValue);
+	void UpdateVectorParameterData(const FCollectionVectorParameter& Parameter, const FLinearColor& ParameterValue);
+
+	void MarkRenderStateDirty(bool bRecreateUniformBuffer);
 	
 	/** Tracks whether this instance needs to update the render state from the game thread */
 	bool bNeedsRenderStateUpdate;
+
+	/** Uniform buffer data last built by GetParameterData, kept up to date by the parameter setters so updates don't rebuild it. */
+	TArray<FVector4> CachedParameterData;
+	bool bCachedParameterDataValid;
 };
 
 
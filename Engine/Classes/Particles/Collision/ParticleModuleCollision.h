@@ -160,6 +160,15 @@ class UParticleModuleCollision : public UParticleModuleCollisionBase
 	UPROPERTY(EditAnywhere, Category=Performance)
 	float MaxCollisionDistance;
 
+	/**
+	 *	If true, the rays of all particles of the emitter are traced as one batched query on worker threads, and the hits are
+	 *	applied during the next update, carried over to where the particles have moved since. Much cheaper than a trace per
+	 *	particle, at the cost of collisions being found from where particles were heading a frame earlier.
+	 *	Mesh particles sweep the mesh bounds without taking particle size into account, and PerformCollisionCheck isn't called.
+	 */
+	UPROPERTY(EditAnywhere, Category=Performance)
+	uint32 bUseBatchedCollision:1;
+
 	/** Initializes the default values for this property */
 	void InitializeDefaults();
 
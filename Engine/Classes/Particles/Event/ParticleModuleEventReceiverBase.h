@@ -55,5 +55,21 @@ class UParticleModuleEventReceiverBase : public UParticleModuleEventBase
 	{
 		return false;
 	}
+
+	/**
+	 *	Process all the events of one type that occurred this frame. Processes each event with ProcessParticleEvent
+	 *	by default, receivers may override it to handle many events at once.
+	 *
+	 *	@param	Owner		The FParticleEmitterInstance this module is contained in.
+	 *	@param	InEvents	The events that occurred, all of the same type.
+	 *	@param	DeltaTime	The time slice of this frame.
+	 */
+	virtual void ProcessParticleEvents(FParticleEmitterInstance* Owner, const FParticleEventBatch& InEvents, float DeltaTime)
+	{
+		for (int32 EventIndex = 0; EventIndex < InEvents.Num(); EventIndex++)
+		{
+			ProcessParticleEvent(Owner, InEvents[EventIndex], DeltaTime);
+		}
+	}
 };
 
@@ -22,6 +22,7 @@ class UParticleModuleEventReceiverKillParticles : public UParticleModuleEventRec
 
 	//~ Begin UParticleModuleEventBase Interface
 	virtual bool ProcessParticleEvent(FParticleEmitterInstance* Owner, FParticleEventData& InEvent, float DeltaTime) override;
+	virtual void ProcessParticleEvents(FParticleEmitterInstance* Owner, const FParticleEventBatch& InEvents, float DeltaTime) override;
 	//~ End UParticleModuleEventBase Interface
 };
 
@@ -76,7 +76,18 @@ class UParticleModuleEventReceiverSpawn : public UParticleModuleEventReceiverBas
 
 	//~ Begin UParticleModuleEventBase Interface
 	virtual bool ProcessParticleEvent(FParticleEmitterInstance* Owner, FParticleEventData& InEvent, float DeltaTime) override;
+	virtual void ProcessParticleEvents(FParticleEmitterInstance* Owner, const FParticleEventBatch& InEvents, float DeltaTime) override;
 	//~ End UParticleModuleEventBase Interface
+
+private:
+	/** Returns true if the event is one this module spawns from. */
+	bool IsEventOfInterest(const FParticleEventData& InEvent) const
+	{
+		return (InEvent.EventName == EventName) && ((EventGeneratorType == EPET_Any) || (EventGeneratorType == InEvent.Type));
+	}
+
+	/** Returns the number of particles to spawn for an event of interest. */
+	int32 GetSpawnCount(const FParticleEventData& InEvent);
 };
 
 
@@ -327,6 +327,39 @@ struct FParticleEventKismetData : public FParticleEventData
 {
 };
 
+/**
+ *	All the events of one type that occurred in a PSysComp, handed to event receivers in one call.
+ *	Events keep their concrete type, cast them according to GetType() as with single events.
+ */
+struct FParticleEventBatch
+{
+	template<typename EventDataType>
+	FParticleEventBatch(EParticleEventType InType, TArray<EventDataType>& InEvents)
+		: Type(InType)
+		, Events((uint8*)InEvents.GetData())
+		, NumEvents(InEvents.Num())
+		, Stride(sizeof(EventDataType))
+	{
+		static_assert(TIsDerivedFrom<EventDataType, FParticleEventData>::IsDerived, "Particle event batches only hold particle event data.");
+	}
+
+	EParticleEventType GetType() const { return Type; }
+
+	int32 Num() const { return NumEvents; }
+
+	FParticleEventData& operator[](int32 Index) const
+	{
+		checkSlow(Index >= 0 && Index < NumEvents);
+		return *(FParticleEventData*)(Events + Index * Stride);
+	}
+
+private:
+	EParticleEventType Type;
+	uint8* Events;
+	int32 NumEvents;
+	int32 Stride;
+};
+
 UCLASS(Abstract)
 class ENGINE_API UFXSystemComponent : public UPrimitiveComponent
 {
@@ -540,6 +573,12 @@ private:
 
 	/** If true, it means the ASync work is done and the finalize is not */
 	uint8 bNeedsFinalize:1;
+
+	/** If true, ConcurrentBoundingBox was gathered from the emitters by the concurrent tick and finalize doesn't have to */
+	uint8 bConcurrentBoundingBoxValid:1;
+
+	/** Union of the emitter bounds, gathered at the end of the concurrent tick */
+	FBox ConcurrentBoundingBox;
 	
 	/** If true, it means the Async work is in process and not yet completed. */
 	volatile bool bAsyncWorkOutstanding;
@@ -1321,6 +1360,9 @@ public:
 
 	void MarshalParamsForAsyncTick();
 private:
+	/** Returns the union of the bounds of the enabled emitter instances */
+	FBox GetEmitterBoundingBox() const;
+
 	/** Wait on the async task and call finalize on the tick **/
 	void WaitForAsyncAndFinalize(EForceAsyncWorkCompletion Behavior, bool bDefinitelyGameThread = true) const;
 
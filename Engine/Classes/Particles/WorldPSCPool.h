@@ -55,13 +55,36 @@ struct FPSCPoolElem
 
 	float LastUsedTime;
 
+	/** Approximate memory held by the free PSC, measured when it was returned to the pool. */
+	uint32 ApproxMemoryUsage;
+
 	FPSCPoolElem()
-		: PSC(nullptr), LastUsedTime(0.0f)
+		: PSC(nullptr), LastUsedTime(0.0f), ApproxMemoryUsage(0)
 	{
 
 	}
-	FPSCPoolElem(UParticleSystemComponent* InPSC, float InLastUsedTime)
-		: PSC(InPSC), LastUsedTime(InLastUsedTime)
+	FPSCPoolElem(UParticleSystemComponent* InPSC, float InLastUsedTime, uint32 InApproxMemoryUsage = 0)
+		: PSC(InPSC), LastUsedTime(InLastUsedTime), ApproxMemoryUsage(InApproxMemoryUsage)
+	{
+
+	}
+};
+
+/** A particle system to pre-allocate pooled components for when a level is brought up for play. */
+USTRUCT()
+struct FPSCPoolPrewarmEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = Pooling)
+	UParticleSystem* System;
+
+	/** Number of free components to create. Clamped to the MaxPoolSize of the system. */
+	UPROPERTY(EditAnywhere, Category = Pooling, meta = (ClampMin = "1"))
+	int32 NumComponents;
+
+	FPSCPoolPrewarmEntry()
+		: System(nullptr), NumComponents(1)
 	{
 
 	}
@@ -74,6 +97,7 @@ struct FPSCPool
 	GENERATED_BODY()
 
 	//Collection of all currently allocated, free items ready to be grabbed for use.
+	//Ordered from the least to the most recently used, so the budget can trim from the front.
 	//TODO: Change this to a FIFO queue to get better usage. May need to make this whole class behave similar to TCircularQueue.
 	UPROPERTY(transient)
 	TArray<FPSCPoolElem> FreeElements;
@@ -89,6 +113,9 @@ struct FPSCPool
 	/** Keeping track of max in flight systems to help inform any future pre-population we do. */
 	int32 MaxUsed;
 
+	/** Sum of the ApproxMemoryUsage of FreeElements. */
+	uint32 FreeMemoryUsage;
+
 public:
 
 	FPSCPool();
@@ -102,6 +129,21 @@ public:
 	/** Kills any components that have not been used since the passed KillTime. */
 	void KillUnusedComponents(float KillTime, UParticleSystem* Template);
 
+	/** Creates free components, with their emitter instances allocated, until the pool holds NumComponents of them. */
+	void Prewarm(UWorld* World, UParticleSystem* Template, int32 NumComponents, const float CurrentTimeSeconds);
+
+private:
+	/** Creates a new component set up for pooling. */
+	static UParticleSystemComponent* CreateComponent(UWorld* World, UParticleSystem* Template);
+
+	/** Destroys the least recently used free components until the free components fit the per system memory budget. */
+	void TrimToMemoryBudget();
+
+	/** Destroys a free component and removes it from FreeElements, keeping the others in order. */
+	void DestroyFreeElement(int32 Index);
+
+public:
+
 	int32 NumComponents() { return FreeElements.Num(); }
 };
 
@@ -132,6 +174,9 @@ public:
 
 	/** Call if you want to halt & reclaim all active particle systems and return them to their respective pools. */
 	void ReclaimActiveParticleSystems();
+
+	/** Pre-allocates free components for each entry, e.g. from the world settings while the level is brought up for play. */
+	void PrewarmPools(UWorld* World, TArrayView<const FPSCPoolPrewarmEntry> Entries);
 	
 	/** Dumps the current state of the pool to the log. */
 	void Dump();
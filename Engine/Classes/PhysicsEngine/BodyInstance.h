@@ -115,6 +115,23 @@ struct FInitBodiesHelperBase
 	bool CreateShapesAndActors();
 	void InitBodies();
 
+	/**
+	 * The steps of CreateShapesAndActors and InitBodies, so that FScopedBodyInstanceInitBatch can run each of them over several helpers.
+	 * PrepareBodies and FinishBodies run on the game thread. CreateBody can run on any thread, once per body.
+	 * PrepareBodies returns false if the bodies don't need to be created, e.g. because they were welded to their parent.
+	 */
+	bool PrepareBodies();
+	void CreateBody(int32 BodyIdx);
+	void FinishBodies();
+	void CollectActorsToAdd_AssumesLocked(TArray<FPhysicsActorHandle>& OutActorHandles);
+	void PostAddToScene_AssumesLocked();
+
+	/** Returns true if that many bodies are worth creating on worker threads, see p.ParallelInitBodiesMinBatchSize */
+	static bool ShouldCreateBodiesInParallel(int32 NumBodies);
+
+	/** Set by CreateBody for each body that ended up without shapes */
+	TArray<bool> BodyInitFailed;
+
 protected:
 	void UpdateSimulatingAndBlendWeight();
 
@@ -177,6 +194,44 @@ struct FInitBodiesHelperWithData : public FInitBodiesHelperBase
 	TArray<FTransform> OwnedTransforms;
 };
 
+/**
+ * Collects the bodies initialized on the game thread while in scope, and initializes them together when the scope ends:
+ * shapes and actors are created in parallel (see p.ParallelInitBodiesMinBatchSize) and the actors are added to each physics scene at once.
+ * Bodies initialized in scope don't have a physics actor until the scope ends, so code that needs the actor right after InitBody, such as
+ * welding or constraint creation, must run after it. Scopes may be nested, each one initializes the bodies it collected.
+ */
+struct ENGINE_API FScopedBodyInstanceInitBatch : public FNoncopyable
+{
+	/** @param bInBatchDynamicBodies	Also collect movable bodies. Static bodies are always collected. */
+	explicit FScopedBodyInstanceInitBatch(bool bInBatchDynamicBodies = false);
+	~FScopedBodyInstanceInitBatch();
+
+private:
+	friend struct FBodyInstance;
+
+	/** Returns the innermost batch in scope on the game thread, if any */
+	static FScopedBodyInstanceInitBatch* GetCurrent();
+
+	/** Queues a body for initialization at the end of the scope. Returns false if the body must be initialized right away. */
+	bool TryAdd(FBodyInstance* Body, const FTransform& Transform, class UBodySetup* Setup, class UPrimitiveComponent* PrimComp, FPhysScene* InRBScene, const FInitBodySpawnParams& SpawnParams);
+
+	/** Drops a body terminated before the end of the scope, from this batch and the outer ones */
+	void Remove(FBodyInstance* Body);
+
+	/** Initializes the queued bodies of this batch and the outer ones */
+	void FlushAll();
+
+	void Flush();
+
+	/** The bodies queued by one InitBody call, and the helper initializing them. Defined in BodyInstance.cpp. */
+	struct FPendingBodies;
+	TArray<TUniquePtr<FPendingBodies>> PendingBodies;
+	TSet<FBodyInstance*> PendingBodySet;
+
+	FScopedBodyInstanceInitBatch* OuterBatch;
+	bool bBatchDynamicBodies;
+};
+
 USTRUCT()
 struct ENGINE_API FCollisionResponse
 {
@@ -1176,6 +1231,7 @@ private:
 	friend class FBodySetupDetails;
 	
 	friend struct FInitBodiesHelperBase;
+	friend struct FScopedBodyInstanceInitBatch;
 	friend class FBodyInstanceCustomizationHelper;
 	friend class FFoliageTypeCustomizationHelpers;
 
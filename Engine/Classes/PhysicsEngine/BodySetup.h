@@ -13,6 +13,7 @@
 #include "PhysicsEngine/AggregateGeom.h"
 #include "Interfaces/Interface_CollisionDataProvider.h"
 #include "HAL/ThreadSafeBool.h"
+#include "Misc/ScopeRWLock.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "BodySetup.generated.h"
 
@@ -81,6 +82,19 @@ struct FBodySetupUVInfo
 	void FillFromTriMesh(const FTriMeshCollisionData& TriMeshCollisionData);
 };
 
+/** Mass properties of the simple collision of a body setup at one scale, for a density of 1. See UBodySetup::FindScaledMassProperties. */
+struct FBodySetupScaledMassProperties
+{
+	float Mass;
+	FVector CenterOfMass;
+
+	/** Columns of the inertia tensor */
+	FVector InertiaTensor[3];
+
+	/** Number of shapes the properties were computed from, bodies with a different number of shapes compute their own */
+	int32 NumShapes;
+};
+
 /** Helper struct to indicate which geometry needs to be cooked */
 struct ENGINE_API FCookBodySetupInfo
 {
@@ -298,6 +312,11 @@ public:
 	FPhysXCookHelper* CurrentCookHelper;
 #endif
 
+private:
+	/** See FindScaledMassProperties */
+	TMap<FVector, FBodySetupScaledMassProperties> ScaledMassProperties;
+	mutable FRWLock ScaledMassPropertiesLock;
+
 public:
 	//~ Begin UObject Interface.
 	virtual void Serialize(FArchive& Ar) override;
@@ -374,6 +393,14 @@ public:
 	/** Release Physics meshes (ConvexMeshes, TriMesh & TriMeshNegX) */
 	ENGINE_API void ClearPhysicsMeshes();
 
+	/**
+	 * Returns the mass properties cached for bodies of this setup at Scale3D, so that bodies sharing this setup and scale compute them once.
+	 * The cache is cleared with the physics meshes. Thread safe.
+	 */
+	ENGINE_API bool FindScaledMassProperties(const FVector& Scale3D, int32 NumShapes, FBodySetupScaledMassProperties& OutMassProperties) const;
+	ENGINE_API void AddScaledMassProperties(const FVector& Scale3D, const FBodySetupScaledMassProperties& MassProperties);
+	ENGINE_API void ClearScaledMassProperties();
+
 	/** Calculates the mass. You can pass in the component where additional information is pulled from ( Scale, PhysMaterialOverride ) */
 	ENGINE_API virtual float CalculateMass(const UPrimitiveComponent* Component = nullptr) const;
 
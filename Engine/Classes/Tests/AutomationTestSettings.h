@@ -314,6 +314,71 @@ struct FEditorMapPerformanceTestDefinition
 	int32 TestTimer;
 };
 
+/**
+* Holds settings for a performance benchmark of the Project.Performance.Benchmarks test.
+* A benchmark either flies a camera along a spline of a map or plays a replay, at a fixed time step, and fails when
+* a measure goes over its threshold. Thresholds of 0 aren't checked.
+*/
+USTRUCT()
+struct FPerformanceBenchmarkDefinition
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Name of the benchmark, used as the name of the test and of its FPS chart **/
+	UPROPERTY(config, EditAnywhere, Category = Automation)
+	FString Name;
+
+	/** Map to fly through, unused when playing a replay **/
+	UPROPERTY(config, EditAnywhere, Category = Automation, meta = (AllowedClasses = "World"))
+	FSoftObjectPath Map;
+
+	/** Tag of the actor holding the spline component the camera flies along **/
+	UPROPERTY(config, EditAnywhere, Category = Automation)
+	FName FlythroughSplineActorTag;
+
+	/** How long the flythrough lasts, in game time **/
+	UPROPERTY(config, EditAnywhere, Category = Automation, meta = (ClampMin = "0.1"))
+	float FlythroughDuration;
+
+	/** Replay to play instead of a flythrough **/
+	UPROPERTY(config, EditAnywhere, Category = Automation)
+	FString ReplayName;
+
+	/** Frame rate of the fixed time step the game runs at during the benchmark, so every run simulates the same frames **/
+	UPROPERTY(config, EditAnywhere, Category = Automation, meta = (ClampMin = "1"))
+	float FixedFrameRate;
+
+	/** Whether to record a CSV profile of the benchmark **/
+	UPROPERTY(config, EditAnywhere, Category = Automation)
+	bool bCaptureCsvProfile;
+
+	/** Threshold of the average frame time **/
+	UPROPERTY(config, EditAnywhere, Category = Thresholds)
+	float MaxAverageFrameTimeMS;
+
+	/** Threshold of the number of hitches per minute **/
+	UPROPERTY(config, EditAnywhere, Category = Thresholds)
+	float MaxHitchesPerMinute;
+
+	/** Threshold of the peak physical memory used by the process **/
+	UPROPERTY(config, EditAnywhere, Category = Thresholds)
+	float MaxPeakUsedMemoryMB;
+
+	/** Thresholds of the 99th percentile of performance tracking timers, e.g. Animation or Physics **/
+	UPROPERTY(config, EditAnywhere, Category = Thresholds)
+	TMap<FName, float> MaxSubsystemTimeP99MS;
+
+	FPerformanceBenchmarkDefinition()
+		: FlythroughDuration(30.0f)
+		, FixedFrameRate(30.0f)
+		, bCaptureCsvProfile(true)
+		, MaxAverageFrameTimeMS(0.0f)
+		, MaxHitchesPerMinute(0.0f)
+		, MaxPeakUsedMemoryMB(0.0f)
+	{
+	}
+};
+
 /**
 * Holds settings for the editor Launch On With Map Iterations test.
 */
@@ -421,6 +486,12 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = Automation, meta = (FilePathFilter="umap"))
 	TArray<FLaunchOnTestSettings> LaunchOnSettings;
 
+	/**
+	* The performance benchmarks run by the Project.Performance.Benchmarks test.
+	*/
+	UPROPERTY(config, EditAnywhere, Category = Automation)
+	TArray<FPerformanceBenchmarkDefinition> PerformanceBenchmarks;
+
 	/**
 	 * The default resolution to take all automation screenshots at.
 	 */
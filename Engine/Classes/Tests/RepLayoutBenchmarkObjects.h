@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/Object.h"
+#include "RepLayoutBenchmarkObjects.generated.h"
+
+/** Replicated objects with representative property layouts, measured by the Net.RepLayoutBenchmark test */
+
+USTRUCT()
+struct FRepLayoutBenchmarkStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Int = 0;
+
+	UPROPERTY()
+	float Float = 0.0f;
+
+	UPROPERTY()
+	FVector Vector = FVector::ZeroVector;
+
+	UPROPERTY()
+	uint8 Byte = 0;
+};
+
+USTRUCT()
+struct FRepLayoutBenchmarkNestedStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FRepLayoutBenchmarkStruct Inner[4];
+
+	UPROPERTY()
+	TArray<int32> Values;
+};
+
+UCLASS(abstract, transient)
+class URepLayoutBenchmarkObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool IsSupportedForNetworking() const override { return true; }
+
+	/** Changes the properties a replicated object would typically change in a frame */
+	virtual void Mutate(int32 Iteration) PURE_VIRTUAL(URepLayoutBenchmarkObject::Mutate, );
+};
+
+/** Flat scalars and static arrays of scalars */
+UCLASS(transient)
+class URepLayoutBenchmarkScalars : public URepLayoutBenchmarkObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Replicated)
+	int32 Ints[8];
+
+	UPROPERTY(Replicated)
+	float Floats[8];
+
+	UPROPERTY(Replicated)
+	FVector Vectors[4];
+
+	UPROPERTY(Replicated)
+	uint8 bFlag0 : 1;
+
+	UPROPERTY(Replicated)
+	uint8 bFlag1 : 1;
+
+	UPROPERTY(Replicated)
+	FName Name;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void Mutate(int32 Iteration) override;
+};
+
+/** Structs, static arrays of structs and nested structs */
+UCLASS(transient)
+class URepLayoutBenchmarkStructs : public URepLayoutBenchmarkObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Replicated)
+	FRepLayoutBenchmarkStruct Structs[8];
+
+	UPROPERTY(Replicated)
+	FRepLayoutBenchmarkNestedStruct Nested;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void Mutate(int32 Iteration) override;
+};
+
+/** Dynamic arrays of scalars and structs, some of them resized */
+UCLASS(transient)
+class URepLayoutBenchmarkArrays : public URepLayoutBenchmarkObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Replicated)
+	TArray<int32> Ints;
+
+	UPROPERTY(Replicated)
+	TArray<FVector> Vectors;
+
+	UPROPERTY(Replicated)
+	TArray<FRepLayoutBenchmarkStruct> Structs;
+
+	URepLayoutBenchmarkArrays();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void Mutate(int32 Iteration) override;
+};
@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "EngineDefines.h"
 #include "VisualLogger/VisualLoggerTypes.h"
+#include "Async/TaskGraphInterfaces.h"
 
 #if ENABLE_VISUAL_LOG
 
@@ -28,8 +29,35 @@ public:
 	virtual void GetRecordedLogs(TArray<FVisualLogEntryItem>& RecordedLogs) const override { RecordedLogs = FrameCache; }
 	virtual bool HasFlags(int32 InFlags) const override { return !!(InFlags & (EVisualLoggerDeviceFlags::CanSaveToFile | EVisualLoggerDeviceFlags::StoreLogsLocally)); }
 
+	/** Writes the frames kept in memory by the ring buffer mode (vislog.BinaryFile.RingBufferSeconds) to a new file, recording goes on */
+	void DumpRingBuffer();
+
 protected:
+	/** A frame serialized by a write task, kept in memory in ring buffer mode */
+	struct FSerializedFrame
+	{
+		float TimeStamp;
+		TArray<uint8> Data;
+	};
+
+	/** Hands the frame cache to a write task, the tasks run in order */
+	void FlushFrameCache();
+
+	/** Serializes Entries and appends them to the file or the ring buffer, on a background thread unless async writes are disabled */
+	void WriteFrame(TArray<FVisualLogEntryItem>& Entries, float TimeStamp);
+
+	void WaitForPendingWrites();
+
+	/** Writes Frames to a new file in the log directory, returns its size */
+	static int64 SaveFrames(const TArray<FSerializedFrame>& Frames, const FString& TempFullFilename);
+
 	int32 bUseCompression : 1;
+	/** Set when recording starts, so ring buffer mode doesn't change while writes are pending */
+	int32 bUseRingBuffer : 1;
+	float RingBufferSeconds;
+	FGraphEventRef LastWriteTask;
+	FCriticalSection RingBufferCS;
+	TArray<FSerializedFrame> RingBuffer;
 	float FrameCacheLenght;
 	float StartRecordingTime;
 	float LastLogTimeStamp;
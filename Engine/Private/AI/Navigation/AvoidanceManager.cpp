@@ -8,9 +8,33 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AI/RVOAvoidanceInterface.h"
 #include "AI/Navigation/NavEdgeProviderInterface.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_STAT(STAT_AI_ObstacleAvoidance);
 
+static float GAvoidanceGridCellSize = 500.0f;
+static FAutoConsoleVariableRef CVarAvoidanceGridCellSize(
+	TEXT("ai.Avoidance.GridCellSize"),
+	GAvoidanceGridCellSize,
+	TEXT("Size of the cells of the grid the avoidance manager buckets agents in to find their neighbors, around the usual avoidance consideration radius.\n")
+	TEXT("0 tests every agent against every other agent."),
+	ECVF_Default);
+
+static float GAvoidanceGridMargin = 50.0f;
+static FAutoConsoleVariableRef CVarAvoidanceGridMargin(
+	TEXT("ai.Avoidance.GridMargin"),
+	GAvoidanceGridMargin,
+	TEXT("Distance agents may move in a frame after the avoidance neighbor grid was built, neighbor queries are extended by it."),
+	ECVF_Default);
+
+static int32 GAvoidanceBatchSize = 32;
+static FAutoConsoleVariableRef CVarAvoidanceBatchSize(
+	TEXT("ai.Avoidance.BatchSize"),
+	GAvoidanceBatchSize,
+	TEXT("Number of agents each worker task solves in UAvoidanceManager::GetAvoidanceVelocities."),
+	ECVF_Default);
+
 FNavAvoidanceData::FNavAvoidanceData(UAvoidanceManager* Manager, IRVOAvoidanceInterface* AvoidanceComp)
 {
 	Init(Manager,
@@ -62,6 +86,9 @@ UAvoidanceManager::UAvoidanceManager(const FObjectInitializer& ObjectInitializer
 	bRequestedUpdateTimer = false;
 	bAutoPurceOutdatedObjects = true;
 	HeightCheckMargin = 10.0f;
+	NeighborGridFrame = 0;
+	NeighborGridCellSize = 0.0f;
+	bNeighborGridDirty = true;
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	bDebugAll = false;
@@ -245,13 +272,116 @@ void UAvoidanceManager::UpdateRVO_Internal(int32 inAvoidanceUID, const FNavAvoid
 {
 	if (FNavAvoidanceData* existingData = AvoidanceObjects.Find(inAvoidanceUID))
 	{
+		if (existingData->ShouldBeIgnored())
+		{
+			bNeighborGridDirty = true;
+		}
+
 		float OverrideWeightTime = existingData->OverrideWeightTime;		//Hold onto this one value
 		*existingData = inAvoidanceData;
 		existingData->OverrideWeightTime = OverrideWeightTime;
 	}
 	else
 	{
+		// May reallocate the data the grid points at
 		AvoidanceObjects.Add(inAvoidanceUID, inAvoidanceData);
+		bNeighborGridDirty = true;
+	}
+}
+
+static FORCEINLINE FIntPoint GetNeighborGridCell(float X, float Y, float CellSize)
+{
+	return FIntPoint(FMath::FloorToInt(X / CellSize), FMath::FloorToInt(Y / CellSize));
+}
+
+void UAvoidanceManager::UpdateNeighborGrid()
+{
+	const float CellSize = GAvoidanceGridCellSize;
+	if (CellSize <= 0.0f)
+	{
+		NeighborGridEntries.Reset();
+		NeighborGridCells.Reset();
+		NeighborGridCellSize = 0.0f;
+		return;
+	}
+
+	if (!bNeighborGridDirty && NeighborGridFrame == GFrameCounter && NeighborGridCellSize == CellSize)
+	{
+		return;
+	}
+
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Avoidance: build neighbor grid"), STAT_AIAvoidanceBuildGrid, STATGROUP_AI);
+
+	NeighborGridEntries.Reset();
+	for (const auto& AvoidanceObj : AvoidanceObjects)
+	{
+		const FNavAvoidanceData& AvoidanceData = AvoidanceObj.Value;
+		if (!AvoidanceData.ShouldBeIgnored())
+		{
+			NeighborGridEntries.Add({ GetNeighborGridCell(AvoidanceData.Center.X, AvoidanceData.Center.Y, CellSize), AvoidanceObj.Key, &AvoidanceData });
+		}
+	}
+
+	NeighborGridEntries.Sort([](const FNeighborGridEntry& A, const FNeighborGridEntry& B)
+	{
+		return A.Cell.X != B.Cell.X ? A.Cell.X < B.Cell.X : A.Cell.Y < B.Cell.Y;
+	});
+
+	NeighborGridCells.Reset();
+	FNeighborGridCell* CurrentCell = nullptr;
+	for (int32 EntryIndex = 0; EntryIndex < NeighborGridEntries.Num(); ++EntryIndex)
+	{
+		if (EntryIndex == 0 || NeighborGridEntries[EntryIndex].Cell != NeighborGridEntries[EntryIndex - 1].Cell)
+		{
+			CurrentCell = &NeighborGridCells.Add(NeighborGridEntries[EntryIndex].Cell, { EntryIndex, 0 });
+		}
+		++CurrentCell->NumEntries;
+	}
+
+	NeighborGridFrame = GFrameCounter;
+	NeighborGridCellSize = CellSize;
+	bNeighborGridDirty = false;
+}
+
+void UAvoidanceManager::ForEachNeighbor(const FVector& Center, float Radius, TFunctionRef<void(int32 AvoidanceUID, const FNavAvoidanceData& OtherObject)> Visitor) const
+{
+	if (NeighborGridCellSize <= 0.0f)
+	{
+		for (const auto& AvoidanceObj : AvoidanceObjects)
+		{
+			Visitor(AvoidanceObj.Key, AvoidanceObj.Value);
+		}
+		return;
+	}
+
+	const float QueryRadius = Radius + FMath::Max(GAvoidanceGridMargin, 0.0f);
+	const FIntPoint MinCell = GetNeighborGridCell(Center.X - QueryRadius, Center.Y - QueryRadius, NeighborGridCellSize);
+	const FIntPoint MaxCell = GetNeighborGridCell(Center.X + QueryRadius, Center.Y + QueryRadius, NeighborGridCellSize);
+
+	// Walking every entry is cheaper than looking up more cells than there are
+	const int64 NumQueryCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+	if (NumQueryCells > NeighborGridCells.Num())
+	{
+		for (const FNeighborGridEntry& Entry : NeighborGridEntries)
+		{
+			Visitor(Entry.AvoidanceUID, *Entry.Data);
+		}
+		return;
+	}
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			if (const FNeighborGridCell* Cell = NeighborGridCells.Find(FIntPoint(CellX, CellY)))
+			{
+				for (int32 EntryIndex = Cell->FirstEntry; EntryIndex < Cell->FirstEntry + Cell->NumEntries; ++EntryIndex)
+				{
+					const FNeighborGridEntry& Entry = NeighborGridEntries[EntryIndex];
+					Visitor(Entry.AvoidanceUID, *Entry.Data);
+				}
+			}
+		}
 	}
 }
 
@@ -371,42 +501,89 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 		return inAvoidanceData.Velocity;
 	}
 
-	FVector ReturnVelocity = inAvoidanceData.Velocity * DeltaTime;
-	float MaxSpeed = ReturnVelocity.Size2D();
-	float CurrentTime;
-
 	UWorld* MyWorld = Cast<UWorld>(GetOuter());
-	if (MyWorld)
-	{
-		CurrentTime = MyWorld->TimeSeconds;
-	}
-	else
+	if (!MyWorld)
 	{
 		//No world? OK, just quietly back out and don't alter anything.
 		return inAvoidanceData.Velocity;
 	}
 
-	bool Unobstructed = true;
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	bool DebugMode = IsDebugOnForAll() || (inIgnoreThisUID ? IsDebugOnForUID(*inIgnoreThisUID) : false);
+	const bool DebugMode = IsDebugOnForAll() || (inIgnoreThisUID ? IsDebugOnForUID(*inIgnoreThisUID) : false);
+#else
+	const bool DebugMode = false;
 #endif
 
+	UpdateNeighborGrid();
+
+	return CalculateAvoidanceVelocity(inAvoidanceData, DeltaTime, inIgnoreThisUID, MyWorld->TimeSeconds, AllCones, DebugMode);
+}
+
+void UAvoidanceManager::GetAvoidanceVelocities(TArrayView<const FNavAvoidanceData> Agents, TArrayView<const int32> IgnoreUIDs, float DeltaTime, TArrayView<FVector> OutVelocities)
+{
+	check(OutVelocities.Num() == Agents.Num());
+	check(IgnoreUIDs.Num() == 0 || IgnoreUIDs.Num() == Agents.Num());
+
+	SCOPE_CYCLE_COUNTER(STAT_AI_ObstacleAvoidance);
+
+	UWorld* MyWorld = Cast<UWorld>(GetOuter());
+	bool bPassThrough = DeltaTime <= 0.0f || !MyWorld;
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	bPassThrough |= !bSystemActive;
+#endif
+	if (bPassThrough)
+	{
+		for (int32 AgentIndex = 0; AgentIndex < Agents.Num(); ++AgentIndex)
+		{
+			OutVelocities[AgentIndex] = Agents[AgentIndex].Velocity;
+		}
+		return;
+	}
+
+	UpdateNeighborGrid();
+
+	const float CurrentTime = MyWorld->TimeSeconds;
+	const int32 BatchSize = FMath::Max(GAvoidanceBatchSize, 1);
+	const int32 NumBatches = FMath::DivideAndRoundUp(Agents.Num(), BatchSize);
+
+	// Nav edge providers aren't required to be thread safe, solve on the game thread if there is one
+	const bool bForceSingleThread = NumBatches < 2 || EdgeProviderOb.IsValid();
+
+	ParallelFor(NumBatches, [this, &Agents, &IgnoreUIDs, &OutVelocities, DeltaTime, CurrentTime, BatchSize](int32 BatchIndex)
+	{
+		TArray<FVelocityAvoidanceCone> Cones;
+
+		const int32 LastAgentIndex = FMath::Min((BatchIndex + 1) * BatchSize, Agents.Num());
+		for (int32 AgentIndex = BatchIndex * BatchSize; AgentIndex < LastAgentIndex; ++AgentIndex)
+		{
+			const int32* IgnoreThisUID = IgnoreUIDs.Num() ? &IgnoreUIDs[AgentIndex] : nullptr;
+			OutVelocities[AgentIndex] = CalculateAvoidanceVelocity(Agents[AgentIndex], DeltaTime, IgnoreThisUID, CurrentTime, Cones, false);
+		}
+	}, bForceSingleThread);
+}
+
+FVector UAvoidanceManager::CalculateAvoidanceVelocity(const FNavAvoidanceData& inAvoidanceData, float DeltaTime, const int32* inIgnoreThisUID, float CurrentTime, TArray<FVelocityAvoidanceCone>& Cones, bool DebugMode) const
+{
+	FVector ReturnVelocity = inAvoidanceData.Velocity * DeltaTime;
+	float MaxSpeed = ReturnVelocity.Size2D();
+
+	bool Unobstructed = true;
+
 	//If we're moving very slowly, just push forward. Not sure it's worth avoiding at this speed, though I could be wrong.
 	if (MaxSpeed < 0.01f)
 	{
 		return inAvoidanceData.Velocity;
 	}
-	AllCones.Empty(AllCones.Max());
+	Cones.Empty(Cones.Max());
 
 	//DrawDebugDirectionalArrow(GetWorld(), inAvoidanceData.Center, inAvoidanceData.Center + inAvoidanceData.Velocity, 2.5f, FColor(0,255,255), true, 0.05f, SDPG_MAX);
 
-	for (auto& AvoidanceObj : AvoidanceObjects)
+	ForEachNeighbor(inAvoidanceData.Center, inAvoidanceData.TestRadius2D, [&](int32 OtherUID, const FNavAvoidanceData& OtherObject)
 	{
-		if ((inIgnoreThisUID) && (*inIgnoreThisUID == AvoidanceObj.Key))
+		if ((inIgnoreThisUID) && (*inIgnoreThisUID == OtherUID))
 		{
-			continue;
+			return;
 		}
-		FNavAvoidanceData& OtherObject = AvoidanceObj.Value;
 
 		//
 		//Start with a few fast-rejects
@@ -415,31 +592,31 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 		//If the object has expired, ignore it
 		if (OtherObject.ShouldBeIgnored())
 		{
-			continue;
+			return;
 		}
 
 		//If other object is not in avoided group, ignore it
 		if (inAvoidanceData.ShouldIgnoreGroup(OtherObject.GroupMask))
 		{
-			continue;
+			return;
 		}
 
 		//RickH - We should have a max-radius parameter/option here, so I'm just going to hardcode one for now.
 		//if ((OtherObject.Radius + _AvoidanceData.Radius + MaxSpeed + OtherObject.Velocity.Size2D()) < FVector::Dist(OtherObject.Center, _AvoidanceData.Center))
 		if (FVector2D(OtherObject.Center - inAvoidanceData.Center).SizeSquared() > FMath::Square(inAvoidanceData.TestRadius2D))
 		{
-			continue;
+			return;
 		}
 
 		if (FMath::Abs(OtherObject.Center.Z - inAvoidanceData.Center.Z) > OtherObject.HalfHeight + inAvoidanceData.HalfHeight + HeightCheckMargin)
 		{
-			continue;
+			return;
 		}
 
 		//If we are moving away from the obstacle, ignore it. Even if we're the slower one, let the other obstacle path around us.
 		if ((ReturnVelocity | (OtherObject.Center - inAvoidanceData.Center)) <= 0.0f)
 		{
-			continue;
+			return;
 		}
 
 		//Create data for the avoidance routine
@@ -456,7 +633,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 			if (TowardB.IsZero())
 			{
 				//Already intersecting, or aligned vertically, scrap this whole object.
-				continue;
+				return;
 			}
 			SidewaysFromB.Set(-TowardB.Y, TowardB.X, 0.0f);
 
@@ -510,10 +687,10 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 					Unobstructed = false;
 				}
 
-				AllCones.Add(NewCone);
+				Cones.Add(NewCone);
 			}
 		}
-	}
+	});
 	if (Unobstructed)
 	{
 		//Trivial case, our ideal velocity is available.
@@ -528,7 +705,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 	}
 
 	//Find a good velocity that isn't inside a cone.
-	if (AllCones.Num())
+	if (Cones.Num())
 	{
 		float AngleCurrent;
 		float AngleF = ReturnVelocity.HeadingAngle();
@@ -561,7 +738,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 				const bool bAvoidsNavEdges = NavEdges.Num() > 0 ? AvoidsNavEdges(inAvoidanceData.Center, VelSpacePoint, NavEdges, inAvoidanceData.HalfHeight) : true;
 				if (bAvoidsNavEdges)
 				{
-					FVector CandidateVelocity = AvoidCones(AllCones, FVector::ZeroVector, VelSpacePoint, AllCones.Num());
+					FVector CandidateVelocity = AvoidCones(Cones, FVector::ZeroVector, VelSpacePoint, Cones.Num());
 					float CandidateScore = (CandidateVelocity|ReturnVelocity) * (CandidateVelocity|CandidateVelocity);
 
 					//Vectors are rated by their length and their overall forward movement.
@@ -577,7 +754,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 		if (DebugMode)
 		{
-			DrawDebugDirectionalArrow(MyWorld, inAvoidanceData.Center + inAvoidanceData.Velocity, inAvoidanceData.Center + (ReturnVelocity / DeltaTime), 75.0f, FColor(64,255,64), true, 2.0f, SDPG_MAX);
+			DrawDebugDirectionalArrow(Cast<UWorld>(GetOuter()), inAvoidanceData.Center + inAvoidanceData.Velocity, inAvoidanceData.Center + (ReturnVelocity / DeltaTime), 75.0f, FColor(64,255,64), true, 2.0f, SDPG_MAX);
 		}
 #endif
 	}
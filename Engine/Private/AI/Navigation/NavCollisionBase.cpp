@@ -1,7 +1,15 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AI/Navigation/NavCollisionBase.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
 
+static int32 GNavCollisionParallelSetup = 1;
+static FAutoConsoleVariableRef CVarNavCollisionParallelSetup(
+	TEXT("ai.Navigation.ParallelNavCollisionSetup"),
+	GNavCollisionParallelSetup,
+	TEXT("Whether UNavCollisionBase::SetupBatch cooks nav collisions that support it on worker threads."),
+	ECVF_Default);
 
 UNavCollisionBase::FConstructNew UNavCollisionBase::ConstructNewInstanceDelegate;
 UNavCollisionBase::FDelegateInitializer UNavCollisionBase::DelegateInitializer;
@@ -17,3 +25,35 @@ UNavCollisionBase::UNavCollisionBase(const FObjectInitializer& ObjectInitializer
 	bIsDynamicObstacle = false;
 	bHasConvexGeometry = false;
 }
+
+void UNavCollisionBase::SetupBatch(TArrayView<UNavCollisionBase* const> NavCollisions, TArrayView<UBodySetup* const> BodySetups)
+{
+	check(IsInGameThread());
+	check(NavCollisions.Num() == BodySetups.Num());
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_NavCollision_SetupBatch);
+
+	TArray<int32> ParallelIndices;
+	for (int32 Index = 0; Index < NavCollisions.Num(); ++Index)
+	{
+		UNavCollisionBase* NavCollision = NavCollisions[Index];
+		if (NavCollision == nullptr)
+		{
+			continue;
+		}
+
+		if (GNavCollisionParallelSetup && NavCollision->SupportsParallelSetup())
+		{
+			ParallelIndices.Add(Index);
+		}
+		else
+		{
+			NavCollision->Setup(BodySetups[Index]);
+		}
+	}
+
+	ParallelFor(ParallelIndices.Num(), [&NavCollisions, &BodySetups, &ParallelIndices](int32 Index)
+	{
+		const int32 CollisionIndex = ParallelIndices[Index];
+		NavCollisions[CollisionIndex]->Setup(BodySetups[CollisionIndex]);
+	});
+}
@@ -10,3 +10,52 @@ UNavigationDataChunk::UNavigationDataChunk(const FObjectInitializer& ObjectIniti
 {
 }
 
+void UNavigationDataChunk::BeginAsyncPrepareAttach()
+{
+	check(IsInGameThread());
+
+	if (!SupportsAsyncPrepareAttach() || bPreparedForAttach || PrepareAttachTask.IsValid())
+	{
+		return;
+	}
+
+	// The chunk is referenced by its level for as long as the task runs, and BeginDestroy waits for it
+	PrepareAttachTask = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+	{
+		PrepareAttach();
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+bool UNavigationDataChunk::IsPrepareAttachComplete() const
+{
+	return !PrepareAttachTask.IsValid() || PrepareAttachTask->IsComplete();
+}
+
+void UNavigationDataChunk::EnsurePreparedForAttach()
+{
+	check(IsInGameThread());
+
+	if (PrepareAttachTask.IsValid())
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(PrepareAttachTask, ENamedThreads::GameThread);
+		PrepareAttachTask = nullptr;
+		bPreparedForAttach = true;
+	}
+	else if (!bPreparedForAttach && SupportsAsyncPrepareAttach())
+	{
+		PrepareAttach();
+		bPreparedForAttach = true;
+	}
+}
+
+void UNavigationDataChunk::BeginDestroy()
+{
+	if (PrepareAttachTask.IsValid())
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(PrepareAttachTask);
+		PrepareAttachTask = nullptr;
+	}
+
+	Super::BeginDestroy();
+}
+
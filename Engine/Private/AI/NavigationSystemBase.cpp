@@ -10,6 +10,8 @@
 #include "AI/Navigation/PathFollowingAgentInterface.h"
 #include "AI/NavigationSystemConfig.h"
 #include "AI/Navigation/NavigationDataChunk.h"
+#include "AI/Navigation/NavRelevantInterface.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY(LogNavigation);
 DEFINE_LOG_CATEGORY(LogNavigationDataBuild);
@@ -20,6 +22,13 @@ DEFINE_LOG_CATEGORY(LogNavLink);
 #include "Misc/ConfigCacheIni.h"
 #endif // !UE_BUILD_SHIPPING
 
+static int32 GNavigationParallelGather = 1;
+static FAutoConsoleVariableRef CVarNavigationParallelGather(
+	TEXT("ai.Navigation.ParallelGather"),
+	GNavigationParallelGather,
+	TEXT("Whether FNavigationSystem::GatherNavigationDataBatch exports geometry on worker threads."),
+	ECVF_Default);
+
 namespace FNavigationSystem
 {
 	void DiscardNavigationDataChunks(UWorld& InWorld)
@@ -38,6 +47,70 @@ namespace FNavigationSystem
 		}
 	}
 
+	void BeginPrepareNavigationDataChunks(ULevel& Level)
+	{
+		for (UNavigationDataChunk* NavChunk : Level.NavDataChunks)
+		{
+			if (NavChunk != nullptr)
+			{
+				NavChunk->BeginAsyncPrepareAttach();
+			}
+		}
+	}
+
+	bool AreNavigationDataChunksPrepared(ULevel& Level, const bool bWait)
+	{
+		for (UNavigationDataChunk* NavChunk : Level.NavDataChunks)
+		{
+			if (NavChunk != nullptr && !NavChunk->IsPrepareAttachComplete())
+			{
+				if (!bWait)
+				{
+					return false;
+				}
+				NavChunk->EnsurePreparedForAttach();
+			}
+		}
+		return true;
+	}
+
+	void GatherNavigationDataBatch(TArrayView<UObject* const> Objects, TArray<TSharedPtr<FNavigationRelevantData, ESPMode::ThreadSafe>>& OutData, FExportNavigationGeometry ExportGeometry)
+	{
+		check(IsInGameThread());
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_Navigation_GatherNavigationDataBatch);
+
+		OutData.Reset(Objects.Num());
+		TArray<int32> RelevantIndices;
+		RelevantIndices.Reserve(Objects.Num());
+
+		for (UObject* Object : Objects)
+		{
+			INavRelevantInterface* NavRelevant = Cast<INavRelevantInterface>(Object);
+			if (NavRelevant == nullptr || !NavRelevant->IsNavigationRelevant())
+			{
+				OutData.Add(nullptr);
+				continue;
+			}
+
+			TSharedPtr<FNavigationRelevantData, ESPMode::ThreadSafe> Data = MakeShareable(new FNavigationRelevantData(*Object));
+			Data->Bounds = NavRelevant->GetNavigationBounds();
+			Data->bSupportsGatheringGeometrySlices = NavRelevant->SupportsGatheringGeometrySlices();
+			NavRelevant->GetNavigationData(*Data);
+			NavRelevant->PrepareGeometryExportSync();
+
+			RelevantIndices.Add(OutData.Num());
+			OutData.Add(MoveTemp(Data));
+		}
+
+		ParallelFor(RelevantIndices.Num(), [&Objects, &OutData, &RelevantIndices, &ExportGeometry](int32 Index)
+		{
+			const int32 ObjectIndex = RelevantIndices[Index];
+			FNavigationRelevantData& Data = *OutData[ObjectIndex];
+			ExportGeometry(*Objects[ObjectIndex], Data);
+			Data.ValidateAndShrink();
+		}, GNavigationParallelGather == 0);
+	}
+
 	void AddNavigationSystemToWorld(UWorld& WorldOwner, const FNavigationSystemRunMode RunMode, UNavigationSystemConfig* NavigationSystemConfig, const bool bInitializeForWorld, const bool bOverridePreviousNavSys)
 	{
 		if (WorldOwner.GetNavigationSystem() == nullptr || bOverridePreviousNavSys)
@@ -4,6 +4,7 @@
 #include "DrawDebugHelpers.h"
 #include "EngineDefines.h"
 #include "Misc/App.h"
+#include "Misc/ScopeLock.h"
 #include "AudioThread.h"
 #include "AudioDevice.h"
 #include "IAudioExtensionPlugin.h"
@@ -23,8 +24,36 @@ FAutoConsoleVariableRef CVarAudioOcclusionEnabled(
 	TEXT("Disables (1) or enables (0) audio occlusion.\n"),
 	ECVF_Default);
 
+static float OcclusionTraceReuseDistanceCVar = 0.0f;
+FAutoConsoleVariableRef CVarOcclusionTraceReuseDistance(
+	TEXT("au.OcclusionTraceReuseDistance"),
+	OcclusionTraceReuseDistanceCVar,
+	TEXT("When greater than 0, an occlusion check reuses the result of the previous trace if neither the sound nor its listener moved farther than this distance since.\n")
+	TEXT("0: Trace at every occlusion check."),
+	ECVF_Default);
+
+static float OcclusionTraceMaxReuseTimeCVar = 1.0f;
+FAutoConsoleVariableRef CVarOcclusionTraceMaxReuseTime(
+	TEXT("au.OcclusionTraceMaxReuseTime"),
+	OcclusionTraceMaxReuseTimeCVar,
+	TEXT("Maximum time in seconds an occlusion trace result is reused for, see au.OcclusionTraceReuseDistance, so that moving occluders are eventually noticed."),
+	ECVF_Default);
+
+static float OcclusionTraceGroupDistanceCVar = 0.0f;
+FAutoConsoleVariableRef CVarOcclusionTraceGroupDistance(
+	TEXT("au.OcclusionTraceGroupDistance"),
+	OcclusionTraceGroupDistanceCVar,
+	TEXT("When greater than 0, occlusion traces requested during the same update from sounds within this distance of each other to the same listener share a single trace.\n")
+	TEXT("0: Only sounds at the exact same location share a trace."),
+	ECVF_Default);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Occlusion Traces"), STAT_AudioOcclusionTraces, STATGROUP_Audio);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Occlusion Traces Reused"), STAT_AudioOcclusionTracesReused, STATGROUP_Audio);
+
 FTraceDelegate FActiveSound::ActiveSoundTraceDelegate;
-TMap<FTraceHandle, FActiveSound::FAsyncTraceDetails> FActiveSound::TraceToActiveSoundMap;
+TMap<FTraceHandle, TArray<FActiveSound::FAsyncTraceDetails>> FActiveSound::TraceToActiveSoundMap;
+TArray<FActiveSound::FOcclusionTraceRequest> FActiveSound::PendingOcclusionTraces;
+FCriticalSection FActiveSound::PendingOcclusionTracesCritSec;
 
 FActiveSound::FActiveSound()
 	: World(nullptr)
@@ -85,6 +114,9 @@ FActiveSound::FActiveSound()
 	, VolumeConcurrency(0.0f)
 	, OcclusionCheckInterval(0.0f)
 	, LastOcclusionCheckTime(TNumericLimits<float>::Lowest())
+	, LastOcclusionTraceTime(TNumericLimits<float>::Lowest())
+	, LastOcclusionSoundLocation(FVector::ZeroVector)
+	, LastOcclusionListenerLocation(FVector::ZeroVector)
 	, MaxDistance(WORLD_MAX)
 	, LastLocation(FVector::ZeroVector)
 	, AudioVolumeID(0)
@@ -950,24 +982,101 @@ void FActiveSound::OcclusionTraceDone(const FTraceHandle& TraceHandle, FTraceDat
 		}
 	}
 
-	FAsyncTraceDetails TraceDetails;
-	if (TraceToActiveSoundMap.RemoveAndCopyValue(TraceHandle, TraceDetails))
+	TArray<FAsyncTraceDetails> TraceDetailsArray;
+	if (TraceToActiveSoundMap.RemoveAndCopyValue(TraceHandle, TraceDetailsArray))
 	{
 		if (FAudioDeviceManager* AudioDeviceManager = GEngine->GetAudioDeviceManager())
 		{
-			if (FAudioDevice* AudioDevice = AudioDeviceManager->GetAudioDeviceRaw(TraceDetails.AudioDeviceID))
+			DECLARE_CYCLE_STAT(TEXT("FAudioThreadTask.OcclusionTraceDone"), STAT_OcclusionTraceDone, STATGROUP_AudioThreadCommands);
+
+			FAudioThread::RunCommandOnAudioThread([AudioDeviceManager, TraceDetailsArray, bFoundBlockingHit]()
 			{
-				FActiveSound* ActiveSound = TraceDetails.ActiveSound;
+				for (const FAsyncTraceDetails& TraceDetails : TraceDetailsArray)
+				{
+					if (FAudioDevice* AudioDevice = AudioDeviceManager->GetAudioDeviceRaw(TraceDetails.AudioDeviceID))
+					{
+						AudioDevice->NotifyActiveSoundOcclusionTraceDone(TraceDetails.ActiveSound, bFoundBlockingHit);
+					}
+				}
+			}, GET_STATID(STAT_OcclusionTraceDone));
+		}
+	}
+}
 
-				DECLARE_CYCLE_STAT(TEXT("FAudioThreadTask.OcclusionTraceDone"), STAT_OcclusionTraceDone, STATGROUP_AudioThreadCommands);
+void FActiveSound::FlushOcclusionTraces()
+{
+	TArray<FOcclusionTraceRequest> Requests;
+	{
+		FScopeLock Lock(&PendingOcclusionTracesCritSec);
+		if (PendingOcclusionTraces.Num() == 0)
+		{
+			return;
+		}
+		Swap(Requests, PendingOcclusionTraces);
+	}
 
-				FAudioThread::RunCommandOnAudioThread([AudioDevice, ActiveSound, bFoundBlockingHit]()
-				{
-					AudioDevice->NotifyActiveSoundOcclusionTraceDone(ActiveSound, bFoundBlockingHit);
-				}, GET_STATID(STAT_OcclusionTraceDone));
+	// Group requests that would trace the same ray closely enough, the first request of a group is traced for all of them.
+	// Only requests with the same query parameters and listener can share a trace.
+	const float GroupDistanceSquared = FMath::Square(FMath::Max(OcclusionTraceGroupDistanceCVar, 0.0f));
+
+	TArray<int32> GroupLeaders;
+	TArray<TArray<FAsyncTraceDetails>> Groups;
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+	{
+		const FOcclusionTraceRequest& Request = Requests[RequestIndex];
+
+		int32 GroupIndex = INDEX_NONE;
+		for (int32 LeaderIndex = 0; LeaderIndex < GroupLeaders.Num(); ++LeaderIndex)
+		{
+			const FOcclusionTraceRequest& Leader = Requests[GroupLeaders[LeaderIndex]];
+			if (Leader.World == Request.World
+				&& Leader.TraceChannel == Request.TraceChannel
+				&& Leader.OwnerID == Request.OwnerID
+				&& Leader.bUseComplexCollision == Request.bUseComplexCollision
+				&& Leader.ListenerLocation.Equals(Request.ListenerLocation)
+				&& FVector::DistSquared(Leader.SoundLocation, Request.SoundLocation) <= GroupDistanceSquared)
+			{
+				GroupIndex = LeaderIndex;
+				break;
 			}
 		}
+
+		if (GroupIndex == INDEX_NONE)
+		{
+			GroupLeaders.Add(RequestIndex);
+			GroupIndex = Groups.AddDefaulted();
+		}
+		Groups[GroupIndex].Add(Request.TraceDetails);
+	}
+
+	INC_DWORD_STAT_BY(STAT_AudioOcclusionTraces, GroupLeaders.Num());
+
+	TArray<FOcclusionTraceRequest> Traces;
+	Traces.Reserve(GroupLeaders.Num());
+	for (const int32 LeaderIndex : GroupLeaders)
+	{
+		Traces.Add(Requests[LeaderIndex]);
 	}
+
+	FAudioThread::RunCommandOnGameThread([Traces, Groups]
+	{
+		// Async traces issued during the same frame are run together by the world's async trace batch
+		for (int32 TraceIndex = 0; TraceIndex < Traces.Num(); ++TraceIndex)
+		{
+			const FOcclusionTraceRequest& Trace = Traces[TraceIndex];
+			if (UWorld* WorldPtr = Trace.World.Get())
+			{
+				FCollisionQueryParams Params(SCENE_QUERY_STAT(SoundOcclusion), Trace.bUseComplexCollision);
+				if (Trace.OwnerID > 0)
+				{
+					Params.AddIgnoredActor(Trace.OwnerID);
+				}
+
+				FTraceHandle TraceHandle = WorldPtr->AsyncLineTraceByChannel(EAsyncTraceType::Test, Trace.SoundLocation, Trace.ListenerLocation, Trace.TraceChannel, Params, FCollisionResponseParams::DefaultResponseParam, &ActiveSoundTraceDelegate);
+				TraceToActiveSoundMap.Add(TraceHandle, Groups[TraceIndex]);
+			}
+		}
+	});
 }
 
 void FActiveSound::CheckOcclusion(const FVector ListenerLocation, const FVector SoundLocation, const FSoundAttenuationSettings* AttenuationSettingsPtr)
@@ -991,6 +1100,7 @@ void FActiveSound::CheckOcclusion(const FVector ListenerLocation, const FVector
 			const bool bUseComplexCollisionForOcclusion = AttenuationSettingsPtr->bUseComplexCollisionForOcclusion;
 			const ECollisionChannel OcclusionTraceChannel = AttenuationSettingsPtr->OcclusionTraceChannel;
 
+			bool bTraced = true;
 			if (!bHasCheckedOcclusion)
 			{
 				FCollisionQueryParams Params(SCENE_QUERY_STAT(SoundOcclusion), bUseComplexCollisionForOcclusion);
@@ -1006,30 +1116,38 @@ void FActiveSound::CheckOcclusion(const FVector ListenerLocation, const FVector
 					bIsOccluded = WorldPtr->LineTraceTestByChannel(SoundLocation, ListenerLocation, OcclusionTraceChannel, Params);
 				}
 			}
+			else if (OcclusionTraceReuseDistanceCVar > 0.0f
+				&& (PlaybackTime - LastOcclusionTraceTime) < OcclusionTraceMaxReuseTimeCVar
+				&& FVector::DistSquared(SoundLocation, LastOcclusionSoundLocation) <= FMath::Square(OcclusionTraceReuseDistanceCVar)
+				&& FVector::DistSquared(ListenerLocation, LastOcclusionListenerLocation) <= FMath::Square(OcclusionTraceReuseDistanceCVar))
+			{
+				// Neither end of the ray moved enough to expect a different result, keep the last one
+				INC_DWORD_STAT(STAT_AudioOcclusionTracesReused);
+				bTraced = false;
+			}
 			else
 			{
 				bAsyncOcclusionPending = true;
 
-				const uint32 SoundOwnerID = OwnerID;
-				TWeakObjectPtr<UWorld> SoundWorld = World;
-				FAsyncTraceDetails TraceDetails;
-				TraceDetails.AudioDeviceID = AudioDevice->DeviceID;
-				TraceDetails.ActiveSound = this;
-
-				FAudioThread::RunCommandOnGameThread([SoundWorld, SoundLocation, ListenerLocation, OcclusionTraceChannel, SoundOwnerID, bUseComplexCollisionForOcclusion, TraceDetails]
-				{
-					if (UWorld* WorldPtr = SoundWorld.Get())
-					{
-						FCollisionQueryParams Params(SCENE_QUERY_STAT(SoundOcclusion), bUseComplexCollisionForOcclusion);
-						if (SoundOwnerID > 0)
-						{
-							Params.AddIgnoredActor(SoundOwnerID);
-						}
+				FOcclusionTraceRequest Request;
+				Request.World = World;
+				Request.SoundLocation = SoundLocation;
+				Request.ListenerLocation = ListenerLocation;
+				Request.TraceChannel = OcclusionTraceChannel;
+				Request.OwnerID = OwnerID;
+				Request.bUseComplexCollision = bUseComplexCollisionForOcclusion;
+				Request.TraceDetails.AudioDeviceID = AudioDevice->DeviceID;
+				Request.TraceDetails.ActiveSound = this;
+
+				FScopeLock Lock(&PendingOcclusionTracesCritSec);
+				PendingOcclusionTraces.Add(Request);
+			}
 
-						FTraceHandle TraceHandle = WorldPtr->AsyncLineTraceByChannel(EAsyncTraceType::Test, SoundLocation, ListenerLocation, OcclusionTraceChannel, Params, FCollisionResponseParams::DefaultResponseParam, &ActiveSoundTraceDelegate);
-						TraceToActiveSoundMap.Add(TraceHandle, TraceDetails);
-					}
-				});
+			if (bTraced)
+			{
+				LastOcclusionTraceTime = PlaybackTime;
+				LastOcclusionSoundLocation = SoundLocation;
+				LastOcclusionListenerLocation = ListenerLocation;
 			}
 		}
 
@@ -1077,7 +1195,7 @@ void FActiveSound::HandleInteriorVolumes(FSoundParseParameters& ParseParams)
 		bGotInteriorSettings = true;
 	}
 
-	check(IsInAudioThread());
+	check(FAudioDevice::IsInAudioThreadOrWaveInstanceGather());
 	const TArray<FListener>& Listeners = AudioDevice->GetListeners();
 	check(ClosestListenerIndex < Listeners.Num());
 	const FListener& Listener = Listeners[ClosestListenerIndex];
@@ -104,6 +104,7 @@ void AActor::InitializeDefaults()
 	SetRole(ROLE_Authority);
 	RemoteRole = ROLE_None;
 	bReplicates = false;
+	bReplicateUsingRegisteredSubObjectList = false;
 	NetPriority = 1.0f;
 	NetUpdateFrequency = 100.0f;
 	MinNetUpdateFrequency = 2.0f;
@@ -192,6 +193,11 @@ FName FActorTickFunction::DiagnosticContext(bool bDetailed)
 	}
 }
 
+const UObject* FActorTickFunction::GetTickAccessScope() const
+{
+	return Target;
+}
+
 bool AActor::CheckDefaultSubobjectsInternal() const
 {
 	bool Result = Super::CheckDefaultSubobjectsInternal();
@@ -308,6 +314,8 @@ void AActor::ResetOwnedComponents()
 			}
 		}
 	}, true, RF_NoFlags, EInternalObjectFlags::PendingKill);
+
+	UpdateAllReplicatedSubObjectComponents();
 }
 
 void AActor::PostInitProperties()
@@ -2085,6 +2093,87 @@ void AActor::FlushNetDormancy()
 	}
 }
 
+void AActor::FlushNetDormancyForActors(TArrayView<AActor* const> Actors)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(NET_AActor_FlushNetDormancyForActors);
+
+	// Actors are grouped by net driver, so each driver only walks its connections once
+	struct FDriverActors
+	{
+		UNetDriver* NetDriver;
+		UNetDriver* DemoNetDriver;
+		TArray<AActor*> Actors;
+
+		// Split of Actors for the demo net driver, which needs to know which actors were initially dormant
+		TArray<AActor*> DormInitialActors;
+		TArray<AActor*> OtherActors;
+	};
+
+	TArray<FDriverActors, TInlineAllocator<2>> DriverActors;
+
+	for (AActor* Actor : Actors)
+	{
+		if (Actor == nullptr || Actor->IsNetMode(NM_Client) || Actor->NetDormancy <= DORM_Awake || Actor->IsPendingKillPending())
+		{
+			continue;
+		}
+
+		bool bWasDormInitial = false;
+		if (Actor->NetDormancy == DORM_Initial)
+		{
+			// No longer initially dormant
+			Actor->NetDormancy = DORM_DormantAll;
+			bWasDormInitial = true;
+		}
+
+		// Don't proceed with network operations if not actually set to replicate
+		if (!Actor->bReplicates)
+		{
+			continue;
+		}
+
+		UWorld* const MyWorld = Actor->GetWorld();
+		if (MyWorld == nullptr)
+		{
+			continue;
+		}
+
+		// Add to network actors list if needed
+		MyWorld->AddNetworkActor(Actor);
+
+		UNetDriver* const NetDriver = Actor->GetNetDriver();
+		if (NetDriver == nullptr)
+		{
+			continue;
+		}
+
+		FDriverActors* Group = DriverActors.FindByPredicate([NetDriver](const FDriverActors& Entry) { return Entry.NetDriver == NetDriver; });
+		if (Group == nullptr)
+		{
+			Group = &DriverActors.AddDefaulted_GetRef();
+			Group->NetDriver = NetDriver;
+			Group->DemoNetDriver = (MyWorld->DemoNetDriver && MyWorld->DemoNetDriver != NetDriver) ? MyWorld->DemoNetDriver : nullptr;
+		}
+
+		Group->Actors.Add(Actor);
+		if (Group->DemoNetDriver)
+		{
+			(bWasDormInitial ? Group->DormInitialActors : Group->OtherActors).Add(Actor);
+		}
+	}
+
+	for (FDriverActors& Group : DriverActors)
+	{
+		Group.NetDriver->FlushDormancyForActors(Group.Actors);
+
+		if (Group.DemoNetDriver)
+		{
+			Group.DemoNetDriver->FlushDormancyForActors(Group.DormInitialActors, true);
+			Group.DemoNetDriver->FlushDormancyForActors(Group.OtherActors);
+		}
+	}
+}
+
 void AActor::ForcePropertyCompare()
 {
 	if ( IsNetMode( NM_Client ) )
@@ -2694,6 +2783,7 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 		if (Component->GetIsReplicated())
 		{
 			ReplicatedComponents.AddUnique(Component);
+			UpdateReplicatedSubObjectComponent(Component);
 		}
 
 		if (Component->IsCreatedByConstructionScript())
@@ -2717,6 +2807,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 	if (OwnedComponents.Remove(Component) > 0)
 	{
 		ReplicatedComponents.Remove(Component);
+		UpdateReplicatedSubObjectComponent(Component);
 		if (Component->IsCreatedByConstructionScript())
 		{
 			BlueprintCreatedComponents.RemoveSingleSwap(Component);
@@ -2746,6 +2837,8 @@ void AActor::UpdateReplicatedComponent(UActorComponent* Component)
 	{
 		ReplicatedComponents.Remove(Component);
 	}
+
+	UpdateReplicatedSubObjectComponent(Component);
 }
 
 void AActor::UpdateAllReplicatedComponents()
@@ -2760,6 +2853,8 @@ void AActor::UpdateAllReplicatedComponents()
 			ReplicatedComponents.Add(Component);
 		}
 	}
+
+	UpdateAllReplicatedSubObjectComponents();
 }
 
 const TArray<UActorComponent*>& AActor::GetInstanceComponents() const
@@ -3404,7 +3499,9 @@ void AActor::DispatchBeginPlay(bool bFromLevelStreaming)
 			World->DestroyActor(this, true); 
 		}
 		
-		if (!IsPendingKill())
+		// Streaming levels may defer this to a time-sliced pass once all of their actors have begun play
+		const ULevel* const Level = (bFromLevelStreaming ? GetLevel() : nullptr);
+		if (!IsPendingKill() && !(Level && Level->bDeferInitialOverlaps))
 		{
 			// Initialize overlap state
 			UpdateInitialOverlaps(bFromLevelStreaming);
@@ -40,6 +40,26 @@ DEFINE_LOG_CATEGORY(LogBlueprintUserMessages);
 
 DECLARE_CYCLE_STAT(TEXT("InstanceActorComponent"), STAT_InstanceActorComponent, STATGROUP_Engine);
 
+static int32 GSkipEmptyUserConstructionScript = 1;
+static FAutoConsoleVariableRef CVarSkipEmptyUserConstructionScript(
+	TEXT("bp.SkipEmptyUserConstructionScript"),
+	GSkipEmptyUserConstructionScript,
+	TEXT("If non-zero, actors whose UserConstructionScript has no script code, e.g. blueprints with an empty construction script, don't call into the script VM for it."),
+	ECVF_Default);
+
+/** Whether a function's bytecode does nothing but return, allowing for the tracepoints of debuggable script */
+static bool IsEmptyScriptFunction(const UFunction* Function)
+{
+	for (const uint8 Token : Function->Script)
+	{
+		if (Token != EX_Return && Token != EX_Nothing && Token != EX_EndOfScript && Token != EX_Tracepoint && Token != EX_WireTracepoint)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // AActor Blueprint Stuff
 
@@ -874,10 +894,15 @@ bool AActor::ExecuteConstruction(const FTransform& Transform, const FRotationCon
 
 void AActor::ProcessUserConstructionScript()
 {
-	// Set a flag that this actor is currently running UserConstructionScript.
-	bRunningUserConstructionScript = true;
-	UserConstructionScript();
-	bRunningUserConstructionScript = false;
+	static const FName UserConstructionScriptName = GET_FUNCTION_NAME_CHECKED(AActor, UserConstructionScript);
+	const UFunction* UserConstructionScriptFunction = GSkipEmptyUserConstructionScript ? GetClass()->FindFunctionByName(UserConstructionScriptName) : nullptr;
+	if (UserConstructionScriptFunction == nullptr || !IsEmptyScriptFunction(UserConstructionScriptFunction))
+	{
+		// Set a flag that this actor is currently running UserConstructionScript.
+		bRunningUserConstructionScript = true;
+		UserConstructionScript();
+		bRunningUserConstructionScript = false;
+	}
 
 	// Validate component mobility after UCS execution
 	for (UActorComponent* Component : GetComponents())
@@ -1239,6 +1264,7 @@ void AActor::PostCreateBlueprintComponent(UActorComponent* NewActorComp)
 		if (NewActorComp->GetIsReplicated())
 		{
 			ReplicatedComponents.AddUnique(NewActorComp);
+			UpdateReplicatedSubObjectComponent(NewActorComp);
 		}
 	}
 }
@@ -19,6 +19,7 @@
 #include "PhysicsPublic.h"
 #include "DrawDebugHelpers.h"
 #include "Net/Core/PushModel/PushModel.h"
+#include "Engine/ReplicatedMovementSubsystem.h"
 
 /*-----------------------------------------------------------------------------
 	AActor networking implementation.
@@ -238,6 +239,17 @@ void AActor::PostNetReceiveLocationAndRotation()
 	const FRepMovement& LocalRepMovement = GetReplicatedMovement();
 	FVector NewLocation = FRepMovement::RebaseOntoLocalOrigin(LocalRepMovement.Location, this);
 
+	UWorld* World = GetWorld();
+	if (UReplicatedMovementSubsystem::IsBatchingEnabled(World) && GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		if (UReplicatedMovementSubsystem* ReplicatedMovementSubsystem = World->GetSubsystem<UReplicatedMovementSubsystem>())
+		{
+			// Applied with the other simulated proxies at the end of the frame, replacing any update queued earlier this frame
+			ReplicatedMovementSubsystem->QueueMovement(this, NewLocation, LocalRepMovement.Rotation);
+			return;
+		}
+	}
+
 	if( RootComponent && RootComponent->IsRegistered() && (NewLocation != GetActorLocation() || LocalRepMovement.Rotation != GetActorRotation()) )
 	{
 		SetActorLocationAndRotation(NewLocation, LocalRepMovement.Rotation, /*bSweep=*/ false);
@@ -454,6 +466,118 @@ bool AActor::ReplicateSubobjects(UActorChannel *Channel, FOutBunch *Bunch, FRepl
 	return WroteSomething;
 }
 
+void AActor::SetReplicateUsingRegisteredSubObjectList(bool bNewReplicateUsingRegisteredSubObjectList)
+{
+	if (bReplicateUsingRegisteredSubObjectList != bNewReplicateUsingRegisteredSubObjectList)
+	{
+		bReplicateUsingRegisteredSubObjectList = bNewReplicateUsingRegisteredSubObjectList;
+
+		if (bReplicateUsingRegisteredSubObjectList)
+		{
+			UpdateAllReplicatedSubObjectComponents();
+		}
+		else
+		{
+			ReplicatedSubObjects.RemoveAll([this](const FReplicatedSubObjectInfo& Info)
+			{
+				const UActorComponent* Component = Cast<UActorComponent>(Info.SubObject.Get());
+				return Component == nullptr || Component->GetOwner() == this;
+			});
+		}
+	}
+}
+
+void AActor::AddReplicatedSubObject(UObject* SubObject, ELifetimeCondition NetCondition, bool bDirtyTracked)
+{
+	if (SubObject == nullptr)
+	{
+		return;
+	}
+
+	ensureMsgf(SubObject->IsIn(this), TEXT("AddReplicatedSubObject: %s is not a subobject of %s"), *GetPathNameSafe(SubObject), *GetPathName());
+
+	FReplicatedSubObjectInfo* Existing = ReplicatedSubObjects.FindByPredicate([SubObject](const FReplicatedSubObjectInfo& Info) { return Info.SubObject == SubObject; });
+	if (Existing)
+	{
+		Existing->NetCondition = NetCondition;
+		Existing->bDirtyTracked = bDirtyTracked;
+		++Existing->DirtyKey;
+	}
+	else
+	{
+		ReplicatedSubObjects.Emplace(SubObject, NetCondition, bDirtyTracked);
+	}
+}
+
+void AActor::RemoveReplicatedSubObject(UObject* SubObject)
+{
+	const int32 Index = ReplicatedSubObjects.IndexOfByPredicate([SubObject](const FReplicatedSubObjectInfo& Info) { return Info.SubObject == SubObject; });
+	if (Index != INDEX_NONE)
+	{
+		// Order is preserved so that subobjects keep replicating in registration order
+		ReplicatedSubObjects.RemoveAt(Index);
+	}
+}
+
+void AActor::MarkReplicatedSubObjectDirty(UObject* SubObject)
+{
+	FReplicatedSubObjectInfo* Info = ReplicatedSubObjects.FindByPredicate([SubObject](const FReplicatedSubObjectInfo& Entry) { return Entry.SubObject == SubObject; });
+	if (Info)
+	{
+		// Never wrap to 0, channels use it for "not sent yet"
+		Info->DirtyKey = (Info->DirtyKey == MAX_uint32) ? 1 : Info->DirtyKey + 1;
+	}
+}
+
+void AActor::UpdateReplicatedSubObjectComponent(UActorComponent* Component)
+{
+	if (!bReplicateUsingRegisteredSubObjectList || Component == nullptr)
+	{
+		return;
+	}
+
+	const bool bShouldBeRegistered = ReplicatedComponents.Contains(Component);
+	const int32 Index = ReplicatedSubObjects.IndexOfByPredicate([Component](const FReplicatedSubObjectInfo& Info) { return Info.SubObject == Component; });
+
+	if (bShouldBeRegistered && Index == INDEX_NONE)
+	{
+		ReplicatedSubObjects.Emplace(Component, COND_None, false);
+	}
+	else if (!bShouldBeRegistered && Index != INDEX_NONE)
+	{
+		ReplicatedSubObjects.RemoveAt(Index);
+	}
+}
+
+void AActor::UpdateAllReplicatedSubObjectComponents()
+{
+	if (!bReplicateUsingRegisteredSubObjectList)
+	{
+		return;
+	}
+
+	// Drop stale entries and components that stopped replicating, keeping explicitly registered subobjects
+	ReplicatedSubObjects.RemoveAll([this](const FReplicatedSubObjectInfo& Info)
+	{
+		UObject* SubObject = Info.SubObject.Get();
+		if (SubObject == nullptr)
+		{
+			return true;
+		}
+
+		UActorComponent* Component = Cast<UActorComponent>(SubObject);
+		return Component && Component->GetOwner() == this && !ReplicatedComponents.Contains(Component);
+	});
+
+	for (UActorComponent* Component : ReplicatedComponents)
+	{
+		if (!ReplicatedSubObjects.ContainsByPredicate([Component](const FReplicatedSubObjectInfo& Info) { return Info.SubObject == Component; }))
+		{
+			ReplicatedSubObjects.Emplace(Component, COND_None, false);
+		}
+	}
+}
+
 void AActor::GetSubobjectsWithStableNamesForNetworking(TArray<UObject*> &ObjList)
 {	
 	// For experimenting with replicating ALL stably named components initially
@@ -0,0 +1,367 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Animation/AnimBoneCompressionCodec_UniformSegments.h"
+#include "Animation/AnimSequenceDecompressionContext.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "AnimEncoding.h"
+
+#if INTEL_ISPC
+#include "AnimBoneCompressionCodec_UniformSegments.ispc.generated.h"
+#endif
+
+namespace UniformSegments
+{
+	/** Component streams of a key, the scale streams are only stored if the sequence has scale */
+	enum EStream
+	{
+		RotationX, RotationY, RotationZ,
+		TranslationX, TranslationY, TranslationZ,
+		ScaleX, ScaleY, ScaleZ,
+		NumStreamsWithScale
+	};
+
+	static const int32 NumStreamsWithoutScale = ScaleX;
+
+	static const int32 TrackAlignment = 8;
+
+	static const float QuantizationScale = 65535.f;
+
+	/** Finds the segment holding both keys of a sampling time and the keys within it */
+	static float GetSegmentKeys(const FUniformSegmentsCompressedAnimData& AnimData, const FAnimSequenceDecompressionContext& DecompContext, int32& OutSegmentIndex, int32& OutSegmentKey0, int32& OutSegmentKey1)
+	{
+		int32 Key0, Key1;
+		const float Alpha = AnimEncoding::TimeToIndex(DecompContext.SequenceLength, DecompContext.RelativePos, AnimData.CompressedNumberOfFrames, DecompContext.Interpolation, Key0, Key1);
+
+		// Segments share their boundary key, so the keys around any time are in the same segment
+		const int32 SegmentNumIntervals = AnimData.SegmentNumKeys - 1;
+		OutSegmentIndex = FMath::Min(Key0 / SegmentNumIntervals, AnimData.NumSegments - 1);
+		OutSegmentKey0 = Key0 - OutSegmentIndex * SegmentNumIntervals;
+		OutSegmentKey1 = Key1 - OutSegmentIndex * SegmentNumIntervals;
+		return Alpha;
+	}
+
+	FORCEINLINE float Dequantize(const float* Mins, const float* Extents, const uint16* Key, int32 StreamOffset)
+	{
+		return Mins[StreamOffset] + Extents[StreamOffset] * ((float)Key[StreamOffset] * (1.f / QuantizationScale));
+	}
+
+	/** Decompresses a single track, rotations are stored with a positive W */
+	static void DecompressTrack(const FUniformSegmentsCompressedAnimData& AnimData, int32 SegmentIndex, int32 SegmentKey0, int32 SegmentKey1, float Alpha, int32 TrackIndex, FQuat* OutRotation, FVector* OutTranslation, FVector* OutScale)
+	{
+		const float* Mins = AnimData.GetSegmentMins(SegmentIndex);
+		const float* Extents = AnimData.GetSegmentExtents(SegmentIndex);
+		const uint16* KeyData0 = AnimData.GetSegmentKey(SegmentIndex, SegmentKey0);
+		const uint16* KeyData1 = AnimData.GetSegmentKey(SegmentIndex, SegmentKey1);
+		const int32 Stride = AnimData.NumTracksPadded;
+
+		auto GetVector = [&](int32 FirstStream, const uint16* KeyData)
+		{
+			return FVector(
+				Dequantize(Mins, Extents, KeyData, (FirstStream + 0) * Stride + TrackIndex),
+				Dequantize(Mins, Extents, KeyData, (FirstStream + 1) * Stride + TrackIndex),
+				Dequantize(Mins, Extents, KeyData, (FirstStream + 2) * Stride + TrackIndex));
+		};
+
+		if (OutRotation)
+		{
+			const FVector R0 = GetVector(RotationX, KeyData0);
+			const FVector R1 = GetVector(RotationX, KeyData1);
+			const FQuat Q0(R0.X, R0.Y, R0.Z, FMath::Sqrt(FMath::Max(1.f - R0.SizeSquared(), 0.f)));
+			const FQuat Q1(R1.X, R1.Y, R1.Z, FMath::Sqrt(FMath::Max(1.f - R1.SizeSquared(), 0.f)));
+
+			*OutRotation = FQuat::FastLerp(Q0, Q1, Alpha);
+			OutRotation->Normalize();
+		}
+
+		if (OutTranslation)
+		{
+			*OutTranslation = FMath::Lerp(GetVector(TranslationX, KeyData0), GetVector(TranslationX, KeyData1), Alpha);
+		}
+
+		if (OutScale)
+		{
+			*OutScale = FMath::Lerp(GetVector(ScaleX, KeyData0), GetVector(ScaleX, KeyData1), Alpha);
+		}
+	}
+}
+
+void FUniformSegmentsCompressedAnimData::SerializeCompressedData(FArchive& Ar)
+{
+	ICompressedAnimData::SerializeCompressedData(Ar);
+
+	Ar << NumTracks;
+	Ar << NumTracksPadded;
+	Ar << SegmentNumKeys;
+	Ar << NumSegments;
+	Ar << NumStreams;
+}
+
+FString FUniformSegmentsCompressedAnimData::GetDebugString() const
+{
+	return FString::Printf(TEXT("[%d segments of %d keys%s]"), NumSegments, SegmentNumKeys, HasScale() ? TEXT(", scale") : TEXT(""));
+}
+
+template<typename TArchive>
+void FUniformSegmentsCompressedAnimData::ByteSwapData(TArrayView<uint8> CompressedData, TArchive& MemoryStream)
+{
+	uint8* MovingCompressedDataPtr = CompressedData.GetData();
+
+	const int32 NumRanges = NumStreams * NumTracksPadded * 2;
+	const int32 NumKeyValues = NumStreams * NumTracksPadded * SegmentNumKeys;
+	for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+	{
+		for (int32 RangeIndex = 0; RangeIndex < NumRanges; ++RangeIndex)
+		{
+			AC_UnalignedSwap(MemoryStream, MovingCompressedDataPtr, sizeof(float));
+		}
+
+		for (int32 ValueIndex = 0; ValueIndex < NumKeyValues; ++ValueIndex)
+		{
+			AC_UnalignedSwap(MemoryStream, MovingCompressedDataPtr, sizeof(uint16));
+		}
+	}
+}
+
+template void FUniformSegmentsCompressedAnimData::ByteSwapData(TArrayView<uint8> CompressedData, FMemoryReader& MemoryStream);
+template void FUniformSegmentsCompressedAnimData::ByteSwapData(TArrayView<uint8> CompressedData, FMemoryWriter& MemoryStream);
+
+UAnimBoneCompressionCodec_UniformSegments::UAnimBoneCompressionCodec_UniformSegments(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, NumKeysPerSegment(16)
+{
+}
+
+#if WITH_EDITORONLY_DATA
+bool UAnimBoneCompressionCodec_UniformSegments::Compress(const FCompressibleAnimData& CompressibleAnimData, FCompressibleAnimDataResult& OutResult)
+{
+	using namespace UniformSegments;
+
+	const TArray<FRawAnimSequenceTrack>& RawTracks = CompressibleAnimData.RawAnimationData;
+	const int32 NumFrames = CompressibleAnimData.NumFrames;
+	if (RawTracks.Num() == 0 || NumFrames <= 0)
+	{
+		return false;
+	}
+
+	TUniquePtr<FUniformSegmentsCompressedAnimData> AnimData = MakeUnique<FUniformSegmentsCompressedAnimData>();
+	AnimData->CompressedNumberOfFrames = NumFrames;
+	AnimData->NumTracks = RawTracks.Num();
+	AnimData->NumTracksPadded = Align(RawTracks.Num(), TrackAlignment);
+	AnimData->SegmentNumKeys = FMath::Clamp(NumKeysPerSegment, 2, 256);
+	AnimData->NumSegments = FMath::Max(FMath::DivideAndRoundUp(NumFrames - 1, AnimData->SegmentNumKeys - 1), 1);
+
+	const bool bHasScale = RawTracks.ContainsByPredicate([](const FRawAnimSequenceTrack& Track) { return Track.ScaleKeys.Num() > 0; });
+	AnimData->NumStreams = bHasScale ? NumStreamsWithScale : NumStreamsWithoutScale;
+
+	const int32 NumStreams = AnimData->NumStreams;
+	const int32 Stride = AnimData->NumTracksPadded;
+	const int32 SegmentNumKeys = AnimData->SegmentNumKeys;
+
+	// Raw tracks hold either one key per frame or a single key for the whole sequence
+	auto GetStreamValue = [&RawTracks](int32 TrackIndex, int32 FrameIndex, int32 Stream) -> float
+	{
+		const FRawAnimSequenceTrack& Track = RawTracks[TrackIndex];
+		if (Stream < TranslationX)
+		{
+			FQuat Rotation = Track.RotKeys.Num() > 0 ? Track.RotKeys[FMath::Min(FrameIndex, Track.RotKeys.Num() - 1)] : FQuat::Identity;
+			Rotation.Normalize();
+
+			// W is rebuilt from the other components during decompression
+			if (Rotation.W < 0.f)
+			{
+				Rotation = Rotation * -1.f;
+			}
+			return Stream == RotationX ? Rotation.X : (Stream == RotationY ? Rotation.Y : Rotation.Z);
+		}
+		else if (Stream < ScaleX)
+		{
+			const FVector Translation = Track.PosKeys.Num() > 0 ? Track.PosKeys[FMath::Min(FrameIndex, Track.PosKeys.Num() - 1)] : FVector::ZeroVector;
+			return Translation[Stream - TranslationX];
+		}
+		else
+		{
+			const FVector Scale = Track.ScaleKeys.Num() > 0 ? Track.ScaleKeys[FMath::Min(FrameIndex, Track.ScaleKeys.Num() - 1)] : FVector::OneVector;
+			return Scale[Stream - ScaleX];
+		}
+	};
+
+	TArray<uint8>& ByteStream = OutResult.CompressedByteStream;
+	ByteStream.Reset();
+	ByteStream.AddZeroed(AnimData->NumSegments * AnimData->GetSegmentSize());
+	AnimData->Bind(ByteStream);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < AnimData->NumSegments; ++SegmentIndex)
+	{
+		if (CompressibleAnimData.IsCancelled())
+		{
+			return false;
+		}
+
+		float* Mins = const_cast<float*>(AnimData->GetSegmentMins(SegmentIndex));
+		float* Extents = const_cast<float*>(AnimData->GetSegmentExtents(SegmentIndex));
+		const int32 FirstFrame = SegmentIndex * (SegmentNumKeys - 1);
+
+		for (int32 TrackIndex = 0; TrackIndex < AnimData->NumTracks; ++TrackIndex)
+		{
+			for (int32 Stream = 0; Stream < NumStreams; ++Stream)
+			{
+				// The last segment repeats the last frame to keep every segment the same size
+				float MinValue = MAX_flt;
+				float MaxValue = -MAX_flt;
+				for (int32 SegmentKey = 0; SegmentKey < SegmentNumKeys; ++SegmentKey)
+				{
+					const float Value = GetStreamValue(TrackIndex, FMath::Min(FirstFrame + SegmentKey, NumFrames - 1), Stream);
+					MinValue = FMath::Min(MinValue, Value);
+					MaxValue = FMath::Max(MaxValue, Value);
+				}
+
+				const int32 StreamOffset = Stream * Stride + TrackIndex;
+				const float Extent = MaxValue - MinValue;
+				Mins[StreamOffset] = MinValue;
+				Extents[StreamOffset] = Extent;
+
+				for (int32 SegmentKey = 0; SegmentKey < SegmentNumKeys; ++SegmentKey)
+				{
+					const float Value = GetStreamValue(TrackIndex, FMath::Min(FirstFrame + SegmentKey, NumFrames - 1), Stream);
+					const float Normalized = Extent > SMALL_NUMBER ? (Value - MinValue) / Extent : 0.f;
+
+					uint16* KeyData = const_cast<uint16*>(AnimData->GetSegmentKey(SegmentIndex, SegmentKey));
+					KeyData[StreamOffset] = (uint16)FMath::Clamp(FMath::RoundToInt(Normalized * QuantizationScale), 0, 65535);
+				}
+			}
+		}
+	}
+
+	OutResult.Codec = this;
+	OutResult.AnimData = MoveTemp(AnimData);
+	return true;
+}
+
+void UAnimBoneCompressionCodec_UniformSegments::PopulateDDCKey(FArchive& Ar)
+{
+	Super::PopulateDDCKey(Ar);
+
+	int32 CodecVersion = 0;
+
+	Ar << CodecVersion;
+	Ar << NumKeysPerSegment;
+}
+#endif
+
+TUniquePtr<ICompressedAnimData> UAnimBoneCompressionCodec_UniformSegments::AllocateAnimData() const
+{
+	return MakeUnique<FUniformSegmentsCompressedAnimData>();
+}
+
+void UAnimBoneCompressionCodec_UniformSegments::ByteSwapIn(ICompressedAnimData& AnimData, TArrayView<uint8> CompressedData, FMemoryReader& MemoryStream) const
+{
+	static_cast<FUniformSegmentsCompressedAnimData&>(AnimData).ByteSwapData(CompressedData, MemoryStream);
+}
+
+void UAnimBoneCompressionCodec_UniformSegments::ByteSwapOut(ICompressedAnimData& AnimData, TArrayView<uint8> CompressedData, FMemoryWriter& MemoryStream) const
+{
+	static_cast<FUniformSegmentsCompressedAnimData&>(AnimData).ByteSwapData(CompressedData, MemoryStream);
+}
+
+void UAnimBoneCompressionCodec_UniformSegments::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
+{
+	using namespace UniformSegments;
+
+	const FUniformSegmentsCompressedAnimData& AnimData = static_cast<const FUniformSegmentsCompressedAnimData&>(DecompContext.CompressedAnimData);
+	const bool bHasScale = AnimData.HasScale();
+
+	int32 SegmentIndex, SegmentKey0, SegmentKey1;
+	const float Alpha = GetSegmentKeys(AnimData, DecompContext, SegmentIndex, SegmentKey0, SegmentKey1);
+
+	if (INTEL_ISPC)
+	{
+#if INTEL_ISPC
+		// Decode every track at once into streams, then scatter the requested tracks to the pose
+		FMemMark Mark(FMemStack::Get());
+
+		const int32 Stride = AnimData.NumTracksPadded;
+		TArray<float, FAnimStackAllocator> Streams;
+		Streams.SetNumUninitialized((AnimData.NumStreams + 1) * Stride);
+
+		ispc::DecompressUniformSegmentsPose(
+			Streams.GetData(),
+			AnimData.GetSegmentMins(SegmentIndex),
+			AnimData.GetSegmentExtents(SegmentIndex),
+			AnimData.GetSegmentKey(SegmentIndex, SegmentKey0),
+			AnimData.GetSegmentKey(SegmentIndex, SegmentKey1),
+			Alpha,
+			AnimData.NumStreams,
+			Stride);
+
+		// Decoded rotations have a W stream after their X, Y and Z streams
+		const float* Rotations = Streams.GetData();
+		const float* Translations = Rotations + (TranslationX + 1) * Stride;
+		const float* Scales = Rotations + (ScaleX + 1) * Stride;
+
+		for (const BoneTrackPair& Pair : RotationPairs)
+		{
+			const int32 TrackIndex = Pair.TrackIndex;
+			OutAtoms[Pair.AtomIndex].SetRotation(FQuat(Rotations[TrackIndex], Rotations[Stride + TrackIndex], Rotations[2 * Stride + TrackIndex], Rotations[3 * Stride + TrackIndex]));
+		}
+
+		for (const BoneTrackPair& Pair : TranslationPairs)
+		{
+			const int32 TrackIndex = Pair.TrackIndex;
+			OutAtoms[Pair.AtomIndex].SetTranslation(FVector(Translations[TrackIndex], Translations[Stride + TrackIndex], Translations[2 * Stride + TrackIndex]));
+		}
+
+		if (bHasScale)
+		{
+			for (const BoneTrackPair& Pair : ScalePairs)
+			{
+				const int32 TrackIndex = Pair.TrackIndex;
+				OutAtoms[Pair.AtomIndex].SetScale3D(FVector(Scales[TrackIndex], Scales[Stride + TrackIndex], Scales[2 * Stride + TrackIndex]));
+			}
+		}
+#endif
+	}
+	else
+	{
+		for (const BoneTrackPair& Pair : RotationPairs)
+		{
+			FQuat Rotation;
+			DecompressTrack(AnimData, SegmentIndex, SegmentKey0, SegmentKey1, Alpha, Pair.TrackIndex, &Rotation, nullptr, nullptr);
+			OutAtoms[Pair.AtomIndex].SetRotation(Rotation);
+		}
+
+		for (const BoneTrackPair& Pair : TranslationPairs)
+		{
+			FVector Translation;
+			DecompressTrack(AnimData, SegmentIndex, SegmentKey0, SegmentKey1, Alpha, Pair.TrackIndex, nullptr, &Translation, nullptr);
+			OutAtoms[Pair.AtomIndex].SetTranslation(Translation);
+		}
+
+		if (bHasScale)
+		{
+			for (const BoneTrackPair& Pair : ScalePairs)
+			{
+				FVector Scale;
+				DecompressTrack(AnimData, SegmentIndex, SegmentKey0, SegmentKey1, Alpha, Pair.TrackIndex, nullptr, nullptr, &Scale);
+				OutAtoms[Pair.AtomIndex].SetScale3D(Scale);
+			}
+		}
+	}
+}
+
+void UAnimBoneCompressionCodec_UniformSegments::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+{
+	using namespace UniformSegments;
+
+	const FUniformSegmentsCompressedAnimData& AnimData = static_cast<const FUniformSegmentsCompressedAnimData&>(DecompContext.CompressedAnimData);
+
+	int32 SegmentIndex, SegmentKey0, SegmentKey1;
+	const float Alpha = GetSegmentKeys(AnimData, DecompContext, SegmentIndex, SegmentKey0, SegmentKey1);
+
+	FQuat Rotation;
+	FVector Translation;
+	FVector Scale = FVector::OneVector;
+	DecompressTrack(AnimData, SegmentIndex, SegmentKey0, SegmentKey1, Alpha, TrackIndex, &Rotation, &Translation, AnimData.HasScale() ? &Scale : nullptr);
+
+	OutAtom = FTransform(Rotation, Translation, Scale);
+}
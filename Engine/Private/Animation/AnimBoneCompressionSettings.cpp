@@ -19,6 +19,7 @@ UAnimBoneCompressionSettings::UAnimBoneCompressionSettings(const FObjectInitiali
 
 	UAnimationSettings* AnimSetting = UAnimationSettings::Get();
 	bForceBelowThreshold = AnimSetting->bForceBelowThreshold;
+	bStopAtFirstCodecBelowThreshold = false;
 #endif
 }
 
@@ -76,6 +77,16 @@ bool UAnimBoneCompressionSettings::AreSettingsValid() const
 	return NumValidCodecs != 0;
 }
 
+/** Shared by the codecs compressing a sequence, to stop once one of them is under the error threshold */
+struct FAnimBoneCompressionEarlyOut
+{
+	/** Error threshold to stop at, negative to try every codec */
+	float ErrorThreshold = -1.0f;
+
+	/** Lowest index of the codecs known to be under the threshold, the codecs after it don't need to run */
+	volatile int32 FirstAcceptableIndex = MAX_int32;
+};
+
 struct FAnimBoneCompressionContext
 {
 	/** The animation sequence we are compressing. */
@@ -88,11 +99,17 @@ struct FAnimBoneCompressionContext
 	FCompressibleAnimDataResult Result;
 	bool bSuccess;
 
-	FAnimBoneCompressionContext(const FCompressibleAnimData& AnimSeq_, UAnimBoneCompressionCodec* Codec_)
+	/** Index of the codec in the settings, among the valid ones */
+	int32 Index;
+	FAnimBoneCompressionEarlyOut& EarlyOut;
+
+	FAnimBoneCompressionContext(const FCompressibleAnimData& AnimSeq_, UAnimBoneCompressionCodec* Codec_, int32 Index_, FAnimBoneCompressionEarlyOut& EarlyOut_)
 		: AnimSeq(AnimSeq_)
 		, Codec(Codec_)
 		, Result()
 		, bSuccess(false)
+		, Index(Index_)
+		, EarlyOut(EarlyOut_)
 	{}
 
 	int32 GetCompressedSize() const { return Result.AnimData != nullptr ? Result.AnimData->GetApproxCompressedSize() : 0; }
@@ -100,11 +117,31 @@ struct FAnimBoneCompressionContext
 
 static void CompressAnimSequenceImpl(FAnimBoneCompressionContext& Context)
 {
+	// A preferred codec is already under the threshold
+	if (Context.Index > Context.EarlyOut.FirstAcceptableIndex)
+	{
+		return;
+	}
+
 	Context.bSuccess = Context.Codec->Compress(Context.AnimSeq, Context.Result);
 
 	if (Context.bSuccess && !Context.AnimSeq.IsCancelled())
 	{
 		FAnimationUtils::ComputeCompressionError(Context.AnimSeq, Context.Result, Context.Result.AnimData->BoneCompressionErrorStats);
+
+		if (Context.EarlyOut.ErrorThreshold >= 0.0f && Context.Result.AnimData->BoneCompressionErrorStats.MaxError <= Context.EarlyOut.ErrorThreshold)
+		{
+			int32 FirstAcceptableIndex = Context.EarlyOut.FirstAcceptableIndex;
+			while (Context.Index < FirstAcceptableIndex)
+			{
+				const int32 PreviousIndex = FPlatformAtomics::InterlockedCompareExchange(&Context.EarlyOut.FirstAcceptableIndex, Context.Index, FirstAcceptableIndex);
+				if (PreviousIndex == FirstAcceptableIndex)
+				{
+					break;
+				}
+				FirstAcceptableIndex = PreviousIndex;
+			}
+		}
 	}
 }
 
@@ -151,6 +188,12 @@ bool UAnimBoneCompressionSettings::Compress(const FCompressibleAnimData& AnimSeq
 	FGraphEventArray AnimCompressionTask_CompletionEvents;
 	TArray<FAnimBoneCompressionContext*> ContextList;
 
+	FAnimBoneCompressionEarlyOut EarlyOut;
+	if (bStopAtFirstCodecBelowThreshold)
+	{
+		EarlyOut.ErrorThreshold = ErrorThreshold / AnimSeq.ErrorThresholdScale;
+	}
+
 	for (UAnimBoneCompressionCodec* Codec : Codecs)
 	{
 		if (Codec == nullptr)
@@ -158,7 +201,7 @@ bool UAnimBoneCompressionSettings::Compress(const FCompressibleAnimData& AnimSeq
 			continue;
 		}
 
-		FAnimBoneCompressionContext* Context = new FAnimBoneCompressionContext(AnimSeq, Codec);
+		FAnimBoneCompressionContext* Context = new FAnimBoneCompressionContext(AnimSeq, Codec, ContextList.Num(), EarlyOut);
 		ContextList.Add(Context);
 
 		AnimCompressionTask_CompletionEvents.Add(TGraphTask<FAsyncAnimCompressionTask>::CreateTask(NULL).ConstructAndDispatchWhenReady(Context));
@@ -167,7 +210,9 @@ bool UAnimBoneCompressionSettings::Compress(const FCompressibleAnimData& AnimSeq
 	// Wait for async compression to finish
 	FTaskGraphInterface::Get().WaitUntilTasksComplete(AnimCompressionTask_CompletionEvents);
 
-	const int32 NumContextes = ContextList.Num();
+	// Only the codecs up to the first one under the threshold are considered, whichever of the later ones happened to run before it finished,
+	// so the selected codec doesn't depend on scheduling
+	const int32 NumContextes = FMath::Min(ContextList.Num(), EarlyOut.FirstAcceptableIndex == MAX_int32 ? MAX_int32 : EarlyOut.FirstAcceptableIndex + 1);
 	if (NumContextes == 0)
 	{
 		return false;
@@ -299,6 +344,12 @@ void UAnimBoneCompressionSettings::PopulateDDCKey(FArchive& Ar)
 	Ar << ErrorThreshold;
 	Ar << bForceBelowThreshold;
 
+	// Only when set, so the keys of the existing settings don't change
+	if (bStopAtFirstCodecBelowThreshold)
+	{
+		Ar << bStopAtFirstCodecBelowThreshold;
+	}
+
 	int32 NumValidCodecs = 0;
 	for (UAnimBoneCompressionCodec* Codec : Codecs)
 	{
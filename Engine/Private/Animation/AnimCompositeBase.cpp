@@ -720,7 +720,9 @@ void UAnimCompositeBase::SetSequenceLength(float InSequenceLength)
 
 void UAnimCompositeBase::ExtractRootMotionFromTrack(const FAnimTrack &SlotAnimTrack, float StartTrackPosition, float EndTrackPosition, FRootMotionMovementParams &RootMotion) const
 {
-	TArray<FRootMotionExtractionStep> RootMotionExtractionSteps;
+	// Kept per thread so extracting root motion every tick doesn't allocate
+	static thread_local TArray<FRootMotionExtractionStep> RootMotionExtractionSteps;
+	RootMotionExtractionSteps.Reset();
 	SlotAnimTrack.GetRootMotionExtractionStepsForTrackRange(RootMotionExtractionSteps, StartTrackPosition, EndTrackPosition);
 
 	UE_LOG(LogRootMotion, Verbose, TEXT("\tUAnimCompositeBase::ExtractRootMotionFromTrack, NumSteps: %d, StartTrackPosition: %.3f, EndTrackPosition: %.3f"),
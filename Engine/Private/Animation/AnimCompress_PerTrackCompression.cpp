@@ -8,6 +8,15 @@
 #include "AnimationCompression.h"
 #include "AnimEncoding.h"
 #include "AnimEncoding_PerTrackCompression.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GPerTrackCompressionParallel = 1;
+static FAutoConsoleVariableRef CVarPerTrackCompressionParallel(
+	TEXT("a.Compression.PerTrackParallel"),
+	GPerTrackCompressionParallel,
+	TEXT("If 1, the per track compression codec tries the formats of different tracks in parallel."),
+	ECVF_Default);
 
 struct FAnimSetMeshLinkup;
 
@@ -1015,8 +1024,18 @@ void UAnimCompress_PerTrackCompression::CompressUsingUnderlyingCompressor(
 
 	AnimData.CompressedByteStream.Empty();
 
-	// Compress each track independently
-	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	// Compress each track independently. The formats of different tracks are tried in parallel and the tracks are written into
+	// the stream in order once they're all done, so the result doesn't depend on the number of threads.
+	struct FCompressedTrackBytes
+	{
+		TArray<uint8> Translation;
+		TArray<uint8> Rotation;
+		TArray<uint8> Scale;
+	};
+	TArray<FCompressedTrackBytes> TrackBytes;
+	TrackBytes.SetNum(NumTracks);
+
+	ParallelFor(NumTracks, [&](int32 TrackIndex)
 	{
 		if (CompressibleAnimData.IsCancelled())
 		{
@@ -1157,34 +1176,14 @@ void UAnimCompress_PerTrackCompression::CompressUsingUnderlyingCompressor(
 				}
 			}
 
-			int32 ScaleOffset = INDEX_NONE;
-			if (BestScale.CompressedBytes.Num() > 0)
-			{
-				check(BestScale.ActualCompressionMode < ACF_MAX);
-				ScaleOffset = AnimData.CompressedByteStream.Num();
-				AnimData.CompressedByteStream.Append(BestScale.CompressedBytes);
-			}
-			AnimData.CompressedScaleOffsets.SetOffsetData(TrackIndex, 0, ScaleOffset);
-		}
-
-		// Now write out compression and translation frames into the stream
-		int32 TranslationOffset = INDEX_NONE;
-		if (BestTranslation.CompressedBytes.Num() > 0 )
-		{
-			check(BestTranslation.ActualCompressionMode < ACF_MAX);
-			TranslationOffset = AnimData.CompressedByteStream.Num();
-			AnimData.CompressedByteStream.Append(BestTranslation.CompressedBytes);
+			check(BestScale.CompressedBytes.Num() == 0 || BestScale.ActualCompressionMode < ACF_MAX);
+			TrackBytes[TrackIndex].Scale = MoveTemp(BestScale.CompressedBytes);
 		}
-		AnimData.CompressedTrackOffsets[TrackIndex*2 + 0] = TranslationOffset;
 
-		int32 RotationOffset = INDEX_NONE;
-		if (BestRotation.CompressedBytes.Num() > 0)
-		{
-			check(BestRotation.ActualCompressionMode < ACF_MAX);
-			RotationOffset = AnimData.CompressedByteStream.Num();
-			AnimData.CompressedByteStream.Append(BestRotation.CompressedBytes);
-		}
-		AnimData.CompressedTrackOffsets[TrackIndex*2 + 1] = RotationOffset;
+		check(BestTranslation.CompressedBytes.Num() == 0 || BestTranslation.ActualCompressionMode < ACF_MAX);
+		check(BestRotation.CompressedBytes.Num() == 0 || BestRotation.ActualCompressionMode < ACF_MAX);
+		TrackBytes[TrackIndex].Translation = MoveTemp(BestTranslation.CompressedBytes);
+		TrackBytes[TrackIndex].Rotation = MoveTemp(BestRotation.CompressedBytes);
 	
 #if 0
 		// This block outputs information about each individual track during compression, which is useful for debugging the compressors
@@ -1203,6 +1202,44 @@ void UAnimCompress_PerTrackCompression::CompressUsingUnderlyingCompressor(
 			MaxAngleErrorCutoff
 			);
 #endif
+	}, !GPerTrackCompressionParallel);
+
+	if (CompressibleAnimData.IsCancelled())
+	{
+		return;
+	}
+
+	// Now write out the compressed frames into the stream
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	{
+		const FCompressedTrackBytes& Bytes = TrackBytes[TrackIndex];
+
+		if (bHasScale)
+		{
+			int32 ScaleOffset = INDEX_NONE;
+			if (Bytes.Scale.Num() > 0)
+			{
+				ScaleOffset = AnimData.CompressedByteStream.Num();
+				AnimData.CompressedByteStream.Append(Bytes.Scale);
+			}
+			AnimData.CompressedScaleOffsets.SetOffsetData(TrackIndex, 0, ScaleOffset);
+		}
+
+		int32 TranslationOffset = INDEX_NONE;
+		if (Bytes.Translation.Num() > 0)
+		{
+			TranslationOffset = AnimData.CompressedByteStream.Num();
+			AnimData.CompressedByteStream.Append(Bytes.Translation);
+		}
+		AnimData.CompressedTrackOffsets[TrackIndex*2 + 0] = TranslationOffset;
+
+		int32 RotationOffset = INDEX_NONE;
+		if (Bytes.Rotation.Num() > 0)
+		{
+			RotationOffset = AnimData.CompressedByteStream.Num();
+			AnimData.CompressedByteStream.Append(Bytes.Rotation);
+		}
+		AnimData.CompressedTrackOffsets[TrackIndex*2 + 1] = RotationOffset;
 	}
 }
 
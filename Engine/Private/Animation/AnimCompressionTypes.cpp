@@ -10,6 +10,7 @@
 #include "Animation/AnimCurveCompressionCodec.h"
 #include "Animation/AnimCurveCompressionSettings.h"
 #include "AnimationRuntime.h"
+#include "Animation/AnimDecompressionCache.h"
 #include "UObject/FortniteMainBranchObjectVersion.h"
 
 CSV_DECLARE_CATEGORY_MODULE_EXTERN(ENGINE_API, Animation);
@@ -665,6 +666,9 @@ SIZE_T FCompressedAnimSequence::GetMemorySize() const
 
 void FCompressedAnimSequence::ClearCompressedBoneData()
 {
+	// Cached keys are identified by the address of the compressed data
+	FAnimDecompressionCache::Flush();
+
 	CompressedByteStream.Empty(0);
 	CompressedDataStructure.Reset();
 	BoneCompressionCodec = nullptr;
@@ -767,27 +771,64 @@ void DecompressPose(FCompactPose& OutPose, const FCompressedAnimSequence& Compre
 		CSV_SCOPED_TIMING_STAT(Animation, ExtractPoseFromAnimData);
 		CSV_CUSTOM_STAT(Animation, NumberOfExtractedAnimations, 1, ECsvCustomStatOp::Accumulate);
 
-		FAnimSequenceDecompressionContext EvalDecompContext(SequenceLength, Interpolation, SourceName, *CompressedData.CompressedDataStructure);
-		EvalDecompContext.Seek(ExtractionContext.CurrentTime);
-
-		// Handle Root Bone separately
-		if (bFirstTrackIsRootBone)
+		FAnimDecompressedKeys CachedKeys;
+		if (FAnimDecompressionCache::FindOrDecompressKeys(CompressedData, SequenceLength, Interpolation, SourceName, ExtractionContext.CurrentTime, CachedKeys))
 		{
-			const int32 TrackIndex = 0;
-			FCompactPoseBoneIndex RootBone(0);
-			FTransform& RootAtom = OutPose[RootBone];
+			// Interpolate the keys shared with other samplings of the sequence this frame
+			if (bFirstTrackIsRootBone)
+			{
+				FCompactPoseBoneIndex RootBone(0);
+				FTransform& RootAtom = OutPose[RootBone];
+				RootAtom.SetRotation(CachedKeys.GetRotation(0));
+				RootAtom.SetTranslation(CachedKeys.GetTranslation(0));
+				if (CachedKeys.HasScale())
+				{
+					RootAtom.SetScale3D(CachedKeys.GetScale3D(0));
+				}
 
-			CompressedData.BoneCompressionCodec->DecompressBone(EvalDecompContext, TrackIndex, RootAtom);
+				FAnimationRuntime::RetargetBoneTransform(Skeleton, RetargetSource, RootAtom, 0, RootBone, RequiredBones, bIsBakedAdditive);
+			}
 
-			// @laurent - we should look into splitting rotation and translation tracks, so we don't have to process translation twice.
-			FAnimationRuntime::RetargetBoneTransform(Skeleton, RetargetSource, RootAtom, 0, RootBone, RequiredBones, bIsBakedAdditive);
-		}
+			const bool bHasScale = CachedKeys.HasScale();
+			for (const BoneTrackPair& Pair : RotationScalePairs)
+			{
+				FTransform& BoneAtom = OutPose[FCompactPoseBoneIndex(Pair.AtomIndex)];
+				BoneAtom.SetRotation(CachedKeys.GetRotation(Pair.TrackIndex));
+				if (bHasScale)
+				{
+					BoneAtom.SetScale3D(CachedKeys.GetScale3D(Pair.TrackIndex));
+				}
+			}
 
-		if (RotationScalePairs.Num() > 0)
+			for (const BoneTrackPair& Pair : TranslationPairs)
+			{
+				OutPose[FCompactPoseBoneIndex(Pair.AtomIndex)].SetTranslation(CachedKeys.GetTranslation(Pair.TrackIndex));
+			}
+		}
+		else
 		{
-			// get the remaining bone atoms
-			TArrayView<FTransform> OutPoseBones = OutPose.GetMutableBones();
-			CompressedData.BoneCompressionCodec->DecompressPose(EvalDecompContext, RotationScalePairs, TranslationPairs, RotationScalePairs, OutPoseBones);
+			FAnimSequenceDecompressionContext EvalDecompContext(SequenceLength, Interpolation, SourceName, *CompressedData.CompressedDataStructure);
+			EvalDecompContext.Seek(ExtractionContext.CurrentTime);
+
+			// Handle Root Bone separately
+			if (bFirstTrackIsRootBone)
+			{
+				const int32 TrackIndex = 0;
+				FCompactPoseBoneIndex RootBone(0);
+				FTransform& RootAtom = OutPose[RootBone];
+
+				CompressedData.BoneCompressionCodec->DecompressBone(EvalDecompContext, TrackIndex, RootAtom);
+
+				// @laurent - we should look into splitting rotation and translation tracks, so we don't have to process translation twice.
+				FAnimationRuntime::RetargetBoneTransform(Skeleton, RetargetSource, RootAtom, 0, RootBone, RequiredBones, bIsBakedAdditive);
+			}
+
+			if (RotationScalePairs.Num() > 0)
+			{
+				// get the remaining bone atoms
+				TArrayView<FTransform> OutPoseBones = OutPose.GetMutableBones();
+				CompressedData.BoneCompressionCodec->DecompressPose(EvalDecompContext, RotationScalePairs, TranslationPairs, RotationScalePairs, OutPoseBones);
+			}
 		}
 	}
 
@@ -0,0 +1,256 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Animation/AnimDecompressionCache.h"
+#include "Animation/AnimCompressionTypes.h"
+#include "Animation/AnimSequenceDecompressionContext.h"
+#include "Animation/AnimBoneCompressionCodec.h"
+#include "AnimEncoding.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Anim Decompression Cache Fill"), STAT_AnimDecompressionCacheFill, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Anim Decompression Cache Hits"), STAT_AnimDecompressionCacheHits, STATGROUP_Anim);
+
+static int32 GAnimDecompressionCache = 0;
+static FAutoConsoleVariableRef CVarAnimDecompressionCache(
+	TEXT("a.AnimDecompressionCache"),
+	GAnimDecompressionCache,
+	TEXT("If 1, decompressed sequence keys are cached for the frame and shared by every pose sampled between the same keys of a sequence.\n")
+	TEXT("Poses are then interpolated linearly between the cached keys, which may differ very slightly from the codec's own interpolation."));
+
+static int32 GAnimDecompressionCacheMaxKeys = 512;
+static FAutoConsoleVariableRef CVarAnimDecompressionCacheMaxKeys(
+	TEXT("a.AnimDecompressionCache.MaxKeys"),
+	GAnimDecompressionCacheMaxKeys,
+	TEXT("Maximum number of decompressed keys cached per frame. Once full, poses are decompressed as if the cache was disabled."));
+
+namespace AnimDecompressionCache
+{
+	struct FKey
+	{
+		const FCompressedAnimSequence* CompressedData;
+		int32 KeyIndex;
+
+		bool operator==(const FKey& Other) const
+		{
+			return CompressedData == Other.CompressedData && KeyIndex == Other.KeyIndex;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(PointerHash(Key.CompressedData), ::GetTypeHash(Key.KeyIndex));
+		}
+	};
+
+	typedef TSharedPtr<const FAnimDecompressedKey, ESPMode::ThreadSafe> FCachedKeyPtr;
+
+	/** Scale the atoms are initialized with, to tell whether the codec wrote any */
+	static const FVector UnwrittenScale(MAX_flt);
+
+	/** Guards everything below. Sampling runs on animation worker threads. */
+	static FRWLock Lock;
+	static TMap<FKey, FCachedKeyPtr> CachedKeys;
+
+	/** Key intervals sampled once this frame, identified by their first key */
+	static TSet<FKey> SampledIntervals;
+
+	static uint64 CacheFrame = 0;
+
+	/** Empties the cache if it was filled during a previous frame. Write lock must be held. */
+	static void ResetIfStale()
+	{
+		if (CacheFrame != GFrameCounter)
+		{
+			CacheFrame = GFrameCounter;
+			CachedKeys.Reset();
+			SampledIntervals.Reset();
+		}
+	}
+
+	static float GetKeyIndices(const FCompressedAnimSequence& CompressedData, float SequenceLength, EAnimInterpolationType Interpolation, float Time, int32& OutKeyIndex0, int32& OutKeyIndex1)
+	{
+		const float RelativePos = SequenceLength > 0.f ? Time / SequenceLength : 0.f;
+		return AnimEncoding::TimeToIndex(SequenceLength, RelativePos, CompressedData.CompressedDataStructure->CompressedNumberOfFrames, Interpolation, OutKeyIndex0, OutKeyIndex1);
+	}
+
+	/** Decompresses every track at the time of a key */
+	static FCachedKeyPtr DecompressKey(const FCompressedAnimSequence& CompressedData, float SequenceLength, EAnimInterpolationType Interpolation, FName SourceName, int32 KeyIndex)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AnimDecompressionCacheFill);
+
+		const int32 NumTracks = CompressedData.CompressedTrackToSkeletonMapTable.Num();
+		const int32 NumFrames = CompressedData.CompressedDataStructure->CompressedNumberOfFrames;
+
+		BoneTrackArray TrackPairs;
+		TrackPairs.Reserve(NumTracks);
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+		{
+			TrackPairs.Add(BoneTrackPair(TrackIndex, TrackIndex));
+		}
+
+		// Scales are only written by codecs when the sequence has scale keys
+		FAnimDecompressedKey* Key = new FAnimDecompressedKey();
+		Key->Atoms.Init(FTransform(FQuat::Identity, FVector::ZeroVector, UnwrittenScale), NumTracks);
+
+		// Sample exactly on the key rather than going through a time, which could round down to the previous key
+		FAnimSequenceDecompressionContext DecompContext(SequenceLength, Interpolation, SourceName, *CompressedData.CompressedDataStructure);
+		DecompContext.RelativePos = NumFrames > 1 ? (float)KeyIndex / (float)(NumFrames - 1) : 0.f;
+		DecompContext.Time = DecompContext.RelativePos * SequenceLength;
+
+		TArrayView<FTransform> AtomsView(Key->Atoms);
+		CompressedData.BoneCompressionCodec->DecompressPose(DecompContext, TrackPairs, TrackPairs, TrackPairs, AtomsView);
+
+		Key->bHasScale = NumTracks > 0 && Key->Atoms[0].GetScale3D() != UnwrittenScale;
+		if (!Key->bHasScale)
+		{
+			for (FTransform& Atom : Key->Atoms)
+			{
+				Atom.SetScale3D(FVector::OneVector);
+			}
+		}
+
+		return FCachedKeyPtr(Key);
+	}
+
+	/** Adds a decompressed key unless another thread added it first, and returns the cached one */
+	static FCachedKeyPtr AddKey(const FKey& Key, const FCachedKeyPtr& Atoms)
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		ResetIfStale();
+
+		if (const FCachedKeyPtr* Existing = CachedKeys.Find(Key))
+		{
+			return *Existing;
+		}
+
+		if (CachedKeys.Num() < GAnimDecompressionCacheMaxKeys)
+		{
+			CachedKeys.Add(Key, Atoms);
+		}
+		return Atoms;
+	}
+}
+
+bool FAnimDecompressionCache::IsEnabled()
+{
+	return GAnimDecompressionCache != 0 && GAnimDecompressionCacheMaxKeys > 0;
+}
+
+bool FAnimDecompressionCache::FindOrDecompressKeys(const FCompressedAnimSequence& CompressedData, float SequenceLength, EAnimInterpolationType Interpolation, FName SourceName, float Time, FAnimDecompressedKeys& OutKeys)
+{
+	using namespace AnimDecompressionCache;
+
+	if (!IsEnabled() || !CompressedData.BoneCompressionCodec || !CompressedData.CompressedDataStructure.IsValid())
+	{
+		return false;
+	}
+
+	int32 KeyIndex0, KeyIndex1;
+	OutKeys.Alpha = GetKeyIndices(CompressedData, SequenceLength, Interpolation, Time, KeyIndex0, KeyIndex1);
+
+	const FKey Key0 = { &CompressedData, KeyIndex0 };
+	const FKey Key1 = { &CompressedData, KeyIndex1 };
+
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+		if (CacheFrame == GFrameCounter)
+		{
+			const FCachedKeyPtr* CachedKey0 = CachedKeys.Find(Key0);
+			const FCachedKeyPtr* CachedKey1 = CachedKeys.Find(Key1);
+			if (CachedKey0 && CachedKey1)
+			{
+				OutKeys.Key0 = *CachedKey0;
+				OutKeys.Key1 = *CachedKey1;
+				INC_DWORD_STAT(STAT_AnimDecompressionCacheHits);
+				return true;
+			}
+		}
+	}
+
+	{
+		// Only the second sampling of an interval fills the cache, sequences sampled once a frame never pay for it
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		ResetIfStale();
+
+		bool bAlreadySampled = false;
+		SampledIntervals.Add(Key0, &bAlreadySampled);
+		if (!bAlreadySampled || CachedKeys.Num() + 2 > GAnimDecompressionCacheMaxKeys)
+		{
+			return false;
+		}
+	}
+
+	OutKeys.Key0 = AddKey(Key0, DecompressKey(CompressedData, SequenceLength, Interpolation, SourceName, KeyIndex0));
+	OutKeys.Key1 = (KeyIndex1 == KeyIndex0) ? OutKeys.Key0 : AddKey(Key1, DecompressKey(CompressedData, SequenceLength, Interpolation, SourceName, KeyIndex1));
+	return true;
+}
+
+void FAnimDecompressionCache::PrefetchKeys(TArrayView<const FAnimDecompressionRequest> Requests)
+{
+	using namespace AnimDecompressionCache;
+
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	// Gather the keys that aren't cached yet, each only once
+	TArray<TPair<FKey, const FAnimDecompressionRequest*>> MissingKeys;
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		ResetIfStale();
+
+		TSet<FKey> Gathered;
+		for (const FAnimDecompressionRequest& Request : Requests)
+		{
+			if (!Request.CompressedData || !Request.CompressedData->BoneCompressionCodec || !Request.CompressedData->CompressedDataStructure.IsValid())
+			{
+				continue;
+			}
+
+			int32 KeyIndices[2];
+			GetKeyIndices(*Request.CompressedData, Request.SequenceLength, Request.Interpolation, Request.Time, KeyIndices[0], KeyIndices[1]);
+			for (const int32 KeyIndex : KeyIndices)
+			{
+				const FKey Key = { Request.CompressedData, KeyIndex };
+				bool bAlreadyGathered = false;
+				Gathered.Add(Key, &bAlreadyGathered);
+				if (!bAlreadyGathered && !CachedKeys.Contains(Key))
+				{
+					MissingKeys.Emplace(Key, &Request);
+				}
+			}
+		}
+
+		MissingKeys.SetNum(FMath::Min(MissingKeys.Num(), FMath::Max(GAnimDecompressionCacheMaxKeys - CachedKeys.Num(), 0)));
+	}
+
+	TArray<FCachedKeyPtr> Decompressed;
+	Decompressed.SetNum(MissingKeys.Num());
+	ParallelFor(MissingKeys.Num(), [&MissingKeys, &Decompressed](int32 Index)
+	{
+		const FAnimDecompressionRequest& Request = *MissingKeys[Index].Value;
+		Decompressed[Index] = DecompressKey(*Request.CompressedData, Request.SequenceLength, Request.Interpolation, Request.SourceName, MissingKeys[Index].Key.KeyIndex);
+	});
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	ResetIfStale();
+	for (int32 Index = 0; Index < MissingKeys.Num(); ++Index)
+	{
+		if (CachedKeys.Num() >= GAnimDecompressionCacheMaxKeys)
+		{
+			break;
+		}
+		CachedKeys.FindOrAdd(MissingKeys[Index].Key, Decompressed[Index]);
+	}
+}
+
+void FAnimDecompressionCache::Flush()
+{
+	using namespace AnimDecompressionCache;
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	CachedKeys.Empty();
+	SampledIntervals.Empty();
+}
@@ -1137,7 +1137,7 @@ int32 UAnimInstance::GetLODLevel() const
 	USkeletalMeshComponent* SkelMeshComp = GetSkelMeshComponent();
 	check(SkelMeshComp)
 
-	return SkelMeshComp->PredictedLODLevel;
+	return SkelMeshComp->GetAnimationLODLevel();
 }
 
 void UAnimInstance::RecalcRequiredBones()
@@ -1301,14 +1301,21 @@ bool UAnimInstance::HasActiveCurves() const
 void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_AnimTriggerAnimNotifies);
+
+	// Most instances have nothing to trigger on most frames
+	if (NotifyQueue.AnimNotifies.Num() == 0 && ActiveAnimNotifyState.Num() == 0)
+	{
+		return;
+	}
+
 	USkeletalMeshComponent* SkelMeshComp = GetSkelMeshComponent();
 
 	// Array that will replace the 'ActiveAnimNotifyState' at the end of this function.
-	TArray<FAnimNotifyEvent> NewActiveAnimNotifyState;
-	NewActiveAnimNotifyState.Reserve(NotifyQueue.AnimNotifies.Num());
+	// Notifies can reenter this function, so these can't be kept on the instance, but only a few states are active at once.
+	TArray<FAnimNotifyEvent, TInlineAllocator<4>> NewActiveAnimNotifyState;
 
 	// AnimNotifyState freshly added that need their 'NotifyBegin' event called.
-	TArray<const FAnimNotifyEvent *> NotifyStateBeginEvent;
+	TArray<const FAnimNotifyEvent *, TInlineAllocator<4>> NotifyStateBeginEvent;
 
 	for (int32 Index=0; Index<NotifyQueue.AnimNotifies.Num(); Index++)
 	{
@@ -1360,8 +1367,9 @@ void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
 		}
 	}
 
-	// Switch our arrays.
-	ActiveAnimNotifyState = MoveTemp(NewActiveAnimNotifyState);
+	// Switch our arrays, reusing the allocation of the active states
+	ActiveAnimNotifyState.Reset(NewActiveAnimNotifyState.Num());
+	ActiveAnimNotifyState.Append(NewActiveAnimNotifyState);
 
 	// Tick currently active AnimNotifyState
 	for(const FAnimNotifyEvent& AnimNotifyEvent : ActiveAnimNotifyState)
@@ -18,6 +18,8 @@
 #include "Animation/AnimSingleNodeInstance.h"
 #include "Engine/Engine.h"
 #include "Animation/AnimTrace.h"
+#include "Animation/AnimStreamable.h"
+#include "Algo/BinarySearch.h"
 
 DEFINE_LOG_CATEGORY(LogAnimMontage);
 
@@ -630,37 +632,26 @@ const FBranchingPointMarker* UAnimMontage::FindFirstBranchingPointMarker(float S
 {
 	if (BranchingPointMarkers.Num() > 0)
 	{
+		// Markers are sorted by trigger time in RefreshBranchingPointMarkers
+		auto GetTriggerTime = [](const FBranchingPointMarker& Marker) { return Marker.TriggerTime; };
+
 		const bool bSearchBackwards = (EndTrackPos < StartTrackPos);
 		if (!bSearchBackwards)
 		{
-			for (int32 Index = 0; Index < BranchingPointMarkers.Num(); Index++)
+			// First marker after StartTrackPos
+			const int32 Index = Algo::UpperBoundBy(BranchingPointMarkers, StartTrackPos, GetTriggerTime);
+			if (Index < BranchingPointMarkers.Num() && BranchingPointMarkers[Index].TriggerTime <= EndTrackPos)
 			{
-				const FBranchingPointMarker& Marker = BranchingPointMarkers[Index];
-				if (Marker.TriggerTime <= StartTrackPos)
-				{
-					continue;
-				}
-				if (Marker.TriggerTime > EndTrackPos)
-				{
-					break;
-				}
-				return &Marker;
+				return &BranchingPointMarkers[Index];
 			}
 		}
 		else
 		{
-			for (int32 Index = BranchingPointMarkers.Num() - 1; Index >= 0; Index--)
+			// Last marker before StartTrackPos
+			const int32 Index = Algo::LowerBoundBy(BranchingPointMarkers, StartTrackPos, GetTriggerTime) - 1;
+			if (Index >= 0 && BranchingPointMarkers[Index].TriggerTime >= EndTrackPos)
 			{
-				const FBranchingPointMarker& Marker = BranchingPointMarkers[Index];
-				if (Marker.TriggerTime >= StartTrackPos)
-				{
-					continue;
-				}
-				if (Marker.TriggerTime < EndTrackPos)
-				{
-					break;
-				}
-				return &Marker;
+				return &BranchingPointMarkers[Index];
 			}
 		}
 	}
@@ -1284,6 +1275,7 @@ FAnimMontageInstance::FAnimMontageInstance()
 	, PreviousPosition(0.f)
 	, SyncGroupIndex(INDEX_NONE)
 	, DisableRootMotionCount(0)
+	, PrefetchedSectionIndex(INDEX_NONE)
 	, MontageSyncLeader(NULL)
 	, MontageSyncUpdateFrameCounter(INDEX_NONE)
 {
@@ -1306,6 +1298,7 @@ FAnimMontageInstance::FAnimMontageInstance(UAnimInstance * InAnimInstance)
 	, PreviousPosition(0.f)
 	, SyncGroupIndex(INDEX_NONE)
 	, DisableRootMotionCount(0)
+	, PrefetchedSectionIndex(INDEX_NONE)
 	, MontageSyncLeader(NULL)
 	, MontageSyncUpdateFrameCounter(INDEX_NONE)
 {
@@ -1325,6 +1318,7 @@ void FAnimMontageInstance::Play(float InPlayRate)
 	Blend.SetBlendTime(Montage->BlendIn.GetBlendTime() * DefaultBlendTimeMultiplier);
 	Blend.SetValueRange(CurrentWeight, 1.f);
 	bEnableAutoBlendOut = Montage->bEnableAutoBlendOut;
+	PrefetchedSectionIndex = INDEX_NONE;
 }
 
 void FAnimMontageInstance::InitializeBlend(const FAlphaBlend& InAlphaBlend)
@@ -1428,6 +1422,39 @@ void FAnimMontageInstance::Initialize(class UAnimMontage * InMontage)
 	}
 }
 
+void FAnimMontageInstance::PrefetchNextSection(int32 SectionIndex, bool bPlayingForward) const
+{
+	if (!NextSections.IsValidIndex(SectionIndex))
+	{
+		return;
+	}
+
+	const int32 NextSectionIndex = bPlayingForward ? NextSections[SectionIndex] : PrevSections[SectionIndex];
+	if (NextSectionIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	float SectionStartTime, SectionEndTime;
+	Montage->GetSectionStartAndEndTime(NextSectionIndex, SectionStartTime, SectionEndTime);
+	const float TrackPosition = bPlayingForward ? SectionStartTime : FMath::Max(SectionEndTime - KINDA_SMALL_NUMBER, SectionStartTime);
+
+	// Characters at lower LODs are less significant
+	const UAnimInstance* Inst = AnimInstance.Get();
+	const float Priority = Inst ? 1.f / (1.f + Inst->GetLODLevel()) : 1.f;
+
+	for (const FSlotAnimationTrack& SlotTrack : Montage->SlotAnimTracks)
+	{
+		if (const FAnimSegment* Segment = SlotTrack.AnimTrack.GetSegmentAtTime(TrackPosition))
+		{
+			if (const UAnimStreamable* StreamableAnim = Cast<UAnimStreamable>(Segment->AnimReference))
+			{
+				StreamableAnim->PrefetchChunksAtTime(Segment->ConvertTrackPosToAnimPos(TrackPosition), Priority);
+			}
+		}
+	}
+}
+
 void FAnimMontageInstance::RefreshNextPrevSections()
 {
 	// initialize next section
@@ -2224,6 +2251,14 @@ void FAnimMontageInstance::Advance(float DeltaTime, struct FRootMotionMovementPa
 				DeltaMoved += SubStepDeltaMove;
 				const bool bPlayingForward = MontageSubStepper.GetbPlayingForward();
 
+				// Request the streamed animations of the next section while playing this one
+				const int32 SubStepSectionIndex = MontageSubStepper.GetCurrentSectionIndex();
+				if (SubStepSectionIndex != PrefetchedSectionIndex)
+				{
+					PrefetchNextSection(SubStepSectionIndex, bPlayingForward);
+					PrefetchedSectionIndex = SubStepSectionIndex;
+				}
+
 				// If current section is last one, check to trigger a blend out and if it hasn't stopped yet, see if we should stop
 				// We check this even if we haven't moved, in case our position was different from last frame.
 				// (Code triggered a position jump).
@@ -2379,8 +2414,8 @@ void FAnimMontageInstance::HandleEvents(float PreviousTrackPos, float CurrentTra
 	// now get active Notifies based on how it advanced
 	if (AnimInstance.IsValid())
 	{
-		TArray<FAnimNotifyEventReference> NotitfyRefs;
-		TMap<FName, TArray<FAnimNotifyEventReference>> NotifyMap;
+		TArray<FAnimNotifyEventReference>& NotitfyRefs = AnimInstance->NotifyQueue.GetScratchNotifies();
+		TMap<FName, TArray<FAnimNotifyEventReference>>& NotifyMap = SlotNotifiesScratch;
 
 		// We already break up AnimMontage update to handle looping, so we guarantee that PreviousPos and CurrentPos are contiguous.
 		Montage->GetAnimNotifiesFromDeltaPositions(PreviousTrackPos, CurrentTrackPos, NotitfyRefs);
@@ -2393,6 +2428,7 @@ void FAnimMontageInstance::HandleEvents(float PreviousTrackPos, float CurrentTra
 		for (auto SlotTrack = Montage->SlotAnimTracks.CreateIterator(); SlotTrack; ++SlotTrack)
 		{
 			TArray<FAnimNotifyEventReference>& MapNotifies = NotifyMap.FindOrAdd(SlotTrack->SlotName);
+			MapNotifies.Reset();
 
 			SlotTrack->AnimTrack.GetAnimNotifiesFromTrackPositions(PreviousTrackPos, CurrentTrackPos, MapNotifies);
 		}
@@ -2432,7 +2468,7 @@ void FAnimMontageInstance::UpdateActiveStateBranchingPoints(float CurrentTrackPo
 				FBranchingPointNotifyPayload BranchingPointNotifyPayload(AnimInstance->GetSkelMeshComponent(), Montage, &NotifyEvent, InstanceID);
 				TRACE_ANIM_NOTIFY(AnimInstance.Get(), NotifyEvent, End);
 				NotifyEvent.NotifyStateClass->BranchingPointNotifyEnd(BranchingPointNotifyPayload);
-				ActiveStateBranchingPoints.RemoveAt(Index, 1);
+				ActiveStateBranchingPoints.RemoveAt(Index, 1, false);
 			}
 		}
 
@@ -343,6 +343,12 @@ void FPoseLinkBase::Update(const FAnimationUpdateContext& Context)
 
 	if (LinkedNode != NULL)
 	{
+		if (FPoseLinkBase* PassThroughLink = LinkedNode->GetActiveLODPassThroughLink(Context.AnimInstanceProxy))
+		{
+			PassThroughLink->Update(Context);
+			return;
+		}
+
 #if ANIM_TRACE_ENABLED
 		{
 			FAnimationUpdateContext LinkContext(Context.WithNodeId(LinkID));
@@ -391,6 +397,12 @@ void FPoseLink::Evaluate(FPoseContext& Output)
 
 	if (LinkedNode != NULL)
 	{
+		if (FPoseLinkBase* PassThroughLink = LinkedNode->GetActiveLODPassThroughLink(Output.AnimInstanceProxy))
+		{
+			static_cast<FPoseLink*>(PassThroughLink)->Evaluate(Output);
+			return;
+		}
+
 #if ENABLE_ANIMNODE_POSE_DEBUG
 		CurrentPose.ResetToAdditiveIdentity();
 #endif
@@ -467,6 +479,12 @@ void FComponentSpacePoseLink::EvaluateComponentSpace(FComponentSpacePoseContext&
 
 	if (LinkedNode != NULL)
 	{
+		if (FPoseLinkBase* PassThroughLink = LinkedNode->GetActiveLODPassThroughLink(Output.AnimInstanceProxy))
+		{
+			static_cast<FComponentSpacePoseLink*>(PassThroughLink)->EvaluateComponentSpace(Output);
+			return;
+		}
+
 		{
 #if ANIM_TRACE_ENABLED
 			Output.SetNodeId(LinkID);
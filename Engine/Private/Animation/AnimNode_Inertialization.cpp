@@ -398,6 +398,9 @@ void FInertializationPoseDiff::InitFrom(const FCompactPose& Pose, const FBlended
 
 	const FQuat ComponentTransform_GetRotation_Inverse = ComponentTransform.GetRotation().Inverse();
 
+	// The decay curves are computed from the new differences once they're applied
+	CoefficientsDuration = -1.0f;
+
 	// Determine if we should initialize in local space (the default) or in world space (for situations where we wish to correct
 	// a world-space discontinuity such as an abrupt orientation change)
 	InertializationSpace = EInertializationSpace::Default;
@@ -420,7 +423,7 @@ void FInertializationPoseDiff::InitFrom(const FCompactPose& Pose, const FBlended
 	// Compute the inertialization differences for each bone
 	const FReferenceSkeleton& RefSkeleton = BoneContainer.GetSkeletonAsset()->GetReferenceSkeleton();
 	const int32 NumSkeletonBones = RefSkeleton.GetNum();
-	BoneDiffs.Empty(NumSkeletonBones);
+	BoneDiffs.Reset(NumSkeletonBones);
 	BoneDiffs.AddZeroed(NumSkeletonBones);
 	for (FCompactPoseBoneIndex BoneIndex : Pose.ForEachBoneIndex())
 	{
@@ -563,7 +566,7 @@ void FInertializationPoseDiff::InitFrom(const FCompactPose& Pose, const FBlended
 
 	// Compute the curve differences
 	const int32 CurveNum = Curves.IsValid() ? Curves.UIDToArrayIndexLUT->Num() : 0;
-	CurveDiffs.Empty(CurveNum);
+	CurveDiffs.Reset(CurveNum);
 	CurveDiffs.AddZeroed(CurveNum);
 	for (int32 CurveUID = 0; CurveUID != CurveNum; ++CurveUID)
 	{
@@ -599,6 +602,11 @@ void FInertializationPoseDiff::ApplyTo(FCompactPose& Pose, FBlendedCurve& Curves
 {
 	const FBoneContainer& BoneContainer = Pose.GetBoneContainer();
 
+	// Evaluate the decay of every bone and curve at once
+	UpdateCoefficients(InertializationDuration);
+	Coefficients.Evaluate(InertializationElapsedTime, DecayedValues);
+	const int32 NumBoneDiffs = BoneDiffs.Num();
+
 	// Apply pose difference
 	for (FCompactPoseBoneIndex BoneIndex : Pose.ForEachBoneIndex())
 	{
@@ -607,20 +615,18 @@ void FInertializationPoseDiff::ApplyTo(FCompactPose& Pose, FBlendedCurve& Curves
 		if (SkeletonPoseBoneIndex != INDEX_NONE)
 		{
 			const FInertializationBoneDiff& BoneDiff = BoneDiffs[SkeletonPoseBoneIndex];
+			const float* BoneDecayedValues = &DecayedValues[SkeletonPoseBoneIndex * 3];
 
 			// Apply the bone translation difference
-			const FVector T = BoneDiff.TranslationDirection *
-				CalcInertialFloat(BoneDiff.TranslationMagnitude, BoneDiff.TranslationSpeed, InertializationElapsedTime, InertializationDuration);
+			const FVector T = BoneDiff.TranslationDirection * BoneDecayedValues[0];
 			Pose[BoneIndex].AddToTranslation(T);
 
 			// Apply the bone rotation difference
-			const FQuat Q = FQuat(BoneDiff.RotationAxis,
-				CalcInertialFloat(BoneDiff.RotationAngle, BoneDiff.RotationSpeed, InertializationElapsedTime, InertializationDuration));
+			const FQuat Q = FQuat(BoneDiff.RotationAxis, BoneDecayedValues[1]);
 			Pose[BoneIndex].SetRotation(Q * Pose[BoneIndex].GetRotation());
 
 			// Apply the bone scale difference
-			const FVector S = BoneDiff.ScaleAxis *
-				CalcInertialFloat(BoneDiff.ScaleMagnitude, BoneDiff.ScaleSpeed, InertializationElapsedTime, InertializationDuration);
+			const FVector S = BoneDiff.ScaleAxis * BoneDecayedValues[2];
 			Pose[BoneIndex].SetScale3D(S + Pose[BoneIndex].GetScale3D());
 		}
 	}
@@ -641,8 +647,7 @@ void FInertializationPoseDiff::ApplyTo(FCompactPose& Pose, FBlendedCurve& Curves
 			}
 
 			FCurveElement& CurrElement = Curves.Elements[CurrIdx];
-			const FInertializationCurveDiff& CurveDiff = CurveDiffs[CurveUID];
-			const float C = CalcInertialFloat(CurveDiff.Delta, CurveDiff.Derivative, InertializationElapsedTime, InertializationDuration);
+			const float C = DecayedValues[NumBoneDiffs * 3 + CurveUID];
 			if (C != 0.0f)
 			{
 				CurrElement.Value += C;
@@ -669,9 +674,6 @@ void FInertializationPoseDiff::ApplyTo(FCompactPose& Pose, FBlendedCurve& Curves
 //
 float FInertializationPoseDiff::CalcInertialFloat(float x0, float v0, float t, float t1)
 {
-	static_assert(INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON > FLT_MIN,
-		"INERTIALIZATION_TIME_EPSILON^5 must be greater than FLT_MIN to avoid denormalization (and potential division by zero) for very small values of t1");
-
 	if (t < 0.0f)
 	{
 		t = 0.0f;
@@ -682,6 +684,22 @@ float FInertializationPoseDiff::CalcInertialFloat(float x0, float v0, float t, f
 		return 0.0f;
 	}
 
+	float A, B, C, D;
+	CalcInertialCoefficients(x0, v0, t1, A, B, C, D, v0, x0, t1);
+
+	if (t >= t1 - INERTIALIZATION_TIME_EPSILON)
+	{
+		return 0.0f;
+	}
+
+	return (((((A*t) + B)*t + C)*t + D)*t + v0)*t + x0;
+}
+
+void FInertializationPoseDiff::CalcInertialCoefficients(float x0, float v0, float t1, float& OutA, float& OutB, float& OutC, float& OutD, float& OutV0, float& OutX0, float& OutT1)
+{
+	static_assert(INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON * INERTIALIZATION_TIME_EPSILON > FLT_MIN,
+		"INERTIALIZATION_TIME_EPSILON^5 must be greater than FLT_MIN to avoid denormalization (and potential division by zero) for very small values of t1");
+
 	// Assume that x0 >= 0... if this is not the case, then simply invert everything (both input and output)
 	float sign = 1.0f;
 	if (x0 < 0.0f)
@@ -699,7 +717,6 @@ float FInertializationPoseDiff::CalcInertialFloat(float x0, float v0, float t, f
 
 	check(x0 >= 0.0f);
 	check(v0 <= 0.0f);
-	check(t >= 0.0f);
 	check(t1 >= 0.0f);
 
 	// Limit t1 such that the curve does not overshoot below zero (ensuring that x >= 0 for all t between 0 and t1).
@@ -725,9 +742,13 @@ float FInertializationPoseDiff::CalcInertialFloat(float x0, float v0, float t, f
 		t1 = FMath::Min(t1, -5.0f * x0 / v0);
 	}
 
-	if (t >= t1 - INERTIALIZATION_TIME_EPSILON)
+	OutT1 = t1;
+
+	// The curve is zero from the start, don't divide by t1
+	if (t1 <= INERTIALIZATION_TIME_EPSILON)
 	{
-		return 0.0f;
+		OutA = OutB = OutC = OutD = OutV0 = OutX0 = 0.0f;
+		return;
 	}
 
 	const float t1_2 = t1 * t1;
@@ -774,9 +795,93 @@ float FInertializationPoseDiff::CalcInertialFloat(float x0, float v0, float t, f
 	const float C = -0.5f * (3.0f*a0*t1_2 + 12.0f*t1*v0 + 20.0f*x0) / t1_3;
 	const float D =  0.5f * a0;
 
-	const float x = (((((A*t) + B)*t + C)*t + D)*t + v0)*t + x0;
+	// The curve is linear in its coefficients, flip them rather than the result
+	OutA = A * sign;
+	OutB = B * sign;
+	OutC = C * sign;
+	OutD = D * sign;
+	OutV0 = v0 * sign;
+	OutX0 = x0 * sign;
+}
+
+void FInertializationPoseDiff::UpdateCoefficients(float InertializationDuration) const
+{
+	if (CoefficientsDuration == InertializationDuration)
+	{
+		return;
+	}
+
+	const int32 NumBoneDiffs = BoneDiffs.Num();
+	Coefficients.SetNum(NumBoneDiffs * 3 + CurveDiffs.Num());
 
-	return x * sign;
+	for (int32 BoneIndex = 0; BoneIndex < NumBoneDiffs; ++BoneIndex)
+	{
+		const FInertializationBoneDiff& BoneDiff = BoneDiffs[BoneIndex];
+		Coefficients.Set(BoneIndex * 3 + 0, BoneDiff.TranslationMagnitude, BoneDiff.TranslationSpeed, InertializationDuration);
+		Coefficients.Set(BoneIndex * 3 + 1, BoneDiff.RotationAngle, BoneDiff.RotationSpeed, InertializationDuration);
+		Coefficients.Set(BoneIndex * 3 + 2, BoneDiff.ScaleMagnitude, BoneDiff.ScaleSpeed, InertializationDuration);
+	}
+
+	for (int32 CurveUID = 0; CurveUID < CurveDiffs.Num(); ++CurveUID)
+	{
+		const FInertializationCurveDiff& CurveDiff = CurveDiffs[CurveUID];
+		Coefficients.Set(NumBoneDiffs * 3 + CurveUID, CurveDiff.Delta, CurveDiff.Derivative, InertializationDuration);
+	}
+
+	CoefficientsDuration = InertializationDuration;
+}
+
+void FInertializationPoseDiff::FInertialCoefficients::SetNum(int32 Num)
+{
+	A.SetNumUninitialized(Num, false);
+	B.SetNumUninitialized(Num, false);
+	C.SetNumUninitialized(Num, false);
+	D.SetNumUninitialized(Num, false);
+	V0.SetNumUninitialized(Num, false);
+	X0.SetNumUninitialized(Num, false);
+	T1.SetNumUninitialized(Num, false);
+}
+
+void FInertializationPoseDiff::FInertialCoefficients::Set(int32 Index, float x0, float v0, float t1)
+{
+	CalcInertialCoefficients(x0, v0, t1, A[Index], B[Index], C[Index], D[Index], V0[Index], X0[Index], T1[Index]);
+}
+
+// Same as CalcInertialFloat for every curve, 4 curves at a time
+//
+void FInertializationPoseDiff::FInertialCoefficients::Evaluate(float t, TArray<float>& OutValues) const
+{
+	if (t < 0.0f)
+	{
+		t = 0.0f;
+	}
+
+	const int32 Num = T1.Num();
+	OutValues.SetNumUninitialized(Num, false);
+
+	const VectorRegister VectorT = VectorSetFloat1(t);
+	const VectorRegister VectorEpsilon = VectorSetFloat1(INERTIALIZATION_TIME_EPSILON);
+
+	int32 Index = 0;
+	for (; Index + 4 <= Num; Index += 4)
+	{
+		VectorRegister X = VectorLoad(&A[Index]);
+		X = VectorMultiplyAdd(X, VectorT, VectorLoad(&B[Index]));
+		X = VectorMultiplyAdd(X, VectorT, VectorLoad(&C[Index]));
+		X = VectorMultiplyAdd(X, VectorT, VectorLoad(&D[Index]));
+		X = VectorMultiplyAdd(X, VectorT, VectorLoad(&V0[Index]));
+		X = VectorMultiplyAdd(X, VectorT, VectorLoad(&X0[Index]));
+
+		// Zero once t reaches the end of the curve
+		const VectorRegister Active = VectorCompareGT(VectorSubtract(VectorLoad(&T1[Index]), VectorEpsilon), VectorT);
+		VectorStore(VectorSelect(Active, X, VectorZero()), &OutValues[Index]);
+	}
+
+	for (; Index < Num; ++Index)
+	{
+		OutValues[Index] = (t >= T1[Index] - INERTIALIZATION_TIME_EPSILON) ? 0.0f :
+			(((((A[Index]*t) + B[Index])*t + C[Index])*t + D[Index])*t + V0[Index])*t + X0[Index];
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "Animation/AnimNode_LinkedAnimLayer.h"
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimTrace.h"
+#include "Animation/AnimStreamable.h"
 
 #if WITH_EDITORONLY_DATA
 #include "Animation/AnimBlueprintGeneratedClass.h"
@@ -267,6 +268,8 @@ void FAnimNode_StateMachine::Initialize_AnyThread(const FAnimationInitializeCont
 				}
 			}
 
+			CompileTransitionRules(Context);
+
 			// Reset transition related variables
 			StatesUpdated.Reset();
 			ActiveTransitionArray.Reset();
@@ -342,6 +345,54 @@ const FAnimationTransitionBetweenStates& FAnimNode_StateMachine::GetTransitionIn
 	return PRIVATE_MachineDescription->Transitions[TransIndex];
 }
 
+void FAnimNode_StateMachine::PrefetchStreamedTransitionTargets(const FAnimationUpdateContext& Context)
+{
+	// Characters at lower LODs are less significant
+	const float Priority = 1.0f / (1.0f + Context.AnimInstanceProxy->GetLODLevel());
+
+	TArray<int32, TInlineAllocator<8>> StatesToVisit;
+	TArray<int32, TInlineAllocator<8>> VisitedStates;
+	StatesToVisit.Add(CurrentState);
+	VisitedStates.Add(CurrentState);
+
+	while (StatesToVisit.Num() > 0)
+	{
+		const FBakedAnimationState& StateInfo = GetStateInfo(StatesToVisit.Pop(false));
+		for (const FBakedStateExitTransition& Transition : StateInfo.Transitions)
+		{
+			if (!IsValidTransitionIndex(Transition.TransitionIndex))
+			{
+				continue;
+			}
+
+			const int32 NextState = GetTransitionInfo(Transition.TransitionIndex).NextState;
+			if (VisitedStates.Contains(NextState))
+			{
+				continue;
+			}
+			VisitedStates.Add(NextState);
+
+			if (IsAConduitState(NextState))
+			{
+				StatesToVisit.Add(NextState);
+				continue;
+			}
+
+			// States are entered at the start of their animations
+			for (const int32 PlayerIndex : GetStateInfo(NextState).PlayerNodeIndices)
+			{
+				if (FAnimNode_AssetPlayerBase* Player = Context.AnimInstanceProxy->GetNodeFromIndex<FAnimNode_AssetPlayerBase>(PlayerIndex))
+				{
+					if (const UAnimStreamable* StreamableAnim = Cast<UAnimStreamable>(Player->GetAnimAsset()))
+					{
+						StreamableAnim->PrefetchChunksAtTime(0.0f, Priority);
+					}
+				}
+			}
+		}
+	}
+}
+
 void FAnimNode_StateMachine::LogInertializationRequestError(const FAnimationUpdateContext& Context, int32 PreviousState, int32 NextState)
 {
 #if WITH_EDITORONLY_DATA
@@ -357,6 +408,8 @@ void FAnimNode_StateMachine::LogInertializationRequestError(const FAnimationUpda
 
 // Temporarily turned off while we track down and fix https://jira.ol.epicgames.net/browse/OR-17066
 TAutoConsoleVariable<int32> CVarAnimStateMachineRelevancyReset(TEXT("a.AnimNode.StateMachine.EnableRelevancyReset"), 1, TEXT("Reset State Machine when it becomes relevant"));
+TAutoConsoleVariable<int32> CVarAnimStateMachineCompiledTransitions(TEXT("a.AnimNode.StateMachine.CompiledTransitions"), 1, TEXT("Find transitions with the rules resolved when the state machine is initialized. Rules that only read a bool variable are evaluated without running their graph"));
+TAutoConsoleVariable<float> CVarAnimStateMachineStreamingPrefetchInterval(TEXT("a.AnimNode.StateMachine.StreamingPrefetchInterval"), 10.0f, TEXT("Seconds between requests for the streamed animations of the states the current state can transition to, 0 disables prefetching. Should be shorter than a.Streaming.PrefetchLifetime"));
 
 void FAnimNode_StateMachine::Update_AnyThread(const FAnimationUpdateContext& Context)
 {
@@ -423,7 +476,14 @@ void FAnimNode_StateMachine::Update_AnyThread(const FAnimationUpdateContext& Con
 			// Evaluate possible transitions out of this state
 			//@TODO: Evaluate if a set is better than an array for the probably low N encountered here
 			TArray<int32, TInlineAllocator<4>> VisitedStateIndices;
-			FindValidTransition(Context, GetStateInfo(), /*Out*/ PotentialTransition, /*Out*/ VisitedStateIndices);
+			if (CompiledStates.Num() > 0 && CVarAnimStateMachineCompiledTransitions.GetValueOnAnyThread() != 0)
+			{
+				FindValidCompiledTransition(Context, CurrentState, /*Out*/ PotentialTransition, /*Out*/ VisitedStateIndices);
+			}
+			else
+			{
+				FindValidTransition(Context, GetStateInfo(), /*Out*/ PotentialTransition, /*Out*/ VisitedStateIndices);
+			}
 		}
 				
 		// If transition is valid and not waiting on other conditions
@@ -504,6 +564,19 @@ void FAnimNode_StateMachine::Update_AnyThread(const FAnimationUpdateContext& Con
 		bFirstUpdate = false;
 	}
 
+	// Request streamed animations of the states we may move to next, so they're loaded by the time we transition
+	const float PrefetchInterval = CVarAnimStateMachineStreamingPrefetchInterval.GetValueOnAnyThread();
+	if (PrefetchInterval > 0.0f)
+	{
+		PrefetchTimer -= Context.GetDeltaTime();
+		if (PrefetchedState != CurrentState || PrefetchTimer <= 0.0f)
+		{
+			PrefetchStreamedTransitionTargets(Context);
+			PrefetchedState = CurrentState;
+			PrefetchTimer = PrefetchInterval;
+		}
+	}
+
 	StatesUpdated.Reset();
 
 	// Tick the individual state/states that are active
@@ -722,6 +795,179 @@ bool FAnimNode_StateMachine::FindValidTransition(const FAnimationUpdateContext&
 	return false;
 }
 
+bool FAnimNode_StateMachine::FindValidCompiledTransition(const FAnimationUpdateContext& Context, int32 StateIndex, /*out*/ FAnimationPotentialTransition& OutPotentialTransition, /*out*/ TArray<int32, TInlineAllocator<4>>& OutVisitedStateIndices)
+{
+	if (OutVisitedStateIndices.Contains(StateIndex))
+	{
+		return false;
+	}
+	OutVisitedStateIndices.Add(StateIndex);
+
+	const FBakedAnimationState& StateInfo = GetStateInfo(StateIndex);
+	const FAnimationCompiledState& CompiledState = CompiledStates[StateIndex];
+
+	// Conduits can only be entered if their entry rule passes
+	if (CompiledState.EntryRule.ResultNode && !EvaluateCompiledTransitionRule(Context, CompiledState.EntryRule, StateInfo))
+	{
+		return false;
+	}
+
+	const FAnimationCompiledTransitionRule* Rules = CompiledTransitionRules.GetData() + CompiledState.FirstTransitionRule;
+	for (int32 RuleIndex = 0; RuleIndex < CompiledState.NumTransitionRules; ++RuleIndex)
+	{
+		const FAnimationCompiledTransitionRule& Rule = Rules[RuleIndex];
+		if (EvaluateCompiledTransitionRule(Context, Rule, StateInfo) != Rule.TransitionRule->bDesiredTransitionReturnValue)
+		{
+			continue;
+		}
+
+		if (Rule.bNextStateIsConduit)
+		{
+			if (FindValidCompiledTransition(Context, Rule.NextState, /*out*/ OutPotentialTransition, /*out*/ OutVisitedStateIndices))
+			{
+				OutPotentialTransition.SourceTransitionIndices.Add(Rule.TransitionRule->TransitionIndex);
+				return true;
+			}
+		}
+		else
+		{
+			OutPotentialTransition.Clear();
+			OutPotentialTransition.TransitionRule = Rule.TransitionRule;
+			OutPotentialTransition.TargetState = Rule.NextState;
+			OutPotentialTransition.SourceTransitionIndices.Add(Rule.TransitionRule->TransitionIndex);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FAnimNode_StateMachine::EvaluateCompiledTransitionRule(const FAnimationUpdateContext& Context, const FAnimationCompiledTransitionRule& Rule, const FBakedAnimationState& StateInfo)
+{
+	FAnimNode_TransitionResult* ResultNode = Rule.ResultNode;
+
+	// Native rules can be bound at any time and always take precedence
+	if (ResultNode->NativeTransitionDelegate.IsBound())
+	{
+		ResultNode->bCanEnterTransition = ResultNode->NativeTransitionDelegate.Execute();
+		return ResultNode->bCanEnterTransition;
+	}
+
+	switch (Rule.Kind)
+	{
+	case FAnimationCompiledTransitionRule::EKind::BoolProperty:
+		// Still written to the result node so the rule shows up as usual when debugging
+		ResultNode->bCanEnterTransition = Rule.SourceProperty->GetPropertyValue(Rule.SourceAddr) != Rule.bNegateSource;
+		break;
+	case FAnimationCompiledTransitionRule::EKind::RemainingTime:
+		{
+			bool bCanEnterTransition = false;
+			if (FAnimNode_AssetPlayerBase* RelevantPlayer = GetRelevantAssetPlayerFromState(Context, StateInfo))
+			{
+				if (UAnimationAsset* AnimAsset = RelevantPlayer->GetAnimAsset())
+				{
+					const float AnimTimeRemaining = AnimAsset->GetMaxCurrentTime() - RelevantPlayer->GetAccumulatedTime();
+					const FAnimationTransitionBetweenStates& TransitionInfo = GetTransitionInfo(Rule.TransitionRule->TransitionIndex);
+					bCanEnterTransition = (AnimTimeRemaining <= TransitionInfo.CrossfadeDuration);
+				}
+			}
+			ResultNode->bCanEnterTransition = bCanEnterTransition;
+		}
+		break;
+	default:
+		ResultNode->GetEvaluateGraphExposedInputs().Execute(Context);
+		break;
+	}
+
+	return ResultNode->bCanEnterTransition;
+}
+
+void FAnimNode_StateMachine::CompileTransitionRules(const FAnimationBaseContext& Context)
+{
+	CompiledStates.Reset();
+	CompiledTransitionRules.Reset();
+
+	const FBakedAnimationStateMachine* Machine = GetMachineDescription();
+	if (Machine == nullptr)
+	{
+		return;
+	}
+
+	UObject* AnimInstanceObject = Context.AnimInstanceProxy->GetAnimInstanceObject();
+	const IAnimClassInterface* AnimBlueprintClass = Context.GetAnimClass();
+
+	auto CompileRule = [&Context, AnimInstanceObject, AnimBlueprintClass](int32 ResultNodeIndex, FAnimationCompiledTransitionRule& OutRule)
+	{
+		OutRule.ResultNode = GetNodeFromPropertyIndex<FAnimNode_TransitionResult>(AnimInstanceObject, AnimBlueprintClass, ResultNodeIndex);
+		if (OutRule.ResultNode == nullptr)
+		{
+			return false;
+		}
+
+		if (OutRule.TransitionRule && OutRule.TransitionRule->bAutomaticRemainingTimeRule)
+		{
+			OutRule.Kind = FAnimationCompiledTransitionRule::EKind::RemainingTime;
+			return true;
+		}
+
+		// A rule graph made of a single bool variable has no function to run, only the copy of the variable to the result
+		const FExposedValueHandler& Handler = OutRule.ResultNode->GetEvaluateGraphExposedInputs();
+		if (Handler.Function == nullptr && Handler.CopyRecords.Num() == 1)
+		{
+			const FExposedValueCopyRecord& CopyRecord = Handler.CopyRecords[0];
+			const FProperty* SourceProperty = CopyRecord.CachedSourceStructSubProperty != nullptr ? CopyRecord.CachedSourceStructSubProperty.Get() : CopyRecord.CachedSourceProperty.Get();
+			const FProperty* DestProperty = CopyRecord.DestProperty.Get();
+
+			if (CopyRecord.CopyType == ECopyType::BoolProperty && !CopyRecord.bInstanceIsTarget &&
+				DestProperty && DestProperty->GetFName() == GET_MEMBER_NAME_CHECKED(FAnimNode_TransitionResult, bCanEnterTransition) &&
+				CastField<FBoolProperty>(SourceProperty) && !CastField<FArrayProperty>(CopyRecord.CachedSourceProperty.Get()))
+			{
+				OutRule.Kind = FAnimationCompiledTransitionRule::EKind::BoolProperty;
+				OutRule.SourceProperty = CastField<FBoolProperty>(SourceProperty);
+				OutRule.SourceAddr = CopyRecord.GetSourceAddr(Context.AnimInstanceProxy);
+				OutRule.bNegateSource = CopyRecord.PostCopyOperation == EPostCopyOperation::LogicalNegateBool;
+			}
+		}
+		return true;
+	};
+
+	CompiledStates.SetNum(Machine->States.Num());
+	for (int32 StateIndex = 0; StateIndex < Machine->States.Num(); ++StateIndex)
+	{
+		const FBakedAnimationState& State = Machine->States[StateIndex];
+		FAnimationCompiledState& CompiledState = CompiledStates[StateIndex];
+
+		if (State.EntryRuleNodeIndex != INDEX_NONE)
+		{
+			CompileRule(State.EntryRuleNodeIndex, CompiledState.EntryRule);
+		}
+
+		CompiledState.FirstTransitionRule = CompiledTransitionRules.Num();
+		for (const FBakedStateExitTransition& TransitionRule : State.Transitions)
+		{
+			if (TransitionRule.CanTakeDelegateIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			FAnimationCompiledTransitionRule Rule;
+			Rule.TransitionRule = &TransitionRule;
+			Rule.NextState = GetTransitionInfo(TransitionRule.TransitionIndex).NextState;
+			Rule.bNextStateIsConduit = GetStateInfo(Rule.NextState).bIsAConduit;
+
+			if (!CompileRule(TransitionRule.CanTakeDelegateIndex, Rule))
+			{
+				// Leave the machine uncompiled rather than evaluating a partial set of rules
+				CompiledStates.Reset();
+				CompiledTransitionRules.Reset();
+				return;
+			}
+			CompiledTransitionRules.Add(Rule);
+		}
+		CompiledState.NumTransitionRules = CompiledTransitionRules.Num() - CompiledState.FirstTransitionRule;
+	}
+}
+
 void FAnimNode_StateMachine::UpdateTransitionStates(const FAnimationUpdateContext& Context, FAnimationActiveTransitionEntry& Transition)
 {
 	if (Transition.bActive)
@@ -91,7 +91,7 @@ void FAnimNotifyQueue::AddAnimNotifies(bool bSrcIsLeader, const TMap<FName, TArr
 void FAnimNotifyQueue::Reset(USkeletalMeshComponent* Component)
 {
 	AnimNotifies.Reset();
-	UnfilteredMontageAnimNotifies.Reset();
+	ResetMontageAnimNotifies();
 	PredictedLODLevel = Component ? Component->PredictedLODLevel : -1;
 }
 
@@ -116,5 +116,14 @@ void FAnimNotifyQueue::ApplyMontageNotifies(const FAnimInstanceProxy& Proxy)
 			AddAnimNotifiesToDestNoFiltering(Pair.Value.Notifies, AnimNotifies);
 		}
 	}
-	UnfilteredMontageAnimNotifies.Reset();
+	ResetMontageAnimNotifies();
+}
+
+void FAnimNotifyQueue::ResetMontageAnimNotifies()
+{
+	// Slots are few and the same every frame, keep their arrays rather than reallocating them
+	for (TPair<FName, FAnimNotifyArray>& Pair : UnfilteredMontageAnimNotifies)
+	{
+		Pair.Value.Notifies.Reset();
+	}
 }
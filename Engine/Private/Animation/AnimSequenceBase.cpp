@@ -753,7 +753,7 @@ void UAnimSequenceBase::Serialize(FArchive& Ar)
 void UAnimSequenceBase::HandleAssetPlayerTickedInternal(FAnimAssetTickContext &Context, const float PreviousTime, const float MoveDelta, const FAnimTickRecord &Instance, struct FAnimNotifyQueue& NotifyQueue) const
 {
 	// Harvest and record notifies
-	TArray<FAnimNotifyEventReference> AnimNotifies;
+	TArray<FAnimNotifyEventReference>& AnimNotifies = NotifyQueue.GetScratchNotifies();
 	GetAnimNotifies(PreviousTime, MoveDelta, Instance.bLooping, AnimNotifies);
 	NotifyQueue.AddAnimNotifies(Context.ShouldGenerateNotifies(),AnimNotifies, Instance.EffectiveBlendWeight);
 }
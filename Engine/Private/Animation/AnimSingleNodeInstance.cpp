@@ -352,7 +352,7 @@ void UAnimSingleNodeInstance::SetPositionWithPreviousTime(float InPosition, floa
 		{
 			NotifyQueue.Reset(GetSkelMeshComponent());
 
-			TArray<FAnimNotifyEventReference> Notifies;
+			TArray<FAnimNotifyEventReference>& Notifies = NotifyQueue.GetScratchNotifies();
 			SequenceBase->GetAnimNotifiesFromDeltaPositions(InPreviousTime, Proxy.GetCurrentTime(), Notifies);
 			if ( Notifies.Num() > 0 )
 			{
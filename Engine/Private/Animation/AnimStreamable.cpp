@@ -411,6 +411,24 @@ int32 UAnimStreamable::GetChunkIndexForTime(const TArray<FAnimStreamableChunk>&
 	return Chunks.Num() - 1;
 }
 
+void UAnimStreamable::PrefetchChunksAtTime(float Time, float Priority) const
+{
+	if (!HasRunningPlatformData())
+	{
+		return;
+	}
+
+	const TArray<FAnimStreamableChunk>& Chunks = GetRunningPlatformData().Chunks;
+	const int32 ChunkIndex = GetChunkIndexForTime(Chunks, Time);
+	if (ChunkIndex != INDEX_NONE)
+	{
+		// Playback requests the chunk after the one it plays, so prefetch both like it would
+		IAnimationStreamingManager& StreamingManager = IStreamingManager::Get().GetAnimationStreamingManager();
+		StreamingManager.PrefetchChunk(this, ChunkIndex, Priority);
+		StreamingManager.PrefetchChunk(this, (ChunkIndex + 1) % Chunks.Num(), Priority);
+	}
+}
+
 #if WITH_EDITOR
 void UAnimStreamable::InitFrom(const UAnimSequence* InSourceSequence)
 {
@@ -17,7 +17,28 @@ FAutoConsoleVariableRef CVarSpoofFailedAnimationChunkLoad(
 	TEXT("0: Not Enabled, 1: Enabled"),
 	ECVF_Default);
 
+static float PrefetchAnimationChunkBudgetMB = 16.f;
+FAutoConsoleVariableRef CVarPrefetchAnimationChunkBudget(
+	TEXT("a.Streaming.PrefetchBudgetMB"),
+	PrefetchAnimationChunkBudgetMB,
+	TEXT("Memory in megabytes that streamed animation chunks prefetched ahead of playback can use.\n")
+	TEXT("0 disables prefetching."),
+	ECVF_Default);
+
+static float PrefetchAnimationChunkLifetime = 30.f;
+FAutoConsoleVariableRef CVarPrefetchAnimationChunkLifetime(
+	TEXT("a.Streaming.PrefetchLifetime"),
+	PrefetchAnimationChunkLifetime,
+	TEXT("Seconds a prefetched animation chunk stays loaded after it was last requested."),
+	ECVF_Default);
 
+static int32 PrefetchAnimationChunkLowIOPriority = 1;
+FAutoConsoleVariableRef CVarPrefetchAnimationChunkLowIOPriority(
+	TEXT("a.Streaming.PrefetchLowIOPriority"),
+	PrefetchAnimationChunkLowIOPriority,
+	TEXT("Whether chunks that are only prefetched are read with the low priority of texture and mesh streaming instead of the critical path priority of chunks needed by playback.\n")
+	TEXT("Keeps prefetching from starving render asset streaming, e.g. during level transitions."),
+	ECVF_Default);
 
 void FLoadedAnimationChunk::CleanUpIORequest()
 {
@@ -115,6 +136,13 @@ bool FStreamingAnimationData::UpdateStreamingStatus()
 
 	LoadFailedChunks.Reset();
 
+	// Prefetched chunks are kept loaded as if playback had requested them
+	const int32 NumPlaybackRequestedChunks = RequestedChunks.Num();
+	for (const FPrefetchedAnimationChunk& PrefetchedChunk : PrefetchedChunks)
+	{
+		RequestedChunks.AddUnique(PrefetchedChunk.Index);
+	}
+
 	bool bHasPendingRequestInFlight = false;
 
 	TArray<uint32> IndicesToLoad;
@@ -138,7 +166,7 @@ bool FStreamingAnimationData::UpdateStreamingStatus()
 
 		LoadedChunkIndices = RequestedChunks;
 
-		BeginPendingRequests(IndicesToLoad, IndicesToFree);
+		BeginPendingRequests(IndicesToLoad, IndicesToFree, NumPlaybackRequestedChunks);
 	}
 
 	ResetRequestedChunks();
@@ -172,7 +200,7 @@ bool FStreamingAnimationData::HasPendingRequests(TArray<uint32>& IndicesToLoad,
 	return IndicesToLoad.Num() > 0 || IndicesToFree.Num() > 0;
 }
 
-void FStreamingAnimationData::BeginPendingRequests(const TArray<uint32>& IndicesToLoad, const TArray<uint32>& IndicesToFree)
+void FStreamingAnimationData::BeginPendingRequests(const TArray<uint32>& IndicesToLoad, const TArray<uint32>& IndicesToFree, int32 NumPlaybackRequestedChunks)
 {
 	TArray<uint32> FreeChunkIndices;
 
@@ -197,10 +225,14 @@ void FStreamingAnimationData::BeginPendingRequests(const TArray<uint32>& Indices
 
 	// Set off all IO Requests
 
-	const EAsyncIOPriorityAndFlags AsyncIOPriority = AIOP_CriticalPath; //Set to Crit temporarily as emergency speculative fix for streaming issue
+	const EAsyncIOPriorityAndFlags PlaybackIOPriority = AIOP_CriticalPath; //Set to Crit temporarily as emergency speculative fix for streaming issue
 
 	for (uint32 ChunkIndex : IndicesToLoad)
 	{
+		// Chunks only needed ahead of playback compete with texture and mesh streaming like their non prioritized requests.
+		const bool bIsPrefetchOnly = RequestedChunks.IndexOfByKey(ChunkIndex) >= NumPlaybackRequestedChunks;
+		const EAsyncIOPriorityAndFlags AsyncIOPriority = bIsPrefetchOnly && PrefetchAnimationChunkLowIOPriority ? AIOP_Low : PlaybackIOPriority;
+
 		const FAnimStreamableChunk& Chunk = StreamableAnim->GetRunningPlatformData().Chunks[ChunkIndex];
 
 		FCompressedAnimSequence* ExistingCompressedData = Chunk.CompressedAnimSequence;
@@ -395,12 +427,75 @@ void FAnimationStreamingManager::UpdateResourceStreaming(float DeltaTime, bool b
 
 	FScopeLock Lock(&CriticalSection);
 
+	EvictPrefetchedChunks();
+
 	for (TPair<UAnimStreamable*, FStreamingAnimationData*>& AnimData : StreamingAnimations)
 	{
 		AnimData.Value->UpdateStreamingStatus();
 	}
 }
 
+void FAnimationStreamingManager::EvictPrefetchedChunks()
+{
+	struct FPrefetchedChunkRef
+	{
+		FStreamingAnimationData* AnimData;
+		const FPrefetchedAnimationChunk* Chunk;
+	};
+
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	TArray<FPrefetchedChunkRef> PrefetchedChunks;
+	for (TPair<UAnimStreamable*, FStreamingAnimationData*>& AnimPair : StreamingAnimations)
+	{
+		FStreamingAnimationData* AnimData = AnimPair.Value;
+		AnimData->PrefetchedChunks.RemoveAllSwap([CurrentTime](const FPrefetchedAnimationChunk& Chunk) { return CurrentTime - Chunk.LastRequestTime > PrefetchAnimationChunkLifetime; }, false);
+
+		for (const FPrefetchedAnimationChunk& Chunk : AnimData->PrefetchedChunks)
+		{
+			PrefetchedChunks.Add({ AnimData, &Chunk });
+		}
+	}
+
+	if (PrefetchedChunks.Num() == 0)
+	{
+		return;
+	}
+
+	// Most important first, the most recently requested first among equally important ones
+	PrefetchedChunks.Sort([](const FPrefetchedChunkRef& A, const FPrefetchedChunkRef& B)
+	{
+		return A.Chunk->Priority != B.Chunk->Priority ? A.Chunk->Priority > B.Chunk->Priority : A.Chunk->LastRequestTime > B.Chunk->LastRequestTime;
+	});
+
+	const int64 Budget = (int64)(PrefetchAnimationChunkBudgetMB * 1024.f * 1024.f);
+	int64 UsedBudget = 0;
+
+	TArray<TPair<FStreamingAnimationData*, uint32>> EvictedChunks;
+	for (const FPrefetchedChunkRef& ChunkRef : PrefetchedChunks)
+	{
+		const FAnimStreamableChunk& Chunk = ChunkRef.AnimData->StreamableAnim->GetRunningPlatformData().Chunks[ChunkRef.Chunk->Index];
+
+		// Chunks that are part of the package don't cost anything to keep
+		const int64 ChunkSize = Chunk.CompressedAnimSequence ? 0 : Chunk.BulkData.GetBulkDataSize();
+		if (UsedBudget + ChunkSize > Budget)
+		{
+			EvictedChunks.Emplace(ChunkRef.AnimData, ChunkRef.Chunk->Index);
+		}
+		else
+		{
+			UsedBudget += ChunkSize;
+		}
+	}
+
+	// Evicted chunks are freed by the next status update unless playback still needs them
+	for (const TPair<FStreamingAnimationData*, uint32>& EvictedChunk : EvictedChunks)
+	{
+		const uint32 ChunkIndex = EvictedChunk.Value;
+		EvictedChunk.Key->PrefetchedChunks.RemoveAllSwap([ChunkIndex](const FPrefetchedAnimationChunk& Chunk) { return Chunk.Index == ChunkIndex; }, false);
+	}
+}
+
 int32 FAnimationStreamingManager::BlockTillAllRequestsFinished(float TimeLimit, bool)
 {
 	{
@@ -539,4 +634,31 @@ const FCompressedAnimSequence* FAnimationStreamingManager::GetLoadedChunk(const
 	}
 
 	return nullptr;
+}
+
+void FAnimationStreamingManager::PrefetchChunk(const UAnimStreamable* Anim, uint32 ChunkIndex, float Priority)
+{
+	// The first chunk is always loaded
+	if (ChunkIndex == 0 || PrefetchAnimationChunkBudgetMB <= 0.f)
+	{
+		return;
+	}
+
+	FScopeLock MapLock(&CriticalSection);
+
+	FStreamingAnimationData* AnimData = StreamingAnimations.FindRef(Anim);
+	if (AnimData && ChunkIndex < (uint32)Anim->GetRunningPlatformData().Chunks.Num())
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (FPrefetchedAnimationChunk* PrefetchedChunk = AnimData->PrefetchedChunks.FindByPredicate([ChunkIndex](const FPrefetchedAnimationChunk& Chunk) { return Chunk.Index == ChunkIndex; }))
+		{
+			// Keep the priority of the most important request until it expires
+			PrefetchedChunk->Priority = FMath::Max(PrefetchedChunk->Priority, Priority);
+			PrefetchedChunk->LastRequestTime = CurrentTime;
+		}
+		else
+		{
+			AnimData->PrefetchedChunks.Add({ ChunkIndex, Priority, CurrentTime });
+		}
+	}
 }
\ No newline at end of file
@@ -17,11 +17,105 @@
 #include "Engine/SkeletalMeshSocket.h"
 #include "AnimEncoding.h"
 #include "UObject/LinkerLoad.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GSkeletonMetaDataCache = 1;
+static FAutoConsoleVariableRef CVarSkeletonMetaDataCache(
+	TEXT("a.Compression.SkeletonMetaDataCache"),
+	GSkeletonMetaDataCache,
+	TEXT("If 1, the bone data BuildSkeletonMetaData computes is cached per skeleton and reused by the sequences compressed against it."),
+	ECVF_Default);
 
 /** Array to keep track of SkeletalMeshes we have built metadata for, and log out the results just once. */
 //static TArray<USkeleton*> UniqueSkeletonsMetadataArray;
 
+namespace AnimationUtils
+{
+	struct FSkeletonMetaDataCacheEntry
+	{
+		uint32 InputHash;
+		TArray<FBoneData> BoneData;
+	};
+
+	/** Bounds the memory of skeletons that are gone, the cache is emptied when it grows past it */
+	static const int32 MaxCachedSkeletons = 256;
+
+	/** Compressions run on worker threads, hence the lock */
+	static FCriticalSection SkeletonMetaDataCacheLock;
+	static TMap<const USkeleton*, FSkeletonMetaDataCacheEntry> SkeletonMetaDataCache;
+
+	/** Hashes everything BuildSkeletonMetaData reads, so edits to the skeleton or the settings and reused addresses never return stale data */
+	static uint32 HashSkeletonMetaDataInputs(const USkeleton* Skeleton)
+	{
+		const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+		const TArray<FTransform>& SkeletonRefPose = Skeleton->GetRefLocalPoses();
+		const int32 NumBones = RefSkeleton.GetNum();
+
+		uint32 Hash = GetTypeHash(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const FTransform& Transform = SkeletonRefPose[BoneIndex];
+			const FQuat Rotation = Transform.GetRotation();
+			const FVector Translation = Transform.GetTranslation();
+			const FVector Scale = Transform.GetScale3D();
+			Hash = FCrc::MemCrc32(&Rotation, sizeof(Rotation), Hash);
+			Hash = FCrc::MemCrc32(&Translation, sizeof(Translation), Hash);
+			Hash = FCrc::MemCrc32(&Scale, sizeof(Scale), Hash);
+			Hash = HashCombine(Hash, GetTypeHash(RefSkeleton.GetBoneName(BoneIndex)));
+			Hash = HashCombine(Hash, GetTypeHash(RefSkeleton.GetParentIndex(BoneIndex)));
+		}
+
+		for (const USkeletalMeshSocket* Socket : Skeleton->Sockets)
+		{
+			Hash = HashCombine(Hash, Socket ? GetTypeHash(Socket->BoneName) : 0);
+		}
+
+		for (const FString& MatchName : UAnimationSettings::Get()->KeyEndEffectorsMatchNameArray)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(MatchName));
+		}
+
+		return Hash;
+	}
+}
+
+static void BuildSkeletonMetaDataUncached(USkeleton* Skeleton, TArray<FBoneData>& OutBoneData);
+
 void FAnimationUtils::BuildSkeletonMetaData(USkeleton* Skeleton, TArray<FBoneData>& OutBoneData)
+{
+	using namespace AnimationUtils;
+
+	if (!GSkeletonMetaDataCache)
+	{
+		BuildSkeletonMetaDataUncached(Skeleton, OutBoneData);
+		return;
+	}
+
+	const uint32 InputHash = HashSkeletonMetaDataInputs(Skeleton);
+	{
+		FScopeLock Lock(&SkeletonMetaDataCacheLock);
+		if (const FSkeletonMetaDataCacheEntry* Entry = SkeletonMetaDataCache.Find(Skeleton))
+		{
+			if (Entry->InputHash == InputHash)
+			{
+				OutBoneData = Entry->BoneData;
+				return;
+			}
+		}
+	}
+
+	BuildSkeletonMetaDataUncached(Skeleton, OutBoneData);
+
+	FScopeLock Lock(&SkeletonMetaDataCacheLock);
+	if (SkeletonMetaDataCache.Num() >= MaxCachedSkeletons)
+	{
+		SkeletonMetaDataCache.Empty();
+	}
+	SkeletonMetaDataCache.Add(Skeleton, { InputHash, OutBoneData });
+}
+
+static void BuildSkeletonMetaDataUncached(USkeleton* Skeleton, TArray<FBoneData>& OutBoneData)
 {
 	// Disable logging by default. Except if we deal with a new Skeleton. Then we log out its details. (just once).
 	bool bEnableLogging = false;
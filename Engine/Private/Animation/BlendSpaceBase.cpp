@@ -12,11 +12,19 @@
 #include "UObject/UObjectIterator.h"
 #include "Logging/TokenizedMessage.h"
 #include "Logging/MessageLog.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE "BlendSpaceBase"
 
 DECLARE_CYCLE_STAT(TEXT("BlendSpace GetAnimPose"), STAT_BlendSpace_GetAnimPose, STATGROUP_Anim);
 
+static int32 GBlendSpaceCacheSamples = 1;
+static FAutoConsoleVariableRef CVarBlendSpaceCacheSamples(
+	TEXT("a.BlendSpace.CacheSamples"),
+	GBlendSpaceCacheSamples,
+	TEXT("If 1, blend space players reuse the sample weights of their last update while their blend input doesn't move, e.g. aim offsets holding their aim."),
+	ECVF_Default);
+
 /** Scratch buffers for multithreaded usage */
 struct FBlendSpaceScratchData : public TThreadSingleton<FBlendSpaceScratchData>
 {
@@ -205,7 +213,7 @@ void UBlendSpaceBase::TickAssetPlayer(FAnimTickRecord& Instance, struct FAnimNot
 		TArray<FBlendSampleData> & SampleDataList = *Instance.BlendSpace.BlendSampleDataCache;
 
 		// get sample data from blendspace
-		if (GetSamplesFromBlendInput(BlendInput, NewSampleDataList))
+		if (GetSamplesFromBlendInputCached(BlendInput, Instance.BlendSpace.BlendFilter, NewSampleDataList))
 		{
 			float NewAnimLength=0.f;
 			float PreInterpAnimLength = 0.f;
@@ -371,7 +379,7 @@ void UBlendSpaceBase::TickAssetPlayer(FAnimTickRecord& Instance, struct FAnimNot
 
 			// generate notifies and sets time
 			{
-				TArray<FAnimNotifyEventReference> Notifies;
+				TArray<FAnimNotifyEventReference>& Notifies = NotifyQueue.GetScratchNotifies();
 
 				const float ClampedNormalizedPreviousTime = FMath::Clamp<float>(NormalizedPreviousTime, 0.f, 1.f);
 				const float ClampedNormalizedCurrentTime = FMath::Clamp<float>(NormalizedCurrentTime, 0.f, 1.f);
@@ -763,6 +771,34 @@ bool UBlendSpaceBase::GetSamplesFromBlendInput(const FVector &BlendInput, TArray
 	return (OutSampleDataList.Num()!=0);
 }
 
+bool UBlendSpaceBase::GetSamplesFromBlendInputCached(const FVector &BlendInput, FBlendFilter* Filter, TArray<FBlendSampleData> & OutSampleDataList) const
+{
+	// Samples can be edited while the editor is running, the cache has no way to know
+	if (!GBlendSpaceCacheSamples || !Filter || GIsEditor)
+	{
+		return GetSamplesFromBlendInput(BlendInput, OutSampleDataList);
+	}
+
+	if (Filter->CachedBlendSpace == this && Filter->CachedBlendInput == BlendInput && Filter->CachedSampleDataList.Num() > 0)
+	{
+		OutSampleDataList.Reset();
+		OutSampleDataList.Append(Filter->CachedSampleDataList);
+		return true;
+	}
+
+	const bool bHasSamples = GetSamplesFromBlendInput(BlendInput, OutSampleDataList);
+
+	Filter->CachedBlendSpace = this;
+	Filter->CachedBlendInput = BlendInput;
+	Filter->CachedSampleDataList.Reset();
+	if (bHasSamples)
+	{
+		Filter->CachedSampleDataList.Append(OutSampleDataList);
+	}
+
+	return bHasSamples;
+}
+
 void UBlendSpaceBase::InitializeFilter(FBlendFilter * Filter) const
 {
 	if (Filter)
@@ -82,6 +82,155 @@ void FCompactHeapPose::ResetToAdditiveIdentity()
 	}
 }
 
+void FCompactPoseSoA::ResetToAdditiveIdentity()
+{
+	const int32 NumBones = GetNumBones();
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		Rotations[BoneIndex] = FQuat::Identity;
+		Translations[BoneIndex] = FVector::ZeroVector;
+		Scales[BoneIndex] = FVector::ZeroVector;
+	}
+}
+
+void FCompactPoseSoA::NormalizeRotations()
+{
+	if (INTEL_ISPC)
+	{
+#if INTEL_ISPC
+		ispc::NormalizeRotationsSoA((float*)Rotations.GetData(), Rotations.Num());
+#endif
+	}
+	else
+	{
+		for (FQuat& Rotation : Rotations)
+		{
+			Rotation.Normalize();
+		}
+	}
+}
+
+void FCompactPoseSoA::BlendOverwrite(const FCompactPoseSoA& SourcePose, float BlendWeight)
+{
+	const int32 NumBones = SourcePose.GetNumBones();
+	SetNumBones(NumBones);
+
+	if (INTEL_ISPC)
+	{
+#if INTEL_ISPC
+		ispc::BlendOverwriteSoA((float*)Rotations.GetData(), (float*)Translations.GetData(), (float*)Scales.GetData(),
+			(const float*)SourcePose.Rotations.GetData(), (const float*)SourcePose.Translations.GetData(), (const float*)SourcePose.Scales.GetData(),
+			BlendWeight, NumBones);
+#endif
+	}
+	else
+	{
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			Rotations[BoneIndex] = SourcePose.Rotations[BoneIndex] * BlendWeight;
+			Translations[BoneIndex] = SourcePose.Translations[BoneIndex] * BlendWeight;
+			Scales[BoneIndex] = SourcePose.Scales[BoneIndex] * BlendWeight;
+		}
+	}
+}
+
+void FCompactPoseSoA::BlendAccumulate(const FCompactPoseSoA& SourcePose, float BlendWeight)
+{
+	const int32 NumBones = GetNumBones();
+	check(SourcePose.GetNumBones() == NumBones);
+
+	if (INTEL_ISPC)
+	{
+#if INTEL_ISPC
+		ispc::BlendAccumulateSoA((float*)Rotations.GetData(), (float*)Translations.GetData(), (float*)Scales.GetData(),
+			(const float*)SourcePose.Rotations.GetData(), (const float*)SourcePose.Translations.GetData(), (const float*)SourcePose.Scales.GetData(),
+			BlendWeight, NumBones);
+#endif
+	}
+	else
+	{
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const FQuat BlendedRotation = SourcePose.Rotations[BoneIndex] * BlendWeight;
+			const float Bias = (Rotations[BoneIndex] | BlendedRotation) >= 0.f ? 1.f : -1.f;
+			Rotations[BoneIndex] += BlendedRotation * Bias;
+
+			Translations[BoneIndex] += SourcePose.Translations[BoneIndex] * BlendWeight;
+			Scales[BoneIndex] += SourcePose.Scales[BoneIndex] * BlendWeight;
+		}
+	}
+}
+
+void FCompactPoseSoA::AccumulateAdditive(const FCompactPoseSoA& AdditivePose, float BlendWeight)
+{
+	const int32 NumBones = GetNumBones();
+	check(AdditivePose.GetNumBones() == NumBones);
+
+	if (INTEL_ISPC)
+	{
+#if INTEL_ISPC
+		ispc::AccumulateAdditiveSoA((float*)Rotations.GetData(), (float*)Translations.GetData(), (float*)Scales.GetData(),
+			(const float*)AdditivePose.Rotations.GetData(), (const float*)AdditivePose.Translations.GetData(), (const float*)AdditivePose.Scales.GetData(),
+			BlendWeight, NumBones);
+#endif
+	}
+	else
+	{
+		const float OneMinusWeight = 1.f - BlendWeight;
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			// Blend from identity to the additive rotation. Identity is (0,0,0,1), so the shortest path only depends on the sign of W.
+			const FQuat& AdditiveRotation = AdditivePose.Rotations[BoneIndex];
+			const float Bias = AdditiveRotation.W >= 0.f ? 1.f : -1.f;
+			FQuat BlendedRotation = AdditiveRotation * BlendWeight;
+			BlendedRotation.W += Bias * OneMinusWeight;
+			BlendedRotation.Normalize();
+
+			Rotations[BoneIndex] = BlendedRotation * Rotations[BoneIndex];
+			Translations[BoneIndex] += AdditivePose.Translations[BoneIndex] * BlendWeight;
+			Scales[BoneIndex] *= FVector::OneVector + AdditivePose.Scales[BoneIndex] * BlendWeight;
+		}
+	}
+}
+
+void FCompactPoseSoA::ConvertToMeshRotation(const FBoneContainer& BoneContainer)
+{
+	const TArray<FCompactPoseBoneIndex>& ParentBones = BoneContainer.GetCompactPoseParentBoneArray();
+	check(ParentBones.Num() == GetNumBones());
+
+	// Parents come before their children, so they already are in mesh space when a bone reads them
+	for (int32 BoneIndex = 1; BoneIndex < ParentBones.Num(); ++BoneIndex)
+	{
+		Rotations[BoneIndex] = Rotations[ParentBones[BoneIndex].GetInt()] * Rotations[BoneIndex];
+	}
+}
+
+void FCompactPoseSoA::ConvertMeshRotationToLocalSpace(const FBoneContainer& BoneContainer)
+{
+	const TArray<FCompactPoseBoneIndex>& ParentBones = BoneContainer.GetCompactPoseParentBoneArray();
+	check(ParentBones.Num() == GetNumBones());
+
+	// Children first, so that parents are still in mesh space when a bone reads them
+	for (int32 BoneIndex = ParentBones.Num() - 1; BoneIndex > 0; --BoneIndex)
+	{
+		Rotations[BoneIndex] = Rotations[ParentBones[BoneIndex].GetInt()].Inverse() * Rotations[BoneIndex];
+	}
+}
+
+void FCompactPoseSoA::BlendPosesTogether(TArrayView<const FCompactPoseSoA* const> SourcePoses, TArrayView<const float> SourceWeights, FCompactPoseSoA& ResultPose)
+{
+	check(SourcePoses.Num() > 0 && SourcePoses.Num() == SourceWeights.Num());
+
+	ResultPose.BlendOverwrite(*SourcePoses[0], SourceWeights[0]);
+	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
+	{
+		ResultPose.BlendAccumulate(*SourcePoses[PoseIndex], SourceWeights[PoseIndex]);
+	}
+
+	// Ensure that all of the resulting rotations are normalized
+	ResultPose.NormalizeRotations();
+}
+
 void FMeshPose::ResetToRefPose()
 {
 	FAnimationRuntime::FillWithRefPose(Bones, *BoneContainer);
@@ -88,6 +88,14 @@ static FAutoConsoleVariableRef CVarSkinWeightProfilesAllowedFromLOD(
 	ECVF_Scalability
 );
 
+static int32 GSkinWeightProfilesKeepOverrideCPUData = 0;
+static FAutoConsoleVariableRef CVarSkinWeightProfilesKeepOverrideCPUData(
+	TEXT("a.SkinWeightProfile.KeepOverrideCPUData"),
+	GSkinWeightProfilesKeepOverrideCPUData,
+	TEXT("If non-zero, the skin weights of loaded Skin Weight Profiles are kept on the CPU even if the Skeletal Mesh's own skin weights aren't."),
+	ECVF_Default
+);
+
 FArchive& operator<<(FArchive& Ar, FRuntimeSkinWeightProfileData& OverrideData)
 {
 	Ar.UsingCustomVersion(FAnimObjectVersion::GUID);
@@ -326,7 +334,9 @@ FSkinWeightVertexBuffer* FSkinWeightProfilesData::GetOverrideBuffer(const FName&
 			{
 				FSkinWeightVertexBuffer* OverrideBuffer = new FSkinWeightVertexBuffer();
 				ProfileNameToBuffer.Add(ProfileName, OverrideBuffer);
-				OverrideBuffer->SetNeedsCPUAccess(true);
+
+				// Only keep the override weights around when the base ones are, they are rebuilt from the base buffer and override data whenever the RHI buffer is recreated
+				OverrideBuffer->SetNeedsCPUAccess(BaseBuffer->GetNeedsCPUAccess() || GSkinWeightProfilesKeepOverrideCPUData != 0);
 
 				ApplyOverrideProfile(OverrideBuffer, ProfileName);
 
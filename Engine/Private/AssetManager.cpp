@@ -476,12 +476,18 @@ int32 UAssetManager::ScanPathsForPrimaryAssets(FPrimaryAssetType PrimaryAssetTyp
 		}
 		else
 		{
-			TArray<UClass*> BlueprintCoreDerivedClasses;
-			GetDerivedClasses(UBlueprintCore::StaticClass(), BlueprintCoreDerivedClasses);
-			for (UClass* BPCoreClass : BlueprintCoreDerivedClasses)
+			if (!bIsBulkScanning || BulkScanBlueprintCoreClassNames.Num() == 0)
 			{
-				ARFilter.ClassNames.Add(BPCoreClass->GetFName());
+				TArray<UClass*> BlueprintCoreDerivedClasses;
+				GetDerivedClasses(UBlueprintCore::StaticClass(), BlueprintCoreDerivedClasses);
+
+				BulkScanBlueprintCoreClassNames.Reset(BlueprintCoreDerivedClasses.Num());
+				for (UClass* BPCoreClass : BlueprintCoreDerivedClasses)
+				{
+					BulkScanBlueprintCoreClassNames.Add(BPCoreClass->GetFName());
+				}
 			}
+			ARFilter.ClassNames.Append(BulkScanBlueprintCoreClassNames);
 
 			// Make sure this works, if it does remove post load check
 			ClassNames.Add(BaseClass->GetFName());
@@ -506,6 +512,12 @@ int32 UAssetManager::ScanPathsForPrimaryAssets(FPrimaryAssetType PrimaryAssetTyp
 
 	AssetRegistry.GetAssets(ARFilter, AssetDataList);
 
+	TypeData.AssetMap.Reserve(TypeData.AssetMap.Num() + AssetDataList.Num());
+	if (bIsBulkScanning)
+	{
+		AssetPathMap.Reserve(AssetPathMap.Num() + AssetDataList.Num());
+	}
+
 	int32 NumAdded = 0;
 	// Now add to map or update as needed
 	for (FAssetData& Data : AssetDataList)
@@ -587,6 +599,8 @@ void UAssetManager::StopBulkScanning()
 		bIsBulkScanning = false;
 	}
 
+	BulkScanBlueprintCoreClassNames.Empty();
+
 	if (!WITH_EDITOR)
 	{
 		// Leave temporary caching mode
@@ -1220,7 +1234,11 @@ TSharedPtr<FStreamableHandle> UAssetManager::ChangeBundleStateForPrimaryAssets(c
 			{
 				if (NameData->PendingState.BundleNames == *NewBundles)
 				{
-					// This will wait on any existing handles to finish
+					// This will wait on any existing handles to finish, a background preload shouldn't hold back a more urgent request
+					if (NameData->PendingState.Handle.IsValid())
+					{
+						NameData->PendingState.Handle->RaisePriority(Priority);
+					}
 					ExistingHandles.Add(NameData->PendingState.Handle);
 					continue;
 				}
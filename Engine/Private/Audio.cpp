@@ -835,7 +835,8 @@ FWaveInstance::FWaveInstance(const UPTRINT InWaveInstanceHash, FActiveSound& InA
 	, WaveInstanceHash(InWaveInstanceHash)
 	, UserIndex(0)
 {
-	TypeHash = ++TypeHashCounter;
+	// Wave instances may be created by several tasks, see au.ParallelGatherWaveInstances
+	TypeHash = (uint32)FPlatformAtomics::InterlockedIncrement((volatile int32*)&TypeHashCounter);
 }
 
 bool FWaveInstance::IsPlaying() const
@@ -239,6 +239,7 @@ namespace
 			float Volume;
 			int32 InstanceIndex;
 			FName WaveInstanceName;
+			const TCHAR* DecodeMode;
 			uint8 bPlayWhenSilent:1;
 		};
 
@@ -280,6 +281,26 @@ namespace
 		}
 	};
 
+	/** How the sound wave's audio is decoded for playback. Audio thread only. */
+	const TCHAR* GetDecodeModeName(const USoundWave& SoundWave)
+	{
+		if (FAudioDevice::IsInDecodedPCMCache(&SoundWave))
+		{
+			return TEXT("Cached PCM");
+		}
+
+		switch (SoundWave.DecompressionType)
+		{
+			case DTYPE_Native:		return TEXT("PCM");
+			case DTYPE_RealTime:	return TEXT("Realtime");
+			case DTYPE_Streaming:	return TEXT("Streaming");
+			case DTYPE_Procedural:	return TEXT("Procedural");
+			case DTYPE_Preview:		return TEXT("Preview");
+			case DTYPE_Invalid:		return TEXT("Invalid");
+			default:				return TEXT("Setup");
+		}
+	}
+
 	void UpdateDisplaySort(FAudioStats& InAudioStats)
 	{
 		if (AudioDebugSoundSortCVarCVar == TEXT("distance"))
@@ -812,9 +833,10 @@ void FAudioDebugger::DumpActiveSounds() const
 			for (const TPair<UPTRINT, FWaveInstance*>& WaveInstancePair : ActiveSound->GetWaveInstances())
 			{
 				const FWaveInstance* WaveInstance = WaveInstancePair.Value;
-				UE_LOG(LogAudio, Display, TEXT("   %s (%.3g) (%d) - %.3g"),
+				UE_LOG(LogAudio, Display, TEXT("   %s (%.3g) (%d) (%s) - %.3g"),
 					*WaveInstance->GetName(), WaveInstance->WaveData->GetDuration(),
 					WaveInstance->WaveData->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal),
+					GetDecodeModeName(*WaveInstance->WaveData),
 					WaveInstance->GetVolumeWithDistanceAttenuation() * WaveInstance->GetDynamicVolume());
 			}
 		}
@@ -1528,12 +1550,13 @@ int32 FAudioDebugger::RenderStatWaves(UWorld* World, FViewport* Viewport, FCanva
 		UAudioComponent* AudioComponent = UAudioComponent::GetAudioComponentFromID(WaveInstanceInfo.Value->AudioComponentID);
 		AActor* SoundOwner = AudioComponent ? AudioComponent->GetOwner() : nullptr;
 
-		FString TheString = *FString::Printf(TEXT("%4i.    %6.2f  %s   Owner: %s   SoundClass: %s"),
+		FString TheString = *FString::Printf(TEXT("%4i.    %6.2f  %s   Owner: %s   SoundClass: %s   Decode: %s"),
 			WaveInstanceInfo.Key->InstanceIndex,
 			WaveInstanceInfo.Key->Volume,
 			*WaveInstanceInfo.Key->WaveInstanceName.ToString(),
 			SoundOwner ? *SoundOwner->GetName() : TEXT("None"),
-			*WaveInstanceInfo.Value->SoundClassName.ToString());
+			*WaveInstanceInfo.Value->SoundClassName.ToString(),
+			WaveInstanceInfo.Key->DecodeMode);
 		Canvas->DrawShadowedString(X, Y, *TheString, GetStatsFont(), WaveInstanceInfo.Key->bPlayWhenSilent == 0 ? BodyColor : FColor::Yellow);
 		Y += FontHeight;
 	}
@@ -1823,6 +1846,7 @@ void FAudioDebugger::SendUpdateResultsToGameThread(const FAudioDevice& AudioDevi
 				WaveInstanceInfo.Volume = WaveInstance->GetVolumeWithDistanceAttenuation() * WaveInstance->GetDynamicVolume();
 				WaveInstanceInfo.InstanceIndex = InstanceIndex;
 				WaveInstanceInfo.WaveInstanceName = *WaveInstance->GetName();
+				WaveInstanceInfo.DecodeMode = WaveInstance->WaveData ? GetDecodeModeName(*WaveInstance->WaveData) : TEXT("None");
 				WaveInstanceInfo.bPlayWhenSilent = WaveInstance->ActiveSound->IsPlayWhenSilent() ? 1 : 0;
 				WaveInstanceInfo.DebugInfo = Source ? Source->DebugInfo : WaveInstanceInfo.DebugInfo;
 				StatSoundInfos[*SoundInfoIndex].WaveInstanceInfos.Add(MoveTemp(WaveInstanceInfo));
@@ -9,6 +9,7 @@
 #include "AudioEffect.h"
 #include "AudioPluginUtilities.h"
 #include "Audio/AudioDebug.h"
+#include "Async/ParallelFor.h"
 #include "ContentStreaming.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/GameUserSettings.h"
@@ -35,6 +36,7 @@
 #include "Sound/SoundNodeWavePlayer.h"
 #include "Sound/SoundSubmix.h"
 #include "UnrealEngine.h"
+#include "InGamePerformanceTracker.h"
 #include "UObject/UObjectHash.h"
 #include "UObject/UObjectIterator.h"
 #include "UObject/Package.h"
@@ -176,10 +178,93 @@ FAutoConsoleVariableRef CVarDisableBinauralSpatialization(
 	TEXT("Disables binaural spatialization.\n"),
 	ECVF_Default);
 
+static int32 ParallelGatherWaveInstancesCVar = 0;
+FAutoConsoleVariableRef CVarParallelGatherWaveInstances(
+	TEXT("au.ParallelGatherWaveInstances"),
+	ParallelGatherWaveInstancesCVar,
+	TEXT("When set to > 0, active sounds parse their sound nodes and update their attenuation in parallel when gathering wave instances,\n")
+	TEXT("as long as at least that many sounds are updated. Sound nodes and attenuation, occlusion or spatialization plugins must not rely on running on the audio thread.\n")
+	TEXT("0: Update active sounds on the audio thread, >0: Minimum number of active sounds to update in parallel."),
+	ECVF_Default);
+
+static int32 PreCullInaudibleLoopsCVar = 1;
+FAutoConsoleVariableRef CVarPreCullInaudibleLoops(
+	TEXT("au.PreCullInaudibleLoops"),
+	PreCullInaudibleLoopsCVar,
+	TEXT("When set to 1, looping sounds out of range of every listener skip parsing their sound nodes when gathering wave instances.\n")
+	TEXT("They only get parsed again once in range. Uses the same conservative audibility check as virtualization.\n")
+	TEXT("0: Parse every active sound, 1: Skip inaudible looping sounds."),
+	ECVF_Default);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Inaudible Loops Pre-Culled"), STAT_AudioInaudibleLoopsPreCulled, STATGROUP_Audio);
+
+static int32 DecodedPCMCacheBudgetKBCVar = 0;
+FAutoConsoleVariableRef CVarDecodedPCMCacheBudgetKB(
+	TEXT("au.DecodedPCMCache.BudgetKB"),
+	DecodedPCMCacheBudgetKBCVar,
+	TEXT("Memory budget, in kilobytes, for keeping short and frequently played sound waves fully decoded instead of decoding them in realtime on every play.\n")
+	TEXT("0: Disabled, n: Budget in kilobytes."),
+	ECVF_Default);
+
+static float DecodedPCMCacheMaxDurationCVar = 1.0f;
+FAutoConsoleVariableRef CVarDecodedPCMCacheMaxDuration(
+	TEXT("au.DecodedPCMCache.MaxDuration"),
+	DecodedPCMCacheMaxDurationCVar,
+	TEXT("Longest sound wave, in seconds, that can be kept decoded by the decoded PCM cache."),
+	ECVF_Default);
+
+static float DecodedPCMCacheMinPlaysPerMinuteCVar = 30.0f;
+FAutoConsoleVariableRef CVarDecodedPCMCacheMinPlaysPerMinute(
+	TEXT("au.DecodedPCMCache.MinPlaysPerMinute"),
+	DecodedPCMCacheMinPlaysPerMinuteCVar,
+	TEXT("How often a sound wave has to be played, in plays per minute, before it is kept decoded by the decoded PCM cache.\n")
+	TEXT("Less played waves are evicted when the budget is full."),
+	ECVF_Default);
+
+/** Set in the tasks updating wave instances in parallel, including the audio thread's own share */
+static thread_local bool bIsInWaveInstanceGather = false;
+
 namespace
 {
 	using FVirtualLoopPair = TPair<FActiveSound*, FAudioVirtualLoop>;
 
+	/**
+	 * Short realtime decompressed sound waves that are played often enough get fully decoded once, as if they were
+	 * below the decompression duration threshold, within a memory budget. Audio thread only.
+	 */
+	namespace DecodedPCMCache
+	{
+		struct FEntry
+		{
+			/** Null once the wave's resources are freed */
+			USoundWave* SoundWave = nullptr;
+
+			/** Plays per minute, decayed exponentially from LastPlayTime */
+			float PlayRate = 0.0f;
+			double LastPlayTime = 0.0;
+
+			/** Decoded data size while the wave is cached, 0 otherwise */
+			uint32 CachedBytes = 0;
+
+			/** Whether to decode the wave the next time none of its sources are playing */
+			bool bPendingPromotion = false;
+		};
+
+		/** Keyed by the compressed data GUID of the waves */
+		TMap<FGuid, FEntry> Entries;
+		uint64 TotalCachedBytes = 0;
+
+		float GetPlayRate(const FEntry& Entry, double Now)
+		{
+			return Entry.PlayRate * FMath::Exp(-(float)(Now - Entry.LastPlayTime) / 60.0f);
+		}
+
+		uint32 GetDecodedSize(const USoundWave& SoundWave)
+		{
+			return (uint32)(SoundWave.Duration * SoundWave.GetSampleRateForCurrentPlatform()) * SoundWave.NumChannels * sizeof(int16);
+		}
+	}
+
 #if !UE_BUILD_SHIPPING
 	int32 PrecachedRealtime = 0;
 	int32 PrecachedNative = 0;
@@ -3190,7 +3275,7 @@ void FAudioDevice::SetDefaultAudioSettings(UWorld* World, const FReverbSettings&
 
 void FAudioDevice::GetAudioVolumeSettings(const uint32 WorldID, const FVector& Location, FAudioVolumeSettings& OutSettings) const
 {
-	check(IsInAudioThread());
+	check(IsInAudioThreadOrWaveInstanceGather());
 
 	for (const TPair<uint32,FAudioVolumeProxy>& AudioVolumePair : AudioVolumeProxies)
 	{
@@ -3650,6 +3735,11 @@ int32 FAudioDevice::GetSortedActiveWaveInstances(TArray<FWaveInstance*>& WaveIns
 	// Tick all the active audio components.  Use a copy as some operations may remove elements from the list, but we want
 	// to evaluate in the order they were added
 	TArray<FActiveSound*> ActiveSoundsCopy = ActiveSounds;
+
+	// Sounds to update in parallel once every sound has been checked, with their delta time
+	const bool bParallelGather = ParallelGatherWaveInstancesCVar > 0 && ActiveSoundsCopy.Num() >= ParallelGatherWaveInstancesCVar;
+	TArray<TPair<FActiveSound*, float>> SoundsToGather;
+
 	for (int32 i = 0; i < ActiveSoundsCopy.Num(); ++i)
 	{
 		FActiveSound* ActiveSound = ActiveSoundsCopy[i];
@@ -3706,7 +3796,19 @@ int32 FAudioDevice::GetSortedActiveWaveInstances(TArray<FWaveInstance*>& WaveIns
 					}
 				}
 
-				if (!bStopped)
+				// Looping sounds out of range would only produce silent wave instances, don't parse their nodes at all.
+				// Sounds fading out still need to update so they finish.
+				bool bPreCulled = false;
+				if (!bStopped && PreCullInaudibleLoopsCVar && GetType != ESortedActiveWaveGetType::QueryOnly
+					&& ActiveSound->IsLooping() && !ActiveSound->bIsUISound && !ActiveSound->bIsPreviewSound && ActiveSound->FadeOut == FActiveSound::EFadeOut::None
+					&& !ActiveSound->Sound->bOutputToBusOnly && !SoundIsAudible(*ActiveSound))
+				{
+					INC_DWORD_STAT(STAT_AudioInaudibleLoopsPreCulled);
+					ActiveSound->bIsPlayingAudio = false;
+					bPreCulled = true;
+				}
+
+				if (!bStopped && !bPreCulled)
 				{
 					// If not in game, do not advance sounds unless they are UI sounds.
 					float UsedDeltaTime = GetGameDeltaTime();
@@ -3715,12 +3817,44 @@ int32 FAudioDevice::GetSortedActiveWaveInstances(TArray<FWaveInstance*>& WaveIns
 						UsedDeltaTime = 0.0f;
 					}
 
-					ActiveSound->UpdateWaveInstances(WaveInstances, UsedDeltaTime);
+					if (bParallelGather)
+					{
+						SoundsToGather.Emplace(ActiveSound, UsedDeltaTime);
+					}
+					else
+					{
+						ActiveSound->UpdateWaveInstances(WaveInstances, UsedDeltaTime);
+					}
 				}
 			}
 		}
 	}
 
+	if (SoundsToGather.Num() > 0)
+	{
+		// Each sound parses into its own list, appended in the original order so sorting stays deterministic
+		TArray<TArray<FWaveInstance*>> GatheredWaveInstances;
+		GatheredWaveInstances.SetNum(SoundsToGather.Num());
+
+		ParallelFor(SoundsToGather.Num(), [&SoundsToGather, &GatheredWaveInstances](int32 Index)
+		{
+			bIsInWaveInstanceGather = true;
+			SoundsToGather[Index].Key->UpdateWaveInstances(GatheredWaveInstances[Index], SoundsToGather[Index].Value);
+			bIsInWaveInstanceGather = false;
+		});
+
+		for (const TArray<FWaveInstance*>& SoundWaveInstances : GatheredWaveInstances)
+		{
+			WaveInstances.Append(SoundWaveInstances);
+		}
+
+		for (FActiveSound* SoundToStop : GatherSoundsToStop)
+		{
+			AddSoundToStop(SoundToStop);
+		}
+		GatherSoundsToStop.Reset();
+	}
+
 	if (GetType != ESortedActiveWaveGetType::QueryOnly)
 	{
 		CullSoundsDueToMaxConcurrency(WaveInstances, ActiveSoundsCopy);
@@ -3954,6 +4088,9 @@ void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 Fir
 
 	SCOPE_CYCLE_COUNTER(STAT_AudioStartSources);
 
+	// Before any source starts this update, so that recently played waves may be idle
+	PromoteDecodedPCMCacheWaves();
+
 	TArray<USoundWave*> StartingSoundWaves;
 
 	// Start sources as needed.
@@ -4092,6 +4229,193 @@ void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 Fir
 			ReferencedSoundWaves_AudioThread.AddUnique(SoundWave);
 		}
 	}
+
+	NotifyDecodedPCMCacheWavesStarted(StartingSoundWaves);
+}
+
+bool FAudioDevice::IsInDecodedPCMCache(const USoundWave* SoundWave)
+{
+	check(IsInAudioThread());
+
+	const DecodedPCMCache::FEntry* Entry = DecodedPCMCache::Entries.Find(SoundWave->CompressedDataGuid);
+	return Entry && Entry->SoundWave == SoundWave && Entry->CachedBytes > 0;
+}
+
+void FAudioDevice::RemoveFromDecodedPCMCache(const USoundWave* SoundWave)
+{
+	check(IsInAudioThread());
+
+	DecodedPCMCache::FEntry* Entry = DecodedPCMCache::Entries.Find(SoundWave->CompressedDataGuid);
+	if (Entry && Entry->SoundWave == SoundWave)
+	{
+		DecodedPCMCache::TotalCachedBytes -= Entry->CachedBytes;
+		Entry->CachedBytes = 0;
+		Entry->SoundWave = nullptr;
+		Entry->bPendingPromotion = false;
+	}
+}
+
+bool FAudioDevice::IsSoundWaveUsedBySource(const USoundWave* SoundWave)
+{
+	bool bIsUsed = false;
+	if (FAudioDeviceManager* AudioDeviceManager = GEngine ? GEngine->GetAudioDeviceManager() : nullptr)
+	{
+		AudioDeviceManager->IterateOverAllDevices([SoundWave, &bIsUsed](Audio::FDeviceId, FAudioDevice* AudioDevice)
+		{
+			for (const FSoundSource* Source : AudioDevice->Sources)
+			{
+				if (Source->WaveInstance && Source->WaveInstance->WaveData == SoundWave)
+				{
+					bIsUsed = true;
+					break;
+				}
+			}
+		});
+	}
+	return bIsUsed;
+}
+
+void FAudioDevice::NotifyDecodedPCMCacheWavesStarted(const TArray<USoundWave*>& StartingSoundWaves)
+{
+	using namespace DecodedPCMCache;
+
+	if (DecodedPCMCacheBudgetKBCVar <= 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	for (USoundWave* SoundWave : StartingSoundWaves)
+	{
+		const bool bIsRealtime = SoundWave->DecompressionType == DTYPE_RealTime;
+		if ((!bIsRealtime && !IsInDecodedPCMCache(SoundWave))
+			|| SoundWave->Duration <= 0.0f
+			|| SoundWave->Duration > DecodedPCMCacheMaxDurationCVar
+			|| !SoundWave->CompressedDataGuid.IsValid())
+		{
+			continue;
+		}
+
+		FEntry& Entry = Entries.FindOrAdd(SoundWave->CompressedDataGuid);
+		if (Entry.CachedBytes > 0 && Entry.SoundWave != SoundWave)
+		{
+			// Another wave with the same compressed data owns the entry
+			continue;
+		}
+
+		Entry.SoundWave = SoundWave;
+		Entry.PlayRate = GetPlayRate(Entry, Now) + 1.0f;
+		Entry.LastPlayTime = Now;
+		Entry.bPendingPromotion = bIsRealtime && Entry.PlayRate >= DecodedPCMCacheMinPlaysPerMinuteCVar;
+	}
+}
+
+void FAudioDevice::PromoteDecodedPCMCacheWaves()
+{
+	using namespace DecodedPCMCache;
+
+	if (DecodedPCMCacheBudgetKBCVar <= 0 || Entries.Num() == 0)
+	{
+		return;
+	}
+
+	// Forget about freed waves that aren't cached anymore
+	for (TMap<FGuid, FEntry>::TIterator It(Entries); It; ++It)
+	{
+		if (!It.Value().SoundWave)
+		{
+			check(It.Value().CachedBytes == 0);
+			It.RemoveCurrent();
+		}
+	}
+
+	FAudioDeviceManager* AudioDeviceManager = GEngine ? GEngine->GetAudioDeviceManager() : nullptr;
+	if (!AudioDeviceManager)
+	{
+		return;
+	}
+
+	const uint64 BudgetBytes = (uint64)DecodedPCMCacheBudgetKBCVar * 1024;
+	const double Now = FPlatformTime::Seconds();
+
+	for (TPair<FGuid, FEntry>& EntryPair : Entries)
+	{
+		FEntry& Entry = EntryPair.Value;
+		if (!Entry.bPendingPromotion)
+		{
+			continue;
+		}
+
+		USoundWave* SoundWave = Entry.SoundWave;
+		if (SoundWave->DecompressionType != DTYPE_RealTime || SoundWave->AudioDecompressor || SoundWave->GetPrecacheState() != ESoundWavePrecacheState::Done)
+		{
+			Entry.bPendingPromotion = false;
+			continue;
+		}
+
+		// Realtime sources decode from the compressed data, it can only be swapped out once none of them play the wave
+		if (IsSoundWaveUsedBySource(SoundWave))
+		{
+			continue;
+		}
+
+		Entry.bPendingPromotion = false;
+
+		const uint32 DecodedBytes = GetDecodedSize(*SoundWave);
+		if (TotalCachedBytes + DecodedBytes > BudgetBytes)
+		{
+			// Make room by evicting the cached waves that are played less often than this one
+			const float PlayRate = GetPlayRate(Entry, Now);
+
+			TArray<TPair<float, FEntry*>> Evictable;
+			uint64 EvictableBytes = 0;
+			for (TPair<FGuid, FEntry>& OtherPair : Entries)
+			{
+				FEntry& Other = OtherPair.Value;
+				const float OtherPlayRate = GetPlayRate(Other, Now);
+				if (Other.CachedBytes > 0 && OtherPlayRate < PlayRate && !IsSoundWaveUsedBySource(Other.SoundWave))
+				{
+					Evictable.Emplace(OtherPlayRate, &Other);
+					EvictableBytes += Other.CachedBytes;
+				}
+			}
+
+			if (TotalCachedBytes - EvictableBytes + DecodedBytes > BudgetBytes)
+			{
+				continue;
+			}
+
+			Evictable.Sort([](const TPair<float, FEntry*>& A, const TPair<float, FEntry*>& B) { return A.Key < B.Key; });
+			for (const TPair<float, FEntry*>& Evicted : Evictable)
+			{
+				if (TotalCachedBytes + DecodedBytes <= BudgetBytes)
+				{
+					break;
+				}
+
+				// Go back to realtime decompression, freeing the resources also drops the wave from the cache
+				USoundWave* EvictedSoundWave = Evicted.Value->SoundWave;
+				AudioDeviceManager->FreeResource(EvictedSoundWave);
+				EvictedSoundWave->FreeResources(false);
+				Precache(EvictedSoundWave, true, true, false);
+
+				// Keep tracking how often it plays
+				Evicted.Value->SoundWave = EvictedSoundWave;
+			}
+		}
+
+		// Same as a wave below the decompression duration threshold
+		AudioDeviceManager->FreeResource(SoundWave);
+		SoundWave->FreeResources(false);
+		Precache(SoundWave, true, true, true);
+
+		Entry.SoundWave = SoundWave;
+		if (SoundWave->DecompressionType == DTYPE_Native && SoundWave->RawPCMData)
+		{
+			Entry.CachedBytes = SoundWave->RawPCMDataSize;
+			TotalCachedBytes += Entry.CachedBytes;
+		}
+	}
 }
 
 void FAudioDevice::UpdateReferencedSoundWaves()
@@ -4137,6 +4461,7 @@ void FAudioDevice::UpdateReferencedSoundWaves()
 void FAudioDevice::Update(bool bGameTicking)
 {
 	LLM_SCOPE(ELLMTag::AudioMisc);
+	SCOPE_PERFORMANCE_TRACKING_TIMER(Audio);
 
 	if (IsInGameThread())
 	{
@@ -4332,6 +4657,9 @@ void FAudioDevice::Update(bool bGameTicking)
 		ActiveWaveInstances.Reset();
 		FirstActiveIndex = GetSortedActiveWaveInstances(ActiveWaveInstances, (bGameTicking ? ESortedActiveWaveGetType::FullUpdate : ESortedActiveWaveGetType::PausedUpdate));
 
+		// Issue the occlusion traces requested while updating the active sounds
+		FActiveSound::FlushOcclusionTraces();
+
 		// Stop sources that need to be stopped, and touch the ones that need to be kept alive
 		StopSources(ActiveWaveInstances, FirstActiveIndex);
 
@@ -4857,9 +5185,18 @@ void FAudioDevice::ProcessingPendingActiveSoundStops(bool bForceDelete)
 
 void FAudioDevice::AddSoundToStop(FActiveSound* SoundToStop)
 {
-	check(IsInAudioThread());
 	check(SoundToStop);
 
+	if (bIsInWaveInstanceGather)
+	{
+		// Stopping unlinks the component and updates concurrency, done on the audio thread once the gather completes
+		FScopeLock Lock(&GatherSoundsToStopCritSec);
+		GatherSoundsToStop.Add(SoundToStop);
+		return;
+	}
+
+	check(IsInAudioThread());
+
 	bool bAlreadyPending = false;
 	PendingSoundsToStop.Add(SoundToStop, &bAlreadyPending);
 	if (!bAlreadyPending)
@@ -4877,6 +5214,11 @@ void FAudioDevice::AddSoundToStop(FActiveSound* SoundToStop)
 	}
 }
 
+bool FAudioDevice::IsInAudioThreadOrWaveInstanceGather()
+{
+	return bIsInWaveInstanceGather || IsInAudioThread();
+}
+
 bool FAudioDevice::IsPendingStop(FActiveSound* ActiveSound)
 {
 	check(IsInAudioThread());
@@ -5234,7 +5576,7 @@ bool FAudioDevice::SoundIsAudible(const FActiveSound& NewActiveSound)
 }
 int32 FAudioDevice::FindClosestListenerIndex(const FTransform& SoundTransform, const TArray<FListener>& InListeners)
 {
-	check(IsInAudioThread());
+	check(IsInAudioThreadOrWaveInstanceGather());
 	int32 ClosestListenerIndex = 0;
 	const bool bAllowAttenuationOverride = true;
 	if (InListeners.Num() > 0)
@@ -6035,7 +6377,7 @@ FSoundClassProperties* FAudioDevice::GetSoundClassCurrentProperties(USoundClass*
 {
 	if (InSoundClass)
 	{
-		check(IsInAudioThread());
+		check(IsInAudioThreadOrWaveInstanceGather());
 
 		FSoundClassProperties* Properties = SoundClasses.Find(InSoundClass);
 		return Properties;
@@ -6173,7 +6515,7 @@ void FAudioDevice::UnregisterPluginListener(const TAudioPluginListenerPtr Plugin
 
 bool FAudioDevice::IsAudioDeviceMuted() const
 {
-	check(IsInAudioThread());
+	check(IsInAudioThreadOrWaveInstanceGather());
 
 	// First check to see if the device manager has "bPlayAllPIEAudio" enabled
 	FAudioDeviceManager* DeviceManager = GEngine->GetAudioDeviceManager();
@@ -6206,7 +6548,7 @@ void FAudioDevice::SetDeviceMuted(const bool bMuted)
 
 FVector FAudioDevice::GetListenerTransformedDirection(const FVector& Position, float* OutDistance)
 {
-	check(IsInAudioThread());
+	check(IsInAudioThreadOrWaveInstanceGather());
 	FVector UnnormalizedDirection = InverseListenerTransform.TransformPosition(Position);
 	if (OutDistance)
 	{
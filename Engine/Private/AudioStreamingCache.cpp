@@ -85,6 +85,14 @@ FAutoConsoleVariableRef CVarStreamCacheSizeOverrideMB(
 	TEXT("0: use cache size from project settings. n: the new cache size in megabytes."),
 	ECVF_Default);
 
+static int32 PrefetchChunkCountCVar = 1;
+FAutoConsoleVariableRef CVarPrefetchChunkCount(
+	TEXT("au.streamcaching.PrefetchChunkCount"),
+	PrefetchChunkCountCVar,
+	TEXT("Number of chunks after the one being played that are requested in the cache ahead of playback. The first of them is kept over any other chunk when evicting.\n")
+	TEXT("0: Don't prefetch chunks. n: Number of chunks to prefetch."),
+	ECVF_Default);
+
 static FAutoConsoleCommand GFlushAudioCacheCommand(
 	TEXT("au.streamcaching.FlushAudioCache"),
 	TEXT("This will flush any non retained audio from the cache when Stream Caching is enabled."),
@@ -322,10 +330,10 @@ FAudioChunkHandle FCachedAudioStreamingManager::GetLoadedChunk(const USoundWave*
 		// The function call below increments the reference count to the internal chunk.
 		TArrayView<uint8> LoadedChunk = Cache->GetChunk(ChunkKey, bBlockForLoad, bForImmediatePlayback);
 
-		// Finally, if there's a chunk after this in the sound, request that it is in the cache.
-		const int32 NextChunk = GetNextChunkIndex(SoundWave, ChunkIndex);
+		// Finally, request that the chunks after this one in the sound are in the cache.
+		int32 NextChunk = GetNextChunkIndex(SoundWave, ChunkIndex);
 
-		if (NextChunk != INDEX_NONE)
+		for (int32 PrefetchIndex = 0; PrefetchIndex < PrefetchChunkCountCVar && NextChunk != INDEX_NONE && NextChunk != ChunkIndex; PrefetchIndex++)
 		{
 			const FAudioChunkCache::FChunkKey NextChunkKey = 
 			{ 
@@ -364,7 +372,17 @@ FAudioChunkHandle FCachedAudioStreamingManager::GetLoadedChunk(const USoundWave*
 
 					UE_LOG(LogAudio, Warning, TEXT("Removed %d retained sounds from the stream cache."), NumChunksReleased);
 				});
+
+				break;
 			}
+
+			// The chunk right after this one is the one this stream is going to need next.
+			if (PrefetchIndex == 0 && bForImmediatePlayback)
+			{
+				Cache->PrioritizeChunkForPlayback(NextChunkKey);
+			}
+
+			NextChunk = GetNextChunkIndex(SoundWave, NextChunk);
 		}
 
 		return BuildChunkHandle(LoadedChunk.GetData(), LoadedChunk.Num(), SoundWave, SoundWave->GetFName(), ChunkIndex);
@@ -603,6 +621,9 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, bool bBlock
 		// If this value is ever negative, it means that we're decrementing more than we're incrementing:
 		check(FoundElement->NumConsumers.GetValue() >= 0);
 		FoundElement->NumConsumers.Increment();
+
+		// The stream that needed this chunk now holds a reference to it.
+		FoundElement->bNeededSoonForPlayback = false;
 		return TArrayView<uint8>(FoundElement->ChunkData.GetData(), FoundElement->ChunkDataSize);
 	}
 	else
@@ -639,6 +660,16 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, bool bBlock
 	}
 }
 
+void FAudioChunkCache::PrioritizeChunkForPlayback(const FChunkKey& InKey)
+{
+	FScopeLock ScopeLock(&CacheMutationCriticalSection);
+
+	if (FCacheElement* FoundElement = FindElementForKey(InKey))
+	{
+		FoundElement->bNeededSoonForPlayback = true;
+	}
+}
+
 void FAudioChunkCache::AddNewReferenceToChunk(const FChunkKey& InKey)
 {
 	FCacheElement* FoundElement = FindElementForKey(InKey);
@@ -672,6 +703,7 @@ void FAudioChunkCache::ClearCache()
 		CachePool.Emplace(MaxChunkSize, Index);
 	}
 
+	ElementsByKey.Reset();
 	MostRecentElement = nullptr;
 	LeastRecentElement = nullptr;
 	ChunksInUse = 0;
@@ -694,13 +726,14 @@ uint64 FAudioChunkCache::TrimMemory(uint64 BytesToFree)
 	uint64 BytesFreed = 0;
 	while (CurrentElement != ElementToStopAt && BytesFreed < BytesToFree)
 	{
-		if (CurrentElement->CanEvictChunk())
+		if (CurrentElement->CanEvictChunk() && !CurrentElement->bNeededSoonForPlayback)
 		{
 			BytesFreed += CurrentElement->ChunkData.Num();
 			MemoryCounterBytes -= CurrentElement->ChunkData.Num();
 			// Empty the chunk data and invalidate the key.
 			CurrentElement->ChunkData.Empty();
 			CurrentElement->ChunkDataSize = 0;
+			ElementsByKey.Remove(CurrentElement->Key);
 			CurrentElement->Key = FChunkKey();
 
 #if DEBUG_STREAM_CACHE
@@ -872,36 +905,25 @@ FString FAudioChunkCache::FlushCacheMissLog()
 FAudioChunkCache::FCacheElement* FAudioChunkCache::FindElementForKey(const FChunkKey& InKey)
 {
 	FScopeLock ScopeLock(&CacheMutationCriticalSection);
-	FCacheElement* CurrentElement = MostRecentElement;
 
-#if DEBUG_STREAM_CACHE
-	// In debuggable situations, we breadcrumb how far down the cache the cache we were.
-	int32 ElementPosition = 0;
-#endif
+	FCacheElement* FoundElement = ElementsByKey.FindRef(InKey);
 
-	while (CurrentElement != nullptr)
-	{
-		if (InKey == CurrentElement->Key)
-		{
-			
 #if DEBUG_STREAM_CACHE
-			float& CMA = CurrentElement->DebugInfo.AverageLocationInCacheWhenNeeded;
-			CMA += ((ElementPosition - CMA) / (CurrentElement->DebugInfo.NumTimesTouched + 1));
-#endif
-
-			return CurrentElement;
-		}
-		else
+	// When profiling, we breadcrumb how far down the cache we were.
+	if (FoundElement && bLogCacheMisses)
+	{
+		int32 ElementPosition = 0;
+		for (const FCacheElement* CurrentElement = MostRecentElement; CurrentElement && CurrentElement != FoundElement; CurrentElement = CurrentElement->LessRecentElement)
 		{
-			CurrentElement = CurrentElement->LessRecentElement;
-
-#if DEBUG_STREAM_CACHE
 			ElementPosition++;
-#endif
 		}
+
+		float& CMA = FoundElement->DebugInfo.AverageLocationInCacheWhenNeeded;
+		CMA += ((ElementPosition - CMA) / (FoundElement->DebugInfo.NumTimesTouched + 1));
 	}
+#endif
 
-	return CurrentElement;
+	return FoundElement;
 }
 
 void FAudioChunkCache::TouchElement(FCacheElement* InElement)
@@ -1000,7 +1022,10 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::InsertChunk(const FChunkKey&
 
 		check(CacheElement);
 		CacheElement->bIsLoaded = false;
+		CacheElement->bNeededSoonForPlayback = false;
+		ElementsByKey.Remove(CacheElement->Key);
 		CacheElement->Key = InKey;
+		ElementsByKey.Add(InKey, CacheElement);
 		TouchElement(CacheElement);
 
 		// If we've got multiple chunks, we can not cache the least recent chunk
@@ -1032,7 +1057,7 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::EvictLeastRecentChunk()
 	FCacheElement* CacheElement = LeastRecentElement;
 
 	// If the least recent chunk is evictable, evict it.
-	if (CacheElement->CanEvictChunk())
+	if (CacheElement->CanEvictChunk() && !CacheElement->bNeededSoonForPlayback)
 	{
 		FCacheElement* NewLeastRecentElement = CacheElement->MoreRecentElement;
 		check(NewLeastRecentElement);
@@ -1047,34 +1072,40 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::EvictLeastRecentChunk()
 		// In order to avoid cycles, we always leave at least two chunks in the cache.
 		const FCacheElement* ElementToStopAt = MostRecentElement->LessRecentElement;
 
-		// Otherwise, we need to crawl up the cache from least recent used to most to find a chunk that is not in use:
-		while (CacheElement && CacheElement != ElementToStopAt)
+		// Otherwise, we need to crawl up the cache from least recent used to most to find a chunk that is not in use.
+		// Chunks a playing stream needs next are only evicted when there is nothing else left to evict.
+		CacheElement = FindEvictableChunk(ElementToStopAt, false);
+		if (!CacheElement)
 		{
-			if (CacheElement->CanEvictChunk())
-			{
-				// Link the two neighboring chunks:
-				if (CacheElement->MoreRecentElement)
-				{
-					CacheElement->MoreRecentElement->LessRecentElement = CacheElement->LessRecentElement;
-				}
-				
-				// If we ever hit this while loop it means that CacheElement is not the least recently used element.
-				check(CacheElement->LessRecentElement);
-				CacheElement->LessRecentElement->MoreRecentElement = CacheElement->MoreRecentElement;
-				break;
-			}
-			else
-			{
-				CacheElement = CacheElement->MoreRecentElement;
-			}
+			CacheElement = FindEvictableChunk(ElementToStopAt, true);
 		}
 
 		// If we ever hit this, it means that we couldn't find any cache elements that aren't in use.
-		if (!CacheElement || CacheElement == ElementToStopAt)
+		if (!CacheElement)
 		{
 			ensureMsgf(false, TEXT("Cache blown! Please increase the cache size or load less audio."));
 			return nullptr;
 		}
+
+		if (CacheElement == LeastRecentElement)
+		{
+			FCacheElement* NewLeastRecentElement = CacheElement->MoreRecentElement;
+			check(NewLeastRecentElement);
+
+			LeastRecentElement = NewLeastRecentElement;
+		}
+		else
+		{
+			// Link the two neighboring chunks:
+			if (CacheElement->MoreRecentElement)
+			{
+				CacheElement->MoreRecentElement->LessRecentElement = CacheElement->LessRecentElement;
+			}
+
+			// If we ever hit this it means that CacheElement is not the least recently used element.
+			check(CacheElement->LessRecentElement);
+			CacheElement->LessRecentElement->MoreRecentElement = CacheElement->MoreRecentElement;
+		}
 	}
 
 #if DEBUG_STREAM_CACHE
@@ -1085,6 +1116,22 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::EvictLeastRecentChunk()
 	return CacheElement;
 }
 
+FAudioChunkCache::FCacheElement* FAudioChunkCache::FindEvictableChunk(const FCacheElement* ElementToStopAt, bool bEvictNeededSoonForPlayback) const
+{
+	FCacheElement* CacheElement = LeastRecentElement;
+	while (CacheElement && CacheElement != ElementToStopAt)
+	{
+		if (CacheElement->CanEvictChunk() && (bEvictNeededSoonForPlayback || !CacheElement->bNeededSoonForPlayback))
+		{
+			return CacheElement;
+		}
+
+		CacheElement = CacheElement->MoreRecentElement;
+	}
+
+	return nullptr;
+}
+
 void FAudioChunkCache::KickOffAsyncLoad(FCacheElement* CacheElement, const FChunkKey& InKey, TFunction<void(EAudioChunkLoadResult)> OnLoadCompleted, ENamedThreads::Type CallbackThread, bool bNeededForPlayback)
 {
 	LLM_SCOPE(ELLMTag::Audio);
@@ -94,6 +94,40 @@ void FBatchedElements::AddTranslucentLine(const FVector& Start, const FVector& E
 	}
 }
 
+void FBatchedLineSet::AddLine(const FVector& Start, const FVector& End, const FLinearColor& Color, FHitProxyId HitProxyId)
+{
+	check(!IsInitialized());
+
+	// Ensure the line isn't masked out.  Some legacy code relies on Color.A being ignored.
+	FLinearColor OpaqueColor(Color);
+	OpaqueColor.A = 1;
+
+	new(Vertices) FSimpleElementVertex(Start, FVector2D::ZeroVector, OpaqueColor, HitProxyId);
+	new(Vertices) FSimpleElementVertex(End, FVector2D::ZeroVector, OpaqueColor, HitProxyId);
+	NumLines++;
+}
+
+void FBatchedLineSet::InitRHI()
+{
+	if (Vertices.Num() > 0)
+	{
+		FRHIResourceCreateInfo CreateInfo;
+		const uint32 Size = Vertices.Num() * sizeof(FSimpleElementVertex);
+		VertexBufferRHI = RHICreateVertexBuffer(Size, BUF_Static, CreateInfo);
+		void* VoidPtr = RHILockVertexBuffer(VertexBufferRHI, 0, Size, RLM_WriteOnly);
+		FMemory::Memcpy(VoidPtr, Vertices.GetData(), Size);
+		RHIUnlockVertexBuffer(VertexBufferRHI);
+	}
+}
+
+void FBatchedElements::AddLineSet(const FBatchedLineSet* LineSet, const FMatrix& LocalToWorld)
+{
+	if (LineSet && LineSet->GetNumLines() > 0)
+	{
+		LineSets.Add({ LineSet, LocalToWorld });
+	}
+}
+
 void FBatchedElements::AddPoint(const FVector& Position,float Size,const FLinearColor& Color,FHitProxyId HitProxyId)
 {
 	// Ensure the point isn't masked out.  Some legacy code relies on Color.A being ignored.
@@ -809,7 +843,7 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 		GraphicsPSOInit.PrimitiveType = PT_TriangleList;
 		GraphicsPSOInit.RasterizerState = TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
 
-		if( (LineVertices.Num() > 0 || Points.Num() > 0 || ThickLines.Num() > 0 || WireTris.Num() > 0)
+		if( (LineVertices.Num() > 0 || LineSets.Num() > 0 || Points.Num() > 0 || ThickLines.Num() > 0 || WireTris.Num() > 0)
 			&& (Filter & EBlendModeFilter::OpaqueAndMasked))
 		{
 			// Lines/points don't support batched element parameters (yet!)
@@ -851,6 +885,28 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 				VertexBufferRHI.SafeRelease();
 			}
 
+			// Draw the static line sets straight from their own vertex buffers
+			for (const FBatchedLineSetElement& LineSetElement : LineSets)
+			{
+				const FBatchedLineSet* LineSet = LineSetElement.LineSet;
+				if (!LineSet->IsInitialized() || !LineSet->VertexBufferRHI.IsValid())
+				{
+					continue;
+				}
+
+				GraphicsPSOInit.PrimitiveType = PT_LineList;
+
+				PrepareShaders(RHICmdList, GraphicsPSOInit, FeatureLevel, SE_BLEND_Opaque, LineSetElement.LocalToWorld * Transform, bNeedToSwitchVerticalAxis, BatchedElementParameters, GWhiteTexture, bHitTesting, Gamma, NULL, &View);
+				RHICmdList.SetStencilRef(StencilRef);
+				RHICmdList.SetStreamSource(0, LineSet->VertexBufferRHI, 0);
+
+				const int32 MaxLinesAllowed = FMath::Min<int32>((GDrawUPVertexCheckCount / sizeof(FSimpleElementVertex)) / 2, 32 * 1024);
+				for (int32 FirstLine = 0; FirstLine < LineSet->GetNumLines(); FirstLine += MaxLinesAllowed)
+				{
+					RHICmdList.DrawPrimitive(FirstLine * 2, FMath::Min(MaxLinesAllowed, LineSet->GetNumLines() - FirstLine), 1);
+				}
+			}
+
 			GraphicsPSOInit.PrimitiveType = PT_TriangleList;
 
 			// Set the appropriate pixel shader parameters & shader state for the non-textured elements.
@@ -1188,6 +1244,7 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 void FBatchedElements::Clear()
 {
 	LineVertices.Empty();
+	LineSets.Empty();
 	Points.Empty();
 	Sprites.Empty();
 	MeshElements.Empty();
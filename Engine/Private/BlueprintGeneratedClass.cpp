@@ -50,6 +50,14 @@ static FAutoConsoleVariableRef CVarBlueprintComponentInstancingFastPathDisabled(
 	ECVF_Default
 );
 
+int32 GBlueprintMergePostConstructionPropertyCopies = 1;
+static FAutoConsoleVariableRef CVarBlueprintMergePostConstructionPropertyCopies(
+	TEXT("bp.MergePostConstructionPropertyCopies"),
+	GBlueprintMergePostConstructionPropertyCopies,
+	TEXT("If non-zero, the plain old data properties a Blueprint class initializes after construction are copied as merged memory ranges instead of one by one."),
+	ECVF_Default
+);
+
 UBlueprintGeneratedClass::UBlueprintGeneratedClass(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 #if VALIDATE_UBER_GRAPH_PERSISTENT_FRAME
@@ -606,6 +614,8 @@ void UBlueprintGeneratedClass::UpdateCustomPropertyListForPostConstruction()
 {
 	// Empty the current list.
 	CustomPropertyListForPostConstruction.Empty();
+	CustomPropertyCopyRangesForPostConstruction.Reset();
+	CustomPropertyNodesForPostConstruction.Reset();
 	bCustomPropertyListForPostConstructionInitialized = false;
 
 	// Find the first native antecedent. All non-native decendant properties are attached to the PostConstructLink chain (see UStruct::Link), so we only need to worry about properties owned by native super classes here.
@@ -622,11 +632,53 @@ void UBlueprintGeneratedClass::UpdateCustomPropertyListForPostConstruction()
 		// Recursively gather native class-owned property values that differ from defaults.
 		FCustomPropertyListNode* PropertyList = nullptr;
 		BuildCustomPropertyListForPostConstruction(PropertyList, SuperClass, (uint8*)ClassDefaultObject, (uint8*)SuperClass->GetDefaultObject(false));
+
+		CompileCustomPropertyListForPostConstruction(PropertyList, 0);
+
+		// The list follows the property link order, sort the ranges by offset to merge the adjacent ones
+		CustomPropertyCopyRangesForPostConstruction.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+		int32 NumMergedRanges = 0;
+		for (const TPair<int32, int32>& CopyRange : CustomPropertyCopyRangesForPostConstruction)
+		{
+			if (NumMergedRanges > 0 && CustomPropertyCopyRangesForPostConstruction[NumMergedRanges - 1].Key + CustomPropertyCopyRangesForPostConstruction[NumMergedRanges - 1].Value == CopyRange.Key)
+			{
+				CustomPropertyCopyRangesForPostConstruction[NumMergedRanges - 1].Value += CopyRange.Value;
+			}
+			else
+			{
+				CustomPropertyCopyRangesForPostConstruction[NumMergedRanges++] = CopyRange;
+			}
+		}
+		CustomPropertyCopyRangesForPostConstruction.SetNum(NumMergedRanges);
 	}
 
 	bCustomPropertyListForPostConstructionInitialized = true;
 }
 
+void UBlueprintGeneratedClass::CompileCustomPropertyListForPostConstruction(const FCustomPropertyListNode* InPropertyList, int32 BaseOffset)
+{
+	for (const FCustomPropertyListNode* CustomPropertyListNode = InPropertyList; CustomPropertyListNode; CustomPropertyListNode = CustomPropertyListNode->PropertyListNext)
+	{
+		const FProperty* Property = CustomPropertyListNode->Property;
+		const int32 Offset = BaseOffset + Property->GetOffset_ForInternal() + Property->ElementSize * CustomPropertyListNode->ArrayIndex;
+
+		if (CustomPropertyListNode->SubPropertyList && Property->IsA<FStructProperty>())
+		{
+			// Struct members are at fixed offsets in the object as well
+			CompileCustomPropertyListForPostConstruction(CustomPropertyListNode->SubPropertyList, Offset);
+		}
+		else if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData) && !Property->IsA<FBoolProperty>())
+		{
+			// Bools are left to their node, bitfields share their byte with other properties
+			CustomPropertyCopyRangesForPostConstruction.Emplace(Offset, Property->ElementSize);
+		}
+		else
+		{
+			CustomPropertyNodesForPostConstruction.Emplace(CustomPropertyListNode, BaseOffset);
+		}
+	}
+}
+
 void UBlueprintGeneratedClass::SetupObjectInitializer(FObjectInitializer& ObjectInitializer) const
 {
 	for (const FBPComponentClassOverride& Override : ComponentClassOverrides)
@@ -642,7 +694,19 @@ void UBlueprintGeneratedClass::InitPropertiesFromCustomList(uint8* DataPtr, cons
 	FScopeLock SerializeAndPostLoadLock(&SerializeAndPostLoadCritical);
 	check(bCustomPropertyListForPostConstructionInitialized); // Something went wrong, probably a race condition
 
-	if (const FCustomPropertyListNode* CustomPropertyList = GetCustomPropertyListForPostConstruction())
+	if (GBlueprintMergePostConstructionPropertyCopies)
+	{
+		for (const TPair<int32, int32>& CopyRange : CustomPropertyCopyRangesForPostConstruction)
+		{
+			FMemory::Memcpy(DataPtr + CopyRange.Key, DefaultDataPtr + CopyRange.Key, CopyRange.Value);
+		}
+
+		for (const TPair<const FCustomPropertyListNode*, int32>& CustomPropertyNode : CustomPropertyNodesForPostConstruction)
+		{
+			InitPropertyFromCustomListNode(CustomPropertyNode.Key, DataPtr + CustomPropertyNode.Value, DefaultDataPtr + CustomPropertyNode.Value);
+		}
+	}
+	else if (const FCustomPropertyListNode* CustomPropertyList = GetCustomPropertyListForPostConstruction())
 	{
 		InitPropertiesFromCustomList(CustomPropertyList, this, DataPtr, DefaultDataPtr);
 	}
@@ -652,31 +716,36 @@ void UBlueprintGeneratedClass::InitPropertiesFromCustomList(const FCustomPropert
 {
 	for (const FCustomPropertyListNode* CustomPropertyListNode = InPropertyList; CustomPropertyListNode; CustomPropertyListNode = CustomPropertyListNode->PropertyListNext)
 	{
-		uint8* PropertyValue = CustomPropertyListNode->Property->ContainerPtrToValuePtr<uint8>(DataPtr, CustomPropertyListNode->ArrayIndex);
-		const uint8* DefaultPropertyValue = CustomPropertyListNode->Property->ContainerPtrToValuePtr<uint8>(DefaultDataPtr, CustomPropertyListNode->ArrayIndex);
+		InitPropertyFromCustomListNode(CustomPropertyListNode, DataPtr, DefaultDataPtr);
+	}
+}
 
-		if (const FStructProperty* StructProperty = CastField<FStructProperty>(CustomPropertyListNode->Property))
-		{
-			if (CustomPropertyListNode->SubPropertyList != nullptr)
-			{
-				InitPropertiesFromCustomList(CustomPropertyListNode->SubPropertyList, StructProperty->Struct, PropertyValue, DefaultPropertyValue);
-			}
-			else
-			{
-				// A NULL sub-property list indicates that we should copy the entire default value (e.g. a struct with one or more non-reflected fields).
-				StructProperty->CopySingleValue(PropertyValue, DefaultPropertyValue);
-			}
-		}
-		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(CustomPropertyListNode->Property))
+void UBlueprintGeneratedClass::InitPropertyFromCustomListNode(const FCustomPropertyListNode* InPropertyNode, uint8* DataPtr, const uint8* DefaultDataPtr)
+{
+	uint8* PropertyValue = InPropertyNode->Property->ContainerPtrToValuePtr<uint8>(DataPtr, InPropertyNode->ArrayIndex);
+	const uint8* DefaultPropertyValue = InPropertyNode->Property->ContainerPtrToValuePtr<uint8>(DefaultDataPtr, InPropertyNode->ArrayIndex);
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(InPropertyNode->Property))
+	{
+		if (InPropertyNode->SubPropertyList != nullptr)
 		{
-			// Note: The sub-property list can be NULL here; in that case only the array size will differ from the default value, but the elements themselves will simply be initialized to defaults.
-			InitArrayPropertyFromCustomList(ArrayProperty, CustomPropertyListNode->SubPropertyList, PropertyValue, DefaultPropertyValue);
+			InitPropertiesFromCustomList(InPropertyNode->SubPropertyList, StructProperty->Struct, PropertyValue, DefaultPropertyValue);
 		}
 		else
 		{
-			CustomPropertyListNode->Property->CopySingleValue(PropertyValue, DefaultPropertyValue);
+			// A NULL sub-property list indicates that we should copy the entire default value (e.g. a struct with one or more non-reflected fields).
+			StructProperty->CopySingleValue(PropertyValue, DefaultPropertyValue);
 		}
 	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InPropertyNode->Property))
+	{
+		// Note: The sub-property list can be NULL here; in that case only the array size will differ from the default value, but the elements themselves will simply be initialized to defaults.
+		InitArrayPropertyFromCustomList(ArrayProperty, InPropertyNode->SubPropertyList, PropertyValue, DefaultPropertyValue);
+	}
+	else
+	{
+		InPropertyNode->Property->CopySingleValue(PropertyValue, DefaultPropertyValue);
+	}
 }
 
 void UBlueprintGeneratedClass::InitArrayPropertyFromCustomList(const FArrayProperty* ArrayProperty, const FCustomPropertyListNode* InPropertyList, uint8* DataPtr, const uint8* DefaultDataPtr)
@@ -16,6 +16,7 @@ FBoneContainer::FBoneContainer()
 , AssetSkeletalMesh(nullptr)
 , AssetSkeleton(nullptr)
 , RefSkeleton(nullptr)
+, UIDToArrayIndexLUTValidCount(0)
 , bDisableRetargeting(false)
 , bUseRAWData(false)
 , bUseSourceData(false)
@@ -32,6 +33,7 @@ FBoneContainer::FBoneContainer(const TArray<FBoneIndexType>& InRequiredBoneIndex
 , AssetSkeletalMesh(nullptr)
 , AssetSkeleton(nullptr)
 , RefSkeleton(nullptr)
+, UIDToArrayIndexLUTValidCount(0)
 , bDisableRetargeting(false)
 , bUseRAWData(false)
 , bUseSourceData(false)
@@ -198,6 +200,7 @@ void FBoneContainer::CacheRequiredAnimCurveUids(const FCurveEvaluationOption& Cu
 		if (Mapping != nullptr)
 		{
 			UIDToArrayIndexLUT.Reset();
+			UIDToArrayIndexLUTValidCount = 0;
 			
 			const SmartName::UID_Type MaxUID = Mapping->GetMaxUID();
 
@@ -283,12 +286,14 @@ void FBoneContainer::CacheRequiredAnimCurveUids(const FCurveEvaluationOption& Cu
 						UIDToArrayIndexLUT[CurveNameIndex] = NumAvailableUIDs++;
 					}
 				}
+				UIDToArrayIndexLUTValidCount = NumAvailableUIDs;
 			}
 		}
 	}
 	else
 	{
 		UIDToArrayIndexLUT.Reset();
+		UIDToArrayIndexLUTValidCount = 0;
 	}
 }
 
@@ -58,6 +58,8 @@ static TAutoConsoleVariable<int32> GFPSChartDoCsvProfile(
 	0,
 	TEXT("Whether to record a CSV profile when recording FPSChart data\n")
 	TEXT(" default: 0"));
+
+CSV_DEFINE_CATEGORY(PerformanceTrackingTimers, true);
 #endif // FPS_CHART_SUPPORT_CSV_PROFILE
 
 float GMaximumFrameTimeToConsiderForHitchesAndBinning = 10.0f;
@@ -150,6 +152,33 @@ void FDumpFPSChartToEndpoint::HandleDynamicResThreshold(int32 TargetScreenPercen
 }
 
 
+/** Percentiles reported for each subsystem timer */
+struct FSubsystemTimerPercentile
+{
+	const TCHAR* Name;
+	double Percentile;
+};
+
+static const FSubsystemTimerPercentile GSubsystemTimerPercentiles[] =
+{
+	{ TEXT("P50"), 0.5 },
+	{ TEXT("P95"), 0.95 },
+	{ TEXT("P99"), 0.99 },
+	{ TEXT("P999"), 0.999 },
+};
+
+void FDumpFPSChartToEndpoint::HandleSubsystemTimer(FName TimerName, const FHistogram& TimeHistogram)
+{
+	const double SecondsToMS = 1000.0;
+
+	FString Line = FString::Printf(TEXT("%s time: avg %4.2f ms"), *TimerName.ToString(), SecondsToMS * TimeHistogram.GetSumOfAllMeasures() / TimeHistogram.GetNumMeasurements());
+	for (const FSubsystemTimerPercentile& Percentile : GSubsystemTimerPercentiles)
+	{
+		Line += FString::Printf(TEXT(", %s %4.2f ms"), Percentile.Name, SecondsToMS * FPerformanceTrackingChart::GetHistogramPercentile(TimeHistogram, Percentile.Percentile));
+	}
+	PrintToEndpoint(Line);
+}
+
 void FDumpFPSChartToEndpoint::HandleBasicStats()
 {
 	PrintToEndpoint(FString::Printf(TEXT("--- Begin : FPS chart dump for level '%s'"), *MapName));
@@ -278,6 +307,16 @@ void FDumpFPSChartToEndpoint::DumpChart(double InWallClockTimeFromStartOfChartin
 
 		HandleDynamicResThreshold(MinScreenPercentage, PctTimeAbove);
 	}
+
+	// Dump subsystem timers
+	for (int32 TimerIndex = 0; TimerIndex < Chart.SubsystemTimeHistograms.Num(); ++TimerIndex)
+	{
+		const FHistogram& TimeHistogram = Chart.SubsystemTimeHistograms[TimerIndex];
+		if (TimeHistogram.GetNumMeasurements() > 0)
+		{
+			HandleSubsystemTimer(FPerformanceTrackingTimers::GetTimerName(TimerIndex), TimeHistogram);
+		}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -369,6 +408,18 @@ protected:
 		ParamArray.Add(FAnalyticsEventAttribute(ParamName, ParamValue));
 	}
 
+	virtual void HandleSubsystemTimer(FName TimerName, const FHistogram& TimeHistogram) override
+	{
+		const double SecondsToMS = 1000.0;
+		const FString ParamNameBase = TimerName.ToString();
+
+		ParamArray.Add(FAnalyticsEventAttribute(ParamNameBase + TEXT("AvgTime"), FString::Printf(TEXT("%4.2f"), SecondsToMS * TimeHistogram.GetSumOfAllMeasures() / TimeHistogram.GetNumMeasurements())));
+		for (const FSubsystemTimerPercentile& Percentile : GSubsystemTimerPercentiles)
+		{
+			ParamArray.Add(FAnalyticsEventAttribute(ParamNameBase + Percentile.Name, FString::Printf(TEXT("%4.2f"), SecondsToMS * FPerformanceTrackingChart::GetHistogramPercentile(TimeHistogram, Percentile.Percentile))));
+		}
+	}
+
 	virtual void HandleBasicStats() override
 	{
 		// Add non-bucket params
@@ -595,6 +646,52 @@ FPerformanceTrackingChart::~FPerformanceTrackingChart()
 	}
 }
 
+/** Logarithmic bins with four sub-bins per power of two from 1/64 ms to 8 s, so percentiles are estimated within a few percent at any scale */
+static void InitSubsystemTimeHistogram(FHistogram& Histogram)
+{
+	const double MSToSeconds = 1.0 / 1000.0;
+
+	FHistogramBuilder Builder(Histogram, 0.0);
+	Builder.AddBin(MSToSeconds / 64.0);
+	for (double PowerOfTwoMS = 1.0 / 64.0; PowerOfTwoMS < 8192.0; PowerOfTwoMS *= 2.0)
+	{
+		for (int32 SubBinIndex = 1; SubBinIndex <= 4; ++SubBinIndex)
+		{
+			Builder.AddBin(PowerOfTwoMS * (1.0 + 0.25 * SubBinIndex) * MSToSeconds);
+		}
+	}
+}
+
+double FPerformanceTrackingChart::GetHistogramPercentile(const FHistogram& Histogram, double Percentile)
+{
+	const int64 NumMeasurements = Histogram.GetNumMeasurements();
+	if (NumMeasurements == 0)
+	{
+		return 0.0;
+	}
+
+	// Find the bin holding the measurement of that rank and interpolate within it
+	const double TargetRank = FMath::Clamp(Percentile, 0.0, 1.0) * NumMeasurements;
+	int64 Rank = 0;
+	for (int32 NumBins = Histogram.GetNumBins(), BinIndex = 0; BinIndex < NumBins; ++BinIndex)
+	{
+		const int64 BinCount = Histogram.GetBinObservationsCount(BinIndex);
+		if (BinCount > 0 && Rank + BinCount >= TargetRank)
+		{
+			const double UpperBound = Histogram.GetBinUpperBound(BinIndex);
+			if (UpperBound == FLT_MAX)
+			{
+				// The last bin is open ended, its average is the best we have
+				return Histogram.GetBinObservationsSum(BinIndex) / BinCount;
+			}
+			return FMath::Lerp(Histogram.GetBinLowerBound(BinIndex), UpperBound, (TargetRank - Rank) / BinCount);
+		}
+		Rank += BinCount;
+	}
+
+	return Histogram.GetBinLowerBound(Histogram.GetNumBins() - 1);
+}
+
 // Discard all accumulated data
 void FPerformanceTrackingChart::Reset(const FDateTime& InStartTime)
 {
@@ -656,6 +753,9 @@ void FPerformanceTrackingChart::Reset(const FDateTime& InStartTime)
 		}
 	}
 
+	// Subsystem time histograms are added as timers are first seen, timers can be registered at any time
+	SubsystemTimeHistograms.Reset();
+
 	StartTemperatureLevel = -1.0f;
 	StopTemperatureLevel = -1.0f;
 
@@ -670,6 +770,14 @@ void FPerformanceTrackingChart::AccumulateWith(const FPerformanceTrackingChart&
 {
 	FrametimeHistogram += Chart.FrametimeHistogram;
 	HitchTimeHistogram += Chart.HitchTimeHistogram;
+	for (int32 TimerIndex = 0; TimerIndex < Chart.SubsystemTimeHistograms.Num(); ++TimerIndex)
+	{
+		if (!SubsystemTimeHistograms.IsValidIndex(TimerIndex))
+		{
+			InitSubsystemTimeHistogram(SubsystemTimeHistograms.AddDefaulted_GetRef());
+		}
+		SubsystemTimeHistograms[TimerIndex] += Chart.SubsystemTimeHistograms[TimerIndex];
+	}
 	NumFramesBound_GameThread += Chart.NumFramesBound_GameThread;
 	NumFramesBound_RenderThread += Chart.NumFramesBound_RenderThread;
 	NumFramesBound_RHIThread += Chart.NumFramesBound_RHIThread;
@@ -822,6 +930,15 @@ void FPerformanceTrackingChart::ProcessFrame(const FFrameData& FrameData)
 			}
 		}
 		DynamicResHistogram.AddMeasurement(FrameData.DynamicResolutionScreenPercentage);
+
+		for (int32 TimerIndex = 0; TimerIndex < FrameData.SubsystemTimeSeconds.Num(); ++TimerIndex)
+		{
+			if (!SubsystemTimeHistograms.IsValidIndex(TimerIndex))
+			{
+				InitSubsystemTimeHistogram(SubsystemTimeHistograms.AddDefaulted_GetRef());
+			}
+			SubsystemTimeHistograms[TimerIndex].AddMeasurement(FrameData.SubsystemTimeSeconds[TimerIndex]);
+		}
 	}
 	else
 	{
@@ -1239,6 +1356,17 @@ IPerformanceDataConsumer::FFrameData FPerformanceTrackingSystem::AnalyzeFrame(fl
 	FrameData.FlushAsyncLoadingCount = GFlushAsyncLoadingCount;
 	FrameData.SyncLoadCount = GSyncLoadCount;
 
+	FPerformanceTrackingTimers::ConsumeFrameTimes(FrameData.SubsystemTimeSeconds);
+#if FPS_CHART_SUPPORT_CSV_PROFILE
+	if (FCsvProfiler::Get()->IsCapturing())
+	{
+		for (int32 TimerIndex = 0; TimerIndex < FrameData.SubsystemTimeSeconds.Num(); ++TimerIndex)
+		{
+			FCsvProfiler::Get()->RecordCustomStat(FPerformanceTrackingTimers::GetTimerName(TimerIndex), CSV_CATEGORY_INDEX(PerformanceTrackingTimers), (float)(FrameData.SubsystemTimeSeconds[TimerIndex] * 1000.0), ECsvCustomStatOp::Set);
+		}
+	}
+#endif
+
 	// Optionally disregard frames that took too long when accumulating data.
 	FrameData.bBinThisFrame = (DeltaSeconds < GMaximumFrameTimeToConsiderForHitchesAndBinning) || (GMaximumFrameTimeToConsiderForHitchesAndBinning <= 0.0f);
 	// We don't measure boundedness of a frame we are disregarding.
@@ -1394,6 +1522,8 @@ void UEngine::TickPerformanceMonitoring(float DeltaSeconds)
 	FPlatformMisc::CustomNamedStat("MemoryUsed", (float)FPlatformMemory::GetMemoryUsedFast(), "Memory", "Bytes");
 #endif // !UE_BUILD_SHIPPING
 
+	FHitchCapture::EndFrame();
+
 	if (ActivePerformanceDataConsumers.Num() > 0)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_ProcessActivePerfDataConsumers);
@@ -1416,6 +1546,7 @@ void UEngine::AddPerformanceDataConsumer(TSharedPtr<IPerformanceDataConsumer> Co
 	{
 		GPerformanceTrackingSystem = FPerformanceTrackingSystem();
 		GPerformanceTrackingSystem.StartCharting();
+		FPerformanceTrackingTimers::SetEnabled(true);
 	}
 
 	Consumer->StartCharting();
@@ -1430,6 +1561,7 @@ void UEngine::RemovePerformanceDataConsumer(TSharedPtr<IPerformanceDataConsumer>
 	if (ActivePerformanceDataConsumers.Num() == 0)
 	{
 		GPerformanceTrackingSystem.StopCharting();
+		FPerformanceTrackingTimers::SetEnabled(false);
 	}
 }
 
@@ -118,10 +118,24 @@ void FKAggregateGeom::CalcBoxSphereBounds(FBoxSphereBounds& Output, const FTrans
 		for (int32 i = 0; i < ConvexElems.Num(); i++)
 		{
 			const FKConvexElem& Elem = ConvexElems[i];
-			for (int32 j = 0; j < Elem.VertexData.Num(); ++j)
+			if (INTEL_ISPC)
 			{
-				const FVector Point = LocalToWorld.TransformPosition(Elem.VertexData[j]);
-				RadiusSquared = FMath::Max(RadiusSquared, (Point - Origin).SizeSquared());
+#if INTEL_ISPC
+				ispc::ConvexCalcRadiusSquared(
+					RadiusSquared,
+					(ispc::FVector*)Elem.VertexData.GetData(),
+					Elem.VertexData.Num(),
+					(ispc::FTransform&)LocalToWorld,
+					(ispc::FVector&)Origin);
+#endif
+			}
+			else
+			{
+				for (int32 j = 0; j < Elem.VertexData.Num(); ++j)
+				{
+					const FVector Point = LocalToWorld.TransformPosition(Elem.VertexData[j]);
+					RadiusSquared = FMath::Max(RadiusSquared, (Point - Origin).SizeSquared());
+				}
 			}
 		}
 
@@ -548,9 +562,21 @@ void FKConvexElem::UpdateElemBox()
 #endif
 
 	ElemBox.Init();
-	for(int32 j=0; j<VertexData.Num(); j++)
+	if (INTEL_ISPC && VertexData.Num() > 0)
 	{
-		ElemBox += VertexData[j];
+#if INTEL_ISPC
+		ispc::ConvexCalcElemBox(
+			(ispc::FBox&)ElemBox,
+			(ispc::FVector*)VertexData.GetData(),
+			VertexData.Num());
+#endif
+	}
+	else
+	{
+		for(int32 j=0; j<VertexData.Num(); j++)
+		{
+			ElemBox += VertexData[j];
+		}
 	}
 }
 
@@ -13,6 +13,7 @@
 #include "Collision/CollisionConversions.h"
 #include "PhysicsEngine/ScopedSQHitchRepeater.h"
 #include "PhysicsInterfaceDeclaresCore.h"
+#include "StaticCollisionStore.h"
 
 #if PHYSICS_INTERFACE_PHYSX
 #include "PhysXInterfaceWrapper.h"
@@ -440,6 +441,13 @@ bool TSceneCastCommon(const UWorld* World, typename Traits::TOutHits& OutHits, c
 //////////////////////////////////////////////////////////////////////////
 // RAYCAST
 
+/** Traces the world's static collision store, see UPrimitiveComponent::bUseStaticCollisionStore. Only blocking hits closer than MaxTime are reported. */
+static bool RaycastStaticCollisionStore(const UWorld* World, FHitResult& OutHit, const FVector& Start, const FVector& End, float MaxTime, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams, const struct FCollisionObjectQueryParams& ObjectParams, bool bAnyHit)
+{
+	FStaticCollisionStore* Store = World ? World->GetStaticCollisionStore() : nullptr;
+	return Store && Store->Raycast(OutHit, Start, End, MaxTime, TraceChannel, Params, ResponseParams, ObjectParams, bAnyHit);
+}
+
 bool FGenericPhysicsInterface::RaycastTest(const UWorld* World, const FVector Start, const FVector End, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams, const struct FCollisionObjectQueryParams& ObjectParams)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Collision_SceneQueryTotal);
@@ -448,7 +456,12 @@ bool FGenericPhysicsInterface::RaycastTest(const UWorld* World, const FVector St
 
 	using TCastTraits = TSQTraits<FHitRaycast, ESweepOrRay::Raycast, ESingleMultiOrTest::Test>;
 	FHitResult DummyHit(NoInit);
-	return TSceneCastCommon<TCastTraits>(World, DummyHit, FRaycastSQAdditionalInputs(), Start, End, TraceChannel, Params, ResponseParams, ObjectParams);
+	if (TSceneCastCommon<TCastTraits>(World, DummyHit, FRaycastSQAdditionalInputs(), Start, End, TraceChannel, Params, ResponseParams, ObjectParams))
+	{
+		return true;
+	}
+
+	return RaycastStaticCollisionStore(World, DummyHit, Start, End, 1.f, TraceChannel, Params, ResponseParams, ObjectParams, true);
 }
 
 bool FGenericPhysicsInterface::RaycastSingle(const UWorld* World, struct FHitResult& OutHit, const FVector Start, const FVector End, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams, const struct FCollisionObjectQueryParams& ObjectParams)
@@ -458,7 +471,11 @@ bool FGenericPhysicsInterface::RaycastSingle(const UWorld* World, struct FHitRes
 	CSV_SCOPED_TIMING_STAT(SceneQuery, RaycastSingle);
 
 	using TCastTraits = TSQTraits<FHitRaycast, ESweepOrRay::Raycast, ESingleMultiOrTest::Single>;
-	return TSceneCastCommon<TCastTraits>(World, OutHit, FRaycastSQAdditionalInputs(), Start, End, TraceChannel, Params, ResponseParams, ObjectParams);
+	const bool bBlockingHit = TSceneCastCommon<TCastTraits>(World, OutHit, FRaycastSQAdditionalInputs(), Start, End, TraceChannel, Params, ResponseParams, ObjectParams);
+
+	// The closer of the two hits wins
+	const float MaxTime = bBlockingHit ? OutHit.Time : 1.f;
+	return RaycastStaticCollisionStore(World, OutHit, Start, End, MaxTime, TraceChannel, Params, ResponseParams, ObjectParams, false) || bBlockingHit;
 }
 
 
@@ -470,7 +487,18 @@ bool FGenericPhysicsInterface::RaycastMulti(const UWorld* World, TArray<struct F
 	CSV_SCOPED_TIMING_STAT(SceneQuery, RaycastMultiple);
 
 	using TCastTraits = TSQTraits<FHitRaycast, ESweepOrRay::Raycast, ESingleMultiOrTest::Multi>;
-	return TSceneCastCommon<TCastTraits> (World, OutHits, FRaycastSQAdditionalInputs(), Start, End, TraceChannel, Params, ResponseParams, ObjectParams);
+	const bool bBlockingHit = TSceneCastCommon<TCastTraits> (World, OutHits, FRaycastSQAdditionalInputs(), Start, End, TraceChannel, Params, ResponseParams, ObjectParams);
+
+	// Hits are sorted with the blocking one last. A closer blocking hit from the store replaces it, along with the touches past it.
+	const float MaxTime = bBlockingHit ? OutHits.Last().Time : 1.f;
+	FHitResult StoreHit;
+	if (RaycastStaticCollisionStore(World, StoreHit, Start, End, MaxTime, TraceChannel, Params, ResponseParams, ObjectParams, false))
+	{
+		OutHits.RemoveAll([&StoreHit](const FHitResult& Hit) { return Hit.bBlockingHit || Hit.Time >= StoreHit.Time; });
+		OutHits.Add(StoreHit);
+		return true;
+	}
+	return bBlockingHit;
 }
 
 //////////////////////////////////////////////////////////////////////////
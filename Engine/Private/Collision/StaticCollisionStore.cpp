@@ -0,0 +1,666 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StaticCollisionStore.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "CollisionQueryParams.h"
+
+DECLARE_CYCLE_STAT(TEXT("Static Collision Store Raycast"), STAT_StaticCollisionStoreRaycast, STATGROUP_Collision);
+DECLARE_CYCLE_STAT(TEXT("Static Collision Store Rebuild"), STAT_StaticCollisionStoreRebuild, STATGROUP_Collision);
+
+static int32 GStaticCollisionStoreEnabled = 1;
+static FAutoConsoleVariableRef CVarStaticCollisionStoreEnabled(
+	TEXT("p.StaticCollisionStore"),
+	GStaticCollisionStoreEnabled,
+	TEXT("If 1, components with bUseStaticCollisionStore register their collision with the world's static collision store instead of creating physics bodies. Only applies to components created after the change."),
+	ECVF_Default);
+
+namespace StaticCollisionStore
+{
+	/** Instances per leaf of the hierarchy */
+	static const int32 MaxLeafInstances = 4;
+
+	/** Past this depth nodes are split by count, so that badly distributed instances can't make the hierarchy degenerate */
+	static const int32 MaxSpatialSplitDepth = 48;
+
+	/** Slab test of a line against an axis aligned box, with the line given by its start and the reciprocal of its delta */
+	static bool LineOverlapsBox(const FBox& Box, const FVector& Start, const FVector& InvDelta, float MaxTime)
+	{
+		float MinTime = 0.f;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			float Time0 = (Box.Min[Axis] - Start[Axis]) * InvDelta[Axis];
+			float Time1 = (Box.Max[Axis] - Start[Axis]) * InvDelta[Axis];
+			if (Time0 > Time1)
+			{
+				Swap(Time0, Time1);
+			}
+			MinTime = FMath::Max(MinTime, Time0);
+			MaxTime = FMath::Min(MaxTime, Time1);
+			if (MinTime > MaxTime)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Intersects the line Start + Delta * Time with a box centered on the origin. Lines starting inside hit at time 0, facing back along the line. */
+	static bool LineBoxIntersect(const FVector& Start, const FVector& Delta, const FVector& Extent, float MaxTime, float& OutTime, FVector& OutNormal)
+	{
+		float EnterTime = 0.f;
+		float ExitTime = MaxTime;
+		int32 EnterAxis = INDEX_NONE;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (FMath::Abs(Delta[Axis]) < SMALL_NUMBER)
+			{
+				if (FMath::Abs(Start[Axis]) > Extent[Axis])
+				{
+					return false;
+				}
+				continue;
+			}
+
+			const float InvDelta = 1.f / Delta[Axis];
+			float Time0 = (-Extent[Axis] - Start[Axis]) * InvDelta;
+			float Time1 = (Extent[Axis] - Start[Axis]) * InvDelta;
+			if (Time0 > Time1)
+			{
+				Swap(Time0, Time1);
+			}
+			if (Time0 > EnterTime)
+			{
+				EnterTime = Time0;
+				EnterAxis = Axis;
+			}
+			ExitTime = FMath::Min(ExitTime, Time1);
+			if (EnterTime > ExitTime)
+			{
+				return false;
+			}
+		}
+
+		OutTime = EnterTime;
+		if (EnterAxis == INDEX_NONE)
+		{
+			OutNormal = -Delta.GetSafeNormal();
+		}
+		else
+		{
+			OutNormal = FVector::ZeroVector;
+			OutNormal[EnterAxis] = Delta[EnterAxis] > 0.f ? -1.f : 1.f;
+		}
+		return true;
+	}
+
+	static bool LineSphereIntersect(const FVector& Start, const FVector& Delta, const FVector& Center, float Radius, float MaxTime, float& OutTime, FVector& OutNormal)
+	{
+		const FVector FromCenter = Start - Center;
+		const float C = FromCenter.SizeSquared() - FMath::Square(Radius);
+		if (C <= 0.f)
+		{
+			OutTime = 0.f;
+			OutNormal = -Delta.GetSafeNormal();
+			return true;
+		}
+
+		const float A = Delta.SizeSquared();
+		const float B = FromCenter | Delta;
+		const float Discriminant = B * B - A * C;
+		if (A < SMALL_NUMBER || B >= 0.f || Discriminant < 0.f)
+		{
+			return false;
+		}
+
+		const float Time = (-B - FMath::Sqrt(Discriminant)) / A;
+		if (Time > MaxTime)
+		{
+			return false;
+		}
+
+		OutTime = Time;
+		OutNormal = (FromCenter + Delta * Time) / Radius;
+		return true;
+	}
+
+	/** Intersects a line with a capsule centered on the origin and aligned with Z, the same way FKSphylElem is oriented */
+	static bool LineCapsuleIntersect(const FVector& Start, const FVector& Delta, float Radius, float HalfLength, float MaxTime, float& OutTime, FVector& OutNormal)
+	{
+		bool bHit = false;
+		float Time;
+		FVector Normal;
+
+		// The capsule is the union of its cylinder and of the two spheres closing it, so the closest entry into any of them is the entry into the capsule
+		if (LineSphereIntersect(Start, Delta, FVector(0.f, 0.f, HalfLength), Radius, MaxTime, Time, Normal))
+		{
+			bHit = true;
+			OutTime = MaxTime = Time;
+			OutNormal = Normal;
+		}
+		if (LineSphereIntersect(Start, Delta, FVector(0.f, 0.f, -HalfLength), Radius, MaxTime, Time, Normal))
+		{
+			bHit = true;
+			OutTime = MaxTime = Time;
+			OutNormal = Normal;
+		}
+
+		if (bHit && OutTime == 0.f)
+		{
+			return true;
+		}
+
+		const float A = FMath::Square(Delta.X) + FMath::Square(Delta.Y);
+		if (A > SMALL_NUMBER)
+		{
+			const float B = Start.X * Delta.X + Start.Y * Delta.Y;
+			const float C = FMath::Square(Start.X) + FMath::Square(Start.Y) - FMath::Square(Radius);
+			if (C <= 0.f && FMath::Abs(Start.Z) <= HalfLength)
+			{
+				OutTime = 0.f;
+				OutNormal = -Delta.GetSafeNormal();
+				return true;
+			}
+
+			const float Discriminant = B * B - A * C;
+			if (C > 0.f && B < 0.f && Discriminant >= 0.f)
+			{
+				Time = (-B - FMath::Sqrt(Discriminant)) / A;
+				const FVector HitLocation = Start + Delta * Time;
+				if (Time <= MaxTime && FMath::Abs(HitLocation.Z) <= HalfLength)
+				{
+					bHit = true;
+					OutTime = Time;
+					OutNormal = FVector(HitLocation.X, HitLocation.Y, 0.f) / Radius;
+				}
+			}
+		}
+		else if (FMath::Square(Start.X) + FMath::Square(Start.Y) <= FMath::Square(Radius) && FMath::Abs(Start.Z) <= HalfLength)
+		{
+			// Moving along the axis from inside the cylinder
+			OutTime = 0.f;
+			OutNormal = -Delta.GetSafeNormal();
+			return true;
+		}
+
+		return bHit;
+	}
+}
+
+bool FStaticCollisionStore::IsEnabled()
+{
+	return GStaticCollisionStoreEnabled != 0;
+}
+
+bool FStaticCollisionStore::CanStoreBodySetup(const UBodySetup* BodySetup)
+{
+	if (BodySetup == nullptr || BodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple)
+	{
+		return false;
+	}
+
+	const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+	return AggGeom.ConvexElems.Num() == 0 && AggGeom.TaperedCapsuleElems.Num() == 0
+		&& (AggGeom.BoxElems.Num() + AggGeom.SphereElems.Num() + AggGeom.SphylElems.Num()) > 0;
+}
+
+FStaticCollisionStore::FStaticCollisionStore()
+	: NumLiveInstances(0)
+	, bNeedsRebuild(false)
+{
+}
+
+FStaticCollisionStore::~FStaticCollisionStore()
+{
+}
+
+bool FStaticCollisionStore::AddComponent(UPrimitiveComponent* Component, UBodySetup* BodySetup)
+{
+	check(IsInGameThread());
+	check(Component);
+
+	if (!CanStoreBodySetup(BodySetup))
+	{
+		return false;
+	}
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+
+	RemoveComponentInternal(Component);
+	AddComponentInternal(Component, BodySetup);
+	return true;
+}
+
+void FStaticCollisionStore::RemoveComponent(const UPrimitiveComponent* Component)
+{
+	check(IsInGameThread());
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+
+	DirtyComponents.Remove(const_cast<UPrimitiveComponent*>(Component));
+	RemoveComponentInternal(Component);
+}
+
+void FStaticCollisionStore::MarkComponentDirty(UPrimitiveComponent* Component)
+{
+	check(IsInGameThread());
+
+	// Only touched by the game thread, raycasts never read it
+	if (SourceIndexByComponent.Contains(Component))
+	{
+		DirtyComponents.Add(Component);
+	}
+}
+
+void FStaticCollisionStore::AddComponentInternal(UPrimitiveComponent* Component, UBodySetup* BodySetup)
+{
+	TArray<FTransform> Transforms;
+	TArray<int32> Items;
+	Component->GetStaticCollisionStoreInstances(Transforms, Items);
+	check(Transforms.Num() == Items.Num());
+
+	FSource Source;
+	Source.Component = Component;
+	Source.Owner = Component->GetOwner();
+	Source.ComponentId = Component->GetUniqueID();
+	Source.OwnerId = Source.Owner ? Source.Owner->GetUniqueID() : 0;
+	Source.Responses = Component->GetCollisionResponseToChannels();
+	Source.ObjectType = Component->GetCollisionObjectType();
+	Source.PhysMaterial = FBodyInstance::GetSimplePhysicalMaterial(&Component->BodyInstance, Component, BodySetup);
+	Source.ShapeSetIndex = FindOrAddShapeSet(BodySetup);
+	Source.FirstInstance = InstanceTransforms.Num();
+	Source.NumInstances = Transforms.Num();
+
+	const int32 SourceIndex = Sources.Add(Source);
+	SourceIndexByComponent.Add(Component, SourceIndex);
+
+	const FBox& LocalBounds = ShapeSets[Source.ShapeSetIndex].LocalBounds;
+	for (int32 Index = 0; Index < Transforms.Num(); ++Index)
+	{
+		InstanceTransforms.Add(Transforms[Index]);
+		InstanceBounds.Add(LocalBounds.TransformBy(Transforms[Index]));
+		InstanceSources.Add(SourceIndex);
+		InstanceItems.Add(Items[Index]);
+	}
+
+	NumLiveInstances += Transforms.Num();
+	bNeedsRebuild = true;
+}
+
+void FStaticCollisionStore::RemoveComponentInternal(const UPrimitiveComponent* Component)
+{
+	int32 SourceIndex;
+	if (!SourceIndexByComponent.RemoveAndCopyValue(Component, SourceIndex))
+	{
+		return;
+	}
+
+	// The instances stay in the hierarchy until the next rebuild, but without a source they are skipped by raycasts
+	const FSource& Source = Sources[SourceIndex];
+	for (int32 Index = Source.FirstInstance; Index < Source.FirstInstance + Source.NumInstances; ++Index)
+	{
+		InstanceSources[Index] = INDEX_NONE;
+	}
+
+	NumLiveInstances -= Source.NumInstances;
+	ReleaseShapeSet(Source.ShapeSetIndex);
+	Sources.RemoveAt(SourceIndex);
+	bNeedsRebuild = true;
+}
+
+int32 FStaticCollisionStore::FindOrAddShapeSet(UBodySetup* BodySetup)
+{
+	if (int32* ExistingIndex = ShapeSetIndexByBodySetup.Find(BodySetup))
+	{
+		++ShapeSets[*ExistingIndex].NumUsers;
+		return *ExistingIndex;
+	}
+
+	FShapeSet ShapeSet;
+	ShapeSet.BodySetup = BodySetup;
+	ShapeSet.BoxElems = BodySetup->AggGeom.BoxElems;
+	ShapeSet.SphereElems = BodySetup->AggGeom.SphereElems;
+	ShapeSet.SphylElems = BodySetup->AggGeom.SphylElems;
+	ShapeSet.LocalBounds = BodySetup->AggGeom.CalcAABB(FTransform::Identity);
+	ShapeSet.NumUsers = 1;
+
+	const int32 ShapeSetIndex = ShapeSets.Add(MoveTemp(ShapeSet));
+	ShapeSetIndexByBodySetup.Add(BodySetup, ShapeSetIndex);
+	return ShapeSetIndex;
+}
+
+void FStaticCollisionStore::ReleaseShapeSet(int32 ShapeSetIndex)
+{
+	FShapeSet& ShapeSet = ShapeSets[ShapeSetIndex];
+	if (--ShapeSet.NumUsers == 0)
+	{
+		ShapeSetIndexByBodySetup.Remove(ShapeSet.BodySetup);
+		ShapeSets.RemoveAt(ShapeSetIndex);
+	}
+}
+
+void FStaticCollisionStore::Flush()
+{
+	check(IsInGameThread());
+
+	if (!bNeedsRebuild && DirtyComponents.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_StaticCollisionStoreRebuild);
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+
+	for (UPrimitiveComponent* Component : DirtyComponents)
+	{
+		const int32 SourceIndex = SourceIndexByComponent.FindChecked(Component);
+		UBodySetup* BodySetup = ShapeSets[Sources[SourceIndex].ShapeSetIndex].BodySetup;
+
+		RemoveComponentInternal(Component);
+		AddComponentInternal(Component, BodySetup);
+	}
+	DirtyComponents.Reset();
+
+	Rebuild();
+}
+
+void FStaticCollisionStore::Rebuild()
+{
+	// Compact the instances of live sources, keeping each source's instances contiguous
+	TArray<FTransform> NewTransforms;
+	TArray<FBox> NewBounds;
+	TArray<int32> NewSources;
+	TArray<int32> NewItems;
+	NewTransforms.Reserve(NumLiveInstances);
+	NewBounds.Reserve(NumLiveInstances);
+	NewSources.Reserve(NumLiveInstances);
+	NewItems.Reserve(NumLiveInstances);
+
+	for (TSparseArray<FSource>::TIterator It(Sources); It; ++It)
+	{
+		FSource& Source = *It;
+		const int32 NewFirstInstance = NewTransforms.Num();
+		NewTransforms.Append(InstanceTransforms.GetData() + Source.FirstInstance, Source.NumInstances);
+		NewBounds.Append(InstanceBounds.GetData() + Source.FirstInstance, Source.NumInstances);
+		NewItems.Append(InstanceItems.GetData() + Source.FirstInstance, Source.NumInstances);
+		for (int32 Index = 0; Index < Source.NumInstances; ++Index)
+		{
+			NewSources.Add(It.GetIndex());
+		}
+		Source.FirstInstance = NewFirstInstance;
+	}
+
+	InstanceTransforms = MoveTemp(NewTransforms);
+	InstanceBounds = MoveTemp(NewBounds);
+	InstanceSources = MoveTemp(NewSources);
+	InstanceItems = MoveTemp(NewItems);
+
+	const int32 NumInstances = InstanceTransforms.Num();
+	NodeInstances.Reset(NumInstances);
+	for (int32 Index = 0; Index < NumInstances; ++Index)
+	{
+		NodeInstances.Add(Index);
+	}
+
+	Nodes.Reset();
+	if (NumInstances > 0)
+	{
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumInstances, StaticCollisionStore::MaxLeafInstances));
+		BuildNode(0, NumInstances, 0);
+	}
+
+	bNeedsRebuild = false;
+}
+
+int32 FStaticCollisionStore::BuildNode(int32 FirstInstance, int32 NumInstances, int32 Depth)
+{
+	FBox Bounds(ForceInit);
+	FBox CenterBounds(ForceInit);
+	for (int32 Index = FirstInstance; Index < FirstInstance + NumInstances; ++Index)
+	{
+		const FBox& InstanceBox = InstanceBounds[NodeInstances[Index]];
+		Bounds += InstanceBox;
+		CenterBounds += InstanceBox.GetCenter();
+	}
+
+	const int32 NodeIndex = Nodes.Num();
+	FNode& Node = Nodes.AddDefaulted_GetRef();
+	Node.Bounds = Bounds;
+	Node.FirstInstance = FirstInstance;
+	Node.NumInstances = NumInstances;
+	Node.SecondChild = INDEX_NONE;
+
+	if (NumInstances <= StaticCollisionStore::MaxLeafInstances)
+	{
+		return NodeIndex;
+	}
+
+	// Split at the middle of the longest axis of the instance centers
+	int32 SplitIndex = FirstInstance;
+	if (Depth < StaticCollisionStore::MaxSpatialSplitDepth)
+	{
+		const FVector CenterExtent = CenterBounds.GetExtent();
+		const int32 Axis = CenterExtent.X >= CenterExtent.Y ? (CenterExtent.X >= CenterExtent.Z ? 0 : 2) : (CenterExtent.Y >= CenterExtent.Z ? 1 : 2);
+		const float SplitPosition = CenterBounds.GetCenter()[Axis];
+
+		for (int32 Index = FirstInstance; Index < FirstInstance + NumInstances; ++Index)
+		{
+			if (InstanceBounds[NodeInstances[Index]].GetCenter()[Axis] < SplitPosition)
+			{
+				Swap(NodeInstances[Index], NodeInstances[SplitIndex++]);
+			}
+		}
+	}
+
+	if (SplitIndex == FirstInstance || SplitIndex == FirstInstance + NumInstances)
+	{
+		SplitIndex = FirstInstance + NumInstances / 2;
+	}
+
+	// Accessed by index from here on, adding the children may reallocate the nodes
+	Nodes[NodeIndex].NumInstances = 0;
+	BuildNode(FirstInstance, SplitIndex - FirstInstance, Depth + 1);
+	const int32 SecondChild = BuildNode(SplitIndex, FirstInstance + NumInstances - SplitIndex, Depth + 1);
+	Nodes[NodeIndex].SecondChild = SecondChild;
+
+	return NodeIndex;
+}
+
+bool FStaticCollisionStore::PassesFilter(const FSource& Source, ECollisionChannel TraceChannel, const FCollisionQueryParams& Params, const FCollisionResponseParams& ResponseParams, const FCollisionObjectQueryParams& ObjectParams) const
+{
+	if (ObjectParams.IsValid())
+	{
+		if ((ObjectParams.GetQueryBitfield() & ECC_TO_BITFIELD(Source.ObjectType)) == 0)
+		{
+			return false;
+		}
+	}
+	else if (Source.Responses.GetResponse(TraceChannel) != ECR_Block || ResponseParams.CollisionResponse.GetResponse(Source.ObjectType) != ECR_Block)
+	{
+		return false;
+	}
+
+	return !Params.GetIgnoredComponents().Contains(Source.ComponentId) && !Params.GetIgnoredActors().Contains(Source.OwnerId);
+}
+
+bool FStaticCollisionStore::RaycastInstance(int32 InstanceIndex, const FVector& Start, const FVector& Delta, float MaxTime, float& OutTime, FVector& OutNormal) const
+{
+	const FTransform& InstanceTransform = InstanceTransforms[InstanceIndex];
+	const FShapeSet& ShapeSet = ShapeSets[Sources[InstanceSources[InstanceIndex]].ShapeSetIndex];
+
+	// Trace in the unscaled space of the instance, times along the line are unchanged by the transform
+	const FVector LocalStart = InstanceTransform.InverseTransformPosition(Start);
+	const FVector LocalDelta = InstanceTransform.InverseTransformVector(Delta);
+
+	bool bHit = false;
+	float Time;
+	FVector Normal;
+	FVector LocalNormal;
+
+	for (const FKBoxElem& BoxElem : ShapeSet.BoxElems)
+	{
+		const FTransform ElemTransform = BoxElem.GetTransform();
+		const FVector Extent(BoxElem.X * 0.5f, BoxElem.Y * 0.5f, BoxElem.Z * 0.5f);
+		if (StaticCollisionStore::LineBoxIntersect(ElemTransform.InverseTransformPositionNoScale(LocalStart), ElemTransform.InverseTransformVectorNoScale(LocalDelta), Extent, MaxTime, Time, Normal))
+		{
+			bHit = true;
+			MaxTime = Time;
+			LocalNormal = ElemTransform.TransformVectorNoScale(Normal);
+		}
+	}
+
+	for (const FKSphereElem& SphereElem : ShapeSet.SphereElems)
+	{
+		if (StaticCollisionStore::LineSphereIntersect(LocalStart, LocalDelta, SphereElem.Center, SphereElem.Radius, MaxTime, Time, Normal))
+		{
+			bHit = true;
+			MaxTime = Time;
+			LocalNormal = Normal;
+		}
+	}
+
+	for (const FKSphylElem& SphylElem : ShapeSet.SphylElems)
+	{
+		const FTransform ElemTransform = SphylElem.GetTransform();
+		if (StaticCollisionStore::LineCapsuleIntersect(ElemTransform.InverseTransformPositionNoScale(LocalStart), ElemTransform.InverseTransformVectorNoScale(LocalDelta), SphylElem.Radius, SphylElem.Length * 0.5f, MaxTime, Time, Normal))
+		{
+			bHit = true;
+			MaxTime = Time;
+			LocalNormal = ElemTransform.TransformVectorNoScale(Normal);
+		}
+	}
+
+	if (bHit)
+	{
+		// Normals go back to world space through the inverse transpose of the scale
+		OutTime = MaxTime;
+		OutNormal = InstanceTransform.TransformVectorNoScale(LocalNormal / InstanceTransform.GetScale3D()).GetSafeNormal();
+	}
+	return bHit;
+}
+
+bool FStaticCollisionStore::Raycast(FHitResult& OutHit, const FVector& Start, const FVector& End, float MaxTime, ECollisionChannel TraceChannel, const FCollisionQueryParams& Params, const FCollisionResponseParams& ResponseParams, const FCollisionObjectQueryParams& ObjectParams, bool bAnyHit)
+{
+	if (Params.bIgnoreBlocks)
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_StaticCollisionStoreRaycast);
+
+	// Task threads trace the hierarchy as of the last flush, the game thread brings it up to date first
+	if (IsInGameThread())
+	{
+		Flush();
+	}
+
+	FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+
+	if (Nodes.Num() == 0)
+	{
+		return false;
+	}
+
+	const FVector Delta = End - Start;
+	const FVector InvDelta(
+		FMath::Abs(Delta.X) > SMALL_NUMBER ? 1.f / Delta.X : BIG_NUMBER,
+		FMath::Abs(Delta.Y) > SMALL_NUMBER ? 1.f / Delta.Y : BIG_NUMBER,
+		FMath::Abs(Delta.Z) > SMALL_NUMBER ? 1.f / Delta.Z : BIG_NUMBER);
+
+	float BestTime = MaxTime;
+	FVector BestNormal;
+	int32 BestInstance = INDEX_NONE;
+
+	TArray<int32, TInlineAllocator<64>> NodeStack;
+	NodeStack.Add(0);
+	while (NodeStack.Num() > 0)
+	{
+		const int32 NodeIndex = NodeStack.Pop(false);
+		const FNode& Node = Nodes[NodeIndex];
+		if (!StaticCollisionStore::LineOverlapsBox(Node.Bounds, Start, InvDelta, BestTime))
+		{
+			continue;
+		}
+
+		if (Node.NumInstances == 0)
+		{
+			NodeStack.Add(Node.SecondChild);
+			NodeStack.Add(NodeIndex + 1);
+			continue;
+		}
+
+		for (int32 Index = Node.FirstInstance; Index < Node.FirstInstance + Node.NumInstances; ++Index)
+		{
+			const int32 InstanceIndex = NodeInstances[Index];
+			const int32 SourceIndex = InstanceSources[InstanceIndex];
+			if (SourceIndex == INDEX_NONE || !PassesFilter(Sources[SourceIndex], TraceChannel, Params, ResponseParams, ObjectParams))
+			{
+				continue;
+			}
+
+			float Time;
+			FVector Normal;
+			if (RaycastInstance(InstanceIndex, Start, Delta, BestTime, Time, Normal))
+			{
+				BestTime = Time;
+				BestNormal = Normal;
+				BestInstance = InstanceIndex;
+
+				if (bAnyHit)
+				{
+					NodeStack.Reset();
+					break;
+				}
+			}
+		}
+	}
+
+	if (BestInstance == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FSource& Source = Sources[InstanceSources[BestInstance]];
+
+	OutHit = FHitResult(Start, End);
+	OutHit.bBlockingHit = true;
+	OutHit.Time = BestTime;
+	OutHit.Distance = Delta.Size() * BestTime;
+	OutHit.Location = OutHit.ImpactPoint = Start + Delta * BestTime;
+	OutHit.Normal = OutHit.ImpactNormal = BestNormal;
+	OutHit.Component = Source.Component;
+	OutHit.Actor = Source.Owner;
+	OutHit.Item = InstanceItems[BestInstance];
+	OutHit.FaceIndex = INDEX_NONE;
+	OutHit.PhysMaterial = Params.bReturnPhysicalMaterial ? Source.PhysMaterial : nullptr;
+	return true;
+}
+
+void FStaticCollisionStore::Dump() const
+{
+	FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+
+	UE_LOG(LogCollision, Log, TEXT("------- %d Stored Instances from %d Components, %d Shape Sets, %d Nodes -------"), NumLiveInstances, Sources.Num(), ShapeSets.Num(), Nodes.Num());
+	for (const FShapeSet& ShapeSet : ShapeSets)
+	{
+		UE_LOG(LogCollision, Log, TEXT("%s: %d components, %d boxes, %d spheres, %d capsules"), *GetPathNameSafe(ShapeSet.BodySetup), ShapeSet.NumUsers, ShapeSet.BoxElems.Num(), ShapeSet.SphereElems.Num(), ShapeSet.SphylElems.Num());
+	}
+}
+
+static void OnDumpStaticCollisionStore(UWorld* World)
+{
+	if (World != nullptr && World->GetStaticCollisionStore() != nullptr)
+	{
+		World->GetStaticCollisionStore()->Dump();
+	}
+}
+
+FAutoConsoleCommandWithWorld DumpStaticCollisionStoreConsoleCommand(
+	TEXT("p.StaticCollisionStore.Dump"),
+	TEXT("Dumps the contents of the static collision store of the current world."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(OnDumpStaticCollisionStore)
+	);
@@ -43,8 +43,17 @@ namespace AsyncTraceCVars
 		TEXT("Whether to use worker thread for async trace functionality. This works if FApp::ShouldUseThreadingForPerformance is true. Otherwise it will always use game thread. \n")
 		TEXT("0: Use game thread, 1: User worker thread"),
 		ECVF_Default);
+
+	static int32 BatchedTraceChunkSize = 32;
+	static FAutoConsoleVariableRef CVarBatchedTraceChunkSize(
+		TEXT("BatchedTraceChunkSize"),
+		BatchedTraceChunkSize,
+		TEXT("Number of queries of a batched trace that run in the same task."),
+		ECVF_Default);
 }
 
+DECLARE_CYCLE_STAT(TEXT("Batched Trace Task"), STAT_BatchedTraceTask, STATGROUP_TaskGraphTasks);
+
 namespace
 {
 	// Helper functions to return the right named member container based on a datum type
@@ -354,6 +363,114 @@ namespace
 	}
 }
 
+FBatchedTraceQuery::FBatchedTraceQuery()
+	: TraceChannel(DefaultCollisionChannel)
+	, TraceType(EAsyncTraceType::Single)
+	, Completion(EBatchedTraceCompletion::NextFrame)
+	, bDispatched(false)
+	, bDelegateExecuted(false)
+{
+}
+
+bool FBatchedTraceQuery::IsComplete() const
+{
+	if (!bDispatched)
+	{
+		return false;
+	}
+
+	for (const FGraphEventRef& CompletionEvent : CompletionEvents)
+	{
+		if (!CompletionEvent->IsComplete())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FBatchedTraceQuery::WaitForCompletion()
+{
+	check(IsInGameThread());
+
+	if (!bDispatched)
+	{
+		// A next frame batch waited for during the frame it was requested in, run it here
+		Dispatch(PhysWorld.Get(), false);
+	}
+
+	if (CompletionEvents.Num() > 0)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_WaitForBatchedTrace);
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(CompletionEvents, ENamedThreads::GameThread);
+		CompletionEvents.Reset();
+	}
+
+	if (!bDelegateExecuted)
+	{
+		bDelegateExecuted = true;
+		Delegate.ExecuteIfBound(*this);
+	}
+}
+
+void FBatchedTraceQuery::Dispatch(UWorld* World, bool bUseWorkerThreads)
+{
+	check(!bDispatched);
+	bDispatched = true;
+	PhysWorld = World;
+
+	const int32 NumQueries = Hits.Num();
+	const int32 ChunkSize = FMath::Max(AsyncTraceCVars::BatchedTraceChunkSize, 1);
+	for (int32 FirstIndex = 0; FirstIndex < NumQueries; FirstIndex += ChunkSize)
+	{
+		const int32 Count = FMath::Min(ChunkSize, NumQueries - FirstIndex);
+		if (bUseWorkerThreads)
+		{
+			// Each task keeps the batch alive, in case the world goes away while they run
+			CompletionEvents.Add(FFunctionGraphTask::CreateAndDispatchWhenReady([Batch = AsShared(), FirstIndex, Count]()
+			{
+				Batch->RunQueries(FirstIndex, Count);
+			}, GET_STATID(STAT_BatchedTraceTask), nullptr, CPrio_FAsyncTraceTask.Get()));
+		}
+		else
+		{
+			RunQueries(FirstIndex, Count);
+		}
+	}
+}
+
+void FBatchedTraceQuery::RunQueries(int32 FirstIndex, int32 Count)
+{
+	const UWorld* World = PhysWorld.Get();
+	const bool bLineTrace = (CollisionParams.CollisionShape.ShapeType == ECollisionShape::Line) || CollisionParams.CollisionShape.IsNearlyZero();
+
+	for (int32 Index = FirstIndex; Index < FirstIndex + Count; ++Index)
+	{
+		FHitResult& Hit = Hits[Index];
+		Hit = FHitResult();
+
+		if (World == nullptr)
+		{
+			continue;
+		}
+
+		if (TraceType == EAsyncTraceType::Test)
+		{
+			Hit.bBlockingHit = bLineTrace
+				? FPhysicsInterface::RaycastTest(World, Starts[Index], Ends[Index], TraceChannel, CollisionParams.CollisionQueryParam, CollisionParams.ResponseParam, CollisionParams.ObjectQueryParam)
+				: FPhysicsInterface::GeomSweepTest(World, CollisionParams.CollisionShape, FQuat::Identity, Starts[Index], Ends[Index], TraceChannel, CollisionParams.CollisionQueryParam, CollisionParams.ResponseParam, CollisionParams.ObjectQueryParam);
+		}
+		else if (bLineTrace)
+		{
+			FPhysicsInterface::RaycastSingle(World, Hit, Starts[Index], Ends[Index], TraceChannel, CollisionParams.CollisionQueryParam, CollisionParams.ResponseParam, CollisionParams.ObjectQueryParam);
+		}
+		else
+		{
+			FPhysicsInterface::GeomSweepSingle(World, CollisionParams.CollisionShape, FQuat::Identity, Hit, Starts[Index], Ends[Index], TraceChannel, CollisionParams.CollisionQueryParam, CollisionParams.ResponseParam, CollisionParams.ObjectQueryParam);
+		}
+	}
+}
+
 FWorldAsyncTraceState::FWorldAsyncTraceState()
 	: CurrentFrame             (0)
 {
@@ -392,6 +509,53 @@ FTraceHandle UWorld::AsyncOverlapByObjectType(const FVector& Pos, const FQuat& R
 	return StartNewTrace(AsyncTraceState, FOverlapDatum(this, CollisionShape, Params, FCollisionResponseParams::DefaultResponseParam, ObjectQueryParams, DefaultCollisionChannel, UserData, Pos, Rot, InDelegate, AsyncTraceState.CurrentFrame));
 }
 
+TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe> UWorld::AsyncBatchTraceByChannel(EBatchedTraceCompletion Completion, EAsyncTraceType InTraceType, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape /* = FCollisionShape::LineShape */, const FCollisionQueryParams& Params /* = FCollisionQueryParams::DefaultQueryParam */, const FCollisionResponseParams& ResponseParam /* = FCollisionResponseParams::DefaultResponseParam */, FBatchedTraceDelegate* InDelegate /* = nullptr */)
+{
+	return StartBatchedTrace(Completion, InTraceType, Starts, Ends, TraceChannel, CollisionShape, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam, InDelegate);
+}
+
+TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe> UWorld::AsyncBatchTraceByObjectType(EBatchedTraceCompletion Completion, EAsyncTraceType InTraceType, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, const FCollisionObjectQueryParams& ObjectQueryParams, const FCollisionShape& CollisionShape /* = FCollisionShape::LineShape */, const FCollisionQueryParams& Params /* = FCollisionQueryParams::DefaultQueryParam */, FBatchedTraceDelegate* InDelegate /* = nullptr */)
+{
+	return StartBatchedTrace(Completion, InTraceType, Starts, Ends, DefaultCollisionChannel, CollisionShape, Params, FCollisionResponseParams::DefaultResponseParam, ObjectQueryParams, InDelegate);
+}
+
+TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe> UWorld::StartBatchedTrace(EBatchedTraceCompletion Completion, EAsyncTraceType InTraceType, TArrayView<const FVector> Starts, TArrayView<const FVector> Ends, ECollisionChannel TraceChannel, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params, const FCollisionResponseParams& ResponseParam, const FCollisionObjectQueryParams& ObjectQueryParams, FBatchedTraceDelegate* InDelegate)
+{
+	// Using async traces outside of the game thread can cause memory corruption
+	check(IsInGameThread());
+	ensureMsgf(Starts.Num() == Ends.Num(), TEXT("Batched trace: %d start locations for %d end locations"), Starts.Num(), Ends.Num());
+	ensureMsgf(InTraceType != EAsyncTraceType::Multi, TEXT("Batched traces do not support multi traces, running single traces instead"));
+
+	const int32 NumQueries = FMath::Min(Starts.Num(), Ends.Num());
+
+	TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe> Batch = MakeShared<FBatchedTraceQuery, ESPMode::ThreadSafe>();
+	Batch->Starts.Append(Starts.GetData(), NumQueries);
+	Batch->Ends.Append(Ends.GetData(), NumQueries);
+	Batch->CollisionParams.CollisionShape = CollisionShape;
+	Batch->CollisionParams.CollisionQueryParam = Params;
+	Batch->CollisionParams.ResponseParam = ResponseParam;
+	Batch->CollisionParams.ObjectQueryParam = ObjectQueryParams;
+	Batch->TraceChannel = TraceChannel;
+	Batch->TraceType = (InTraceType == EAsyncTraceType::Test) ? EAsyncTraceType::Test : EAsyncTraceType::Single;
+	Batch->Completion = Completion;
+	Batch->PhysWorld = this;
+	Batch->Hits.SetNum(NumQueries);
+	if (InDelegate)
+	{
+		Batch->Delegate = *InDelegate;
+	}
+
+	AsyncTraceState.GetBufferForCurrentFrame().BatchedTraces.Add(Batch);
+
+	if (Completion == EBatchedTraceCompletion::SameFrame)
+	{
+		const bool bRunAsyncTraceOnWorkerThread = !!AsyncTraceCVars::RunAsyncTraceOnWorkerThread && FApp::ShouldUseThreadingForPerformance();
+		Batch->Dispatch(this, bRunAsyncTraceOnWorkerThread);
+	}
+
+	return Batch;
+}
+
 bool UWorld::IsTraceHandleValid(const FTraceHandle& Handle, bool bOverlapTrace)
 {
 	// only valid if it's previous frame or current frame
@@ -487,6 +651,12 @@ void UWorld::ResetAsyncTrace()
 		auto& TraceData = FBufferIndexPair(Idx).DatumLookupChecked(DataBufferExecuted.OverlapData);
 		TraceData.Delegate.ExecuteIfBound(FTraceHandle(TraceData.FrameNumber, Idx), TraceData);
 	}
+
+	for (const TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe>& Batch : DataBufferExecuted.BatchedTraces)
+	{
+		Batch->WaitForCompletion();
+	}
+	DataBufferExecuted.BatchedTraces.Reset();
 }
 
 void UWorld::FinishAsyncTrace()
@@ -495,6 +665,30 @@ void UWorld::FinishAsyncTrace()
 	ExecuteAsyncTraceIfAvailable<FTraceDatum>  (AsyncTraceState, true);
 	ExecuteAsyncTraceIfAvailable<FOverlapDatum>(AsyncTraceState, true);
 
+	// same frame batches complete now, next frame ones start along with the rest of the frame's async traces
+	const bool bRunAsyncTraceOnWorkerThread = !!AsyncTraceCVars::RunAsyncTraceOnWorkerThread && FApp::ShouldUseThreadingForPerformance();
+	TArray<TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe>> SameFrameBatches;
+	TArray<TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe>>& BatchedTraces = AsyncTraceState.GetBufferForCurrentFrame().BatchedTraces;
+	for (int32 Idx = BatchedTraces.Num() - 1; Idx >= 0; --Idx)
+	{
+		FBatchedTraceQuery& Batch = BatchedTraces[Idx].Get();
+		if (Batch.Completion == EBatchedTraceCompletion::SameFrame)
+		{
+			SameFrameBatches.Add(BatchedTraces[Idx]);
+			BatchedTraces.RemoveAt(Idx, 1, false);
+		}
+		else if (!Batch.bDispatched)
+		{
+			Batch.Dispatch(this, bRunAsyncTraceOnWorkerThread);
+		}
+	}
+
+	// delegates may request new batches, those are completed with the next frame's
+	for (int32 Idx = SameFrameBatches.Num() - 1; Idx >= 0; --Idx)
+	{
+		SameFrameBatches[Idx]->WaitForCompletion();
+	}
+
 	// this flag only needed to know I can't accept any more new request in current frame
 	AsyncTraceState.GetBufferForCurrentFrame().bAsyncAllowed = false;
 
@@ -0,0 +1,378 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Commandlets/ContentPerformanceReportCommandlet.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "Misc/PackageName.h"
+#include "Misc/FileHelper.h"
+#include "UObject/Package.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/Texture.h"
+#include "Engine/SkeletalMesh.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Materials/MaterialInterface.h"
+#include "MaterialShared.h"
+#include "Net/RepLayout.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogContentPerformanceReport, Log, All);
+
+namespace ContentPerformanceReport
+{
+	struct FActorCosts
+	{
+		FString LevelName;
+		FString ActorName;
+		FString ClassName;
+		int64 TickingComponents = 0;
+		int64 ReplicatedProperties = 0;
+		int64 CollisionBodies = 0;
+		int64 CollisionShapes = 0;
+		int64 SkeletalMeshLODs = 0;
+		int64 Materials = 0;
+		int64 MaterialShaders = 0;
+		int64 MaxShaderInstructions = 0;
+		int64 TextureBytes = 0;
+	};
+
+	struct FColumn
+	{
+		const TCHAR* Name;
+		int64 FActorCosts::* Value;
+	};
+
+	/** Columns of the report, any of them can be used to rank the actors */
+	static const FColumn Columns[] =
+	{
+		{ TEXT("TickingComponents"), &FActorCosts::TickingComponents },
+		{ TEXT("ReplicatedProperties"), &FActorCosts::ReplicatedProperties },
+		{ TEXT("CollisionBodies"), &FActorCosts::CollisionBodies },
+		{ TEXT("CollisionShapes"), &FActorCosts::CollisionShapes },
+		{ TEXT("SkeletalMeshLODs"), &FActorCosts::SkeletalMeshLODs },
+		{ TEXT("Materials"), &FActorCosts::Materials },
+		{ TEXT("MaterialShaders"), &FActorCosts::MaterialShaders },
+		{ TEXT("MaxShaderInstructions"), &FActorCosts::MaxShaderInstructions },
+		{ TEXT("TextureBytes"), &FActorCosts::TextureBytes },
+	};
+
+	struct FLevelSummary
+	{
+		FString LevelName;
+		int32 NumActors = 0;
+		int64 TickingComponents = 0;
+		int64 CollisionBodies = 0;
+		/** Memory of every texture the level references, each counted once */
+		int64 TextureBytes = 0;
+	};
+
+	class FReportBuilder
+	{
+	public:
+		void AddLevel(ULevel* Level, const FString& LevelName);
+
+		TArray<FActorCosts> Actors;
+		TArray<FLevelSummary> Levels;
+
+	private:
+		struct FMaterialCosts
+		{
+			int64 Shaders = 0;
+			int64 MaxInstructions = 0;
+		};
+
+		int32 GetNumReplicatedProperties(UClass* Class);
+		const FMaterialCosts& GetMaterialCosts(UMaterialInterface* Material);
+
+		TMap<UClass*, int32> ReplicatedPropertiesPerClass;
+		TMap<UMaterialInterface*, FMaterialCosts> CostsPerMaterial;
+	};
+
+	void FReportBuilder::AddLevel(ULevel* Level, const FString& LevelName)
+	{
+		FLevelSummary& Summary = Levels.AddDefaulted_GetRef();
+		Summary.LevelName = LevelName;
+
+		TSet<UTexture*> LevelTextures;
+		for (AActor* Actor : Level->Actors)
+		{
+			if (!Actor || Actor->IsPendingKill())
+			{
+				continue;
+			}
+
+			FActorCosts& Costs = Actors.AddDefaulted_GetRef();
+			Costs.LevelName = LevelName;
+			Costs.ActorName = Actor->GetName();
+			Costs.ClassName = Actor->GetClass()->GetName();
+
+			if (Actor->PrimaryActorTick.bCanEverTick && Actor->PrimaryActorTick.bStartWithTickEnabled)
+			{
+				++Costs.TickingComponents;
+			}
+
+			const bool bReplicated = Actor->GetIsReplicated();
+			if (bReplicated)
+			{
+				Costs.ReplicatedProperties += GetNumReplicatedProperties(Actor->GetClass());
+			}
+
+			TSet<UMaterialInterface*> ActorMaterials;
+			TSet<UTexture*> ActorTextures;
+			TArray<UMaterialInterface*> UsedMaterials;
+			TArray<UTexture*> UsedTextures;
+
+			TInlineComponentArray<UActorComponent*> Components(Actor);
+			for (UActorComponent* Component : Components)
+			{
+				if (Component->PrimaryComponentTick.bCanEverTick && Component->PrimaryComponentTick.bStartWithTickEnabled)
+				{
+					++Costs.TickingComponents;
+				}
+
+				if (bReplicated && Component->GetIsReplicated())
+				{
+					Costs.ReplicatedProperties += GetNumReplicatedProperties(Component->GetClass());
+				}
+
+				UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+				if (!Primitive)
+				{
+					continue;
+				}
+
+				if (Primitive->IsCollisionEnabled())
+				{
+					// Every instance gets its own body
+					const UInstancedStaticMeshComponent* InstancedComponent = Cast<UInstancedStaticMeshComponent>(Primitive);
+					const int32 NumBodies = InstancedComponent ? InstancedComponent->GetInstanceCount() : 1;
+					const UBodySetup* BodySetup = Primitive->GetBodySetup();
+
+					Costs.CollisionBodies += NumBodies;
+					Costs.CollisionShapes += BodySetup ? (int64)NumBodies * BodySetup->AggGeom.GetElementCount() : 0;
+				}
+
+				if (const USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(Primitive))
+				{
+					if (SkeletalMeshComponent->SkeletalMesh)
+					{
+						Costs.SkeletalMeshLODs += SkeletalMeshComponent->SkeletalMesh->GetLODNum();
+					}
+				}
+
+				UsedMaterials.Reset();
+				Primitive->GetUsedMaterials(UsedMaterials);
+				ActorMaterials.Append(UsedMaterials);
+
+				UsedTextures.Reset();
+				Primitive->GetUsedTextures(UsedTextures, EMaterialQualityLevel::Num);
+				ActorTextures.Append(UsedTextures);
+			}
+
+			ActorMaterials.Remove(nullptr);
+			for (UMaterialInterface* Material : ActorMaterials)
+			{
+				const FMaterialCosts& MaterialCosts = GetMaterialCosts(Material);
+				Costs.MaterialShaders += MaterialCosts.Shaders;
+				Costs.MaxShaderInstructions = FMath::Max(Costs.MaxShaderInstructions, MaterialCosts.MaxInstructions);
+			}
+			Costs.Materials = ActorMaterials.Num();
+
+			ActorTextures.Remove(nullptr);
+			for (UTexture* Texture : ActorTextures)
+			{
+				Costs.TextureBytes += Texture->CalcTextureMemorySizeEnum(TMC_AllMips);
+			}
+			LevelTextures.Append(ActorTextures);
+
+			++Summary.NumActors;
+			Summary.TickingComponents += Costs.TickingComponents;
+			Summary.CollisionBodies += Costs.CollisionBodies;
+		}
+
+		for (UTexture* Texture : LevelTextures)
+		{
+			Summary.TextureBytes += Texture->CalcTextureMemorySizeEnum(TMC_AllMips);
+		}
+	}
+
+	int32 FReportBuilder::GetNumReplicatedProperties(UClass* Class)
+	{
+		if (const int32* NumProperties = ReplicatedPropertiesPerClass.Find(Class))
+		{
+			return *NumProperties;
+		}
+
+		TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(Class);
+		return ReplicatedPropertiesPerClass.Add(Class, RepLayout.IsValid() ? RepLayout->GetNumParents() : 0);
+	}
+
+	const FReportBuilder::FMaterialCosts& FReportBuilder::GetMaterialCosts(UMaterialInterface* Material)
+	{
+		if (const FMaterialCosts* Costs = CostsPerMaterial.Find(Material))
+		{
+			return *Costs;
+		}
+
+		FMaterialCosts& Costs = CostsPerMaterial.Add(Material);
+
+		// Only known for materials whose shaders are compiled or loaded for the current feature level
+		const FMaterialResource* Resource = Material->GetMaterialResource(GMaxRHIFeatureLevel);
+		const FMaterialShaderMap* ShaderMap = Resource ? Resource->GetGameThreadShaderMap() : nullptr;
+		if (ShaderMap)
+		{
+			TMap<FShaderId, TShaderRef<FShader>> Shaders;
+			ShaderMap->GetShaderList(Shaders);
+
+			Costs.Shaders = Shaders.Num();
+			for (const TPair<FShaderId, TShaderRef<FShader>>& Shader : Shaders)
+			{
+				Costs.MaxInstructions = FMath::Max<int64>(Costs.MaxInstructions, Shader.Value->GetNumInstructions());
+			}
+		}
+
+		return Costs;
+	}
+
+	static bool WriteActorsCSV(const TArray<FActorCosts>& Actors, const FString& Filename)
+	{
+		FString CSV = TEXT("Level,Actor,Class");
+		for (const FColumn& Column : Columns)
+		{
+			CSV += TEXT(",");
+			CSV += Column.Name;
+		}
+		CSV += TEXT("\n");
+
+		for (const FActorCosts& Costs : Actors)
+		{
+			CSV += FString::Printf(TEXT("%s,%s,%s"), *Costs.LevelName, *Costs.ActorName, *Costs.ClassName);
+			for (const FColumn& Column : Columns)
+			{
+				CSV += FString::Printf(TEXT(",%lld"), Costs.*Column.Value);
+			}
+			CSV += TEXT("\n");
+		}
+
+		return FFileHelper::SaveStringToFile(CSV, *Filename);
+	}
+
+	static bool WriteLevelsCSV(const TArray<FLevelSummary>& Levels, const FString& Filename)
+	{
+		FString CSV = TEXT("Level,Actors,TickingComponents,CollisionBodies,TextureBytes\n");
+		for (const FLevelSummary& Summary : Levels)
+		{
+			CSV += FString::Printf(TEXT("%s,%d,%lld,%lld,%lld\n"), *Summary.LevelName, Summary.NumActors, Summary.TickingComponents, Summary.CollisionBodies, Summary.TextureBytes);
+		}
+
+		return FFileHelper::SaveStringToFile(CSV, *Filename);
+	}
+}
+
+UContentPerformanceReportCommandlet::UContentPerformanceReportCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UContentPerformanceReportCommandlet::Main(const FString& Params)
+{
+	using namespace ContentPerformanceReport;
+
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		UE_LOG(LogContentPerformanceReport, Error, TEXT("Usage: ContentPerformanceReport -Map=/Game/Maps/MyMap [-SortBy=TextureBytes] [-Top=20] [-Output=Path/Report.csv]"));
+		return 1;
+	}
+
+	FString SortBy = TEXT("TextureBytes");
+	FParse::Value(*Params, TEXT("SortBy="), SortBy);
+
+	const FColumn* SortColumn = nullptr;
+	for (const FColumn& Column : Columns)
+	{
+		if (SortBy == Column.Name)
+		{
+			SortColumn = &Column;
+		}
+	}
+
+	if (!SortColumn)
+	{
+		UE_LOG(LogContentPerformanceReport, Error, TEXT("Unknown -SortBy=%s, expected the name of one of the report's columns."), *SortBy);
+		return 1;
+	}
+
+	int32 NumTopActors = 20;
+	FParse::Value(*Params, TEXT("Top="), NumTopActors);
+
+	FString OutputFilename = FPaths::ProfilingDir() / TEXT("ContentPerformanceReport") / FPackageName::GetShortName(MapName) + TEXT(".csv");
+	FParse::Value(*Params, TEXT("Output="), OutputFilename);
+
+	UPackage* MapPackage = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (!World || !World->PersistentLevel)
+	{
+		UE_LOG(LogContentPerformanceReport, Error, TEXT("Failed to load map %s."), *MapName);
+		return 1;
+	}
+
+	FReportBuilder Report;
+	Report.AddLevel(World->PersistentLevel, FPackageName::GetShortName(MapPackage->GetName()));
+
+	// The streaming levels are only loaded, the world isn't initialized so nothing gets registered or begins play
+	for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+	{
+		const FName LevelPackageName = StreamingLevel ? StreamingLevel->GetWorldAssetPackageFName() : NAME_None;
+		if (LevelPackageName == NAME_None)
+		{
+			continue;
+		}
+
+		UPackage* LevelPackage = LoadPackage(nullptr, *LevelPackageName.ToString(), LOAD_None);
+		UWorld* LevelWorld = LevelPackage ? UWorld::FindWorldInPackage(LevelPackage) : nullptr;
+		if (LevelWorld && LevelWorld->PersistentLevel)
+		{
+			Report.AddLevel(LevelWorld->PersistentLevel, FPackageName::GetShortName(LevelPackageName));
+		}
+		else
+		{
+			UE_LOG(LogContentPerformanceReport, Warning, TEXT("Failed to load streaming level %s, it won't be part of the report."), *LevelPackageName.ToString());
+		}
+	}
+
+	int64 FActorCosts::* SortValue = SortColumn->Value;
+	Report.Actors.StableSort([SortValue](const FActorCosts& A, const FActorCosts& B) { return A.*SortValue > B.*SortValue; });
+	Report.Levels.StableSort([](const FLevelSummary& A, const FLevelSummary& B) { return A.TextureBytes > B.TextureBytes; });
+
+	UE_LOG(LogContentPerformanceReport, Display, TEXT("%d actors in %d levels, top %d by %s:"), Report.Actors.Num(), Report.Levels.Num(), FMath::Min(NumTopActors, Report.Actors.Num()), SortColumn->Name);
+	for (int32 Index = 0; Index < FMath::Min(NumTopActors, Report.Actors.Num()); ++Index)
+	{
+		const FActorCosts& Costs = Report.Actors[Index];
+		UE_LOG(LogContentPerformanceReport, Display, TEXT("  %lld %s (%s) in %s"), Costs.*SortValue, *Costs.ActorName, *Costs.ClassName, *Costs.LevelName);
+	}
+
+	for (const FLevelSummary& Summary : Report.Levels)
+	{
+		UE_LOG(LogContentPerformanceReport, Display, TEXT("Level %s: %d actors, %lld ticking components, %lld collision bodies, %.2f MB of textures"),
+			*Summary.LevelName, Summary.NumActors, Summary.TickingComponents, Summary.CollisionBodies, Summary.TextureBytes / (1024.0 * 1024.0));
+	}
+
+	const FString LevelsFilename = FPaths::GetPath(OutputFilename) / FPaths::GetBaseFilename(OutputFilename) + TEXT("_Levels.csv");
+	if (!WriteActorsCSV(Report.Actors, OutputFilename) || !WriteLevelsCSV(Report.Levels, LevelsFilename))
+	{
+		UE_LOG(LogContentPerformanceReport, Error, TEXT("Failed to write the report to %s."), *OutputFilename);
+		return 1;
+	}
+
+	UE_LOG(LogContentPerformanceReport, Display, TEXT("Wrote the report to %s and %s."), *OutputFilename, *LevelsFilename);
+	return 0;
+}
@@ -1,12 +1,14 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ComponentInstanceDataCache.h"
+#include "HAL/IConsoleManager.h"
 #include "Serialization/ObjectWriter.h"
 #include "Serialization/ObjectReader.h"
 #include "Serialization/DuplicatedObject.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/StructuredArchive.h"
 #include "UObject/Package.h"
 #include "UObject/UObjectAnnotation.h"
 #include "UObject/UObjectGlobals.h"
@@ -16,6 +18,13 @@
 #include "Components/SceneComponent.h"
 #include "GameFramework/Actor.h"
 
+static int32 GComponentInstanceDataDirectCopy = 1;
+static FAutoConsoleVariableRef CVarComponentInstanceDataDirectCopy(
+	TEXT("bp.ComponentInstanceDataDirectCopy"),
+	GComponentInstanceDataDirectCopy,
+	TEXT("If non-zero, the instance modified properties of native components that hold no object references are copied directly when caching component instance data, instead of going through tagged property serialization."),
+	ECVF_Default);
+
 class FComponentPropertyWriter : public FObjectWriter
 {
 public:
@@ -44,6 +53,29 @@ public:
 				}
 			}
 
+			// The properties of native classes live as long as the class, so their modified values can be kept as they are
+			// and left out of the tagged properties
+			if (GComponentInstanceDataDirectCopy && ComponentClass->HasAnyClassFlags(CLASS_Native))
+			{
+				const UObject* ComponentArchetype = Component->GetArchetype();
+				for (TFieldIterator<FProperty> It(ComponentClass); It; ++It)
+				{
+					FProperty* Property = *It;
+					if (Property->ShouldSerializeValue(*this) && FActorComponentInstanceDirectProperties::CanCopyDirectly(Property))
+					{
+						for (int32 Idx = 0; Idx < Property->ArrayDim; ++Idx)
+						{
+							if (!Property->Identical_InContainer(Component, ComponentArchetype, Idx, ArPortFlags))
+							{
+								ActorInstanceData.DirectProperties.Add(Property, Property->ContainerPtrToValuePtr<void>(Component));
+								PropertiesToSkip.Add(Property);
+								break;
+							}
+						}
+					}
+				}
+			}
+
 			ComponentClass->SerializeTaggedProperties(*this, (uint8*)Component, ComponentClass, (uint8*)Component->GetArchetype());
 		}
 	}
@@ -206,6 +238,173 @@ public:
 };
 
 
+FActorComponentInstanceDirectProperties::FActorComponentInstanceDirectProperties(const FActorComponentInstanceDirectProperties& Other)
+{
+	*this = Other;
+}
+
+FActorComponentInstanceDirectProperties::FActorComponentInstanceDirectProperties(FActorComponentInstanceDirectProperties&& Other)
+	: Values(MoveTemp(Other.Values))
+{
+}
+
+FActorComponentInstanceDirectProperties& FActorComponentInstanceDirectProperties::operator=(const FActorComponentInstanceDirectProperties& Other)
+{
+	if (this != &Other)
+	{
+		Reset();
+		Values.Reserve(Other.Values.Num());
+		for (const FValue& Value : Other.Values)
+		{
+			Add(Value.Property, Value.Data);
+		}
+	}
+	return *this;
+}
+
+FActorComponentInstanceDirectProperties& FActorComponentInstanceDirectProperties::operator=(FActorComponentInstanceDirectProperties&& Other)
+{
+	if (this != &Other)
+	{
+		Reset();
+		Values = MoveTemp(Other.Values);
+	}
+	return *this;
+}
+
+FActorComponentInstanceDirectProperties::~FActorComponentInstanceDirectProperties()
+{
+	Reset();
+}
+
+bool FActorComponentInstanceDirectProperties::CanCopyDirectly(const FProperty* Property)
+{
+	if (Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>() || Property->IsA<FEnumProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FStrProperty>())
+	{
+		return true;
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		// Immutable structs always serialize all their members, other structs skip the ones that aren't editable
+		if ((StructProperty->Struct->StructFlags & STRUCT_Immutable) == 0)
+		{
+			return false;
+		}
+
+		for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+		{
+			if (!CanCopyDirectly(*It))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		return CanCopyDirectly(ArrayProperty->Inner);
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		return CanCopyDirectly(SetProperty->ElementProp);
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		return CanCopyDirectly(MapProperty->KeyProp) && CanCopyDirectly(MapProperty->ValueProp);
+	}
+
+	return false;
+}
+
+FActorComponentInstanceDirectProperties::FValue& FActorComponentInstanceDirectProperties::AddInitialized(const FProperty* Property)
+{
+	FValue& Value = Values.AddDefaulted_GetRef();
+	Value.Property = Property;
+	Value.Data = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+
+	// Zeroed first, bitfield bools only initialize their own bit
+	FMemory::Memzero(Value.Data, Property->GetSize());
+	Property->InitializeValue(Value.Data);
+	return Value;
+}
+
+void FActorComponentInstanceDirectProperties::Add(const FProperty* Property, const void* Value)
+{
+	Property->CopyCompleteValue(AddInitialized(Property).Data, Value);
+}
+
+void FActorComponentInstanceDirectProperties::ApplyTo(UActorComponent* Component, const TSet<const FProperty*>& PropertiesToSkip) const
+{
+	const UClass* ComponentClass = Component->GetClass();
+	for (const FValue& Value : Values)
+	{
+		if (ComponentClass->IsChildOf(Value.Property->GetOwnerClass()) && !PropertiesToSkip.Contains(Value.Property))
+		{
+			Value.Property->CopyCompleteValue(Value.Property->ContainerPtrToValuePtr<void>(Component), Value.Data);
+		}
+	}
+}
+
+void FActorComponentInstanceDirectProperties::Serialize(FArchive& Ar, const UClass* ComponentClass)
+{
+	int32 NumValues = Values.Num();
+	Ar << NumValues;
+
+	if (Ar.IsLoading())
+	{
+		Reset();
+	}
+
+	for (int32 ValueIndex = 0; ValueIndex < NumValues; ++ValueIndex)
+	{
+		// Each value in its own array, so the values of properties that aren't found anymore can be skipped
+		FName PropertyName;
+		TArray<uint8> ValueData;
+
+		if (Ar.IsSaving())
+		{
+			const FValue& Value = Values[ValueIndex];
+			PropertyName = Value.Property->GetFName();
+
+			FMemoryWriter MemAr(ValueData);
+			FObjectAndNameAsStringProxyArchive Writer(MemAr, false);
+			for (int32 Idx = 0; Idx < Value.Property->ArrayDim; ++Idx)
+			{
+				Value.Property->SerializeItem(FStructuredArchiveFromArchive(Writer).GetSlot(), (uint8*)Value.Data + Idx * Value.Property->ElementSize, nullptr);
+			}
+		}
+
+		Ar << PropertyName;
+		Ar << ValueData;
+
+		if (Ar.IsLoading())
+		{
+			const FProperty* Property = ComponentClass ? ComponentClass->FindPropertyByName(PropertyName) : nullptr;
+			if (Property && CanCopyDirectly(Property))
+			{
+				FValue& Value = AddInitialized(Property);
+
+				FMemoryReader MemAr(ValueData);
+				FObjectAndNameAsStringProxyArchive Reader(MemAr, false);
+				for (int32 Idx = 0; Idx < Property->ArrayDim; ++Idx)
+				{
+					Property->SerializeItem(FStructuredArchiveFromArchive(Reader).GetSlot(), (uint8*)Value.Data + Idx * Property->ElementSize, nullptr);
+				}
+			}
+		}
+	}
+}
+
+void FActorComponentInstanceDirectProperties::Reset()
+{
+	for (const FValue& Value : Values)
+	{
+		Value.Property->DestroyValue(Value.Data);
+		FMemory::Free(Value.Data);
+	}
+	Values.Reset();
+}
+
 FActorComponentDuplicatedObjectData::FActorComponentDuplicatedObjectData(UObject* InObject)
 	: DuplicatedObject(InObject)
 	, ObjectPathDepth(0)
@@ -365,7 +564,7 @@ void FActorComponentInstanceData::ApplyToComponent(UActorComponent* Component, c
 {
 	// After the user construction script has run we will re-apply all the cached changes that do not conflict
 	// with a change that the user construction script made.
-	if (CacheApplyPhase == ECacheApplyPhase::PostUserConstructionScript && SavedProperties.Num() > 0)
+	if (CacheApplyPhase == ECacheApplyPhase::PostUserConstructionScript && HasSavedProperties())
 	{
 		Component->DetermineUCSModifiedProperties();
 
@@ -377,7 +576,17 @@ void FActorComponentInstanceData::ApplyToComponent(UActorComponent* Component, c
 			}
 		}
 
-		FComponentPropertyReader ComponentPropertyReader(Component, *this);
+		if (SavedProperties.Num() > 0)
+		{
+			FComponentPropertyReader ComponentPropertyReader(Component, *this);
+		}
+
+		if (DirectProperties.Num() > 0)
+		{
+			TSet<const FProperty*> UCSModifiedProperties;
+			Component->GetUCSModifiedProperties(UCSModifiedProperties);
+			DirectProperties.ApplyTo(Component, UCSModifiedProperties);
+		}
 
 		if (Component->IsRegistered())
 		{
@@ -445,6 +654,7 @@ void FComponentInstanceDataCache::Serialize(FArchive& Ar)
 	enum class EVersion : uint8
 	{
 		InitialVersion = 0,
+		WithDirectProperties,
 		// -----<new versions can be added above this line>-------------------------------------------------
 		VersionPlusOne,
 		LatestVersion = VersionPlusOne - 1
@@ -459,6 +669,22 @@ void FComponentInstanceDataCache::Serialize(FArchive& Ar)
 		return;
 	}
 
+	// The directly copied properties aren't UPROPERTYs, they follow the instance data in the same order
+	auto SerializeDirectProperties = [&Ar](TArray<TStructOnScope<FActorComponentInstanceData>>& InstanceData)
+	{
+		for (TStructOnScope<FActorComponentInstanceData>& ComponentInstanceData : InstanceData)
+		{
+			if (ComponentInstanceData.IsValid())
+			{
+				ComponentInstanceData->DirectProperties.Serialize(Ar, ComponentInstanceData->GetComponentClass());
+			}
+			else
+			{
+				FActorComponentInstanceDirectProperties EmptyDirectProperties;
+				EmptyDirectProperties.Serialize(Ar, nullptr);
+			}
+		}
+	};
 
 	if (Ar.IsLoading())
 	{
@@ -466,11 +692,16 @@ void FComponentInstanceDataCache::Serialize(FArchive& Ar)
 		// so we deserialize it in a temp array and copy it over
 		TArray<TStructOnScope<FActorComponentInstanceData>> TempInstanceData;
 		Ar << TempInstanceData;
+		if (Version >= EVersion::WithDirectProperties)
+		{
+			SerializeDirectProperties(TempInstanceData);
+		}
 		CopySerializableProperties(MoveTemp(TempInstanceData));
 	}
 	else
 	{
 		Ar << ComponentsInstanceData;
+		SerializeDirectProperties(ComponentsInstanceData);
 	}
 
 	Ar << InstanceComponentTransformToRootMap;
@@ -678,6 +909,9 @@ void FComponentInstanceDataCache::CopySerializableProperties(TArray<TStructOnSco
 		if (DestInstanceData)
 		{
 			CopyProperties(*DestInstanceData, InstanceData);
+
+			// The directly copied properties belong with the SavedProperties they were left out of
+			(*DestInstanceData)->DirectProperties = MoveTemp(InstanceData->DirectProperties);
 		}
 		// otherwise we just add our to the list, since no component instance data was created for it
 		else
@@ -996,6 +996,11 @@ FName FActorComponentTickFunction::DiagnosticContext(bool bDetailed)
 	}
 }
 
+const UObject* FActorComponentTickFunction::GetTickAccessScope() const
+{
+	return Target ? Target->GetOwner() : nullptr;
+}
+
 
 bool UActorComponent::SetupActorComponentTickFunction(struct FTickFunction* TickFunction)
 {
@@ -1411,6 +1416,13 @@ void UActorComponent::CreatePhysicsState()
 
 	if (!bPhysicsStateCreated && WorldPrivate->GetPhysicsScene() && ShouldCreatePhysicsState())
 	{
+		// A streaming level creates physics state in its own time-sliced pass once its components are registered
+		const ULevel* const Level = GetComponentLevel();
+		if (Level && Level->bDeferComponentPhysicsState)
+		{
+			return;
+		}
+
 		// Call virtual
 		OnCreatePhysicsState();
 
@@ -48,6 +48,7 @@ DECLARE_CYCLE_STAT(TEXT("Char PerformMovement"), STAT_CharacterMovementPerformMo
 DECLARE_CYCLE_STAT(TEXT("Char ReplicateMoveToServer"), STAT_CharacterMovementReplicateMoveToServer, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char CallServerMove"), STAT_CharacterMovementCallServerMove, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char ServerMove"), STAT_CharacterMovementServerMove, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("Char ProcessQueuedServerMoves"), STAT_CharacterMovementProcessQueuedServerMoves, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char ServerForcePositionUpdate"), STAT_CharacterMovementForcePositionUpdate, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char RootMotionSource Calculate"), STAT_CharacterMovementRootMotionSourceCalculate, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char RootMotionSource Apply"), STAT_CharacterMovementRootMotionSourceApply, STATGROUP_Character);
@@ -116,6 +117,38 @@ namespace CharacterMovementCVars
 		TEXT("0: Disable, 1: Enable"),
 		ECVF_Default);
 
+	// Offscreen proxy simulation
+	static int32 NetEnableSkipProxyCollisionWhenNotRendered = 1;
+	FAutoConsoleVariableRef CVarNetEnableSkipProxyCollisionWhenNotRendered(
+		TEXT("p.NetEnableSkipProxyCollisionWhenNotRendered"),
+		NetEnableSkipProxyCollisionWhenNotRendered,
+		TEXT("Whether to allow walking proxies that are not rendered to move without sweeps or floor checks, if bNetworkSkipProxyCollisionWhenNotRendered is also true on the movement component.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static float NetProxyNotRenderedTime = 1.f;
+	FAutoConsoleVariableRef CVarNetProxyNotRenderedTime(
+		TEXT("p.NetProxyNotRenderedTime"),
+		NetProxyNotRenderedTime,
+		TEXT("Seconds a proxy's mesh must not have been rendered for before it may skip collision, see p.NetEnableSkipProxyCollisionWhenNotRendered."),
+		ECVF_Default);
+
+	static int32 EnableStationaryFloorCache = 1;
+	FAutoConsoleVariableRef CVarEnableStationaryFloorCache(
+		TEXT("p.EnableStationaryFloorCache"),
+		EnableStationaryFloorCache,
+		TEXT("Whether characters with a StationaryFloorCacheLifetime reuse their last floor sweep while they and their base have not moved.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static int32 NetQueueServerMoves = 0;
+	FAutoConsoleVariableRef CVarNetQueueServerMoves(
+		TEXT("p.NetQueueServerMoves"),
+		NetQueueServerMoves,
+		TEXT("Whether the server queues the moves received from clients and simulates each character's moves together once per frame after TickDispatch, instead of simulating every move as it arrives.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
 	// Logging when character is stuck. Off by default in shipping.
 #if UE_BUILD_SHIPPING
 	static float StuckWarningPeriod = -1.f;
@@ -455,6 +488,8 @@ UCharacterMovementComponent::UCharacterMovementComponent(const FObjectInitialize
 	BrakingDecelerationFlying = 0.f;
 	BrakingDecelerationSwimming = 0.f;
 	LedgeCheckThreshold = 4.0f;
+	StationaryFloorCacheLifetime = 0.f;
+	CachedFloorSweepTime = -1.f;
 	JumpOutOfWaterPitch = 11.25f;
 
 #if WITH_EDITORONLY_DATA
@@ -1810,10 +1845,29 @@ void UCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 
 		UpdateProxyAcceleration();
 
+		// Proxies nobody is looking at only need to be roughly in the right place, the next net update corrects them anyway.
+		const USkeletalMeshComponent* const OwnerMesh = bIsSimulatedProxy ? CharacterOwner->GetMesh() : nullptr;
+		const bool bMoveWithoutCollision = bNetworkSkipProxyCollisionWhenNotRendered && CharacterMovementCVars::NetEnableSkipProxyCollisionWhenNotRendered
+			&& OwnerMesh && IsMovingOnGround() && !bHandledNetUpdate && !OwnerMesh->WasRecentlyRendered(CharacterMovementCVars::NetProxyNotRenderedTime);
+
+		if (bMoveWithoutCollision)
+		{
+			UE_LOG(LogCharacterMovement, Verbose, TEXT("Proxy %s moving without collision"), *GetNameSafe(CharacterOwner));
+			UpdatedComponent->MoveComponent(Velocity * DeltaSeconds, UpdatedComponent->GetComponentQuat(), false);
+			bNetworkProxyMovedWithoutCollision = true;
+		}
 		// May only need to simulate forward on frames where we haven't just received a new position update.
-		if (!bHandledNetUpdate || !bNetworkSkipProxyPredictionOnNetUpdate || !CharacterMovementCVars::NetEnableSkipProxyPredictionOnNetUpdate)
+		else if (!bHandledNetUpdate || !bNetworkSkipProxyPredictionOnNetUpdate || !CharacterMovementCVars::NetEnableSkipProxyPredictionOnNetUpdate)
 		{
 			UE_LOG(LogCharacterMovement, Verbose, TEXT("Proxy %s simulating movement"), *GetNameSafe(CharacterOwner));
+
+			if (bNetworkProxyMovedWithoutCollision)
+			{
+				// CurrentFloor is from before we stopped checking it
+				bNetworkProxyMovedWithoutCollision = false;
+				UpdateFloorFromAdjustment();
+			}
+
 			FStepDownResult StepDownResult;
 			MoveSmooth(Velocity, DeltaSeconds, &StepDownResult);
 
@@ -6184,7 +6238,12 @@ void UCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFin
 	{
 		UCharacterMovementComponent* MutableThis = const_cast<UCharacterMovementComponent*>(this);
 
-		if ( bAlwaysCheckFloor || !bCanUseCachedLocation || bForceNextFloorCheck || bJustTeleported )
+		if ( bCanUseCachedLocation && !bForceNextFloorCheck && !bJustTeleported && CanUseCachedFloorSweep(CapsuleLocation) )
+		{
+			OutFloorResult = CachedFloorSweepResult;
+			bNeedToValidateFloor = false;
+		}
+		else if ( bAlwaysCheckFloor || !bCanUseCachedLocation || bForceNextFloorCheck || bJustTeleported )
 		{
 			MutableThis->bForceNextFloorCheck = false;
 			ComputeFloorDist(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
@@ -6257,6 +6316,61 @@ void UCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFin
 			}
 		}
 	}
+
+	// Remember the swept floor so that a character that stays still can skip the next sweeps
+	if (bNeedToValidateFloor && StationaryFloorCacheLifetime > 0.f)
+	{
+		UCharacterMovementComponent* MutableThis = const_cast<UCharacterMovementComponent*>(this);
+		UPrimitiveComponent* FloorComponent = OutFloorResult.bBlockingHit ? OutFloorResult.HitResult.GetComponent() : nullptr;
+		if (FloorComponent)
+		{
+			float CapsuleRadius, CapsuleHalfHeight;
+			CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+
+			MutableThis->CachedFloorSweepResult = OutFloorResult;
+			MutableThis->CachedFloorSweepLocation = CapsuleLocation;
+			MutableThis->CachedFloorSweepCapsuleSize = FVector2D(CapsuleRadius, CapsuleHalfHeight);
+			MutableThis->CachedFloorSweepBase = FloorComponent;
+			MutableThis->CachedFloorSweepBaseTransform = FloorComponent->GetComponentTransform();
+			MutableThis->CachedFloorSweepTime = GetWorld()->GetTimeSeconds();
+		}
+		else
+		{
+			MutableThis->CachedFloorSweepTime = -1.f;
+		}
+	}
+}
+
+
+bool UCharacterMovementComponent::CanUseCachedFloorSweep(const FVector& CapsuleLocation) const
+{
+	if (CachedFloorSweepTime < 0.f || StationaryFloorCacheLifetime <= 0.f || CharacterMovementCVars::EnableStationaryFloorCache == 0)
+	{
+		return false;
+	}
+
+	if (GetWorld()->TimeSince(CachedFloorSweepTime) > StationaryFloorCacheLifetime || CapsuleLocation != CachedFloorSweepLocation)
+	{
+		return false;
+	}
+
+	float CapsuleRadius, CapsuleHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+	if (CachedFloorSweepCapsuleSize != FVector2D(CapsuleRadius, CapsuleHalfHeight))
+	{
+		return false;
+	}
+
+	// The floor must still be there and still block us
+	const UPrimitiveComponent* FloorComponent = CachedFloorSweepBase.Get();
+	if (FloorComponent == nullptr || FloorComponent->IsPendingKill() || !FloorComponent->IsQueryCollisionEnabled()
+		|| FloorComponent->GetCollisionResponseToChannel(UpdatedComponent->GetCollisionObjectType()) != ECR_Block)
+	{
+		return false;
+	}
+
+	// Static components cannot move, anything else must be exactly where it was
+	return FloorComponent->Mobility == EComponentMobility::Static || FloorComponent->GetComponentTransform().Equals(CachedFloorSweepBaseTransform, 0.f);
 }
 
 
@@ -8289,6 +8403,9 @@ void UCharacterMovementComponent::ServerMoveOld_Implementation
 	FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character();
 	check(ServerData);
 
+	// Old moves are not queued, simulate the moves that arrived before this one first so they are verified in the order they were received
+	ProcessQueuedServerMoves();
+
 	if( !VerifyClientTimeStamp(OldTimeStamp, *ServerData) )
 	{
 		UE_LOG(LogNetPlayerMovement, VeryVerbose, TEXT("ServerMoveOld: TimeStamp expired. %f, CurrentTimeStamp: %f, Character: %s"), OldTimeStamp, ServerData->CurrentClientTimeStamp, *GetNameSafe(CharacterOwner));
@@ -8683,6 +8800,27 @@ void UCharacterMovementComponent::ServerMove_Implementation(
 	FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character();
 	check(ServerData);
 
+	if (CharacterMovementCVars::NetQueueServerMoves != 0 && !ServerData->bProcessingQueuedServerMoves)
+	{
+		if (ServerData->QueuedServerMoves.Num() == 0)
+		{
+			GetWorld()->CharacterMovementComponentsWithQueuedServerMoves.Add(this);
+		}
+
+		FNetworkPredictionData_Server_Character::FQueuedServerMove& QueuedMove = ServerData->QueuedServerMoves.AddDefaulted_GetRef();
+		QueuedMove.TimeStamp = TimeStamp;
+		QueuedMove.Accel = InAccel;
+		QueuedMove.ClientLoc = ClientLoc;
+		QueuedMove.MoveFlags = MoveFlags;
+		QueuedMove.ClientRoll = ClientRoll;
+		QueuedMove.View = View;
+		QueuedMove.ClientMovementBase = ClientMovementBase;
+		QueuedMove.ClientBaseBoneName = ClientBaseBoneName;
+		QueuedMove.ClientMovementMode = ClientMovementMode;
+		QueuedMove.bIgnoreRootMotion = CharacterOwner->bServerMoveIgnoreRootMotion;
+		return;
+	}
+
 	if( !VerifyClientTimeStamp(TimeStamp, *ServerData) )
 	{
 		const float ServerTimeStamp = ServerData->CurrentClientTimeStamp;
@@ -8755,6 +8893,73 @@ void UCharacterMovementComponent::ServerMove_Implementation(
 	ServerMoveHandleClientError(TimeStamp, DeltaTime, Accel, ClientLoc, ClientMovementBase, ClientBaseBoneName, ClientMovementMode);
 }
 
+void UCharacterMovementComponent::ProcessQueuedServerMoves()
+{
+	if (!HasPredictionData_Server() || !HasValidData())
+	{
+		return;
+	}
+
+	FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character();
+	if (ServerData->QueuedServerMoves.Num() == 0 || ServerData->bProcessingQueuedServerMoves)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_CharacterMovementProcessQueuedServerMoves);
+
+	TArray<FNetworkPredictionData_Server_Character::FQueuedServerMove> QueuedMoves = MoveTemp(ServerData->QueuedServerMoves);
+	ServerData->QueuedServerMoves.Reset();
+	ServerData->bProcessingQueuedServerMoves = true;
+
+	{
+		// Combine the moves of the frame so overlaps and child transforms are only updated once for all of them
+		FScopedMovementUpdate ScopedMovementUpdate(UpdatedComponent, bEnableServerDualMoveScopedMovementUpdates ? EScopedUpdate::DeferredUpdates : EScopedUpdate::ImmediateUpdates);
+
+		for (const FNetworkPredictionData_Server_Character::FQueuedServerMove& Move : QueuedMoves)
+		{
+			// A move may destroy the character or reset its prediction data, the remaining moves are dropped in that case
+			if (!HasValidData() || ServerPredictionData != ServerData)
+			{
+				break;
+			}
+
+			CharacterOwner->bServerMoveIgnoreRootMotion = Move.bIgnoreRootMotion;
+			ServerMove_Implementation(Move.TimeStamp, Move.Accel, Move.ClientLoc, Move.MoveFlags, Move.ClientRoll, Move.View, Move.ClientMovementBase.Get(), Move.ClientBaseBoneName, Move.ClientMovementMode);
+		}
+	}
+
+	if (CharacterOwner)
+	{
+		CharacterOwner->bServerMoveIgnoreRootMotion = false;
+	}
+
+	if (ServerPredictionData == ServerData)
+	{
+		ServerData->bProcessingQueuedServerMoves = false;
+	}
+}
+
+void UCharacterMovementComponent::ProcessAllQueuedServerMoves(UWorld* World)
+{
+	if (World->CharacterMovementComponentsWithQueuedServerMoves.Num() == 0)
+	{
+		return;
+	}
+
+	// A component that queues again after its old moves flushed its queue may be listed twice, the second visit finds nothing to do
+	TArray<TWeakObjectPtr<UCharacterMovementComponent>> Components = MoveTemp(World->CharacterMovementComponentsWithQueuedServerMoves);
+	World->CharacterMovementComponentsWithQueuedServerMoves.Reset();
+
+	for (const TWeakObjectPtr<UCharacterMovementComponent>& WeakComponent : Components)
+	{
+		if (UCharacterMovementComponent* Component = WeakComponent.Get())
+		{
+			Component->ProcessQueuedServerMoves();
+		}
+	}
+}
+
 
 void UCharacterMovementComponent::ServerMoveHandleClientError(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& RelativeClientLoc, UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode)
 {
@@ -10447,6 +10652,7 @@ FNetworkPredictionData_Server_Character::FNetworkPredictionData_Server_Character
 	, TimeDiscrepancyResolutionMoveDeltaOverride(0.f)
 	, TimeDiscrepancyAccumulatedClientDeltasSinceLastServerTick(0.f)
 	, WorldCreationTime(0.f)
+	, bProcessingQueuedServerMoves(false)
 {
 	const AGameNetworkManager* GameNetworkManager = (const AGameNetworkManager*)(AGameNetworkManager::StaticClass()->GetDefaultObject());
 	if (GameNetworkManager)
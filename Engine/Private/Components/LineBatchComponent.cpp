@@ -265,56 +265,33 @@ void ULineBatchComponent::DrawCircle(const FVector& Base,const FVector& X,const
 	MarkRenderStateDirty();
 }
 
-void ULineBatchComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+/**
+ * Ages the elements that have a lifetime and removes the expired ones in a single pass.
+ * Elements without a lifetime are persistent. Keeps the allocation since elements are usually re-added every frame.
+ * @return true if any element expired
+ */
+template<typename ElementType>
+static bool ExpireBatchedElements(TArray<ElementType>& Elements, float DeltaTime)
 {
-	bool bDirty = false;
-	// Update the life time of batched lines, removing the lines which have expired.
-	for(int32 LineIndex=0; LineIndex < BatchedLines.Num(); LineIndex++)
+	const int32 NumElements = Elements.Num();
+	Elements.RemoveAllSwap([DeltaTime](ElementType& Element)
 	{
-		FBatchedLine& Line = BatchedLines[LineIndex];
-		if (Line.RemainingLifeTime > 0.0f)
+		if (Element.RemainingLifeTime > 0.0f)
 		{
-			Line.RemainingLifeTime -= DeltaTime;
-			if(Line.RemainingLifeTime <= 0.0f)
-			{
-				// The line has expired, remove it.
-				BatchedLines.RemoveAtSwap(LineIndex--);
-				bDirty = true;
-			}
-		}
-	}
-
-	// Update the life time of batched points, removing the points which have expired.
-	for(int32 PtIndex=0; PtIndex < BatchedPoints.Num(); PtIndex++)
-	{
-		FBatchedPoint& Pt = BatchedPoints[PtIndex];
-		if (Pt.RemainingLifeTime > 0.0f)
-		{
-			Pt.RemainingLifeTime -= DeltaTime;
-			if(Pt.RemainingLifeTime <= 0.0f)
-			{
-				// The point has expired, remove it.
-				BatchedPoints.RemoveAtSwap(PtIndex--);
-				bDirty = true;
-			}
+			Element.RemainingLifeTime -= DeltaTime;
+			return Element.RemainingLifeTime <= 0.0f;
 		}
-	}
+		return false;
+	}, false);
+	return Elements.Num() != NumElements;
+}
 
-	// Update the life time of batched meshes, removing the meshes which have expired.
-	for(int32 MeshIndex=0; MeshIndex < BatchedMeshes.Num(); MeshIndex++)
-	{
-		FBatchedMesh& Mesh = BatchedMeshes[MeshIndex];
-		if (Mesh.RemainingLifeTime > 0.0f)
-		{
-			Mesh.RemainingLifeTime -= DeltaTime;
-			if(Mesh.RemainingLifeTime <= 0.0f)
-			{
-				// The mesh has expired, remove it.
-				BatchedMeshes.RemoveAtSwap(MeshIndex--);
-				bDirty = true;
-			}
-		}
-	}
+void ULineBatchComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	// Update the life time of batched lines, points and meshes, removing the ones which have expired.
+	bool bDirty = ExpireBatchedElements(BatchedLines, DeltaTime);
+	bDirty |= ExpireBatchedElements(BatchedPoints, DeltaTime);
+	bDirty |= ExpireBatchedElements(BatchedMeshes, DeltaTime);
 
 	if(bDirty)
 	{
@@ -408,9 +385,10 @@ void ULineBatchComponent::Flush()
 {
 	if (BatchedLines.Num() > 0 || BatchedPoints.Num() > 0 || BatchedMeshes.Num() > 0)
 	{
-		BatchedLines.Empty();
-		BatchedPoints.Empty();
-		BatchedMeshes.Empty();
+		// Keep the allocations, the per-frame line batcher is flushed and refilled every frame
+		BatchedLines.Reset();
+		BatchedPoints.Reset();
+		BatchedMeshes.Reset();
 		MarkRenderStateDirty();
 	}
 }
@@ -27,6 +27,7 @@
 #include "Misc/UObjectToken.h"
 #include "Misc/MapErrors.h"
 #include "CollisionDebugDrawingPublic.h"
+#include "StaticCollisionStore.h"
 #include "GameFramework/CheatManager.h"
 #include "Streaming/TextureStreamingHelpers.h"
 #include "PrimitiveSceneProxy.h"
@@ -67,6 +68,13 @@ static FAutoConsoleVariableRef CVarAllowCachedOverlaps(
 	TEXT("0: disable cached overlaps, 1: enable (default)"),
 	ECVF_Default);
 
+static int32 GAllowDeferredOverlapUpdates = 1;
+static FAutoConsoleVariableRef CVarAllowDeferredOverlapUpdates(
+	TEXT("p.AllowDeferredOverlapUpdates"),
+	GAllowDeferredOverlapUpdates,
+	TEXT("If non-zero, components with bDeferOverlapUpdates set update their overlaps once per frame after physics instead of after every move."),
+	ECVF_Default);
+
 static float InitialOverlapToleranceCVar = 0.0f;
 static FAutoConsoleVariableRef CVarInitialOverlapTolerance(
 	TEXT("p.InitialOverlapTolerance"),
@@ -107,6 +115,7 @@ DECLARE_CYCLE_STAT(TEXT("MoveComponent FastOverlap"), STAT_MoveComponent_FastOve
 DECLARE_CYCLE_STAT(TEXT("BeginComponentOverlap"), STAT_BeginComponentOverlap, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("EndComponentOverlap"), STAT_EndComponentOverlap, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("PrimComp DispatchBlockingHit"), STAT_DispatchBlockingHit, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("FlushDeferredOverlapUpdates"), STAT_FlushDeferredOverlapUpdates, STATGROUP_Game);
 
 
 // Predicate to determine if an overlap is with a certain AActor.
@@ -670,7 +679,7 @@ void FPrimitiveComponentInstanceData::ApplyToComponent(UActorComponent* Componen
 		PrimitiveComponent->VisibilityId = VisibilityId;
 	}
 
-	if (Component->IsRegistered() && ((VisibilityId != INDEX_NONE) || SavedProperties.Num() > 0))
+	if (Component->IsRegistered() && ((VisibilityId != INDEX_NONE) || HasSavedProperties()))
 	{
 		Component->MarkRenderStateDirty();
 	}
@@ -756,7 +765,11 @@ void UPrimitiveComponent::OnCreatePhysicsState()
 		}
 
 		UBodySetup* BodySetup = GetBodySetup();
-		if(BodySetup)
+		if (BodySetup && ShouldUseStaticCollisionStore() && GetWorld()->GetOrCreateStaticCollisionStore().AddComponent(this, BodySetup))
+		{
+			bInStaticCollisionStore = true;
+		}
+		else if(BodySetup)
 		{
 			// Create new BodyInstance at given location.
 			FTransform BodyTransform = GetComponentTransform();
@@ -860,6 +873,12 @@ void UPrimitiveComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransfor
 
 void UPrimitiveComponent::SendPhysicsTransform(ETeleportType Teleport)
 {
+	if (bInStaticCollisionStore)
+	{
+		MarkStaticCollisionStoreDirty();
+		return;
+	}
+
 	BodyInstance.SetBodyTransform(GetComponentTransform(), Teleport);
 	BodyInstance.UpdateBodyScale(GetComponentTransform().GetScale3D());
 }
@@ -877,6 +896,8 @@ void UPrimitiveComponent::OnDestroyPhysicsState()
 		BodyInstance.TermBody();
 	}
 
+	RemoveFromStaticCollisionStore();
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	SendRenderDebugPhysics();
 #endif
@@ -884,6 +905,45 @@ void UPrimitiveComponent::OnDestroyPhysicsState()
 	Super::OnDestroyPhysicsState();
 }
 
+bool UPrimitiveComponent::ShouldUseStaticCollisionStore() const
+{
+	const UWorld* World = GetWorld();
+	return bUseStaticCollisionStore && FStaticCollisionStore::IsEnabled()
+		&& World && World->IsGameWorld()
+		&& Mobility == EComponentMobility::Static
+		&& GetCollisionEnabled() == ECollisionEnabled::QueryOnly;
+}
+
+void UPrimitiveComponent::GetStaticCollisionStoreInstances(TArray<FTransform>& OutTransforms, TArray<int32>& OutItems) const
+{
+	// Zero scale bodies can't be hit, the same way they are created tiny when they are physics bodies
+	if (!GetComponentTransform().GetScale3D().IsNearlyZero())
+	{
+		OutTransforms.Add(GetComponentTransform());
+		OutItems.Add(INDEX_NONE);
+	}
+}
+
+void UPrimitiveComponent::RemoveFromStaticCollisionStore()
+{
+	if (bInStaticCollisionStore)
+	{
+		bInStaticCollisionStore = false;
+		if (FStaticCollisionStore* Store = GetWorld() ? GetWorld()->GetStaticCollisionStore() : nullptr)
+		{
+			Store->RemoveComponent(this);
+		}
+	}
+}
+
+void UPrimitiveComponent::MarkStaticCollisionStoreDirty()
+{
+	if (bInStaticCollisionStore)
+	{
+		GetWorld()->GetOrCreateStaticCollisionStore().MarkComponentDirty(this);
+	}
+}
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 void UPrimitiveComponent::SendRenderDebugPhysics(FPrimitiveSceneProxy* OverrideSceneProxy)
 {
@@ -2281,7 +2341,7 @@ bool UPrimitiveComponent::MoveComponentImpl( const FVector& Delta, const FQuat&
 				ScopedUpdate->AppendOverlapsAfterMove(PendingOverlaps, bSweep, bIncludesOverlapsAtEnd);
 			}
 		}
-		else
+		else if (!QueueDeferredOverlapUpdate((MoveFlags & MOVECOMP_DeferOverlapUpdate) != MOVECOMP_NoFlags))
 		{
 			if (bIncludesOverlapsAtEnd)
 			{
@@ -3285,6 +3345,59 @@ bool UPrimitiveComponent::UpdateOverlapsImpl(const TOverlapArrayView* NewPending
 	return bCanSkipUpdateOverlaps;
 }
 
+bool UPrimitiveComponent::QueueDeferredOverlapUpdate(bool bForceDefer)
+{
+	if (!(bDeferOverlapUpdates || bForceDefer) || !GAllowDeferredOverlapUpdates || !IsInGameThread())
+	{
+		return false;
+	}
+
+	UWorld* const World = GetWorld();
+	if (World == nullptr || !World->IsGameWorld())
+	{
+		return false;
+	}
+
+	if (!bPendingDeferredOverlapUpdate)
+	{
+		bPendingDeferredOverlapUpdate = true;
+		World->ComponentsPendingDeferredOverlapUpdate.Add(this);
+	}
+	return true;
+}
+
+void UPrimitiveComponent::FlushDeferredOverlapUpdates(UWorld* World)
+{
+	if (World == nullptr || World->ComponentsPendingDeferredOverlapUpdate.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlushDeferredOverlapUpdates);
+	check(IsInGameThread());
+
+	// Overlap events may move or queue components again, those wait for the next pass
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Pending = MoveTemp(World->ComponentsPendingDeferredOverlapUpdate);
+	World->ComponentsPendingDeferredOverlapUpdate.Reset();
+
+	for (const TWeakObjectPtr<UPrimitiveComponent>& WeakComponent : Pending)
+	{
+		if (UPrimitiveComponent* Component = WeakComponent.Get())
+		{
+			Component->bPendingDeferredOverlapUpdate = false;
+		}
+	}
+
+	for (const TWeakObjectPtr<UPrimitiveComponent>& WeakComponent : Pending)
+	{
+		UPrimitiveComponent* Component = WeakComponent.Get();
+		if (Component && Component->IsRegistered() && !Component->IsPendingKill())
+		{
+			Component->UpdateOverlaps();
+		}
+	}
+}
+
 bool RequiresUpdateOverlaps(bool bGenerateOverlapEvents)
 {
 	return bGenerateOverlapEvents;
@@ -25,6 +25,8 @@ void URuntimeVirtualTextureComponent::CreateRenderState_Concurrent(FRegisterComp
 	{
 		// This will modify the URuntimeVirtualTexture and allocate its VT
 		GetScene()->AddRuntimeVirtualTexture(this);
+		SentVirtualTextureTransform = GetVirtualTextureTransform();
+		bHasSentVirtualTexture = true;
 	}
 
 	Super::CreateRenderState_Concurrent(Context);
@@ -34,8 +36,15 @@ void URuntimeVirtualTextureComponent::SendRenderTransform_Concurrent()
 {
 	if (ShouldRender() && VirtualTexture != nullptr)
 	{
-		// This will modify the URuntimeVirtualTexture and allocate its VT
-		GetScene()->AddRuntimeVirtualTexture(this);
+		// Transform updates that don't move the virtual texture (e.g. bounds only updates) keep the pages already rendered
+		const FTransform VirtualTextureTransform = GetVirtualTextureTransform();
+		if (!bHasSentVirtualTexture || !VirtualTextureTransform.Equals(SentVirtualTextureTransform, 0.f))
+		{
+			// This will modify the URuntimeVirtualTexture and allocate its VT
+			GetScene()->AddRuntimeVirtualTexture(this);
+			SentVirtualTextureTransform = VirtualTextureTransform;
+			bHasSentVirtualTexture = true;
+		}
 	}
 
 	Super::SendRenderTransform_Concurrent();
@@ -45,6 +54,7 @@ void URuntimeVirtualTextureComponent::DestroyRenderState_Concurrent()
 {
 	// This will modify the URuntimeVirtualTexture and free its VT
 	GetScene()->RemoveRuntimeVirtualTexture(this);
+	bHasSentVirtualTexture = false;
 
 	Super::DestroyRenderState_Concurrent();
 }
@@ -33,11 +33,50 @@
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/TextureRenderTarget2D.h"
+#include "Engine/TextureRenderTargetCube.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
 
 #define LOCTEXT_NAMESPACE "SceneCaptureComponent"
 
 static TMultiMap<TWeakObjectPtr<UWorld>, TWeakObjectPtr<USceneCaptureComponent> > SceneCapturesToUpdateMap;
 
+static float GSceneCaptureFrameBudgetMS = 0.0f;
+static FAutoConsoleVariableRef CVarSceneCaptureFrameBudgetMS(
+	TEXT("r.SceneCapture.FrameBudgetMS"),
+	GSceneCaptureFrameBudgetMS,
+	TEXT("Game thread time in milliseconds deferred scene captures may spend submitting captures per frame, 0 for no budget.\n")
+	TEXT("Captures over the budget are postponed to the next frame, displayed captures and the ones postponed the longest go first."),
+	ECVF_Default);
+
+static int32 GSceneCaptureMaxCapturesPerFrame = 0;
+static FAutoConsoleVariableRef CVarSceneCaptureMaxCapturesPerFrame(
+	TEXT("r.SceneCapture.MaxCapturesPerFrame"),
+	GSceneCaptureMaxCapturesPerFrame,
+	TEXT("Maximum number of deferred scene captures rendered per frame, 0 for no limit. Bounds the GPU time captures take per frame."),
+	ECVF_Default);
+
+static int32 GSceneCaptureMaxDeferredFrames = 4;
+static FAutoConsoleVariableRef CVarSceneCaptureMaxDeferredFrames(
+	TEXT("r.SceneCapture.MaxDeferredFrames"),
+	GSceneCaptureMaxDeferredFrames,
+	TEXT("Number of frames a scene capture can be postponed by r.SceneCapture.FrameBudgetMS or r.SceneCapture.MaxCapturesPerFrame before it's rendered regardless."),
+	ECVF_Default);
+
+static int32 GSceneCaptureUndisplayedUpdateInterval = 0;
+static FAutoConsoleVariableRef CVarSceneCaptureUndisplayedUpdateInterval(
+	TEXT("r.SceneCapture.UndisplayedUpdateInterval"),
+	GSceneCaptureUndisplayedUpdateInterval,
+	TEXT("If > 1, deferred scene captures whose render target wasn't drawn in the last second are only rendered every that many frames, 0 to always render them."),
+	ECVF_Default);
+
+/** Whether a material sampling the texture was rendered in the last second, e.g. the screen showing a security camera */
+static bool IsCaptureTextureDisplayed(const UTexture* Texture)
+{
+	// The render thread updates LastRenderTime, a stale value only delays the capture by a frame
+	return Texture && Texture->Resource && FApp::GetCurrentTime() - Texture->Resource->LastRenderTime <= 1.0;
+}
+
 ASceneCapture::ASceneCapture(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -386,29 +425,69 @@ void USceneCaptureComponent::UpdateDeferredCaptures(FSceneInterface* Scene)
 	// Updating others not associated with the scene would cause invalid data to be rendered into the target
 	TArray< TWeakObjectPtr<USceneCaptureComponent> > SceneCapturesToUpdate;
 	SceneCapturesToUpdateMap.MultiFind(World, SceneCapturesToUpdate);
-	SceneCapturesToUpdate.Sort([](const TWeakObjectPtr<USceneCaptureComponent>& A, const TWeakObjectPtr<USceneCaptureComponent>& B)
+
+	struct FPendingCapture
 	{
-		if (!A.IsValid())
+		USceneCaptureComponent* Component;
+		bool bDisplayed;
+	};
+
+	const bool bScheduleUndisplayed = GSceneCaptureUndisplayedUpdateInterval > 1;
+	TArray<FPendingCapture, TInlineAllocator<16>> PendingCaptures;
+	for (const TWeakObjectPtr<USceneCaptureComponent>& WeakComponent : SceneCapturesToUpdate)
+	{
+		if (USceneCaptureComponent* Component = WeakComponent.Get())
 		{
-			return false;
+			PendingCaptures.Add({ Component, !bScheduleUndisplayed || IsCaptureTextureDisplayed(Component->GetCaptureTexture()) });
 		}
-		else if (!B.IsValid())
+	}
+
+	// CaptureSortPriority first, captures may depend on others having rendered. Within a priority, displayed captures and the ones postponed the longest go first.
+	PendingCaptures.Sort([](const FPendingCapture& A, const FPendingCapture& B)
+	{
+		if (A.Component->CaptureSortPriority != B.Component->CaptureSortPriority)
 		{
-			return true;
+			return A.Component->CaptureSortPriority > B.Component->CaptureSortPriority;
 		}
-		return A->CaptureSortPriority > B->CaptureSortPriority;
+		if (A.bDisplayed != B.bDisplayed)
+		{
+			return A.bDisplayed;
+		}
+		return A.Component->NumFramesDeferred > B.Component->NumFramesDeferred;
 	});
 
-	for (TWeakObjectPtr<USceneCaptureComponent> Component : SceneCapturesToUpdate)
+	const uint64 BudgetCycles = GSceneCaptureFrameBudgetMS > 0.0f ? uint64(GSceneCaptureFrameBudgetMS / (1000.0 * FPlatformTime::GetSecondsPerCycle64())) : 0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	int32 NumCaptured = 0;
+	TArray<USceneCaptureComponent*, TInlineAllocator<16>> PostponedCaptures;
+
+	for (const FPendingCapture& PendingCapture : PendingCaptures)
 	{
-		if (Component.IsValid())
+		USceneCaptureComponent* Component = PendingCapture.Component;
+
+		const bool bOverdue = Component->NumFramesDeferred >= GSceneCaptureMaxDeferredFrames;
+		const bool bOverBudget = NumCaptured > 0 && ((GSceneCaptureMaxCapturesPerFrame > 0 && NumCaptured >= GSceneCaptureMaxCapturesPerFrame)
+			|| (BudgetCycles > 0 && FPlatformTime::Cycles64() - StartCycles > BudgetCycles));
+		const bool bSkipUndisplayed = !PendingCapture.bDisplayed && Component->NumFramesDeferred + 1 < GSceneCaptureUndisplayedUpdateInterval;
+
+		if (bSkipUndisplayed || (bOverBudget && !bOverdue))
 		{
-			Component->UpdateSceneCaptureContents(Scene);
+			++Component->NumFramesDeferred;
+			PostponedCaptures.Add(Component);
+			continue;
 		}
+
+		Component->NumFramesDeferred = 0;
+		Component->UpdateSceneCaptureContents(Scene);
+		++NumCaptured;
 	}
 
-	// All scene captures for this world have been updated
+	// All scene captures for this world have been updated, or are postponed to the next frame
 	SceneCapturesToUpdateMap.Remove(World);
+	for (USceneCaptureComponent* Component : PostponedCaptures)
+	{
+		SceneCapturesToUpdateMap.AddUnique(World, Component);
+	}
 }
 
 void USceneCaptureComponent::OnUnregister()
@@ -696,6 +775,11 @@ void USceneCaptureComponent2D::Serialize(FArchive& Ar)
 	}
 }
 
+UTexture* USceneCaptureComponent2D::GetCaptureTexture() const
+{
+	return TextureTarget;
+}
+
 void USceneCaptureComponent2D::UpdateSceneCaptureContents(FSceneInterface* Scene)
 {
 	Scene->UpdateSceneCaptureContents(this);
@@ -1106,6 +1190,11 @@ void USceneCaptureComponentCube::CaptureScene()
 	}
 }
 
+UTexture* USceneCaptureComponentCube::GetCaptureTexture() const
+{
+	return TextureTarget;
+}
+
 void USceneCaptureComponentCube::UpdateSceneCaptureContents(FSceneInterface* Scene)
 {
 	Scene->UpdateSceneCaptureContents(this);
@@ -52,6 +52,17 @@ DECLARE_CYCLE_STAT(TEXT("UpdateChildTransforms"), STAT_UpdateChildTransforms, ST
 DECLARE_CYCLE_STAT(TEXT("Component UpdateBounds"), STAT_ComponentUpdateBounds, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component UpdateNavData"), STAT_ComponentUpdateNavData, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component PostUpdateNavData"), STAT_ComponentPostUpdateNavData, STATGROUP_Component);
+DECLARE_CYCLE_STAT(TEXT("FlushDeferredChildTransformUpdates"), STAT_FlushDeferredChildTransformUpdates, STATGROUP_Component);
+
+static int32 GDeferChildTransformUpdates = 0;
+static FAutoConsoleVariableRef CVarDeferChildTransformUpdates(
+	TEXT("SceneComponent.DeferChildTransformUpdates"),
+	GDeferChildTransformUpdates,
+	TEXT("If non-zero, components with bDeferChildTransformUpdates set update their attach children once per tick group instead of every time they move.")
+);
+
+/** Work list of the batched pass in FlushDeferredChildTransformUpdates. While set, components append themselves instead of recursing into their children. */
+static TArray<FDeferredChildTransformUpdate>* GChildTransformUpdateBatch = nullptr;
 
 
 FOverlapInfo::FOverlapInfo(UPrimitiveComponent* InComponent, int32 InBodyIndex)
@@ -764,7 +775,7 @@ void USceneComponent::PropagateTransformUpdate(bool bTransformChanged, EUpdateTr
 			if (AttachedChildren.Num() > 0)
 			{
 				EUpdateTransformFlags ChildrenFlagNoPhysics = ~EUpdateTransformFlags::SkipPhysicsUpdate & UpdateTransformFlags;
-				UpdateChildTransforms(ChildrenFlagNoPhysics, Teleport);
+				UpdateOrDeferChildTransforms(ChildrenFlagNoPhysics, Teleport);
 			}
 		}
 
@@ -796,7 +807,7 @@ void USceneComponent::PropagateTransformUpdate(bool bTransformChanged, EUpdateTr
 			// Now go and update children
 			if (AttachedChildren.Num() > 0)
 			{
-				UpdateChildTransforms();
+				UpdateOrDeferChildTransforms(EUpdateTransformFlags::None, ETeleportType::None);
 			}
 		}
 
@@ -810,6 +821,85 @@ void USceneComponent::PropagateTransformUpdate(bool bTransformChanged, EUpdateTr
 	}
 }
 
+void USceneComponent::UpdateOrDeferChildTransforms(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (GChildTransformUpdateBatch)
+	{
+		// The batched pass visits our children after everything queued before us
+		GChildTransformUpdateBatch->Add({ this, UpdateTransformFlags, Teleport });
+		return;
+	}
+
+	UWorld* World = (bDeferChildTransformUpdates && GDeferChildTransformUpdates && bRegistered && IsInGameThread()) ? GetWorld() : nullptr;
+	if (World && World->IsGameWorld())
+	{
+		if (!bPendingChildTransformUpdate)
+		{
+			bPendingChildTransformUpdate = true;
+			World->DeferredChildTransformUpdates.Add({ this, UpdateTransformFlags, Teleport });
+		}
+		else if (Teleport != ETeleportType::None)
+		{
+			// Keep the strongest teleport of all the moves since the last pass
+			FDeferredChildTransformUpdate* Pending = World->DeferredChildTransformUpdates.FindByPredicate([this](const FDeferredChildTransformUpdate& Update) { return Update.Component.Get() == this; });
+			if (Pending && Pending->Teleport < Teleport)
+			{
+				Pending->Teleport = Teleport;
+			}
+		}
+		return;
+	}
+
+	UpdateChildTransforms(UpdateTransformFlags, Teleport);
+}
+
+void USceneComponent::FlushDeferredChildTransformUpdates(UWorld* World)
+{
+	if (World == nullptr || World->DeferredChildTransformUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlushDeferredChildTransformUpdates);
+	check(IsInGameThread());
+	checkf(GChildTransformUpdateBatch == nullptr, TEXT("FlushDeferredChildTransformUpdates is not reentrant"));
+
+	// Flatten the dirty subtrees into one work list. Children whose transform changes append themselves to the end of the list,
+	// so it is walked breadth first and every parent is up to date before its children are computed.
+	TArray<FDeferredChildTransformUpdate> Batch = MoveTemp(World->DeferredChildTransformUpdates);
+	World->DeferredChildTransformUpdates.Reset();
+
+	const int32 NumQueued = Batch.Num();
+	for (FDeferredChildTransformUpdate& Update : Batch)
+	{
+		if (USceneComponent* Component = Update.Component.Get())
+		{
+			Component->bPendingChildTransformUpdate = false;
+		}
+	}
+
+	GChildTransformUpdateBatch = &Batch;
+	for (int32 Index = 0; Index < Batch.Num(); ++Index)
+	{
+		// Copy out, the array may grow while the children are updated
+		const FDeferredChildTransformUpdate Update = Batch[Index];
+		if (USceneComponent* Component = Update.Component.Get())
+		{
+			Component->UpdateChildTransforms(Update.UpdateTransformFlags, Update.Teleport);
+		}
+	}
+	GChildTransformUpdateBatch = nullptr;
+
+	// Overlaps of the children were evaluated at their old location when the queued components moved
+	for (int32 Index = 0; Index < NumQueued; ++Index)
+	{
+		USceneComponent* Component = Batch[Index].Component.Get();
+		if (Component && Component->IsRegistered() && !Component->IsPendingKill())
+		{
+			Component->UpdateOverlaps();
+		}
+	}
+}
 
 void USceneComponent::EndScopedMovementUpdate(class FScopedMovementUpdate& CompletedScope)
 {
@@ -842,7 +932,11 @@ void USceneComponent::EndScopedMovementUpdate(class FScopedMovementUpdate& Compl
 			if (bTransformChanged || CurrentScopedUpdate->bHasMoved)
 			{
 				UPrimitiveComponent* PrimitiveThis = Cast<UPrimitiveComponent>(this);
-				if (PrimitiveThis)
+				if (PrimitiveThis && PrimitiveThis->QueueDeferredOverlapUpdate())
+				{
+					// Overlaps are updated by the batched pass at their final location
+				}
+				else if (PrimitiveThis)
 				{
 					// NOTE: UpdateOverlaps filters events to only consider overlaps where bGenerateOverlapEvents is true for both components, so it's ok if we queued up other overlaps.
 					TInlineOverlapInfoArray EndOverlaps;
@@ -2284,7 +2378,7 @@ void FSceneComponentInstanceData::ApplyToComponent(UActorComponent* Component, c
 
 	USceneComponent* SceneComponent = CastChecked<USceneComponent>(Component);
 
-	if (SavedProperties.Num() > 0)
+	if (HasSavedProperties())
 	{
 		SceneComponent->UpdateComponentToWorld();
 	}
@@ -40,6 +40,7 @@
 #include "SkeletalRenderPublic.h"
 #include "ContentStreaming.h"
 #include "Animation/AnimTrace.h"
+#include "InGamePerformanceTracker.h"
 #if INTEL_ISPC
 #include "SkeletalMeshComponent.ispc.generated.h"
 #endif
@@ -51,6 +52,12 @@ TAutoConsoleVariable<int32> CVarUseParallelAnimUpdate(TEXT("a.ParallelAnimUpdate
 TAutoConsoleVariable<int32> CVarForceUseParallelAnimUpdate(TEXT("a.ForceParallelAnimUpdate"), 0, TEXT("If != 0, then we update animations on worker threads regardless of the setting on the project or anim blueprint."));
 TAutoConsoleVariable<int32> CVarUseParallelAnimationInterpolation(TEXT("a.ParallelAnimInterpolation"), 1, TEXT("If 1, animation interpolation will be run across the task graph system. If 0, interpolation will run purely on the game thread"));
 
+static TAutoConsoleVariable<int32> CVarParallelAnimEvaluationBatchSize(
+	TEXT("a.ParallelAnimEvaluationBatchSize"),
+	8,
+	TEXT("Maximum number of components using the same anim blueprint and skeleton whose evaluation is run by a single task, when they are dispatched before that task starts.\n")
+	TEXT("Components that share an anim graph then evaluate back to back on one worker. 0 or 1 dispatches one task per component."));
+
 static TAutoConsoleVariable<float> CVarStallParallelAnimation(
 	TEXT("CriticalPathStall.ParallelAnimation"),
 	0.0f,
@@ -117,6 +124,114 @@ public:
 	}
 };
 
+/**
+ * Components with the same anim blueprint class and skeleton that are evaluated by one task.
+ * The task is dispatched with the first component, later components join it for as long as it hasn't started,
+ * so no evaluation waits on the batch filling up and batches only grow when the workers are already busy.
+ */
+struct FParallelAnimationEvaluationBatch
+{
+	FCriticalSection CriticalSection;
+	TArray<TWeakObjectPtr<USkeletalMeshComponent>, TInlineAllocator<8>> Components;
+	FGraphEventRef Task;
+	bool bStarted = false;
+
+	/** Adds a component unless the task already started or the batch is full. Game thread only. */
+	bool TryAdd(USkeletalMeshComponent* Component, int32 MaxBatchSize)
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (bStarted || Components.Num() >= MaxBatchSize)
+		{
+			return false;
+		}
+		Components.Add(Component);
+		return true;
+	}
+};
+
+class FParallelAnimationBatchEvaluationTask
+{
+	TSharedRef<FParallelAnimationEvaluationBatch, ESPMode::ThreadSafe> Batch;
+
+public:
+	FParallelAnimationBatchEvaluationTask(const TSharedRef<FParallelAnimationEvaluationBatch, ESPMode::ThreadSafe>& InBatch)
+		: Batch(InBatch)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FParallelAnimationBatchEvaluationTask, STATGROUP_TaskGraphTasks);
+	}
+	static FORCEINLINE ENamedThreads::Type GetDesiredThread()
+	{
+		return CPrio_ParallelAnimationEvaluationTask.Get();
+	}
+	static FORCEINLINE ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		{
+			// Components can't join once this is set, the list is only read from here on
+			FScopeLock Lock(&Batch->CriticalSection);
+			Batch->bStarted = true;
+		}
+
+		if (CurrentThread != ENamedThreads::GameThread)
+		{
+			GInitRunaway();
+		}
+
+		for (const TWeakObjectPtr<USkeletalMeshComponent>& WeakComp : Batch->Components)
+		{
+			if (USkeletalMeshComponent* Comp = WeakComp.Get())
+			{
+				FScopeCycleCounterUObject ContextScope(Comp);
+#if !UE_BUILD_TEST && !UE_BUILD_SHIPPING
+				float Stall = CVarStallParallelAnimation.GetValueOnAnyThread();
+				if (Stall > 0.0f)
+				{
+					FPlatformProcess::Sleep(Stall / 1000.0f);
+				}
+#endif
+				Comp->ParallelAnimationEvaluation();
+			}
+		}
+	}
+};
+
+/** Returns the task evaluating Component, which may be shared with other components using the same anim graph */
+static FGraphEventRef DispatchParallelAnimationEvaluationTask(USkeletalMeshComponent* Component)
+{
+	check(IsInGameThread());
+
+	const int32 MaxBatchSize = CVarParallelAnimEvaluationBatchSize.GetValueOnGameThread();
+	UAnimInstance* AnimInstance = Component->GetAnimInstance();
+	if (MaxBatchSize <= 1 || AnimInstance == nullptr || Component->SkeletalMesh == nullptr)
+	{
+		return TGraphTask<FParallelAnimationEvaluationTask>::CreateTask().ConstructAndDispatchWhenReady(Component);
+	}
+
+	// Batches that started or filled up are replaced as they are looked up, so the map holds one batch per graph that was evaluated
+	typedef TPair<const UClass*, const USkeleton*> FBatchKey;
+	static TMap<FBatchKey, TSharedPtr<FParallelAnimationEvaluationBatch, ESPMode::ThreadSafe>> OpenBatches;
+
+	TSharedPtr<FParallelAnimationEvaluationBatch, ESPMode::ThreadSafe>& OpenBatch = OpenBatches.FindOrAdd(FBatchKey(AnimInstance->GetClass(), Component->SkeletalMesh->Skeleton));
+	if (OpenBatch.IsValid() && OpenBatch->TryAdd(Component, MaxBatchSize))
+	{
+		return OpenBatch->Task;
+	}
+
+	TSharedRef<FParallelAnimationEvaluationBatch, ESPMode::ThreadSafe> NewBatch = MakeShared<FParallelAnimationEvaluationBatch, ESPMode::ThreadSafe>();
+	NewBatch->Components.Add(Component);
+	NewBatch->Task = TGraphTask<FParallelAnimationBatchEvaluationTask>::CreateTask().ConstructAndDispatchWhenReady(NewBatch);
+	OpenBatch = NewBatch;
+	return NewBatch->Task;
+}
+
 class FParallelAnimationCompletionTask
 {
 	TWeakObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
@@ -175,6 +290,7 @@ USkeletalMeshComponent::USkeletalMeshComponent(const FObjectInitializer& ObjectI
 	PhysicsTransformUpdateMode = EPhysicsTransformUpdateMode::SimulationUpatesComponentTransform;
 	SetGenerateOverlapEvents(false);
 	LineCheckBoundsScale = FVector(1.0f, 1.0f, 1.0f);
+	AnimationLODOverride = INDEX_NONE;
 
 	EndPhysicsTickFunction.TickGroup = TG_EndPhysics;
 	EndPhysicsTickFunction.bCanEverTick = true;
@@ -634,7 +750,7 @@ void USkeletalMeshComponent::InitAnim(bool bForceReinit)
 		}
 
 		// this has to be called before Initialize Animation because it will required RequiredBones list when InitializeAnimScript
-		RecalcRequiredBones(PredictedLODLevel);
+		RecalcRequiredBones(GetRequiredBonesLODLevel());
 
 		// In Editor, animations won't get ticked. So Update once to get accurate representation instead of T-Pose.
 		// Also allow this to be an option to support pre-4.19 games that might need it..
@@ -1701,6 +1817,27 @@ void USkeletalMeshComponent::ComputeRequiredBones(TArray<FBoneIndexType>& OutReq
 	FAnimationRuntime::EnsureParentsPresent(OutFillComponentSpaceTransformsRequiredBones, SkeletalMesh->RefSkeleton);
 }
 
+void USkeletalMeshComponent::SetAnimationLODOverride(int32 InAnimationLODOverride)
+{
+	InAnimationLODOverride = FMath::Max(InAnimationLODOverride, (int32)INDEX_NONE);
+	if (AnimationLODOverride != InAnimationLODOverride)
+	{
+		AnimationLODOverride = InAnimationLODOverride;
+		bRequiredBonesUpToDate = false;
+	}
+}
+
+int32 USkeletalMeshComponent::GetRequiredBonesLODLevel() const
+{
+	if (AnimationLODOverride == INDEX_NONE)
+	{
+		return PredictedLODLevel;
+	}
+
+	// Rendered meshes need at least the bones of the LOD they are drawn with
+	return FApp::CanEverRender() ? FMath::Min(AnimationLODOverride, PredictedLODLevel) : AnimationLODOverride;
+}
+
 void USkeletalMeshComponent::RecalcRequiredBones(int32 LODIndex)
 {
 	if (!SkeletalMesh)
@@ -1822,6 +1959,7 @@ void USkeletalMeshComponent::PerformAnimationProcessing(const USkeletalMesh* InS
 {
 	CSV_SCOPED_TIMING_STAT(Animation, WorkerThreadTickTime);
 	ANIM_MT_SCOPE_CYCLE_COUNTER(PerformAnimEvaluation, !IsInGameThread());
+	SCOPE_PERFORMANCE_TRACKING_TIMER(Animation);
 
 	// Can't do anything without a SkeletalMesh
 	if (!InSkeletalMesh)
@@ -2001,7 +2139,7 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 	if (!bRequiredBonesUpToDate)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_USkeletalMeshComponent_RefreshBoneTransforms_RecalcRequiredBones);
-		RecalcRequiredBones(PredictedLODLevel);
+		RecalcRequiredBones(GetRequiredBonesLODLevel());
 	}
 	// if curves have to be refreshed
 	else if (!AreRequiredCurvesUpToDate())
@@ -2203,7 +2341,7 @@ void USkeletalMeshComponent::DispatchParallelEvaluationTasks(FActorComponentTick
 
 	// start parallel work
 	check(!IsValidRef(ParallelAnimationEvaluationTask));
-	ParallelAnimationEvaluationTask = TGraphTask<FParallelAnimationEvaluationTask>::CreateTask().ConstructAndDispatchWhenReady(this);
+	ParallelAnimationEvaluationTask = DispatchParallelAnimationEvaluationTask(this);
 
 	// set up a task to run on the game thread to accept the results
 	FGraphEventArray Prerequistes;
@@ -1946,7 +1946,12 @@ FTransform USkinnedMeshComponent::GetSocketTransform(FName InSocketName, ERelati
 {
 	QUICK_SCOPE_CYCLE_COUNTER(USkinnedMeshComponent_GetSocketTransform);
 
-	FTransform OutSocketTransform = GetComponentTransform();
+	// Component space queries are answered from the component space transforms directly rather than
+	// going to world space and back, which costs a transform composition and a relative transform per query
+	const bool bComponentSpace = TransformSpace == RTS_Component && IsRegistered();
+	const FTransform& LocalToWorld = bComponentSpace ? FTransform::Identity : GetComponentTransform();
+
+	FTransform OutSocketTransform = LocalToWorld;
 
 	if (InSocketName != NAME_None)
 	{
@@ -1964,7 +1969,7 @@ FTransform USkinnedMeshComponent::GetSocketTransform(FName InSocketName, ERelati
 
 			if (SocketBoneIndex != INDEX_NONE)
 			{
-				FTransform BoneTransform = GetBoneTransform(SocketBoneIndex);
+				FTransform BoneTransform = bComponentSpace ? GetBoneTransform(SocketBoneIndex, LocalToWorld) : GetBoneTransform(SocketBoneIndex);
 				OutSocketTransform = SocketLocalTransform * BoneTransform;
 			}
 		}
@@ -1973,12 +1978,12 @@ FTransform USkinnedMeshComponent::GetSocketTransform(FName InSocketName, ERelati
 			int32 BoneIndex = GetBoneIndex(InSocketName);
 			if (BoneIndex != INDEX_NONE)
 			{
-				OutSocketTransform = GetBoneTransform(BoneIndex);
+				OutSocketTransform = bComponentSpace ? GetBoneTransform(BoneIndex, LocalToWorld) : GetBoneTransform(BoneIndex);
 
 				if (TransformSpace == RTS_ParentBoneSpace)
 				{
-					FName ParentBone = GetParentBone(InSocketName);
-					int32 ParentIndex = GetBoneIndex(ParentBone);
+					// BoneIndex was found in the reference skeleton, so its parent can be taken from there without looking names up again
+					const int32 ParentIndex = SkeletalMesh->RefSkeleton.GetParentIndex(BoneIndex);
 					if (ParentIndex != INDEX_NONE)
 					{
 						return OutSocketTransform.GetRelativeTransform(GetBoneTransform(ParentIndex));
@@ -2001,6 +2006,10 @@ FTransform USkinnedMeshComponent::GetSocketTransform(FName InSocketName, ERelati
 		}
 		case RTS_Component:
 		{
+			if (bComponentSpace)
+			{
+				return OutSocketTransform;
+			}
 			return OutSocketTransform.GetRelativeTransform( GetComponentTransform() );
 		}
 	}
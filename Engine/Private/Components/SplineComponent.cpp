@@ -10,6 +10,8 @@
 #include "PrimitiveSceneProxy.h"
 #include "SceneManagement.h"
 #include "UnrealEngine.h"
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
 
 #define SPLINE_FAST_BOUNDS_CALCULATION 0
 
@@ -27,6 +29,7 @@ USplineComponent::USplineComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bAllowSplineEditingPerInstance_DEPRECATED(true)
 	, ReparamStepsPerSegment(10)
+	, bAdaptiveReparamSteps(false)
 	, Duration(1.0f)
 	, bStationaryEndpoints(false)
 	, bSplineHasBeenEdited(false)
@@ -143,6 +146,12 @@ void USplineComponent::Serialize(FArchive& Ar)
 
 		UpdateSpline();
 	}
+
+	// The segment bounds aren't serialized
+	if (Ar.IsLoading())
+	{
+		SplineCurves.UpdateSegmentBounds();
+	}
 }
 
 void USplineComponent::PostLoad()
@@ -150,7 +159,7 @@ void USplineComponent::PostLoad()
 	Super::PostLoad();
 }
 
-void FSplineCurves::UpdateSpline(bool bClosedLoop, bool bStationaryEndpoints, int32 ReparamStepsPerSegment, bool bLoopPositionOverride, float LoopPosition, const FVector& Scale3D)
+void FSplineCurves::UpdateSpline(bool bClosedLoop, bool bStationaryEndpoints, int32 ReparamStepsPerSegment, bool bLoopPositionOverride, float LoopPosition, const FVector& Scale3D, bool bAdaptiveReparamSteps)
 {
 	const int32 NumPoints = Position.Points.Num();
 	check(Rotation.Points.Num() == NumPoints && Scale.Points.Num() == NumPoints);
@@ -192,9 +201,34 @@ void FSplineCurves::UpdateSpline(bool bClosedLoop, bool bStationaryEndpoints, in
 	float AccumulatedLength = 0.0f;
 	for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
 	{
-		for (int32 Step = 0; Step < ReparamStepsPerSegment; ++Step)
+		int32 NumSteps = ReparamStepsPerSegment;
+		if (bAdaptiveReparamSteps)
+		{
+			// The table is linear between steps, so it's exact where the speed along the segment is constant and needs more steps the more the speed varies
+			const FInterpCurvePointVector& StartPoint = Position.Points[SegmentIndex];
+			const FInterpCurvePointVector& EndPoint = Position.Points[SegmentIndex == NumPoints - 1 ? 0 : SegmentIndex + 1];
+
+			float SpeedVariation = 0.0f;
+			if (StartPoint.InterpMode != CIM_Linear && StartPoint.InterpMode != CIM_Constant)
+			{
+				float MinSpeed = MAX_flt;
+				float MaxSpeed = 0.0f;
+				for (int32 Sample = 0; Sample <= 4; ++Sample)
+				{
+					const FVector Derivative = FMath::CubicInterpDerivative(StartPoint.OutVal, StartPoint.LeaveTangent, EndPoint.OutVal, EndPoint.ArriveTangent, Sample * 0.25f);
+					const float Speed = (Derivative * Scale3D).Size();
+					MinSpeed = FMath::Min(MinSpeed, Speed);
+					MaxSpeed = FMath::Max(MaxSpeed, Speed);
+				}
+				SpeedVariation = MaxSpeed > KINDA_SMALL_NUMBER ? (MaxSpeed - MinSpeed) / MaxSpeed : 0.0f;
+			}
+
+			NumSteps = FMath::Clamp(FMath::CeilToInt(ReparamStepsPerSegment * 2 * SpeedVariation), 1, ReparamStepsPerSegment * 2);
+		}
+
+		for (int32 Step = 0; Step < NumSteps; ++Step)
 		{
-			const float Param = static_cast<float>(Step) / ReparamStepsPerSegment;
+			const float Param = static_cast<float>(Step) / NumSteps;
 			const float SegmentLength = (Step == 0) ? 0.0f : GetSegmentLength(SegmentIndex, Param, bClosedLoop, Scale3D);
 
 			ReparamTable.Points.Emplace(SegmentLength + AccumulatedLength, SegmentIndex + Param, 0.0f, 0.0f, CIM_Linear);
@@ -203,11 +237,107 @@ void FSplineCurves::UpdateSpline(bool bClosedLoop, bool bStationaryEndpoints, in
 	}
 
 	ReparamTable.Points.Emplace(AccumulatedLength, static_cast<float>(NumSegments), 0.0f, 0.0f, CIM_Linear);
+
+	UpdateSegmentBounds();
+}
+
+void FSplineCurves::UpdateSegmentBounds()
+{
+	const int32 NumPoints = Position.Points.Num();
+	const int32 NumSegments = Position.bIsLooped ? NumPoints : NumPoints - 1;
+
+	SegmentBoundsTree.Reset();
+	if (NumSegments <= 0)
+	{
+		return;
+	}
+
+	const int32 NumLeaves = FMath::RoundUpToPowerOfTwo(NumSegments);
+	SegmentBoundsTree.SetNumZeroed(NumLeaves * 2);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+	{
+		const FInterpCurvePointVector& StartPoint = Position.Points[SegmentIndex];
+		const FInterpCurvePointVector& EndPoint = Position.Points[SegmentIndex == NumPoints - 1 ? 0 : SegmentIndex + 1];
+
+		// A Hermite segment is the Bezier curve with these control points, and lies within their convex hull
+		FBox& Bounds = SegmentBoundsTree[NumLeaves + SegmentIndex];
+		Bounds = FBox(StartPoint.OutVal, StartPoint.OutVal);
+		Bounds += EndPoint.OutVal;
+		if (StartPoint.InterpMode != CIM_Linear && StartPoint.InterpMode != CIM_Constant)
+		{
+			Bounds += StartPoint.OutVal + StartPoint.LeaveTangent / 3.0f;
+			Bounds += EndPoint.OutVal - EndPoint.ArriveTangent / 3.0f;
+		}
+	}
+
+	for (int32 NodeIndex = NumLeaves - 1; NodeIndex > 0; --NodeIndex)
+	{
+		SegmentBoundsTree[NodeIndex] = SegmentBoundsTree[NodeIndex * 2] + SegmentBoundsTree[NodeIndex * 2 + 1];
+	}
+}
+
+float FSplineCurves::FindNearest(const FVector& LocalLocation, float& OutSquaredDistance) const
+{
+	const int32 NumPoints = Position.Points.Num();
+	const int32 NumSegments = Position.bIsLooped ? NumPoints : NumPoints - 1;
+	const int32 NumLeaves = SegmentBoundsTree.Num() / 2;
+
+	// Also covers single point splines, and curves edited without UpdateSpline
+	if (NumSegments <= 0 || NumLeaves < NumSegments || NumLeaves >= NumSegments * 2)
+	{
+		return Position.InaccurateFindNearest(LocalLocation, OutSquaredDistance);
+	}
+
+	float BestKey = Position.Points[0].InVal;
+	float BestSquaredDistance = MAX_flt;
+
+	TArray<int32, TInlineAllocator<64>> NodeStack;
+	NodeStack.Add(1);
+	while (NodeStack.Num() > 0)
+	{
+		const int32 NodeIndex = NodeStack.Pop(false);
+		const FBox& Bounds = SegmentBoundsTree[NodeIndex];
+		if (!Bounds.IsValid || Bounds.ComputeSquaredDistanceToPoint(LocalLocation) >= BestSquaredDistance)
+		{
+			continue;
+		}
+
+		if (NodeIndex >= NumLeaves)
+		{
+			float SquaredDistance;
+			const float Key = Position.InaccurateFindNearestOnSegment(LocalLocation, NodeIndex - NumLeaves, SquaredDistance);
+			if (SquaredDistance < BestSquaredDistance)
+			{
+				BestSquaredDistance = SquaredDistance;
+				BestKey = Key;
+			}
+			continue;
+		}
+
+		// Pop the nearer child first, so the best distance shrinks early and prunes more of the farther one
+		const int32 LeftIndex = NodeIndex * 2;
+		const int32 RightIndex = LeftIndex + 1;
+		const bool bLeftNearer = SegmentBoundsTree[LeftIndex].IsValid && (!SegmentBoundsTree[RightIndex].IsValid ||
+			SegmentBoundsTree[LeftIndex].ComputeSquaredDistanceToPoint(LocalLocation) <= SegmentBoundsTree[RightIndex].ComputeSquaredDistanceToPoint(LocalLocation));
+		NodeStack.Add(bLeftNearer ? RightIndex : LeftIndex);
+		NodeStack.Add(bLeftNearer ? LeftIndex : RightIndex);
+	}
+
+	OutSquaredDistance = BestSquaredDistance;
+	return BestKey;
+}
+
+float FSplineCurves::GetDistanceAtSegmentStart(int32 SegmentIndex) const
+{
+	// Segment starts are the entries whose parameter is exactly the segment index, wherever adaptive steps put them
+	const int32 EntryIndex = Algo::LowerBoundBy(ReparamTable.Points, static_cast<float>(SegmentIndex), [](const FInterpCurvePointFloat& Point) { return Point.OutVal; });
+	return ReparamTable.Points.IsValidIndex(EntryIndex) ? ReparamTable.Points[EntryIndex].InVal : 0.0f;
 }
 
 void USplineComponent::UpdateSpline()
 {
-	SplineCurves.UpdateSpline(bClosedLoop, bStationaryEndpoints, ReparamStepsPerSegment, bLoopPositionOverride, LoopPosition, GetComponentTransform().GetScale3D());
+	SplineCurves.UpdateSpline(bClosedLoop, bStationaryEndpoints, ReparamStepsPerSegment, bLoopPositionOverride, LoopPosition, GetComponentTransform().GetScale3D(), bAdaptiveReparamSteps);
 
 #if !UE_BUILD_SHIPPING
 	if (bDrawDebug)
@@ -1015,7 +1145,7 @@ float USplineComponent::GetDistanceAlongSplineAtSplinePoint(int32 PointIndex) co
 
 	if ((PointIndex >= 0) && (PointIndex < NumSegments + 1))
 	{
-		return SplineCurves.ReparamTable.Points[PointIndex * ReparamStepsPerSegment].InVal;
+		return SplineCurves.GetDistanceAtSegmentStart(PointIndex);
 	}
 
 	return 0.0f;
@@ -1366,7 +1496,28 @@ float USplineComponent::FindInputKeyClosestToWorldLocation(const FVector& WorldL
 {
 	const FVector LocalLocation = GetComponentTransform().InverseTransformPosition(WorldLocation);
 	float Dummy;
-	return SplineCurves.Position.InaccurateFindNearest(LocalLocation, Dummy);
+	return SplineCurves.FindNearest(LocalLocation, Dummy);
+}
+
+
+void USplineComponent::FindInputKeysClosestToWorldLocations(TArrayView<const FVector> WorldLocations, TArrayView<float> OutInputKeys) const
+{
+	check(WorldLocations.Num() == OutInputKeys.Num());
+
+	// Each query is a tree search, only worth the dispatch for batches of a few hundred and more
+	const int32 NumPerTask = 256;
+	const int32 NumTasks = FMath::DivideAndRoundUp(WorldLocations.Num(), NumPerTask);
+	const FTransform& ComponentTransform = GetComponentTransform();
+
+	ParallelFor(NumTasks, [this, &WorldLocations, &OutInputKeys, &ComponentTransform, NumPerTask](int32 TaskIndex)
+	{
+		const int32 EndIndex = FMath::Min((TaskIndex + 1) * NumPerTask, WorldLocations.Num());
+		for (int32 Index = TaskIndex * NumPerTask; Index < EndIndex; ++Index)
+		{
+			float Dummy;
+			OutInputKeys[Index] = SplineCurves.FindNearest(ComponentTransform.InverseTransformPosition(WorldLocations[Index]), Dummy);
+		}
+	}, NumTasks <= 1);
 }
 
 
@@ -1709,6 +1860,7 @@ void USplineComponent::PostEditChangeChainProperty(FPropertyChangedChainEvent& P
 	if (PropertyChangedEvent.Property != nullptr)
 	{
 		static const FName ReparamStepsPerSegmentName = GET_MEMBER_NAME_CHECKED(USplineComponent, ReparamStepsPerSegment);
+		static const FName AdaptiveReparamStepsName = GET_MEMBER_NAME_CHECKED(USplineComponent, bAdaptiveReparamSteps);
 		static const FName StationaryEndpointsName = GET_MEMBER_NAME_CHECKED(USplineComponent, bStationaryEndpoints);
 		static const FName DefaultUpVectorName = GET_MEMBER_NAME_CHECKED(USplineComponent, DefaultUpVector);
 		static const FName ClosedLoopName = GET_MEMBER_NAME_CHECKED(USplineComponent, bClosedLoop);
@@ -1716,6 +1868,7 @@ void USplineComponent::PostEditChangeChainProperty(FPropertyChangedChainEvent& P
 
 		const FName PropertyName(PropertyChangedEvent.Property->GetFName());
 		if (PropertyName == ReparamStepsPerSegmentName ||
+			PropertyName == AdaptiveReparamStepsName ||
 			PropertyName == StationaryEndpointsName ||
 			PropertyName == DefaultUpVectorName ||
 			PropertyName == ClosedLoopName)
@@ -61,31 +61,9 @@ void FSplineMeshVertexFactoryShaderParameters::GetElementShaderBindings(
 		}
 	}
 
-		checkSlow(BatchElement.bIsSplineProxy);
-		FSplineMeshSceneProxy* SplineProxy = BatchElement.SplineMeshSceneProxy;
-		FSplineMeshParams& SplineParams = SplineProxy->SplineParams;
-
-	FVector4 ParamData[10];
-	ParamData[0] = FVector4(SplineParams.StartPos, SplineParams.StartRoll);
-	ParamData[1] = FVector4(SplineParams.StartTangent, SplineParams.EndRoll);
-	ParamData[2] = FVector4(SplineParams.StartScale, SplineParams.StartOffset);
-	ParamData[3] = FVector4(SplineParams.EndPos, (float)(int32)SplineProxy->bSmoothInterpRollScale);
-	ParamData[4] = FVector4(SplineParams.EndTangent, SplineProxy->SplineMeshMinZ);
-	ParamData[5] = FVector4(SplineParams.EndScale, SplineParams.EndOffset);
-	ParamData[6] = FVector4(SplineProxy->SplineUpDir, SplineProxy->SplineMeshScaleZ);
-
-		FVector DirMask(0, 0, 0);
-	DirMask = FVector::ZeroVector;
-		DirMask[SplineProxy->ForwardAxis] = 1;
-	ParamData[7] = FVector4(DirMask, 0);
-		DirMask = FVector::ZeroVector;
-		DirMask[(SplineProxy->ForwardAxis + 1) % 3] = 1;
-	ParamData[8] = FVector4(DirMask, 0);
-		DirMask = FVector::ZeroVector;
-		DirMask[(SplineProxy->ForwardAxis + 2) % 3] = 1;
-	ParamData[9] = FVector4(DirMask, 0);
-
-	ShaderBindings.Add(SplineMeshParams, ParamData);
+	checkSlow(BatchElement.bIsSplineProxy);
+	const FSplineMeshSceneProxy* SplineProxy = BatchElement.SplineMeshSceneProxy;
+	ShaderBindings.Add(SplineMeshParams, SplineProxy->SplineParamData);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -451,6 +429,13 @@ void USplineMeshComponent::UpdateRenderStateAndCollision()
 }
 
 void USplineMeshComponent::UpdateRenderStateAndCollision_Internal(bool bConcurrent)
+{
+	TArray<FSplineMeshProxyUpdate> ProxyUpdates;
+	UpdateRenderStateAndCollision_Internal(bConcurrent, ProxyUpdates);
+	FSplineMeshSceneProxy::ApplyUpdates(MoveTemp(ProxyUpdates));
+}
+
+void USplineMeshComponent::UpdateRenderStateAndCollision_Internal(bool bConcurrent, TArray<FSplineMeshProxyUpdate>& OutProxyUpdates)
 {
 	if (GNoRecreateSplineMeshProxy && bRenderStateCreated && SceneProxy)
 	{
@@ -463,21 +448,13 @@ void USplineMeshComponent::UpdateRenderStateAndCollision_Internal(bool bConcurre
 			MarkRenderTransformDirty();
 		}
 
-		FSplineMeshSceneProxy* SplineProxy = static_cast<FSplineMeshSceneProxy*>(SceneProxy);
-
-		float SplineMeshScaleZ = 1.f;
-		float SplineMeshMinZ = 1.f;
-		CalculateScaleZAndMinZ(SplineMeshScaleZ, SplineMeshMinZ);
-
-		ENQUEUE_RENDER_COMMAND(UpdateSplineParamsRTCommand)(
-			[SplineProxy, this, SplineMeshScaleZ, SplineMeshMinZ](FRHICommandList&)
-		{
-			SplineProxy->SplineParams = SplineParams;
-			SplineProxy->ForwardAxis = ForwardAxis;
-			SplineProxy->SplineUpDir = SplineUpDir;
-			SplineProxy->SplineMeshScaleZ = SplineMeshScaleZ;
-			SplineProxy->SplineMeshMinZ = SplineMeshMinZ;
-		});
+		// Parameters are copied, the component may change again before the render thread applies them
+		FSplineMeshProxyUpdate& Update = OutProxyUpdates.AddDefaulted_GetRef();
+		Update.SplineProxy = static_cast<FSplineMeshSceneProxy*>(SceneProxy);
+		Update.SplineParams = SplineParams;
+		Update.SplineUpDir = SplineUpDir;
+		Update.ForwardAxis = ForwardAxis;
+		CalculateScaleZAndMinZ(Update.SplineMeshScaleZ, Update.SplineMeshMinZ);
 	}
 	else
 	{
@@ -497,6 +474,22 @@ void USplineMeshComponent::UpdateRenderStateAndCollision_Internal(bool bConcurre
 	bMeshDirty = false;
 }
 
+void USplineMeshComponent::UpdateMeshes(TArrayView<USplineMeshComponent* const> Components)
+{
+	TArray<FSplineMeshProxyUpdate> ProxyUpdates;
+	ProxyUpdates.Reserve(Components.Num());
+
+	for (USplineMeshComponent* Component : Components)
+	{
+		if (Component != nullptr && Component->bMeshDirty)
+		{
+			Component->UpdateRenderStateAndCollision_Internal(false, ProxyUpdates);
+		}
+	}
+
+	FSplineMeshSceneProxy::ApplyUpdates(MoveTemp(ProxyUpdates));
+}
+
 void USplineMeshComponent::Serialize(FArchive& Ar)
 {
 	Super::Serialize(Ar);
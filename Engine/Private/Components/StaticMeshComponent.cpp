@@ -38,6 +38,7 @@
 #include "Engine/StaticMesh.h"
 #include "HAL/LowLevelMemTracker.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
 #include "Algo/AllOf.h"
 #include "Algo/Transform.h"
 
@@ -2500,7 +2501,76 @@ bool UStaticMeshComponent::ComponentIsTouchingSelectionFrustum(const FConvexVolu
 //////////////////////////////////////////////////////////////////////////
 // StaticMeshComponentLODInfo
 
+static int32 GShareOverrideVertexColors = 1;
+static FAutoConsoleVariableRef CVarShareOverrideVertexColors(
+	TEXT("r.ShareOverrideVertexColors"),
+	GShareOverrideVertexColors,
+	TEXT("If non-zero, components loaded outside of the editor share one override vertex color buffer between all of their LODs with identical colors, like copies of a painted mesh."),
+	ECVF_Default
+	);
+
+namespace StaticMeshOverrideVertexColors
+{
+	struct FSharedBuffer
+	{
+		FColorVertexBuffer* Buffer = nullptr;
+		int32 NumReferences = 0;
+	};
+
+	/** Accessed from the loading threads and the game thread */
+	static FCriticalSection SharedBuffersCS;
+	static TMap<FSHAHash, FSharedBuffer> SharedBuffers;
+	static TMap<const FColorVertexBuffer*, FSHAHash> SharedBufferHashes;
 
+	/** Returns the shared buffer with the colors of Buffer, Buffer itself if there's none yet, otherwise Buffer is deleted */
+	static FColorVertexBuffer* Share(FColorVertexBuffer* Buffer)
+	{
+		FSHAHash Hash;
+		FSHA1::HashBuffer(Buffer->GetVertexData(), Buffer->GetNumVertices() * Buffer->GetStride(), Hash.Hash);
+
+		FScopeLock Lock(&SharedBuffersCS);
+		FSharedBuffer& SharedBuffer = SharedBuffers.FindOrAdd(Hash);
+		if (SharedBuffer.Buffer)
+		{
+			delete Buffer;
+		}
+		else
+		{
+			SharedBuffer.Buffer = Buffer;
+			SharedBufferHashes.Add(Buffer, Hash);
+		}
+
+		++SharedBuffer.NumReferences;
+		return SharedBuffer.Buffer;
+	}
+
+	static bool IsShared(const FColorVertexBuffer* Buffer)
+	{
+		FScopeLock Lock(&SharedBuffersCS);
+		return SharedBufferHashes.Contains(Buffer);
+	}
+
+	/** Drops a reference to the buffer, returns whether it isn't used anymore and should be released */
+	static bool Release(const FColorVertexBuffer* Buffer)
+	{
+		FScopeLock Lock(&SharedBuffersCS);
+		const FSHAHash* Hash = SharedBufferHashes.Find(Buffer);
+		if (!Hash)
+		{
+			return true;
+		}
+
+		FSharedBuffer& SharedBuffer = SharedBuffers.FindChecked(*Hash);
+		if (--SharedBuffer.NumReferences > 0)
+		{
+			return false;
+		}
+
+		SharedBuffers.Remove(*Hash);
+		SharedBufferHashes.Remove(Buffer);
+		return true;
+	}
+}
 
 /** Default constructor */
 FStaticMeshComponentLODInfo::FStaticMeshComponentLODInfo()
@@ -2569,7 +2639,8 @@ void FStaticMeshComponentLODInfo::CleanUp()
 	OverrideVertexColors = nullptr;
 	PaintedVertices.Empty();
 
-	if (LocalOverrideVertexColors != nullptr)
+	// Shared buffers are released with their last reference
+	if (LocalOverrideVertexColors != nullptr && StaticMeshOverrideVertexColors::Release(LocalOverrideVertexColors))
 	{
 		ENQUEUE_RENDER_COMMAND(FStaticMeshComponentLODInfoCleanUp)(
 		[LocalOverrideVertexColors](FRHICommandList&)
@@ -2583,7 +2654,8 @@ void FStaticMeshComponentLODInfo::CleanUp()
 
 void FStaticMeshComponentLODInfo::BeginReleaseOverrideVertexColors()
 {
-	if(OverrideVertexColors)
+	// Shared buffers may still be rendered by other components, CleanUp releases them once they aren't
+	if(OverrideVertexColors && !StaticMeshOverrideVertexColors::IsShared(OverrideVertexColors))
 	{
 		// enqueue a rendering command to release
 		BeginReleaseResource(OverrideVertexColors);
@@ -2757,6 +2829,12 @@ FArchive& operator<<(FArchive& Ar,FStaticMeshComponentLODInfo& I)
 				}
 				else
 				{
+					// Nothing modifies the buffers of loaded components outside of the editor, so identical ones can be shared
+					if (GShareOverrideVertexColors && !GIsEditor && !IsRunningCommandlet())
+					{
+						I.OverrideVertexColors = StaticMeshOverrideVertexColors::Share(I.OverrideVertexColors);
+					}
+
 					BeginInitResource(I.OverrideVertexColors);
 				}
 			}
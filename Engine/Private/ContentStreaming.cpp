@@ -22,6 +22,7 @@
 #include "AudioStreamingCache.h"
 #include "AudioCompressionSettingsUtils.h"
 #include "VT/VirtualTextureChunkManager.h"
+#include "InGamePerformanceTracker.h"
 
 /*-----------------------------------------------------------------------------
 	Globals.
@@ -825,6 +826,7 @@ void FStreamingManagerCollection::SetNumIterationsForNextFrame( int32 InNumItera
 void FStreamingManagerCollection::Tick( float DeltaTime, bool bProcessEverything )
 {
 	LLM_SCOPE(ELLMTag::StreamingManager);
+	SCOPE_PERFORMANCE_TRACKING_TIMER(Streaming);
 
 	AddOrRemoveTextureStreamingManagerIfNeeded();
 
@@ -413,6 +413,207 @@ bool FConvexVolume::IntersectSphere(const FVector& Origin,const float& Radius, b
 	return Result;
 }
 
+//
+//	FConvexVolume::IntersectBoxes / IntersectSpheres, batched over structure of arrays bounds
+//
+
+namespace ConvexVolumeBatch
+{
+	/** One plane splatted to every lane, four bounds are tested against it at once */
+	struct FSplatPlane
+	{
+		VectorRegister X;
+		VectorRegister Y;
+		VectorRegister Z;
+		VectorRegister W;
+		VectorRegister AbsX;
+		VectorRegister AbsY;
+		VectorRegister AbsZ;
+	};
+
+	typedef TArray<FSplatPlane, TInlineAllocator<8>> FSplatPlaneArray;
+
+	static void SplatPlanes(const FConvexVolume::FPlaneArray& Planes, FSplatPlaneArray& OutPlanes)
+	{
+		OutPlanes.SetNumUninitialized(Planes.Num());
+		for (int32 PlaneIndex = 0; PlaneIndex < Planes.Num(); PlaneIndex++)
+		{
+			const FPlane& Plane = Planes[PlaneIndex];
+			FSplatPlane& SplatPlane = OutPlanes[PlaneIndex];
+			SplatPlane.X = VectorSetFloat1(Plane.X);
+			SplatPlane.Y = VectorSetFloat1(Plane.Y);
+			SplatPlane.Z = VectorSetFloat1(Plane.Z);
+			SplatPlane.W = VectorSetFloat1(Plane.W);
+			SplatPlane.AbsX = VectorAbs(SplatPlane.X);
+			SplatPlane.AbsY = VectorAbs(SplatPlane.Y);
+			SplatPlane.AbsZ = VectorAbs(SplatPlane.Z);
+		}
+	}
+
+	/** Loads four consecutive values of a stream, the lanes past the end of the stream are zero */
+	static FORCEINLINE VectorRegister LoadStream(const float* Stream, int32 Index, int32 NumValid)
+	{
+		if (NumValid >= 4)
+		{
+			return VectorLoad(Stream + Index);
+		}
+
+		MS_ALIGN(16) float Padded[4] GCC_ALIGN(16) = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for (int32 Lane = 0; Lane < NumValid; Lane++)
+		{
+			Padded[Lane] = Stream[Index + Lane];
+		}
+		return VectorLoadAligned(Padded);
+	}
+
+	static FORCEINLINE void WriteMask(uint32* OutMask, int32 Index, uint32 LaneMask)
+	{
+		OutMask[Index / 32] |= LaneMask << (Index % 32);
+	}
+
+	/**
+	 * TBoundsType provides Load(Index, NumValid) and GetPushOut(Plane), the distance the bounds reach towards a plane.
+	 * Bounds are outside if they are further than their push out in front of any plane, fully contained if they are
+	 * further than their push out behind every plane.
+	 */
+	template<bool bComputeContained, typename TBoundsType>
+	static void Intersect(const FConvexVolume::FPlaneArray& Planes, int32 NumBounds, TBoundsType& Bounds, uint32* OutVisible, uint32* OutFullyContained)
+	{
+		const int32 NumWords = (NumBounds + 31) / 32;
+		FMemory::Memzero(OutVisible, NumWords * sizeof(uint32));
+		if (bComputeContained)
+		{
+			FMemory::Memzero(OutFullyContained, NumWords * sizeof(uint32));
+		}
+
+		FSplatPlaneArray PlanesToTest;
+		SplatPlanes(Planes, PlanesToTest);
+
+		for (int32 Index = 0; Index < NumBounds; Index += 4)
+		{
+			const int32 NumValid = FMath::Min(NumBounds - Index, 4);
+			const uint32 ValidMask = (1u << NumValid) - 1;
+
+			Bounds.Load(Index, NumValid);
+
+			VectorRegister Outside = VectorZero();
+			VectorRegister NotContained = VectorZero();
+			for (const FSplatPlane& Plane : PlanesToTest)
+			{
+				// Calculate the distance (x * x) + (y * y) + (z * z) - w
+				VectorRegister DistX = VectorMultiply(Bounds.OrigX, Plane.X);
+				VectorRegister DistY = VectorMultiplyAdd(Bounds.OrigY, Plane.Y, DistX);
+				VectorRegister DistZ = VectorMultiplyAdd(Bounds.OrigZ, Plane.Z, DistY);
+				VectorRegister Distance = VectorSubtract(DistZ, Plane.W);
+				VectorRegister PushOut = Bounds.GetPushOut(Plane);
+
+				Outside = VectorBitwiseOr(Outside, VectorCompareGT(Distance, PushOut));
+				if (bComputeContained)
+				{
+					NotContained = VectorBitwiseOr(NotContained, VectorCompareGT(Distance, VectorNegate(PushOut)));
+				}
+				else if (VectorMaskBits(Outside) == 0xF)
+				{
+					// All four are culled, the remaining planes can't change the result
+					break;
+				}
+			}
+
+			const uint32 VisibleMask = ~(uint32)VectorMaskBits(Outside) & ValidMask;
+			WriteMask(OutVisible, Index, VisibleMask);
+			if (bComputeContained)
+			{
+				WriteMask(OutFullyContained, Index, ~(uint32)VectorMaskBits(NotContained) & VisibleMask);
+			}
+		}
+	}
+
+	struct FBoxStreams
+	{
+		const float* OriginX;
+		const float* OriginY;
+		const float* OriginZ;
+		const float* ExtentX;
+		const float* ExtentY;
+		const float* ExtentZ;
+
+		VectorRegister OrigX;
+		VectorRegister OrigY;
+		VectorRegister OrigZ;
+		VectorRegister AbsExtentX;
+		VectorRegister AbsExtentY;
+		VectorRegister AbsExtentZ;
+
+		FORCEINLINE void Load(int32 Index, int32 NumValid)
+		{
+			OrigX = LoadStream(OriginX, Index, NumValid);
+			OrigY = LoadStream(OriginY, Index, NumValid);
+			OrigZ = LoadStream(OriginZ, Index, NumValid);
+			AbsExtentX = VectorAbs(LoadStream(ExtentX, Index, NumValid));
+			AbsExtentY = VectorAbs(LoadStream(ExtentY, Index, NumValid));
+			AbsExtentZ = VectorAbs(LoadStream(ExtentZ, Index, NumValid));
+		}
+
+		FORCEINLINE VectorRegister GetPushOut(const FSplatPlane& Plane) const
+		{
+			// FMath::Abs(x * x) + FMath::Abs(y * y) + FMath::Abs(z * z)
+			VectorRegister PushX = VectorMultiply(AbsExtentX, Plane.AbsX);
+			VectorRegister PushY = VectorMultiplyAdd(AbsExtentY, Plane.AbsY, PushX);
+			return VectorMultiplyAdd(AbsExtentZ, Plane.AbsZ, PushY);
+		}
+	};
+
+	struct FSphereStreams
+	{
+		const float* OriginX;
+		const float* OriginY;
+		const float* OriginZ;
+		const float* Radius;
+
+		VectorRegister OrigX;
+		VectorRegister OrigY;
+		VectorRegister OrigZ;
+		VectorRegister VRadius;
+
+		FORCEINLINE void Load(int32 Index, int32 NumValid)
+		{
+			OrigX = LoadStream(OriginX, Index, NumValid);
+			OrigY = LoadStream(OriginY, Index, NumValid);
+			OrigZ = LoadStream(OriginZ, Index, NumValid);
+			VRadius = LoadStream(Radius, Index, NumValid);
+		}
+
+		FORCEINLINE VectorRegister GetPushOut(const FSplatPlane& Plane) const
+		{
+			return VRadius;
+		}
+	};
+}
+
+void FConvexVolume::IntersectBoxes(int32 NumBoxes, const float* OriginX, const float* OriginY, const float* OriginZ, const float* ExtentX, const float* ExtentY, const float* ExtentZ, uint32* OutVisible) const
+{
+	ConvexVolumeBatch::FBoxStreams Boxes{ OriginX, OriginY, OriginZ, ExtentX, ExtentY, ExtentZ };
+	ConvexVolumeBatch::Intersect<false>(Planes, NumBoxes, Boxes, OutVisible, nullptr);
+}
+
+void FConvexVolume::IntersectBoxes(int32 NumBoxes, const float* OriginX, const float* OriginY, const float* OriginZ, const float* ExtentX, const float* ExtentY, const float* ExtentZ, uint32* OutVisible, uint32* OutFullyContained) const
+{
+	ConvexVolumeBatch::FBoxStreams Boxes{ OriginX, OriginY, OriginZ, ExtentX, ExtentY, ExtentZ };
+	ConvexVolumeBatch::Intersect<true>(Planes, NumBoxes, Boxes, OutVisible, OutFullyContained);
+}
+
+void FConvexVolume::IntersectSpheres(int32 NumSpheres, const float* OriginX, const float* OriginY, const float* OriginZ, const float* Radius, uint32* OutVisible) const
+{
+	ConvexVolumeBatch::FSphereStreams Spheres{ OriginX, OriginY, OriginZ, Radius };
+	ConvexVolumeBatch::Intersect<false>(Planes, NumSpheres, Spheres, OutVisible, nullptr);
+}
+
+void FConvexVolume::IntersectSpheres(int32 NumSpheres, const float* OriginX, const float* OriginY, const float* OriginZ, const float* Radius, uint32* OutVisible, uint32* OutFullyContained) const
+{
+	ConvexVolumeBatch::FSphereStreams Spheres{ OriginX, OriginY, OriginZ, Radius };
+	ConvexVolumeBatch::Intersect<true>(Planes, NumSpheres, Spheres, OutVisible, OutFullyContained);
+}
+
 bool FConvexVolume::IntersectLineSegment(const FVector& InStart, const FVector& InEnd) const
 {
 	// @todo: not optimized
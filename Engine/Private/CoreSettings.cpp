@@ -18,6 +18,12 @@ float GLevelStreamingActorsUpdateTimeLimit = 5.0f;
 float GPriorityLevelStreamingActorsUpdateExtraTime = 5.0f;
 float GLevelStreamingUnregisterComponentsTimeLimit = 1.0f;
 int32 GLevelStreamingComponentsRegistrationGranularity = 10;
+int32 GLevelStreamingBatchRenderStateCreation = 1;
+int32 GLevelStreamingDeferPhysicsStateCreation = 1;
+float GLevelStreamingPhysicsStateTimeLimit = 2.0f;
+int32 GLevelStreamingDeferInitialOverlaps = 0;
+float GLevelStreamingInitialOverlapsTimeLimit = 1.0f;
+int32 GLevelStreamingAsyncPrepareNavigationData = 1;
 int32 GLevelStreamingComponentsUnregistrationGranularity = 5;
 int32 GLevelStreamingForceGCAfterLevelStreamedOut = 1;
 int32 GLevelStreamingContinuouslyIncrementalGCWhileLevelsPendingPurge = 1;
@@ -80,6 +86,48 @@ static FAutoConsoleVariableRef CVarLevelStreamingComponentsRegistrationGranulari
 	ECVF_Default
 	);
 
+static FAutoConsoleVariableRef CVarLevelStreamingBatchRenderStateCreation(
+	TEXT("s.LevelStreamingBatchRenderStateCreation"),
+	GLevelStreamingBatchRenderStateCreation,
+	TEXT("Whether render proxies created while registering components during level streaming are added to the scene in one batch per frame."),
+	ECVF_Default
+	);
+
+static FAutoConsoleVariableRef CVarLevelStreamingDeferPhysicsStateCreation(
+	TEXT("s.LevelStreamingDeferPhysicsStateCreation"),
+	GLevelStreamingDeferPhysicsStateCreation,
+	TEXT("Whether physics state is created in a separate time-sliced step after component registration during level streaming."),
+	ECVF_Default
+	);
+
+static FAutoConsoleVariableRef CVarLevelStreamingPhysicsStateTimeLimit(
+	TEXT("s.LevelStreamingPhysicsStateTimeLimit"),
+	GLevelStreamingPhysicsStateTimeLimit,
+	TEXT("Maximum time to spend creating deferred physics state during level streaming (ms per frame). If this is zero only s.LevelStreamingActorsUpdateTimeLimit applies."),
+	ECVF_Default
+	);
+
+static FAutoConsoleVariableRef CVarLevelStreamingDeferInitialOverlaps(
+	TEXT("s.LevelStreamingDeferInitialOverlaps"),
+	GLevelStreamingDeferInitialOverlaps,
+	TEXT("Whether initial overlaps are updated in a separate time-sliced step once all actors of a streaming level have begun play, instead of right after each actor's BeginPlay."),
+	ECVF_Default
+	);
+
+static FAutoConsoleVariableRef CVarLevelStreamingInitialOverlapsTimeLimit(
+	TEXT("s.LevelStreamingInitialOverlapsTimeLimit"),
+	GLevelStreamingInitialOverlapsTimeLimit,
+	TEXT("Maximum time to spend updating deferred initial overlaps during level streaming (ms per frame). If this is zero only s.LevelStreamingActorsUpdateTimeLimit applies."),
+	ECVF_Default
+	);
+
+static FAutoConsoleVariableRef CVarLevelStreamingAsyncPrepareNavigationData(
+	TEXT("s.LevelStreamingAsyncPrepareNavigationData"),
+	GLevelStreamingAsyncPrepareNavigationData,
+	TEXT("Whether the navigation data chunks of a streaming level are prepared on worker threads while the level is being made visible, so attaching them to the navigation data is only a swap."),
+	ECVF_Default
+	);
+
 static FAutoConsoleVariableRef CVarLevelStreamingComponentsUnregistrationGranularity(
 	TEXT("s.LevelStreamingComponentsUnregistrationGranularity"),
 	GLevelStreamingComponentsUnregistrationGranularity,
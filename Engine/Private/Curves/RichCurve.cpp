@@ -1013,6 +1013,31 @@ float FRichCurve::Eval(float InTime, float InDefaultValue) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_RichCurve_Eval);
 
+	return EvalInternal(InTime, InDefaultValue, nullptr);
+}
+
+float FRichCurve::EvalWithKeyHint(float InTime, int32& InOutKeyHint, float InDefaultValue) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_RichCurve_Eval);
+
+	return EvalInternal(InTime, InDefaultValue, &InOutKeyHint);
+}
+
+void FRichCurve::EvalBatch(TArrayView<const float> InTimes, TArrayView<float> OutValues, float InDefaultValue) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_RichCurve_Eval);
+
+	check(InTimes.Num() == OutValues.Num());
+
+	int32 KeyHint = INDEX_NONE;
+	for (int32 Index = 0; Index < InTimes.Num(); ++Index)
+	{
+		OutValues[Index] = EvalInternal(InTimes[Index], InDefaultValue, &KeyHint);
+	}
+}
+
+float FRichCurve::EvalInternal(float InTime, float InDefaultValue, int32* InOutKeyHint) const
+{
 	// Remap time if extrapolation is present and compute offset value to use if cycling 
 	float CycleValueOffset = 0;
 	RemapTimeValue(InTime, CycleValueOffset);
@@ -1052,27 +1077,53 @@ float FRichCurve::Eval(float InTime, float InDefaultValue) const
 	}
 	else if (InTime < Keys[NumKeys - 1].Time)
 	{
-		// perform a lower bound to get the second of the interpolation nodes
-		int32 first = 1;
-		int32 last = NumKeys - 1;
-		int32 count = last - first;
-
-		while (count > 0)
+		// The hint is the second key of the previous evaluation, try it and the next key before searching
+		int32 first = INDEX_NONE;
+		if (InOutKeyHint && *InOutKeyHint > 0 && *InOutKeyHint < NumKeys)
 		{
-			int32 step = count / 2;
-			int32 middle = first + step;
-
-			if (InTime >= Keys[middle].Time)
+			const int32 Hint = *InOutKeyHint;
+			if (InTime >= Keys[Hint - 1].Time)
 			{
-				first = middle + 1;
-				count -= step + 1;
+				if (InTime < Keys[Hint].Time)
+				{
+					first = Hint;
+				}
+				else if (Hint + 1 < NumKeys && InTime < Keys[Hint + 1].Time)
+				{
+					first = Hint + 1;
+				}
 			}
-			else
+		}
+
+		if (first == INDEX_NONE)
+		{
+			// perform a lower bound to get the second of the interpolation nodes
+			first = 1;
+			int32 last = NumKeys - 1;
+			int32 count = last - first;
+
+			while (count > 0)
 			{
-				count = step;
+				int32 step = count / 2;
+				int32 middle = first + step;
+
+				if (InTime >= Keys[middle].Time)
+				{
+					first = middle + 1;
+					count -= step + 1;
+				}
+				else
+				{
+					count = step;
+				}
 			}
 		}
 
+		if (InOutKeyHint)
+		{
+			*InOutKeyHint = first;
+		}
+
 		InterpVal = EvalForTwoKeys(Keys[first - 1], Keys[first], InTime);
 	}
 	else
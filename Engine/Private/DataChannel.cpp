@@ -214,13 +214,13 @@ bool UChannel::CleanUp(const bool bForDestroy, EChannelCloseReason CloseReason)
 	for (FOutBunch* Out = OutRec, *NextOut; Out != NULL; Out = NextOut)
 	{
 		NextOut = Out->Next;
-		delete Out;
+		Connection->ReleaseReliableOutBunch(Out);
 	}
 	OutRec = nullptr;
 	for (FInBunch* In = InRec, *NextIn; In != NULL; In = NextIn)
 	{
 		NextIn = In->Next;
-		delete In;
+		Connection->ReleaseInBunch(In);
 	}
 	InRec = nullptr;
 	if (InPartialBunch != NULL)
@@ -335,7 +335,7 @@ void UChannel::ReceivedAcks()
 
 		FOutBunch* Release = OutRec;
 		OutRec = OutRec->Next;
-		delete Release;
+		Connection->ReleaseReliableOutBunch(Release);
 		NumOutRec--;
 	}
 
@@ -458,7 +458,7 @@ void UChannel::ReceivedRawBunch( FInBunch & Bunch, bool & bOutSkipAck )
 			}
 		}
 
-		FInBunch* New = new FInBunch(Bunch);
+		FInBunch* New = Connection->AllocInBunch(Bunch);
 		New->Next     = *InPtr;
 		*InPtr        = New;
 		NumInRec++;
@@ -505,6 +505,9 @@ void UChannel::ReceivedRawBunch( FInBunch & Bunch, bool & bOutSkipAck )
 			// Definitely want to warn when this happens, since it's really not possible
 			bool bLocalSkipAck = false;
 
+			// The channel may be cleaned up (clearing Connection) while processing the bunch
+			UNetConnection* const ReleaseConnection = Connection;
+
 			bDeleted = ReceivedNextBunch( *Release, bLocalSkipAck );
 
 			if ( bLocalSkipAck )
@@ -518,7 +521,7 @@ void UChannel::ReceivedRawBunch( FInBunch & Bunch, bool & bOutSkipAck )
 				return;
 			}
 
-			delete Release;
+			ReleaseConnection->ReleaseInBunch(Release);
 			if (bDeleted)
 			{
 				return;
@@ -1212,7 +1215,7 @@ FOutBunch* UChannel::PrepBunch(FOutBunch* Bunch, FOutBunch* OutBunch, bool Merge
 			Bunch->Next	= NULL;
 			Bunch->ChSequence = ++Connection->OutReliable[ChIndex];
 			NumOutRec++;
-			OutBunch = new FOutBunch(*Bunch);
+			OutBunch = Connection->AllocReliableOutBunch(*Bunch);
 			FOutBunch** OutLink = &OutRec;
 			while(*OutLink) // This was rewritten from a single-line for loop due to compiler complaining about empty body for loops (-Wempty-body)
 			{
@@ -1808,6 +1811,12 @@ void UActorChannel::SetClosingFlag()
 int64 UActorChannel::Close(EChannelCloseReason Reason)
 {
 	UE_LOG(LogNetTraffic, Log, TEXT("UActorChannel::Close: ChIndex: %d, Actor: %s, Reason: %s"), ChIndex, *GetFullNameSafe(Actor), LexToString(Reason));
+	// Anything called on this channel before it closed should still go out ahead of the close bunch
+	if (!Closing)
+	{
+		FlushBatchedRemoteFunctions();
+	}
+
 	int64 NumBits = UChannel::Close(Reason);
 
 	if (Actor != nullptr)
@@ -2090,12 +2099,33 @@ bool UActorChannel::CleanUp(const bool bForDestroy, EChannelCloseReason CloseRea
 	// Free the must be mapped list
 	QueuedMustBeMappedGuidsInLastBunch.Empty();
 
+	// Drop anything that was batched but never flushed
+	if (BatchedRemoteFunctions != nullptr)
+	{
+		delete BatchedRemoteFunctions;
+		BatchedRemoteFunctions = nullptr;
+	}
+
+	BatchedMustBeMappedGuids.Empty();
+
+	if (Connection)
+	{
+		Connection->ChannelsWithBatchedRemoteFunctions.Remove(this);
+	}
+
 	if (QueuedBunches.Num() > 0)
 	{
 		// Free any queued bunches
 		for (int32 i = 0; i < QueuedBunches.Num(); i++)
 		{
-			delete QueuedBunches[i];
+			if (Connection)
+			{
+				Connection->ReleaseInBunch(QueuedBunches[i]);
+			}
+			else
+			{
+				delete QueuedBunches[i];
+			}
 		}
 
 		QueuedBunches.Empty();
@@ -2371,10 +2401,13 @@ bool UActorChannel::ProcessQueuedBunches()
 			&& !Connection->Driver->ShouldQueueBunchesForActorGUID(ActorNetGUID))
 		{
 			DECLARE_SCOPE_CYCLE_COUNTER(TEXT("ProcessQueuedBunches time"), STAT_ProcessQueuedBunchesTime, STATGROUP_Net);
+
+			// Processing a bunch may clean up this channel (clearing Connection)
+			UNetConnection* const ReleaseConnection = Connection;
 			for ( int32 i = 0; i < QueuedBunches.Num(); i++ )
 			{
 				ProcessBunch( *QueuedBunches[i] );
-				delete QueuedBunches[i];
+				ReleaseConnection->ReleaseInBunch( QueuedBunches[i] );
 			}
 
 			UE_LOG(LogNet, VeryVerbose, TEXT("UActorChannel::ProcessQueuedBunches: Flushing queued bunches. ChIndex: %i, Actor: %s, Queued: %i"), ChIndex, Actor != NULL ? *Actor->GetPathName() : TEXT("NULL"), QueuedBunches.Num());
@@ -2547,7 +2580,7 @@ void UActorChannel::ReceivedBunch( FInBunch & Bunch )
 				bSuppressQueuedBunchWarningsDueToHitches = false;
 			}
 
-			QueuedBunches.Add(new FInBunch(Bunch));
+			QueuedBunches.Add(Connection->AllocInBunch(Bunch));
 			
 			// Start ticking this channel so we can process the queued bunches when possible
 			Connection->StartTickingChannel(this);
@@ -2889,6 +2922,9 @@ int64 UActorChannel::ReplicateActor()
 		UE_LOG(LogNet, Verbose, TEXT("ReplicateActor: bPausedUntilReliableACK is ending now that reliables have been ACK'd. %s"), *Describe());
 	}
 
+	// Batched functions were called before this update, so make sure they go out first
+	FlushBatchedRemoteFunctions();
+
 	const TArray<FNetViewer>& NetViewers = ActorWorld->GetWorldSettings()->ReplicationViewers;
 	bool bIsNewlyReplicationPaused = false;
 	bool bIsNewlyReplicationUnpaused = false;
@@ -3042,7 +3078,14 @@ int64 UActorChannel::ReplicateActor()
 		}
 
 		// The SubObjects
-		WroteSomethingImportant |= Actor->ReplicateSubobjects(this, &Bunch, &RepFlags);
+		if (Actor->IsUsingRegisteredSubObjectList())
+		{
+			WroteSomethingImportant |= ReplicateRegisteredSubObjects(Bunch, RepFlags);
+		}
+		else
+		{
+			WroteSomethingImportant |= Actor->ReplicateSubobjects(this, &Bunch, &RepFlags);
+		}
 
 		if (Connection->ResendAllDataState != EResendAllDataState::None)
 		{
@@ -3252,6 +3295,68 @@ void UActorChannel::QueueRemoteFunctionBunch( UObject* CallTarget, UFunction* Fu
 	FindOrCreateReplicator(CallTarget).Get().QueueRemoteFunctionBunch( Func, Bunch );
 }
 
+void UActorChannel::BatchRemoteFunctionBunch( FOutBunch &Bunch )
+{
+	// Never let a batch grow into a partial bunch, since losing any part of it would drop every function in it.
+	if ( BatchedRemoteFunctions != nullptr && BatchedRemoteFunctions->GetNumBits() + Bunch.GetNumBits() > Connection->GetMaxSingleBunchSizeBits() )
+	{
+		FlushBatchedRemoteFunctions();
+	}
+
+	if ( BatchedRemoteFunctions == nullptr )
+	{
+		BatchedRemoteFunctions = new FNetBitWriter( Connection->PackageMap, 0 );
+	}
+
+	if ( BatchedRemoteFunctions->GetNumBits() == 0 )
+	{
+		Connection->ChannelsWithBatchedRemoteFunctions.Add( this );
+	}
+
+	BatchedRemoteFunctions->SerializeBits( Bunch.GetData(), Bunch.GetNumBits() );
+
+	UPackageMapClient* PackageMapClient = CastChecked<UPackageMapClient>( Connection->PackageMap );
+
+	// Hold on to any guids the client must wait on until we actually send the bunch these functions end up in
+	if ( PackageMapClient->GetMustBeMappedGuidsInLastBunch().Num() )
+	{
+		BatchedMustBeMappedGuids.Append( PackageMapClient->GetMustBeMappedGuidsInLastBunch() );
+		PackageMapClient->GetMustBeMappedGuidsInLastBunch().Reset();
+	}
+
+	// Exports only need to arrive before the functions that use them, so they can go out with the next bunch sent on this channel
+	PackageMapClient->AppendExportBunches( QueuedExportBunches );
+}
+
+void UActorChannel::FlushBatchedRemoteFunctions()
+{
+	if ( BatchedRemoteFunctions == nullptr || BatchedRemoteFunctions->GetNumBits() == 0 )
+	{
+		return;
+	}
+
+	FOutBunch Bunch( this, 0 );
+	Bunch.SerializeBits( BatchedRemoteFunctions->GetData(), BatchedRemoteFunctions->GetNumBits() );
+	BatchedRemoteFunctions->Reset();
+
+	if ( BatchedMustBeMappedGuids.Num() )
+	{
+		CastChecked<UPackageMapClient>( Connection->PackageMap )->GetMustBeMappedGuidsInLastBunch().Append( BatchedMustBeMappedGuids );
+		BatchedMustBeMappedGuids.Reset();
+	}
+
+	if ( Bunch.IsError() )
+	{
+		UE_LOG( LogNet, Log, TEXT( "Error: Can't send batched RPCs on %s: RPC bunch overflowed" ), *Describe() );
+		CastChecked<UPackageMapClient>( Connection->PackageMap )->GetMustBeMappedGuidsInLastBunch().Reset();
+		return;
+	}
+
+	UE_LOG( LogNetTraffic, Log, TEXT( "      Sending batched RPCs: Channel[%d] [%.1f bytes]" ), ChIndex, Bunch.GetNumBits() / 8.f );
+
+	SendBunch( &Bunch, 1 );
+}
+
 void UActorChannel::BecomeDormant()
 {
 	UE_LOG(LogNetDormancy, Verbose, TEXT("BecomeDormant: %s"), *Describe() );
@@ -4047,6 +4152,51 @@ bool UActorChannel::ReplicateSubobject(UObject *Obj, FOutBunch &Bunch, const FRe
 	return WroteSomething;
 }
 
+bool UActorChannel::ReplicateRegisteredSubObjects(FOutBunch& Bunch, const FReplicationFlags& RepFlags)
+{
+	bool bWroteSomething = false;
+
+	const TStaticBitArray<COND_Max> ConditionMap = FSendingRepState::BuildConditionMapFromRepFlags(RepFlags);
+	const bool bCompareAll = RepFlags.bNetInitial || bForceCompareProperties || Connection->ResendAllDataState != EResendAllDataState::None;
+
+	for (const FReplicatedSubObjectInfo& Info : Actor->GetReplicatedSubObjects())
+	{
+		UObject* SubObject = Info.SubObject.Get();
+		if (SubObject == nullptr || !ConditionMap[Info.NetCondition])
+		{
+			continue;
+		}
+
+		if (Info.bDirtyTracked)
+		{
+			TSharedRef<FObjectReplicator>* ExistingReplicator = ReplicationMap.Find(SubObject);
+			if (!bCompareAll && ExistingReplicator)
+			{
+				const FObjectReplicator& Replicator = ExistingReplicator->Get();
+				const bool bHasQueuedRPCs = Replicator.RemoteFunctions && Replicator.RemoteFunctions->GetNumBits() > 0;
+
+				if (Replicator.LastSentSubObjectDirtyKey == Info.DirtyKey && !bHasQueuedRPCs)
+				{
+					continue;
+				}
+			}
+
+			bWroteSomething |= ReplicateSubobject(SubObject, Bunch, RepFlags);
+
+			if (TSharedRef<FObjectReplicator>* Replicator = ExistingReplicator ? ExistingReplicator : ReplicationMap.Find(SubObject))
+			{
+				(*Replicator)->LastSentSubObjectDirtyKey = Info.DirtyKey;
+			}
+		}
+		else
+		{
+			bWroteSomething |= ReplicateSubobject(SubObject, Bunch, RepFlags);
+		}
+	}
+
+	return bWroteSomething;
+}
+
 //------------------------------------------------------
 
 static void	DebugNetGUIDs( UWorld* InWorld )
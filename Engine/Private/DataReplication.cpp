@@ -50,6 +50,14 @@ static FAutoConsoleVariableRef CVarSupportsFastArrayDelta(
 	TEXT("Whether or not Fast Array Struct Delta Serialization is enabled.")
 );
 
+int32 GNetCoalesceRepNotifies = 0;
+static FAutoConsoleVariableRef CVarNetCoalesceRepNotifies(
+	TEXT("net.CoalesceRepNotifies"),
+	GNetCoalesceRepNotifies,
+	TEXT("If non-zero, clients call the RepNotifies of objects whose actor has begun play once at the end of TickDispatch, instead of after every bunch.\n")
+	TEXT("Properties received by several bunches in a frame then notify once."),
+	ECVF_Default);
+
 extern TAutoConsoleVariable<int32> CVarNetEnableDetailedScopeCounters;
 
 class FNetSerializeCB : public INetSerializeCB
@@ -281,6 +289,7 @@ FObjectReplicator::FObjectReplicator()
 	, bForceUpdateUnmapped(false)
 	, bHasReplicatedProperties(false)
 	, bSupportsFastArrayDelta(false)
+	, LastSentSubObjectDirtyKey(0)
 	, ObjectClass(nullptr)
 	, ObjectPtr(nullptr)
 	, Connection(nullptr)
@@ -504,6 +513,7 @@ void FObjectReplicator::CleanUp()
 		}
 
 		Connection->Driver->UnmappedReplicators.Remove( this );
+		Connection->Driver->RepNotifyPendingReplicators.Remove( this );
 
 		Connection->Driver->TotalTrackedGuidMemoryBytes -= TrackedGuidMemoryBytes;
 
@@ -770,6 +780,9 @@ void FObjectReplicator::ReceivedNak( int32 NakPacketId )
 		UE_LOG(LogNet, Verbose, TEXT("FObjectReplicator::ReceivedNak: Object == nullptr"));
 		return;
 	}
+
+	// Lost data has to be resent even if a dirty tracked subobject hasn't been marked dirty again
+	LastSentSubObjectDirtyKey = 0;
 	else if (ObjectClass == nullptr)
 	{
 		UE_LOG(LogNet, Verbose, TEXT("FObjectReplicator::ReceivedNak: ObjectClass == nullptr"));
@@ -1343,7 +1356,14 @@ void FObjectReplicator::PostReceivedBunch()
 		bHasReplicatedProperties = false;
 	}
 
-	// Call RepNotifies
+	// Call RepNotifies, or once at the end of the dispatch together with the ones of later bunches.
+	// Actors that didn't begin play yet get theirs right away, so they're called before PostNetInit.
+	if (!bIsServer && GNetCoalesceRepNotifies && OwningChannel->Actor && OwningChannel->Actor->HasActorBegunPlay())
+	{
+		OwningChannel->Connection->Driver->RepNotifyPendingReplicators.Add(this);
+		return;
+	}
+
 	CallRepNotifies(true);
 }
 
@@ -1980,7 +2000,10 @@ void FObjectReplicator::UpdateUnmappedObjects(bool & bOutHasMoreUnmapped)
 	FReceivingRepState* ReceivingRepState = RepState->GetReceivingRepState();
 	const bool bHasQueuedBunches = OwningChannel && OwningChannel->QueuedBunches.Num() > 0;
 
-	checkf(bHasQueuedBunches || ReceivingRepState->RepNotifies.Num() == 0,
+	// Coalesced RepNotifies are called below as well
+	const bool bHasPendingRepNotifies = Connection->Driver->RepNotifyPendingReplicators.Remove(this) > 0;
+
+	checkf(bHasQueuedBunches || bHasPendingRepNotifies || ReceivingRepState->RepNotifies.Num() == 0,
 		TEXT("Failed RepState RepNotifies check. Num=%d. Object=%s. Channel QueuedBunches=%d"),
 		ReceivingRepState->RepNotifies.Num(), *Object->GetFullName(), OwningChannel ? OwningChannel->QueuedBunches.Num() : 0);
 
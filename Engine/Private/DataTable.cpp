@@ -106,6 +106,17 @@ void UDataTable::LoadStructData(FStructuredArchiveSlot Slot)
 
 	DATATABLE_CHANGE_SCOPE();
 
+	// Cooked builds load every row into one block, which keeps rows that are iterated together next to each other in memory.
+	// Editor tools free rows one by one, so they keep their own allocation there
+	const int32 RowAlignment = FMath::Max(LoadUsingStruct->GetMinAlignment(), 1);
+	const int32 RowStride = Align(LoadUsingStruct->GetStructureSize(), RowAlignment);
+	uint8* RowBlock = nullptr;
+	if (!WITH_EDITOR && NumRows > 0 && RowMap.Num() == 0 && !LoadedRowBlock)
+	{
+		LoadedRowBlockSize = (SIZE_T)RowStride * NumRows;
+		LoadedRowBlock = RowBlock = (uint8*)FMemory::Malloc(LoadedRowBlockSize, RowAlignment);
+	}
+
 	RowMap.Reserve(NumRows);
 	for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
 	{
@@ -116,7 +127,7 @@ void UDataTable::LoadStructData(FStructuredArchiveSlot Slot)
 		RowRecord << SA_VALUE(TEXT("Name"), RowName);
 
 		// Load row data
-		uint8* RowData = (uint8*)FMemory::Malloc(LoadUsingStruct->GetStructureSize());
+		uint8* RowData = RowBlock ? RowBlock + (SIZE_T)RowStride * RowIdx : (uint8*)FMemory::Malloc(LoadUsingStruct->GetStructureSize());
 
 		// And be sure to call DestroyScriptStruct later
 		LoadUsingStruct->InitializeStruct(RowData);
@@ -345,13 +356,29 @@ void UDataTable::EmptyTable()
 	// Iterate over all rows in table and free mem
 	for (auto RowIt = RowMap.CreateIterator(); RowIt; ++RowIt)
 	{
-		uint8* RowData = RowIt.Value();
-		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+		FreeRowData(EmptyUsingStruct, RowIt.Value());
 	}
 
 	// Finally empty the map
 	RowMap.Empty();
+
+	if (LoadedRowBlock)
+	{
+		FMemory::Free(LoadedRowBlock);
+		LoadedRowBlock = nullptr;
+		LoadedRowBlockSize = 0;
+	}
+}
+
+void UDataTable::FreeRowData(UScriptStruct& UsingStruct, uint8* RowData)
+{
+	UsingStruct.DestroyStruct(RowData);
+
+	const bool bInLoadedRowBlock = LoadedRowBlock && RowData >= LoadedRowBlock && RowData < LoadedRowBlock + LoadedRowBlockSize;
+	if (!bInLoadedRowBlock)
+	{
+		FMemory::Free(RowData);
+	}
 }
 
 void UDataTable::RemoveRow(FName RowName)
@@ -365,8 +392,7 @@ void UDataTable::RemoveRow(FName RowName)
 		
 	if (RowData)
 	{
-		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+		FreeRowData(EmptyUsingStruct, RowData);
 	}
 }
 
@@ -5,6 +5,8 @@
 #include "Engine/DataTable.h"
 #include "Serialization/Csv/CsvParser.h"
 #include "Engine/UserDefinedStruct.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 
 #if WITH_EDITOR
 
@@ -113,6 +115,21 @@ bool FDataTableExporterCSV::WriteStructEntry(const void* InRowData, FProperty* I
 #endif // WITH_EDITOR
 
 
+/** Tables with fewer rows are imported on the calling thread only */
+static const int32 ParallelCSVImportMinRows = 1024;
+
+/** Plain numbers, bools, strings and names import without touching anything but the row, so their cells can be imported from any thread */
+static bool CanImportCellInParallel(const FProperty* ColumnProp)
+{
+	if (const FByteProperty* ByteProp = CastField<const FByteProperty>(ColumnProp))
+	{
+		// Enum cells may look up display names
+		return !ByteProp->IsEnum();
+	}
+
+	return ColumnProp && (ColumnProp->IsA<FNumericProperty>() || ColumnProp->IsA<FBoolProperty>() || ColumnProp->IsA<FStrProperty>() || ColumnProp->IsA<FNameProperty>());
+}
+
 FDataTableImporterCSV::FDataTableImporterCSV(UDataTable& InDataTable, FString InCSVData, TArray<FString>& OutProblems)
 	: DataTable(&InDataTable)
 	, CSVData(MoveTemp(InCSVData))
@@ -170,6 +187,47 @@ bool FDataTableImporterCSV::ReadTable()
 	// Empty existing data
 	DataTable->EmptyTable();
 
+	auto ImportCell = [&ColumnProps](const TArray<const TCHAR*>& Cells, int32 CellIdx, FName RowName, uint8* RowData, TArray<FString>& OutProblems)
+	{
+		// Try and assign string to data using the column property
+		FProperty* ColumnProp = ColumnProps[CellIdx];
+		const FString CellValue = Cells[CellIdx];
+		FString Error = DataTableUtils::AssignStringToProperty(CellValue, ColumnProp, RowData);
+
+		// If we failed, output a problem string
+		if(Error.Len() > 0)
+		{
+			FString ColumnName = (ColumnProp != nullptr) 
+				? DataTableUtils::GetPropertyExportName(ColumnProp)
+				: FString(TEXT("NONE"));
+			OutProblems.Add(FString::Printf(TEXT("Problem assigning string '%s' to property '%s' on row '%s' : %s"), *CellValue, *ColumnName, *RowName.ToString(), *Error));
+		}
+	};
+
+	// Large tables create every row first, then import the cells that can be imported from any thread in parallel
+	const bool bImportInParallel = Rows.Num() > ParallelCSVImportMinRows && FApp::ShouldUseThreadingForPerformance();
+	TBitArray<> ParallelColumns(false, ColumnProps.Num());
+	if (bImportInParallel)
+	{
+		for (int32 ColIdx = 0; ColIdx < ColumnProps.Num(); ++ColIdx)
+		{
+			ParallelColumns[ColIdx] = ColIdx != KeyColumn && CanImportCellInParallel(ColumnProps[ColIdx]);
+		}
+	}
+
+	struct FParallelImportRow
+	{
+		const TArray<const TCHAR*>* Cells;
+		FName RowName;
+		uint8* RowData;
+		TArray<FString> Problems;
+	};
+	TArray<FParallelImportRow> ParallelImportRows;
+	if (bImportInParallel)
+	{
+		ParallelImportRows.Reserve(Rows.Num() - 1);
+	}
+
 	// Iterate over rows
 	for(int32 RowIdx=1; RowIdx<Rows.Num(); RowIdx++)
 	{
@@ -222,27 +280,20 @@ bool FDataTableImporterCSV::ReadTable()
 		// Add to row map
 		DataTable->AddRowInternal(RowName, RowData);
 
+		if (bImportInParallel)
+		{
+			ParallelImportRows.Add({ &Cells, RowName, RowData, TArray<FString>() });
+		}
+
 		// Now iterate over cells (skipping first cell unless we had an explicit name)
 		for(int32 CellIdx = 0; CellIdx < Cells.Num(); CellIdx++)
 		{
-			if (CellIdx == KeyColumn)
-		{
+			if (CellIdx == KeyColumn || ParallelColumns[CellIdx])
+			{
 				continue;
 			}
 
-			// Try and assign string to data using the column property
-			FProperty* ColumnProp = ColumnProps[CellIdx];
-			const FString CellValue = Cells[CellIdx];
-			FString Error = DataTableUtils::AssignStringToProperty(CellValue, ColumnProp, RowData);
-
-			// If we failed, output a problem string
-			if(Error.Len() > 0)
-			{
-				FString ColumnName = (ColumnProp != nullptr) 
-					? DataTableUtils::GetPropertyExportName(ColumnProp)
-					: FString(TEXT("NONE"));
-				ImportProblems.Add(FString::Printf(TEXT("Problem assigning string '%s' to property '%s' on row '%s' : %s"), *CellValue, *ColumnName, *RowName.ToString(), *Error));
-			}
+			ImportCell(Cells, CellIdx, RowName, RowData, ImportProblems);
 		}
 
 		// Problem if we didn't have enough cells on this row
@@ -252,6 +303,26 @@ bool FDataTableImporterCSV::ReadTable()
 		}
 	}
 
+	if (bImportInParallel)
+	{
+		ParallelFor(ParallelImportRows.Num(), [&ParallelImportRows, &ParallelColumns, &ImportCell](int32 Index)
+		{
+			FParallelImportRow& ImportRow = ParallelImportRows[Index];
+			for (int32 CellIdx = 0; CellIdx < ImportRow.Cells->Num(); CellIdx++)
+			{
+				if (ParallelColumns[CellIdx])
+				{
+					ImportCell(*ImportRow.Cells, CellIdx, ImportRow.RowName, ImportRow.RowData, ImportRow.Problems);
+				}
+			}
+		});
+
+		for (const FParallelImportRow& ImportRow : ParallelImportRows)
+		{
+			ImportProblems.Append(ImportRow.Problems);
+		}
+	}
+
 	DataTable->Modify(true);
 
 	return true;
@@ -40,6 +40,8 @@
 #include "Engine/ChildConnection.h"
 #include "Net/ReplayPlaylistTracker.h"
 #include "Net/NetworkGranularMemoryLogging.h"
+#include "Serialization/MemoryWriter.h"
+#include "Async/TaskGraphInterfaces.h"
 
 DEFINE_LOG_CATEGORY( LogDemo );
 
@@ -82,6 +84,9 @@ static FAutoConsoleVariableRef CVarDemoSaveRollbackActorState( TEXT( "demo.SaveR
 static TAutoConsoleVariable<int32> CVarWithLevelStreamingFixes(TEXT("demo.WithLevelStreamingFixes"), 0, TEXT("If 1, provides fixes for level streaming (but breaks backwards compatibility)."));
 static TAutoConsoleVariable<int32> CVarWithDemoTimeBurnIn(TEXT("demo.WithTimeBurnIn"), 0, TEXT("If true, adds an on screen message with the current DemoTime and Changelist."));
 static TAutoConsoleVariable<int32> CVarWithDeltaCheckpoints(TEXT("demo.WithDeltaCheckpoints"), 0, TEXT("If true, record checkpoints as a delta from the previous checkpoint."));
+static TAutoConsoleVariable<float> CVarDemoGotoTimeFastForwardThreshold(TEXT("demo.GotoTimeFastForwardThreshold"), 0.0f, TEXT("If > 0, GotoTimeInSeconds requests that move forward by at most this many seconds will fast forward from the current position instead of loading a checkpoint."));
+static TAutoConsoleVariable<int32> CVarDemoPlaybackPacketBufferPoolSize(TEXT("demo.PlaybackPacketBufferPoolSize"), 256, TEXT("The maximum number of processed playback packet buffers kept for reuse when reading demo frames. 0 disables reuse."));
+static TAutoConsoleVariable<int32> CVarDemoAsyncCheckpointGuidCache(TEXT("demo.AsyncCheckpointGuidCache"), 0, TEXT("If true, the guid cache for a checkpoint is resolved in one frame and then serialized on a background task, instead of being serialized on the game thread across frames."));
 static TAutoConsoleVariable<int32> CVarWithGameSpecificFrameData(TEXT("demo.WithGameSpecificFrameData"), 0, TEXT("If true, allow game specific data to be recorded with each demo frame."));
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -975,6 +980,7 @@ void UDemoNetDriver::ResetDemoState()
 
 	ExternalDataToObjectMap.Empty();
 	PlaybackPackets.Empty();
+	FreePlaybackPacketBuffers.Empty();
 	PlaybackFrames.Empty();
 
 	ClearLevelStreamingState();
@@ -1971,6 +1977,85 @@ bool UDemoNetDriver::SerializeGuidCache(const FRepActorsCheckpointParams& Params
 	return bCompleted;
 }
 
+// Checkpoint saving step, when demo.AsyncCheckpointGuidCache is enabled.
+// Anything that touches UObjects is resolved here, the (much more expensive) string conversion and archive writes happen on a background task.
+void UDemoNetDriver::StartAsyncGuidCacheSerialization()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedPtr<FAsyncGuidCacheSerialization, ESPMode::ThreadSafe> State = MakeShared<FAsyncGuidCacheSerialization, ESPMode::ThreadSafe>();
+	State->Items.Reserve(NetGuidCacheSnapshot.Num());
+
+	for (const FNetGuidCacheItem& Item : NetGuidCacheSnapshot)
+	{
+		const FNetGuidCacheObject& CacheObject = Item.NetGuidCacheObject;
+		const UObject* Object = CacheObject.Object.Get();
+
+		if ((Item.NetGuid.IsStatic() || (Object && Object->IsNameStableForNetworking())) && !DeletedNetStartupActorGUIDs.Contains(Item.NetGuid))
+		{
+			FAsyncNetGuidCacheItem& AsyncItem = State->Items.AddDefaulted_GetRef();
+			AsyncItem.NetGuid = Item.NetGuid;
+			AsyncItem.OuterGUID = CacheObject.OuterGUID;
+			AsyncItem.ObjectName = Object ? Object->GetFName() : CacheObject.PathName;
+			AsyncItem.NetworkChecksum = CacheObject.NetworkChecksum;
+			AsyncItem.Flags = (CacheObject.bNoLoad ? (1 << 0) : 0) | (CacheObject.bIgnoreWhenMissing ? (1 << 1) : 0);
+
+			// Only packages are remapped when writing, and there are few of them
+			if (!CacheObject.OuterGUID.IsValid())
+			{
+				FString PathName = AsyncItem.ObjectName.ToString();
+				if (GEngine->NetworkRemapPath(this, PathName, false))
+				{
+					AsyncItem.RemappedPathName = MoveTemp(PathName);
+				}
+			}
+		}
+	}
+
+	NetGuidCacheSnapshot.Reset();
+	AsyncGuidCacheSerialization = State;
+
+	FFunctionGraphTask::CreateAndDispatchWhenReady([State]()
+	{
+		FMemoryWriter Writer(State->Data);
+
+		for (FAsyncNetGuidCacheItem& Item : State->Items)
+		{
+			FString PathName = Item.RemappedPathName.IsEmpty() ? Item.ObjectName.ToString() : MoveTemp(Item.RemappedPathName);
+
+			Writer << Item.NetGuid;
+			Writer << Item.OuterGUID;
+			Writer << PathName;
+			Writer << Item.NetworkChecksum;
+			Writer << Item.Flags;
+		}
+
+		State->bCompleted = true;
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+
+	UE_LOG(LogDemo, Verbose, TEXT("StartAsyncGuidCacheSerialization: %d, %.1f ms"), State->Items.Num(), (FPlatformTime::Seconds() - StartTime) * 1000);
+}
+
+bool UDemoNetDriver::FinishAsyncGuidCacheSerialization(FArchive* CheckpointArchive)
+{
+	check(AsyncGuidCacheSerialization.IsValid());
+
+	if (!AsyncGuidCacheSerialization->bCompleted)
+	{
+		return false;
+	}
+
+	int32 NumNetGuids = AsyncGuidCacheSerialization->Items.Num();
+	*CheckpointArchive << NumNetGuids;
+	CheckpointArchive->Serialize(AsyncGuidCacheSerialization->Data.GetData(), AsyncGuidCacheSerialization->Data.Num());
+
+	UE_LOG(LogDemo, Log, TEXT("Checkpoint. FinishAsyncGuidCacheSerialization: %d guids, %d bytes"), NumNetGuids, AsyncGuidCacheSerialization->Data.Num());
+
+	AsyncGuidCacheSerialization.Reset();
+
+	return true;
+}
+
 float UDemoNetDriver::GetCheckpointSaveMaxMSPerFrame() const
 {
 	const float CVarValue = CVarCheckpointSaveMaxMSPerFrameOverride.GetValueOnAnyThread();
@@ -2106,6 +2191,7 @@ void UDemoNetDriver::SaveCheckpoint()
 
 	// We are now processing checkpoint actors	
 	CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState_ProcessCheckpointActors;
+	AsyncGuidCacheSerialization.Reset();
 	CheckpointSaveContext.TotalCheckpointSaveTimeSeconds = 0;
 	CheckpointSaveContext.TotalCheckpointReplicationTimeSeconds = 0;
 	CheckpointSaveContext.TotalCheckpointSaveFrames = 0;
@@ -2307,6 +2393,12 @@ void UDemoNetDriver::TickCheckpoint()
 						SCOPED_NAMED_EVENT(UDemoNetDriver_CacheNetGuids, FColor::Green);
 
 						CacheNetGuids();
+
+						if (CVarDemoAsyncCheckpointGuidCache.GetValueOnAnyThread() != 0)
+						{
+							StartAsyncGuidCacheSerialization();
+						}
+
 						CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState_SerializeGuidCache;
 					}
 				}
@@ -2317,7 +2409,7 @@ void UDemoNetDriver::TickCheckpoint()
 					SCOPED_NAMED_EVENT(UDemoNetDriver_SerializeGuidCache, FColor::Green);
 
 					// Save the current guid cache
-					bExecuteNextState = SerializeGuidCache(Params, CheckpointArchive);
+					bExecuteNextState = AsyncGuidCacheSerialization.IsValid() ? FinishAsyncGuidCacheSerialization(CheckpointArchive) : SerializeGuidCache(Params, CheckpointArchive);
 					if (bExecuteNextState)
 					{
 						CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState_SerializeNetFieldExportGroupMap;
@@ -2835,13 +2927,18 @@ void UDemoNetDriver::TickDemoRecordFrame(float DeltaSeconds)
 		{
 			TArray< FReplayViewer, TInlineAllocator<16> > ReplayViewers;
 
-			const bool bUseNetRelevancy = CVarDemoUseNetRelevancy.GetValueOnAnyThread() > 0 && World->NetDriver != nullptr && World->NetDriver->IsServer();
+			const bool bUseNetRelevancy = (CVarDemoUseNetRelevancy.GetValueOnAnyThread() > 0 || ReplayViewerFilter.IsBound()) && World->NetDriver != nullptr && World->NetDriver->IsServer();
 
-			// If we're using relevancy, consider all connections as possible viewing sources
+			// If we're using relevancy, consider all connections (or the filtered subset) as possible viewing sources
 			if (bUseNetRelevancy)
 			{
 				for (UNetConnection* Connection : World->NetDriver->ClientConnections)
 				{
+					if (ReplayViewerFilter.IsBound() && !ReplayViewerFilter.Execute(Connection))
+					{
+						continue;
+					}
+
 					FReplayViewer ReplayViewer(Connection);
 					if (ReplayViewer.ViewTarget != nullptr)
 					{
@@ -3501,7 +3598,7 @@ bool UDemoNetDriver::ReadDemoFrameIntoPlaybackPackets(FArchive& Ar, TArray<FPlay
 					}
 
 					InPlaybackPackets.Emplace(MoveTemp(ScratchPacket));
-					ScratchPacket.Data = TArray<uint8>();
+					ScratchPacket.Data = FreePlaybackPacketBuffers.Num() > 0 ? FreePlaybackPacketBuffers.Pop(false) : TArray<uint8>();
 					break;
 				}
 
@@ -3739,10 +3836,21 @@ bool UDemoNetDriver::ConditionallyProcessPlaybackPackets()
 	return ProcessPacket(CurPacket);
 }
 
+void UDemoNetDriver::RemoveProcessedPlaybackPackets(int32 Count)
+{
+	const int32 MaxFreeBuffers = CVarDemoPlaybackPacketBufferPoolSize.GetValueOnAnyThread();
+	for (int32 i = 0; i < Count && FreePlaybackPacketBuffers.Num() < MaxFreeBuffers; ++i)
+	{
+		FreePlaybackPacketBuffers.Emplace(MoveTemp(PlaybackPackets[i].Data));
+	}
+
+	PlaybackPackets.RemoveAt(0, Count);
+}
+
 void UDemoNetDriver::ProcessAllPlaybackPackets()
 {
 	ProcessPlaybackPackets(PlaybackPackets);
-	PlaybackPackets.Empty();
+	RemoveProcessedPlaybackPackets(PlaybackPackets.Num());
 	// this call is used for checkpoint loading, so not dealing with per frame data
 	PlaybackFrames.Empty();
 }
@@ -3919,6 +4027,17 @@ void UDemoNetDriver::GotoTimeInSeconds(const float TimeInSeconds, const FOnGotoT
 
 	UE_LOG(LogDemo, Log, TEXT("GotoTimeInSeconds: %2.2f"), TimeInSeconds);
 
+	// Short forward seeks are usually cheaper to fast forward from where we are than to load the previous checkpoint and fast forward from there.
+	// FinalizeFastForward will call the goto delegate.
+	const float FastForwardThreshold = CVarDemoGotoTimeFastForwardThreshold.GetValueOnGameThread();
+	const float SecondsToSkip = TimeInSeconds - DemoCurrentTime;
+	if (FastForwardThreshold > 0.0f && SecondsToSkip > 0.0f && SecondsToSkip <= FastForwardThreshold && !IsAnyTaskPending() && !bIsLoadingCheckpoint)
+	{
+		UE_LOG(LogDemo, Log, TEXT("GotoTimeInSeconds: Fast forwarding %2.2f seconds instead of loading a checkpoint"), SecondsToSkip);
+		AddReplayTask(new FSkipTimeInSecondsTask(this, SecondsToSkip));
+		return;
+	}
+
 	AddReplayTask(new FGotoTimeInSecondsTask(this, TimeInSeconds));
 }
 
@@ -4202,7 +4321,7 @@ void UDemoNetDriver::TickDemoPlayback(float DeltaSeconds)
 			// as it points to the "next" index we would otherwise have processed.
 			LastProcessedPacketTime = PlaybackPackets[PlaybackPacketIndex - 1].TimeSeconds;
 
-			PlaybackPackets.RemoveAt(0, PlaybackPacketIndex);
+			RemoveProcessedPlaybackPackets(PlaybackPacketIndex);
 			PlaybackPacketIndex = 0;
 		}
 
@@ -6914,6 +7033,14 @@ void UDemoNetDriver::Serialize(FArchive& Ar)
 			}
 		);
 
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("FreePlaybackPacketBuffers",
+			FreePlaybackPacketBuffers.CountBytes(Ar);
+			for (const TArray<uint8>& Buffer : FreePlaybackPacketBuffers)
+			{
+				Buffer.CountBytes(Ar);
+			}
+		);
+
 		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("PlaybackFrames",
 			PlaybackFrames.CountBytes(Ar);
 			for (auto& Frame : PlaybackFrames)
@@ -88,10 +88,11 @@ void UDeviceProfileManager::InitializeCVarsForActiveDeviceProfile(bool bPushSett
 
 	UE_LOG(LogInit, Log, TEXT("Applying CVar settings loaded from the selected device profile: [%s]"), *ActiveProfileName);
 
-	TArray< FString > AvailableProfiles;
-	GConfig->GetSectionNames( GDeviceProfilesIni, AvailableProfiles );
+	TArray< FString > AvailableProfileSections;
+	GConfig->GetSectionNames( GDeviceProfilesIni, AvailableProfileSections );
 
 	// Look up the ini for this tree as we are far too early to use the UObject system
+	TSet< FString > AvailableProfiles(AvailableProfileSections);
 	AvailableProfiles.Remove( TEXT( "DeviceProfiles" ) );
 
 	// Next we need to create a hierarchy of CVars from the Selected Device Profile, to it's eldest parent
@@ -199,38 +200,12 @@ void UDeviceProfileManager::InitializeCVarsForActiveDeviceProfile(bool bPushSett
 				TArray< FString > CurrentProfilesCVars;
 				GConfig->GetArray(*CurrentSectionName, *ArrayName, CurrentProfilesCVars, GDeviceProfilesIni);
 
-				// Iterate over the profile and make sure we do not have duplicate CVars
-				{
-					TMap< FString, FString > ValidCVars;
-					for (TArray< FString >::TConstIterator CVarIt(CurrentProfilesCVars); CVarIt; ++CVarIt)
-					{
-						FString CVarKey, CVarValue;
-						if ((*CVarIt).Split(TEXT("="), &CVarKey, &CVarValue))
-						{
-							if (ValidCVars.Find(CVarKey))
-							{
-								ValidCVars.Remove(CVarKey);
-							}
-
-							ValidCVars.Add(CVarKey, CVarValue);
-						}
-					}
-
-					// Empty the current list, and replace with the processed CVars. This removes duplicates
-					CurrentProfilesCVars.Empty();
-
-					for (TMap< FString, FString >::TConstIterator ProcessedCVarIt(ValidCVars); ProcessedCVarIt; ++ProcessedCVarIt)
-					{
-						CurrentProfilesCVars.Add(FString::Printf(TEXT("%s=%s"), *ProcessedCVarIt.Key(), *ProcessedCVarIt.Value()));
-					}
-
-				}
-
 				// Iterate over this profiles cvars and set them if they haven't been already.
-				for (TArray< FString >::TConstIterator CVarIt(CurrentProfilesCVars); CVarIt; ++CVarIt)
+				// Backwards, so that when a CVar is listed more than once the last value is the one set, and the others are skipped like already set ones.
+				for (int32 CVarIndex = CurrentProfilesCVars.Num() - 1; CVarIndex >= 0; --CVarIndex)
 				{
 					FString CVarKey, CVarValue;
-					if ((*CVarIt).Split(TEXT("="), &CVarKey, &CVarValue))
+					if (CurrentProfilesCVars[CVarIndex].Split(TEXT("="), &CVarKey, &CVarValue))
 					{
 						if (!CVarsAlreadySetList.Find(CVarKey))
 						{
@@ -15,6 +15,8 @@
 #include "ProfilingDebugging/CookStats.h"
 #include "Templates/UniquePtr.h"
 #include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
+#include "UObject/UObjectIterator.h"
 #include "Misc/AutomationTest.h"
 #include "Async/ParallelFor.h"
 #include "DistanceFieldDownsampling.h"
@@ -847,14 +849,49 @@ FString BuildDistanceFieldDerivedDataKey(const FString& InMeshKey)
 
 #endif
 
+int32 GUseAsyncDistanceFieldBuildQueue = 1;
+static FAutoConsoleVariableRef CVarAOAsyncBuildQueue(
+	TEXT("r.AOAsyncBuildQueue"),
+	GUseAsyncDistanceFieldBuildQueue,
+	TEXT("Whether to asynchronously build distance field volume data from meshes."),
+	ECVF_Default | ECVF_ReadOnly
+	);
+
+static int32 GDistanceFieldAsyncDDCFetch = 1;
+static FAutoConsoleVariableRef CVarDistanceFieldAsyncDDCFetch(
+	TEXT("r.DistanceFieldBuild.AsyncDDCFetch"),
+	GDistanceFieldAsyncDDCFetch,
+	TEXT("Whether distance fields are fetched from the DDC asynchronously through the build queue instead of blocking the thread caching the mesh.\n")
+	TEXT("Fetched distance fields are then applied like built ones, once the queue is processed. Requires r.AOAsyncBuildQueue."),
+	ECVF_Default
+	);
+
+static float GDistanceFieldBuildPriorityUpdatePeriod = 1.0f;
+static FAutoConsoleVariableRef CVarDistanceFieldBuildPriorityUpdatePeriod(
+	TEXT("r.DistanceFieldBuild.PriorityUpdatePeriod"),
+	GDistanceFieldBuildPriorityUpdatePeriod,
+	TEXT("Seconds between updates of the build order of pending distance fields, meshes rendered most recently are built first.\n")
+	TEXT("0 disables the updates, distance fields are then built last queued first."),
+	ECVF_Default
+	);
+
 #if WITH_EDITORONLY_DATA
 
 void FDistanceFieldVolumeData::CacheDerivedData(const FString& InDDCKey, UStaticMesh* Mesh, UStaticMesh* GenerateSource, float DistanceFieldResolutionScale, bool bGenerateDistanceFieldAsIfTwoSided)
 {
 	TArray<uint8> DerivedData;
 
+	// The fetch is then waited for by the build thread, which only builds the distance field on a miss
+	const bool bAsyncFetch = GUseAsyncDistanceFieldBuildQueue && GDistanceFieldAsyncDDCFetch;
+	uint32 DDCRequestHandle = 0;
+
 	COOK_STAT(auto Timer = DistanceFieldCookStats::UsageStats.TimeSyncWork());
-	if (GetDerivedDataCacheRef().GetSynchronous(*InDDCKey, DerivedData, Mesh->GetPathName()))
+	if (bAsyncFetch)
+	{
+		DDCRequestHandle = GetDerivedDataCacheRef().GetAsynchronous(*InDDCKey, Mesh->GetPathName());
+	}
+
+	if (!bAsyncFetch && GetDerivedDataCacheRef().GetSynchronous(*InDDCKey, DerivedData, Mesh->GetPathName()))
 	{
 		COOK_STAT(Timer.AddHit(DerivedData.Num()));
 		FMemoryReader Ar(DerivedData, /*bIsPersistent=*/ true);
@@ -872,6 +909,7 @@ void FDistanceFieldVolumeData::CacheDerivedData(const FString& InDDCKey, UStatic
 		NewTask->DistanceFieldResolutionScale = DistanceFieldResolutionScale;
 		NewTask->bGenerateDistanceFieldAsIfTwoSided = bGenerateDistanceFieldAsIfTwoSided;
 		NewTask->GeneratedVolumeData = new FDistanceFieldVolumeData();
+		NewTask->DDCRequestHandle = DDCRequestHandle;
 
 		for (int32 MaterialIndex = 0; MaterialIndex < Mesh->StaticMaterials.Num(); MaterialIndex++)
 		{
@@ -892,14 +930,6 @@ void FDistanceFieldVolumeData::CacheDerivedData(const FString& InDDCKey, UStatic
 
 #endif
 
-int32 GUseAsyncDistanceFieldBuildQueue = 1;
-static FAutoConsoleVariableRef CVarAOAsyncBuildQueue(
-	TEXT("r.AOAsyncBuildQueue"),
-	GUseAsyncDistanceFieldBuildQueue,
-	TEXT("Whether to asynchronously build distance field volume data from meshes."),
-	ECVF_Default | ECVF_ReadOnly
-	);
-
 class FBuildDistanceFieldThreadRunnable : public FRunnable
 {
 public:
@@ -980,8 +1010,8 @@ uint32 FBuildDistanceFieldThreadRunnable::Run()
 	uint64 LastWorkCycle = FPlatformTime::Cycles64();
 	while (!bForceFinish &&  (bHasWork || (FPlatformTime::Cycles64() - LastWorkCycle) < ExitAfterIdleCycle))
 	{
-		// LIFO build order, since meshes actually visible in a map are typically loaded last
-		FAsyncDistanceFieldTask* Task = AsyncQueue.TaskQueue.Pop();
+		// Meshes rendered most recently first, then LIFO build order, since meshes actually visible in a map are typically loaded last
+		FAsyncDistanceFieldTask* Task = AsyncQueue.PopHighestPriorityTask();
 
 		if (Task)
 		{
@@ -1012,11 +1042,15 @@ FAsyncDistanceFieldTask::FAsyncDistanceFieldTask()
 	, DistanceFieldResolutionScale(0.0f)
 	, bGenerateDistanceFieldAsIfTwoSided(false)
 	, GeneratedVolumeData(nullptr)
+	, Priority(-FLT_MAX)
+	, DDCRequestHandle(0)
+	, bLoadedFromDDC(false)
 {
 }
 
 
 FDistanceFieldAsyncQueue::FDistanceFieldAsyncQueue() 
+	: LastPriorityUpdateTime(0.0)
 {
 #if WITH_EDITOR
 	MeshUtilities = NULL;
@@ -1048,10 +1082,10 @@ void FDistanceFieldAsyncQueue::AddTask(FAsyncDistanceFieldTask* Task)
 	// Also protects from creating too many thread pools when already parallel.
 	if (GUseAsyncDistanceFieldBuildQueue || !IsInGameThread())
 	{
-		TaskQueue.Push(Task);
-
 		// Logic protection when called from multiple threads
 		FScopeLock Lock(&CriticalSection);
+		PendingTasks.Add(Task);
+
 		if (!ThreadRunnable->IsRunning())
 		{
 			ThreadRunnable->Launch();
@@ -1118,6 +1152,99 @@ void FDistanceFieldAsyncQueue::BlockUntilBuildComplete(UStaticMesh* StaticMesh,
 	}
 }
 
+void FDistanceFieldAsyncQueue::CancelBuild(UStaticMesh* StaticMesh)
+{
+	check(IsInGameThread());
+
+	TArray<FAsyncDistanceFieldTask*> CancelledTasks;
+	{
+		FScopeLock Lock(&CriticalSection);
+		for (int32 TaskIndex = PendingTasks.Num() - 1; TaskIndex >= 0; TaskIndex--)
+		{
+			FAsyncDistanceFieldTask* Task = PendingTasks[TaskIndex];
+			if (Task->StaticMesh == StaticMesh || Task->GenerateSource == StaticMesh)
+			{
+				CancelledTasks.Add(Task);
+				PendingTasks.RemoveAt(TaskIndex);
+				ReferencedTasks.Remove(Task);
+			}
+		}
+	}
+
+	for (FAsyncDistanceFieldTask* Task : CancelledTasks)
+	{
+		if (Task->DDCRequestHandle != 0)
+		{
+			// Discard the results so the DDC can release the request
+			GetDerivedDataCacheRef().WaitAsynchronousCompletion(Task->DDCRequestHandle);
+			TArray<uint8> Junk;
+			GetDerivedDataCacheRef().GetAsynchronousResults(Task->DDCRequestHandle, Junk);
+		}
+
+		delete Task->GeneratedVolumeData;
+		delete Task;
+	}
+}
+
+FAsyncDistanceFieldTask* FDistanceFieldAsyncQueue::PopHighestPriorityTask()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	int32 BestIndex = INDEX_NONE;
+	for (int32 TaskIndex = PendingTasks.Num() - 1; TaskIndex >= 0; TaskIndex--)
+	{
+		if (BestIndex == INDEX_NONE || PendingTasks[TaskIndex]->Priority > PendingTasks[BestIndex]->Priority)
+		{
+			BestIndex = TaskIndex;
+		}
+	}
+
+	FAsyncDistanceFieldTask* Task = nullptr;
+	if (BestIndex != INDEX_NONE)
+	{
+		Task = PendingTasks[BestIndex];
+		PendingTasks.RemoveAt(BestIndex);
+	}
+	return Task;
+}
+
+void FDistanceFieldAsyncQueue::UpdateTaskPriorities()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FDistanceFieldAsyncQueue::UpdateTaskPriorities)
+
+	TMap<UStaticMesh*, float> LastRenderTimes;
+	{
+		FScopeLock Lock(&CriticalSection);
+		for (const FAsyncDistanceFieldTask* Task : PendingTasks)
+		{
+			LastRenderTimes.Add(Task->StaticMesh, -FLT_MAX);
+		}
+	}
+
+	if (LastRenderTimes.Num() == 0)
+	{
+		return;
+	}
+
+	for (const UStaticMeshComponent* Component : TObjectRange<UStaticMeshComponent>(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		if (float* LastRenderTime = LastRenderTimes.Find(Component->GetStaticMesh()))
+		{
+			*LastRenderTime = FMath::Max(*LastRenderTime, Component->GetLastRenderTimeOnScreen());
+		}
+	}
+
+	// Tasks may have been added or popped meanwhile, the new ones keep the lowest priority until the next update
+	FScopeLock Lock(&CriticalSection);
+	for (FAsyncDistanceFieldTask* Task : PendingTasks)
+	{
+		if (const float* LastRenderTime = LastRenderTimes.Find(Task->StaticMesh))
+		{
+			Task->Priority = *LastRenderTime;
+		}
+	}
+}
+
 void FDistanceFieldAsyncQueue::BlockUntilAllBuildsComplete()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FDistanceFieldAsyncQueue::BlockUntilAllBuildsComplete)
@@ -1132,8 +1259,25 @@ void FDistanceFieldAsyncQueue::BlockUntilAllBuildsComplete()
 void FDistanceFieldAsyncQueue::Build(FAsyncDistanceFieldTask* Task, FQueuedThreadPool& ThreadPool)
 {
 #if WITH_EDITOR
+	if (Task->DDCRequestHandle != 0)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDistanceFieldAsyncQueue::FetchDDC)
+
+		TArray<uint8> DerivedData;
+		GetDerivedDataCacheRef().WaitAsynchronousCompletion(Task->DDCRequestHandle);
+		const bool bHit = GetDerivedDataCacheRef().GetAsynchronousResults(Task->DDCRequestHandle, DerivedData);
+		Task->DDCRequestHandle = 0;
+
+		if (bHit)
+		{
+			FMemoryReader Ar(DerivedData, /*bIsPersistent=*/ true);
+			Ar << *Task->GeneratedVolumeData;
+			Task->bLoadedFromDDC = true;
+		}
+	}
+
 	// Editor 'force delete' can null any UObject pointers which are seen by reference collecting (eg FProperty or serialized)
-	if (Task->StaticMesh && Task->GenerateSource)
+	if (Task->StaticMesh && Task->GenerateSource && !Task->bLoadedFromDDC)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FDistanceFieldAsyncQueue::Build)
 
@@ -1179,11 +1323,14 @@ void FDistanceFieldAsyncQueue::ProcessAsyncTasks()
 
 	for (int TaskIndex = 0; TaskIndex < LocalCompletedTasks.Num(); TaskIndex++)
 	{
-		// We want to count each resource built from a DDC miss, so count each iteration of the loop separately.
+		// We want to count each resource built from a DDC miss or fetched asynchronously, so count each iteration of the loop separately.
 		COOK_STAT(auto Timer = DistanceFieldCookStats::UsageStats.TimeSyncWork());
 		FAsyncDistanceFieldTask* Task = LocalCompletedTasks[TaskIndex];
 
-		ReferencedTasks.Remove(Task);
+		{
+			FScopeLock Lock(&CriticalSection);
+			ReferencedTasks.Remove(Task);
+		}
 
 		// Editor 'force delete' can null any UObject pointers which are seen by reference collecting (eg FProperty or serialized)
 		if (Task->StaticMesh)
@@ -1211,6 +1358,11 @@ void FDistanceFieldAsyncQueue::ProcessAsyncTasks()
 			// Rendering thread may still be referencing the old one, use the deferred cleanup interface to delete it next frame when it is safe
 			BeginCleanup(OldVolumeData);
 
+			if (Task->bLoadedFromDDC)
+			{
+				COOK_STAT(Timer.AddHit(Task->GeneratedVolumeData->GetResourceSizeBytes()));
+			}
+			else
 			{
 				TArray<uint8> DerivedData;
 				// Save built distance field volume to DDC
@@ -1224,6 +1376,13 @@ void FDistanceFieldAsyncQueue::ProcessAsyncTasks()
 		delete Task;
 	}
 
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (GDistanceFieldBuildPriorityUpdatePeriod > 0.0f && CurrentTime - LastPriorityUpdateTime >= GDistanceFieldBuildPriorityUpdatePeriod)
+	{
+		LastPriorityUpdateTime = CurrentTime;
+		UpdateTaskPriorities();
+	}
+
 	if (ReferencedTasks.Num() > 0 && !ThreadRunnable->IsRunning())
 	{
 		ThreadRunnable->Launch();
@@ -101,6 +101,33 @@ static TAutoConsoleVariable<int32> CVarTimingMeasureModel(
 	TEXT(" 0: Same as stat unit (default);\n 1: Timestamp queries."),
 	ECVF_RenderThreadSafe | ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarModelFixedGPUCost(
+	TEXT("r.DynamicRes.ModelFixedGPUCost"),
+	1,
+	TEXT("Whether the GPU time of the frame outside of the passes rendered at dynamic resolution is predicted to stay the same\n")
+	TEXT("when changing resolution, rather than to scale with it. Needs timestamp queries (r.DynamicRes.GPUTimingMeasureMethod=1)."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPanicGPUTimeRatio(
+	TEXT("r.DynamicRes.PanicGPUTimeRatio"),
+	0.0f,
+	TEXT("If above 0, a single frame with a GPU time over r.DynamicRes.FrameTimeBudget times this ratio drops the resolution immediately,\n")
+	TEXT("instead of waiting for r.DynamicRes.MaxConsecutiveOverbudgetGPUFrameCount frames. Frames ignored as outliers don't count."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPanicIncreaseHoldCount(
+	TEXT("r.DynamicRes.PanicIncreaseHoldCount"),
+	0,
+	TEXT("Number of heuristic refreshes, about one per frame, during which the resolution isn't increased after dropping because over GPU budget."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGPUTimeTrendWeight(
+	TEXT("r.DynamicRes.GPUTimeTrendWeight"),
+	0.0f,
+	TEXT("Weight of the change of GPU cost per pixel between the last two frames, extrapolated to the next frame, so resolution\n")
+	TEXT("drops before the GPU goes over budget when the cost of the scene ramps up. 0 disables it."),
+	ECVF_RenderThreadSafe | ECVF_Default);
+
 static TAutoConsoleVariable<float> CVarCPUBoundScreenPercentage(
 	TEXT("r.DynamicRes.CPUBoundScreenPercentage"),
 	100,
@@ -136,6 +163,7 @@ void FDynamicResolutionHeuristicProxy::ResetInternal()
 	History.Reset();
 
 	NumberOfFramesSinceScreenPercentageChange = 0;
+	PanicIncreaseHoldRemainingCount = 0;
 	CurrentFrameResolutionFraction = 1.0f;
 
 	// Ignore previous frame timings.
@@ -218,6 +246,8 @@ void FDynamicResolutionHeuristicProxy::RefreshCurentFrameResolutionFraction_Rend
 		const int32 MaxConsecutiveOverbudgetGPUFrameCount = FMath::Max(CVarMaxConsecutiveOverbudgetGPUFrameCount.GetValueOnRenderThread(), 2);
 		
 		const float OutLierTimeThreshold = FrameTimeBudgetMs * CVarOutlierThreshold.GetValueOnRenderThread();
+		const float PanicGPUTimeThreshold = FrameTimeBudgetMs * CVarPanicGPUTimeRatio.GetValueOnRenderThread();
+		const bool bModelFixedGPUCost = CVarModelFixedGPUCost.GetValueOnRenderThread() != 0;
 
 		NewFrameResolutionFraction = 0.0f;
 
@@ -313,6 +343,12 @@ void FDynamicResolutionHeuristicProxy::RefreshCurentFrameResolutionFraction_Rend
 				continue;
 			}
 
+			// A spike on the latest frame is handled like consecutive over budget frames, by dropping the resolution right away.
+			if (bHasOverbudgetGPU && FrameCount == 0 && PanicGPUTimeThreshold > 0.0f && FrameEntry.TotalFrameGPUBusyTimeMs > PanicGPUTimeThreshold)
+			{
+				bCaryOnBrowsingFrameHistory = false;
+			}
+
 			float SuggestedResolutionFraction = 1.0f;
 
 			// If have reliable GPU times, or guess there is not GPU bubbles -> estimate the suggested resolution fraction that could have been used.
@@ -326,12 +362,20 @@ void FDynamicResolutionHeuristicProxy::RefreshCurentFrameResolutionFraction_Rend
 				// This assumption means we may drop ResolutionFraction lower than needed, or be slower to increase
 				// resolution.
 				//
-				// TODO: If we have RHI guarantee of frame timing association, we could make an estimation of B
-				// At resolution change that happen every N frames, amortized over time and scaled down as the
-				// standard variation of the GPU timing over non resolution changing frames increases.
-				SuggestedResolutionFraction = (
-					FMath::Sqrt(TargetedGPUBusyTimeMs / FrameEntry.TotalFrameGPUBusyTimeMs)
-					* FrameEntry.ResolutionFraction);
+				// When timestamp queries measure the passes rendered at dynamic resolution, B is the rest of the frame.
+				const float ScalingGPUBusyTimeMs = FrameEntry.GlobalDynamicResolutionTimeMs;
+				if (bModelFixedGPUCost && ScalingGPUBusyTimeMs > 0.0f && ScalingGPUBusyTimeMs < FrameEntry.TotalFrameGPUBusyTimeMs)
+				{
+					const float FixedGPUBusyTimeMs = FrameEntry.TotalFrameGPUBusyTimeMs - ScalingGPUBusyTimeMs;
+					const float ScalingGPUBudgetMs = FMath::Max(TargetedGPUBusyTimeMs - FixedGPUBusyTimeMs, 0.0f);
+					SuggestedResolutionFraction = FMath::Sqrt(ScalingGPUBudgetMs / ScalingGPUBusyTimeMs) * FrameEntry.ResolutionFraction;
+				}
+				else
+				{
+					SuggestedResolutionFraction = (
+						FMath::Sqrt(TargetedGPUBusyTimeMs / FrameEntry.TotalFrameGPUBusyTimeMs)
+						* FrameEntry.ResolutionFraction);
+				}
 			}
 			else if (FrameEntry.ResolutionFraction > CPUBoundResolutionFraction)
 			{
@@ -355,6 +399,30 @@ void FDynamicResolutionHeuristicProxy::RefreshCurentFrameResolutionFraction_Rend
 
 		NewFrameResolutionFraction /= TotalWeight;
 
+		// Extrapolate how the cost per pixel changes on the next frame, the GPU time scaling with ResolutionFraction^2.
+		const float GPUTimeTrendWeight = CVarGPUTimeTrendWeight.GetValueOnRenderThread();
+		if (GPUTimeTrendWeight > 0.0f && FrameCount > 0)
+		{
+			const FrameHistoryEntry* LatestFrameEntries[2] = {};
+			for (int32 TrendFrameId = 0, TrendFrameCount = 0; TrendFrameId < HistorySize && TrendFrameCount < 2; TrendFrameId++)
+			{
+				const FrameHistoryEntry& FrameEntry = GetPreviousFrameEntry(TrendFrameId);
+				if (FrameEntry.HasGPUTimings() && !FrameEntry.bGPUTimingsHaveCPUBubbles)
+				{
+					LatestFrameEntries[TrendFrameCount++] = &FrameEntry;
+				}
+			}
+
+			if (LatestFrameEntries[1] && LatestFrameEntries[1]->TotalFrameGPUBusyTimeMs > 0.0f)
+			{
+				const float LatestCost = LatestFrameEntries[0]->TotalFrameGPUBusyTimeMs / FMath::Square(LatestFrameEntries[0]->ResolutionFraction);
+				const float PreviousCost = LatestFrameEntries[1]->TotalFrameGPUBusyTimeMs / FMath::Square(LatestFrameEntries[1]->ResolutionFraction);
+				const float CostTrend = FMath::Clamp(1.0f + GPUTimeTrendWeight * (LatestCost / PreviousCost - 1.0f), 0.5f, 2.0f);
+
+				NewFrameResolutionFraction /= FMath::Sqrt(CostTrend);
+			}
+		}
+
 		// If immediate previous frames where over budget, react immediately.
 		bGPUOverbugetPanic = FrameCount > 0 && ConsecutiveOverbudgetGPUFramCount == FrameCount;
 
@@ -362,6 +430,7 @@ void FDynamicResolutionHeuristicProxy::RefreshCurentFrameResolutionFraction_Rend
 		if (bGPUOverbugetPanic)
 		{
 			HistorySize = 0;
+			PanicIncreaseHoldRemainingCount = CVarPanicIncreaseHoldCount.GetValueOnRenderThread();
 		}
 		// If not immediately over budget, refine the new resolution fraction.
 		else
@@ -379,6 +448,13 @@ void FDynamicResolutionHeuristicProxy::RefreshCurentFrameResolutionFraction_Rend
 				}
 			}
 
+			// Don't scale the resolution back up right after a panic, the GPU spike may not be over
+			if (PanicIncreaseHoldRemainingCount > 0)
+			{
+				PanicIncreaseHoldRemainingCount--;
+				NewFrameResolutionFraction = FMath::Min(NewFrameResolutionFraction, CurrentFrameResolutionFraction);
+			}
+
 			// If scaling the resolution up, amortize to avoid oscillations.
 			if (NewFrameResolutionFraction > CurrentFrameResolutionFraction)
 			{
@@ -0,0 +1,304 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/ActorRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+DECLARE_CYCLE_STAT(TEXT("ActorRegistry Query"), STAT_ActorRegistryQuery, STATGROUP_Game);
+
+bool UActorRegistrySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Editor worlds add and remove actors through paths that do not go through SpawnActor, so only game worlds are tracked
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UActorRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UWorld* World = GetWorld();
+	check(World);
+
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UActorRegistrySubsystem::OnActorSpawned));
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UActorRegistrySubsystem::OnLevelRemovedFromWorld);
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UActorRegistrySubsystem::OnPreGarbageCollect);
+
+	// Subsystems are created at the start of InitWorld, only the persistent level is in the world at this point.
+	// Streaming levels are added by UWorld::AddToWorld as they start associating.
+	if (World->PersistentLevel)
+	{
+		AddLevelActors(World->PersistentLevel);
+	}
+}
+
+void UActorRegistrySubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+
+	Buckets.Empty();
+	BucketIndexByClass.Empty();
+	ActorLocations.Empty();
+	MatchingBucketsCache.Empty();
+
+	Super::Deinitialize();
+}
+
+void UActorRegistrySubsystem::AddActor(AActor* Actor)
+{
+	if (Actor == nullptr || Actor->IsPendingKill() || ActorLocations.Contains(Actor))
+	{
+		return;
+	}
+
+	UClass* ActorClass = Actor->GetClass();
+	int32& BucketIndex = BucketIndexByClass.FindOrAdd(ActorClass, INDEX_NONE);
+	if (BucketIndex == INDEX_NONE)
+	{
+		BucketIndex = Buckets.Num();
+		Buckets.AddDefaulted_GetRef().Class = ActorClass;
+		MatchingBucketsCache.Reset();
+	}
+
+	FClassBucket& Bucket = Buckets[BucketIndex];
+	ActorLocations.Add(Actor, { BucketIndex, Bucket.Actors.Add(Actor) });
+}
+
+void UActorRegistrySubsystem::RemoveActor(AActor* Actor)
+{
+	FActorLocation Location;
+	if (!ActorLocations.RemoveAndCopyValue(Actor, Location))
+	{
+		return;
+	}
+
+	TArray<AActor*>& BucketActors = Buckets[Location.BucketIndex].Actors;
+	BucketActors.RemoveAtSwap(Location.ActorIndex, 1, false);
+	if (Location.ActorIndex < BucketActors.Num())
+	{
+		ActorLocations.FindChecked(BucketActors[Location.ActorIndex]).ActorIndex = Location.ActorIndex;
+	}
+}
+
+void UActorRegistrySubsystem::AddLevelActors(ULevel* Level)
+{
+	if (Level)
+	{
+		for (AActor* Actor : Level->Actors)
+		{
+			AddActor(Actor);
+		}
+	}
+}
+
+void UActorRegistrySubsystem::RemoveLevelActors(ULevel* Level)
+{
+	if (Level)
+	{
+		for (AActor* Actor : Level->Actors)
+		{
+			if (Actor)
+			{
+				RemoveActor(Actor);
+			}
+		}
+	}
+}
+
+void UActorRegistrySubsystem::OnActorSpawned(AActor* Actor)
+{
+	AddActor(Actor);
+}
+
+void UActorRegistrySubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	if (Level)
+	{
+		RemoveLevelActors(Level);
+	}
+	else
+	{
+		// A null level means every level was removed
+		Buckets.Reset();
+		BucketIndexByClass.Reset();
+		ActorLocations.Reset();
+		MatchingBucketsCache.Reset();
+	}
+}
+
+void UActorRegistrySubsystem::OnPreGarbageCollect()
+{
+	Compact();
+}
+
+void UActorRegistrySubsystem::Compact()
+{
+	// Actors that are destroyed go through RemoveActor, this catches the ones that were marked pending kill some other way
+	for (FClassBucket& Bucket : Buckets)
+	{
+		for (int32 Index = Bucket.Actors.Num() - 1; Index >= 0; --Index)
+		{
+			if (Bucket.Actors[Index]->IsPendingKill())
+			{
+				RemoveActor(Bucket.Actors[Index]);
+			}
+		}
+	}
+
+	// Empty buckets may be for classes that are about to be collected, and their class pointer is dereferenced when building queries
+	const bool bHasEmptyBuckets = Buckets.ContainsByPredicate([](const FClassBucket& Bucket) { return Bucket.Actors.Num() == 0; });
+	if (bHasEmptyBuckets)
+	{
+		Buckets.RemoveAll([](const FClassBucket& Bucket) { return Bucket.Actors.Num() == 0; });
+
+		BucketIndexByClass.Reset();
+		for (int32 BucketIndex = 0; BucketIndex < Buckets.Num(); ++BucketIndex)
+		{
+			BucketIndexByClass.Add(Buckets[BucketIndex].Class, BucketIndex);
+			for (AActor* Actor : Buckets[BucketIndex].Actors)
+			{
+				ActorLocations.FindChecked(Actor).BucketIndex = BucketIndex;
+			}
+		}
+
+		MatchingBucketsCache.Reset();
+	}
+}
+
+const TArray<int32>& UActorRegistrySubsystem::GetMatchingBuckets(UClass* ActorClass) const
+{
+	if (const TArray<int32>* Cached = MatchingBucketsCache.Find(ActorClass))
+	{
+		return *Cached;
+	}
+
+	TArray<int32>& Matching = MatchingBucketsCache.Add(ActorClass);
+	for (int32 BucketIndex = 0; BucketIndex < Buckets.Num(); ++BucketIndex)
+	{
+		if (Buckets[BucketIndex].Class->IsChildOf(ActorClass))
+		{
+			Matching.Add(BucketIndex);
+		}
+	}
+	return Matching;
+}
+
+bool UActorRegistrySubsystem::IsLevelActive(const ULevel* Level)
+{
+	const bool bIsLevelVisibleOrAssociating = (Level->bIsVisible && !Level->bIsBeingRemoved) || Level->bIsAssociatingLevel || Level->bIsDisassociatingLevel;
+
+	const FLevelCollection* const ActorLevelCollection = Level->GetCachedLevelCollection();
+	const FLevelCollection* const ActiveLevelCollection = Level->OwningWorld ? Level->OwningWorld->GetActiveLevelCollection() : nullptr;
+
+	const bool bIsCurrentLevelCollectionTicking = !ActiveLevelCollection || (ActorLevelCollection == ActiveLevelCollection);
+	const bool bIsLevelCollectionNullOrStatic = !ActorLevelCollection || ActorLevelCollection->GetType() == ELevelCollectionType::StaticLevels;
+
+	return bIsLevelVisibleOrAssociating && (bIsCurrentLevelCollectionTicking || bIsLevelCollectionNullOrStatic);
+}
+
+void UActorRegistrySubsystem::ForEachActorOfClass(TSubclassOf<AActor> ActorClass, TFunctionRef<bool(AActor*)> Operation) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_ActorRegistryQuery);
+
+	if (!ActorClass)
+	{
+		return;
+	}
+
+	// Actors of a level are mostly spawned together, so remember the last level checked rather than evaluating it for every actor
+	const ULevel* LastLevel = nullptr;
+	bool bLastLevelActive = false;
+
+	for (const int32 BucketIndex : GetMatchingBuckets(ActorClass))
+	{
+		for (AActor* Actor : Buckets[BucketIndex].Actors)
+		{
+			if (Actor->IsPendingKill())
+			{
+				continue;
+			}
+
+			const ULevel* Level = Actor->GetLevel();
+			if (Level != LastLevel)
+			{
+				LastLevel = Level;
+				bLastLevelActive = Level && IsLevelActive(Level);
+			}
+
+			if (bLastLevelActive && !Operation(Actor))
+			{
+				return;
+			}
+		}
+	}
+}
+
+void UActorRegistrySubsystem::GetActorsOfClass(TSubclassOf<AActor> ActorClass, TArray<AActor*>& OutActors) const
+{
+	if (!ActorClass)
+	{
+		return;
+	}
+
+	int32 NumMatching = 0;
+	for (const int32 BucketIndex : GetMatchingBuckets(ActorClass))
+	{
+		NumMatching += Buckets[BucketIndex].Actors.Num();
+	}
+	OutActors.Reserve(OutActors.Num() + NumMatching);
+
+	ForEachActorOfClass(ActorClass, [&OutActors](AActor* Actor)
+	{
+		OutActors.Add(Actor);
+		return true;
+	});
+}
+
+int32 UActorRegistrySubsystem::GetNumActorsOfClass(TSubclassOf<AActor> ActorClass) const
+{
+	int32 NumMatching = 0;
+	if (ActorClass)
+	{
+		for (const int32 BucketIndex : GetMatchingBuckets(ActorClass))
+		{
+			NumMatching += Buckets[BucketIndex].Actors.Num();
+		}
+	}
+	return NumMatching;
+}
+
+void UActorRegistrySubsystem::Dump() const
+{
+	UE_LOG(LogSpawn, Log, TEXT("------- %d Registered Actors in %d Class Buckets -------"), ActorLocations.Num(), Buckets.Num());
+	for (const FClassBucket& Bucket : Buckets)
+	{
+		UE_LOG(LogSpawn, Log, TEXT("%s: %d"), *Bucket.Class->GetName(), Bucket.Actors.Num());
+	}
+}
+
+static void OnDumpActorRegistry(UWorld* World)
+{
+	if (UActorRegistrySubsystem* Registry = UWorld::GetSubsystem<UActorRegistrySubsystem>(World))
+	{
+		Registry->Dump();
+	}
+}
+
+FAutoConsoleCommandWithWorld DumpActorRegistryConsoleCommand(
+	TEXT("world.ActorRegistry.Dump"),
+	TEXT("Dumps the number of registered actors per class for the current world."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(OnDumpActorRegistry)
+	);
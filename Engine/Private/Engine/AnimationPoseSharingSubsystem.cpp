@@ -0,0 +1,365 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/AnimationPoseSharingSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/SkeletalMesh.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Animation/AnimSequenceBase.h"
+#include "HAL/IConsoleManager.h"
+#include "EngineLogs.h"
+
+DECLARE_CYCLE_STAT(TEXT("Animation Pose Sharing Update"), STAT_AnimationPoseSharingUpdate, STATGROUP_Anim);
+
+UAnimationPoseSharingSubsystem::UAnimationPoseSharingSubsystem()
+	: PromotionDistance(1500.f)
+	, UpdatePeriod(0.25f)
+	, NextUpdateIndex(0)
+	, PendingUpdates(0.f)
+{
+}
+
+bool UAnimationPoseSharingSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UAnimationPoseSharingSubsystem::Deinitialize()
+{
+	for (FFollower& Follower : Followers)
+	{
+		if (!Follower.bPromoted)
+		{
+			DetachFollower(Follower);
+		}
+	}
+	Followers.Empty();
+	FollowerIndexByComponent.Empty();
+
+	for (const FSetup& Setup : Setups)
+	{
+		if (AActor* LeaderActor = Setup.LeaderActor.Get())
+		{
+			LeaderActor->Destroy();
+		}
+	}
+	Setups.Empty();
+
+	Super::Deinitialize();
+}
+
+int32 UAnimationPoseSharingSubsystem::RegisterSetup(USkeletalMesh* SkeletalMesh, const TArray<UAnimSequenceBase*>& StateAnimations, int32 NumTimeBuckets)
+{
+	UWorld* World = GetWorld();
+	if (!ensureMsgf(World && SkeletalMesh && StateAnimations.Num() > 0, TEXT("RegisterSetup needs a world, a skeletal mesh and at least one state animation")))
+	{
+		return INDEX_NONE;
+	}
+
+	NumTimeBuckets = FMath::Max(NumTimeBuckets, 1);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* LeaderActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+	if (LeaderActor == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 SetupIndex = Setups.AddDefaulted();
+	FSetup& Setup = Setups[SetupIndex];
+	Setup.LeaderActor = LeaderActor;
+	Setup.NumStates = StateAnimations.Num();
+	Setup.NumTimeBuckets = NumTimeBuckets;
+	Setup.Leaders.Reserve(Setup.NumStates * NumTimeBuckets);
+
+	for (UAnimSequenceBase* Animation : StateAnimations)
+	{
+		for (int32 TimeBucket = 0; TimeBucket < NumTimeBuckets; ++TimeBucket)
+		{
+			// Leaders are never rendered, their pose is only read by the followers
+			USkeletalMeshComponent* Leader = NewObject<USkeletalMeshComponent>(LeaderActor);
+			Leader->SetSkeletalMesh(SkeletalMesh);
+			Leader->SetHiddenInGame(true);
+			Leader->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			Leader->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+			if (LeaderActor->GetRootComponent() == nullptr)
+			{
+				LeaderActor->SetRootComponent(Leader);
+			}
+			Leader->RegisterComponent();
+
+			if (Animation)
+			{
+				Leader->PlayAnimation(Animation, true);
+				Leader->SetPosition(Animation->GetPlayLength() * TimeBucket / NumTimeBuckets, false);
+			}
+
+			// Ticked once it has followers
+			Leader->SetComponentTickEnabled(false);
+
+			Setup.Leaders.Add({ Leader, 0 });
+		}
+	}
+
+	return SetupIndex;
+}
+
+void UAnimationPoseSharingSubsystem::AddFollower(int32 SetupIndex, USkeletalMeshComponent* Component)
+{
+	if (Component == nullptr || !ensureMsgf(Setups.IsValidIndex(SetupIndex), TEXT("AddFollower called with unregistered setup %d"), SetupIndex))
+	{
+		return;
+	}
+
+	RemoveFollower(Component);
+
+	const FSetup& Setup = Setups[SetupIndex];
+
+	FFollower& Follower = Followers.AddDefaulted_GetRef();
+	Follower.Component = Component;
+	Follower.SetupIndex = SetupIndex;
+	Follower.StateIndex = 0;
+	Follower.TimeBucket = GetTypeHash(Component) % Setup.NumTimeBuckets;
+	Follower.bPromoted = false;
+	FollowerIndexByComponent.Add(Component, Followers.Num() - 1);
+
+	AttachFollower(Follower);
+}
+
+void UAnimationPoseSharingSubsystem::RemoveFollower(USkeletalMeshComponent* Component)
+{
+	if (const int32* FollowerIndex = FollowerIndexByComponent.Find(Component))
+	{
+		RemoveFollowerAt(*FollowerIndex);
+	}
+}
+
+void UAnimationPoseSharingSubsystem::RemoveFollowerAt(int32 FollowerIndex)
+{
+	FFollower& Follower = Followers[FollowerIndex];
+	if (!Follower.bPromoted)
+	{
+		DetachFollower(Follower);
+	}
+
+	FollowerIndexByComponent.Remove(Follower.Component);
+	Followers.RemoveAtSwap(FollowerIndex, 1, false);
+	if (FollowerIndex < Followers.Num())
+	{
+		FollowerIndexByComponent.FindChecked(Followers[FollowerIndex].Component) = FollowerIndex;
+	}
+}
+
+void UAnimationPoseSharingSubsystem::SetFollowerState(USkeletalMeshComponent* Component, int32 StateIndex, float StateTime)
+{
+	const int32* FollowerIndex = FollowerIndexByComponent.Find(Component);
+	if (FollowerIndex == nullptr)
+	{
+		return;
+	}
+
+	FFollower& Follower = Followers[*FollowerIndex];
+	const FSetup& Setup = Setups[Follower.SetupIndex];
+	if (!ensureMsgf(StateIndex >= 0 && StateIndex < Setup.NumStates, TEXT("SetFollowerState called with state %d, the setup has %d states"), StateIndex, Setup.NumStates))
+	{
+		return;
+	}
+
+	int32 TimeBucket = Follower.TimeBucket;
+	if (StateTime >= 0.f)
+	{
+		// Leaders of a state play the same looping animation, so the distance between times wraps around its length
+		float BestDistance = MAX_flt;
+		for (int32 Bucket = 0; Bucket < Setup.NumTimeBuckets; ++Bucket)
+		{
+			const USkeletalMeshComponent* Leader = Setup.Leaders[StateIndex * Setup.NumTimeBuckets + Bucket].Component.Get();
+			UAnimSequenceBase* Animation = Leader ? Cast<UAnimSequenceBase>(Leader->AnimationData.AnimToPlay) : nullptr;
+			if (Animation == nullptr)
+			{
+				continue;
+			}
+
+			const float Length = Animation->GetPlayLength();
+			float Distance = FMath::Abs(Leader->GetPosition() - StateTime);
+			if (Length > 0.f)
+			{
+				Distance = FMath::Fmod(Distance, Length);
+				Distance = FMath::Min(Distance, Length - Distance);
+			}
+
+			if (Distance < BestDistance)
+			{
+				BestDistance = Distance;
+				TimeBucket = Bucket;
+			}
+		}
+	}
+
+	if (StateIndex == Follower.StateIndex && TimeBucket == Follower.TimeBucket)
+	{
+		return;
+	}
+
+	if (Follower.bPromoted)
+	{
+		Follower.StateIndex = StateIndex;
+		Follower.TimeBucket = TimeBucket;
+	}
+	else
+	{
+		DetachFollower(Follower);
+		Follower.StateIndex = StateIndex;
+		Follower.TimeBucket = TimeBucket;
+		AttachFollower(Follower);
+	}
+}
+
+void UAnimationPoseSharingSubsystem::AttachFollower(FFollower& Follower)
+{
+	FLeader& Leader = Setups[Follower.SetupIndex].Leaders[GetLeaderIndex(Follower)];
+	USkeletalMeshComponent* LeaderComponent = Leader.Component.Get();
+	USkeletalMeshComponent* FollowerComponent = Follower.Component.Get();
+	if (LeaderComponent == nullptr || FollowerComponent == nullptr)
+	{
+		return;
+	}
+
+	if (Leader.NumFollowers++ == 0)
+	{
+		LeaderComponent->SetComponentTickEnabled(true);
+	}
+
+	FollowerComponent->SetMasterPoseComponent(LeaderComponent);
+}
+
+void UAnimationPoseSharingSubsystem::DetachFollower(FFollower& Follower)
+{
+	FLeader& Leader = Setups[Follower.SetupIndex].Leaders[GetLeaderIndex(Follower)];
+	USkeletalMeshComponent* LeaderComponent = Leader.Component.Get();
+	if (LeaderComponent == nullptr)
+	{
+		return;
+	}
+
+	// The follower may be gone already, the leader still has to stop counting it
+	if (USkeletalMeshComponent* FollowerComponent = Follower.Component.Get())
+	{
+		FollowerComponent->SetMasterPoseComponent(nullptr);
+	}
+
+	if (Leader.NumFollowers > 0 && --Leader.NumFollowers == 0)
+	{
+		LeaderComponent->SetComponentTickEnabled(false);
+	}
+}
+
+ETickableTickType UAnimationPoseSharingSubsystem::GetTickableTickType() const
+{
+	// The CDO of this should never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UAnimationPoseSharingSubsystem::IsTickable() const
+{
+	return Followers.Num() > 0;
+}
+
+void UAnimationPoseSharingSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AnimationPoseSharingUpdate);
+
+	UWorld* MyWorld = GetWorld();
+	if (MyWorld == nullptr || Followers.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	if (PromotionDistance > 0.f)
+	{
+		for (FConstPlayerControllerIterator It = MyWorld->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (const APlayerController* PlayerController = It->Get())
+			{
+				FVector ViewLocation;
+				FRotator ViewRotation;
+				PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+				ViewLocations.Add(ViewLocation);
+			}
+		}
+	}
+	const float PromotionDistanceSquared = FMath::Square(PromotionDistance);
+
+	// Evaluate a slice of the list every frame so that the whole list is covered once per UpdatePeriod
+	PendingUpdates += (UpdatePeriod > 0.f) ? Followers.Num() * FMath::Min(DeltaTime / UpdatePeriod, 1.f) : Followers.Num();
+	int32 NumToUpdate = FMath::Min(FMath::FloorToInt(PendingUpdates), Followers.Num());
+	PendingUpdates -= NumToUpdate;
+
+	while (NumToUpdate-- > 0 && Followers.Num() > 0)
+	{
+		if (NextUpdateIndex >= Followers.Num())
+		{
+			NextUpdateIndex = 0;
+		}
+
+		FFollower& Follower = Followers[NextUpdateIndex];
+		const USkeletalMeshComponent* Component = Follower.Component.Get();
+		if (Component == nullptr)
+		{
+			RemoveFollowerAt(NextUpdateIndex);
+			continue;
+		}
+
+		const FVector Location = Component->GetComponentLocation();
+		const bool bShouldPromote = ViewLocations.ContainsByPredicate([&Location, PromotionDistanceSquared](const FVector& ViewLocation)
+		{
+			return FVector::DistSquared(Location, ViewLocation) < PromotionDistanceSquared;
+		});
+
+		if (bShouldPromote != Follower.bPromoted)
+		{
+			if (bShouldPromote)
+			{
+				DetachFollower(Follower);
+			}
+			else
+			{
+				AttachFollower(Follower);
+			}
+			Follower.bPromoted = bShouldPromote;
+		}
+		++NextUpdateIndex;
+	}
+}
+
+void UAnimationPoseSharingSubsystem::Dump() const
+{
+	UE_LOG(LogAnimation, Log, TEXT("------- %d Pose Sharing Followers in %d Setups -------"), Followers.Num(), Setups.Num());
+	for (int32 SetupIndex = 0; SetupIndex < Setups.Num(); ++SetupIndex)
+	{
+		const FSetup& Setup = Setups[SetupIndex];
+		UE_LOG(LogAnimation, Log, TEXT("Setup %d: %d states, %d time buckets"), SetupIndex, Setup.NumStates, Setup.NumTimeBuckets);
+		for (int32 LeaderIndex = 0; LeaderIndex < Setup.Leaders.Num(); ++LeaderIndex)
+		{
+			UE_LOG(LogAnimation, Log, TEXT("  State %d Bucket %d: %d followers"), LeaderIndex / Setup.NumTimeBuckets, LeaderIndex % Setup.NumTimeBuckets, Setup.Leaders[LeaderIndex].NumFollowers);
+		}
+	}
+}
+
+static void OnDumpAnimationPoseSharing(UWorld* World)
+{
+	if (UAnimationPoseSharingSubsystem* PoseSharing = UWorld::GetSubsystem<UAnimationPoseSharingSubsystem>(World))
+	{
+		PoseSharing->Dump();
+	}
+}
+
+FAutoConsoleCommandWithWorld DumpAnimationPoseSharingConsoleCommand(
+	TEXT("a.PoseSharing.Dump"),
+	TEXT("Dumps the pose sharing setups of the current world and the number of followers of each leader."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(OnDumpAnimationPoseSharing)
+	);
@@ -0,0 +1,262 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/ProjectileSimulationSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "CollisionQueryParams.h"
+
+DECLARE_CYCLE_STAT(TEXT("Lightweight Projectiles Resolve Impacts"), STAT_LightweightProjectilesResolveImpacts, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Lightweight Projectiles Integrate"), STAT_LightweightProjectilesIntegrate, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Lightweight Projectiles Request Traces"), STAT_LightweightProjectilesRequestTraces, STATGROUP_Game);
+
+bool UProjectileSimulationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UProjectileSimulationSubsystem::Deinitialize()
+{
+	ClearProjectiles();
+	Types.Empty();
+
+	Super::Deinitialize();
+}
+
+int32 UProjectileSimulationSubsystem::RegisterProjectileType(const FLightweightProjectileType& Type)
+{
+	return Types.Add(Type);
+}
+
+void UProjectileSimulationSubsystem::FireProjectile(int32 TypeIndex, const FVector& Location, const FVector& Velocity, AActor* Instigator)
+{
+	if (!ensureMsgf(Types.IsValidIndex(TypeIndex), TEXT("FireProjectile called with unregistered projectile type %d"), TypeIndex))
+	{
+		return;
+	}
+
+	const FLightweightProjectileType& Type = Types[TypeIndex];
+
+	PositionX.Add(Location.X);
+	PositionY.Add(Location.Y);
+	PositionZ.Add(Location.Z);
+	VelocityX.Add(Velocity.X);
+	VelocityY.Add(Velocity.Y);
+	VelocityZ.Add(Velocity.Z);
+	GravityScales.Add(Type.GravityScale);
+	LifeRemaining.Add(Type.LifeSpan);
+
+	StepStart.Add(Location);
+	TraceHandles.AddDefaulted();
+	TypeIndices.Add(TypeIndex);
+	Instigators.Add(Instigator);
+}
+
+void UProjectileSimulationSubsystem::ClearProjectiles()
+{
+	PositionX.Reset();
+	PositionY.Reset();
+	PositionZ.Reset();
+	VelocityX.Reset();
+	VelocityY.Reset();
+	VelocityZ.Reset();
+	GravityScales.Reset();
+	LifeRemaining.Reset();
+
+	StepStart.Reset();
+	TraceHandles.Reset();
+	TypeIndices.Reset();
+	Instigators.Reset();
+}
+
+void UProjectileSimulationSubsystem::RemoveProjectileAtSwap(int32 Index)
+{
+	PositionX.RemoveAtSwap(Index, 1, false);
+	PositionY.RemoveAtSwap(Index, 1, false);
+	PositionZ.RemoveAtSwap(Index, 1, false);
+	VelocityX.RemoveAtSwap(Index, 1, false);
+	VelocityY.RemoveAtSwap(Index, 1, false);
+	VelocityZ.RemoveAtSwap(Index, 1, false);
+	GravityScales.RemoveAtSwap(Index, 1, false);
+	LifeRemaining.RemoveAtSwap(Index, 1, false);
+
+	StepStart.RemoveAtSwap(Index, 1, false);
+	TraceHandles.RemoveAtSwap(Index, 1, false);
+	TypeIndices.RemoveAtSwap(Index, 1, false);
+	Instigators.RemoveAtSwap(Index, 1, false);
+}
+
+ETickableTickType UProjectileSimulationSubsystem::GetTickableTickType() const
+{
+	// The CDO of this should never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UProjectileSimulationSubsystem::IsTickable() const
+{
+	return PositionX.Num() > 0;
+}
+
+void UProjectileSimulationSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	ResolveImpacts(World);
+	RemoveExpired();
+	Integrate(DeltaTime, World->GetGravityZ());
+	RequestTraces(World);
+}
+
+void UProjectileSimulationSubsystem::ResolveImpacts(UWorld* World)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LightweightProjectilesResolveImpacts);
+
+	struct FImpact
+	{
+		FHitResult Hit;
+		FVector Velocity;
+		int32 TypeIndex;
+		TWeakObjectPtr<AActor> Instigator;
+	};
+	TArray<FImpact> Impacts;
+
+	// Projectiles are removed while iterating, impacts are reported afterwards so that callbacks may fire new projectiles
+	FTraceDatum TraceDatum;
+	for (int32 Index = PositionX.Num() - 1; Index >= 0; --Index)
+	{
+		if (!World->QueryTraceData(TraceHandles[Index], TraceDatum))
+		{
+			// Fired this frame, or the trace could not be queued
+			continue;
+		}
+
+		if (TraceDatum.OutHits.Num() > 0 && TraceDatum.OutHits[0].bBlockingHit)
+		{
+			FImpact& Impact = Impacts.AddDefaulted_GetRef();
+			Impact.Hit = TraceDatum.OutHits[0];
+			Impact.Velocity = FVector(VelocityX[Index], VelocityY[Index], VelocityZ[Index]);
+			Impact.TypeIndex = TypeIndices[Index];
+			Impact.Instigator = Instigators[Index];
+
+			RemoveProjectileAtSwap(Index);
+		}
+	}
+
+	for (const FImpact& Impact : Impacts)
+	{
+		// Copied, a callback may register new types
+		const FLightweightProjectileType Type = Types[Impact.TypeIndex];
+		Type.OnImpact.ExecuteIfBound(Impact.Hit, Impact.Velocity);
+
+		if (Type.ImpactActorClass)
+		{
+			AActor* InstigatorActor = Impact.Instigator.Get();
+
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.Owner = InstigatorActor;
+			SpawnParameters.Instigator = Cast<APawn>(InstigatorActor);
+			SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			World->SpawnActor<AActor>(Type.ImpactActorClass, Impact.Hit.ImpactPoint, Impact.Hit.ImpactNormal.Rotation(), SpawnParameters);
+		}
+	}
+}
+
+void UProjectileSimulationSubsystem::RemoveExpired()
+{
+	for (int32 Index = LifeRemaining.Num() - 1; Index >= 0; --Index)
+	{
+		if (LifeRemaining[Index] <= 0.f)
+		{
+			RemoveProjectileAtSwap(Index);
+		}
+	}
+}
+
+void UProjectileSimulationSubsystem::Integrate(float DeltaTime, float GravityZ)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LightweightProjectilesIntegrate);
+
+	const int32 NumProjectiles = PositionX.Num();
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		StepStart[Index] = FVector(PositionX[Index], PositionY[Index], PositionZ[Index]);
+	}
+
+	float* RESTRICT PosX = PositionX.GetData();
+	float* RESTRICT PosY = PositionY.GetData();
+	float* RESTRICT PosZ = PositionZ.GetData();
+	const float* RESTRICT VelX = VelocityX.GetData();
+	const float* RESTRICT VelY = VelocityY.GetData();
+	float* RESTRICT VelZ = VelocityZ.GetData();
+	const float* RESTRICT Gravity = GravityScales.GetData();
+	float* RESTRICT Life = LifeRemaining.GetData();
+
+	// Same integration as UProjectileMovementComponent::ComputeMoveDelta: gravity is applied over the step with a constant acceleration
+	const float GravityDelta = GravityZ * DeltaTime;
+	const float HalfGravityDeltaSquared = 0.5f * GravityZ * DeltaTime * DeltaTime;
+
+	const VectorRegister VecDeltaTime = VectorSetFloat1(DeltaTime);
+	const VectorRegister VecGravityDelta = VectorSetFloat1(GravityDelta);
+	const VectorRegister VecHalfGravityDeltaSquared = VectorSetFloat1(HalfGravityDeltaSquared);
+
+	const int32 NumVectorized = NumProjectiles & ~3;
+	int32 Index = 0;
+	for (; Index < NumVectorized; Index += 4)
+	{
+		VectorStore(VectorMultiplyAdd(VectorLoad(VelX + Index), VecDeltaTime, VectorLoad(PosX + Index)), PosX + Index);
+		VectorStore(VectorMultiplyAdd(VectorLoad(VelY + Index), VecDeltaTime, VectorLoad(PosY + Index)), PosY + Index);
+
+		const VectorRegister GravityScale = VectorLoad(Gravity + Index);
+		const VectorRegister VelocityZVec = VectorLoad(VelZ + Index);
+		const VectorRegister NewPositionZ = VectorMultiplyAdd(VelocityZVec, VecDeltaTime, VectorLoad(PosZ + Index));
+		VectorStore(VectorMultiplyAdd(GravityScale, VecHalfGravityDeltaSquared, NewPositionZ), PosZ + Index);
+		VectorStore(VectorMultiplyAdd(GravityScale, VecGravityDelta, VelocityZVec), VelZ + Index);
+
+		VectorStore(VectorSubtract(VectorLoad(Life + Index), VecDeltaTime), Life + Index);
+	}
+
+	for (; Index < NumProjectiles; ++Index)
+	{
+		PosX[Index] += VelX[Index] * DeltaTime;
+		PosY[Index] += VelY[Index] * DeltaTime;
+		PosZ[Index] += VelZ[Index] * DeltaTime + Gravity[Index] * HalfGravityDeltaSquared;
+		VelZ[Index] += Gravity[Index] * GravityDelta;
+		Life[Index] -= DeltaTime;
+	}
+}
+
+void UProjectileSimulationSubsystem::RequestTraces(UWorld* World)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LightweightProjectilesRequestTraces);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(LightweightProjectile), false);
+	QueryParams.bReturnPhysicalMaterial = true;
+
+	const int32 NumProjectiles = PositionX.Num();
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		const FLightweightProjectileType& Type = Types[TypeIndices[Index]];
+		const FVector End(PositionX[Index], PositionY[Index], PositionZ[Index]);
+
+		QueryParams.ClearIgnoredActors();
+		if (const AActor* Instigator = Instigators[Index].Get())
+		{
+			QueryParams.AddIgnoredActor(Instigator);
+		}
+
+		if (Type.Radius > 0.f)
+		{
+			TraceHandles[Index] = World->AsyncSweepByChannel(EAsyncTraceType::Single, StepStart[Index], End, Type.TraceChannel, FCollisionShape::MakeSphere(Type.Radius), QueryParams);
+		}
+		else
+		{
+			TraceHandles[Index] = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, StepStart[Index], End, Type.TraceChannel, QueryParams);
+		}
+	}
+}
@@ -0,0 +1,127 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/ReplicatedMovementSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Batched Replicated Movement"), STAT_BatchedReplicatedMovement, STATGROUP_Game);
+
+static int32 GRepMovementBatch = 0;
+static FAutoConsoleVariableRef CVarRepMovementBatch(
+	TEXT("net.RepMovement.Batch"),
+	GRepMovementBatch,
+	TEXT("If non-zero, clients queue the replicated movement of simulated proxy actors and apply it once per frame, from the replicated movement subsystem."),
+	ECVF_Default);
+
+static float GRepMovementBatchSmoothingTime = 0.f;
+static FAutoConsoleVariableRef CVarRepMovementBatchSmoothingTime(
+	TEXT("net.RepMovement.Batch.SmoothingTime"),
+	GRepMovementBatchSmoothingTime,
+	TEXT("Time constant in seconds of the interpolation to the replicated transform of batched actors. 0 moves them to it right away."),
+	ECVF_Default);
+
+static float GRepMovementBatchMaxSmoothDistance = 500.f;
+static FAutoConsoleVariableRef CVarRepMovementBatchMaxSmoothDistance(
+	TEXT("net.RepMovement.Batch.MaxSmoothDistance"),
+	GRepMovementBatchMaxSmoothDistance,
+	TEXT("Distance from the replicated location over which batched actors are moved to it right away instead of being interpolated."),
+	ECVF_Default);
+
+namespace ReplicatedMovementSubsystem
+{
+	/** Distance and angle in degrees under which an interpolated actor is snapped to its target */
+	static const float SnapDistance = 0.1f;
+	static const float SnapAngle = 0.1f;
+}
+
+bool UReplicatedMovementSubsystem::IsBatchingEnabled(const UWorld* World)
+{
+	return GRepMovementBatch != 0 && World && World->IsNetMode(NM_Client);
+}
+
+bool UReplicatedMovementSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UReplicatedMovementSubsystem::Deinitialize()
+{
+	PendingMovements.Empty();
+
+	Super::Deinitialize();
+}
+
+void UReplicatedMovementSubsystem::QueueMovement(AActor* Actor, const FVector& Location, const FRotator& Rotation)
+{
+	FPendingMovement& PendingMovement = PendingMovements.FindOrAdd(Actor);
+	PendingMovement.Location = Location;
+	PendingMovement.Rotation = Rotation;
+}
+
+ETickableTickType UReplicatedMovementSubsystem::GetTickableTickType() const
+{
+	// The CDO of this should never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UReplicatedMovementSubsystem::IsTickable() const
+{
+	return PendingMovements.Num() > 0;
+}
+
+void UReplicatedMovementSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BatchedReplicatedMovement);
+
+	using namespace ReplicatedMovementSubsystem;
+
+	const bool bSmooth = GRepMovementBatchSmoothingTime > 0.f;
+	const float Alpha = bSmooth ? 1.f - FMath::Exp(-DeltaTime / GRepMovementBatchSmoothingTime) : 1.f;
+	const float MaxSmoothDistanceSquared = FMath::Square(GRepMovementBatchMaxSmoothDistance);
+
+	for (TMap<TWeakObjectPtr<AActor>, FPendingMovement>::TIterator It(PendingMovements); It; ++It)
+	{
+		AActor* Actor = It.Key().Get();
+		USceneComponent* RootComponent = Actor ? Actor->GetRootComponent() : nullptr;
+
+		// The actor may have been destroyed, attached, or started simulating physics since its movement was queued
+		if (!RootComponent || !RootComponent->IsRegistered() || RootComponent->GetAttachParent() || Actor->GetLocalRole() != ROLE_SimulatedProxy || Actor->GetReplicatedMovement().bRepPhysics)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		const FPendingMovement& PendingMovement = It.Value();
+		const FVector CurrentLocation = Actor->GetActorLocation();
+		const FQuat CurrentRotation = Actor->GetActorQuat();
+		const FQuat TargetRotation = PendingMovement.Rotation.Quaternion();
+
+		bool bReachedTarget = !bSmooth || FVector::DistSquared(CurrentLocation, PendingMovement.Location) > MaxSmoothDistanceSquared;
+		FVector NewLocation = PendingMovement.Location;
+		FQuat NewRotation = TargetRotation;
+		if (!bReachedTarget)
+		{
+			NewLocation = FMath::Lerp(CurrentLocation, PendingMovement.Location, Alpha);
+			NewRotation = FQuat::Slerp(CurrentRotation, TargetRotation, Alpha);
+
+			bReachedTarget = FVector::DistSquared(NewLocation, PendingMovement.Location) < FMath::Square(SnapDistance)
+				&& FMath::RadiansToDegrees(NewRotation.AngularDistance(TargetRotation)) < SnapAngle;
+		}
+
+		if (bReachedTarget)
+		{
+			if (PendingMovement.Location != CurrentLocation || PendingMovement.Rotation != Actor->GetActorRotation())
+			{
+				Actor->SetActorLocationAndRotation(PendingMovement.Location, PendingMovement.Rotation, /*bSweep=*/ false);
+			}
+			It.RemoveCurrent();
+		}
+		else
+		{
+			Actor->SetActorLocationAndRotation(NewLocation, NewRotation, /*bSweep=*/ false);
+		}
+	}
+}
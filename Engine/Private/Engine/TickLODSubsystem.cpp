@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/TickLODSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/ActorComponent.h"
+
+UTickLODSubsystem::UTickLODSubsystem()
+	: UpdatePeriod(0.5f)
+	, RecentlyRenderedTolerance(0.2f)
+	, NextUpdateIndex(0)
+	, PendingUpdates(0.f)
+{
+	LODDistances = { 2500.f, 6000.f, 12000.f };
+	LODTickIntervals = { 0.f, 0.1f, 0.25f, 0.5f };
+}
+
+void UTickLODSubsystem::Deinitialize()
+{
+	for (FRegisteredActor& Registered : RegisteredActors)
+	{
+		if (AActor* Actor = Registered.Actor.Get())
+		{
+			Actor->OnEndPlay.RemoveAll(this);
+			RestoreTickIntervals(Registered);
+		}
+	}
+	RegisteredActors.Empty();
+}
+
+void UTickLODSubsystem::RegisterActor(AActor* Actor, bool bIncludeComponents)
+{
+	if (Actor == nullptr || RegisteredActors.ContainsByPredicate([Actor](const FRegisteredActor& Registered) { return Registered.Actor == Actor; }))
+	{
+		return;
+	}
+
+	FRegisteredActor& Registered = RegisteredActors.AddDefaulted_GetRef();
+	Registered.Actor = Actor;
+	Registered.BaseTickInterval = Actor->GetActorTickInterval();
+	Registered.LOD = 0;
+
+	if (bIncludeComponents)
+	{
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component && Component->PrimaryComponentTick.bCanEverTick)
+			{
+				Registered.Components.Emplace(Component, Component->GetComponentTickInterval());
+			}
+		}
+	}
+
+	Actor->OnEndPlay.AddDynamic(this, &UTickLODSubsystem::OnActorEndPlay);
+}
+
+void UTickLODSubsystem::UnregisterActor(AActor* Actor)
+{
+	const int32 Index = RegisteredActors.IndexOfByPredicate([Actor](const FRegisteredActor& Registered) { return Registered.Actor == Actor; });
+	if (Actor && Index != INDEX_NONE)
+	{
+		Actor->OnEndPlay.RemoveAll(this);
+		RestoreTickIntervals(RegisteredActors[Index]);
+		RegisteredActors.RemoveAtSwap(Index);
+	}
+}
+
+void UTickLODSubsystem::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterActor(Actor);
+}
+
+ETickableTickType UTickLODSubsystem::GetTickableTickType() const
+{
+	// The CDO of this should never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UTickLODSubsystem::IsTickable() const
+{
+	return RegisteredActors.Num() > 0;
+}
+
+void UTickLODSubsystem::Tick(float DeltaTime)
+{
+	UWorld* MyWorld = GetWorld();
+	if (MyWorld == nullptr || RegisteredActors.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for (FConstPlayerControllerIterator It = MyWorld->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	// Evaluate a slice of the list every frame so that the whole list is covered once per UpdatePeriod
+	PendingUpdates += (UpdatePeriod > 0.f) ? RegisteredActors.Num() * FMath::Min(DeltaTime / UpdatePeriod, 1.f) : RegisteredActors.Num();
+	int32 NumToUpdate = FMath::Min(FMath::FloorToInt(PendingUpdates), RegisteredActors.Num());
+	PendingUpdates -= NumToUpdate;
+
+	while (NumToUpdate-- > 0 && RegisteredActors.Num() > 0)
+	{
+		if (NextUpdateIndex >= RegisteredActors.Num())
+		{
+			NextUpdateIndex = 0;
+		}
+
+		FRegisteredActor& Registered = RegisteredActors[NextUpdateIndex];
+		const AActor* Actor = Registered.Actor.Get();
+		if (Actor == nullptr)
+		{
+			RegisteredActors.RemoveAtSwap(NextUpdateIndex);
+			continue;
+		}
+
+		const int32 NewLOD = CalculateLOD(Actor, ViewLocations);
+		if (NewLOD != Registered.LOD)
+		{
+			ApplyLOD(Registered, NewLOD);
+		}
+		++NextUpdateIndex;
+	}
+}
+
+int32 UTickLODSubsystem::CalculateLOD(const AActor* Actor, TArrayView<const FVector> ViewLocations) const
+{
+	if (ViewLocations.Num() == 0)
+	{
+		return 0;
+	}
+
+	const FVector ActorLocation = Actor->GetActorLocation();
+	float MinDistSq = MAX_flt;
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(ActorLocation, ViewLocation));
+	}
+
+	int32 LOD = 0;
+	while (LOD < LODDistances.Num() && MinDistSq > FMath::Square(LODDistances[LOD]))
+	{
+		++LOD;
+	}
+
+	if (LOD > 0 && Actor->WasRecentlyRendered(RecentlyRenderedTolerance))
+	{
+		--LOD;
+	}
+
+	return FMath::Min(LOD, FMath::Max(LODTickIntervals.Num() - 1, 0));
+}
+
+void UTickLODSubsystem::ApplyLOD(FRegisteredActor& Registered, int32 NewLOD) const
+{
+	Registered.LOD = NewLOD;
+
+	const float LODInterval = LODTickIntervals.IsValidIndex(NewLOD) ? LODTickIntervals[NewLOD] : 0.f;
+
+	if (AActor* Actor = Registered.Actor.Get())
+	{
+		Actor->SetActorTickInterval(FMath::Max(Registered.BaseTickInterval, LODInterval));
+	}
+
+	for (const TPair<TWeakObjectPtr<UActorComponent>, float>& ComponentInterval : Registered.Components)
+	{
+		if (UActorComponent* Component = ComponentInterval.Key.Get())
+		{
+			Component->SetComponentTickInterval(FMath::Max(ComponentInterval.Value, LODInterval));
+		}
+	}
+}
+
+void UTickLODSubsystem::RestoreTickIntervals(FRegisteredActor& Registered)
+{
+	if (AActor* Actor = Registered.Actor.Get())
+	{
+		Actor->SetActorTickInterval(Registered.BaseTickInterval);
+	}
+
+	for (const TPair<TWeakObjectPtr<UActorComponent>, float>& ComponentInterval : Registered.Components)
+	{
+		if (UActorComponent* Component = ComponentInterval.Key.Get())
+		{
+			Component->SetComponentTickInterval(ComponentInterval.Value);
+		}
+	}
+}
@@ -19,6 +19,8 @@ GPUSkinCache.cpp: Performs skinning on a compute shader into a buffer to avoid v
 DEFINE_STAT(STAT_GPUSkinCache_TotalNumChunks);
 DEFINE_STAT(STAT_GPUSkinCache_TotalNumVertices);
 DEFINE_STAT(STAT_GPUSkinCache_TotalMemUsed);
+DEFINE_STAT(STAT_GPUSkinCache_FreeMemKept);
+DEFINE_STAT(STAT_GPUSkinCache_NumAllocationsReused);
 DEFINE_STAT(STAT_GPUSkinCache_TangentsIntermediateMemUsed);
 DEFINE_STAT(STAT_GPUSkinCache_NumTrianglesForRecomputeTangents);
 DEFINE_STAT(STAT_GPUSkinCache_NumSectionsProcessed);
@@ -105,6 +107,23 @@ static TAutoConsoleVariable<float> CVarGPUSkinCacheSceneMemoryLimitInMB(
 	ECVF_RenderThreadSafe
 );
 
+static int32 GSkinCacheFreeAllocationLifetime = 120;
+FAutoConsoleVariableRef CVarGPUSkinCacheFreeAllocationLifetime(
+	TEXT("r.SkinCache.FreeAllocationLifetime"),
+	GSkinCacheFreeAllocationLifetime,
+	TEXT("Number of frames the buffers of a released skin cache entry are kept for reuse by a new entry of about the same size, e.g. after a LOD change.\n")
+	TEXT("Kept buffers count against r.SkinCache.SceneMemoryLimitInMB and are freed first when it's reached. 0 frees buffers right away."),
+	ECVF_RenderThreadSafe
+);
+
+static float GSkinCacheFreeAllocationMaxWaste = 0.25f;
+FAutoConsoleVariableRef CVarGPUSkinCacheFreeAllocationMaxWaste(
+	TEXT("r.SkinCache.FreeAllocationMaxWaste"),
+	GSkinCacheFreeAllocationMaxWaste,
+	TEXT("Fraction of unused vertices allowed when reusing the kept buffers of a released entry for a smaller entry."),
+	ECVF_RenderThreadSafe
+);
+
 ////temporary disable until resource lifetimes are safe for all cases
 static int32 GAllowDupedVertsForRecomputeTangents = 0;
 FAutoConsoleVariableRef CVarGPUSkinCacheAllowDupedVertesForRecomputeTangents(
@@ -664,6 +683,7 @@ void FGPUSkinCache::Cleanup()
 	{
 		ReleaseSkinCacheEntry(Entries.Last());
 	}
+	FreeUnusedAllocations(true);
 	ensure(Allocations.Num() == 0);
 }
 
@@ -1078,8 +1098,39 @@ void FGPUSkinCache::DispatchUpdateSkinTangents(FRHICommandListImmediate& RHICmdL
 
 FGPUSkinCache::FRWBuffersAllocation* FGPUSkinCache::TryAllocBuffer(uint32 NumVertices, bool WithTangnents)
 {
+	FreeUnusedAllocations(false);
+
+	// Reuse the buffers of a released entry if they're big enough without wasting too much
+	const uint32 MaxReusedNumVertices = NumVertices + (uint32)(NumVertices * FMath::Max(GSkinCacheFreeAllocationMaxWaste, 0.0f));
+	int32 BestFreeIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < FreeAllocations.Num(); ++Index)
+	{
+		const FRWBuffersAllocation* FreeAllocation = FreeAllocations[Index].Allocation;
+		if (FreeAllocation->HasTangents() == WithTangnents && FreeAllocation->GetNumVertices() >= NumVertices && FreeAllocation->GetNumVertices() <= MaxReusedNumVertices
+			&& (BestFreeIndex == INDEX_NONE || FreeAllocation->GetNumVertices() < FreeAllocations[BestFreeIndex].Allocation->GetNumVertices()))
+		{
+			BestFreeIndex = Index;
+		}
+	}
+
+	if (BestFreeIndex != INDEX_NONE)
+	{
+		FRWBuffersAllocation* ReusedAllocation = FreeAllocations[BestFreeIndex].Allocation;
+		FreeAllocations.RemoveAt(BestFreeIndex);
+		DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_FreeMemKept, ReusedAllocation->GetNumBytes());
+		INC_DWORD_STAT(STAT_GPUSkinCache_NumAllocationsReused);
+		return ReusedAllocation;
+	}
+
 	uint64 MaxSizeInBytes = (uint64)(GSkinCacheSceneMemoryLimitInMB * 1024.0f * 1024.0f);
 	uint64 RequiredMemInBytes = FRWBuffersAllocation::CalculateRequiredMemory(NumVertices, WithTangnents);
+
+	// Buffers kept for reuse make room first, oldest first
+	while (bRequiresMemoryLimit && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes && FreeAllocations.Num() > 0)
+	{
+		FreeAllocation(0);
+	}
+
 	if (bRequiresMemoryLimit && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes)
 	{
 		ExtraRequiredMemory += RequiredMemInBytes;
@@ -1523,14 +1574,8 @@ void FGPUSkinCache::ReleaseSkinCacheEntry(FGPUSkinCacheEntry* SkinCacheEntry)
 	FRWBuffersAllocation* PositionAllocation = SkinCacheEntry->PositionAllocation;
 	if (PositionAllocation)
 	{
-		uint64 RequiredMemInBytes = PositionAllocation->GetNumBytes();
-		SkinCache->UsedMemoryInBytes -= RequiredMemInBytes;
-		DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
-
-		SkinCache->Allocations.Remove(PositionAllocation);
 		PositionAllocation->RemoveAllFromTransitionArray(SkinCache->BuffersToTransition);
-
-		delete PositionAllocation;
+		SkinCache->ReleaseAllocation(PositionAllocation);
 
 		SkinCacheEntry->PositionAllocation = nullptr;
 	}
@@ -1539,6 +1584,47 @@ void FGPUSkinCache::ReleaseSkinCacheEntry(FGPUSkinCacheEntry* SkinCacheEntry)
 	delete SkinCacheEntry;
 }
 
+void FGPUSkinCache::ReleaseAllocation(FRWBuffersAllocation* Allocation)
+{
+	// Buffers created with other settings than the current ones are never reused
+	const bool bMatchesSettings = Allocation->HasIntermediateTangents() == (Allocation->HasTangents() && UseIntermediateTangents());
+	if (GSkinCacheFreeAllocationLifetime > 0 && bMatchesSettings)
+	{
+		FreeAllocations.Add({ Allocation, GFrameNumberRenderThread });
+		INC_MEMORY_STAT_BY(STAT_GPUSkinCache_FreeMemKept, Allocation->GetNumBytes());
+		return;
+	}
+
+	uint64 RequiredMemInBytes = Allocation->GetNumBytes();
+	UsedMemoryInBytes -= RequiredMemInBytes;
+	DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
+
+	Allocations.Remove(Allocation);
+	delete Allocation;
+}
+
+void FGPUSkinCache::FreeAllocation(int32 FreeAllocationIndex)
+{
+	FRWBuffersAllocation* Allocation = FreeAllocations[FreeAllocationIndex].Allocation;
+	FreeAllocations.RemoveAt(FreeAllocationIndex);
+
+	uint64 RequiredMemInBytes = Allocation->GetNumBytes();
+	UsedMemoryInBytes -= RequiredMemInBytes;
+	DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
+	DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_FreeMemKept, RequiredMemInBytes);
+
+	Allocations.Remove(Allocation);
+	delete Allocation;
+}
+
+void FGPUSkinCache::FreeUnusedAllocations(bool bFreeAll)
+{
+	while (FreeAllocations.Num() > 0 && (bFreeAll || GFrameNumberRenderThread - FreeAllocations[0].ReleasedFrame > (uint32)FMath::Max(GSkinCacheFreeAllocationLifetime, 0)))
+	{
+		FreeAllocation(0);
+	}
+}
+
 #if RHI_RAYTRACING
 void FGPUSkinCache::GetRayTracingSegmentVertexBuffers(const FGPUSkinCacheEntry& SkinCacheEntry, TArrayView<FRayTracingGeometrySegment> OutSegments)
 {
@@ -1569,6 +1655,9 @@ void FGPUSkinCache::InvalidateAllEntries()
 		Entries[Index]->LOD = -1;
 	}
 
+	// Settings changed, buffers kept for reuse may no longer match them
+	FreeUnusedAllocations(true);
+
 	for (int32 Index = 0; Index < StagingBuffers.Num(); ++Index)
 	{
 		StagingBuffers[Index].Release();
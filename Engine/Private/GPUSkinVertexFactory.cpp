@@ -10,6 +10,7 @@
 #include "GPUSkinCache.h"
 #include "ShaderParameterUtils.h"
 #include "MeshMaterialShader.h"
+#include "Hash/CityHash.h"
 #if INTEL_ISPC
 #include "GPUSkinVertexFactory.ispc.generated.h"
 #endif
@@ -212,6 +213,24 @@ static bool DeferSkeletalLockAndFillToRHIThread()
 	return IsRunningRHIInSeparateThread() && CVarRHICmdDeferSkeletalLockAndFillToRHIThread.GetValueOnRenderThread() > 0;
 }
 
+static int32 GSkipUnchangedBoneBufferUpdates = 1;
+static FAutoConsoleVariableRef CVarSkipUnchangedBoneBufferUpdates(
+	TEXT("r.GPUSkin.SkipUnchangedBoneBufferUpdates"),
+	GSkipUnchangedBoneBufferUpdates,
+	TEXT("If 1, bone buffers that already hold the bones being written are neither locked nor filled again, e.g. for meshes holding a pose."),
+	ECVF_RenderThreadSafe);
+
+/** Hash of the bones a section would write into its bone buffer */
+static uint64 HashBoneMatrices(const TArray<FMatrix>& ReferenceToLocalMatrices, const TArray<FBoneIndexType>& BoneMap)
+{
+	uint64 Hash = BoneMap.Num();
+	for (const FBoneIndexType RefToLocalIdx : BoneMap)
+	{
+		Hash = CityHash64WithSeed((const char*)&ReferenceToLocalMatrices[RefToLocalIdx], sizeof(FMatrix), Hash);
+	}
+	return Hash;
+}
+
 bool FGPUBaseSkinVertexFactory::FShaderDataType::UpdateBoneData(FRHICommandListImmediate& RHICmdList, const TArray<FMatrix>& ReferenceToLocalMatrices,
 	const TArray<FBoneIndexType>& BoneMap, uint32 RevisionNumber, bool bPrevious, ERHIFeatureLevel::Type InFeatureLevel, bool bUseSkinCache)
 {
@@ -229,7 +248,8 @@ bool FGPUBaseSkinVertexFactory::FShaderDataType::UpdateBoneData(FRHICommandListI
 		// make sure current revision is up-to-date
 		SetCurrentRevisionNumber(RevisionNumber);
 
-		CurrentBoneBuffer = &GetBoneBufferForWriting(bPrevious);
+		const uint32 BufferIndex = GetBoneBufferIndex(bPrevious);
+		CurrentBoneBuffer = &BoneBuffer[BufferIndex];
 
 		static FSharedPoolPolicyData PoolPolicy;
 		uint32 NumVectors = NumBones*3;
@@ -245,9 +265,26 @@ bool FGPUBaseSkinVertexFactory::FShaderDataType::UpdateBoneData(FRHICommandListI
 			}
 			*CurrentBoneBuffer = BoneBufferPool.CreatePooledResource(VectorArraySize);
 			check(IsValidRef(*CurrentBoneBuffer));
+			BoneBufferHash[BufferIndex] = 0;
 		}
 		if(NumBones)
 		{
+			// Buffers are double buffered and flipped on every revision, so a mesh holding a pose ends up with both
+			// buffers holding the same bones and stops uploading them
+			if (GSkipUnchangedBoneBufferUpdates)
+			{
+				const uint64 Hash = HashBoneMatrices(ReferenceToLocalMatrices, BoneMap);
+				if (Hash != 0 && Hash == BoneBufferHash[BufferIndex])
+				{
+					return false;
+				}
+				BoneBufferHash[BufferIndex] = Hash;
+			}
+			else
+			{
+				BoneBufferHash[BufferIndex] = 0;
+			}
+
 			if (!bUseSkinCache && DeferSkeletalLockAndFillToRHIThread())
 			{
 				FRHIVertexBuffer* VertexBuffer = CurrentBoneBuffer->VertexBufferRHI;
@@ -1405,7 +1405,7 @@ void FRootMotionSourceGroup::PrepareRootMotion(float DeltaTime, const ACharacter
 	// Add pending sources
 	{
 		RootMotionSources.Append(PendingAddRootMotionSources);
-		PendingAddRootMotionSources.Empty();
+		PendingAddRootMotionSources.Reset();
 	}
 
 	// Sort by priority
@@ -2070,8 +2070,9 @@ void FRootMotionSourceGroup::CullInvalidSources()
 
 void FRootMotionSourceGroup::Clear()
 {
-	RootMotionSources.Empty();
-	PendingAddRootMotionSources.Empty();
+	// Keep the allocations, saved moves clear and copy groups every frame
+	RootMotionSources.Reset();
+	PendingAddRootMotionSources.Reset();
 	bIsAdditiveVelocityApplied = false;
 	bHasAdditiveSources = false;
 	bHasOverrideSources = false;
@@ -2085,7 +2086,7 @@ FRootMotionSourceGroup& FRootMotionSourceGroup::operator=(const FRootMotionSourc
 	if (this != &Other)
 	{
 		// Deep copy Sources
-		RootMotionSources.Empty(Other.RootMotionSources.Num());
+		RootMotionSources.Reset(Other.RootMotionSources.Num());
 		for (int i = 0; i < Other.RootMotionSources.Num(); ++i)
 		{
 			if (Other.RootMotionSources[i].IsValid())
@@ -2100,7 +2101,7 @@ FRootMotionSourceGroup& FRootMotionSourceGroup::operator=(const FRootMotionSourc
 		}
 
 		// Deep copy PendingAdd sources
-		PendingAddRootMotionSources.Empty(Other.PendingAddRootMotionSources.Num());
+		PendingAddRootMotionSources.Reset(Other.PendingAddRootMotionSources.Num());
 		for (int i = 0; i < Other.PendingAddRootMotionSources.Num(); ++i)
 		{
 			if (Other.PendingAddRootMotionSources[i].IsValid())
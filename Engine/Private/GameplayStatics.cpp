@@ -46,6 +46,8 @@
 #include "Components/SceneCaptureComponent2D.h"
 #include "Sound/SoundCue.h"
 #include "Sound/SoundWave.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/ActorRegistrySubsystem.h"
 
 #define LOCTEXT_NAMESPACE "GameplayStatics"
 
@@ -69,6 +71,20 @@ DECLARE_CYCLE_STAT(TEXT("BreakHitResult"), STAT_BreakHitResult, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("MakeHitResult"), STAT_MakeHitResult, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("SpawnTime"), STAT_SpawnTime, STATGROUP_Game);
 
+static int32 GUseActorRegistryForGetAllActorsOfClass = 1;
+static FAutoConsoleVariableRef CVarUseActorRegistryForGetAllActorsOfClass(
+	TEXT("world.ActorRegistry.UseForGetAllActorsOfClass"),
+	GUseActorRegistryForGetAllActorsOfClass,
+	TEXT("If non-zero, GetAllActorsOfClass and GetAllActorsOfClassWithTag query the world's actor registry instead of iterating every actor of every level.\n")
+	TEXT("The actors returned are the same but not in level order.")
+);
+
+/** Returns the world's actor registry if class queries should go through it */
+static UActorRegistrySubsystem* GetActorRegistryForQueries(UWorld* World)
+{
+	return GUseActorRegistryForGetAllActorsOfClass ? World->GetSubsystem<UActorRegistrySubsystem>() : nullptr;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // FSaveGameHeader
 
@@ -878,10 +894,16 @@ void UGameplayStatics::GetAllActorsOfClass(const UObject* WorldContextObject, TS
 	if (ActorClass)
 	{
 		if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
-	{
-		for(TActorIterator<AActor> It(World, ActorClass); It; ++It)
 		{
-			AActor* Actor = *It;
+			if (UActorRegistrySubsystem* ActorRegistry = GetActorRegistryForQueries(World))
+			{
+				ActorRegistry->GetActorsOfClass(ActorClass, OutActors);
+				return;
+			}
+
+			for(TActorIterator<AActor> It(World, ActorClass); It; ++It)
+			{
+				AActor* Actor = *It;
 				OutActors.Add(Actor);
 			}
 		}
@@ -943,6 +965,19 @@ void UGameplayStatics::GetAllActorsOfClassWithTag(const UObject* WorldContextObj
 	// We do nothing if no is class provided, rather than giving ALL actors!
 	if (ActorClass && World)
 	{
+		if (UActorRegistrySubsystem* ActorRegistry = GetActorRegistryForQueries(World))
+		{
+			ActorRegistry->ForEachActorOfClass(ActorClass, [Tag, &OutActors](AActor* Actor)
+			{
+				if (Actor->ActorHasTag(Tag))
+				{
+					OutActors.Add(Actor);
+				}
+				return true;
+			});
+			return;
+		}
+
 		for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
 		{
 			AActor* Actor = *It;
@@ -2025,7 +2060,8 @@ void UGameplayStatics::AsyncSaveGameToSlot(USaveGame* SaveGameObject, const FStr
 	TArray<uint8> ObjectBytes;
 	if (SaveGameToMemory(SaveGameObject, ObjectBytes))
 	{
-		AsyncTask(ENamedThreads::AnyHiPriThreadNormalTask, [SlotName, UserIndex, SavedDelegate, ObjectBytes]()
+		// The serialized save can be large, hand it over to the task rather than copying it
+		AsyncTask(ENamedThreads::AnyHiPriThreadNormalTask, [SlotName, UserIndex, SavedDelegate, ObjectBytes = MoveTemp(ObjectBytes)]()
 		{
 			bool bSuccess = SaveDataToSlot(ObjectBytes, SlotName, UserIndex);
 
@@ -32,6 +32,8 @@
 #include "UObject/ReleaseObjectVersion.h"
 #include "ComponentRecreateRenderStateContext.h"
 #include "Algo/AnyOf.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 
 static TAutoConsoleVariable<int32> CVarFoliageSplitFactor(
 	TEXT("foliage.SplitFactor"),
@@ -121,6 +123,17 @@ static TAutoConsoleVariable<int32> CVarFoliageUseInstanceRuns(
 	0,
 	TEXT("Whether to use the InstanceRuns feature of FMeshBatch to compress foliage draw call data sent to the renderer.  Not supported by the Mesh Draw Command pipeline."));
 
+static TAutoConsoleVariable<float> CVarFoliageRefitMaxGrowth(
+	TEXT("foliage.RefitMaxGrowth"),
+	0.25f,
+	TEXT("When a built instance moves, the cluster tree is refitted around its new bounds instead of rebuilt as long as its leaf grows by less than this fraction of its size.\n")
+	TEXT("Refitting only grows bounds, so larger values avoid more rebuilds but cull moved instances less tightly. 0 always rebuilds the tree."));
+
+static TAutoConsoleVariable<int32> CVarFoliageParallelTraversalMinNodes(
+	TEXT("foliage.ParallelTraversalMinNodes"),
+	512,
+	TEXT("Cluster trees with at least this many nodes are culled with a task per child of the root, for every view and shadow pass. 0 always culls on the rendering thread."));
+
 DECLARE_CYCLE_STAT(TEXT("Traversal Time"),STAT_FoliageTraversalTime,STATGROUP_Foliage);
 DECLARE_CYCLE_STAT(TEXT("Build Time"), STAT_FoliageBuildTime, STATGROUP_Foliage);
 DECLARE_CYCLE_STAT(TEXT("Batch Time"),STAT_FoliageBatchTime,STATGROUP_Foliage);
@@ -993,6 +1006,39 @@ public:
 
 	template<bool TUseVector>
 	void Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false) const;
+
+	/** Same as Traverse from the root, with the subtrees of the root traversed in parallel */
+	template<bool TUseVector>
+	void TraverseParallel(FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false) const;
+};
+
+/** A run added by a parallel traversal task, replayed in order once every task is done */
+struct FFoliageDeferredRun
+{
+	int32 MinLod;
+	int32 MaxLod;
+	int32 FirstInstance;
+	int32 LastInstance;
+};
+
+/** A subtree of the root traversed by a task, see TraverseParallel */
+struct FFoliageTraversalTask
+{
+	int32 NodeIndex;
+	int32 MinLOD;
+	int32 MaxLOD;
+	bool bFullyContained;
+
+	/** Worker threads can't allocate from the scene rendering mem stack, runs are only gathered here */
+	TArray<FFoliageDeferredRun> Runs;
+
+	FFoliageTraversalTask(int32 InNodeIndex, int32 InMinLOD, int32 InMaxLOD, bool bInFullyContained)
+		: NodeIndex(InNodeIndex)
+		, MinLOD(InMinLOD)
+		, MaxLOD(InMaxLOD)
+		, bFullyContained(bInFullyContained)
+	{
+	}
 };
 
 struct FFoliageRenderInstanceParams
@@ -1005,10 +1051,14 @@ struct FFoliageRenderInstanceParams
 	mutable int32 TotalSingleLODInstances[MAX_STATIC_MESH_LODS];
 	mutable int32 TotalMultipleLODInstances[MAX_STATIC_MESH_LODS];
 
+	/** When set, runs are gathered here instead of being added to the arrays above */
+	TArray<FFoliageDeferredRun>* DeferredRuns;
+
 	FFoliageRenderInstanceParams(bool InbNeedsSingleLODRuns, bool InbNeedsMultipleLODRuns, bool InbOverestimate)
 		: bNeedsSingleLODRuns(InbNeedsSingleLODRuns)
 		, bNeedsMultipleLODRuns(InbNeedsMultipleLODRuns)
 		, bOverestimate(InbOverestimate)
+		, DeferredRuns(nullptr)
 	{
 		for (int32 Index = 0; Index < MAX_STATIC_MESH_LODS; Index++)
 		{
@@ -1030,6 +1080,11 @@ struct FFoliageRenderInstanceParams
 	}
 	FORCEINLINE_DEBUGGABLE void AddRun(int32 MinLod, int32 MaxLod, int32 FirstInstance, int32 LastInstance) const
 	{
+		if (DeferredRuns)
+		{
+			DeferredRuns->Add({ MinLod, MaxLod, FirstInstance, LastInstance });
+			return;
+		}
 		if (bNeedsSingleLODRuns)
 		{
 			int32 CurrentLOD = bOverestimate ? MaxLod : MinLod;
@@ -1075,7 +1130,8 @@ struct FFoliageCullInstanceParams : public FFoliageRenderInstanceParams
 	const TArray<bool>* OcclusionResults;
 	int32 OcclusionResultsStart;
 
-
+	/** When set, the children of the root are added here instead of being traversed */
+	TArray<FFoliageTraversalTask>* ParallelTasks;
 
 	FFoliageCullInstanceParams(bool InbNeedsSingleLODRuns, bool InbNeedsMultipleLODRuns, bool InbOverestimate, const TArray<FClusterNode>& InTree)
 	:	FFoliageRenderInstanceParams(InbNeedsSingleLODRuns, InbNeedsMultipleLODRuns, InbOverestimate)
@@ -1084,6 +1140,7 @@ struct FFoliageCullInstanceParams : public FFoliageRenderInstanceParams
 	,	LastOcclusionNode(-1)
 	,	OcclusionResults(nullptr)
 	,	OcclusionResultsStart(0)
+	,	ParallelTasks(nullptr)
 	{
 	}
 };
@@ -1254,12 +1311,60 @@ void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParam
 		Params.AddRun(MinLOD, MaxLOD, Node);
 		return;
 	}
+	if (Params.ParallelTasks && Index == 0)
+	{
+		for (int32 ChildIndex = Node.FirstChild; ChildIndex <= Node.LastChild; ChildIndex++)
+		{
+			Params.ParallelTasks->Emplace(ChildIndex, MinLOD, MaxLOD, bFullyContained);
+		}
+		return;
+	}
 	for (int32 ChildIndex = Node.FirstChild; ChildIndex <= Node.LastChild; ChildIndex++)
 	{
 		Traverse<TUseVector>(Params, ChildIndex, MinLOD, MaxLOD, bFullyContained);
 	}
 }
 
+template<bool TUseVector>
+void FHierarchicalStaticMeshSceneProxy::TraverseParallel(FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const
+{
+	check(IsInRenderingThread() && !Params.DeferredRuns);
+
+	TArray<FFoliageTraversalTask> Tasks;
+	Params.ParallelTasks = &Tasks;
+	Traverse<TUseVector>(Params, 0, MinLOD, MaxLOD, bFullyContained);
+	Params.ParallelTasks = nullptr;
+
+	if (Tasks.Num() == 0)
+	{
+		return;
+	}
+
+	// Copied here while their runs are still empty, nothing is allocated from the mem stack on the worker threads
+	TArray<FFoliageCullInstanceParams, TInlineAllocator<16>> TaskParams;
+	TaskParams.Reserve(Tasks.Num());
+	for (FFoliageTraversalTask& Task : Tasks)
+	{
+		FFoliageCullInstanceParams& Copy = TaskParams[TaskParams.Emplace(Params)];
+		Copy.DeferredRuns = &Task.Runs;
+	}
+
+	ParallelFor(Tasks.Num(), [this, &Tasks, &TaskParams](int32 TaskIndex)
+	{
+		const FFoliageTraversalTask& Task = Tasks[TaskIndex];
+		Traverse<TUseVector>(TaskParams[TaskIndex], Task.NodeIndex, Task.MinLOD, Task.MaxLOD, Task.bFullyContained);
+	}, Tasks.Num() < 2);
+
+	// Replay the runs in tree order so they merge exactly like a serial traversal
+	for (const FFoliageTraversalTask& Task : Tasks)
+	{
+		for (const FFoliageDeferredRun& Run : Task.Runs)
+		{
+			Params.AddRun(Run.MinLod, Run.MaxLod, Run.FirstInstance, Run.LastInstance);
+		}
+	}
+}
+
 struct FFoliageElementParams
 {
 	const FInstancingUserData* PassUserData[2];
@@ -1691,7 +1796,21 @@ void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<cons
 
 					if (CVarCullAll.GetValueOnRenderThread() < 1)
 					{
-						if (bUseVectorCull)
+						const int32 ParallelTraversalMinNodes = CVarFoliageParallelTraversalMinNodes.GetValueOnRenderThread();
+						const bool bParallelTraversal = ParallelTraversalMinNodes > 0 && ClusterTree.Num() >= ParallelTraversalMinNodes && FApp::ShouldUseThreadingForPerformance();
+
+						if (bParallelTraversal)
+						{
+							if (bUseVectorCull)
+							{
+								TraverseParallel<true>(InstanceParams, UseMinLOD, UseMaxLOD, bDisableCull);
+							}
+							else
+							{
+								TraverseParallel<false>(InstanceParams, UseMinLOD, UseMaxLOD, bDisableCull);
+							}
+						}
+						else if (bUseVectorCull)
 						{
 							Traverse<true>(InstanceParams, 0, UseMinLOD, UseMaxLOD, bDisableCull);
 						}
@@ -2098,7 +2217,11 @@ void UHierarchicalInstancedStaticMeshComponent::RemoveInstancesInternal(const in
 	#endif
 
 		// update the physics state
-		if (bPhysicsStateCreated)
+		if (bInStaticCollisionStore)
+		{
+			MarkStaticCollisionStoreDirty();
+		}
+		else if (bPhysicsStateCreated)
 		{
 			// Clean up physics for removed instance
 			if (InstanceBodies[InstanceIndex])
@@ -2211,7 +2334,8 @@ bool UHierarchicalInstancedStaticMeshComponent::UpdateInstanceTransform(int32 In
 	// if we are only updating rotation/scale we update the instance directly in the cluster tree
 	const bool bIsOmittedInstance = (RenderIndex == INDEX_NONE);
 	const bool bIsBuiltInstance = !bIsOmittedInstance && RenderIndex < NumBuiltRenderInstances;
-	const bool bDoInPlaceUpdate = bIsBuiltInstance && NewLocalLocation.Equals(OldTransform.GetOrigin()) && (PerInstanceRenderData.IsValid() && PerInstanceRenderData->InstanceBuffer.RequireCPUAccess);
+	const bool bCanUpdateInPlace = bIsBuiltInstance && (PerInstanceRenderData.IsValid() && PerInstanceRenderData->InstanceBuffer.RequireCPUAccess);
+	const bool bDoInPlaceUpdate = bCanUpdateInPlace && NewLocalLocation.Equals(OldTransform.GetOrigin());
 
 	bool Result = Super::UpdateInstanceTransform(InstanceIndex, NewInstanceTransform, bWorldSpace, bMarkRenderStateDirty, bTeleport);
 	
@@ -2239,6 +2363,16 @@ bool UHierarchicalInstancedStaticMeshComponent::UpdateInstanceTransform(int32 In
 				MarkRenderStateDirty();
 			}
 		}
+		else if (bCanUpdateInPlace && RefitClusterTree(RenderIndex, NewInstanceBounds, NewLocalTransform.ToMatrixWithScale().GetScaleVector()))
+		{
+			// The instance keeps its place in the tree, only the nodes above it grew to contain it
+			BuiltInstanceBounds += NewInstanceBounds;
+
+			if (bMarkRenderStateDirty)
+			{
+				MarkRenderStateDirty();
+			}
+		}
 		else
 		{
 			UnbuiltInstanceBounds += NewInstanceBounds;
@@ -2251,6 +2385,74 @@ bool UHierarchicalInstancedStaticMeshComponent::UpdateInstanceTransform(int32 In
 	return Result;
 }
 
+bool UHierarchicalInstancedStaticMeshComponent::RefitClusterTree(int32 RenderIndex, const FBox& NewInstanceBounds, const FVector& NewInstanceScale)
+{
+	const float MaxGrowth = CVarFoliageRefitMaxGrowth.GetValueOnGameThread();
+	if (MaxGrowth <= 0.0f || !ClusterTreePtr.IsValid() || ClusterTreePtr->Num() == 0)
+	{
+		return false;
+	}
+
+	// Walk down to the leaf holding the instance, the children of a node cover consecutive ranges of its instances
+	TArray<int32, TInlineAllocator<16>> NodePath;
+	{
+		const TArray<FClusterNode>& ClusterTree = *ClusterTreePtr;
+		int32 NodeIndex = 0;
+		while (true)
+		{
+			const FClusterNode& Node = ClusterTree[NodeIndex];
+			if (RenderIndex < Node.FirstInstance || RenderIndex > Node.LastInstance)
+			{
+				return false;
+			}
+
+			NodePath.Add(NodeIndex);
+			if (Node.FirstChild < 0)
+			{
+				break;
+			}
+
+			NodeIndex = Node.FirstChild;
+			while (NodeIndex < Node.LastChild && RenderIndex > ClusterTree[NodeIndex].LastInstance)
+			{
+				++NodeIndex;
+			}
+		}
+
+		// A leaf stretched too far would be drawn for views that can't see most of its instances, rebuild instead
+		const FClusterNode& Leaf = ClusterTree[NodePath.Last()];
+		const FBox LeafBounds(Leaf.BoundMin, Leaf.BoundMax);
+		const FVector Growth = (LeafBounds + NewInstanceBounds).GetSize() - LeafBounds.GetSize();
+		if (Growth.GetMax() > LeafBounds.GetSize().GetMax() * MaxGrowth)
+		{
+			return false;
+		}
+	}
+
+	// The scene proxy culls with the current tree on the render thread, refit a copy it will pick up when recreated
+	if (!ClusterTreePtr.IsUnique())
+	{
+		ClusterTreePtr = MakeShareable(new TArray<FClusterNode>(*ClusterTreePtr));
+	}
+
+	TArray<FClusterNode>& ClusterTree = *ClusterTreePtr;
+	for (const int32 NodeIndex : NodePath)
+	{
+		FClusterNode& Node = ClusterTree[NodeIndex];
+		Node.BoundMin = Node.BoundMin.ComponentMin(NewInstanceBounds.Min);
+		Node.BoundMax = Node.BoundMax.ComponentMax(NewInstanceBounds.Max);
+
+		// Scale ranges are only there if the tree was built with them
+		if (Node.MinInstanceScale.X <= Node.MaxInstanceScale.X)
+		{
+			Node.MinInstanceScale = Node.MinInstanceScale.ComponentMin(NewInstanceScale);
+			Node.MaxInstanceScale = Node.MaxInstanceScale.ComponentMax(NewInstanceScale);
+		}
+	}
+
+	return true;
+}
+
 bool UHierarchicalInstancedStaticMeshComponent::SetCustomDataValue(int32 InstanceIndex, int32 CustomDataIndex, float CustomDataValue, bool bMarkRenderStateDirty)
 {
 	if (!PerInstanceSMData.IsValidIndex(InstanceIndex))
@@ -2451,6 +2653,7 @@ void UHierarchicalInstancedStaticMeshComponent::ClearInstances()
 
 	// Release any physics representations
 	ClearAllInstanceBodies();
+	MarkStaticCollisionStoreDirty();
 
 	MarkRenderStateDirty();
 
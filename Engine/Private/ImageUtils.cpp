@@ -17,6 +17,9 @@ ImageUtils.cpp: Image utility functions.
 #include "HDRLoader.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
+#include "Misc/App.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogImageUtils, Log, All);
 
@@ -85,87 +88,98 @@ void FImageUtils::ImageResize(int32 SrcWidth, int32 SrcHeight, const TArrayView<
 	check(SrcData.Num() >= SrcWidth * SrcHeight);
 	check(DstData.Num() >= DstWidth * DstHeight);
 
-	float SrcX = 0;
-	float SrcY = 0;
-
 	const float StepSizeX = SrcWidth / (float)DstWidth;
 	const float StepSizeY = SrcHeight / (float)DstHeight;
 
-	for(int32 Y=0; Y<DstHeight;Y++)
+	// Large images are resized in bands of rows on the task graph, small ones (thumbnails) aren't worth the dispatch
+	const int32 RowsPerBand = 32;
+	const int32 NumBands = FMath::DivideAndRoundUp(DstHeight, RowsPerBand);
+	const bool bSingleThreaded = (int64)DstWidth * DstHeight < 256 * 256 || !FApp::ShouldUseThreadingForPerformance();
+
+	ParallelFor(NumBands, [&](int32 BandIndex)
 	{
-		int32 PixelPos = Y * DstWidth;
-		SrcX = 0.0f;	
-	
-		for(int32 X=0; X<DstWidth; X++)
+		const int32 FirstY = BandIndex * RowsPerBand;
+		const int32 LastY = FMath::Min(FirstY + RowsPerBand, DstHeight);
+
+		float SrcX = 0;
+		float SrcY = FirstY * StepSizeY;
+
+		for(int32 Y=FirstY; Y<LastY;Y++)
 		{
-			int32 PixelCount = 0;
-			float EndX = SrcX + StepSizeX;
-			float EndY = SrcY + StepSizeY;
+			int32 PixelPos = Y * DstWidth;
+			SrcX = 0.0f;	
+	
+			for(int32 X=0; X<DstWidth; X++)
+			{
+				int32 PixelCount = 0;
+				float EndX = SrcX + StepSizeX;
+				float EndY = SrcY + StepSizeY;
 			
-			// Generate a rectangular region of pixels and then find the average color of the region.
-			int32 PosY = FMath::TruncToInt(SrcY+0.5f);
-			PosY = FMath::Clamp<int32>(PosY, 0, (SrcHeight - 1));
+				// Generate a rectangular region of pixels and then find the average color of the region.
+				int32 PosY = FMath::TruncToInt(SrcY+0.5f);
+				PosY = FMath::Clamp<int32>(PosY, 0, (SrcHeight - 1));
 
-			int32 PosX = FMath::TruncToInt(SrcX+0.5f);
-			PosX = FMath::Clamp<int32>(PosX, 0, (SrcWidth - 1));
+				int32 PosX = FMath::TruncToInt(SrcX+0.5f);
+				PosX = FMath::Clamp<int32>(PosX, 0, (SrcWidth - 1));
 
-			int32 EndPosY = FMath::TruncToInt(EndY+0.5f);
-			EndPosY = FMath::Clamp<int32>(EndPosY, 0, (SrcHeight - 1));
+				int32 EndPosY = FMath::TruncToInt(EndY+0.5f);
+				EndPosY = FMath::Clamp<int32>(EndPosY, 0, (SrcHeight - 1));
 
-			int32 EndPosX = FMath::TruncToInt(EndX+0.5f);
-			EndPosX = FMath::Clamp<int32>(EndPosX, 0, (SrcWidth - 1));
+				int32 EndPosX = FMath::TruncToInt(EndX+0.5f);
+				EndPosX = FMath::Clamp<int32>(EndPosX, 0, (SrcWidth - 1));
 
-			FColor FinalColor;
-			if(bLinearSpace)
-			{
-				FLinearColor LinearStepColor(0.0f,0.0f,0.0f,0.0f);
-				for(int32 PixelX = PosX; PixelX <= EndPosX; PixelX++)
+				FColor FinalColor;
+				if(bLinearSpace)
 				{
-					for(int32 PixelY = PosY; PixelY <= EndPosY; PixelY++)
+					FLinearColor LinearStepColor(0.0f,0.0f,0.0f,0.0f);
+					for(int32 PixelX = PosX; PixelX <= EndPosX; PixelX++)
 					{
-						int32 StartPixel =  PixelX + PixelY * SrcWidth;
-
-						// Convert from gamma space to linear space before the addition.
-						LinearStepColor += SrcData[StartPixel];
-						PixelCount++;
+						for(int32 PixelY = PosY; PixelY <= EndPosY; PixelY++)
+						{
+							int32 StartPixel =  PixelX + PixelY * SrcWidth;
+
+							// Convert from gamma space to linear space before the addition.
+							LinearStepColor += SrcData[StartPixel];
+							PixelCount++;
+						}
 					}
-				}
-				LinearStepColor /= (float)PixelCount;
+					LinearStepColor /= (float)PixelCount;
 
-				// Convert back from linear space to gamma space.
-				FinalColor = LinearStepColor.ToFColor(true);
-			}
-			else
-			{
-				FVector StepColor(0,0,0);
-				for(int32 PixelX = PosX; PixelX <= EndPosX; PixelX++)
+					// Convert back from linear space to gamma space.
+					FinalColor = LinearStepColor.ToFColor(true);
+				}
+				else
 				{
-					for(int32 PixelY = PosY; PixelY <= EndPosY; PixelY++)
+					FVector StepColor(0,0,0);
+					for(int32 PixelX = PosX; PixelX <= EndPosX; PixelX++)
 					{
-						int32 StartPixel =  PixelX + PixelY * SrcWidth;
-						StepColor.X += (float)SrcData[StartPixel].R;
-						StepColor.Y += (float)SrcData[StartPixel].G;
-						StepColor.Z += (float)SrcData[StartPixel].B;
-						PixelCount++;
+						for(int32 PixelY = PosY; PixelY <= EndPosY; PixelY++)
+						{
+							int32 StartPixel =  PixelX + PixelY * SrcWidth;
+							StepColor.X += (float)SrcData[StartPixel].R;
+							StepColor.Y += (float)SrcData[StartPixel].G;
+							StepColor.Z += (float)SrcData[StartPixel].B;
+							PixelCount++;
+						}
 					}
+					StepColor /= (float)PixelCount;
+					uint8 FinalR = FMath::Clamp(FMath::TruncToInt(StepColor.X), 0, 255);
+					uint8 FinalG = FMath::Clamp(FMath::TruncToInt(StepColor.Y), 0, 255);
+					uint8 FinalB = FMath::Clamp(FMath::TruncToInt(StepColor.Z), 0, 255);
+					FinalColor = FColor(FinalR, FinalG, FinalB);
 				}
-				StepColor /= (float)PixelCount;
-				uint8 FinalR = FMath::Clamp(FMath::TruncToInt(StepColor.X), 0, 255);
-				uint8 FinalG = FMath::Clamp(FMath::TruncToInt(StepColor.Y), 0, 255);
-				uint8 FinalB = FMath::Clamp(FMath::TruncToInt(StepColor.Z), 0, 255);
-				FinalColor = FColor(FinalR, FinalG, FinalB);
-			}
 
-			// Store the final averaged pixel color value.
-			FinalColor.A = 255;
-			DstData[PixelPos] = FinalColor;
+				// Store the final averaged pixel color value.
+				FinalColor.A = 255;
+				DstData[PixelPos] = FinalColor;
 
-			SrcX = EndX;	
-			PixelPos++;
-		}
+				SrcX = EndX;	
+				PixelPos++;
+			}
 
-		SrcY += StepSizeY;
-	}
+			SrcY += StepSizeY;
+		}
+	}, bSingleThreaded);
 }
 
 /**
@@ -299,25 +313,20 @@ void FImageUtils::CropAndScaleImage( int32 SrcWidth, int32 SrcHeight, int32 Desi
 
 void FImageUtils::CompressImageArray( int32 ImageWidth, int32 ImageHeight, const TArray<FColor> &SrcData, TArray<uint8> &DstData )
 {
-	TArray<FColor> MutableSrcData = SrcData;
-
-	// PNGs are saved as RGBA but FColors are stored as BGRA. An option to swap the order upon compression may be added at 
-	// some point. At the moment, manually swapping Red and Blue 
-	for ( int32 Index = 0; Index < ImageWidth*ImageHeight; Index++ )
-	{
-		uint8 TempRed = MutableSrcData[Index].R;
-		MutableSrcData[Index].R = MutableSrcData[Index].B;
-		MutableSrcData[Index].B = TempRed;
-	}
-
 	FObjectThumbnail TempThumbnail;
 	TempThumbnail.SetImageSize( ImageWidth, ImageHeight );
 	TArray<uint8>& ThumbnailByteArray = TempThumbnail.AccessImageData();
 
-	// Copy scaled image into destination thumb
-	int32 MemorySize = ImageWidth*ImageHeight*sizeof(FColor);
-	ThumbnailByteArray.AddUninitialized(MemorySize);
-	FMemory::Memcpy(ThumbnailByteArray.GetData(), MutableSrcData.GetData(), MemorySize);
+	// PNGs are saved as RGBA but FColors are stored as BGRA. An option to swap the order upon compression may be added at 
+	// some point. At the moment, manually swapping Red and Blue while copying the image into the thumb
+	const int32 NumPixels = ImageWidth*ImageHeight;
+	ThumbnailByteArray.AddUninitialized(NumPixels*sizeof(FColor));
+	FColor* ThumbnailPixels = (FColor*)ThumbnailByteArray.GetData();
+	for ( int32 Index = 0; Index < NumPixels; Index++ )
+	{
+		const FColor& SrcColor = SrcData[Index];
+		ThumbnailPixels[Index] = FColor(SrcColor.B, SrcColor.G, SrcColor.R, SrcColor.A);
+	}
 
 	// Compress data - convert into a .png
 	TempThumbnail.CompressImageData();
@@ -325,6 +334,35 @@ void FImageUtils::CompressImageArray( int32 ImageWidth, int32 ImageHeight, const
 	DstData = TempThumbnail.AccessCompressedImageData();
 }
 
+TFuture<TArray64<uint8>> FImageUtils::CompressImageAsync(int32 ImageWidth, int32 ImageHeight, TArray<FColor>&& SrcData, EImageCompressionFormat Format, int32 Quality)
+{
+	EImageFormat ImageFormat = EImageFormat::PNG;
+	switch (Format)
+	{
+	case EImageCompressionFormat::JPEG:
+		ImageFormat = EImageFormat::JPEG;
+		break;
+	case EImageCompressionFormat::EXR:
+		ImageFormat = EImageFormat::EXR;
+		break;
+	}
+
+	// Modules can only be loaded on the game thread, the worker only uses the wrapper
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::Get().LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
+
+	return Async(EAsyncExecution::ThreadPool, [ImageWrapper, ImageWidth, ImageHeight, SrcData = MoveTemp(SrcData), Quality]()
+	{
+		TArray64<uint8> CompressedData;
+		if (ImageWrapper.IsValid() && SrcData.Num() >= ImageWidth * ImageHeight
+			&& ImageWrapper->SetRaw(SrcData.GetData(), (int64)ImageWidth * ImageHeight * sizeof(FColor), ImageWidth, ImageHeight, ERGBFormat::BGRA, 8))
+		{
+			CompressedData = ImageWrapper->GetCompressed(Quality);
+		}
+		return CompressedData;
+	});
+}
+
 UTexture2D* FImageUtils::CreateCheckerboardTexture(FColor ColorOne, FColor ColorTwo, int32 CheckerSize)
 {
 	CheckerSize = FMath::Min<uint32>( FMath::RoundUpToPowerOfTwo(CheckerSize), 4096 );
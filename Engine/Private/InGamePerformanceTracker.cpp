@@ -2,6 +2,7 @@
 
 #include "InGamePerformanceTracker.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
 #include "Engine/World.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogInGamePerformanceTracker, Log, All);
@@ -102,3 +103,68 @@ FWorldInGamePerformanceTrackers::~FWorldInGamePerformanceTrackers()
 {
 
 }
+
+//////////////////////////////////////////////////////////////////////////
+
+bool FPerformanceTrackingTimers::bEnabled = false;
+volatile int32 FPerformanceTrackingTimers::NumTimers = 0;
+volatile int64 FPerformanceTrackingTimers::FrameCycles[FPerformanceTrackingTimers::MaxTimers] = {};
+
+/** Names of the registered timers, only ever appended to */
+static FName GPerformanceTrackingTimerNames[FPerformanceTrackingTimers::MaxTimers];
+static FCriticalSection GPerformanceTrackingTimersCritical;
+
+int32 FPerformanceTrackingTimers::RegisterTimer(FName TimerName)
+{
+	FScopeLock Lock(&GPerformanceTrackingTimersCritical);
+
+	for (int32 TimerIndex = 0; TimerIndex < NumTimers; ++TimerIndex)
+	{
+		if (GPerformanceTrackingTimerNames[TimerIndex] == TimerName)
+		{
+			return TimerIndex;
+		}
+	}
+
+	if (NumTimers >= MaxTimers)
+	{
+		UE_LOG(LogInGamePerformanceTracker, Warning, TEXT("Can't register performance tracking timer %s, all %d timers are in use."), *TimerName.ToString(), MaxTimers);
+		return INDEX_NONE;
+	}
+
+	// Publish the name before the timer so that readers never see a timer without its name
+	GPerformanceTrackingTimerNames[NumTimers] = TimerName;
+	FPlatformMisc::MemoryBarrier();
+	return NumTimers++;
+}
+
+FName FPerformanceTrackingTimers::GetTimerName(int32 TimerIndex)
+{
+	return (TimerIndex >= 0 && TimerIndex < NumTimers) ? GPerformanceTrackingTimerNames[TimerIndex] : NAME_None;
+}
+
+void FPerformanceTrackingTimers::SetEnabled(bool bInEnabled)
+{
+	check(IsInGameThread());
+
+	if (bInEnabled && !bEnabled)
+	{
+		// Drop whatever was accumulated by scopes still running when the previous tracking stopped
+		for (int32 TimerIndex = 0; TimerIndex < MaxTimers; ++TimerIndex)
+		{
+			FPlatformAtomics::InterlockedExchange(&FrameCycles[TimerIndex], 0);
+		}
+	}
+	bEnabled = bInEnabled;
+}
+
+void FPerformanceTrackingTimers::ConsumeFrameTimes(TArray<double, TInlineAllocator<MaxTimers>>& OutSeconds)
+{
+	const int32 LocalNumTimers = NumTimers;
+	OutSeconds.SetNumUninitialized(LocalNumTimers);
+	for (int32 TimerIndex = 0; TimerIndex < LocalNumTimers; ++TimerIndex)
+	{
+		const int64 Cycles = FPlatformAtomics::InterlockedExchange(&FrameCycles[TimerIndex], 0);
+		OutSeconds[TimerIndex] = FPlatformTime::ToSeconds64((uint64)Cycles);
+	}
+}
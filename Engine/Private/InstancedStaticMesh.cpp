@@ -61,6 +61,14 @@ TAutoConsoleVariable<int32> CVarMinLOD(
 	TEXT("Used to discard the top LODs for performance evaluation. -1: Disable all effects of this cvar."),
 	ECVF_Scalability | ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarPartialInstanceBufferUpdates(
+	TEXT("r.InstancedStaticMeshes.PartialBufferUpdates"),
+	1,
+	TEXT("If 1, instance edits that don't change the number of instances only upload the ranges of instances they changed.\n")
+	TEXT("Instanced static mesh components also record transform and custom data edits as such when they keep a CPU copy of their instance buffer.\n")
+	TEXT("If 0, every edit recreates the whole instance buffer."),
+	ECVF_RenderThreadSafe);
+
 static TAutoConsoleVariable<int32> CVarRayTracingRenderInstances(
 	TEXT("r.RayTracing.InstancedStaticMeshes"),
 	1,
@@ -122,6 +130,7 @@ void HInstancedStaticMeshInstance::AddReferencedObjects(FReferenceCollector& Col
 FInstanceUpdateCmdBuffer::FInstanceUpdateCmdBuffer()
 	: NumAdds(0)
 	, NumEdits(0)
+	, NumInlineEdits(0)
 {
 }
 
@@ -133,6 +142,7 @@ void FInstanceUpdateCmdBuffer::HideInstance(int32 RenderIndex)
 	Cmd.InstanceIndex = RenderIndex;
 	Cmd.Type = FInstanceUpdateCmdBuffer::Hide;
 
+	NumInlineEdits++;
 	Edit();
 }
 
@@ -144,6 +154,7 @@ void FInstanceUpdateCmdBuffer::AddInstance(const FMatrix& InTransform)
 	Cmd.XForm = InTransform;
 
 	NumAdds++;
+	NumInlineEdits++;
 	Edit();
 }
 
@@ -154,6 +165,18 @@ void FInstanceUpdateCmdBuffer::UpdateInstance(int32 RenderIndex, const FMatrix&
 	Cmd.Type = FInstanceUpdateCmdBuffer::Update;
 	Cmd.XForm = InTransform;
 
+	NumInlineEdits++;
+	Edit();
+}
+
+void FInstanceUpdateCmdBuffer::UpdateInstanceTransform(int32 RenderIndex, const FMatrix& InTransform)
+{
+	FInstanceUpdateCommand& Cmd = Cmds.AddDefaulted_GetRef();
+	Cmd.InstanceIndex = RenderIndex;
+	Cmd.Type = FInstanceUpdateCmdBuffer::UpdateTransform;
+	Cmd.XForm = InTransform;
+
+	NumInlineEdits++;
 	Edit();
 }
 
@@ -165,6 +188,7 @@ void FInstanceUpdateCmdBuffer::SetEditorData(int32 RenderIndex, const FColor& Co
 	Cmd.HitProxyColor = Color;
 	Cmd.bSelected = bSelected;
 
+	NumInlineEdits++;
 	Edit();
 }
 
@@ -191,6 +215,7 @@ void FInstanceUpdateCmdBuffer::SetLightMapData(int32 RenderIndex, const FVector2
 		Cmd.LightmapUVBias = LightmapUVBias;
 	}
 
+	NumInlineEdits++;
 	Edit();
 }
 
@@ -217,6 +242,7 @@ void FInstanceUpdateCmdBuffer::SetShadowMapData(int32 RenderIndex, const FVector
 		Cmd.ShadowmapUVBias = ShadowmapUVBias;
 	}
 
+	NumInlineEdits++;
 	Edit();
 }
 
@@ -243,6 +269,7 @@ void FInstanceUpdateCmdBuffer::SetCustomData(int32 RenderIndex, const TArray<flo
 		Cmd.CustomDataFloats = CustomDataFloats;
 	}
 
+	NumInlineEdits++;
 	Edit();
 }
 
@@ -262,6 +289,7 @@ void FInstanceUpdateCmdBuffer::Reset()
 	Cmds.Empty();
 	NumAdds = 0;
 	NumEdits = 0;
+	NumInlineEdits = 0;
 }
 
 FStaticMeshInstanceBuffer::FStaticMeshInstanceBuffer(ERHIFeatureLevel::Type InFeatureLevel, bool InRequireCPUAccess)
@@ -300,6 +328,7 @@ void FStaticMeshInstanceBuffer::UpdateFromCommandBuffer_Concurrent(FInstanceUpda
 	
 	// leave NumEdits unchanged in commandbuffer
 	CmdBuffer.NumEdits = NewCmdBuffer->NumEdits; 
+	CmdBuffer.NumInlineEdits = NewCmdBuffer->NumInlineEdits;
 	CmdBuffer.ResetInlineCommands();
 		
 	ENQUEUE_RENDER_COMMAND(InstanceBuffer_UpdateFromPreallocatedData)(
@@ -318,6 +347,15 @@ void FStaticMeshInstanceBuffer::UpdateFromCommandBuffer_RenderThread(FInstanceUp
 	int32 NumAdds = CmdBuffer.NumAdds;
 	int32 AddIndex = INDEX_NONE;
 
+	// Without adds the buffers keep their size, so only the instances the commands touched need to be uploaded
+	const bool bPartialUpdate = NumAdds == 0 && RequireCPUAccess && IsInitialized() && IsValidRef(InstanceOriginBuffer.VertexBufferRHI) && CVarPartialInstanceBufferUpdates.GetValueOnRenderThread() != 0;
+	TArray<int32> DirtyInstances;
+	uint32 DirtyStreams = 0;
+	if (bPartialUpdate)
+	{
+		DirtyInstances.Reserve(NumCommands);
+	}
+
 	if (NumAdds > 0)
 	{
 		AddIndex = InstanceData->GetNumInstances();
@@ -340,31 +378,122 @@ void FStaticMeshInstanceBuffer::UpdateFromCommandBuffer_RenderThread(FInstanceUp
 		{
 		case FInstanceUpdateCmdBuffer::Add:
 			InstanceData->SetInstance(InstanceIndex, Cmd.XForm, 0);
+			DirtyStreams |= InstanceStream_All;
 			break;
 		case FInstanceUpdateCmdBuffer::Hide:
 			InstanceData->NullifyInstance(InstanceIndex);
+			DirtyStreams |= InstanceStream_All;
 			break;
 		case FInstanceUpdateCmdBuffer::Update:
 			InstanceData->SetInstance(InstanceIndex, Cmd.XForm, 0);
+			DirtyStreams |= InstanceStream_All;
+			break;
+		case FInstanceUpdateCmdBuffer::UpdateTransform:
+			InstanceData->SetInstanceTransform(InstanceIndex, Cmd.XForm);
+			DirtyStreams |= InstanceStream_Origin | InstanceStream_Transform;
 			break;
 		case FInstanceUpdateCmdBuffer::EditorData:
 			InstanceData->SetInstanceEditorData(InstanceIndex, Cmd.HitProxyColor, Cmd.bSelected);
+			DirtyStreams |= InstanceStream_Transform;
 			break;
 		case FInstanceUpdateCmdBuffer::LightmapData:
 			InstanceData->SetInstanceLightMapData(InstanceIndex, Cmd.LightmapUVBias, Cmd.ShadowmapUVBias);
+			DirtyStreams |= InstanceStream_Lightmap;
 			break;
 		case FInstanceUpdateCmdBuffer::CustomData:
 			for (int32 j = 0; j < InstanceData->GetNumCustomDataFloats(); ++j)
 			{
 				InstanceData->SetInstanceCustomData(Cmd.InstanceIndex, j, Cmd.CustomDataFloats[j]);
 			}
+			DirtyStreams |= InstanceStream_CustomData;
 			break;
 		default:
 			check(false);
 		}
+
+		if (bPartialUpdate)
+		{
+			DirtyInstances.Add(InstanceIndex);
+		}
 	}
 
-	UpdateRHI();
+	if (bPartialUpdate)
+	{
+		UpdateDirtyInstances(DirtyInstances, DirtyStreams);
+	}
+	else
+	{
+		UpdateRHI();
+	}
+}
+
+void FStaticMeshInstanceBuffer::UpdateDirtyInstances(TArray<int32>& DirtyInstances, uint32 DirtyStreams)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FStaticMeshInstanceBuffer_UpdateDirtyInstances);
+
+	if (DirtyInstances.Num() == 0)
+	{
+		return;
+	}
+
+	// Merge the touched instances into runs, instances closer than this are uploaded with the ones in between rather than locking again
+	const int32 MaxRunGap = 64;
+	const int32 MaxRuns = 64;
+
+	DirtyInstances.Sort();
+	TArray<TPair<int32, int32>, TInlineAllocator<16>> Runs;
+	for (const int32 InstanceIndex : DirtyInstances)
+	{
+		if (Runs.Num() > 0 && InstanceIndex <= Runs.Last().Value + MaxRunGap)
+		{
+			Runs.Last().Value = FMath::Max(Runs.Last().Value, InstanceIndex);
+		}
+		else
+		{
+			Runs.Emplace(InstanceIndex, InstanceIndex);
+		}
+	}
+
+	// Too scattered, a single lock spanning all of them is cheaper than many small ones
+	if (Runs.Num() > MaxRuns)
+	{
+		const int32 LastIndex = Runs.Last().Value;
+		Runs.SetNum(1);
+		Runs[0].Value = LastIndex;
+	}
+
+	const uint32 TransformStride = InstanceData->GetTranslationUsesHalfs() ? 8 : 16;
+	auto UpdateStream = [&Runs](FVertexBuffer& Buffer, FResourceArrayInterface* ResourceArray, uint32 Stride)
+	{
+		const uint8* SourceData = static_cast<const uint8*>(ResourceArray->GetResourceData());
+		for (const TPair<int32, int32>& Run : Runs)
+		{
+			const uint32 Offset = Run.Key * Stride;
+			const uint32 Size = (Run.Value - Run.Key + 1) * Stride;
+			check(Offset + Size <= ResourceArray->GetResourceDataSize());
+
+			void* DestData = RHILockVertexBuffer(Buffer.VertexBufferRHI, Offset, Size, RLM_WriteOnly);
+			FMemory::Memcpy(DestData, SourceData + Offset, Size);
+			RHIUnlockVertexBuffer(Buffer.VertexBufferRHI);
+		}
+	};
+
+	if (DirtyStreams & InstanceStream_Origin)
+	{
+		UpdateStream(InstanceOriginBuffer, InstanceData->GetOriginResourceArray(), 16);
+	}
+	if (DirtyStreams & InstanceStream_Transform)
+	{
+		UpdateStream(InstanceTransformBuffer, InstanceData->GetTransformResourceArray(), 3 * TransformStride);
+	}
+	if (DirtyStreams & InstanceStream_Lightmap)
+	{
+		UpdateStream(InstanceLightmapBuffer, InstanceData->GetLightMapResourceArray(), 8);
+	}
+	if ((DirtyStreams & InstanceStream_CustomData) && InstanceData->GetNumCustomDataFloats() > 0 && IsValidRef(InstanceCustomDataBuffer.VertexBufferRHI))
+	{
+		UpdateStream(InstanceCustomDataBuffer, InstanceData->GetCustomDataResourceArray(), InstanceData->GetNumCustomDataFloats() * sizeof(float));
+	}
 }
 
 /**
@@ -1483,11 +1612,20 @@ FPrimitiveSceneProxy* UInstancedStaticMeshComponent::CreateSceneProxy()
 		// generally happens only in editor 
 		if (InstanceUpdateCmdBuffer.NumTotalCommands() != 0)
 		{
-			InstanceUpdateCmdBuffer.Reset();
+			if (InstanceUpdateCmdBuffer.HasOnlyInlineCommands() && PerInstanceRenderData->InstanceBuffer.RequireCPUAccess)
+			{
+				// only the edited instances are uploaded
+				PerInstanceRenderData->UpdateFromCommandBuffer(InstanceUpdateCmdBuffer);
+				InstanceUpdateCmdBuffer.Reset();
+			}
+			else
+			{
+				InstanceUpdateCmdBuffer.Reset();
 
-			FStaticMeshInstanceData RenderInstanceData = FStaticMeshInstanceData(GVertexElementTypeSupport.IsSupported(VET_Half2));
-			BuildRenderData(RenderInstanceData, PerInstanceRenderData->HitProxies);
-			PerInstanceRenderData->UpdateFromPreallocatedData(RenderInstanceData);
+				FStaticMeshInstanceData RenderInstanceData = FStaticMeshInstanceData(GVertexElementTypeSupport.IsSupported(VET_Half2));
+				BuildRenderData(RenderInstanceData, PerInstanceRenderData->HitProxies);
+				PerInstanceRenderData->UpdateFromPreallocatedData(RenderInstanceData);
+			}
 		}
 		
 		ProxySize = PerInstanceRenderData->ResourceSize;
@@ -1714,8 +1852,15 @@ void UInstancedStaticMeshComponent::OnCreatePhysicsState()
 		return;
 	}
 
-	// Create all the bodies.
-	CreateAllInstanceBodies();
+	// Create all the bodies, or a single entry in the static collision store for all of them
+	if (ShouldUseStaticCollisionStore() && GetWorld()->GetOrCreateStaticCollisionStore().AddComponent(this, GetBodySetup()))
+	{
+		bInStaticCollisionStore = true;
+	}
+	else
+	{
+		CreateAllInstanceBodies();
+	}
 
 	USceneComponent::OnCreatePhysicsState();
 }
@@ -1726,6 +1871,24 @@ void UInstancedStaticMeshComponent::OnDestroyPhysicsState()
 
 	// Release all physics representations
 	ClearAllInstanceBodies();
+	RemoveFromStaticCollisionStore();
+}
+
+void UInstancedStaticMeshComponent::GetStaticCollisionStoreInstances(TArray<FTransform>& OutTransforms, TArray<int32>& OutItems) const
+{
+	OutTransforms.Reserve(PerInstanceSMData.Num());
+	OutItems.Reserve(PerInstanceSMData.Num());
+
+	// Same as CreateAllInstanceBodies, zero scale instances get no collision and the hit item is the instance index
+	for (int32 InstanceIndex = 0; InstanceIndex < PerInstanceSMData.Num(); ++InstanceIndex)
+	{
+		const FTransform InstanceTransform = FTransform(PerInstanceSMData[InstanceIndex].Transform) * GetComponentTransform();
+		if (!InstanceTransform.GetScale3D().IsNearlyZero())
+		{
+			OutTransforms.Add(InstanceTransform);
+			OutItems.Add(InstanceIndex);
+		}
+	}
 }
 
 bool UInstancedStaticMeshComponent::CanEditSimulatePhysics()
@@ -2246,8 +2409,7 @@ bool UInstancedStaticMeshComponent::SetCustomDataValue(int32 InstanceIndex, int3
 
 	PerInstanceSMCustomData[InstanceIndex * NumCustomDataFloats + CustomDataIndex] = CustomDataValue;
 
-	// Force recreation of the render data when proxy is created
-	InstanceUpdateCmdBuffer.Edit();
+	UpdateInstanceRenderCustomData(InstanceIndex, CanUpdateInstanceRenderDataInline(1));
 
 	if (bMarkRenderStateDirty)
 	{
@@ -2272,8 +2434,7 @@ bool UInstancedStaticMeshComponent::SetCustomData(int32 InstanceIndex, const TAr
 	const int32 NumToCopy = FMath::Min(InCustomData.Num(), NumCustomDataFloats);
 	FMemory::Memcpy(&PerInstanceSMCustomData[InstanceIndex * NumCustomDataFloats], InCustomData.GetData(), NumToCopy * InCustomData.GetTypeSize());
 
-	// Force recreation of the render data when proxy is created
-	InstanceUpdateCmdBuffer.Edit();
+	UpdateInstanceRenderCustomData(InstanceIndex, CanUpdateInstanceRenderDataInline(1));
 
 	if (bMarkRenderStateDirty)
 	{
@@ -2304,6 +2465,7 @@ bool UInstancedStaticMeshComponent::RemoveInstanceInternal(int32 InstanceIndex,
 #endif
 
 	// update the physics state
+	MarkStaticCollisionStoreDirty();
 	if (bPhysicsStateCreated && InstanceBodies.IsValidIndex(InstanceIndex))
 	{
 		if (FBodyInstance*& InstanceBody = InstanceBodies[InstanceIndex])
@@ -2373,6 +2535,13 @@ void UInstancedStaticMeshComponent::UpdateInstanceBodyTransform(int32 InstanceIn
 {
 	check(bPhysicsStateCreated);
 
+	if (bInStaticCollisionStore)
+	{
+		// The store re-reads every instance from PerInstanceSMData when it is next flushed
+		MarkStaticCollisionStoreDirty();
+		return;
+	}
+
 	FBodyInstance*& InstanceBodyInstance = InstanceBodies[InstanceIndex];
 #if WITH_PHYSX
 	if (WorldSpaceInstanceTransform.GetScale3D().IsNearlyZero())
@@ -2431,8 +2600,7 @@ bool UInstancedStaticMeshComponent::UpdateInstanceTransform(int32 InstanceIndex,
 	// Request navigation update
 	PartialNavigationUpdate(InstanceIndex);
 
-	// Force recreation of the render data when proxy is created
-	InstanceUpdateCmdBuffer.Edit();
+	UpdateInstanceRenderTransform(InstanceIndex, CanUpdateInstanceRenderDataInline(1));
 
 	if (bMarkRenderStateDirty)
 	{
@@ -2451,6 +2619,8 @@ bool UInstancedStaticMeshComponent::BatchUpdateInstancesTransforms(int32 StartIn
 
 	Modify();
 
+	const bool bUpdateInline = CanUpdateInstanceRenderDataInline(NewInstancesTransforms.Num());
+
 	int32 InstanceIndex = StartInstanceIndex;
 	for (const FTransform& NewInstanceTransform : NewInstancesTransforms)
 	{
@@ -2470,15 +2640,14 @@ bool UInstancedStaticMeshComponent::BatchUpdateInstancesTransforms(int32 StartIn
 			UpdateInstanceBodyTransform(InstanceIndex, WorldTransform, bTeleport);
 		}
 
+		UpdateInstanceRenderTransform(InstanceIndex, bUpdateInline);
+
 		InstanceIndex++;
 	}
 
 	// Request navigation update - Execute on a single index as it updates everything anyway
 	PartialNavigationUpdate(StartInstanceIndex);
 
-	// Force recreation of the render data when proxy is created
-	InstanceUpdateCmdBuffer.Edit();
-
 	if (bMarkRenderStateDirty)
 	{
 		MarkRenderStateDirty();
@@ -2496,6 +2665,8 @@ bool UInstancedStaticMeshComponent::BatchUpdateInstancesTransform(int32 StartIns
 
 	Modify();
 
+	const bool bUpdateInline = CanUpdateInstanceRenderDataInline(NumInstances);
+
 	int32 EndInstanceIndex = StartInstanceIndex + NumInstances;
 	for(int32 InstanceIndex = StartInstanceIndex; InstanceIndex < EndInstanceIndex; ++InstanceIndex)
 	{
@@ -2514,14 +2685,13 @@ bool UInstancedStaticMeshComponent::BatchUpdateInstancesTransform(int32 StartIns
 			FTransform WorldTransform = bWorldSpace ? NewInstancesTransform : (LocalTransform * GetComponentTransform());
 			UpdateInstanceBodyTransform(InstanceIndex, WorldTransform, bTeleport);
 		}
+
+		UpdateInstanceRenderTransform(InstanceIndex, bUpdateInline);
 	}
 
 	// Request navigation update - Execute on a single index as it updates everything anyway
 	PartialNavigationUpdate(StartInstanceIndex);
 
-	// Force recreation of the render data when proxy is created
-	InstanceUpdateCmdBuffer.Edit();
-
 	if(bMarkRenderStateDirty)
 	{
 		MarkRenderStateDirty();
@@ -2539,6 +2709,8 @@ bool UInstancedStaticMeshComponent::BatchUpdateInstancesData(int32 StartInstance
 
 	Modify();
 
+	const bool bUpdateInline = CanUpdateInstanceRenderDataInline(NumInstances);
+
 	for (int32 i = 0; i < NumInstances; ++i)
 	{
 		int32 InstanceIndex = StartInstanceIndex + i;
@@ -2552,14 +2724,13 @@ bool UInstancedStaticMeshComponent::BatchUpdateInstancesData(int32 StartInstance
 			FTransform WorldTransform = FTransform(InstanceData.Transform) * GetComponentTransform();
 			UpdateInstanceBodyTransform(InstanceIndex, WorldTransform, bTeleport);
 		}
+
+		UpdateInstanceRenderTransform(InstanceIndex, bUpdateInline);
 	}
 
 	// Request navigation update - Execute on a single index as it updates everything anyway
 	PartialNavigationUpdate(StartInstanceIndex);
 
-	// Force recreation of the render data when proxy is created
-	InstanceUpdateCmdBuffer.Edit();
-
 	if (bMarkRenderStateDirty)
 	{
 		MarkRenderStateDirty();
@@ -2568,6 +2739,53 @@ bool UInstancedStaticMeshComponent::BatchUpdateInstancesData(int32 StartInstance
 	return true;
 }
 
+bool UInstancedStaticMeshComponent::CanUpdateInstanceRenderDataInline(int32 NumInstancesToUpdate) const
+{
+	// Inline commands are applied to the CPU copy of the current render data, which must match the instances
+	// and not have pending edits that need a rebuild. Past the number of instances, a rebuild is cheaper.
+	return CVarPartialInstanceBufferUpdates.GetValueOnGameThread() != 0
+		&& PerInstanceRenderData.IsValid()
+		&& PerInstanceRenderData->InstanceBuffer.RequireCPUAccess
+		&& PerInstanceRenderData->InstanceBuffer_GameThread.IsValid()
+		&& PerInstanceRenderData->InstanceBuffer_GameThread->GetNumInstances() == PerInstanceSMData.Num()
+		&& InstanceUpdateCmdBuffer.HasOnlyInlineCommands()
+		&& InstanceUpdateCmdBuffer.NumInlineCommands() + NumInstancesToUpdate <= PerInstanceSMData.Num();
+}
+
+void UInstancedStaticMeshComponent::UpdateInstanceRenderTransform(int32 InstanceIndex, bool bInline)
+{
+	if (!bInline)
+	{
+		// Force recreation of the render data when proxy is created
+		InstanceUpdateCmdBuffer.Edit();
+	}
+	else
+	{
+		const int32 RenderIndex = GetRenderIndex(InstanceIndex);
+		if (RenderIndex != INDEX_NONE)
+		{
+			InstanceUpdateCmdBuffer.UpdateInstanceTransform(RenderIndex, PerInstanceSMData[InstanceIndex].Transform);
+		}
+	}
+}
+
+void UInstancedStaticMeshComponent::UpdateInstanceRenderCustomData(int32 InstanceIndex, bool bInline)
+{
+	if (!bInline)
+	{
+		// Force recreation of the render data when proxy is created
+		InstanceUpdateCmdBuffer.Edit();
+	}
+	else
+	{
+		const int32 RenderIndex = GetRenderIndex(InstanceIndex);
+		if (RenderIndex != INDEX_NONE && NumCustomDataFloats > 0)
+		{
+			InstanceUpdateCmdBuffer.SetCustomData(RenderIndex, TArray<float>(&PerInstanceSMCustomData[InstanceIndex * NumCustomDataFloats], NumCustomDataFloats));
+		}
+	}
+}
+
 TArray<int32> UInstancedStaticMeshComponent::GetInstancesOverlappingSphere(const FVector& Center, float Radius, bool bSphereInWorldSpace) const
 {
 	TArray<int32> Result;
@@ -2705,6 +2923,7 @@ void UInstancedStaticMeshComponent::ClearInstances()
 
 	// Release any physics representations
 	ClearAllInstanceBodies();
+	MarkStaticCollisionStoreDirty();
 
 	// Force recreation of the render data
 	InstanceUpdateCmdBuffer.Reset();
@@ -2730,7 +2949,11 @@ void UInstancedStaticMeshComponent::SetupNewInstanceData(FInstancedStaticMeshIns
 {
 	InOutNewInstanceData.Transform = InInstanceTransform.ToMatrixWithScale();
 
-	if (bPhysicsStateCreated)
+	if (bInStaticCollisionStore)
+	{
+		MarkStaticCollisionStoreDirty();
+	}
+	else if (bPhysicsStateCreated)
 	{
 		if (InInstanceTransform.GetScale3D().IsNearlyZero())
 		{
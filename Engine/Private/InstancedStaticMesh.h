@@ -152,6 +152,18 @@ private:
 	
 	/**  */
 	void UpdateFromCommandBuffer_RenderThread(FInstanceUpdateCmdBuffer& CmdBuffer);
+
+	enum EInstanceStream
+	{
+		InstanceStream_Origin = 1 << 0,
+		InstanceStream_Transform = 1 << 1,
+		InstanceStream_Lightmap = 1 << 2,
+		InstanceStream_CustomData = 1 << 3,
+		InstanceStream_All = InstanceStream_Origin | InstanceStream_Transform | InstanceStream_Lightmap | InstanceStream_CustomData,
+	};
+
+	/** Uploads the given instances of the dirty streams from the CPU copy into the existing buffers */
+	void UpdateDirtyInstances(TArray<int32>& DirtyInstances, uint32 DirtyStreams);
 };
 
 /*-----------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 #include "ClearQuad.h"
 #include "Engine/Texture2D.h"
 #include "RHI.h"
+#include "RenderTargetAsyncReadback.h"
 
 #if WITH_EDITOR
 #include "AssetRegistryModule.h"
@@ -320,6 +321,16 @@ FColor UKismetRenderingLibrary::ReadRenderTargetPixel(UObject* WorldContextObjec
 	}
 }
 
+void UKismetRenderingLibrary::ReadRenderTargetPixelsAsync(UObject* WorldContextObject, UTextureRenderTarget2D* TextureRenderTarget, FOnRenderTargetPixelsRead OnPixelsRead, int32 X, int32 Y, int32 Width, int32 Height)
+{
+	const FIntRect Rect = (Width > 0 && Height > 0) ? FIntRect(X, Y, X + Width, Y + Height) : FIntRect();
+
+	FRenderTargetAsyncReadback::ReadPixels(TextureRenderTarget, [OnPixelsRead](FRenderTargetReadbackResult&& Result)
+	{
+		OnPixelsRead.ExecuteIfBound(Result.bSuccess, Result.Pixels);
+	}, Rect);
+}
+
 FLinearColor UKismetRenderingLibrary::ReadRenderTargetRawPixel(UObject * WorldContextObject, UTextureRenderTarget2D * TextureRenderTarget, int32 X, int32 Y)
 {
 	TArray<FColor> Samples;
@@ -2162,6 +2162,7 @@ void UKismetSystemLibrary::RetriggerableDelay(UObject* WorldContextObject, float
 		{
 			// Reset the existing delay to the new duration
 			Action->TimeRemaining = Duration;
+			LatentActionManager.RestartAction(LatentInfo.CallbackTarget, Action);
 		}
 	}
 }
@@ -18,6 +18,7 @@
 #include "UObject/FrameworkObjectVersion.h"
 #include "UObject/FortniteMainBranchObjectVersion.h"
 #include "Engine/HLODProxy.h"
+#include "PrimitiveSceneProxy.h"
 #include "UObject/PropertyPortFlags.h"
 
 #if WITH_EDITOR
@@ -63,6 +64,13 @@ static TAutoConsoleVariable<int32> CVarHLODForceDisableCastDynamicShadow(
 	TEXT("If non-zero, will set bCastDynamicShadow to false for all LODActors, regardless of the shadowing setting of their subactors."),
 	ECVF_ReadOnly);
 
+static int32 GHLODUpdateDrawDistanceInPlace = 1;
+static FAutoConsoleVariableRef CVarHLODUpdateDrawDistanceInPlace(
+	TEXT("r.HLOD.UpdateDrawDistanceInPlace"),
+	GHLODUpdateDrawDistanceInPlace,
+	TEXT("If non-zero, HLOD transitions change the draw distance of the LOD actor's existing scene proxies and update their transform, instead of recreating their render state."),
+	ECVF_Default);
+
 ENGINE_API TArray<float> ALODActor::HLODDistances;
 
 #if !(UE_BUILD_SHIPPING)
@@ -310,20 +318,43 @@ void ALODActor::SetComponentsMinDrawDistance(float InMinDrawDistance, bool bInMa
 {
 	float MinDrawDistance = FMath::Max(0.0f, InMinDrawDistance);
 
-	StaticMeshComponent->MinDrawDistance = MinDrawDistance;
-	if (bInMarkRenderStateDirty)
+	TArray<UPrimitiveComponent*, TInlineAllocator<4>> Components;
+	Components.Add(StaticMeshComponent);
+	for (const TPair<const UMaterialInterface*, UInstancedStaticMeshComponent*>& Component : ImpostersStaticMeshComponents)
 	{
-		StaticMeshComponent->MarkRenderStateDirty();
+		Components.Add(Component.Value);
 	}
 
-	for (const TPair<const UMaterialInterface*, UInstancedStaticMeshComponent*>& Component : ImpostersStaticMeshComponents)
+	// Proxies that only need their draw distance changed are updated by one render command for the whole LOD actor
+	TArray<FPrimitiveSceneProxy*, TInlineAllocator<4>> SceneProxies;
+	for (UPrimitiveComponent* Component : Components)
 	{
-		Component.Value->MinDrawDistance = MinDrawDistance;
+		Component->MinDrawDistance = MinDrawDistance;
 		if (bInMarkRenderStateDirty)
 		{
-			Component.Value->MarkRenderStateDirty();
+			if (GHLODUpdateDrawDistanceInPlace && Component->SceneProxy && !Component->IsRenderStateDirty())
+			{
+				SceneProxies.Add(Component->SceneProxy);
+				Component->MarkRenderTransformDirty();
+			}
+			else
+			{
+				Component->MarkRenderStateDirty();
+			}
 		}
 	}
+
+	if (SceneProxies.Num() > 0)
+	{
+		ENQUEUE_RENDER_COMMAND(UpdateHLODMinDrawDistance)(
+			[SceneProxies, MinDrawDistance](FRHICommandListImmediate&)
+		{
+			for (FPrimitiveSceneProxy* SceneProxy : SceneProxies)
+			{
+				SceneProxy->SetMinDrawDistance_RenderThread(MinDrawDistance);
+			}
+		});
+	}
 }
 
 /** Returns an array of distances that are used to override individual LOD actors min draw distances. */
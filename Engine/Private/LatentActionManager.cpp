@@ -29,9 +29,24 @@ void FLatentActionManager::AddNewAction(UObject* InActionObject, int32 UUID, FPe
 	}
 	ObjectActions->ActionList.Add(UUID, NewAction);
 
+	// The first update gets the delta time of the frame, the object may be asleep since long before
+	NewAction->LastUpdateTime = ObjectActions->ElapsedTime;
+	NewAction->NextUpdateTime = 0.0;
+	ObjectActions->NextUpdateTime = 0.0;
+
 	LatentActionsChangedDelegate.Broadcast(InActionObject, ELatentActionChangeType::ActionsAdded);
 }
 
+void FLatentActionManager::RestartAction(UObject* InActionObject, FPendingLatentAction* Action)
+{
+	if (FObjectActions* ObjectActions = GetActionsForObject(InActionObject))
+	{
+		Action->LastUpdateTime = ObjectActions->ElapsedTime;
+		Action->NextUpdateTime = 0.0;
+		ObjectActions->NextUpdateTime = 0.0;
+	}
+}
+
 void FLatentActionManager::RemoveActionsForObject(TWeakObjectPtr<UObject> InObject)
 {
 	FObjectActions* ObjectActions = GetActionsForObject(InObject);
@@ -120,7 +135,10 @@ void FLatentActionManager::ProcessLatentActions(UObject* InObject, float DeltaTi
 		{
 			if (!ObjectActions->bProcessedThisFrame)
 			{
-				TickLatentActionForObject(DeltaTime, ObjectActions->ActionList, InObject);
+				if (ObjectActions->AdvanceClock(DeltaTime))
+				{
+					TickLatentActionForObject(DeltaTime, *ObjectActions, InObject);
+				}
 				ObjectActions->bProcessedThisFrame = true;
 			}
 		}
@@ -129,18 +147,27 @@ void FLatentActionManager::ProcessLatentActions(UObject* InObject, float DeltaTi
 	{
 		for (FObjectToActionListMap::TIterator ObjIt(ObjectToActionListMap); ObjIt; ++ObjIt)
 		{	
-			TWeakObjectPtr<UObject> WeakPtr = ObjIt.Key();
-			UObject* Object = WeakPtr.Get();
 			FObjectActions* ObjectActions = ObjIt.Value().Get();
 			check(ObjectActions);
 			FActionList& ObjectActionList = ObjectActions->ActionList;
 
+			// Objects whose actions are all waiting only advance their clock, they are not even resolved until one of them is due.
+			// This also delays noticing that such an object was garbage collected until then.
+			if (!ObjectActions->bProcessedThisFrame && ObjectActionList.Num() > 0 && !ObjectActions->AdvanceClock(DeltaTime))
+			{
+				ObjectActions->bProcessedThisFrame = true;
+				continue;
+			}
+
+			TWeakObjectPtr<UObject> WeakPtr = ObjIt.Key();
+			UObject* Object = WeakPtr.Get();
+
 			if (Object)
 			{
 				// Tick all outstanding actions for this object
 				if (!ObjectActions->bProcessedThisFrame && ObjectActionList.Num() > 0)
 				{
-					TickLatentActionForObject(DeltaTime, ObjectActionList, Object);
+					TickLatentActionForObject(DeltaTime, *ObjectActions, Object);
 					ensure(ObjectActions == ObjIt.Value().Get());
 					ObjectActions->bProcessedThisFrame = true;
 				}
@@ -168,17 +195,34 @@ void FLatentActionManager::ProcessLatentActions(UObject* InObject, float DeltaTi
 	}
 }
 
-void FLatentActionManager::TickLatentActionForObject(float DeltaTime, FActionList& ObjectActionList, UObject* InObject)
+void FLatentActionManager::TickLatentActionForObject(float DeltaTime, FObjectActions& ObjectActions, UObject* InObject)
 {
 	typedef TPair<int32, FPendingLatentAction*> FActionListPair;
 	TArray<FActionListPair, TInlineAllocator<4>> ItemsToRemove;
+	FActionList& ObjectActionList = ObjectActions.ActionList;
+	const double Now = ObjectActions.ElapsedTime;
+	double NextUpdateTime = TNumericLimits<double>::Max();
+
+	// Actions added or restarted from UpdateOperation bring this back to 0
+	ObjectActions.NextUpdateTime = TNumericLimits<double>::Max();
 	
 	FLatentResponse Response(DeltaTime);
 	for (TMultiMap<int32, FPendingLatentAction*>::TConstIterator It(ObjectActionList); It; ++It)
 	{
 		FPendingLatentAction* Action = It.Value();
 
+		if (Action->NextUpdateTime > Now)
+		{
+			// Still waiting
+			NextUpdateTime = FMath::Min(NextUpdateTime, Action->NextUpdateTime);
+			continue;
+		}
+
 		Response.bRemoveAction = false;
+		Response.WaitTime = 0.f;
+
+		// Actions that were updated last frame get DeltaTime, the ones that were waiting get the whole wait
+		Response.DeltaTime = (float)(Now - Action->LastUpdateTime);
 
 		Action->UpdateOperation(Response);
 
@@ -186,8 +230,17 @@ void FLatentActionManager::TickLatentActionForObject(float DeltaTime, FActionLis
 		{
 			ItemsToRemove.Emplace(It.Key(), Action);
 		}
+		else
+		{
+			Action->LastUpdateTime = Now;
+			Action->NextUpdateTime = (Response.WaitTime > 0.f) ? Now + Response.WaitTime : 0.0;
+			NextUpdateTime = FMath::Min(NextUpdateTime, Action->NextUpdateTime);
+		}
 	}
 
+	NextUpdateTime = FMath::Min(NextUpdateTime, ObjectActions.NextUpdateTime);
+	ObjectActions.NextUpdateTime = (NextUpdateTime == TNumericLimits<double>::Max()) ? 0.0 : NextUpdateTime;
+
 	// Remove any items that were deleted
 	for (const FActionListPair& ItemPair : ItemsToRemove)
 	{
@@ -43,6 +43,7 @@ Level.cpp: Level-related functions
 #include "TickTaskManagerInterface.h"
 #include "UObject/ReleaseObjectVersion.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/BodyInstance.h"
 #include "EngineGlobals.h"
 #include "Engine/LevelBounds.h"
 #include "Async/ParallelFor.h"
@@ -940,8 +941,16 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 	}
 
 	int32 PreviousIndex = CurrentActorIndexForUpdateComponents;
-	// Find next valid actor to process components registration
 
+	{
+	// Static bodies of the registered components are created together and added to the physics scene at once when this goes out of scope
+	TOptional<FScopedBodyInstanceInitBatch> InitBodiesBatch;
+	if (OwningWorld && OwningWorld->IsGameWorld())
+	{
+		InitBodiesBatch.Emplace();
+	}
+
+	// Find next valid actor to process components registration
 	while (CurrentActorIndexForUpdateComponents < Actors.Num())
 	{
 		AActor* Actor = Actors[CurrentActorIndexForUpdateComponents];
@@ -973,6 +982,7 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 			break;
 		}
 	}
+	}
 
 	// See whether we are done.
 	if (CurrentActorIndexForUpdateComponents >= Actors.Num())
@@ -1052,6 +1062,70 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 }
 
 
+bool ULevel::IncrementalCreatePhysicsState()
+{
+	while (CurrentActorIndexForPhysicsState < Actors.Num())
+	{
+		AActor* Actor = Actors[CurrentActorIndexForPhysicsState++];
+		if (Actor && !Actor->IsPendingKill())
+		{
+#if PERF_TRACK_DETAILED_ASYNC_STATS
+			FScopeCycleCounterUObject ContextScope(Actor);
+#endif
+			// Components create their own physics state from here on, including ones registered later by this actor
+			TInlineComponentArray<UActorComponent*> Components(Actor);
+			bDeferComponentPhysicsState = false;
+			for (UActorComponent* Component : Components)
+			{
+				if (Component->IsRegistered() && !Component->IsPhysicsStateCreated())
+				{
+					Component->CreatePhysicsState();
+				}
+			}
+			bDeferComponentPhysicsState = true;
+
+			// Return after each actor that did any work so the caller can check its time limit
+			break;
+		}
+	}
+
+	if (CurrentActorIndexForPhysicsState >= Actors.Num())
+	{
+		CurrentActorIndexForPhysicsState = 0;
+		bDeferComponentPhysicsState = false;
+		return true;
+	}
+
+	return false;
+}
+
+bool ULevel::IncrementalUpdateInitialOverlaps()
+{
+	while (CurrentActorIndexForInitialOverlaps < Actors.Num())
+	{
+		AActor* Actor = Actors[CurrentActorIndexForInitialOverlaps++];
+		if (Actor && !Actor->IsPendingKill() && Actor->HasActorBegunPlay())
+		{
+#if PERF_TRACK_DETAILED_ASYNC_STATS
+			FScopeCycleCounterUObject ContextScope(Actor);
+#endif
+			Actor->UpdateInitialOverlaps(/*bFromLevelStreaming*/ true);
+
+			// Return after each actor that did any work so the caller can check its time limit
+			break;
+		}
+	}
+
+	if (CurrentActorIndexForInitialOverlaps >= Actors.Num())
+	{
+		CurrentActorIndexForInitialOverlaps = 0;
+		bDeferInitialOverlaps = false;
+		return true;
+	}
+
+	return false;
+}
+
 bool ULevel::IncrementalUnregisterComponents(int32 NumComponentsToUnregister)
 {
 	// A value of 0 means that we want to unregister all components.
@@ -37,6 +37,7 @@
 #include "GameFramework/WorldSettings.h"
 #include "Engine/NetDriver.h"
 #include "Engine/Player.h"
+#include "Interfaces/PoolableActorInterface.h"
 
 #include "Components/BoxComponent.h"
 #include "GameFramework/MovementComponent.h"
@@ -468,6 +469,17 @@ AActor* UWorld::SpawnActor( UClass* Class, FTransform const* UserTransformPtr, c
 		}
 	}
 
+	// Recycle a parked actor if the class opted into pooling. Named and deferred spawns, and spawns that may adjust their location, always construct a new actor.
+	if (IsGameWorld() && SpawnParameters.Name.IsNone() && !SpawnParameters.bDeferConstruction
+		&& (CollisionHandlingMethod == ESpawnActorCollisionHandlingMethod::AlwaysSpawn || CollisionHandlingMethod == ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding)
+		&& Class->ImplementsInterface(UPoolableActorInterface::StaticClass()))
+	{
+		if (AActor* const PooledActor = ActorPool.Acquire(Template, LevelToSpawnIn, UserTransform, SpawnParameters))
+		{
+			return PooledActor;
+		}
+	}
+
 	// actually make the actor object
 	AActor* const Actor = NewObject<AActor>(LevelToSpawnIn, Class, NewActorName, SpawnParameters.ObjectFlags, Template);
 	check(Actor);
@@ -629,6 +641,12 @@ bool UWorld::DestroyActor( AActor* ThisActor, bool bNetForce, bool bShouldModify
 			FSetActorWantsDestroyDuringBeginPlay SetActorWantsDestroyDuringBeginPlay(ThisActor);
 			return true; // while we didn't actually destroy it now, we are going to, so tell the calling code it succeeded
 		}
+
+		// Actors that opted into pooling are parked in the world's actor pool instead, with their components left registered
+		if (!bNetForce && ActorPool.Reclaim(ThisActor))
+		{
+			return true;
+		}
 	}
 	else
 	{
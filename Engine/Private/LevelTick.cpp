@@ -27,6 +27,7 @@
 #include "GameFramework/Controller.h"
 #include "AI/NavigationSystemBase.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "SceneUtils.h"
 #include "ParticleHelper.h"
 #include "Engine/LevelStreaming.h"
@@ -35,6 +36,7 @@
 #include "Engine/LevelStreamingVolume.h"
 #include "Engine/WorldComposition.h"
 #include "Collision.h"
+#include "Components/PrimitiveComponent.h"
 #include "PhysicsPublic.h"
 #include "Tickable.h"
 #include "IHeadMountedDisplay.h"
@@ -553,9 +555,50 @@ private:
 	bool bShouldChangeVisibility;
 };
 
+static TAutoConsoleVariable<float> CVarStreamingVolumePrefetchTime(
+	TEXT("s.StreamingVolumePrefetchTime"),
+	0.f,
+	TEXT("Seconds ahead to predict where each player's view target will be from its velocity. Streaming volumes containing a predicted location\n")
+	TEXT("start loading their levels (without making them visible) before the view gets there. 0 disables prefetching."));
+
+static TAutoConsoleVariable<int32> CVarStreamingVolumePrefetchSamples(
+	TEXT("s.StreamingVolumePrefetchSamples"),
+	4,
+	TEXT("Number of predicted locations, evenly spaced over s.StreamingVolumePrefetchTime, tested against streaming volumes."));
+
+static TAutoConsoleVariable<float> CVarStreamingVolumePrefetchMinSpeed(
+	TEXT("s.StreamingVolumePrefetchMinSpeed"),
+	600.f,
+	TEXT("View targets moving slower than this (in cm/s) do not prefetch, the regular volume test is early enough for them."));
+
+/** Appends the locations the player's view is predicted to go through over the prefetch window, nearest first */
+static void GetStreamingVolumePrefetchLocations(const APlayerController* PlayerController, const FVector& ViewLocation, TArray<FVector, TInlineAllocator<8>>& OutLocations)
+{
+	const float PrefetchTime = CVarStreamingVolumePrefetchTime.GetValueOnGameThread();
+	const int32 NumSamples = FMath::Clamp(CVarStreamingVolumePrefetchSamples.GetValueOnGameThread(), 0, 8);
+	const AActor* ViewTarget = PlayerController->GetViewTarget();
+	if (PrefetchTime <= 0.f || NumSamples == 0 || ViewTarget == nullptr)
+	{
+		return;
+	}
+
+	const FVector Velocity = ViewTarget->GetVelocity();
+	if (Velocity.SizeSquared() < FMath::Square(CVarStreamingVolumePrefetchMinSpeed.GetValueOnGameThread()))
+	{
+		return;
+	}
+
+	for (int32 SampleIndex = 1; SampleIndex <= NumSamples; ++SampleIndex)
+	{
+		OutLocations.Add(ViewLocation + Velocity * (PrefetchTime * SampleIndex / NumSamples));
+	}
+}
+
 /**
  * Issues level streaming load/unload requests based on whether
  * players are inside/outside level streaming volumes.
+ * With s.StreamingVolumePrefetchTime set, levels whose volumes the players are heading into are loaded ahead of time,
+ * and unloaded by the regular volume logic if the prediction stops hitting them.
  */
 void UWorld::ProcessLevelStreamingVolumes(FVector* OverrideViewLocation)
 {
@@ -640,6 +683,11 @@ void UWorld::ProcessLevelStreamingVolumes(FVector* OverrideViewLocation)
 
 				TMap<AVolume*,bool> VolumeMap;
 
+				// Where the view is heading, only used to start loading levels early
+				TArray<FVector, TInlineAllocator<8>> PrefetchLocations;
+				GetStreamingVolumePrefetchLocations(PlayerActor, ViewLocation, PrefetchLocations);
+				TMap<AVolume*,bool> PrefetchVolumeMap;
+
 				// Iterate over streaming levels with volumes and compute whether the
 				// player's ViewLocation is in any of their volumes.
 				for( int32 LevelIndex = 0 ; LevelIndex < LevelStreamingObjectsWithVolumes.Num() ; ++LevelIndex )
@@ -700,6 +748,28 @@ void UWorld::ProcessLevelStreamingVolumes(FVector* OverrideViewLocation)
 									break;
 								}
 							}
+							else if ( PrefetchLocations.Num() > 0 && StreamingVolume->StreamingUsage != SVB_BlockingOnLoad )
+							{
+								// Blocking only volumes never unload their level, so they are left out of prefetching
+								bool bPredictedInVolume;
+								if ( bool* bPrefetchResult = PrefetchVolumeMap.Find(StreamingVolume) )
+								{
+									bPredictedInVolume = *bPrefetchResult;
+								}
+								else
+								{
+									bPredictedInVolume = PrefetchLocations.ContainsByPredicate([StreamingVolume](const FVector& Location) { return StreamingVolume->EncompassesPoint(Location); });
+									PrefetchVolumeMap.Add( StreamingVolume, bPredictedInVolume );
+									INC_DWORD_STAT_BY( STAT_VolumeStreamingChecks, PrefetchLocations.Num() );
+								}
+
+								if ( bPredictedInVolume )
+								{
+									// Load only, visibility is left to the volume once the view is actually inside it
+									StreamingSettings |= FVisibleLevelStreamingSettings( SVB_Loading );
+									VisibleLevelStreamingObjects.Add( LevelStreamingObject, StreamingSettings );
+								}
+							}
 						}
 					}
 				} // for each streaming level 
@@ -781,6 +851,18 @@ void UWorld::RunTickGroup(ETickingGroup Group, bool bBlockTillComplete = true)
 	check(TickGroup == Group); // this should already be at the correct value, but we want to make sure things are happening in the right order
 	FTickTaskManagerInterface::Get().RunTickGroup(Group, bBlockTillComplete);
 	TickGroup = ETickingGroup(TickGroup + 1); // new actors go into the next tick group because this one is already gone
+
+	// Children of components that moved during the group catch up once, now that nothing of the group is still running
+	if (bBlockTillComplete)
+	{
+		USceneComponent::FlushDeferredChildTransformUpdates(this);
+
+		// Once physics results are in, components that deferred their overlaps update them in one batch
+		if (Group == TG_PostPhysics)
+		{
+			UPrimitiveComponent::FlushDeferredOverlapUpdates(this);
+		}
+	}
 }
 
 static TAutoConsoleVariable<int32> CVarAllowAsyncRenderThreadUpdates(
@@ -982,6 +1064,10 @@ void UWorld::SendAllEndOfFrameUpdates()
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(EndOfFrameUpdates);
 	CSV_SCOPED_SET_WAIT_STAT(EndOfFrameUpdates);
 
+	// Moves made outside of the tick groups must reach the children before their render transforms are sent
+	USceneComponent::FlushDeferredChildTransformUpdates(this);
+	UPrimitiveComponent::FlushDeferredOverlapUpdates(this);
+
 	if (!HasEndOfFrameUpdates())
 	{
 		return;
@@ -1359,6 +1445,12 @@ void EndTickDrawEvent(FDrawEvent* TickDrawEvent)
  * Update the level after a variable amount of time, DeltaSeconds, has passed.
  * All child actors are ticked after their owners have been ticked.
  */
+static TAutoConsoleVariable<int32> CVarRunTimersDuringPhysics(
+	TEXT("tick.RunTimersDuringPhysics"),
+	0,
+	TEXT("If non-zero, latent actions and timers are processed once TG_DuringPhysics is done on the game thread, while the physics simulation is still running,\n")
+	TEXT("instead of after TG_PostPhysics. Neither depends on the simulation results, but timers then fire before the post physics ticks of the frame."));
+
 void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 {
 	SCOPE_TIME_GUARD(TEXT("UWorld::Tick"));
@@ -1371,6 +1463,8 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		return;
 	}
 
+	SCOPE_PERFORMANCE_TRACKING_TIMER(WorldTick);
+
 	FDrawEvent* TickDrawEvent = BeginTickDrawEvent();
 
 	FWorldDelegates::OnWorldTickStart.Broadcast(this, TickType, DeltaSeconds);
@@ -1425,6 +1519,9 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		BroadcastTickDispatch(DeltaSeconds);
 		BroadcastPostTickDispatch();
 
+		// Simulate the client moves that servers queued while receiving packets
+		UCharacterMovementComponent::ProcessAllQueuedServerMoves(this);
+
 		if( NetDriver && NetDriver->ServerConnection )
 		{
 			TickNetClient( DeltaSeconds );
@@ -1509,6 +1606,11 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 			SCOPE_CYCLE_COUNTER(STAT_ResetAsyncTraceTickTime);
 			ResetAsyncTrace();
 		}
+		if (StaticCollisionStore.IsValid())
+		{
+			// Bring the static collision store up to date before this frame's async traces are issued, task threads never rebuild it themselves
+			StaticCollisionStore->Flush();
+		}
 		{
 			// Run pre-actor tick delegates that want clamped/dilated time
 			SCOPE_CYCLE_COUNTER(STAT_TickTime);
@@ -1541,6 +1643,9 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		// Set up context on the world for this level collection
 		FScopedLevelCollectionContextSwitch LevelContext(i, this);
 
+		// Only for the source level collection, as below
+		const bool bRunTimersDuringPhysics = bDoingActorTicks && LevelCollections[i].GetType() == ELevelCollectionType::DynamicSourceLevels && CVarRunTimersDuringPhysics.GetValueOnGameThread() != 0;
+
 		// If caller wants time update only, or we are paused, skip the rest.
 		if (bDoingActorTicks)
 		{
@@ -1574,6 +1679,16 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 				CSV_SCOPED_SET_WAIT_STAT(DuringPhysics);
 				RunTickGroup(TG_DuringPhysics, false); // No wait here, we should run until idle though. We don't care if all of the async ticks are done before we start running post-phys stuff
 			}
+			if (bRunTimersDuringPhysics)
+			{
+				// The game thread would otherwise be waiting on the simulation in TG_EndPhysics
+				CurrentLatentActionManager.ProcessLatentActions(nullptr, DeltaSeconds);
+
+				SCOPE_CYCLE_COUNTER(STAT_TickableTickTime);
+				SCOPE_TIME_GUARD_MS(TEXT("UWorld::Tick - TimerManager"), 5);
+				STAT(FScopeCycleCounter Context(GetTimerManager().GetStatId());)
+				GetTimerManager().Tick(DeltaSeconds);
+			}
 			TickGroup = TG_EndPhysics; // set this here so the current tick group is correct during collision notifies, though I am not sure it matters. 'cause of the false up there^^^
 			{
 				SCOPE_CYCLE_COUNTER(STAT_TG_EndPhysics);
@@ -1600,7 +1715,7 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		if (LevelCollections[i].GetType() == ELevelCollectionType::DynamicSourceLevels)
 		{
 			// Process any remaining latent actions
-			if( !bIsPaused )
+			if( !bIsPaused && !bRunTimersDuringPhysics )
 			{
 				// This will process any latent actions that have not been processed already
 				CurrentLatentActionManager.ProcessLatentActions(nullptr, DeltaSeconds);
@@ -1618,7 +1733,7 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 			{
 				SCOPE_CYCLE_COUNTER(STAT_TickableTickTime);
 
-				if (TickType != LEVELTICK_TimeOnly && !bIsPaused)
+				if (TickType != LEVELTICK_TimeOnly && !bIsPaused && !bRunTimersDuringPhysics)
 				{
 					SCOPE_TIME_GUARD_MS(TEXT("UWorld::Tick - TimerManager"), 5);
 					STAT(FScopeCycleCounter Context(GetTimerManager().GetStatId());)
@@ -76,6 +76,8 @@ ENGINE_API FColor GTexelSelectionColor(255, 50, 0);
 	ENGINE_API uint64 GLightmapTotalSize = 0;
 	/** Total memory size for streaming lightmaps (in bytes). */
 	ENGINE_API uint64 GLightmapTotalStreamingSize = 0;
+	/** Texels of streaming lightmap textures that no mapping uses, streamed in for nothing. */
+	ENGINE_API uint64 GNumLightmapStreamedWastedTexels = 0;
 #endif
 
 static TAutoConsoleVariable<int32> CVarTexelDebugging(
@@ -100,6 +102,14 @@ static TAutoConsoleVariable<int32> CVarIncludeNonVirtualTexturedLightMaps(
 	TEXT(" 0: Not included.\n") \
 	TEXT(" 1: Included."));
 
+static TAutoConsoleVariable<float> CVarLightmapPackingCellSize(
+	TEXT("r.LightmapPackingCellSize"),
+	0.0f,
+	TEXT("If > 0, lighting builds only pack lightmaps into the same texture when the centers of their primitives are in the same cell of this size (in world units).\n")
+	TEXT("Textures then hold the lightmaps of one region of the level, so streaming in a visible region pulls mips from fewer textures, at the cost of more, less full textures.\n")
+	TEXT(" 0: Disabled, lightmaps are packed by size only."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarVTEnableLossyCompressLightmaps(
 	TEXT("r.VT.EnableLossyCompressLightmaps"),
 	0,
@@ -355,6 +365,7 @@ struct FLightMapAllocationGroup
 		: Outer(nullptr)
 		, LightmapFlags(LMF_None)
 		, Bounds(ForceInit)
+		, PackingCell(ForceInitToZero)
 		, TotalTexels(0)
 	{
 	}
@@ -374,6 +385,9 @@ struct FLightMapAllocationGroup
 	// Used to group nearby allocations into the same lightmap texture
 	FBoxSphereBounds Bounds;
 
+	// Cell of the bounds origin when packing by r.LightmapPackingCellSize, allocations are only packed with those of the same cell
+	FIntVector		PackingCell;
+
 	int32			TotalTexels;
 };
 
@@ -655,6 +669,10 @@ void FLightMapPendingTexture::PostEncode()
 	GNumLightmapMappedTexels += NumLightmapMappedTexels;
 	GNumLightmapUnmappedTexels += NumLightmapUnmappedTexels;
 	GNumLightmapTotalTexelsNonPow2 += NumNonPower2Texels;
+	if (LightmapFlags & LMF_Streamed)
+	{
+		GNumLightmapStreamedWastedTexels += (uint64)GetSizeX() * GetSizeY() - FMath::Min<uint64>(NumLightmapMappedTexels, (uint64)GetSizeX() * GetSizeY());
+	}
 
 	// Encode and compress the coefficient textures.
 	for (uint32 CoefficientIndex = 0; CoefficientIndex < NUM_STORED_LIGHTMAP_COEF; CoefficientIndex += 2)
@@ -2321,6 +2339,20 @@ struct FCompareLightmaps
 {
 	FORCEINLINE bool operator()(const FLightMapAllocationGroup& A, const FLightMapAllocationGroup& B) const
 	{
+		// Keep the allocations of a packing cell together
+		if (A.PackingCell != B.PackingCell)
+		{
+			if (A.PackingCell.X != B.PackingCell.X)
+			{
+				return A.PackingCell.X < B.PackingCell.X;
+			}
+			if (A.PackingCell.Y != B.PackingCell.Y)
+			{
+				return A.PackingCell.Y < B.PackingCell.Y;
+			}
+			return A.PackingCell.Z < B.PackingCell.Z;
+		}
+
 		// Order descending by total size of allocation
 		return A.TotalTexels > B.TotalTexels;
 	}
@@ -2377,9 +2409,17 @@ void FLightMap2D::EncodeTextures( UWorld* InWorld, bool bLightingSuccessful, boo
 			}
 		}
 
-		// Calculate size of pending allocations for sorting
+		// Calculate size and packing cell of pending allocations for sorting
+		const float PackingCellSize = CVarLightmapPackingCellSize.GetValueOnAnyThread();
 		for (FLightMapAllocationGroup& PendingGroup : PendingLightMaps)
 		{
+			PendingGroup.PackingCell = FIntVector::ZeroValue;
+			if (PackingCellSize > 0.0f)
+			{
+				const FVector Cell = PendingGroup.Bounds.Origin / PackingCellSize;
+				PendingGroup.PackingCell = FIntVector(FMath::FloorToInt(Cell.X), FMath::FloorToInt(Cell.Y), FMath::FloorToInt(Cell.Z));
+			}
+
 			PendingGroup.TotalTexels = 0;
 			for (auto& Allocation : PendingGroup.Allocations)
 			{
@@ -2394,6 +2434,10 @@ void FLightMap2D::EncodeTextures( UWorld* InWorld, bool bLightingSuccessful, boo
 		// Allocate texture space for each light-map.
 		TArray<FLightMapPendingTexture*> PendingTextures;
 
+		// Groups are sorted by packing cell, only the textures created for the current cell are candidates
+		int32 CellFirstTextureIndex = 0;
+		FIntVector CurrentPackingCell = PendingLightMaps.Num() ? PendingLightMaps[0].PackingCell : FIntVector::ZeroValue;
+
 		for (FLightMapAllocationGroup& PendingGroup : PendingLightMaps)
 		{
 			if (!ensure(PendingGroup.Allocations.Num() >= 1))
@@ -2401,6 +2445,12 @@ void FLightMap2D::EncodeTextures( UWorld* InWorld, bool bLightingSuccessful, boo
 				continue;
 			}
 
+			if (PendingGroup.PackingCell != CurrentPackingCell)
+			{
+				CurrentPackingCell = PendingGroup.PackingCell;
+				CellFirstTextureIndex = PendingTextures.Num();
+			}
+
 			int32 MaxWidth = 0;
 			int32 MaxHeight = 0;
 			for (auto& Allocation : PendingGroup.Allocations)
@@ -2413,8 +2463,9 @@ void FLightMap2D::EncodeTextures( UWorld* InWorld, bool bLightingSuccessful, boo
 
 			// Find an existing texture which the light-map can be stored in.
 			// Lightmaps will always be 4-pixel aligned...
-			for (FLightMapPendingTexture* ExistingTexture : PendingTextures)
+			for (int32 TextureIndex = CellFirstTextureIndex; TextureIndex < PendingTextures.Num(); ++TextureIndex)
 			{
+				FLightMapPendingTexture* ExistingTexture = PendingTextures[TextureIndex];
 				if (ExistingTexture->AddElement(PendingGroup))
 				{
 					Texture = ExistingTexture;
@@ -2464,6 +2515,23 @@ void FLightMap2D::EncodeTextures( UWorld* InWorld, bool bLightingSuccessful, boo
 			}
 		}
 		PendingLightMaps.Empty();
+
+		if (PendingTextures.Num() > 0)
+		{
+			float StreamedRadiusSum = 0.0f;
+			int32 NumStreamedTextures = 0;
+			for (const FLightMapPendingTexture* Texture : PendingTextures)
+			{
+				if (Texture->LightmapFlags & LMF_Streamed)
+				{
+					StreamedRadiusSum += Texture->Bounds.SphereRadius;
+					++NumStreamedTextures;
+				}
+			}
+			UE_LOG(LogLightMap, Log, TEXT("Packed lightmaps into %d textures (packing cell size %.0f), %d streamed with an average bounds radius of %.0f"),
+				PendingTextures.Num(), PackingCellSize, NumStreamedTextures, NumStreamedTextures ? StreamedRadiusSum / NumStreamedTextures : 0.0f);
+		}
+
 		if (bMultithreadedEncode)
 		{
 			FThreadSafeCounter Counter(PendingTextures.Num());
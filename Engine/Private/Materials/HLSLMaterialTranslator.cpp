@@ -61,6 +61,9 @@ FHLSLMaterialTranslator::FHLSLMaterialTranslator(FMaterial* InMaterial,
 ,	CurrentScopeChunks(nullptr)
 ,	CurrentScopeID(0u)
 ,	NextTempScopeID(SF_NumFrequencies)
+,	HashedScopeChunks(nullptr)
+,	HashedScopeID(0u)
+,	NumHashedScopeChunks(0)
 ,	Material(InMaterial)
 ,	MaterialCompilationOutput(InMaterialCompilationOutput)
 ,	StaticParameters(InStaticParameters)
@@ -195,6 +198,32 @@ void FHLSLMaterialTranslator::AssignTempScope(TArray<FShaderCodeChunk>& InScope)
 	CurrentScopeID = NextTempScopeID++;
 }
 
+int32 FHLSLMaterialTranslator::FindScopeChunkByHash(uint64 Hash)
+{
+	const TArray<FShaderCodeChunk>& Chunks = *CurrentScopeChunks;
+
+	// Scopes are switched for each property, and temporary scopes get emptied, so only the chunks of one scope are indexed.
+	if (HashedScopeChunks != CurrentScopeChunks || HashedScopeID != CurrentScopeID || NumHashedScopeChunks > Chunks.Num())
+	{
+		ScopeChunkHashToIndex.Reset();
+		HashedScopeChunks = CurrentScopeChunks;
+		HashedScopeID = CurrentScopeID;
+		NumHashedScopeChunks = 0;
+	}
+
+	for (; NumHashedScopeChunks < Chunks.Num(); ++NumHashedScopeChunks)
+	{
+		const uint64 ChunkHash = Chunks[NumHashedScopeChunks].Hash;
+		if (!ScopeChunkHashToIndex.Contains(ChunkHash))
+		{
+			ScopeChunkHashToIndex.Add(ChunkHash, NumHashedScopeChunks);
+		}
+	}
+
+	const int32* ChunkIndex = ScopeChunkHashToIndex.Find(Hash);
+	return ChunkIndex ? *ChunkIndex : INDEX_NONE;
+}
+
 void FHLSLMaterialTranslator::AssignShaderFrequencyScope(EShaderFrequency InShaderFrequency)
 {
 	check(InShaderFrequency < SF_NumFrequencies);
@@ -1913,12 +1942,10 @@ int32 FHLSLMaterialTranslator::AddCodeChunkInner(uint64 Hash, const TCHAR* Forma
 	else if ((Type & (MCT_Float | MCT_VTPageTableResult)) || Type == MCT_ShadingModel)
 	{
 		// Check for existing
-		for (int32 i = 0; i < CurrentScopeChunks->Num(); ++i)
+		const int32 ExistingCodeIndex = FindScopeChunkByHash(Hash);
+		if (ExistingCodeIndex != INDEX_NONE)
 		{
-			if ((*CurrentScopeChunks)[i].Hash == Hash)
-			{
-				return i;
-			}
+			return ExistingCodeIndex;
 		}
 
 		const int32 CodeIndex = CurrentScopeChunks->Num();
@@ -2426,6 +2453,21 @@ EMaterialValueType FHLSLMaterialTranslator::GetArithmeticResultType(int32 A,int3
 	return GetArithmeticResultType(TypeA,TypeB);
 }
 
+bool FHLSLMaterialTranslator::GetConstantScalarValue(int32 Code, float& OutValue) const
+{
+	FMaterialUniformExpression* Expression = GetParameterUniformExpression(Code);
+	const EMaterialValueType Type = GetParameterType(Code);
+	if (Expression && Expression->IsConstant() && (Type == MCT_Float || Type == MCT_Float1))
+	{
+		FLinearColor Value;
+		FMaterialRenderContext DummyContext(nullptr, *Material, nullptr);
+		Expression->GetNumberValue(DummyContext, Value);
+		OutValue = Value.R;
+		return true;
+	}
+	return false;
+}
+
 // FMaterialCompiler interface.
 
 /** 
@@ -3842,6 +3884,13 @@ int32 FHLSLMaterialTranslator::If(int32 A,int32 B,int32 AGreaterThanB,int32 AEqu
 			return INDEX_NONE;
 		}
 
+		// Only the selected branch is needed when the comparison is constant, e.g. under static parameters
+		float ValueA, ValueB, Threshold;
+		if (GetConstantScalarValue(A, ValueA) && GetConstantScalarValue(B, ValueB) && GetConstantScalarValue(ThresholdArg, Threshold))
+		{
+			return FMath::Abs(ValueA - ValueB) > Threshold ? (ValueA >= ValueB ? CoercedAGreaterThanB : CoercedALessThanB) : CoercedAEqualsB;
+		}
+
 		return AddCodeChunk(
 			ResultType,
 			TEXT("((abs(%s - %s) > %s) ? (%s >= %s ? %s : %s) : %s)"),
@@ -3867,6 +3916,16 @@ int32 FHLSLMaterialTranslator::If(int32 A,int32 B,int32 AGreaterThanB,int32 AEqu
 			return INDEX_NONE;
 		}
 
+		float ValueA, ValueB;
+		if (CoercedAGreaterThanB == CoercedALessThanB)
+		{
+			return CoercedAGreaterThanB;
+		}
+		else if (GetConstantScalarValue(A, ValueA) && GetConstantScalarValue(B, ValueB))
+		{
+			return ValueA >= ValueB ? CoercedAGreaterThanB : CoercedALessThanB;
+		}
+
 		return AddCodeChunk(
 			ResultType,
 			TEXT("((%s >= %s) ? %s : %s)"),
@@ -5368,14 +5427,26 @@ int32 FHLSLMaterialTranslator::Add(int32 A,int32 B)
 		return INDEX_NONE;
 	}
 
+	// Adding a constant zero leaves the other operand as is, when it already has the result type
+	float ConstantValue;
+	const EMaterialValueType ResultType = GetArithmeticResultType(A,B);
+	if (GetConstantScalarValue(B, ConstantValue) && ConstantValue == 0.0f && GetParameterType(A) == ResultType)
+	{
+		return A;
+	}
+	else if (GetConstantScalarValue(A, ConstantValue) && ConstantValue == 0.0f && GetParameterType(B) == ResultType)
+	{
+		return B;
+	}
+
 	const uint64 Hash = CityHash128to64({ GetParameterHash(A), GetParameterHash(B) });
 	if(GetParameterUniformExpression(A) && GetParameterUniformExpression(B))
 	{
-		return AddUniformExpressionWithHash(Hash, new FMaterialUniformExpressionFoldedMath(GetParameterUniformExpression(A),GetParameterUniformExpression(B),FMO_Add),GetArithmeticResultType(A,B),TEXT("(%s + %s)"),*GetParameterCode(A),*GetParameterCode(B));
+		return AddUniformExpressionWithHash(Hash, new FMaterialUniformExpressionFoldedMath(GetParameterUniformExpression(A),GetParameterUniformExpression(B),FMO_Add),ResultType,TEXT("(%s + %s)"),*GetParameterCode(A),*GetParameterCode(B));
 	}
 	else
 	{
-		return AddCodeChunkWithHash(Hash, GetArithmeticResultType(A,B),TEXT("(%s + %s)"),*GetParameterCode(A),*GetParameterCode(B));
+		return AddCodeChunkWithHash(Hash, ResultType,TEXT("(%s + %s)"),*GetParameterCode(A),*GetParameterCode(B));
 	}
 }
 
@@ -5404,14 +5475,26 @@ int32 FHLSLMaterialTranslator::Mul(int32 A,int32 B)
 		return INDEX_NONE;
 	}
 
+	// Multiplying by a constant one leaves the other operand as is, when it already has the result type
+	float ConstantValue;
+	const EMaterialValueType ResultType = GetArithmeticResultType(A,B);
+	if (GetConstantScalarValue(B, ConstantValue) && ConstantValue == 1.0f && GetParameterType(A) == ResultType)
+	{
+		return A;
+	}
+	else if (GetConstantScalarValue(A, ConstantValue) && ConstantValue == 1.0f && GetParameterType(B) == ResultType)
+	{
+		return B;
+	}
+
 	const uint64 Hash = CityHash128to64({ GetParameterHash(A), GetParameterHash(B) });
 	if(GetParameterUniformExpression(A) && GetParameterUniformExpression(B))
 	{
-		return AddUniformExpressionWithHash(Hash, new FMaterialUniformExpressionFoldedMath(GetParameterUniformExpression(A),GetParameterUniformExpression(B),FMO_Mul),GetArithmeticResultType(A,B),TEXT("(%s * %s)"),*GetParameterCode(A),*GetParameterCode(B));
+		return AddUniformExpressionWithHash(Hash, new FMaterialUniformExpressionFoldedMath(GetParameterUniformExpression(A),GetParameterUniformExpression(B),FMO_Mul),ResultType,TEXT("(%s * %s)"),*GetParameterCode(A),*GetParameterCode(B));
 	}
 	else
 	{
-		return AddCodeChunkWithHash(Hash, GetArithmeticResultType(A,B),TEXT("(%s * %s)"),*GetParameterCode(A),*GetParameterCode(B));
+		return AddCodeChunkWithHash(Hash, ResultType,TEXT("(%s * %s)"),*GetParameterCode(A),*GetParameterCode(B));
 	}
 }
 
@@ -141,6 +141,12 @@ protected:
 	uint64 CurrentScopeID;
 	uint64 NextTempScopeID;
 
+	/** Index of the first chunk of each hash in the scope chunks, filled lazily. Avoids a linear search per added chunk in large materials. */
+	TMap<uint64, int32> ScopeChunkHashToIndex;
+	const TArray<FShaderCodeChunk>* HashedScopeChunks;
+	uint64 HashedScopeID;
+	int32 NumHashedScopeChunks;
+
 	// List of Shared pixel properties. Used to share generated code
 	bool SharedPixelProperties[CompiledMP_MAX];
 
@@ -310,6 +316,9 @@ public:
 	void ClearFunctionStack(uint32 Frequency);
 
 	void AssignTempScope(TArray<FShaderCodeChunk>& InScope);
+
+	/** Finds the first chunk of a given hash in the current scope */
+	int32 FindScopeChunkByHash(uint64 Hash);
 	void AssignShaderFrequencyScope(EShaderFrequency InShaderFrequency);
 
 	void GatherCustomVertexInterpolators(TArray<UMaterialExpression*> Expressions);
@@ -415,6 +424,9 @@ protected:
 
 	EMaterialValueType GetArithmeticResultType(int32 A, int32 B);
 
+	/** Returns true and the value if Code is a constant scalar, letting operations on constants skip the code they would emit. */
+	bool GetConstantScalarValue(int32 Code, float& OutValue) const;
+
 	// FMaterialCompiler interface.
 
 	/** 
@@ -264,8 +264,106 @@ void FMaterialResource::EndAllowCachingStaticParameterValues()
 }
 #endif // WITH_EDITOR
 
+#if WITH_EDITOR
+static int32 GMaterialInstanceShaderMapIdCache = 1;
+static FAutoConsoleVariableRef CVarMaterialInstanceShaderMapIdCache(
+	TEXT("r.Material.InstanceShaderMapIdCache"),
+	GMaterialInstanceShaderMapIdCache,
+	TEXT("If 1, the shader map ID of a material instance with static parameters is built once and shared by every instance with the same\n")
+	TEXT("parent chain and static parameters, instead of resolving the static parameters and shader dependencies of each instance."));
+
+namespace MaterialInstanceShaderMapIdCache
+{
+	/** Shader map IDs of material instance resources, by hash of everything the ID is built from */
+	static FCriticalSection CS;
+	static TMap<FSHAHash, FMaterialShaderMapId> Ids;
+
+	static void UpdateHash(FSHA1& HashState, const FStaticParameterSet& StaticParameters)
+	{
+		for (const FStaticSwitchParameter& Parameter : StaticParameters.StaticSwitchParameters)
+		{
+			Parameter.UpdateHash(HashState);
+		}
+		for (const FStaticComponentMaskParameter& Parameter : StaticParameters.StaticComponentMaskParameters)
+		{
+			Parameter.UpdateHash(HashState);
+		}
+		for (const FStaticTerrainLayerWeightParameter& Parameter : StaticParameters.TerrainLayerWeightParameters)
+		{
+			Parameter.UpdateHash(HashState);
+		}
+		for (const FStaticMaterialLayersParameter& Parameter : StaticParameters.MaterialLayersParameters)
+		{
+			Parameter.GetID().UpdateHash(HashState);
+		}
+		const int32 Nums[] = { StaticParameters.StaticSwitchParameters.Num(), StaticParameters.StaticComponentMaskParameters.Num(), StaticParameters.TerrainLayerWeightParameters.Num(), StaticParameters.MaterialLayersParameters.Num() };
+		HashState.Update((const uint8*)Nums, sizeof(Nums));
+	}
+
+	/**
+	 * Hashes the inputs of the shader map ID of an instance resource: the static parameters overridden by each instance of the parent chain,
+	 * the base material state and the properties of the resource. Resolving the composited static parameters is what this avoids.
+	 */
+	static FSHAHash GetKey(const FMaterialResource& Resource, UMaterialInstance* MaterialInstance, UMaterial* Material, EShaderPlatform Platform, const ITargetPlatform* TargetPlatform, EMaterialShaderMapUsage::Type Usage, const FSHAHash& BasePropertyOverridesHash)
+	{
+		FSHA1 HashState;
+		for (UMaterialInterface* Interface = MaterialInstance; Interface; )
+		{
+			HashState.Update((const uint8*)&Interface, sizeof(Interface));
+
+			UMaterialInstance* Instance = Cast<UMaterialInstance>(Interface);
+			if (!Instance)
+			{
+				break;
+			}
+			UpdateHash(HashState, Instance->GetStaticParameters());
+			Interface = Instance->Parent;
+		}
+
+		HashState.Update((const uint8*)&Material->StateId, sizeof(Material->StateId));
+		HashState.Update(BasePropertyOverridesHash.Hash, sizeof(BasePropertyOverridesHash.Hash));
+
+		const int32 ResourceKey[] = { (int32)Platform, (int32)Resource.GetQualityLevel(), (int32)Resource.GetFeatureLevel(), (int32)Usage };
+		HashState.Update((const uint8*)ResourceKey, sizeof(ResourceKey));
+		HashState.Update((const uint8*)&TargetPlatform, sizeof(TargetPlatform));
+
+		const TArrayView<UObject* const> ReferencedTextures = Resource.GetReferencedTextures();
+		HashState.Update((const uint8*)ReferencedTextures.GetData(), ReferencedTextures.Num() * sizeof(UObject*));
+
+		FSHAHash Key;
+		HashState.Final();
+		HashState.GetHash(Key.Hash);
+		return Key;
+	}
+}
+
+void FMaterialResource::EmptyInstanceShaderMapIdCache()
+{
+	FScopeLock ScopeLock(&MaterialInstanceShaderMapIdCache::CS);
+	MaterialInstanceShaderMapIdCache::Ids.Empty();
+}
+#endif // WITH_EDITOR
+
 void FMaterialResource::GetShaderMapId(EShaderPlatform Platform, const ITargetPlatform* TargetPlatform, FMaterialShaderMapId& OutId) const
 {
+#if WITH_EDITOR
+	FSHAHash CacheKey;
+	const bool bUseCache = MaterialInstance && GMaterialInstanceShaderMapIdCache && !GetLoadedCookedShaderMapId();
+	if (bUseCache)
+	{
+		FSHAHash BasePropertyOverridesHash;
+		MaterialInstance->GetBasePropertyOverridesHash(BasePropertyOverridesHash);
+		CacheKey = MaterialInstanceShaderMapIdCache::GetKey(*this, MaterialInstance, Material, Platform, TargetPlatform, GetShaderMapUsage(), BasePropertyOverridesHash);
+
+		FScopeLock ScopeLock(&MaterialInstanceShaderMapIdCache::CS);
+		if (const FMaterialShaderMapId* CachedId = MaterialInstanceShaderMapIdCache::Ids.Find(CacheKey))
+		{
+			OutId = *CachedId;
+			return;
+		}
+	}
+#endif // WITH_EDITOR
+
 	FMaterial::GetShaderMapId(Platform, TargetPlatform, OutId);
 #if WITH_EDITOR
 	Material->AppendReferencedFunctionIdsTo(OutId.ReferencedFunctions);
@@ -281,6 +379,12 @@ void FMaterialResource::GetShaderMapId(EShaderPlatform Platform, const ITargetPl
 		MaterialInstance->GetStaticParameterValues(CompositedStaticParameters);
 		OutId.UpdateFromParameterSet(CompositedStaticParameters);
 	}
+
+	if (bUseCache)
+	{
+		FScopeLock ScopeLock(&MaterialInstanceShaderMapIdCache::CS);
+		MaterialInstanceShaderMapIdCache::Ids.Add(CacheKey, OutId);
+	}
 #endif // WITH_EDITOR
 }
 
@@ -4407,6 +4511,11 @@ void UMaterial::BeginDestroy()
 {
 	Super::BeginDestroy();
 
+#if WITH_EDITOR
+	// Cached instance shader map IDs are keyed by material address
+	FMaterialResource::EmptyInstanceShaderMapIdCache();
+#endif
+
 	if (DefaultMaterialInstance)
 	{
 		FMaterialRenderProxy* LocalResource = DefaultMaterialInstance;
@@ -349,6 +349,89 @@ void FMaterialInstanceResource::GameThread_SetParent(UMaterialInterface* ParentM
 	}
 }
 
+namespace MaterialInstanceParameterBatch
+{
+	template <typename ValueType>
+	struct TUpdate
+	{
+		FMaterialInstanceResource* Resource;
+		FHashedMaterialParameterInfo ParameterInfo;
+		ValueType Value;
+	};
+
+	/** Number of FMaterialInstanceParameterUpdateScope alive, and the updates they gathered. Game thread only. */
+	static int32 NumScopes = 0;
+	static TArray<TUpdate<float>> ScalarUpdates;
+	static TArray<TUpdate<FLinearColor>> VectorUpdates;
+
+	template <typename ValueType>
+	static TArray<TUpdate<ValueType>>* GetUpdates() { return nullptr; }
+	template <> TArray<TUpdate<float>>* GetUpdates<float>() { return &ScalarUpdates; }
+	template <> TArray<TUpdate<FLinearColor>>* GetUpdates<FLinearColor>() { return &VectorUpdates; }
+
+	/** Gathers the update if a scope is alive, returns false if it must be sent right away. */
+	template <typename ValueType>
+	static bool Add(FMaterialInstanceResource* Resource, const FHashedMaterialParameterInfo& ParameterInfo, const ValueType& Value)
+	{
+		TArray<TUpdate<ValueType>>* Updates = GetUpdates<ValueType>();
+		if (!Updates || !NumScopes || !IsInGameThread())
+		{
+			return false;
+		}
+
+		Updates->Add({ Resource, ParameterInfo, Value });
+		return true;
+	}
+}
+
+FMaterialInstanceParameterUpdateScope::FMaterialInstanceParameterUpdateScope()
+{
+	check(IsInGameThread());
+	++MaterialInstanceParameterBatch::NumScopes;
+}
+
+FMaterialInstanceParameterUpdateScope::~FMaterialInstanceParameterUpdateScope()
+{
+	check(IsInGameThread() && MaterialInstanceParameterBatch::NumScopes > 0);
+	if (--MaterialInstanceParameterBatch::NumScopes == 0)
+	{
+		Flush();
+	}
+}
+
+void FMaterialInstanceParameterUpdateScope::Flush()
+{
+	using namespace MaterialInstanceParameterBatch;
+
+	if (!IsInGameThread() || (!ScalarUpdates.Num() && !VectorUpdates.Num()))
+	{
+		return;
+	}
+
+	ENQUEUE_RENDER_COMMAND(SetMIParameterValues)(
+		[InScalarUpdates = MoveTemp(ScalarUpdates), InVectorUpdates = MoveTemp(VectorUpdates)](FRHICommandListImmediate& RHICmdList)
+		{
+			TSet<FMaterialInstanceResource*> UpdatedResources;
+			for (const TUpdate<float>& Update : InScalarUpdates)
+			{
+				Update.Resource->RenderThread_UpdateParameterValue(Update.ParameterInfo, Update.Value);
+				UpdatedResources.Add(Update.Resource);
+			}
+			for (const TUpdate<FLinearColor>& Update : InVectorUpdates)
+			{
+				Update.Resource->RenderThread_UpdateParameterValue(Update.ParameterInfo, Update.Value);
+				UpdatedResources.Add(Update.Resource);
+			}
+			for (FMaterialInstanceResource* Resource : UpdatedResources)
+			{
+				Resource->InvalidateUniformExpressionCache(false);
+			}
+		});
+
+	ScalarUpdates.Reset();
+	VectorUpdates.Reset();
+}
+
 /**
 * Updates a parameter on the material instance from the game thread.
 */
@@ -358,6 +441,11 @@ void GameThread_UpdateMIParameter(const UMaterialInstance* Instance, const Param
 	FMaterialInstanceResource* Resource = Instance->Resource;
 	const FMaterialParameterInfo& ParameterInfo = Parameter.ParameterInfo;
 	typename ParameterType::ValueType Value = ParameterType::GetValue(Parameter);
+	if (MaterialInstanceParameterBatch::Add(Resource, ParameterInfo, Value))
+	{
+		return;
+	}
+
 	ENQUEUE_RENDER_COMMAND(SetMIParameterValue)(
 		[Resource, ParameterInfo, Value](FRHICommandListImmediate& RHICmdList)
 		{
@@ -3550,6 +3638,14 @@ void UMaterialInstance::BeginDestroy()
 
 	if (!HasAnyFlags(RF_ClassDefaultObject))
 	{
+		// Gathered parameter updates must not reach the resource after it's released.
+		FMaterialInstanceParameterUpdateScope::Flush();
+
+#if WITH_EDITOR
+		// Cached instance shader map IDs are keyed by instance address
+		FMaterialResource::EmptyInstanceShaderMapIdCache();
+#endif
+
 		FMaterialRenderProxy* LocalResource = Resource;
 		ENQUEUE_RENDER_COMMAND(BeginDestroyCommand)(
 		[LocalResource](FRHICommandList& RHICmdList)
@@ -3894,6 +3990,9 @@ void UMaterialInstance::ClearParameterValuesInternal(const bool bAllParameters)
 
 	if (Resource)
 	{
+		// Parameters set before clearing must not be applied after it.
+		FMaterialInstanceParameterUpdateScope::Flush();
+
 		FMaterialInstanceResource* InResource = Resource;
 		ENQUEUE_RENDER_COMMAND(FClearMIParametersCommand)(
 			[InResource](FRHICommandList& RHICmdList)
@@ -120,10 +120,19 @@ public:
 	 */
 	template <typename ValueType>
 	void RenderThread_UpdateParameter(const FHashedMaterialParameterInfo& ParameterInfo, const ValueType& Value )
+	{
+		InvalidateUniformExpressionCache(false);
+		RenderThread_UpdateParameterValue(ParameterInfo, Value);
+	}
+
+	/**
+	 * Updates a named parameter on the render thread, without invalidating the uniform expression cache.
+	 */
+	template <typename ValueType>
+	void RenderThread_UpdateParameterValue(const FHashedMaterialParameterInfo& ParameterInfo, const ValueType& Value)
 	{
 		LLM_SCOPE(ELLMTag::MaterialInstance);
 
-		InvalidateUniformExpressionCache(false);
 		TArray<TNamedParameter<ValueType> >& ValueArray = GetValueArray<ValueType>();
 		const int32 ParameterCount = ValueArray.Num();
 		for (int32 ParameterIndex = 0; ParameterIndex < ParameterCount; ++ParameterIndex)
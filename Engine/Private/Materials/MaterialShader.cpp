@@ -2213,6 +2213,7 @@ uint32 FMaterialShaderMap::GetShaderNum() const
  */
 void FMaterialShaderMap::Register(EShaderPlatform InShaderPlatform)
 {
+	// By default RHI shaders are created one at a time through the resource as they are requested, rather than for every permutation of the map
 	extern int32 GCreateShadersOnLoad;
 	if (GCreateShadersOnLoad && GetShaderPlatform() == InShaderPlatform)
 	{
@@ -2999,8 +2999,21 @@ void FMaterial::SaveShaderStableKeys(EShaderPlatform TargetShaderPlatform, FStab
 }
 
 
+/** Context of the outermost FMaterialUpdateContextBatchScope, game thread only */
+static FMaterialUpdateContext* GMaterialUpdateContextBatch = nullptr;
+
 FMaterialUpdateContext::FMaterialUpdateContext(uint32 Options, EShaderPlatform InShaderPlatform)
+	: BatchContext(nullptr)
 {
+	if (GMaterialUpdateContextBatch && GMaterialUpdateContextBatch->ShaderPlatform == InShaderPlatform && IsInGameThread())
+	{
+		// The batch already flushed rendering and holds the component contexts, it updates our materials when it ends
+		BatchContext = GMaterialUpdateContextBatch;
+		bSyncWithRenderingThread = false;
+		ShaderPlatform = InShaderPlatform;
+		return;
+	}
+
 	bool bReregisterComponents = (Options & EOptions::ReregisterComponents) != 0;
 	bool bRecreateRenderStates = ((Options & EOptions::RecreateRenderStates) != 0) && FApp::CanEverRender();
 
@@ -3022,26 +3035,51 @@ FMaterialUpdateContext::FMaterialUpdateContext(uint32 Options, EShaderPlatform I
 
 void FMaterialUpdateContext::AddMaterial(UMaterial* Material)
 {
+	if (BatchContext)
+	{
+		BatchContext->AddMaterial(Material);
+		return;
+	}
 	UpdatedMaterials.Add(Material);
 	UpdatedMaterialInterfaces.Add(Material);
 }
 
 void FMaterialUpdateContext::AddMaterialInstance(UMaterialInstance* Instance)
 {
+	if (BatchContext)
+	{
+		BatchContext->AddMaterialInstance(Instance);
+		return;
+	}
 	UpdatedMaterials.Add(Instance->GetMaterial());
 	UpdatedMaterialInterfaces.Add(Instance);
 }
 
 void FMaterialUpdateContext::AddMaterialInterface(UMaterialInterface* Interface)
 {
+	if (BatchContext)
+	{
+		BatchContext->AddMaterialInterface(Interface);
+		return;
+	}
 	UpdatedMaterials.Add(Interface->GetMaterial());
 	UpdatedMaterialInterfaces.Add(Interface);
 }
 
 FMaterialUpdateContext::~FMaterialUpdateContext()
 {
+	if (BatchContext)
+	{
+		return;
+	}
+
 	TRACE_CPUPROFILER_EVENT_SCOPE(FMaterialUpdateContext::~FMaterialUpdateContext);
 
+#if WITH_EDITOR
+	// Materials, functions or collections may have been edited, instance shader map IDs need to be rebuilt
+	FMaterialResource::EmptyInstanceShaderMapIdCache();
+#endif
+
 	double StartTime = FPlatformTime::Seconds();
 	bool bProcess = false;
 
@@ -3188,6 +3226,29 @@ FMaterialUpdateContext::~FMaterialUpdateContext()
 	}
 }
 
+FMaterialUpdateContextBatchScope::FMaterialUpdateContextBatchScope(uint32 Options, EShaderPlatform InShaderPlatform)
+{
+	check(IsInGameThread());
+
+	if (!GMaterialUpdateContextBatch)
+	{
+		Context = MakeUnique<FMaterialUpdateContext>(Options, InShaderPlatform);
+		GMaterialUpdateContextBatch = Context.Get();
+	}
+}
+
+FMaterialUpdateContextBatchScope::~FMaterialUpdateContextBatchScope()
+{
+	if (Context)
+	{
+		check(GMaterialUpdateContextBatch == Context.Get());
+		GMaterialUpdateContextBatch = nullptr;
+
+		// Updates every material gathered by the batched contexts
+		Context.Reset();
+	}
+}
+
 bool UMaterialInterface::IsPropertyActive(EMaterialProperty InProperty)const
 {
 	//TODO: Disable properties in instances based on the currently set overrides and other material settings?
@@ -624,6 +624,48 @@ static void GetScalarParameter(const FUniformExpressionSet& UniformExpressionSet
 	OutValue.R = OutValue.G = OutValue.B = OutValue.A;
 }
 
+/**
+ * Parameter values resolved at most once while filling a uniform buffer. Parameters are often referenced by several
+ * preshaders, and each lookup goes through the render proxy parameters and the parent chain.
+ */
+class FPreshaderParameterCache
+{
+public:
+	FPreshaderParameterCache(int32 NumVectorParameters, int32 NumScalarParameters)
+		: VectorValuesResolved(false, NumVectorParameters)
+		, ScalarValuesResolved(false, NumScalarParameters)
+	{
+		VectorValues.AddUninitialized(NumVectorParameters);
+		ScalarValues.AddUninitialized(NumScalarParameters);
+	}
+
+	void GetVectorParameter(const FUniformExpressionSet& UniformExpressionSet, uint32 ParameterIndex, const FMaterialRenderContext& Context, FLinearColor& OutValue)
+	{
+		if (!VectorValuesResolved[ParameterIndex])
+		{
+			::GetVectorParameter(UniformExpressionSet, ParameterIndex, Context, VectorValues[ParameterIndex]);
+			VectorValuesResolved[ParameterIndex] = true;
+		}
+		OutValue = VectorValues[ParameterIndex];
+	}
+
+	void GetScalarParameter(const FUniformExpressionSet& UniformExpressionSet, uint32 ParameterIndex, const FMaterialRenderContext& Context, FLinearColor& OutValue)
+	{
+		if (!ScalarValuesResolved[ParameterIndex])
+		{
+			::GetScalarParameter(UniformExpressionSet, ParameterIndex, Context, ScalarValues[ParameterIndex]);
+			ScalarValuesResolved[ParameterIndex] = true;
+		}
+		OutValue = ScalarValues[ParameterIndex];
+	}
+
+private:
+	TArray<FLinearColor, TInlineAllocator<16u>> VectorValues;
+	TArray<FLinearColor, TInlineAllocator<32u>> ScalarValues;
+	TBitArray<> VectorValuesResolved;
+	TBitArray<> ScalarValuesResolved;
+};
+
 using FPreshaderStack = TArray<FLinearColor, TInlineAllocator<64u>>;
 
 template<typename Operation>
@@ -852,7 +894,7 @@ FORCENOINLINE static float DivideComponent(float A, float B)
 	return A / GetSafeDivisor(B);
 }
 
-static void EvaluatePreshader(const FUniformExpressionSet* UniformExpressionSet, const FMaterialRenderContext& Context, FPreshaderStack& Stack, const uint8* BaseData, uint32 Size, FLinearColor& OutValue)
+static void EvaluatePreshader(const FUniformExpressionSet* UniformExpressionSet, const FMaterialRenderContext& Context, FPreshaderStack& Stack, const uint8* BaseData, uint32 Size, FLinearColor& OutValue, FPreshaderParameterCache* ParameterCache = nullptr)
 {
 	static const float LogToLog10 = 1.0f / FMath::Loge(10.f);
 	FPreshaderDataPtr Data(BaseData);
@@ -872,11 +914,25 @@ static void EvaluatePreshader(const FUniformExpressionSet* UniformExpressionSet,
 			break;
 		case EMaterialPreshaderOpcode::VectorParameter:
 			check(UniformExpressionSet);
-			GetVectorParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			if (ParameterCache)
+			{
+				ParameterCache->GetVectorParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			}
+			else
+			{
+				GetVectorParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			}
 			break;
 		case EMaterialPreshaderOpcode::ScalarParameter:
 			check(UniformExpressionSet);
-			GetScalarParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			if (ParameterCache)
+			{
+				ParameterCache->GetScalarParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			}
+			else
+			{
+				GetScalarParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			}
 			break;
 		case EMaterialPreshaderOpcode::Add: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return Lhs + Rhs; }); break;
 		case EMaterialPreshaderOpcode::Sub: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return Lhs - Rhs; }); break;
@@ -1080,13 +1136,14 @@ void FUniformExpressionSet::FillUniformBuffer(const FMaterialRenderContext& Mate
 
 		// Dump vector expression into the buffer.
 		FPreshaderStack PreshaderStack;
+		FPreshaderParameterCache ParameterCache(UniformVectorParameters.Num(), UniformScalarParameters.Num());
 		const uint8* PreshaderData = UniformPreshaderData.Data.GetData();
 		for(int32 VectorIndex = 0;VectorIndex < UniformVectorPreshaders.Num();++VectorIndex)
 		{
 			FLinearColor VectorValue(0, 0, 0, 0);
 
 			const FMaterialUniformPreshaderHeader& Preshader = UniformVectorPreshaders[VectorIndex];
-			EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderData + Preshader.OpcodeOffset, Preshader.OpcodeSize, VectorValue);
+			EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderData + Preshader.OpcodeOffset, Preshader.OpcodeSize, VectorValue, &ParameterCache);
 	
 			FLinearColor* DestAddress = (FLinearColor*)BufferCursor;
 			*DestAddress = VectorValue;
@@ -1100,7 +1157,7 @@ void FUniformExpressionSet::FillUniformBuffer(const FMaterialRenderContext& Mate
 			FLinearColor VectorValue(0,0,0,0);
 
 			const FMaterialUniformPreshaderHeader& Preshader = UniformScalarPreshaders[ScalarIndex];
-			EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderData + Preshader.OpcodeOffset, Preshader.OpcodeSize, VectorValue);
+			EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderData + Preshader.OpcodeOffset, Preshader.OpcodeSize, VectorValue, &ParameterCache);
 
 			float* DestAddress = (float*)BufferCursor;
 			*DestAddress = VectorValue.R;
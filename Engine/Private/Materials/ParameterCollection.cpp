@@ -475,6 +475,7 @@ UMaterialParameterCollectionInstance::UMaterialParameterCollectionInstance(const
 {
 	Resource = nullptr;
 	bNeedsRenderStateUpdate = false;
+	bCachedParameterDataValid = false;
 }
 
 void UMaterialParameterCollectionInstance::PostInitProperties()
@@ -491,13 +492,14 @@ void UMaterialParameterCollectionInstance::SetCollection(UMaterialParameterColle
 {
 	Collection = InCollection;
 	World = InWorld;
+	bCachedParameterDataValid = false;
 }
 
 bool UMaterialParameterCollectionInstance::SetScalarParameterValue(FName ParameterName, float ParameterValue)
 {
 	check(World.IsValid() && Collection);
 
-	if (Collection->GetScalarParameterByName(ParameterName))
+	if (const FCollectionScalarParameter* Parameter = Collection->GetScalarParameterByName(ParameterName))
 	{
 		float* ExistingValue = ScalarParameterValues.Find(ParameterName);
 		bool bUpdateUniformBuffer = false;
@@ -517,7 +519,7 @@ bool UMaterialParameterCollectionInstance::SetScalarParameterValue(FName Paramet
 
 		if (bUpdateUniformBuffer)
 		{
-			UpdateRenderState(false);
+			UpdateScalarParameterData(*Parameter, ParameterValue);
 		}
 
 		return true;
@@ -530,7 +532,7 @@ bool UMaterialParameterCollectionInstance::SetVectorParameterValue(FName Paramet
 {
 	check(World.IsValid() && Collection);
 
-	if (Collection->GetVectorParameterByName(ParameterName))
+	if (const FCollectionVectorParameter* Parameter = Collection->GetVectorParameterByName(ParameterName))
 	{
 		FLinearColor* ExistingValue = VectorParameterValues.Find(ParameterName);
 		bool bUpdateUniformBuffer = false;
@@ -550,7 +552,7 @@ bool UMaterialParameterCollectionInstance::SetVectorParameterValue(FName Paramet
 
 		if (bUpdateUniformBuffer)
 		{
-			UpdateRenderState(false);
+			UpdateVectorParameterData(*Parameter, ParameterValue);
 		}
 
 		return true;
@@ -588,6 +590,35 @@ bool UMaterialParameterCollectionInstance::GetVectorParameterValue(FName Paramet
 }
 
 void UMaterialParameterCollectionInstance::UpdateRenderState(bool bRecreateUniformBuffer)
+{
+	// The collection's parameters or their defaults may have changed, rebuild all of the data
+	bCachedParameterDataValid = false;
+	MarkRenderStateDirty(bRecreateUniformBuffer);
+}
+
+void UMaterialParameterCollectionInstance::UpdateScalarParameterData(const FCollectionScalarParameter& Parameter, float ParameterValue)
+{
+	if (bCachedParameterDataValid)
+	{
+		// Same packing as GetParameterData, 4 scalars per vector
+		const int32 ParameterIndex = &Parameter - Collection->ScalarParameters.GetData();
+		CachedParameterData[ParameterIndex / 4][ParameterIndex % 4] = ParameterValue;
+	}
+	MarkRenderStateDirty(false);
+}
+
+void UMaterialParameterCollectionInstance::UpdateVectorParameterData(const FCollectionVectorParameter& Parameter, const FLinearColor& ParameterValue)
+{
+	if (bCachedParameterDataValid)
+	{
+		// Vectors follow the packed scalars
+		const int32 ParameterIndex = &Parameter - Collection->VectorParameters.GetData();
+		CachedParameterData[FMath::DivideAndRoundUp(Collection->ScalarParameters.Num(), 4) + ParameterIndex] = ParameterValue;
+	}
+	MarkRenderStateDirty(false);
+}
+
+void UMaterialParameterCollectionInstance::MarkRenderStateDirty(bool bRecreateUniformBuffer)
 {
 	// Don't need material parameters on the server
 	if (!World.IsValid() || World->GetNetMode() == NM_DedicatedServer)
@@ -610,10 +641,14 @@ void UMaterialParameterCollectionInstance::DeferredUpdateRenderState(bool bRecre
 
 	if (bNeedsRenderStateUpdate && World.IsValid())
 	{
+		if (!bCachedParameterDataValid)
+		{
+			GetParameterData(CachedParameterData);
+			bCachedParameterDataValid = true;
+		}
+
 		// Propagate the new values to the rendering thread
-		TArray<FVector4> ParameterData;
-		GetParameterData(ParameterData);
-		Resource->GameThread_UpdateContents(Collection ? Collection->StateId : FGuid(), ParameterData, GetFName(), bRecreateUniformBuffer);
+		Resource->GameThread_UpdateContents(Collection ? Collection->StateId : FGuid(), CachedParameterData, GetFName(), bRecreateUniformBuffer);
 	}
 
 	bNeedsRenderStateUpdate = false;
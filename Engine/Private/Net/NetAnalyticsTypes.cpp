@@ -212,6 +212,33 @@ void FNetConnectionSaturationAnalytics::Reset()
 	CurrentRunOfSaturatedReplications = 0;
 }
 
+float FNetConnectionStarvationAnalytics::GetBucketUpperBoundSeconds(const int32 BucketIndex)
+{
+	static const float BucketUpperBounds[NumberOfBuckets] = { 0.1f, 0.25f, 0.5f, 1.0f, 2.0f, TNumericLimits<float>::Max() };
+	return BucketUpperBounds[FMath::Clamp<int32>(BucketIndex, 0, NumberOfBuckets - 1)];
+}
+
+void FNetConnectionStarvationAnalytics::TrackStarvation(const float StarvationSeconds)
+{
+	int32 BucketIndex = 0;
+	while (BucketIndex < NumberOfBuckets - 1 && StarvationSeconds > GetBucketUpperBoundSeconds(BucketIndex))
+	{
+		++BucketIndex;
+	}
+
+	++StarvationHistogram[BucketIndex];
+	++NumberOfStarvedUpdates;
+	LongestStarvationSeconds = FMath::Max(LongestStarvationSeconds, StarvationSeconds);
+}
+
+void FNetConnectionStarvationAnalytics::Reset()
+{
+	FMemory::Memzero(StarvationHistogram);
+	NumberOfStarvedUpdates = 0;
+	LongestStarvationSeconds = 0.f;
+	NumberOfBudgetLimitedReplications = 0;
+}
+
 void FNetConnectionPacketAnalytics::Reset()
 {
 	bSawPacketLossBurstThisFrame = false;
@@ -0,0 +1,313 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Net/SimulatedClientNetConnection.h"
+
+#include "EngineLogs.h"
+#include "ChartCreation.h"
+#include "InGamePerformanceTracker.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+/**
+ * Loads a server with simulated clients connected in-process, to measure how server frame time scales with the number
+ * of clients without running the clients. Simulated clients walk around at random and everything is replicated to them.
+ *
+ *	Net.LoadSim.AddClients <Num>							Connects Num more simulated clients
+ *	Net.LoadSim.RemoveClients								Disconnects every simulated client
+ *	Net.LoadSim.Benchmark <MaxClients> [Step] [Seconds]		Adds Step clients at a time up to MaxClients, and logs the server
+ *															frame time and the time of each performance tracking timer
+ *															measured for Seconds at every step
+ *
+ * Headless runs can start a benchmark with -ExecCmds="Net.LoadSim.Benchmark 100".
+ */
+namespace ServerLoadSimulation
+{
+	/** Time given to new clients to finish spawning and replicating before a step is measured */
+	static const double BenchmarkWarmUpSeconds = 3.0;
+
+	struct FBenchmark
+	{
+		TWeakObjectPtr<UWorld> World;
+		int32 MaxClients;
+		int32 StepClients;
+		float StepSeconds;
+
+		double StepStartTime;
+		bool bWarmingUp;
+
+		TSharedPtr<FPerformanceTrackingChart> Chart;
+		int64 StepStartBytesSent;
+
+		TArray<FString> Results;
+	};
+
+	static TUniquePtr<FBenchmark> Benchmark;
+
+	static FDelegateHandle WorldTickStartHandle;
+
+	static int32 NextClientIndex = 0;
+
+	static void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	static UNetDriver* GetServerNetDriver(UWorld* World)
+	{
+		UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+		if (!NetDriver || !NetDriver->IsServer())
+		{
+			UE_LOG(LogNet, Warning, TEXT("Server load simulation needs a world that is listening for clients."));
+			return nullptr;
+		}
+		return NetDriver;
+	}
+
+	static int32 GetNumClients(UNetDriver* NetDriver, int64* OutBytesSent = nullptr)
+	{
+		int32 NumClients = 0;
+		int64 BytesSent = 0;
+		for (UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			USimulatedClientNetConnection* SimulatedConnection = Cast<USimulatedClientNetConnection>(Connection);
+			if (SimulatedConnection && SimulatedConnection->State != USOCK_Closed)
+			{
+				++NumClients;
+				BytesSent += SimulatedConnection->GetSimulatedBytesSent();
+			}
+		}
+
+		if (OutBytesSent)
+		{
+			*OutBytesSent = BytesSent;
+		}
+		return NumClients;
+	}
+
+	static void AddClients(UWorld* World, int32 NumClients)
+	{
+		UNetDriver* NetDriver = GetServerNetDriver(World);
+		if (!NetDriver)
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < NumClients; ++Index)
+		{
+			const int32 ClientIndex = NextClientIndex++;
+			const FURL URL(nullptr, *FString::Printf(TEXT("?Name=SimulatedClient%d"), ClientIndex), TRAVEL_Absolute);
+
+			// Same login as a real client joining, past the handshake and control messages
+			USimulatedClientNetConnection* Connection = NewObject<USimulatedClientNetConnection>(NetDriver);
+			Connection->InitConnection(NetDriver, USOCK_Open, URL, 0);
+			NetDriver->AddClientConnection(Connection);
+			Connection->SetClientLoginState(EClientLoginState::Welcomed);
+
+			FString Error;
+			Connection->PlayerController = World->SpawnPlayActor(Connection, ROLE_AutonomousProxy, URL, Connection->PlayerId, Error);
+			if (!Connection->PlayerController)
+			{
+				UE_LOG(LogNet, Warning, TEXT("Simulated client %d failed to join: %s"), ClientIndex, *Error);
+				Connection->Close();
+				continue;
+			}
+
+			Connection->SetClientLoginState(EClientLoginState::ReceivedJoin);
+			Connection->InitSimulatedMovement(ClientIndex);
+		}
+
+		if (!WorldTickStartHandle.IsValid())
+		{
+			WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddStatic(&OnWorldTickStart);
+		}
+
+		UE_LOG(LogNet, Log, TEXT("Server load simulation: %d simulated clients connected."), GetNumClients(NetDriver));
+	}
+
+	static void RemoveClients(UWorld* World)
+	{
+		if (UNetDriver* NetDriver = GetServerNetDriver(World))
+		{
+			// Closed connections are cleaned up by the net driver, like any other
+			for (int32 Index = NetDriver->ClientConnections.Num() - 1; Index >= 0; --Index)
+			{
+				if (USimulatedClientNetConnection* Connection = Cast<USimulatedClientNetConnection>(NetDriver->ClientConnections[Index]))
+				{
+					Connection->Close();
+				}
+			}
+		}
+
+		FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+		WorldTickStartHandle.Reset();
+	}
+
+	static void StopBenchmark()
+	{
+		if (Benchmark.IsValid())
+		{
+			if (Benchmark->Chart.IsValid())
+			{
+				GEngine->RemovePerformanceDataConsumer(Benchmark->Chart);
+			}
+			Benchmark.Reset();
+		}
+	}
+
+	/** Logs the frame time and every performance tracking timer measured during a step */
+	static void EndBenchmarkStep(int32 NumClients, int64 BytesSent)
+	{
+		const FPerformanceTrackingChart& Chart = *Benchmark->Chart;
+		const double SecondsToMS = 1000.0;
+		const int64 NumFrames = FMath::Max<int64>(Chart.GetNumFrames(), 1);
+
+		FString Result = FString::Printf(TEXT("%4d clients: frame %6.2f ms, sent %8.1f KB/s"), NumClients,
+			SecondsToMS * Chart.GetTotalTime() / NumFrames, (BytesSent - Benchmark->StepStartBytesSent) / (1024.0 * FMath::Max(Chart.GetTotalTime(), SMALL_NUMBER)));
+
+		for (int32 TimerIndex = 0; TimerIndex < Chart.SubsystemTimeHistograms.Num(); ++TimerIndex)
+		{
+			const FHistogram& TimeHistogram = Chart.SubsystemTimeHistograms[TimerIndex];
+			if (TimeHistogram.GetNumMeasurements() > 0)
+			{
+				Result += FString::Printf(TEXT(", %s avg %5.2f p99 %5.2f ms"), *FPerformanceTrackingTimers::GetTimerName(TimerIndex).ToString(),
+					SecondsToMS * TimeHistogram.GetSumOfAllMeasures() / TimeHistogram.GetNumMeasurements(), SecondsToMS * FPerformanceTrackingChart::GetHistogramPercentile(TimeHistogram, 0.99));
+			}
+		}
+
+		UE_LOG(LogNet, Log, TEXT("Server load benchmark: %s"), *Result);
+		Benchmark->Results.Add(MoveTemp(Result));
+
+		GEngine->RemovePerformanceDataConsumer(Benchmark->Chart);
+		Benchmark->Chart.Reset();
+	}
+
+	static void TickBenchmark(UWorld* World, UNetDriver* NetDriver)
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		int64 BytesSent = 0;
+		const int32 NumClients = GetNumClients(NetDriver, &BytesSent);
+
+		if (Benchmark->bWarmingUp)
+		{
+			if (CurrentTime - Benchmark->StepStartTime >= BenchmarkWarmUpSeconds)
+			{
+				Benchmark->bWarmingUp = false;
+				Benchmark->StepStartTime = CurrentTime;
+				Benchmark->StepStartBytesSent = BytesSent;
+				Benchmark->Chart = MakeShareable(new FPerformanceTrackingChart(FDateTime::Now(), FString::Printf(TEXT("LoadSim%d"), NumClients)));
+				GEngine->AddPerformanceDataConsumer(Benchmark->Chart);
+			}
+			return;
+		}
+
+		if (CurrentTime - Benchmark->StepStartTime < Benchmark->StepSeconds)
+		{
+			return;
+		}
+
+		EndBenchmarkStep(NumClients, BytesSent);
+
+		if (NumClients >= Benchmark->MaxClients)
+		{
+			UE_LOG(LogNet, Display, TEXT("Server load benchmark finished:"));
+			for (const FString& Result : Benchmark->Results)
+			{
+				UE_LOG(LogNet, Display, TEXT("  %s"), *Result);
+			}
+			StopBenchmark();
+			return;
+		}
+
+		AddClients(World, FMath::Min(Benchmark->StepClients, Benchmark->MaxClients - NumClients));
+		Benchmark->bWarmingUp = true;
+		Benchmark->StepStartTime = CurrentTime;
+	}
+
+	static void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		UNetDriver* NetDriver = World->GetNetDriver();
+		if (!NetDriver || !NetDriver->IsServer())
+		{
+			return;
+		}
+
+		{
+			// Simulated moves are processed here rather than when receiving packets in TickDispatch
+			SCOPE_PERFORMANCE_TRACKING_TIMER(Movement);
+
+			for (UNetConnection* Connection : NetDriver->ClientConnections)
+			{
+				USimulatedClientNetConnection* SimulatedConnection = Cast<USimulatedClientNetConnection>(Connection);
+				if (SimulatedConnection && SimulatedConnection->State == USOCK_Open)
+				{
+					SimulatedConnection->TickSimulatedMovement(DeltaSeconds);
+				}
+			}
+		}
+
+		if (Benchmark.IsValid() && Benchmark->World == World)
+		{
+			TickBenchmark(World, NetDriver);
+		}
+	}
+
+	static void StartBenchmark(UWorld* World, int32 MaxClients, int32 StepClients, float StepSeconds)
+	{
+		UNetDriver* NetDriver = GetServerNetDriver(World);
+		if (!NetDriver)
+		{
+			return;
+		}
+
+		StopBenchmark();
+
+		Benchmark = MakeUnique<FBenchmark>();
+		Benchmark->World = World;
+		Benchmark->MaxClients = MaxClients;
+		Benchmark->StepClients = FMath::Max(StepClients, 1);
+		Benchmark->StepSeconds = FMath::Max(StepSeconds, 1.0f);
+		Benchmark->StepStartBytesSent = 0;
+
+		UE_LOG(LogNet, Display, TEXT("Server load benchmark: up to %d clients, %d at a time, measuring %.0f seconds per step."), Benchmark->MaxClients, Benchmark->StepClients, Benchmark->StepSeconds);
+
+		// The first step measures the server with the clients already connected, possibly none
+		Benchmark->bWarmingUp = true;
+		Benchmark->StepStartTime = FPlatformTime::Seconds();
+		if (!WorldTickStartHandle.IsValid())
+		{
+			WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddStatic(&OnWorldTickStart);
+		}
+	}
+}
+
+FAutoConsoleCommandWithWorldAndArgs LoadSimAddClientsCommand(TEXT("Net.LoadSim.AddClients"), TEXT("Connects simulated clients to the server. Usage: Net.LoadSim.AddClients <Num>"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 NumClients = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1;
+		ServerLoadSimulation::AddClients(World, FMath::Max(NumClients, 0));
+	})
+);
+
+FAutoConsoleCommandWithWorldAndArgs LoadSimRemoveClientsCommand(TEXT("Net.LoadSim.RemoveClients"), TEXT("Disconnects every simulated client and stops any server load benchmark."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		ServerLoadSimulation::StopBenchmark();
+		ServerLoadSimulation::RemoveClients(World);
+	})
+);
+
+FAutoConsoleCommandWithWorldAndArgs LoadSimBenchmarkCommand(TEXT("Net.LoadSim.Benchmark"), TEXT("Measures server frame time as simulated clients are added. Usage: Net.LoadSim.Benchmark <MaxClients> [Step=10] [SecondsPerStep=10]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogNet, Warning, TEXT("Usage: Net.LoadSim.Benchmark <MaxClients> [Step=10] [SecondsPerStep=10]"));
+			return;
+		}
+
+		const int32 MaxClients = FCString::Atoi(*Args[0]);
+		const int32 StepClients = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10;
+		const float StepSeconds = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 10.0f;
+		ServerLoadSimulation::StartBenchmark(World, MaxClients, StepClients, StepSeconds);
+	})
+);
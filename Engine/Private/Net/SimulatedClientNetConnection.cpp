@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Net/SimulatedClientNetConnection.h"
+
+#include "EngineLogs.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+
+/** Longest a simulated client walks in the same direction */
+static const float SimulatedClientMaxHeadingTime = 4.0f;
+
+/** Client time stamps are reset as often as CharacterMovementComponent's default MinTimeBetweenTimeStampResets */
+static const float SimulatedClientTimeStampResetInterval = 240.0f;
+
+USimulatedClientNetConnection::USimulatedClientNetConnection(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, MoveTimeStamp(0.0f)
+	, MoveHeading(ForceInitToZero)
+	, MoveHeadingTimeLeft(0.0f)
+	, SimulatedBytesSent(0)
+{
+	SetInternalAck(true);
+}
+
+void USimulatedClientNetConnection::InitConnection(UNetDriver* InDriver, EConnectionState InState, const FURL& InURL, int32 InConnectionSpeed, int32 InMaxPacket)
+{
+	Super::InitConnection(InDriver, InState, InURL, InConnectionSpeed, InMaxPacket);
+
+	// Packets are never received, pretend everything was acked as for replay connections
+	SetInternalAck(true);
+
+	InitSendBuffer();
+}
+
+FString USimulatedClientNetConnection::LowLevelGetRemoteAddress(bool bAppendPort)
+{
+	return FString::Printf(TEXT("SimulatedClient%d"), GetConnectionId());
+}
+
+FString USimulatedClientNetConnection::LowLevelDescribe()
+{
+	return FString::Printf(TEXT("Simulated client connection %d"), GetConnectionId());
+}
+
+void USimulatedClientNetConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits)
+{
+	SimulatedBytesSent += FMath::DivideAndRoundUp(CountBits, 8);
+}
+
+int32 USimulatedClientNetConnection::IsNetReady(bool Saturate)
+{
+	return 1;
+}
+
+void USimulatedClientNetConnection::InitSimulatedMovement(int32 Seed)
+{
+	MovementStream.Initialize(Seed);
+	MoveTimeStamp = 0.0f;
+	MoveHeadingTimeLeft = 0.0f;
+}
+
+void USimulatedClientNetConnection::TickSimulatedMovement(float DeltaSeconds)
+{
+	ACharacter* Character = PlayerController ? Cast<ACharacter>(PlayerController->GetPawn()) : nullptr;
+	UCharacterMovementComponent* MovementComponent = Character ? Character->GetCharacterMovement() : nullptr;
+	if (!MovementComponent || DeltaSeconds <= 0.0f)
+	{
+		return;
+	}
+
+	// A real client acks its pawn before its moves are accepted. Its location isn't predicted, so don't correct it either.
+	PlayerController->AcknowledgedPawn = Character;
+	MovementComponent->bIgnoreClientMovementErrorChecksAndCorrection = true;
+
+	MoveHeadingTimeLeft -= DeltaSeconds;
+	if (MoveHeadingTimeLeft <= 0.0f)
+	{
+		MoveHeading = FRotator(0.0f, MovementStream.FRandRange(0.0f, 360.0f), 0.0f);
+		MoveHeadingTimeLeft = MovementStream.FRandRange(0.5f, SimulatedClientMaxHeadingTime);
+	}
+
+	MoveTimeStamp += DeltaSeconds;
+	if (MoveTimeStamp > SimulatedClientTimeStampResetInterval)
+	{
+		MoveTimeStamp = DeltaSeconds;
+	}
+
+	const FVector Acceleration = MoveHeading.Vector() * MovementComponent->GetMaxAcceleration();
+	const FVector ClientLocation = Character->GetActorLocation();
+	const uint32 View = UCharacterMovementComponent::PackYawAndPitchTo32(MoveHeading.Yaw, MoveHeading.Pitch);
+
+	// Same move a client would send through ServerMove, without the RPC serialization
+	Character->ServerMove_Implementation(MoveTimeStamp, Acceleration, ClientLocation, 0, 0, View, nullptr, NAME_None, MovementComponent->PackNetworkMovementMode());
+}
@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Engine/NetSerialization.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetSerializeVectorComponentsTest, "Net.SerializeVectorComponentsTest", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FNetSerializeVectorComponentsTest::RunTest(const FString& Parameters)
+{
+	const uint32 TestValues[][3] = { { 0, 0, 0 }, { 1, 2, 3 }, { 0x155, 0x2AA, 0x0F0 }, { 0xFFFFFFFF, 0x7FFFFFFF, 0x12345678 } };
+
+	for (uint32 NumBits = 2; NumBits <= 31; ++NumBits)
+	{
+		const uint32 Mask = (1U << NumBits) - 1;
+
+		for (const uint32 (&Values)[3] : TestValues)
+		{
+			uint32 X = Values[0] & Mask;
+			uint32 Y = Values[1] & Mask;
+			uint32 Z = Values[2] & Mask;
+
+			// Reference layout, component by component
+			FBitWriter Expected(0, true);
+			Expected.WriteBit(1);
+			Expected.SerializeInt(X, 1U << NumBits);
+			Expected.SerializeInt(Y, 1U << NumBits);
+			Expected.SerializeInt(Z, 1U << NumBits);
+
+			// Start unaligned so the packed path has to cross byte boundaries
+			FBitWriter Writer(0, true);
+			Writer.WriteBit(1);
+			SerializeVectorComponents(Writer, X, Y, Z, NumBits);
+
+			TestEqual(FString::Printf(TEXT("NumBits %u written size"), NumBits), Writer.GetNumBits(), Expected.GetNumBits());
+			TestTrue(FString::Printf(TEXT("NumBits %u written bits"), NumBits), Writer.GetNumBytes() == Expected.GetNumBytes() && FMemory::Memcmp(Writer.GetData(), Expected.GetData(), Writer.GetNumBytes()) == 0);
+
+			FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+			Reader.ReadBit();
+
+			uint32 ReadX = 0;
+			uint32 ReadY = 0;
+			uint32 ReadZ = 0;
+			SerializeVectorComponents(Reader, ReadX, ReadY, ReadZ, NumBits);
+
+			TestFalse(FString::Printf(TEXT("NumBits %u read error"), NumBits), Reader.IsError());
+			TestTrue(FString::Printf(TEXT("NumBits %u read values"), NumBits), ReadX == X && ReadY == Y && ReadZ == Z);
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
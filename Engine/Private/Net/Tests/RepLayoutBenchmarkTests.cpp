@@ -0,0 +1,240 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "UObject/Package.h"
+#include "Net/RepLayout.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/SimulatedClientNetConnection.h"
+#include "Engine/ActorChannel.h"
+#include "Tests/RepLayoutBenchmarkObjects.h"
+
+void URepLayoutBenchmarkScalars::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(URepLayoutBenchmarkScalars, Ints);
+	DOREPLIFETIME(URepLayoutBenchmarkScalars, Floats);
+	DOREPLIFETIME(URepLayoutBenchmarkScalars, Vectors);
+	DOREPLIFETIME(URepLayoutBenchmarkScalars, bFlag0);
+	DOREPLIFETIME(URepLayoutBenchmarkScalars, bFlag1);
+	DOREPLIFETIME(URepLayoutBenchmarkScalars, Name);
+}
+
+void URepLayoutBenchmarkScalars::Mutate(int32 Iteration)
+{
+	Ints[Iteration % 8] = Iteration;
+	Floats[(Iteration * 3) % 8] += 0.5f;
+	Vectors[Iteration % 4].X += 1.0f;
+	bFlag0 = Iteration & 1;
+
+	if (Iteration % 16 == 0)
+	{
+		Name = FName(TEXT("RepLayoutBenchmark"), Iteration / 16);
+	}
+}
+
+void URepLayoutBenchmarkStructs::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(URepLayoutBenchmarkStructs, Structs);
+	DOREPLIFETIME(URepLayoutBenchmarkStructs, Nested);
+}
+
+void URepLayoutBenchmarkStructs::Mutate(int32 Iteration)
+{
+	FRepLayoutBenchmarkStruct& Struct = Structs[Iteration % 8];
+	Struct.Int = Iteration;
+	Struct.Vector.Z += 1.0f;
+
+	Nested.Inner[Iteration % 4].Float += 1.0f;
+	Nested.Values.SetNum(8 + Iteration % 4);
+	Nested.Values[Iteration % Nested.Values.Num()] = Iteration;
+}
+
+URepLayoutBenchmarkArrays::URepLayoutBenchmarkArrays()
+{
+	Ints.SetNumZeroed(64);
+	Vectors.SetNumZeroed(32);
+	Structs.SetNum(16);
+}
+
+void URepLayoutBenchmarkArrays::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(URepLayoutBenchmarkArrays, Ints);
+	DOREPLIFETIME(URepLayoutBenchmarkArrays, Vectors);
+	DOREPLIFETIME(URepLayoutBenchmarkArrays, Structs);
+}
+
+void URepLayoutBenchmarkArrays::Mutate(int32 Iteration)
+{
+	Ints[Iteration % Ints.Num()] = Iteration;
+	Vectors[(Iteration * 7) % Vectors.Num()].Y += 1.0f;
+
+	// Grow and shrink the struct array, so resizes are part of what's measured
+	Structs.SetNum(16 + Iteration % 8);
+	Structs[Iteration % Structs.Num()].Byte++;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Measures CompareProperties, SendProperties and ReceiveProperties of a class outside of any net driver, so changes to
+ * the property replication path can be compared run to run. The sending side is set up as a server replicating to a
+ * single connection and the receiving side as the client of that connection.
+ */
+class FRepLayoutBenchmark
+{
+public:
+
+	struct FResult
+	{
+		FString Name;
+		int32 NumIterations = 0;
+		int32 NumParents = 0;
+		int64 NumChangedHandles = 0;
+		int64 NumBits = 0;
+		uint64 CompareCycles = 0;
+		uint64 SendCycles = 0;
+		uint64 ReceiveCycles = 0;
+		bool bReceivedAll = true;
+
+		double GetCompareNsPerProperty() const { return ToNanoseconds(CompareCycles) / FMath::Max<int64>((int64)NumIterations * NumParents, 1); }
+		double GetSendNsPerProperty() const { return ToNanoseconds(SendCycles) / FMath::Max<int64>(NumChangedHandles, 1); }
+		double GetReceiveNsPerProperty() const { return ToNanoseconds(ReceiveCycles) / FMath::Max<int64>(NumChangedHandles, 1); }
+		double GetBytesPerSend() const { return NumBits / 8.0 / FMath::Max(NumIterations, 1); }
+
+		static double ToNanoseconds(uint64 Cycles) { return FPlatformTime::ToMilliseconds64(Cycles) * 1000000.0; }
+	};
+
+	static FResult Run(UClass* ObjectClass, int32 NumIterations)
+	{
+		check(ObjectClass->IsChildOf(URepLayoutBenchmarkObject::StaticClass()));
+
+		URepLayoutBenchmarkObject* Sender = NewObject<URepLayoutBenchmarkObject>(GetTransientPackage(), ObjectClass);
+		URepLayoutBenchmarkObject* Receiver = NewObject<URepLayoutBenchmarkObject>(GetTransientPackage(), ObjectClass);
+
+		// Only used by ReceiveProperties to pick the non replay path
+		USimulatedClientNetConnection* Connection = NewObject<USimulatedClientNetConnection>();
+		Connection->SetInternalAck(false);
+		UActorChannel* Channel = NewObject<UActorChannel>();
+		Channel->Connection = Connection;
+
+		TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(ObjectClass);
+
+		TSharedPtr<FReplicationChangelistMgr> ChangelistMgr = RepLayout->CreateReplicationChangelistMgr(Sender, ECreateReplicationChangelistMgrFlags::None);
+		FRepChangelistState* ChangelistState = ChangelistMgr->GetRepChangelistState();
+
+		TSharedPtr<FRepChangedPropertyTracker> ChangedTracker = MakeShareable(new FRepChangedPropertyTracker(false, false));
+		RepLayout->InitChangedTracker(ChangedTracker.Get());
+
+		TUniquePtr<FRepState> SenderRepState = RepLayout->CreateRepState(Sender, ChangedTracker, ECreateRepStateFlags::SkipCreateReceivingState);
+		FSendingRepState* SendingRepState = SenderRepState->GetSendingRepState();
+
+		TSharedPtr<FRepChangedPropertyTracker> NoTracker;
+		TUniquePtr<FRepState> ReceiverRepState = RepLayout->CreateRepState(Receiver, NoTracker, ECreateRepStateFlags::None);
+		FReceivingRepState* ReceivingRepState = ReceiverRepState->GetReceivingRepState();
+
+		FResult Result;
+		Result.Name = ObjectClass->GetName();
+		Result.NumIterations = NumIterations;
+		Result.NumParents = RepLayout->Parents.Num();
+
+		const FReplicationFlags RepFlags;
+		FRepSerializationSharedInfo SharedInfo;
+		TArray<uint16> Changed;
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Sender->Mutate(Iteration);
+
+			const uint64 CompareStartCycles = FPlatformTime::Cycles64();
+			const bool bHasChanges = RepLayout->CompareProperties(SendingRepState, ChangelistState, Sender, RepFlags);
+			Result.CompareCycles += FPlatformTime::Cycles64() - CompareStartCycles;
+
+			if (!bHasChanges)
+			{
+				continue;
+			}
+
+			// The newest changelist, null terminated
+			Changed = ChangelistState->ChangeHistory[(ChangelistState->HistoryEnd - 1) % FRepChangelistState::MAX_CHANGE_HISTORY].Changed;
+			Result.NumChangedHandles += Changed.Num() - 1;
+
+			FNetBitWriter Writer(nullptr, 8192);
+
+			const uint64 SendStartCycles = FPlatformTime::Cycles64();
+			RepLayout->SendProperties(SendingRepState, ChangedTracker.Get(), Sender, ObjectClass, Writer, Changed, SharedInfo);
+			Result.SendCycles += FPlatformTime::Cycles64() - SendStartCycles;
+			Result.NumBits += Writer.GetNumBits();
+
+			FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+			bool bHasUnmapped = false;
+			bool bGuidsChanged = false;
+
+			const uint64 ReceiveStartCycles = FPlatformTime::Cycles64();
+			const bool bReceived = RepLayout->ReceiveProperties(Channel, ObjectClass, ReceivingRepState, Receiver, Reader, bHasUnmapped, bGuidsChanged, EReceivePropertiesFlags::None);
+			Result.ReceiveCycles += FPlatformTime::Cycles64() - ReceiveStartCycles;
+
+			Result.bReceivedAll &= bReceived && !Reader.IsError();
+		}
+
+		Channel->Connection = nullptr;
+		Channel->MarkPendingKill();
+		Connection->MarkPendingKill();
+		Sender->MarkPendingKill();
+		Receiver->MarkPendingKill();
+
+		return Result;
+	}
+
+	/** Appends the results to Saved/Profiling/RepLayoutBenchmarks.csv, one row per class, so runs can be compared across builds */
+	static void WriteCSV(const TArray<FResult>& Results)
+	{
+		const FString Filename = FPaths::ProfilingDir() / TEXT("RepLayoutBenchmarks.csv");
+
+		FString CSV;
+		if (!IFileManager::Get().FileExists(*Filename))
+		{
+			CSV += TEXT("Date,BuildVersion,Class,Iterations,Properties,CompareNsPerProperty,SendNsPerProperty,ReceiveNsPerProperty,BytesPerSend\n");
+		}
+
+		const FString Date = FDateTime::Now().ToString();
+		for (const FResult& Result : Results)
+		{
+			CSV += FString::Printf(TEXT("%s,%s,%s,%d,%d,%.2f,%.2f,%.2f,%.2f\n"), *Date, FApp::GetBuildVersion(), *Result.Name, Result.NumIterations, Result.NumParents,
+				Result.GetCompareNsPerProperty(), Result.GetSendNsPerProperty(), Result.GetReceiveNsPerProperty(), Result.GetBytesPerSend());
+		}
+
+		FFileHelper::SaveStringToFile(CSV, *Filename, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), EFileWrite::FILEWRITE_Append);
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRepLayoutBenchmarkTest, "Net.RepLayoutBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FRepLayoutBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int32 NumIterations = Parameters.IsNumeric() ? FCString::Atoi(*Parameters) : 10000;
+
+	TArray<FRepLayoutBenchmark::FResult> Results;
+	for (UClass* ObjectClass : { URepLayoutBenchmarkScalars::StaticClass(), URepLayoutBenchmarkStructs::StaticClass(), URepLayoutBenchmarkArrays::StaticClass() })
+	{
+		const FRepLayoutBenchmark::FResult& Result = Results.Add_GetRef(FRepLayoutBenchmark::Run(ObjectClass, NumIterations));
+
+		TestTrue(FString::Printf(TEXT("%s received every send"), *Result.Name), Result.bReceivedAll);
+		AddInfo(FString::Printf(TEXT("%s: %d properties, compare %.2f ns/property, send %.2f ns/property, receive %.2f ns/property, %.2f bytes/send"),
+			*Result.Name, Result.NumParents, Result.GetCompareNsPerProperty(), Result.GetSendNsPerProperty(), Result.GetReceiveNsPerProperty(), Result.GetBytesPerSend()));
+	}
+
+	FRepLayoutBenchmark::WriteCSV(Results);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -64,6 +64,12 @@ static TAutoConsoleVariable<int32> CVarNetPacketOrderMaxMissingPackets(TEXT("net
 
 static TAutoConsoleVariable<int32> CVarNetPacketOrderMaxCachedPackets(TEXT("net.PacketOrderMaxCachedPackets"), 32, TEXT("(NOTE: Must be power of 2!) The maximum number of packets to cache while waiting for missing packet sequences, before treating missing packets as lost."));
 
+static int32 GNetBunchPoolSize = 32;
+static FAutoConsoleVariableRef CVarNetBunchPoolSize(
+	TEXT("net.BunchPoolSize"),
+	GNetBunchPoolSize,
+	TEXT("The maximum number of released reliable out bunches and queued in bunches each connection keeps for reuse. 0 disables pooling."));
+
 TAutoConsoleVariable<int32> CVarNetEnableDetailedScopeCounters(TEXT("net.EnableDetailedScopeCounters"), 1, TEXT("Enables detailed networking scope cycle counters. There are often lots of these which can negatively impact performance."));
 
 #if !UE_BUILD_SHIPPING
@@ -699,6 +705,19 @@ void UNetConnection::Serialize( FArchive& Ar )
 			Ar.CountBytes(SizeAllocatedByChannelRecord, SizeAllocatedByChannelRecord)
 		);
 
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("FreeReliableOutBunches",
+			FreeReliableOutBunches.CountBytes(Ar);
+			for (const FOutBunch* Bunch : FreeReliableOutBunches)
+			{
+				Bunch->CountMemory(Ar);
+			}
+		);
+
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("FreeInBunchMemory",
+			FreeInBunchMemory.CountBytes(Ar);
+			Ar.CountBytes(FreeInBunchMemory.Num() * sizeof(FInBunch), FreeInBunchMemory.Num() * sizeof(FInBunch));
+		);
+
 		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("LastOut", LastOut.CountMemory(Ar));
 		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SendBunchHeader", SendBunchHeader.CountMemory(Ar));
 
@@ -878,6 +897,9 @@ void UNetConnection::CleanUp()
 
 	Driver = nullptr;
 
+	// All channels have been cleaned up by now, and any bunch released later is deleted directly
+	EmptyBunchPools();
+
 #if UE_NET_TRACE_ENABLED	
 	UE_NET_TRACE_DESTROY_COLLECTOR(InTraceCollector);
 	UE_NET_TRACE_DESTROY_COLLECTOR(OutTraceCollector);
@@ -1241,7 +1263,11 @@ void UNetConnection::ReceivedRawPacket( void* InData, int32 Count )
 		}
 	}
 
+	ReceivedHandledRawPacket(Data, Count);
+}
 
+void UNetConnection::ReceivedHandledRawPacket(uint8* Data, int32 Count)
+{
 	// Handle an incoming raw packet from the driver.
 	UE_LOG(LogNetTraffic, Verbose, TEXT("%6.3f: Received %i"), FPlatformTime::Seconds() - GStartTime, Count );
 	int32 PacketBytes = Count + PacketOverhead;
@@ -1306,6 +1332,87 @@ void UNetConnection::ReceivedRawPacket( void* InData, int32 Count )
 	}
 }
 
+bool UNetConnection::CanDecodeRawPacketsAsync() const
+{
+	// Handlers that are still handshaking may need to send packets or touch driver state while processing incoming data,
+	// so only connections that are fully set up are decoded off the game thread.
+	if (State != USOCK_Open || (Handler.IsValid() && !Handler->IsFullyInitialized()))
+	{
+		return false;
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (ReceivedRawPacketDel.IsBound())
+	{
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+void UNetConnection::DecodeRawPacket_AnyThread(uint8* InData, int32 Count)
+{
+	FDecodedRawPacket DecodedPacket;
+
+	if (Handler.IsValid())
+	{
+		const ProcessedPacket UnProcessedPacket = Handler->Incoming(InData, Count);
+
+		if (UnProcessedPacket.bError)
+		{
+			DecodedPacket.bHandlerError = true;
+		}
+		else
+		{
+			Count = FMath::DivideAndRoundUp(UnProcessedPacket.CountBits, 8);
+
+			// This packet has been consumed
+			if (Count <= 0)
+			{
+				return;
+			}
+
+			DecodedPacket.Data.Append(UnProcessedPacket.Data, Count);
+		}
+	}
+	else
+	{
+		DecodedPacket.Data.Append(InData, Count);
+	}
+
+	DecodedRawPackets.Enqueue(MoveTemp(DecodedPacket));
+}
+
+void UNetConnection::ProcessDecodedRawPackets()
+{
+	FDecodedRawPacket DecodedPacket;
+	while (DecodedRawPackets.Dequeue(DecodedPacket))
+	{
+		if (State == USOCK_Closed)
+		{
+			continue;
+		}
+
+#if DO_ENABLE_NET_TEST
+		// Opportunity for packet loss burst simulation to drop the incoming packet.
+		if (Driver && Driver->IsSimulatingPacketLossBurst())
+		{
+			continue;
+		}
+#endif
+
+		if (DecodedPacket.bHandlerError)
+		{
+			CLOSE_CONNECTION_DUE_TO_SECURITY_VIOLATION(this, ESecurityEvent::Malformed_Packet,
+														TEXT("Packet failed PacketHandler processing."));
+			continue;
+		}
+
+		ReceivedHandledRawPacket(DecodedPacket.Data.GetData(), DecodedPacket.Data.Num());
+	}
+}
+
 void UNetConnection::PostTickDispatch()
 {
 	if (!IsInternalAck())
@@ -1390,6 +1497,92 @@ void UNetConnection::ReinjectDelayedPackets()
 
 uint32 GNetOutBytes = 0;
 
+FOutBunch* UNetConnection::AllocReliableOutBunch(const FOutBunch& Source)
+{
+	if (FreeReliableOutBunches.Num() > 0)
+	{
+		// Assignment keeps the existing buffer allocation when the sizes match, which they do for bunches from the same connection
+		FOutBunch* Bunch = FreeReliableOutBunches.Pop(false);
+		*Bunch = Source;
+		return Bunch;
+	}
+
+	return new FOutBunch(Source);
+}
+
+void UNetConnection::ReleaseReliableOutBunch(FOutBunch* Bunch)
+{
+	// Once cleaned up, nothing will empty the pool again
+	if (Driver != nullptr && FreeReliableOutBunches.Num() < GNetBunchPoolSize)
+	{
+		Bunch->Next = nullptr;
+		Bunch->Channel = nullptr;
+		FreeReliableOutBunches.Add(Bunch);
+	}
+	else
+	{
+		delete Bunch;
+	}
+}
+
+FInBunch* UNetConnection::AllocInBunch(FInBunch& Source)
+{
+	if (FreeInBunchMemory.Num() > 0)
+	{
+		return new (FreeInBunchMemory.Pop(false)) FInBunch(Source);
+	}
+
+	return new FInBunch(Source);
+}
+
+void UNetConnection::ReleaseInBunch(FInBunch* Bunch)
+{
+	if (Driver != nullptr && FreeInBunchMemory.Num() < GNetBunchPoolSize)
+	{
+		Bunch->~FInBunch();
+		FreeInBunchMemory.Add(Bunch);
+	}
+	else
+	{
+		delete Bunch;
+	}
+}
+
+void UNetConnection::EmptyBunchPools()
+{
+	for (FOutBunch* Bunch : FreeReliableOutBunches)
+	{
+		delete Bunch;
+	}
+	FreeReliableOutBunches.Empty();
+
+	for (void* Memory : FreeInBunchMemory)
+	{
+		::operator delete(Memory);
+	}
+	FreeInBunchMemory.Empty();
+}
+
+void UNetConnection::FlushBatchedRemoteFunctions()
+{
+	if (ChannelsWithBatchedRemoteFunctions.Num() == 0)
+	{
+		return;
+	}
+
+	// Sending may close channels, which removes them from the list, so work from a copy.
+	TArray<UActorChannel*> ChannelsToFlush = MoveTemp(ChannelsWithBatchedRemoteFunctions);
+	ChannelsWithBatchedRemoteFunctions.Reset();
+
+	for (UActorChannel* Channel : ChannelsToFlush)
+	{
+		if (Channel && !Channel->Closing)
+		{
+			Channel->FlushBatchedRemoteFunctions();
+		}
+	}
+}
+
 void UNetConnection::FlushNet(bool bIgnoreSimulation)
 {
 	check(Driver);
@@ -3435,6 +3628,9 @@ void UNetConnection::Tick()
 		}
 	}
 
+	// Send any unreliable RPCs that were batched this frame, so they can go out with this flush.
+	FlushBatchedRemoteFunctions();
+
 	// Flush.
 	if ( TimeSensitive || (Driver->GetElapsedTime() - LastSendTime) > Driver->KeepAliveTime)
 	{
@@ -4068,6 +4264,36 @@ void UNetConnection::TrackReplicationForAnalytics(const bool bWasSaturated)
 	SaturationAnalytics.TrackReplication(bWasSaturated);
 }
 
+void UNetConnection::TrackBudgetLimitedReplicationForAnalytics()
+{
+	StarvationAnalytics.TrackBudgetLimitedReplication();
+}
+
+void UNetConnection::NotifyStarvedActorReplicated(AActor* Actor, double ElapsedTime)
+{
+	FActorReplicationStarvation Starvation;
+	if (StarvedActors.RemoveAndCopyValue(Actor, Starvation))
+	{
+		StarvationAnalytics.TrackStarvation(ElapsedTime - Starvation.StarvedSinceTime);
+	}
+}
+
+void UNetConnection::ConsumeStarvationAnalytics(FNetConnectionStarvationAnalytics& Out)
+{
+	Out = StarvationAnalytics;
+	StarvationAnalytics.Reset();
+}
+
+const FNetConnectionStarvationAnalytics& UNetConnection::GetStarvationAnalytics() const
+{
+	return StarvationAnalytics;
+}
+
+void UNetConnection::ResetStarvationAnalytics()
+{
+	StarvationAnalytics.Reset();
+}
+
 void UNetConnection::ProcessJitter(uint32 PacketJitterClockTimeMS)
 {
 	if (PacketJitterClockTimeMS >= UE4_NetConnectionPrivate::MaxJitterClockTimeValue)
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/NetUpdateFrequencyScheduler.h"
+#include "Engine/NetConnection.h"
+#include "Engine/ChildConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "GameFramework/Actor.h"
+
+UNetUpdateFrequencyScheduler::UNetUpdateFrequencyScheduler()
+	: NetDriver(nullptr)
+	, ChangeRateSmoothing(0.25f)
+	, HotActorChangeRate(0.9f)
+	, HotActorFrequencyScale(1.0f)
+	, DistanceScaleStart(5000.0f)
+	, DistanceScaleEnd(15000.0f)
+	, SaturatedConnectionThreshold(0.25f)
+	, SaturatedConnectionRatio(0.0f)
+{
+}
+
+void UNetUpdateFrequencyScheduler::InitForNetDriver(UNetDriver* InNetDriver)
+{
+	NetDriver = InNetDriver;
+}
+
+void UNetUpdateFrequencyScheduler::BeginFrame(const TArray<UNetConnection*>& ClientConnections, float DeltaSeconds)
+{
+	ViewerLocations.Reset();
+
+	int32 NumConnections = 0;
+	int32 NumSaturated = 0;
+
+	for (UNetConnection* Connection : ClientConnections)
+	{
+		if (Connection == nullptr || Connection->State == USOCK_Closed)
+		{
+			continue;
+		}
+
+		++NumConnections;
+		if (!Connection->IsNetReady(false))
+		{
+			++NumSaturated;
+		}
+
+		if (Connection->ViewTarget)
+		{
+			ViewerLocations.Add(Connection->ViewTarget->GetActorLocation());
+		}
+
+		for (UChildConnection* Child : Connection->Children)
+		{
+			if (Child && Child->ViewTarget)
+			{
+				ViewerLocations.Add(Child->ViewTarget->GetActorLocation());
+			}
+		}
+	}
+
+	SaturatedConnectionRatio = NumConnections > 0 ? (float)NumSaturated / (float)NumConnections : 0.0f;
+}
+
+float UNetUpdateFrequencyScheduler::GetNextUpdateDelta(FNetworkObjectInfo& ActorInfo, double WorldTime)
+{
+	AActor* Actor = ActorInfo.Actor;
+
+	// Fold the result of the previous scheduled update into the change rate history.
+	const float Sample = ActorInfo.bReplicatedSinceLastSchedule ? 1.0f : 0.0f;
+	ActorInfo.ObservedChangeRate = FMath::Lerp(ActorInfo.ObservedChangeRate, Sample, FMath::Clamp(ChangeRateSmoothing, KINDA_SMALL_NUMBER, 1.0f));
+	ActorInfo.bReplicatedSinceLastSchedule = false;
+
+	if (Actor->MinNetUpdateFrequency == 0.0f)
+	{
+		Actor->MinNetUpdateFrequency = 2.0f;
+	}
+
+	// Don't go faster than NetUpdateFrequency, and don't go slower than MinNetUpdateFrequency (or NetUpdateFrequency if it's slower)
+	const float MinDelta = 1.0f / Actor->NetUpdateFrequency;
+	const float MaxDelta = FMath::Max(1.0f / Actor->MinNetUpdateFrequency, MinDelta);
+
+	if (ActorInfo.ObservedChangeRate >= HotActorChangeRate)
+	{
+		return MinDelta / FMath::Max(HotActorFrequencyScale, 1.0f);
+	}
+
+	// Each factor independently pushes the actor toward MaxDelta.
+	const float ChangeAlpha = 1.0f - ActorInfo.ObservedChangeRate;
+	const float Alpha = 1.0f - (1.0f - ChangeAlpha) * (1.0f - GetDistanceAlpha(Actor)) * (1.0f - GetBandwidthAlpha());
+
+	ActorInfo.OptimalNetUpdateDelta = FMath::Lerp(MinDelta, MaxDelta, FMath::Clamp(Alpha, 0.0f, 1.0f));
+	return ActorInfo.OptimalNetUpdateDelta;
+}
+
+void UNetUpdateFrequencyScheduler::NotifyActorReplicated(FNetworkObjectInfo& ActorInfo, UNetConnection* Connection)
+{
+	ActorInfo.bReplicatedSinceLastSchedule = true;
+}
+
+float UNetUpdateFrequencyScheduler::GetDistanceAlpha(const AActor* Actor) const
+{
+	if (ViewerLocations.Num() == 0 || DistanceScaleEnd <= DistanceScaleStart)
+	{
+		return 0.0f;
+	}
+
+	const FVector ActorLocation = Actor->GetActorLocation();
+
+	float ClosestDistSq = TNumericLimits<float>::Max();
+	for (const FVector& ViewerLocation : ViewerLocations)
+	{
+		ClosestDistSq = FMath::Min(ClosestDistSq, FVector::DistSquared(ActorLocation, ViewerLocation));
+	}
+
+	return FMath::Clamp((FMath::Sqrt(ClosestDistSq) - DistanceScaleStart) / (DistanceScaleEnd - DistanceScaleStart), 0.0f, 1.0f);
+}
+
+float UNetUpdateFrequencyScheduler::GetBandwidthAlpha() const
+{
+	if (SaturatedConnectionRatio <= SaturatedConnectionThreshold || SaturatedConnectionThreshold >= 1.0f)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Clamp((SaturatedConnectionRatio - SaturatedConnectionThreshold) / (1.0f - SaturatedConnectionThreshold), 0.0f, 1.0f);
+}
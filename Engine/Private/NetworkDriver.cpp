@@ -59,12 +59,16 @@
 #include "Engine/ChildConnection.h"
 #include "Net/Core/Trace/NetTrace.h"
 #include "Misc/ScopeExit.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
 #include "Net/DataChannel.h"
 #include "GameFramework/PlayerState.h"
 #include "Net/PerfCountersHelpers.h"
 #include "Stats/StatsMisc.h"
 #include "Engine/ReplicationDriver.h"
+#include "Engine/NetUpdateFrequencyScheduler.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "InGamePerformanceTracker.h"
 #include "Engine/LevelScriptActor.h"
 #include "Engine/NetworkSettings.h"
 #include "Net/NetworkGranularMemoryLogging.h"
@@ -148,6 +152,9 @@ DECLARE_CYCLE_STAT(TEXT("Process Prioritized Actors Time"), STAT_NetProcessPrior
 DECLARE_CYCLE_STAT(TEXT("NetDriver TickFlush"), STAT_NetTickFlush, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("NetDriver TickFlush GatherStats"), STAT_NetTickFlushGatherStats, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("NetDriver TickFlush GatherStatsPerfCounters"), STAT_NetTickFlushGatherStatsPerfCounters, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("NetDriver TickFlush SendBatch"), STAT_NetTickFlushSendBatch, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("NetDriver ReceiveRawPackets"), STAT_NetReceiveRawPackets, STATGROUP_Net);
+DECLARE_CYCLE_STAT(TEXT("NetDriver DecodeRawPacketsParallel"), STAT_NetDecodeRawPacketsParallel, STATGROUP_Net);
 
 int32 GNumSaturatedConnections; // Counter for how many connections are skipped/early out due to bandwidth saturation
 int32 GNumSharedSerializationHit;
@@ -207,6 +214,29 @@ static FAutoConsoleVariableRef CVarNetDormancyValidate(
 	TEXT("0: Dont validate. 1: Validate on wake up. 2: Validate on each net update"),
 	ECVF_Default);
 
+float GNetDormancyWakeUpDistance = 0.0f;
+static FAutoConsoleVariableRef CVarNetDormancyWakeUpDistance(
+	TEXT("net.DormancyWakeUpDistance"),
+	GNetDormancyWakeUpDistance,
+	TEXT("When > 0, actors dormant on a connection are flushed for that connection when one of its viewers moves within this distance of them, ")
+	TEXT("as if FlushNetDormancy had been called for that connection only. Actors go back to dormant as usual after replicating. Only used without a ReplicationDriver."),
+	ECVF_Default);
+
+float GNetDormancyWakeUpInterval = 0.25f;
+static FAutoConsoleVariableRef CVarNetDormancyWakeUpInterval(
+	TEXT("net.DormancyWakeUpInterval"),
+	GNetDormancyWakeUpInterval,
+	TEXT("Seconds between the viewer distance checks done for net.DormancyWakeUpDistance."),
+	ECVF_Default);
+
+int32 GNetBatchSends = 0;
+static FAutoConsoleVariableRef CVarNetBatchSends(
+	TEXT("net.BatchSends"),
+	GNetBatchSends,
+	TEXT("When enabled, net drivers that support send batching queue the packets produced during TickFlush ")
+	TEXT("and submit them together once every connection has flushed, instead of making one socket call per packet."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarNetDebugDraw(
 	TEXT("net.DebugDraw"),
 	0,
@@ -231,6 +261,96 @@ TAutoConsoleVariable<int32> CVarNetAllowEncryption(
 	1,
 	TEXT("If true, the engine will attempt to load an encryption PacketHandler component and fill in the EncryptionToken parameter of the NMT_Hello message based on the ?EncryptionToken= URL option and call callbacks if it's non-empty."));
 
+int32 GNetParallelPrioritizeConnections = 0;
+static FAutoConsoleVariableRef CVarNetParallelPrioritizeConnections(
+	TEXT("net.ParallelPrioritizeConnections"),
+	GNetParallelPrioritizeConnections,
+	TEXT("When enabled, ServerReplicateActors builds the relevant and prioritized actor lists for each connection in parallel on the task graph.\n")
+	TEXT("Actor replication itself (bunch writes) still happens serially on the game thread. Ignored while net.DebugRelevantActors is active.\n")
+	TEXT("IsNetRelevantFor, GetNetPriority and GetNetDormancy overrides must be safe to call from worker threads when this is enabled."),
+	ECVF_Default);
+
+int32 GNetParallelPrioritizeMinConnections = 4;
+static FAutoConsoleVariableRef CVarNetParallelPrioritizeMinConnections(
+	TEXT("net.ParallelPrioritizeConnections.MinConnections"),
+	GNetParallelPrioritizeMinConnections,
+	TEXT("Minimum number of connections ticked in a frame before net.ParallelPrioritizeConnections goes wide."),
+	ECVF_Default);
+
+int32 GNetDecodePacketsInParallel = 0;
+static FAutoConsoleVariableRef CVarNetDecodePacketsInParallel(
+	TEXT("net.DecodePacketsInParallel"),
+	GNetDecodePacketsInParallel,
+	TEXT("If true, UNetDriver::ReceiveRawPackets runs PacketHandler processing for fully connected clients on worker threads before applying the packets on the game thread."),
+	ECVF_Default);
+
+int32 GNetDecodePacketsInParallelMinConnections = 4;
+static FAutoConsoleVariableRef CVarNetDecodePacketsInParallelMinConnections(
+	TEXT("net.DecodePacketsInParallel.MinConnections"),
+	GNetDecodePacketsInParallelMinConnections,
+	TEXT("Minimum number of connections with received packets in a batch before net.DecodePacketsInParallel goes wide."),
+	ECVF_Default);
+
+int32 GNetBatchUnreliableRPCs = 0;
+static FAutoConsoleVariableRef CVarNetBatchUnreliableRPCs(
+	TEXT("net.BatchUnreliableRPCs"),
+	GNetBatchUnreliableRPCs,
+	TEXT("If true, unreliable non-multicast RPCs are batched per actor channel and sent together in a single bunch when the connection ticks, instead of each RPC sending its own bunch."),
+	ECVF_Default);
+
+int32 GNetConnectionReplicationByteBudget = 0;
+static FAutoConsoleVariableRef CVarNetConnectionReplicationByteBudget(
+	TEXT("net.ConnectionReplicationByteBudget"),
+	GNetConnectionReplicationByteBudget,
+	TEXT("If > 0, the maximum number of bytes ServerReplicateActors will send to a single connection per frame. Actors that don't fit are aged and considered again next frame."),
+	ECVF_Default);
+
+float GNetConnectionReplicationTimeBudgetMS = 0.0f;
+static FAutoConsoleVariableRef CVarNetConnectionReplicationTimeBudgetMS(
+	TEXT("net.ConnectionReplicationTimeBudgetMS"),
+	GNetConnectionReplicationTimeBudgetMS,
+	TEXT("If > 0, the maximum time in milliseconds ServerReplicateActors will spend replicating actors to a single connection per frame. Actors that don't fit are aged and considered again next frame."),
+	ECVF_Default);
+
+float GNetStarvationPriorityAgingScale = 0.0f;
+static FAutoConsoleVariableRef CVarNetStarvationPriorityAgingScale(
+	TEXT("net.StarvationPriorityAgingScale"),
+	GNetStarvationPriorityAgingScale,
+	TEXT("Priority added per second to actors that keep being skipped on a connection because it is saturated or out of budget, so they eventually sort ahead of actors that replicate every frame."),
+	ECVF_Default);
+
+float GNetStarvationPriorityAgingMaxSeconds = 5.0f;
+static FAutoConsoleVariableRef CVarNetStarvationPriorityAgingMaxSeconds(
+	TEXT("net.StarvationPriorityAgingMaxSeconds"),
+	GNetStarvationPriorityAgingMaxSeconds,
+	TEXT("The maximum starvation time that net.StarvationPriorityAgingScale is applied to."),
+	ECVF_Default);
+
+/** Actors that haven't been skipped for this long are no longer considered starved. */
+static const double STARVATION_RESET_SECONDS = 1.0;
+
+int32 GNetRelevancyGrid = 0;
+static FAutoConsoleVariableRef CVarNetRelevancyGrid(
+	TEXT("net.RelevancyGrid"),
+	GNetRelevancyGrid,
+	TEXT("When enabled, considered actors whose relevancy is purely distance based are stored in a spatial grid, and each connection only\n")
+	TEXT("visits the cells around its viewers (plus actors it already has channels for) instead of calling IsNetRelevantFor on every actor.\n")
+	TEXT("Always relevant, owner relevant, attached actors and classes overriding IsNetRelevantFor still take the per actor path."),
+	ECVF_Default);
+
+float GNetRelevancyGridCellSize = 10000.f;
+static FAutoConsoleVariableRef CVarNetRelevancyGridCellSize(
+	TEXT("net.RelevancyGrid.CellSize"),
+	GNetRelevancyGridCellSize,
+	TEXT("Size of a net.RelevancyGrid cell in world units."),
+	ECVF_Default);
+
+static bool IsRelevancyGridEnabled()
+{
+	// Without distance based relevancy everything is relevant, so there's nothing to cull
+	return GNetRelevancyGrid != 0 && GetDefault<AGameNetworkManager>()->bUseDistanceBasedRelevancy;
+}
+
 static TAutoConsoleVariable<int32> CVarActorChannelPool(
 	TEXT("net.ActorChannelPool"),
 	1,
@@ -254,6 +374,7 @@ UNetDriver::UNetDriver(const FObjectInitializer& ObjectInitializer)
 ,   ServerConnection(nullptr)
 ,	ClientConnections()
 ,	MappedClientConnections()
+,	ClientConnectionsById()
 ,	RecentlyDisconnectedClients()
 ,	RecentlyDisconnectedTrackingTime(0)
 ,	ConnectionlessHandler()
@@ -301,6 +422,8 @@ UNetDriver::UNetDriver(const FObjectInitializer& ObjectInitializer)
 ,	ProcessQueuedBunchesCurrentFrameMilliseconds(0.0f)
 ,	DDoS()
 ,	LocalAddr(nullptr)
+,	LastDormancyWakeUpTime(0.0)
+,	bSendBatchActive(false)
 ,	NetworkObjects(new FNetworkObjectList)
 ,	LagState(ENetworkLagState::NotLagging)
 ,	DuplicateLevelID(INDEX_NONE)
@@ -498,7 +621,7 @@ FNetworkObjectInfo* UNetDriver::FindNetworkObjectInfo(const AActor* InActor)
 bool UNetDriver::IsNetworkActorUpdateFrequencyThrottled(const FNetworkObjectInfo& InNetworkActor) const
 {
 	bool bThrottled = false;
-	if (IsAdaptiveNetUpdateFrequencyEnabled())
+	if (IsAdaptiveNetUpdateFrequencyEnabled() || NetUpdateFrequencyScheduler)
 	{
 		// Must have been replicated once for this to happen (and for OptimalNetUpdateDelta to have been set)
 		const AActor* Actor = InNetworkActor.Actor;
@@ -518,7 +641,7 @@ bool UNetDriver::IsNetworkActorUpdateFrequencyThrottled(const FNetworkObjectInfo
 bool UNetDriver::IsNetworkActorUpdateFrequencyThrottled(const AActor* InActor) const
 {
 	bool bThrottled = false;
-	if (InActor && IsAdaptiveNetUpdateFrequencyEnabled())
+	if (InActor && (IsAdaptiveNetUpdateFrequencyEnabled() || NetUpdateFrequencyScheduler))
 	{
 		if (const FNetworkObjectInfo* NetActor = FindNetworkObjectInfo(InActor))
 		{
@@ -531,7 +654,7 @@ bool UNetDriver::IsNetworkActorUpdateFrequencyThrottled(const AActor* InActor) c
 
 void UNetDriver::CancelAdaptiveReplication(FNetworkObjectInfo& InNetworkActor)
 {
-	if (IsAdaptiveNetUpdateFrequencyEnabled())
+	if (IsAdaptiveNetUpdateFrequencyEnabled() || NetUpdateFrequencyScheduler)
 	{
 		if (AActor* Actor = InNetworkActor.Actor)
 		{
@@ -540,6 +663,7 @@ void UNetDriver::CancelAdaptiveReplication(FNetworkObjectInfo& InNetworkActor)
 				const float ExpectedNetDelay = (1.0f / Actor->NetUpdateFrequency);
 				Actor->SetNetUpdateTime( ActorWorld->GetTimeSeconds() + FMath::FRandRange( 0.5f, 1.0f ) * ExpectedNetDelay );
 				InNetworkActor.OptimalNetUpdateDelta = ExpectedNetDelay;
+				InNetworkActor.ObservedChangeRate = 1.0f;
 				// TODO: we really need a way to cancel the throttling completely. OptimalNetUpdateDelta is going to be recalculated based on LastNetReplicateTime.
 			}
 		}
@@ -575,6 +699,16 @@ void UNetDriver::TickFlush(float DeltaSeconds)
 	}
 	FSimpleScopeSecondsCounter ScopedTimer(GTickFlushGameDriverTimeSeconds, bEnableTimer);
 
+	static const int32 ReplicationTimer = FPerformanceTrackingTimers::RegisterTimer(TEXT("Replication"));
+	FScopedPerformanceTrackingTimer ReplicationTrackingTimer(NetDriverName == NAME_GameNetDriver ? ReplicationTimer : INDEX_NONE);
+
+	// Packets sent from here until every connection has ticked are submitted together, see net.BatchSends
+	if (GNetBatchSends && SupportsSendBatching())
+	{
+		bSendBatchActive = true;
+		BeginSendBatch();
+	}
+
 	if ( IsServer() && ClientConnections.Num() > 0 && ClientConnections[0]->IsInternalAck() == false )
 	{
 		// Update all clients.
@@ -591,6 +725,12 @@ void UNetDriver::TickFlush(float DeltaSeconds)
 #endif // WITH_SERVER_CODE
 	}
 
+	// Report replication cost gathered by net.RepLayoutCostTracking for this frame
+	if (FRepLayoutCostTracker::IsEnabled())
+	{
+		FRepLayoutCostTracker::EndFrame();
+	}
+
 	// Reset queued bunch amortization timer
 	ProcessQueuedBunchesCurrentFrameMilliseconds = 0.0f;
 
@@ -1012,6 +1152,13 @@ void UNetDriver::TickFlush(float DeltaSeconds)
 		FlushHandler();
 	}
 
+	if (bSendBatchActive)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_NetTickFlushSendBatch);
+		bSendBatchActive = false;
+		EndSendBatch();
+	}
+
 	if (CVarNetDebugDraw.GetValueOnAnyThread() > 0)
 	{
 		DrawNetDriverDebug();
@@ -1446,6 +1593,18 @@ bool UNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, const FU
 		InitReplicationDriverClass();
 		SetReplicationDriver(UReplicationDriver::CreateReplicationDriver(this, URL, GetWorld()));
 
+		if (!NetUpdateFrequencySchedulerClassName.IsEmpty())
+		{
+			if (UClass* SchedulerClass = LoadClass<UNetUpdateFrequencyScheduler>(nullptr, *NetUpdateFrequencySchedulerClassName, nullptr, LOAD_None, nullptr))
+			{
+				SetNetUpdateFrequencyScheduler(NewObject<UNetUpdateFrequencyScheduler>(this, SchedulerClass));
+			}
+			else
+			{
+				UE_LOG(LogNet, Error, TEXT("Failed to load class '%s'"), *NetUpdateFrequencySchedulerClassName);
+			}
+		}
+
 		DDoS.Init(FMath::Clamp(NetServerMaxTickRate, 1, 1000));
 
 		DDoS.NotifySeverityEscalation.BindLambda(
@@ -1660,6 +1819,7 @@ void UNetDriver::Shutdown()
 	ConnectionlessHandler.Reset(nullptr);
 
 	SetReplicationDriver(nullptr);
+	SetNetUpdateFrequencyScheduler(nullptr);
 
 	// End NetTrace session for this instance
 	UE_NET_TRACE_END_SESSION(GetNetTraceId());
@@ -1745,8 +1905,75 @@ struct FRPCCSVTracker
 
 // ----------------------------------------------------------------------------------------
 
+void UNetDriver::ReceiveRawPackets(TArrayView<const FReceivedRawPacket> Packets)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NetReceiveRawPackets);
+
+	if (!GNetDecodePacketsInParallel || !FApp::ShouldUseThreadingForPerformance())
+	{
+		for (const FReceivedRawPacket& Packet : Packets)
+		{
+			Packet.Connection->ReceivedRawPacket(Packet.Data, Packet.Count);
+		}
+		return;
+	}
+
+	// Group packets by connection, keeping receive order within each connection.
+	// Connections that can't be decoded off the game thread are handled immediately.
+	TArray<UNetConnection*, TInlineAllocator<64>> DecodeConnections;
+	TArray<TArray<int32, TInlineAllocator<4>>, TInlineAllocator<64>> DecodePacketIndices;
+	TMap<UNetConnection*, int32, TInlineSetAllocator<64>> ConnectionToDecodeIndex;
+
+	for (int32 PacketIndex = 0; PacketIndex < Packets.Num(); ++PacketIndex)
+	{
+		UNetConnection* Connection = Packets[PacketIndex].Connection;
+
+		int32* DecodeIndex = ConnectionToDecodeIndex.Find(Connection);
+		if (DecodeIndex == nullptr)
+		{
+			if (!Connection->CanDecodeRawPacketsAsync())
+			{
+				Connection->ReceivedRawPacket(Packets[PacketIndex].Data, Packets[PacketIndex].Count);
+				continue;
+			}
+
+			DecodeIndex = &ConnectionToDecodeIndex.Add(Connection, DecodeConnections.Add(Connection));
+			DecodePacketIndices.AddDefaulted();
+		}
+
+		DecodePacketIndices[*DecodeIndex].Add(PacketIndex);
+	}
+
+	if (DecodeConnections.Num() == 0)
+	{
+		return;
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_NetDecodeRawPacketsParallel);
+
+		const bool bForceSingleThread = DecodeConnections.Num() < GNetDecodePacketsInParallelMinConnections;
+		ParallelFor(DecodeConnections.Num(), [&](int32 DecodeIndex)
+		{
+			UNetConnection* Connection = DecodeConnections[DecodeIndex];
+			for (const int32 PacketIndex : DecodePacketIndices[DecodeIndex])
+			{
+				Connection->DecodeRawPacket_AnyThread(Packets[PacketIndex].Data, Packets[PacketIndex].Count);
+			}
+		}, bForceSingleThread);
+	}
+
+	for (UNetConnection* Connection : DecodeConnections)
+	{
+		Connection->ProcessDecodedRawPackets();
+	}
+}
+
 void UNetDriver::TickDispatch( float DeltaTime )
 {
+	static const int32 TickDispatchTimer = FPerformanceTrackingTimers::RegisterTimer(TEXT("TickDispatch"));
+	FScopedPerformanceTrackingTimer TickDispatchTrackingTimer(NetDriverName == NAME_GameNetDriver ? TickDispatchTimer : INDEX_NONE);
+
 	SendCycles=0;
 
 	const double CurrentRealtime = FPlatformTime::Seconds();
@@ -1846,6 +2073,16 @@ void UNetDriver::PostTickDispatch()
 		ReplicationDriver->PostTickDispatch();
 	}
 
+	// Call the RepNotifies coalesced during the dispatch. Popped one at a time, a RepNotify may destroy other replicators.
+	while (RepNotifyPendingReplicators.Num() > 0)
+	{
+		TSet<FObjectReplicator*>::TIterator It(RepNotifyPendingReplicators);
+		FObjectReplicator* Replicator = *It;
+		It.RemoveCurrent();
+
+		Replicator->CallRepNotifies(true);
+	}
+
 	if (GReceiveRPCTimingEnabled)
 	{
 		GRPCCSVTracker.EndTickDispatch();
@@ -2017,6 +2254,14 @@ void UNetDriver::ProcessRemoteFunctionForChannel(UActorChannel* Ch, const FClass
 		return;
 	}
 
+	// Unreliable RPCs that would otherwise be sent immediately can be batched with other RPCs on this channel.
+	// Anything else must go out after RPCs that were already batched, so flush them before writing this bunch.
+	const bool bBatchBunch = GNetBatchUnreliableRPCs && SendPolicy == ERemoteFunctionSendPolicy::Default && !Connection->IsInternalAck() && !(Function->FunctionFlags & (FUNC_NetReliable | FUNC_NetMulticast));
+	if (!bBatchBunch)
+	{
+		Ch->FlushBatchedRemoteFunctions();
+	}
+
 	// Form the RPC preamble.
 	FOutBunch Bunch( Ch, 0 );
 
@@ -2233,7 +2478,15 @@ void UNetDriver::ProcessRemoteFunctionForChannel(UActorChannel* Ch, const FClass
 				}
 
 				NETWORK_PROFILER(GNetworkProfiler.TrackSendRPC(Ch->Actor, Function, HeaderBits, ParameterBits, 0, Connection));
-				Ch->SendBunch( &Bunch, 1 );
+
+				if (bBatchBunch)
+				{
+					Ch->BatchRemoteFunctionBunch(Bunch);
+				}
+				else
+				{
+					Ch->SendBunch( &Bunch, 1 );
+				}
 			}
 		}
 	}
@@ -2417,6 +2670,7 @@ void UNetDriver::Serialize( FArchive& Ar )
 		// These are probably insignificant, though.
 
 		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("MappedClientConnection", MappedClientConnections.CountBytes(Ar));
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("ClientConnectionsById", ClientConnectionsById.CountBytes(Ar));
 		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("RecentlyDisconnectedClients", RecentlyDisconnectedClients.CountBytes(Ar));
 		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("GuidCache",
 			if (FNetGUIDCache const * const LocalGuidCache = GuidCache.Get())
@@ -3013,6 +3267,8 @@ void UNetDriver::NotifyActorDestroyed( AActor* ThisActor, bool IsSeamlessTravel
 
 			// Remove it from any dormancy lists
 			Connection->CleanupDormantReplicatorsForActor(ThisActor);
+
+			Connection->GetStarvedActors().Remove(ThisActor);
 		}
 	}
 
@@ -3240,6 +3496,42 @@ void UNetDriver::FlushActorDormancy(AActor* Actor, bool bWasDormInitial)
 	FlushActorDormancyInternal(Actor);
 }
 
+void UNetDriver::FlushDormancyForActors(TArrayView<AActor* const> Actors, bool bWasDormInitial)
+{
+	if (GSetNetDormancyEnabled == 0 || Actors.Num() == 0)
+		return;
+
+	check(ServerConnection == NULL);
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_NetDriver_FlushDormancyForActors);
+
+	if (ReplicationDriver)
+	{
+		for (AActor* Actor : Actors)
+		{
+			if (Actor)
+			{
+				ReplicationDriver->FlushNetDormancy(Actor, bWasDormInitial);
+			}
+		}
+	}
+
+	// Visit each connection once for the whole group, rather than once per actor
+	for (UNetConnection* NetConnection : ClientConnections)
+	{
+		if (NetConnection != NULL)
+		{
+			for (AActor* Actor : Actors)
+			{
+				if (Actor)
+				{
+					NetConnection->FlushDormancy(Actor);
+				}
+			}
+		}
+	}
+}
+
 void UNetDriver::NotifyActorDormancyChange(AActor* Actor, ENetDormancy OldDormancyState)
 {
 	if (ReplicationDriver)
@@ -3673,6 +3965,20 @@ FActorPriority::FActorPriority(UNetConnection* InConnection, UActorChannel* InCh
 	{
 		Priority = FMath::Max<int32>(Priority, FMath::RoundToInt(65536.0f * ActorInfo->Actor->GetNetPriority(Viewers[i].ViewLocation, Viewers[i].ViewDir, Viewers[i].InViewer, Viewers[i].ViewTarget, InChannel, Time, bLowBandwidth)));
 	}
+
+	// Age actors that keep getting skipped so they eventually sort ahead of actors that are sent every frame
+	if (GNetStarvationPriorityAgingScale > 0.0f)
+	{
+		if (const FActorReplicationStarvation* Starvation = InConnection->GetStarvedActors().Find(ActorInfo->WeakActor))
+		{
+			const double ElapsedTime = InConnection->Driver->GetElapsedTime();
+			if (ElapsedTime - Starvation->LastSkippedTime <= STARVATION_RESET_SECONDS)
+			{
+				const float StarvedSeconds = FMath::Min((float)(ElapsedTime - Starvation->StarvedSinceTime), GNetStarvationPriorityAgingMaxSeconds);
+				Priority += FMath::RoundToInt(65536.0f * GNetStarvationPriorityAgingScale * StarvedSeconds);
+			}
+		}
+	}
 }
 
 FActorPriority::FActorPriority(class UNetConnection* InConnection, struct FActorDestructionInfo * Info, const TArray<struct FNetViewer>& Viewers )
@@ -3819,6 +4125,22 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 
 	const bool bUseAdapativeNetFrequency = IsAdaptiveNetUpdateFrequencyEnabled();
 
+	if ( NetUpdateFrequencyScheduler )
+	{
+		NetUpdateFrequencyScheduler->BeginFrame( ClientConnections, ServerTickTime );
+	}
+
+	FNetworkRelevancyGrid& RelevancyGrid = GetNetworkObjectList().GetRelevancyGrid();
+	const bool bUseRelevancyGrid = IsRelevancyGridEnabled();
+	if ( bUseRelevancyGrid )
+	{
+		RelevancyGrid.BeginFrame( GNetRelevancyGridCellSize );
+	}
+	else
+	{
+		RelevancyGrid.Reset();
+	}
+
 	TArray<AActor*> ActorsToRemove;
 
 	for ( const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects() )
@@ -3897,7 +4219,7 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 
 		const float LastReplicateDelta = World->TimeSeconds - ActorInfo->LastNetReplicateTime;
 
-		if ( LastReplicateDelta > ScaleDownStartTime )
+		if ( LastReplicateDelta > ScaleDownStartTime && !NetUpdateFrequencyScheduler )
 		{
 			if ( Actor->MinNetUpdateFrequency == 0.0f )
 			{
@@ -3921,7 +4243,11 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 		{
 			UE_LOG( LogNetTraffic, Log, TEXT( "actor %s requesting new net update, time: %2.3f" ), *Actor->GetName(), World->TimeSeconds );
 
-			const float NextUpdateDelta = bUseAdapativeNetFrequency ? ActorInfo->OptimalNetUpdateDelta : 1.0f / Actor->NetUpdateFrequency;
+			float NextUpdateDelta = bUseAdapativeNetFrequency ? ActorInfo->OptimalNetUpdateDelta : 1.0f / Actor->NetUpdateFrequency;
+			if ( NetUpdateFrequencyScheduler )
+			{
+				NextUpdateDelta = NetUpdateFrequencyScheduler->GetNextUpdateDelta( *ActorInfo, World->TimeSeconds );
+			}
 
 			// then set the next update time
 			ActorInfo->NextUpdateTime = World->TimeSeconds + UpdateDelayRandomStream.FRand() * ServerTickTime + NextUpdateDelta;
@@ -3944,6 +4270,11 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 
 		// Call PreReplication on all actors that will be considered
 		Actor->CallPreReplication( this );
+
+		if ( bUseRelevancyGrid )
+		{
+			RelevancyGrid.AddConsideredObject( ActorInfo );
+		}
 	}
 
 	for ( AActor* Actor : ActorsToRemove )
@@ -3997,6 +4328,128 @@ static FORCEINLINE_DEBUGGABLE UNetConnection* IsActorOwnedByAndRelevantToConnect
 	return nullptr;
 }
 
+void UNetDriver::ServerReplicateActors_WakeDormantActorsNearViewers( const float DeltaSeconds )
+{
+	if ( GSetNetDormancyEnabled == 0 || GNetDormancyWakeUpDistance <= 0.0f )
+	{
+		return;
+	}
+
+	if ( ElapsedTime - LastDormancyWakeUpTime < GNetDormancyWakeUpInterval )
+	{
+		return;
+	}
+
+	LastDormancyWakeUpTime = ElapsedTime;
+
+	QUICK_SCOPE_CYCLE_COUNTER( STAT_NetDriver_WakeDormantActorsNearViewers );
+
+	const float WakeUpDistSq = FMath::Square( GNetDormancyWakeUpDistance );
+
+	// Only viewers that moved since the last check can have come into range of a dormant actor
+	struct FMovedViewer
+	{
+		TWeakObjectPtr<UNetConnection> Connection;
+		FVector PreviousLocation;
+		FVector Location;
+		bool bHasPreviousLocation;
+	};
+
+	TArray<FMovedViewer, TInlineAllocator<32>> MovedViewers;
+
+	for ( UNetConnection* Connection : ClientConnections )
+	{
+		if ( Connection == nullptr || Connection->State == USOCK_Closed || Connection->ViewTarget == nullptr || Connection->OwningActor == nullptr )
+		{
+			continue;
+		}
+
+		TArray<FVector, TInlineAllocator<1>> ViewLocations;
+		ViewLocations.Add( FNetViewer( Connection, DeltaSeconds ).ViewLocation );
+		for ( UNetConnection* Child : Connection->Children )
+		{
+			if ( Child && Child->ViewTarget && Child->OwningActor )
+			{
+				ViewLocations.Add( FNetViewer( Child, DeltaSeconds ).ViewLocation );
+			}
+		}
+
+		const TArray<FVector, TInlineAllocator<1>>& PreviousLocations = Connection->DormancyWakeUpViewLocations;
+		for ( int32 ViewerIndex = 0; ViewerIndex < ViewLocations.Num(); ++ViewerIndex )
+		{
+			const bool bHasPreviousLocation = PreviousLocations.IsValidIndex( ViewerIndex );
+			if ( bHasPreviousLocation && PreviousLocations[ViewerIndex].Equals( ViewLocations[ViewerIndex] ) )
+			{
+				continue;
+			}
+
+			MovedViewers.Add( { Connection, bHasPreviousLocation ? PreviousLocations[ViewerIndex] : FVector::ZeroVector, ViewLocations[ViewerIndex], bHasPreviousLocation } );
+		}
+
+		Connection->DormancyWakeUpViewLocations = MoveTemp( ViewLocations );
+	}
+
+	if ( MovedViewers.Num() == 0 )
+	{
+		return;
+	}
+
+	// Gather first, flushing moves actors between the object list's sets
+	TArray<TPair<UNetConnection*, AActor*>> ActorsToWake;
+
+	for ( const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetAllObjects() )
+	{
+		FNetworkObjectInfo* ActorInfo = ObjectInfo.Get();
+		if ( ActorInfo->DormantConnections.Num() == 0 )
+		{
+			continue;
+		}
+
+		AActor* Actor = ActorInfo->Actor;
+		if ( !IsValid( Actor ) || Actor->IsPendingKillPending() )
+		{
+			continue;
+		}
+
+		const FVector ActorLocation = Actor->GetActorLocation();
+		const int32 FirstPairForActor = ActorsToWake.Num();
+
+		for ( const FMovedViewer& Viewer : MovedViewers )
+		{
+			if ( FVector::DistSquared( ActorLocation, Viewer.Location ) > WakeUpDistSq )
+			{
+				continue;
+			}
+
+			// Viewers that were already in range woke the actor when they first approached it
+			if ( Viewer.bHasPreviousLocation && FVector::DistSquared( ActorLocation, Viewer.PreviousLocation ) <= WakeUpDistSq )
+			{
+				continue;
+			}
+
+			UNetConnection* ViewerConnection = Viewer.Connection.Get();
+
+			// Children share their parent's connection, only wake the actor once per connection
+			bool bAlreadyWaking = false;
+			for ( int32 PairIndex = FirstPairForActor; PairIndex < ActorsToWake.Num(); ++PairIndex )
+			{
+				bAlreadyWaking |= ( ActorsToWake[PairIndex].Key == ViewerConnection );
+			}
+
+			if ( !bAlreadyWaking && ActorInfo->DormantConnections.Contains( Viewer.Connection ) )
+			{
+				ActorsToWake.Emplace( ViewerConnection, Actor );
+			}
+		}
+	}
+
+	for ( const TPair<UNetConnection*, AActor*>& ConnectionActorPair : ActorsToWake )
+	{
+		UE_LOG( LogNetDormancy, Verbose, TEXT( "WakeDormantActorsNearViewers: %s. Connection: %s" ), *ConnectionActorPair.Value->GetName(), *ConnectionActorPair.Key->GetName() );
+		ConnectionActorPair.Key->FlushDormancy( ConnectionActorPair.Value );
+	}
+}
+
 // Returns true if this actor is considered dormant (and all properties caught up) to the current connection
 static FORCEINLINE_DEBUGGABLE bool IsActorDormant( FNetworkObjectInfo* ActorInfo, const TWeakObjectPtr<UNetConnection>& Connection )
 {
@@ -4027,7 +4480,70 @@ static FORCEINLINE_DEBUGGABLE bool ShouldActorGoDormant( AActor* Actor, const TA
 	return true;
 }
 
-int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors )
+// Builds the part of the consider list a connection has to visit when the relevancy grid is in use:
+// slow path actors, grid actors near any of the viewers, and grid actors the connection already has a channel for.
+// Safe to call from multiple threads, as long as the object list and channel maps aren't being modified.
+static void BuildRelevancyGridConsiderList( const FNetworkObjectList& NetworkObjectList, UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, TArray<FNetworkObjectInfo*>& OutConsiderList )
+{
+	const FNetworkRelevancyGrid& RelevancyGrid = NetworkObjectList.GetRelevancyGrid();
+	const FNetworkObjectList::FNetworkObjectSet& AllObjects = NetworkObjectList.GetAllObjects();
+
+	auto AddIfConsideredInGrid = [&RelevancyGrid, &AllObjects, &OutConsiderList]( const AActor* Actor )
+	{
+		// Avoid copying the shared pointer, its reference count isn't thread safe
+		if ( const TSharedPtr<FNetworkObjectInfo>* InfoPtr = Actor ? AllObjects.Find( const_cast<AActor*>( Actor ) ) : nullptr )
+		{
+			if ( RelevancyGrid.IsConsideredInGrid( InfoPtr->Get() ) )
+			{
+				OutConsiderList.Add( InfoPtr->Get() );
+			}
+		}
+	};
+
+	OutConsiderList.Reset();
+	OutConsiderList.Append( RelevancyGrid.GetSlowPathObjects() );
+
+	const int32 FirstGridIndex = OutConsiderList.Num();
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for ( const FNetViewer& Viewer : ConnectionViewers )
+	{
+		ViewLocations.Add( Viewer.ViewLocation );
+
+		// Viewers are relevant to themselves no matter where the camera is
+		AddIfConsideredInGrid( Viewer.InViewer );
+		AddIfConsideredInGrid( Viewer.ViewTarget );
+	}
+
+	RelevancyGrid.GatherObjectsNear( ViewLocations, OutConsiderList );
+
+	// Actors with an open channel need to be visited wherever they are, so they can keep replicating or time out
+	for ( FActorChannelMap::TConstIterator It = Connection->ActorChannelConstIterator(); It; ++It )
+	{
+		AddIfConsideredInGrid( It.Key().Get() );
+	}
+
+	// Nearby cells for different viewers and channels can overlap
+	const int32 NumGridObjects = OutConsiderList.Num() - FirstGridIndex;
+	if ( NumGridObjects > 1 )
+	{
+		TArrayView<FNetworkObjectInfo*> GridObjects( OutConsiderList.GetData() + FirstGridIndex, NumGridObjects );
+		Algo::Sort( GridObjects, []( const FNetworkObjectInfo* A, const FNetworkObjectInfo* B ) { return A < B; } );
+
+		int32 NumUnique = 1;
+		for ( int32 Index = 1; Index < NumGridObjects; ++Index )
+		{
+			if ( GridObjects[Index] != GridObjects[NumUnique - 1] )
+			{
+				GridObjects[NumUnique++] = GridObjects[Index];
+			}
+		}
+
+		OutConsiderList.SetNum( FirstGridIndex + NumUnique, false );
+	}
+}
+
+int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*>& FullConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors )
 {
 	SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
 
@@ -4050,6 +4566,14 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 	// Make weak ptr once for IsActorDormant call
 	TWeakObjectPtr<UNetConnection> WeakConnection(Connection);
 
+	// With the relevancy grid, only visit the actors that can possibly be relevant to this connection
+	TArray<FNetworkObjectInfo*> GridConsiderList;
+	if ( IsRelevancyGridEnabled() )
+	{
+		BuildRelevancyGridConsiderList( GetNetworkObjectList(), Connection, ConnectionViewers, GridConsiderList );
+	}
+	const TArray<FNetworkObjectInfo*>& ConsiderList = IsRelevancyGridEnabled() ? GridConsiderList : FullConsiderList;
+
 	const int32 MaxSortedActors = ConsiderList.Num() + DestroyedStartupOrDormantActors.Num();
 	if ( MaxSortedActors > 0 )
 	{
@@ -4168,6 +4692,163 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 	return FinalSortedCount;
 }
 
+void UNetDriver::ServerReplicateActors_PrioritizeActorsForConnection( const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bLowNetBandwidth, FConnectionPrioritizeResult& OutResult )
+{
+	UNetConnection* Connection = OutResult.Connection;
+	const TArray<FNetViewer>& ConnectionViewers = OutResult.ConnectionViewers;
+
+	// NetTag is shared by all connections, so it can't be used to skip sent temporaries when running wide
+	TSet<const AActor*> SentTemporaries;
+	SentTemporaries.Reserve( Connection->SentTemporaries.Num() );
+	for ( const AActor* SentTemporary : Connection->SentTemporaries )
+	{
+		SentTemporaries.Add( SentTemporary );
+	}
+
+	const TWeakObjectPtr<UNetConnection> WeakConnection( Connection );
+
+	TArray<FNetworkObjectInfo*> GridConsiderList;
+	if ( IsRelevancyGridEnabled() )
+	{
+		BuildRelevancyGridConsiderList( GetNetworkObjectList(), Connection, ConnectionViewers, GridConsiderList );
+	}
+	const TArray<FNetworkObjectInfo*>& ConnectionConsiderList = IsRelevancyGridEnabled() ? GridConsiderList : ConsiderList;
+
+	const int32 MaxSortedActors = ConnectionConsiderList.Num() + DestroyedStartupOrDormantActors.Num();
+	OutResult.PriorityList.Reserve( MaxSortedActors );
+
+	for ( FNetworkObjectInfo* ActorInfo : ConnectionConsiderList )
+	{
+		AActor* Actor = ActorInfo->Actor;
+
+		UActorChannel* Channel = Connection->FindActorChannelRef( ActorInfo->WeakActor );
+
+		// Same relevancy rules as ServerReplicateActors_PrioritizeActors
+		if ( !Channel )
+		{
+			if ( !IsLevelInitializedForActor( Actor, Connection ) || !IsActorRelevantToConnection( Actor, ConnectionViewers ) )
+			{
+				continue;
+			}
+		}
+
+		UNetConnection* PriorityConnection = Connection;
+
+		if ( Actor->bOnlyRelevantToOwner )
+		{
+			bool bHasNullViewTarget = false;
+
+			PriorityConnection = IsActorOwnedByAndRelevantToConnection( Actor, ConnectionViewers, bHasNullViewTarget );
+
+			if ( PriorityConnection == nullptr )
+			{
+				if ( !bHasNullViewTarget && Channel != nullptr && ElapsedTime - Channel->RelevantTime >= RelevantTimeout )
+				{
+					OutResult.ChannelsToClose.Add( Channel );
+				}
+
+				continue;
+			}
+		}
+		else if ( GSetNetDormancyEnabled != 0 )
+		{
+			if ( IsActorDormant( ActorInfo, WeakConnection ) )
+			{
+				continue;
+			}
+
+			if ( ShouldActorGoDormant( Actor, ConnectionViewers, Channel, ElapsedTime, bLowNetBandwidth ) )
+			{
+				OutResult.ChannelsToStartDormant.Add( Channel );
+			}
+		}
+
+		if ( SentTemporaries.Contains( Actor ) )
+		{
+			continue;
+		}
+
+		OutResult.PriorityList.Emplace( PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth );
+	}
+
+	for ( auto It = Connection->GetDestroyedStartupOrDormantActorGUIDs().CreateConstIterator(); It; ++It )
+	{
+		FActorDestructionInfo& DInfo = *DestroyedStartupOrDormantActors.FindChecked( *It );
+		OutResult.PriorityList.Emplace( Connection, &DInfo, ConnectionViewers );
+		OutResult.DeletedCount++;
+	}
+
+	// Pointers are only taken once the list is done growing
+	OutResult.PriorityActors.Reserve( OutResult.PriorityList.Num() );
+	for ( FActorPriority& Priority : OutResult.PriorityList )
+	{
+		OutResult.PriorityActors.Add( &Priority );
+	}
+
+	Sort( OutResult.PriorityActors.GetData(), OutResult.PriorityActors.Num(), FCompareFActorPriority() );
+}
+
+void UNetDriver::ServerReplicateActors_PrioritizeConnectionsParallel( const TArray<FNetworkObjectInfo*>& ConsiderList, const int32 NumClientsToTick, const float DeltaSeconds, TArray<FConnectionPrioritizeResult>& OutResults )
+{
+	SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
+
+	check( IsInGameThread() );
+
+	const int32 NumConnections = FMath::Min( NumClientsToTick, ClientConnections.Num() );
+	OutResults.SetNum( NumConnections );
+
+	// Viewers call into gameplay code (GetPlayerViewPoint), so they are gathered up front on the game thread
+	for ( int32 i = 0; i < NumConnections; i++ )
+	{
+		UNetConnection* Connection = ClientConnections[i];
+		FConnectionPrioritizeResult& Result = OutResults[i];
+
+		if ( Connection->ViewTarget == nullptr )
+		{
+			continue;
+		}
+
+		check( World == Connection->OwningActor->GetWorld() );
+		check( World == Connection->ViewTarget->GetWorld() );
+
+		Result.Connection = Connection;
+		new( Result.ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
+		for ( UNetConnection* Child : Connection->Children )
+		{
+			if ( Child->ViewTarget != nullptr )
+			{
+				new( Result.ConnectionViewers )FNetViewer( Child, DeltaSeconds );
+			}
+		}
+	}
+
+	AGameNetworkManager* const NetworkManager = World->NetworkManager;
+	const bool bLowNetBandwidth = NetworkManager ? NetworkManager->IsInLowBandwidthMode() : false;
+
+	ParallelFor( NumConnections, [this, &ConsiderList, bLowNetBandwidth, &OutResults]( int32 Index )
+	{
+		FConnectionPrioritizeResult& Result = OutResults[Index];
+		if ( Result.Connection )
+		{
+			ServerReplicateActors_PrioritizeActorsForConnection( ConsiderList, bLowNetBandwidth, Result );
+		}
+	});
+
+	// Apply the channel changes the workers deferred
+	for ( FConnectionPrioritizeResult& Result : OutResults )
+	{
+		for ( UActorChannel* Channel : Result.ChannelsToClose )
+		{
+			Channel->Close( EChannelCloseReason::Relevancy );
+		}
+
+		for ( UActorChannel* Channel : Result.ChannelsToStartDormant )
+		{
+			Channel->StartBecomingDormant();
+		}
+	}
+}
+
 int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated )
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetProcessPrioritizedActorsTime);
@@ -4183,8 +4864,28 @@ int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection
 		return 0;
 	}
 
+	// Optional per connection budgets, measured from queued bytes (flushed + pending in the send buffer) and wall time
+	const bool bHasByteBudget = GNetConnectionReplicationByteBudget > 0;
+	const bool bHasTimeBudget = GNetConnectionReplicationTimeBudgetMS > 0.0f;
+	const int64 StartBits = (int64)Connection->OutTotalBytes * 8 + Connection->SendBuffer.GetNumBits();
+	const double StartTime = bHasTimeBudget ? FPlatformTime::Seconds() : 0.0;
+
 	for ( int32 j = 0; j < FinalSortedCount; j++ )
 	{
+		if ( ( bHasByteBudget || bHasTimeBudget ) && j > 0 )
+		{
+			const int64 SentBits = (int64)Connection->OutTotalBytes * 8 + Connection->SendBuffer.GetNumBits() - StartBits;
+			const bool bOverByteBudget = bHasByteBudget && SentBits >= (int64)GNetConnectionReplicationByteBudget * 8;
+			const bool bOverTimeBudget = bHasTimeBudget && ( FPlatformTime::Seconds() - StartTime ) * 1000.0 >= GNetConnectionReplicationTimeBudgetMS;
+
+			if ( bOverByteBudget || bOverTimeBudget )
+			{
+				UE_LOG( LogNetTraffic, Log, TEXT( "ServerReplicateActors_ProcessPrioritizedActors: %s replication budget used after %d of %d actors" ), bOverByteBudget ? TEXT( "Byte" ) : TEXT( "CPU" ), j, FinalSortedCount );
+				Connection->TrackBudgetLimitedReplicationForAnalytics();
+				return j;
+			}
+		}
+
 		FNetworkObjectInfo*	ActorInfo = PriorityActors[j]->ActorInfo;
 
 		// Deletion entry
@@ -4335,6 +5036,13 @@ int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection
 							// Choose an optimal time, we choose 70% of the actual rate to allow frequency to go up if needed
 							ActorInfo->OptimalNetUpdateDelta = FMath::Clamp( DeltaBetweenReplications * 0.7f, MinOptimalDelta, MaxOptimalDelta );
 							ActorInfo->LastNetReplicateTime = World->TimeSeconds;
+
+							if ( NetUpdateFrequencyScheduler )
+							{
+								NetUpdateFrequencyScheduler->NotifyActorReplicated( *ActorInfo, Connection );
+							}
+
+							Connection->NotifyStarvedActorReplicated( Actor, ElapsedTime );
 						}
 						ActorUpdatesThisConnection++;
 						OutUpdated++;
@@ -4373,6 +5081,54 @@ int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection
 
 	return FinalSortedCount;
 }
+
+void UNetDriver::ServerReplicateActors_MarkUnprocessedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FirstUnprocessedActor, const int32 FinalSortedCount )
+{
+	// relevant actors that could not be processed this frame are marked to be considered for next frame
+	for ( int32 k=FirstUnprocessedActor; k<FinalSortedCount; k++ )
+	{
+		if (!PriorityActors[k]->ActorInfo)
+		{
+			// A deletion entry, skip it because we dont have anywhere to store a 'better give higher priority next time'
+			continue;
+		}
+
+		AActor* Actor = PriorityActors[k]->ActorInfo->Actor;
+
+		UActorChannel* Channel = PriorityActors[k]->Channel;
+		
+		UE_LOG(LogNetTraffic, Verbose, TEXT("Saturated. %s"), *Actor->GetName());
+
+		// Remember how long this actor has been skipped so it can be aged in FActorPriority and tracked for analytics
+		FActorReplicationStarvation& Starvation = Connection->GetStarvedActors().FindOrAdd(PriorityActors[k]->ActorInfo->WeakActor);
+		if (Starvation.StarvedSinceTime == 0.0 || ElapsedTime - Starvation.LastSkippedTime > STARVATION_RESET_SECONDS)
+		{
+			Starvation.StarvedSinceTime = ElapsedTime;
+		}
+		Starvation.LastSkippedTime = ElapsedTime;
+		if (Channel != NULL && ElapsedTime - Channel->RelevantTime <= 1.0)
+		{
+			UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
+			PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
+		}
+		else if ( IsActorRelevantToConnection( Actor, ConnectionViewers ) )
+		{
+			// If this actor was relevant but didn't get processed, force another update for next frame
+			UE_LOG( LogNetTraffic, Log, TEXT( " Saturated. Mark %s NetUpdateTime to be checked for next tick" ), *Actor->GetName() );
+			PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
+			if ( Channel != NULL )
+			{
+				Channel->RelevantTime = ElapsedTime + 0.5 * UpdateDelayRandomStream.FRand();
+			}
+		}
+
+		// If the actor was forced to relevant and didn't get processed, try again on the next update;
+		if (PriorityActors[k]->ActorInfo->ForceRelevantFrame >= Connection->LastProcessedFrame)
+		{
+			PriorityActors[k]->ActorInfo->ForceRelevantFrame = ReplicationFrame+1;
+		}
+	}
+}
 #endif
 
 // -------------------------------------------------------------------------------------------------------------------------
@@ -4526,6 +5282,9 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 	SCOPE_CYCLE_COUNTER(STAT_NetServerRepActorsTime);
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(ServerReplicateActors);
 
+	static const int32 ServerReplicateActorsTimer = FPerformanceTrackingTimers::RegisterTimer(TEXT("ServerReplicateActors"));
+	FScopedPerformanceTrackingTimer ServerReplicateActorsTrackingTimer(NetDriverName == NAME_GameNetDriver ? ServerReplicateActorsTimer : INDEX_NONE);
+
 #if WITH_SERVER_CODE
 	if ( ClientConnections.Num() == 0 )
 	{
@@ -4574,6 +5333,9 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 		bCPUSaturated	= DeltaSeconds > 1.2f * ServerTickTime;
 	}
 
+	// Wake dormant actors that viewers moved close to, so they're picked up by the consider list below
+	ServerReplicateActors_WakeDormantActorsNearViewers( DeltaSeconds );
+
 	TArray<FNetworkObjectInfo*> ConsiderList;
 	ConsiderList.Reserve( GetNetworkObjectList().GetActiveObjects().Num() );
 
@@ -4582,6 +5344,14 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 	FMemMark Mark( FMemStack::Get() );
 
+	// Optionally build every ticked connection's prioritized list up front on the task graph
+	TArray<FConnectionPrioritizeResult> ParallelPrioritizeResults;
+	const bool bParallelPrioritize = GNetParallelPrioritizeConnections != 0 && !DebugRelevantActors && NumClientsToTick >= FMath::Max( GNetParallelPrioritizeMinConnections, 2 );
+	if ( bParallelPrioritize )
+	{
+		ServerReplicateActors_PrioritizeConnectionsParallel( ConsiderList, NumClientsToTick, DeltaSeconds, ParallelPrioritizeResults );
+	}
+
 	for ( int32 i=0; i < ClientConnections.Num(); i++ )
 	{
 		UNetConnection* Connection = ClientConnections[i];
@@ -4631,16 +5401,26 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 			const int32 LocalNumSaturated = GNumSaturatedConnections;
 
+			FConnectionPrioritizeResult* ParallelResult = bParallelPrioritize ? &ParallelPrioritizeResults[i] : nullptr;
+			check( !ParallelResult || ParallelResult->Connection == Connection );
+
 			// Make a list of viewers this connection should consider (this connection and children of this connection)
 			TArray<FNetViewer>& ConnectionViewers = WorldSettings->ReplicationViewers;
 
 			ConnectionViewers.Reset();
-			new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
-			for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+			if ( ParallelResult )
+			{
+				ConnectionViewers = ParallelResult->ConnectionViewers;
+			}
+			else
 			{
-				if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+				new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
+				for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
 				{
-					new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+					{
+						new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					}
 				}
 			}
 
@@ -4664,48 +5444,26 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 			FActorPriority* PriorityList	= NULL;
 			FActorPriority** PriorityActors = NULL;
 
-			// Get a sorted list of actors for this connection
-			const int32 FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
-
-			// Process the sorted list of actors for this connection
-			const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, ConnectionViewers, PriorityActors, FinalSortedCount, Updated );
-
-			// relevant actors that could not be processed this frame are marked to be considered for next frame
-			for ( int32 k=LastProcessedActor; k<FinalSortedCount; k++ )
+			int32 FinalSortedCount = 0;
+			if ( ParallelResult )
 			{
-				if (!PriorityActors[k]->ActorInfo)
-				{
-					// A deletion entry, skip it because we dont have anywhere to store a 'better give higher priority next time'
-					continue;
-				}
+				// Already gathered and sorted by ServerReplicateActors_PrioritizeConnectionsParallel
+				PriorityActors = ParallelResult->PriorityActors.GetData();
+				FinalSortedCount = ParallelResult->PriorityActors.Num();
 
-				AActor* Actor = PriorityActors[k]->ActorInfo->Actor;
+				SET_DWORD_STAT( STAT_PrioritizedActors, FinalSortedCount );
+				SET_DWORD_STAT( STAT_NumRelevantDeletedActors, ParallelResult->DeletedCount );
+			}
+			else
+			{
+				// Get a sorted list of actors for this connection
+				FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
+			}
 
-				UActorChannel* Channel = PriorityActors[k]->Channel;
-				
-				UE_LOG(LogNetTraffic, Verbose, TEXT("Saturated. %s"), *Actor->GetName());
-				if (Channel != NULL && ElapsedTime - Channel->RelevantTime <= 1.0)
-				{
-					UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
-					PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
-				}
-				else if ( IsActorRelevantToConnection( Actor, ConnectionViewers ) )
-				{
-					// If this actor was relevant but didn't get processed, force another update for next frame
-					UE_LOG( LogNetTraffic, Log, TEXT( " Saturated. Mark %s NetUpdateTime to be checked for next tick" ), *Actor->GetName() );
-					PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
-					if ( Channel != NULL )
-					{
-						Channel->RelevantTime = ElapsedTime + 0.5 * UpdateDelayRandomStream.FRand();
-					}
-					}
+			// Process the sorted list of actors for this connection
+			const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, ConnectionViewers, PriorityActors, FinalSortedCount, Updated );
 
-				// If the actor was forced to relevant and didn't get processed, try again on the next update;
-				if (PriorityActors[k]->ActorInfo->ForceRelevantFrame >= Connection->LastProcessedFrame)
-				{
-					PriorityActors[k]->ActorInfo->ForceRelevantFrame = ReplicationFrame+1;
-				}
-			}
+			ServerReplicateActors_MarkUnprocessedActors( Connection, ConnectionViewers, PriorityActors, LastProcessedActor, FinalSortedCount );
 			RelevantActorMark.Pop();
 
 			ConnectionViewers.Reset();
@@ -5002,6 +5760,16 @@ void UNetDriver::AddClientConnection(UNetConnection * NewConnection)
 
 	ClientConnections.Add(NewConnection);
 
+	if (const uint32 ConnectionId = NewConnection->GetConnectionId())
+	{
+		if (ConnectionId >= (uint32)ClientConnectionsById.Num())
+		{
+			ClientConnectionsById.SetNumZeroed(ConnectionId + 1);
+		}
+
+		ClientConnectionsById[ConnectionId] = NewConnection;
+	}
+
 	TSharedPtr<const FInternetAddr> ConnAddr = NewConnection->GetRemoteAddr();
 
 	if (ConnAddr.IsValid())
@@ -5124,6 +5892,12 @@ void UNetDriver::RemoveClientConnection(UNetConnection* ClientConnectionToRemove
 {
 	verify(ClientConnections.Remove(ClientConnectionToRemove) == 1);
 
+	const uint32 RemovedConnectionId = ClientConnectionToRemove->GetConnectionId();
+	if (RemovedConnectionId < (uint32)ClientConnectionsById.Num() && ClientConnectionsById[RemovedConnectionId] == ClientConnectionToRemove)
+	{
+		ClientConnectionsById[RemovedConnectionId] = nullptr;
+	}
+
 	TSharedPtr<const FInternetAddr> AddrToRemove = ClientConnectionToRemove->GetRemoteAddr();
 
 	if (AddrToRemove.IsValid())
@@ -5308,6 +6082,15 @@ void UNetDriver::SetReplicationDriver(UReplicationDriver* NewReplicationDriver)
 	}
 }
 
+void UNetDriver::SetNetUpdateFrequencyScheduler(UNetUpdateFrequencyScheduler* NewScheduler)
+{
+	NetUpdateFrequencyScheduler = NewScheduler;
+	if (NetUpdateFrequencyScheduler)
+	{
+		NetUpdateFrequencyScheduler->InitForNetDriver(this);
+	}
+}
+
 UNetConnection* UNetDriver::GetConnectionById(uint32 ConnectionId) const
 {
 	if (ServerConnection != nullptr && ServerConnection->GetConnectionId() == ConnectionId)
@@ -5315,15 +6098,10 @@ UNetConnection* UNetDriver::GetConnectionById(uint32 ConnectionId) const
 		return ServerConnection;
 	}
 
-	for (UNetConnection* Connection : ClientConnections)
-	{
-		if (Connection && Connection->GetConnectionId() == ConnectionId)
-		{
-			return Connection;
-		}
-	}
+	// Ids are reused once freed, so make sure the connection still has the one it was added with
+	UNetConnection* Connection = (ConnectionId != 0 && ConnectionId < (uint32)ClientConnectionsById.Num()) ? ClientConnectionsById[ConnectionId] : nullptr;
 
-	return nullptr;
+	return (Connection && Connection->GetConnectionId() == ConnectionId) ? Connection : nullptr;
 }
 
 static void	DumpRelevantActors( UWorld* InWorld )
@@ -5,6 +5,17 @@
 #include "Engine/Level.h"
 #include "EngineUtils.h"
 #include "Serialization/Archive.h"
+#include "HAL/IConsoleManager.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+static TAutoConsoleVariable<FString> CVarNetRelevancyGridDistanceOnlyClasses(
+	TEXT("net.RelevancyGrid.DistanceOnlyClasses"),
+	TEXT(""),
+	TEXT("Comma separated list of native actor class names outside the Engine module whose IsNetRelevantFor doesn't add anything beyond AActor's distance based relevancy.\n")
+	TEXT("Actors of these classes (and their Blueprint children) can be culled by net.RelevancyGrid."),
+	ECVF_Default);
 
 void FNetworkObjectList::AddInitialObjects(UWorld* const World, const FName NetDriverName)
 {
@@ -134,6 +145,8 @@ void FNetworkObjectList::Remove(AActor* const Actor)
 		NumDormantObjectsPerConnectionRef--;
 	}
 
+	RelevancyGrid.Remove(NetworkObjectInfo);
+
 	// Remove this object from all lists
 	AllNetworkObjects.Remove(Actor);
 	ActiveNetworkObjects.Remove(Actor);
@@ -334,6 +347,7 @@ void FNetworkObjectList::ForceActorRelevantNextUpdate(AActor* const Actor, UNetD
 void FNetworkObjectList::Reset()
 {
 	// Reset all state
+	RelevancyGrid.Reset();
 	AllNetworkObjects.Empty();
 	ActiveNetworkObjects.Empty();
 	ObjectsDormantOnAllConnections.Empty();
@@ -357,6 +371,7 @@ void FNetworkObjectList::CountBytes(FArchive& Ar) const
 	ActiveNetworkObjects.CountBytes(Ar);
 	ObjectsDormantOnAllConnections.CountBytes(Ar);
 	NumDormantObjectsPerConnection.CountBytes(Ar);
+	RelevancyGrid.CountBytes(Ar);
  
 	// ObjectsDormantOnAllConnections and ActiveNetworkObjects are both sub sets of AllNetworkObjects
 	// and only have pointers back to the data there.
@@ -369,4 +384,190 @@ void FNetworkObjectList::CountBytes(FArchive& Ar) const
 			Info->CountBytes(Ar);
 		}
 	}
-}
\ No newline at end of file
+}
+
+void FNetworkRelevancyGrid::BeginFrame(const float InCellSize)
+{
+	const float NewCellSize = FMath::Max(InCellSize, 100.f);
+	if (NewCellSize != CellSize)
+	{
+		// Every cell coordinate is stale, start over
+		Reset();
+		CellSize = NewCellSize;
+	}
+
+	const FString NewDistanceOnlyClasses = CVarNetRelevancyGridDistanceOnlyClasses.GetValueOnGameThread();
+	if (NewDistanceOnlyClasses != DistanceOnlyClassesString)
+	{
+		DistanceOnlyClassesString = NewDistanceOnlyClasses;
+		DistanceOnlyClassNames.Reset();
+		DefaultRelevancyClassCache.Reset();
+
+		TArray<FString> ClassNames;
+		DistanceOnlyClassesString.ParseIntoArray(ClassNames, TEXT(","), true);
+		for (const FString& ClassName : ClassNames)
+		{
+			DistanceOnlyClassNames.Add(FName(*ClassName.TrimStartAndEnd()));
+		}
+	}
+
+	SlowPathObjects.Reset();
+	MaxCullDistance = 0.f;
+	Frame++;
+}
+
+bool FNetworkRelevancyGrid::AddConsideredObject(FNetworkObjectInfo* ObjectInfo)
+{
+	const AActor* Actor = ObjectInfo->Actor;
+
+	if (!CanCullByDistance(Actor))
+	{
+		Remove(ObjectInfo);
+		SlowPathObjects.Add(ObjectInfo);
+		return false;
+	}
+
+	const FIntPoint NewCell = GetCell(Actor->GetActorLocation());
+
+	if (!ObjectInfo->bInRelevancyGrid || ObjectInfo->RelevancyGridCell != NewCell)
+	{
+		Remove(ObjectInfo);
+
+		Cells.FindOrAdd(NewCell).Add(ObjectInfo);
+		ObjectInfo->RelevancyGridCell = NewCell;
+		ObjectInfo->bInRelevancyGrid = true;
+	}
+
+	ObjectInfo->RelevancyGridFrame = Frame;
+	MaxCullDistance = FMath::Max(MaxCullDistance, FMath::Sqrt(Actor->NetCullDistanceSquared));
+
+	return true;
+}
+
+void FNetworkRelevancyGrid::Remove(FNetworkObjectInfo* ObjectInfo)
+{
+	if (!ObjectInfo->bInRelevancyGrid)
+	{
+		return;
+	}
+
+	if (TArray<FNetworkObjectInfo*>* Cell = Cells.Find(ObjectInfo->RelevancyGridCell))
+	{
+		Cell->RemoveSingleSwap(ObjectInfo, false);
+		if (Cell->Num() == 0)
+		{
+			Cells.Remove(ObjectInfo->RelevancyGridCell);
+		}
+	}
+
+	ObjectInfo->bInRelevancyGrid = false;
+}
+
+void FNetworkRelevancyGrid::GatherObjectsNear(TArrayView<const FVector> Locations, TArray<FNetworkObjectInfo*>& OutObjects) const
+{
+	if (Cells.Num() == 0 || MaxCullDistance <= 0.f)
+	{
+		return;
+	}
+
+	for (const FVector& Location : Locations)
+	{
+		const FIntPoint MinCell = GetCell(Location - FVector(MaxCullDistance, MaxCullDistance, 0.f));
+		const FIntPoint MaxCell = GetCell(Location + FVector(MaxCullDistance, MaxCullDistance, 0.f));
+
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+			{
+				if (const TArray<FNetworkObjectInfo*>* Cell = Cells.Find(FIntPoint(CellX, CellY)))
+				{
+					for (FNetworkObjectInfo* ObjectInfo : *Cell)
+					{
+						if (ObjectInfo->RelevancyGridFrame == Frame)
+						{
+							OutObjects.Add(ObjectInfo);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+bool FNetworkRelevancyGrid::CanCullByDistance(const AActor* Actor) const
+{
+	// These all make AActor::IsNetRelevantFor true (or dependent on another actor) regardless of distance
+	if (Actor->bAlwaysRelevant || Actor->bOnlyRelevantToOwner || Actor->bNetUseOwnerRelevancy || Actor->GetOwner() || Actor->GetInstigator())
+	{
+		return false;
+	}
+
+	const USceneComponent* RootComponent = Actor->GetRootComponent();
+	if (RootComponent == nullptr || RootComponent->GetAttachParent() != nullptr)
+	{
+		return false;
+	}
+
+	return UsesDefaultNetRelevancy(Actor->GetClass());
+}
+
+bool FNetworkRelevancyGrid::UsesDefaultNetRelevancy(const UClass* InClass) const
+{
+	if (const bool* bCachedResult = DefaultRelevancyClassCache.Find(InClass))
+	{
+		return *bCachedResult;
+	}
+
+	// IsNetRelevantFor isn't exposed to Blueprints, so only the native class can change it
+	const UClass* NativeClass = InClass;
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+
+	bool bUsesDefault = false;
+	if (NativeClass)
+	{
+		static const FName EnginePackageName(TEXT("/Script/Engine"));
+
+		if (DistanceOnlyClassNames.Contains(NativeClass->GetFName()))
+		{
+			bUsesDefault = true;
+		}
+		else if (NativeClass->GetOutermost()->GetFName() == EnginePackageName)
+		{
+			// Pawns and player controllers are the only engine actors that override IsNetRelevantFor
+			bUsesDefault = !NativeClass->IsChildOf(APawn::StaticClass()) && !NativeClass->IsChildOf(APlayerController::StaticClass());
+		}
+	}
+
+	DefaultRelevancyClassCache.Add(InClass, bUsesDefault);
+	return bUsesDefault;
+}
+
+void FNetworkRelevancyGrid::Reset()
+{
+	for (TPair<FIntPoint, TArray<FNetworkObjectInfo*>>& Cell : Cells)
+	{
+		for (FNetworkObjectInfo* ObjectInfo : Cell.Value)
+		{
+			ObjectInfo->bInRelevancyGrid = false;
+		}
+	}
+
+	Cells.Empty();
+	SlowPathObjects.Empty();
+	MaxCullDistance = 0.f;
+}
+
+void FNetworkRelevancyGrid::CountBytes(FArchive& Ar) const
+{
+	Cells.CountBytes(Ar);
+	for (const TPair<FIntPoint, TArray<FNetworkObjectInfo*>>& Cell : Cells)
+	{
+		Cell.Value.CountBytes(Ar);
+	}
+
+	SlowPathObjects.CountBytes(Ar);
+	DefaultRelevancyClassCache.CountBytes(Ar);
+}
@@ -84,6 +84,22 @@ static FAutoConsoleVariableRef CVarAllowClientRemapCacheObject(
 	TEXT("When enabled, we will allow clients to remap read only cache objects and keep the same NetGUID.")
 );
 
+static bool GbExportPathPrefixes = false;
+static FAutoConsoleVariableRef CVarExportPathPrefixes(
+	TEXT("net.ExportPathPrefixes"),
+	GbExportPathPrefixes,
+	TEXT("When enabled, the server will export object names as a prefix of a similarly named object the connection has already acked, plus a suffix. Clients must be running a build that understands this.")
+);
+
+static int32 GExportPathPrefixMinLength = 8;
+static FAutoConsoleVariableRef CVarExportPathPrefixMinLength(
+	TEXT("net.ExportPathPrefixes.MinLength"),
+	GExportPathPrefixMinLength,
+	TEXT("Minimum number of shared characters before net.ExportPathPrefixes will send a name as a prefix reference.")
+);
+
+static const int32 MAX_EXPORT_PATH_PREFIX_GUIDS = 4;
+
 static bool GbQuantizeActorScaleOnSpawn = false;
 static FAutoConsoleVariableRef CVarQuantizeActorScaleOnSpawn(
 	TEXT("net.QuantizeActorScaleOnSpawn"),
@@ -772,7 +788,7 @@ void UPackageMapClient::InternalWriteObject( FArchive & Ar, FNetworkGUID NetGUID
 		GEngine->NetworkRemapPath(Connection->Driver, ObjectPathName, false);
 
 		// Serialize Name of object
-		Ar << ObjectPathName;
+		WriteExportPathName(Ar, NetGUID, ObjectPathName, bIsPackage);
 
 		uint32 NetworkChecksum = 0;
 
@@ -803,6 +819,116 @@ void UPackageMapClient::InternalWriteObject( FArchive & Ar, FNetworkGUID NetGUID
 	}
 }
 
+void UPackageMapClient::WriteExportPathName( FArchive& Ar, const FNetworkGUID& NetGUID, const FString& ObjectPathName, const bool bIsPackage )
+{
+	// Package names may be remapped differently on each side (e.g. PIE), so only names relative to an outer are shared.
+	const bool bCanUsePrefix = GbExportPathPrefixes && !bIsPackage && NetGUID.IsStatic() && GuidCache->IsExportingNetGUIDBunch &&
+		IsNetGUIDAuthority() && !Connection->IsInternalAck();
+
+	if ( !bCanUsePrefix )
+	{
+		FString PathName = ObjectPathName;
+		Ar << PathName;
+		return;
+	}
+
+	const FName Name( *ObjectPathName );
+	const FName NameKey( Name, 0 );
+
+	TArray< FNetworkGUID, TInlineAllocator< 4 > >& PrefixGUIDs = GuidCache->ExportPathPrefixGUIDs.FindOrAdd( NameKey );
+
+	FNetworkGUID BestPrefixGUID;
+	int32 BestPrefixLength = 0;
+
+	for ( const FNetworkGUID& PrefixGUID : PrefixGUIDs )
+	{
+		if ( PrefixGUID == NetGUID || !NetGUIDHasBeenAckd( PrefixGUID ) )
+		{
+			continue;
+		}
+
+		const FNetGuidCacheObject* PrefixCacheObject = GuidCache->ObjectLookup.Find( PrefixGUID );
+		if ( PrefixCacheObject == nullptr || !PrefixCacheObject->Object.IsValid() )
+		{
+			continue;
+		}
+
+		const FString PrefixName = PrefixCacheObject->PathName.ToString();
+		const int32 MaxLength = FMath::Min( PrefixName.Len(), ObjectPathName.Len() );
+
+		int32 PrefixLength = 0;
+		while ( PrefixLength < MaxLength && PrefixName[PrefixLength] == ObjectPathName[PrefixLength] )
+		{
+			++PrefixLength;
+		}
+
+		if ( PrefixLength > BestPrefixLength )
+		{
+			BestPrefixGUID = PrefixGUID;
+			BestPrefixLength = PrefixLength;
+		}
+	}
+
+	if ( BestPrefixLength >= GExportPathPrefixMinLength )
+	{
+		FString EmptyPathName;
+		FString Suffix = ObjectPathName.RightChop( BestPrefixLength );
+		uint32 PrefixLength = BestPrefixLength;
+
+		Ar << EmptyPathName;
+		Ar << BestPrefixGUID;
+		Ar.SerializeIntPacked( PrefixLength );
+		Ar << Suffix;
+
+		UE_LOG( LogNetPackageMap, VeryVerbose, TEXT( "WriteExportPathName: %s sent as %d characters of %s + %s" ), *ObjectPathName, BestPrefixLength, *BestPrefixGUID.ToString(), *Suffix );
+	}
+	else
+	{
+		FString PathName = ObjectPathName;
+		Ar << PathName;
+	}
+
+	// Remember this export so similarly named objects can reference it once it's acked
+	if ( !PrefixGUIDs.Contains( NetGUID ) )
+	{
+		if ( PrefixGUIDs.Num() >= MAX_EXPORT_PATH_PREFIX_GUIDS )
+		{
+			PrefixGUIDs.RemoveAt( 0, 1, false );
+		}
+
+		PrefixGUIDs.Add( NetGUID );
+	}
+}
+
+bool UPackageMapClient::ReadExportPathNamePrefix( FArchive& Ar, FString& OutPathName )
+{
+	FNetworkGUID PrefixGUID;
+	uint32 PrefixLength = 0;
+	FString Suffix;
+
+	Ar << PrefixGUID;
+	Ar.SerializeIntPacked( PrefixLength );
+	Ar << Suffix;
+
+	if ( Ar.IsError() )
+	{
+		return false;
+	}
+
+	const FNetGuidCacheObject* PrefixCacheObject = GuidCache->ObjectLookup.Find( PrefixGUID );
+	const FString PrefixName = PrefixCacheObject ? PrefixCacheObject->PathName.ToString() : FString();
+
+	if ( PrefixCacheObject == nullptr || PrefixLength == 0 || (int32)PrefixLength > PrefixName.Len() )
+	{
+		UE_LOG( LogNetPackageMap, Error, TEXT( "ReadExportPathNamePrefix: Invalid prefix reference. PrefixGUID: %s, PrefixLength: %u, Known: %d" ), *PrefixGUID.ToString(), PrefixLength, PrefixCacheObject != nullptr ? 1 : 0 );
+		Ar.SetError();
+		return false;
+	}
+
+	OutPathName = PrefixName.Left( PrefixLength ) + Suffix;
+	return true;
+}
+
 //--------------------------------------------------------------------
 //
 //	Loading
@@ -932,6 +1058,12 @@ FNetworkGUID UPackageMapClient::InternalLoadObject( FArchive & Ar, UObject *& Ob
 
 		Ar << PathName;
 
+		// An empty name is never exported directly, it means the name was sent as a prefix of an existing export.
+		if ( PathName.IsEmpty() && GuidCache->IsExportingNetGUIDBunch && !IsNetGUIDAuthority() )
+		{
+			ReadExportPathNamePrefix( Ar, PathName );
+		}
+
 		if ( ExportFlags.bHasNetworkChecksum )
 		{
 			Ar << NetworkChecksum;
@@ -2326,6 +2458,9 @@ void FNetGUIDCache::CleanReferences()
 {
 	const double Time = FPlatformTime::Seconds();
 
+	// Prefix references are only kept for the current map
+	ExportPathPrefixGUIDs.Reset();
+
 	TMap<TWeakObjectPtr<UObject>, FNetworkGUID> StaticObjectGuids;
 
 	// Mark all static or non valid dynamic guids to timeout after NETWORK_GUID_TIMEOUT seconds
@@ -3459,6 +3594,8 @@ void FNetGUIDCache::ResetCacheForDemo()
 	NetFieldExportGroupMap.Reset();
 	NetFieldExportGroupIndexToGroup.Reset();
 	NetFieldExportGroupPathToIndex.Reset();
+
+	ExportPathPrefixGUIDs.Reset();
 }
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -270,6 +270,7 @@ StatelessConnectHandlerComponent::StatelessConnectHandlerComponent()
 	, bRestartedHandshake(false)
 	, AuthorisedCookie()
 	, MagicHeader()
+	, OutgoingPacketBuffer()
 {
 	SetActive(true);
 
@@ -935,18 +936,32 @@ void StatelessConnectHandlerComponent::Incoming(FBitReader& Packet)
 void StatelessConnectHandlerComponent::Outgoing(FBitWriter& Packet, FOutPacketTraits& Traits)
 {
 	// All UNetConnection packets must specify a zero bHandshakePacket value
-	FBitWriter NewPacket(GetAdjustedSizeBits(Packet.GetNumBits())+1, true);
+	const int64 NewPacketBits = GetAdjustedSizeBits(Packet.GetNumBits()) + 1;
 	uint8 bHandshakePacket = 0;
 
+	// Reuse the buffer of the previously sent packet, only allocating when a bigger packet comes along
+	if (OutgoingPacketBuffer.GetMaxBits() < NewPacketBits)
+	{
+		OutgoingPacketBuffer = FBitWriter(FMath::Max(NewPacketBits, Packet.GetMaxBits() + NewPacketBits - Packet.GetNumBits()), true);
+	}
+	else
+	{
+		OutgoingPacketBuffer.Reset();
+	}
+
 	if (MagicHeader.Num() > 0)
 	{
-		NewPacket.SerializeBits(MagicHeader.GetData(), MagicHeader.Num());
+		OutgoingPacketBuffer.SerializeBits(MagicHeader.GetData(), MagicHeader.Num());
 	}
 
-	NewPacket.WriteBit(bHandshakePacket);
-	NewPacket.SerializeBits(Packet.GetData(), Packet.GetNumBits());
+	OutgoingPacketBuffer.WriteBit(bHandshakePacket);
+	OutgoingPacketBuffer.SerializeBits(Packet.GetData(), Packet.GetNumBits());
 
-	Packet = MoveTemp(NewPacket);
+	// Hand the new packet out and keep the buffer of the old one for the next send
+	FBitWriter SentPacketBuffer;
+	SentPacketBuffer = MoveTemp(Packet);
+	Packet = MoveTemp(OutgoingPacketBuffer);
+	OutgoingPacketBuffer = MoveTemp(SentPacketBuffer);
 }
 
 void StatelessConnectHandlerComponent::IncomingConnectionless(const TSharedPtr<const FInternetAddr>& Address, FBitReader& Packet)
@@ -204,7 +204,8 @@ public:
 	 * @param Simulation The simulation to be sorted.
 	 * @param ViewOrigin The origin of the view from which to sort.
 	 * @param bIsTranslucent Whether this is for sorting translucent particles or opaque particles, affect when the data is required for the rendering.
-	 * @param OutInfo The bindings for this GPU sort task, if success. 
+	 * @param OutInfo The bindings for this GPU sort task, if success. Views within FX.GPUSortShareViewDistance of a view the simulation
+	 *                was already sorted for this frame get the bindings of that sort task instead of a new one.
 	 * @returns true if the work was registered, or false it GPU sorting is not available or impossible.
 	 */
 	bool AddSortedGPUSimulation(FParticleSimulationGPU* Simulation, const FVector& ViewOrigin, bool bIsTranslucent, FGPUSortManager::FAllocationInfo& OutInfo);
@@ -326,6 +327,8 @@ private:
 	TRefCountPtr<FGPUSortManager> GPUSortManager;
 	/** All sort tasks registered in AddSortedGPUSimulation(). Holds all the data required in GenerateSortKeys(). */
 	TArray<FParticleSimulationSortInfo> SimulationsToSort;
+	/** Latest sort task of each simulation in SimulationsToSort, by vertex buffer, so that views close to each other share it. */
+	TMap<FRHIShaderResourceView*, int32> LatestSortTaskBySimulation;
 
 	/** Previous frame new particles for multi-gpu simulation*/
 	TArray<FNewParticle> LastFrameNewParticles;
@@ -3565,10 +3565,12 @@ bool UParticleSystemComponent::CanSkipTickDueToVisibility()
 	{
 		SCOPE_CYCLE_COUNTER(STAT_UParticleSystemComponent_LOD_Inactive);
 		bForcedInActive = true;
-		SpawnEvents.Empty();
-		DeathEvents.Empty();
-		CollisionEvents.Empty();
-		KismetEvents.Empty();
+		// Keep the event arrays allocated, events are reported again once the system is visible.
+		SpawnEvents.Reset();
+		DeathEvents.Reset();
+		CollisionEvents.Reset();
+		BurstEvents.Reset();
+		KismetEvents.Reset();
 
 		if (bIsManagingSignificance && Template->GetHighestSignificance() < RequiredSignificance)
 		{
@@ -5368,6 +5370,14 @@ void UParticleSystemComponent::ComputeTickComponent_Concurrent()
 #endif
 		}
 	}
+
+	// Gather the bounds while the emitters are still hot in this thread's cache, finalize only has to compare them
+	bConcurrentBoundingBoxValid = !bWarmingUp && Template && !Template->bUseFixedRelativeBoundingBox;
+	if (bConcurrentBoundingBoxValid)
+	{
+		ConcurrentBoundingBox = GetEmitterBoundingBox();
+	}
+
 	if (bAsyncWorkOutstanding)
 	{
 		FPlatformMisc::MemoryBarrier();
@@ -5375,6 +5385,26 @@ void UParticleSystemComponent::ComputeTickComponent_Concurrent()
 	}
 }
 
+FBox UParticleSystemComponent::GetEmitterBoundingBox() const
+{
+	FBox BoundingBox;
+	BoundingBox.Init();
+
+	for (int32 i=0; i<EmitterInstances.Num(); i++)
+	{
+		FParticleEmitterInstance* Instance = EmitterInstances[i];
+		if (Instance && Instance->SpriteTemplate)
+		{
+			UParticleLODLevel* SpriteLODLevel = Instance->SpriteTemplate->GetCurrentLODLevel(Instance);
+			if (SpriteLODLevel && SpriteLODLevel->bEnabled)
+			{
+				BoundingBox += Instance->GetBoundingBox();
+			}
+		}
+	}
+	return BoundingBox;
+}
+
 void UParticleSystemComponent::FinalizeTickComponent()
 {
 	FInGameScopedCycleCounter InGameCycleCounter(GetWorld(), EInGamePerfTrackers::VFXSignificance, IsInGameThread() ? EInGamePerfTrackerThreads::GameThread : EInGamePerfTrackerThreads::OtherThread, bIsManagingSignificance);
@@ -5423,6 +5453,12 @@ void UParticleSystemComponent::FinalizeTickComponent()
 						Instance->ProcessParticleEvents(DeltaTimeTick, bSuppressSpawning);
 					}
 				}
+
+				// Batched traces can only be started from the game thread. When finalized elsewhere, the rays are dropped and gathered again next update.
+				if (Instance->CollisionBatches.Num() > 0 && IsInGameThread())
+				{
+					Instance->SubmitCollisionBatches();
+				}
 			}
 		}
 
@@ -5437,7 +5473,7 @@ void UParticleSystemComponent::FinalizeTickComponent()
 		}
 	}
 	// Clear out the Kismet events, as they should have been processed by now...
-	KismetEvents.Empty();
+	KismetEvents.Reset();
 
 	// Indicate that we have been ticked since being registered.
 	bJustRegistered = false;
@@ -5472,22 +5508,8 @@ void UParticleSystemComponent::FinalizeTickComponent()
 		}
 		else
 		{
-			// Compute the new system bounding box.
-			FBox BoundingBox;
-			BoundingBox.Init();
-
-			for (int32 i=0; i<EmitterInstances.Num(); i++)
-			{
-				FParticleEmitterInstance* Instance = EmitterInstances[i];
-				if (Instance && Instance->SpriteTemplate)
-				{
-					UParticleLODLevel* SpriteLODLevel = Instance->SpriteTemplate->GetCurrentLODLevel(Instance);
-					if (SpriteLODLevel && SpriteLODLevel->bEnabled)
-					{
-						BoundingBox += Instance->GetBoundingBox();
-					}
-				}
-			}
+			// Compute the new system bounding box, unless the concurrent tick already did.
+			const FBox BoundingBox = bConcurrentBoundingBoxValid ? ConcurrentBoundingBox : GetEmitterBoundingBox();
 
 			// Only update the primitive's bounding box in the octree if the system bounding box has gotten larger.
 			if(!Bounds.GetBox().IsInside(BoundingBox.Min) || !Bounds.GetBox().IsInside(BoundingBox.Max))
@@ -5496,6 +5518,7 @@ void UParticleSystemComponent::FinalizeTickComponent()
 			}
 		}
 	}
+	bConcurrentBoundingBoxValid = false;
 
 	// Update if the component transform has been dirtied.
 	if(bIsTransformDirty)
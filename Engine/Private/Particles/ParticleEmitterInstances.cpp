@@ -7,6 +7,8 @@
 #include "ParticleEmitterInstances.h"
 #include "EngineGlobals.h"
 #include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "WorldCollision.h"
 #include "Materials/Material.h"
 #include "Particles/ParticleSystem.h"
 #include "TessellationRendering.h"
@@ -17,6 +19,7 @@
 #include "HAL/PlatformStackWalk.h"
 
 #include "Particles/SubUV/ParticleModuleSubUV.h"
+#include "Particles/Collision/ParticleModuleCollision.h"
 #include "Particles/Collision/ParticleModuleCollisionGPU.h"
 #include "Particles/Event/ParticleModuleEventGenerator.h"
 #include "Particles/Event/ParticleModuleEventReceiverBase.h"
@@ -73,6 +76,7 @@ DEFINE_STAT(STAT_MeshParticlePolys);
 
 DEFINE_STAT(STAT_GPUSpriteParticles);
 DEFINE_STAT(STAT_GPUSpritesSpawned);
+DEFINE_STAT(STAT_GPUSpritesTruncated);
 DEFINE_STAT(STAT_SortedGPUParticles);
 DEFINE_STAT(STAT_SortedGPUEmitters);
 DEFINE_STAT(STAT_FreeGPUTiles);
@@ -1279,7 +1283,6 @@ void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 
 		UParticleLODLevel* LODLevel = GetCurrentLODLevelChecked();
 
-		FVector	NewLocation;
 		float	NewRotation;
 		if (bUpdateBox)
 		{
@@ -1317,14 +1320,23 @@ void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 			? Component->GetComponentToWorld().ToMatrixWithScale() 
 			: FMatrix::Identity;
 
+		const VectorRegister VecDeltaTime = VectorSetFloat1(DeltaTime);
+		const VectorRegister VecPositionOffset = VectorLoadFloat3_W0(&PositionOffsetThisTick);
+		VectorRegister VecMinVal = VectorLoadFloat3_W0(&MinVal);
+		VectorRegister VecMaxVal = VectorLoadFloat3_W0(&MaxVal);
+
 		bool bSkipDoubleSpawnUpdate = !SpriteTemplate->bUseLegacySpawningBehavior;
 		for (int32 i=0; i<ActiveParticles; i++)
 		{
 			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[i]);
+			const int32 NextIndex = FMath::Min(i + 1, ActiveParticles - 1);
+			FPlatformMisc::Prefetch(ParticleData, ParticleStride * ParticleIndices[NextIndex]);
+			FPlatformMisc::Prefetch(ParticleData, ParticleStride * ParticleIndices[NextIndex] + PLATFORM_CACHE_LINE_SIZE);
 			
 			// Do linear integrator and update bounding box
 			// Do angular integrator, and wrap result to within +/- 2 PI
-			Particle.OldLocation	= Particle.Location;
+			const VectorRegister VecLocation = VectorLoadFloat3_W0(&Particle.Location);
+			VectorRegister VecNewLocation = VecLocation;
 
 			bool bJustSpawned = (Particle.Flags & STATE_Particle_JustSpawned) != 0;
 			Particle.Flags &= ~STATE_Particle_JustSpawned;
@@ -1336,11 +1348,7 @@ void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 			{
 				if ((Particle.Flags & STATE_Particle_FreezeTranslation) == 0)
 				{
-					NewLocation = Particle.Location + (DeltaTime * Particle.Velocity);
-				}
-				else
-				{
-					NewLocation = Particle.Location;
+					VecNewLocation = VectorMultiplyAdd(VecDeltaTime, VectorLoadFloat3_W0(&Particle.Velocity), VecLocation);
 				}
 				if ((Particle.Flags & STATE_Particle_FreezeRotation) == 0)
 				{
@@ -1353,7 +1361,6 @@ void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 			}
 			else
 			{
-				NewLocation = Particle.Location;
 				NewRotation = Particle.Rotation;
 			}
 
@@ -1376,35 +1383,34 @@ void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 				LocalMax += (Particle.Size * ParticlePivotOffset).GetAbsMax();
 			}
 
-			NewLocation			+= PositionOffsetThisTick;
-			Particle.OldLocation+= PositionOffsetThisTick;
-						
-			Particle.Location	 = NewLocation;
+			VecNewLocation = VectorAdd(VecNewLocation, VecPositionOffset);
+			VectorStoreFloat3(VectorAdd(VecLocation, VecPositionOffset), &Particle.OldLocation);
+			VectorStoreFloat3(VecNewLocation, &Particle.Location);
 			Particle.Rotation	 = FMath::Fmod(NewRotation, 2.f*(float)PI);
 
 			if (bUpdateBox)
 			{	
-				FVector PositionForBounds = NewLocation;
+				VectorRegister VecPositionForBounds = VecNewLocation;
 
 				if (bUseLocalSpace)
 				{
 					// Note: building the bounding box in world space as that gives tighter bounds than transforming a local space AABB into world space
-					PositionForBounds = ComponentToWorld.TransformPosition(NewLocation);
+					const FVector PositionForBounds = ComponentToWorld.TransformPosition(Particle.Location);
+					VecPositionForBounds = VectorLoadFloat3_W0(&PositionForBounds);
 				}
 
 				// Treat each particle as a cube whose sides are the length of the maximum component
 				// This handles the particle's extents changing due to being camera facing
-				MinVal[0] = FMath::Min<float>(MinVal[0], PositionForBounds.X - LocalMax);
-				MaxVal[0] = FMath::Max<float>(MaxVal[0], PositionForBounds.X + LocalMax);
-				MinVal[1] = FMath::Min<float>(MinVal[1], PositionForBounds.Y - LocalMax);
-				MaxVal[1] = FMath::Max<float>(MaxVal[1], PositionForBounds.Y + LocalMax);
-				MinVal[2] = FMath::Min<float>(MinVal[2], PositionForBounds.Z - LocalMax);
-				MaxVal[2] = FMath::Max<float>(MaxVal[2], PositionForBounds.Z + LocalMax);
+				const VectorRegister VecLocalMax = VectorSetFloat1(LocalMax);
+				VecMinVal = VectorMin(VecMinVal, VectorSubtract(VecPositionForBounds, VecLocalMax));
+				VecMaxVal = VectorMax(VecMaxVal, VectorAdd(VecPositionForBounds, VecLocalMax));
 			}
 		}
 
 		if (bUpdateBox)
 		{
+			VectorStoreFloat3(VecMinVal, &MinVal);
+			VectorStoreFloat3(VecMaxVal, &MaxVal);
 			ParticleBoundingBox = FBox(MinVal, MaxVal);
 		}
 	}
@@ -1707,10 +1713,17 @@ void FParticleEmitterInstance::ResetParticleParameters(float DeltaTime)
 	for (int32 ParticleIndex = 0; ParticleIndex < ActiveParticles; ParticleIndex++)
 	{
 		DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[ParticleIndex]);
-		Particle.Velocity		= Particle.BaseVelocity;
-		Particle.Size = GetParticleBaseSize(Particle);
-		Particle.RotationRate	= Particle.BaseRotationRate;
-		Particle.Color = Particle.BaseColor;
+		const int32 NextIndex = FMath::Min(ParticleIndex + 1, ActiveParticles - 1);
+		FPlatformMisc::Prefetch(ParticleData, ParticleStride * ParticleIndices[NextIndex]);
+		FPlatformMisc::Prefetch(ParticleData, ParticleStride * ParticleIndices[NextIndex] + PLATFORM_CACHE_LINE_SIZE);
+
+		// Velocity = BaseVelocity, RotationRate = BaseRotationRate, Size = abs(BaseSize) and Color = BaseColor, a row at a time
+		const VectorRegister VelocityRow = VectorMergeVecXYZ_VecW(VectorLoad(&Particle.BaseVelocity), VectorLoad(&Particle.Velocity));
+		const VectorRegister BaseSizeRow = VectorMergeVecXYZ_VecW(VectorLoad(&Particle.BaseSize), VelocityRow);
+		VectorStore(VelocityRow, &Particle.Velocity);
+		VectorStore(BaseSizeRow, &Particle.BaseSize);
+		VectorStore(VectorMergeVecXYZ_VecW(VectorAbs(BaseSizeRow), VectorLoad(&Particle.Size)), &Particle.Size);
+		VectorStore(VectorLoad(&Particle.BaseColor), &Particle.Color);
 
 		bool bJustSpawned = (Particle.Flags & STATE_Particle_JustSpawned) != 0;
 
@@ -2725,6 +2738,47 @@ bool FParticleEmitterInstance::IsDynamicDataRequired(UParticleLODLevel* InCurren
 /**
  *	Process received events.
  */
+FParticleCollisionBatch& FParticleEmitterInstance::FindOrAddCollisionBatch(const UParticleModuleCollision* Module)
+{
+	for (FParticleCollisionBatch& Batch : CollisionBatches)
+	{
+		if (Batch.Module == Module)
+		{
+			return Batch;
+		}
+	}
+
+	FParticleCollisionBatch& Batch = CollisionBatches.AddDefaulted_GetRef();
+	Batch.Module = Module;
+	return Batch;
+}
+
+void FParticleEmitterInstance::SubmitCollisionBatches()
+{
+	check(IsInGameThread());
+
+	UWorld* World = Component ? Component->GetWorld() : nullptr;
+	for (FParticleCollisionBatch& Batch : CollisionBatches)
+	{
+		Batch.PendingQuery.Reset();
+		if (World && Batch.Module && Batch.Starts.Num() > 0)
+		{
+			AActor* IgnoreActor = Batch.Module->bIgnoreSourceActor ? Component->GetOwner() : nullptr;
+			const bool bLineTrace = Batch.Extent.IsZero();
+
+			// Same query as UParticleSystemComponent::ParticleLineCheck
+			FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ParticleCollision), bLineTrace, IgnoreActor);
+			QueryParams.bReturnPhysicalMaterial = true;
+
+			Batch.PendingQuery = World->AsyncBatchTraceByObjectType(EBatchedTraceCompletion::NextFrame, EAsyncTraceType::Single, Batch.Starts, Batch.Ends, Batch.Module->ObjectParams,
+				bLineTrace ? FCollisionShape::LineShape : FCollisionShape::MakeBox(Batch.Extent), QueryParams);
+			Batch.PendingGeneration = Batch.StagedGeneration;
+		}
+		Batch.Starts.Reset();
+		Batch.Ends.Reset();
+	}
+}
+
 void FParticleEmitterInstance::ProcessParticleEvents(float DeltaTime, bool bSuppressSpawning)
 {
 	UParticleLODLevel* LODLevel = GetCurrentLODLevelChecked();
@@ -2732,48 +2786,32 @@ void FParticleEmitterInstance::ProcessParticleEvents(float DeltaTime, bool bSupp
 	{
 		for (int32 EventModIndex = 0; EventModIndex < LODLevel->EventReceiverModules.Num(); EventModIndex++)
 		{
-			int32 EventIndex;
 			UParticleModuleEventReceiverBase* EventRcvr = LODLevel->EventReceiverModules[EventModIndex];
 			check(EventRcvr);
 
 			if (EventRcvr->WillProcessParticleEvent(EPET_Spawn) && (Component->SpawnEvents.Num() > 0))
 			{
-				for (EventIndex = 0; EventIndex < Component->SpawnEvents.Num(); EventIndex++)
-				{
-					EventRcvr->ProcessParticleEvent(this, Component->SpawnEvents[EventIndex], DeltaTime);
-				}
+				EventRcvr->ProcessParticleEvents(this, FParticleEventBatch(EPET_Spawn, Component->SpawnEvents), DeltaTime);
 			}
 
 			if (EventRcvr->WillProcessParticleEvent(EPET_Death) && (Component->DeathEvents.Num() > 0))
 			{
-				for (EventIndex = 0; EventIndex < Component->DeathEvents.Num(); EventIndex++)
-				{
-					EventRcvr->ProcessParticleEvent(this, Component->DeathEvents[EventIndex], DeltaTime);
-				}
+				EventRcvr->ProcessParticleEvents(this, FParticleEventBatch(EPET_Death, Component->DeathEvents), DeltaTime);
 			}
 
 			if (EventRcvr->WillProcessParticleEvent(EPET_Collision) && (Component->CollisionEvents.Num() > 0))
 			{
-				for (EventIndex = 0; EventIndex < Component->CollisionEvents.Num(); EventIndex++)
-				{
-					EventRcvr->ProcessParticleEvent(this, Component->CollisionEvents[EventIndex], DeltaTime);
-				}
+				EventRcvr->ProcessParticleEvents(this, FParticleEventBatch(EPET_Collision, Component->CollisionEvents), DeltaTime);
 			}
 
 			if (EventRcvr->WillProcessParticleEvent(EPET_Burst) && (Component->BurstEvents.Num() > 0))
 			{
-				for (EventIndex = 0; EventIndex < Component->BurstEvents.Num(); EventIndex++)
-				{
-					EventRcvr->ProcessParticleEvent(this, Component->BurstEvents[EventIndex], DeltaTime);
-				}
+				EventRcvr->ProcessParticleEvents(this, FParticleEventBatch(EPET_Burst, Component->BurstEvents), DeltaTime);
 			}
 
 			if (EventRcvr->WillProcessParticleEvent(EPET_Blueprint) && (Component->KismetEvents.Num() > 0))
 			{
-				for (EventIndex = 0; EventIndex < Component->KismetEvents.Num(); EventIndex++)
-				{
-					EventRcvr->ProcessParticleEvent(this, Component->KismetEvents[EventIndex], DeltaTime);
-				}
+				EventRcvr->ProcessParticleEvents(this, FParticleEventBatch(EPET_Blueprint, Component->KismetEvents), DeltaTime);
 			}
 		}
 	}
@@ -3477,7 +3515,6 @@ void FParticleMeshEmitterInstance::UpdateBoundingBox(float DeltaTime)
 			? Component->GetComponentToWorld().ToMatrixWithScale() 
 			: FMatrix::Identity;
 
-		FVector	NewLocation;
 		float	NewRotation;
 		if (bUpdateBox)
 		{
@@ -3488,6 +3525,11 @@ void FParticleMeshEmitterInstance::UpdateBoundingBox(float DeltaTime)
 		FVector MinVal(HALF_WORLD_MAX);
 		FVector MaxVal(-HALF_WORLD_MAX);
 		
+		const VectorRegister VecDeltaTime = VectorSetFloat1(DeltaTime);
+		const VectorRegister VecPositionOffset = VectorLoadFloat3_W0(&PositionOffsetThisTick);
+		VectorRegister VecMinVal = VectorLoadFloat3_W0(&MinVal);
+		VectorRegister VecMaxVal = VectorLoadFloat3_W0(&MaxVal);
+
 		FPlatformMisc::Prefetch(ParticleData, ParticleStride * ParticleIndices[0]);
 		FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[0] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
 
@@ -3499,7 +3541,8 @@ void FParticleMeshEmitterInstance::UpdateBoundingBox(float DeltaTime)
 			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
 
 			// Do linear integrator and update bounding box
-			Particle.OldLocation = Particle.Location;
+			const VectorRegister VecLocation = VectorLoadFloat3_W0(&Particle.Location);
+			VectorRegister VecNewLocation = VecLocation;
 
 			bool bJustSpawned = (Particle.Flags & STATE_Particle_JustSpawned) != 0;
 			Particle.Flags &= ~STATE_Particle_JustSpawned;
@@ -3511,11 +3554,7 @@ void FParticleMeshEmitterInstance::UpdateBoundingBox(float DeltaTime)
 			{
 				if ((Particle.Flags & STATE_Particle_FreezeTranslation) == 0)
 				{
-					NewLocation	= Particle.Location + DeltaTime * Particle.Velocity;
-				}
-				else
-				{
-					NewLocation = Particle.Location;
+					VecNewLocation = VectorMultiplyAdd(VecDeltaTime, VectorLoadFloat3_W0(&Particle.Velocity), VecLocation);
 				}
 				if ((Particle.Flags & STATE_Particle_FreezeRotation) == 0)
 				{
@@ -3529,40 +3568,39 @@ void FParticleMeshEmitterInstance::UpdateBoundingBox(float DeltaTime)
 			else
 			{
 				// Don't move it...
-				NewLocation = Particle.Location;
 				NewRotation = Particle.Rotation;
 			}
 
 			FVector LocalExtent = MeshBound.GetBox().GetExtent() * Particle.Size * Scale;
 
-			NewLocation			+= PositionOffsetThisTick;
-			Particle.OldLocation+= PositionOffsetThisTick;
+			VecNewLocation = VectorAdd(VecNewLocation, VecPositionOffset);
+			VectorStoreFloat3(VectorAdd(VecLocation, VecPositionOffset), &Particle.OldLocation);
 
 			// Do angular integrator, and wrap result to within +/- 2 PI
 			Particle.Rotation = FMath::Fmod(NewRotation, 2.f*(float)PI);
-			Particle.Location = NewLocation;
+			VectorStoreFloat3(VecNewLocation, &Particle.Location);
 
 			if (bUpdateBox)
 			{	
-				FVector PositionForBounds = NewLocation;
+				VectorRegister VecPositionForBounds = VecNewLocation;
 
 				if (bUseLocalSpace)
 				{
 					// Note: building the bounding box in world space as that gives tighter bounds than transforming a local space AABB into world space
-					PositionForBounds = ComponentToWorld.TransformPosition(NewLocation);
+					const FVector PositionForBounds = ComponentToWorld.TransformPosition(Particle.Location);
+					VecPositionForBounds = VectorLoadFloat3_W0(&PositionForBounds);
 				}
 
-				MinVal[0] = FMath::Min<float>(MinVal[0], PositionForBounds.X - LocalExtent.X);
-				MaxVal[0] = FMath::Max<float>(MaxVal[0], PositionForBounds.X + LocalExtent.X);
-				MinVal[1] = FMath::Min<float>(MinVal[1], PositionForBounds.Y - LocalExtent.Y);
-				MaxVal[1] = FMath::Max<float>(MaxVal[1], PositionForBounds.Y + LocalExtent.Y);
-				MinVal[2] = FMath::Min<float>(MinVal[2], PositionForBounds.Z - LocalExtent.Z);
-				MaxVal[2] = FMath::Max<float>(MaxVal[2], PositionForBounds.Z + LocalExtent.Z);
+				const VectorRegister VecLocalExtent = VectorLoadFloat3_W0(&LocalExtent);
+				VecMinVal = VectorMin(VecMinVal, VectorSubtract(VecPositionForBounds, VecLocalExtent));
+				VecMaxVal = VectorMax(VecMaxVal, VectorAdd(VecPositionForBounds, VecLocalExtent));
 			}
 		}
 
 		if (bUpdateBox)
 		{	
+			VectorStoreFloat3(VecMinVal, &MinVal);
+			VectorStoreFloat3(VecMaxVal, &MaxVal);
 			ParticleBoundingBox = FBox(MinVal, MaxVal);
 		}
 	}
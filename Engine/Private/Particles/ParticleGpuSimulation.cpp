@@ -122,12 +122,21 @@ static TAutoConsoleVariable<int32> CVarGPUParticleAFRReinject(
 	TEXT("  1: Reinjection on"),
 	ECVF_ReadOnly);
 
+static int32 GGPUParticleTileExhaustionFrames = 60;
+static FAutoConsoleVariableRef CVarGPUParticleTileExhaustionFrames(
+	TEXT("fx.GPUParticleTileExhaustionFrames"),
+	GGPUParticleTileExhaustionFrames,
+	TEXT("Number of frames after running out of GPU particle tiles during which emitters give back the tiles they preallocated but don't use.\n")
+	TEXT("0 disables it, emitters then always keep their preallocated tiles."),
+	ECVF_Default);
+
 /*-----------------------------------------------------------------------------
 	Allocators used to manage GPU particle resources.
 -----------------------------------------------------------------------------*/
 
 /**
- * Stack allocator for managing tile lifetime.
+ * Allocator for managing tile lifetime. Free tiles are kept in a min-heap so the lowest free tile is always allocated
+ * first: as emitters churn, live tiles pack towards the start of the simulation textures instead of scattering over them.
  */
 class FParticleTileAllocator
 {
@@ -135,7 +144,8 @@ public:
 
 	/** Default constructor. */
 	FParticleTileAllocator()
-		: FreeTileCount(GParticleSimulationTileCount)
+		: LastExhaustedFrame(0)
+		, bExhausted(false)
 	{
 		/** Texture size must be power-of-two. */
 		check((GParticleSimulationTextureSizeX & (GParticleSimulationTextureSizeX - 1)) == 0); // fx.GPUSimulationTextureSizeX is not a power of two.
@@ -144,11 +154,12 @@ public:
 		check(GParticleSimulationTileSize <= GParticleSimulationTextureSizeX); // Particle simulation tile size is larger than fx.GPUSimulationTextureSizeX.
 		check(GParticleSimulationTileSize <= GParticleSimulationTextureSizeY); // Particle simulation tile size is larger than fx.GPUSimulationTextureSizeY.
 
+		// Ascending order is already a valid min-heap.
 		FreeTiles.AddUninitialized(GParticleSimulationTileCount);
 
 		for ( int32 TileIndex = 0; TileIndex < GParticleSimulationTileCount; ++TileIndex )
 		{
-			FreeTiles[TileIndex] = GParticleSimulationTileCount - TileIndex - 1;
+			FreeTiles[TileIndex] = TileIndex;
 		}
 	}
 
@@ -159,11 +170,14 @@ public:
 	uint32 Allocate()
 	{
 		FScopeLock Lock(&CriticalSection);
-		if ( FreeTileCount > 0 )
+		if ( FreeTiles.Num() > 0 )
 		{
-			FreeTileCount--;
-			return FreeTiles[FreeTileCount];
+			uint32 TileIndex;
+			FreeTiles.HeapPop(TileIndex, /*bAllowShrinking=*/ false);
+			return TileIndex;
 		}
+		LastExhaustedFrame = GFrameCounter;
+		bExhausted = true;
 		return INDEX_NONE;
 	}
 
@@ -175,9 +189,8 @@ public:
 	{
 		FScopeLock Lock(&CriticalSection);
 		check( TileIndex < GParticleSimulationTileCount );
-		check( FreeTileCount < GParticleSimulationTileCount );
-		FreeTiles[FreeTileCount] = TileIndex;
-		FreeTileCount++;
+		check( FreeTiles.Num() < GParticleSimulationTileCount );
+		FreeTiles.HeapPush(TileIndex);
 	}
 
 	/**
@@ -186,15 +199,26 @@ public:
 	int32 GetFreeTileCount() const
 	{
 		FScopeLock Lock(&CriticalSection);
-		return FreeTileCount;
+		return FreeTiles.Num();
+	}
+
+	/**
+	 * Returns true if an allocation failed during the last fx.GPUParticleTileExhaustionFrames frames.
+	 */
+	bool IsUnderPressure() const
+	{
+		FScopeLock Lock(&CriticalSection);
+		return bExhausted && GFrameCounter - LastExhaustedFrame < (uint64)FMath::Max(GGPUParticleTileExhaustionFrames, 0);
 	}
 
 private:
 
-	/** List of free tiles. */
+	/** Min-heap of free tiles. */
 	TArray<uint32> FreeTiles;
-	/** How many tiles are in the free list. */
-	int32 FreeTileCount;
+	/** Frame of the last failed allocation. */
+	uint64 LastExhaustedFrame;
+	/** True once an allocation failed. */
+	bool bExhausted;
 
 	mutable FCriticalSection CriticalSection;
 };
@@ -476,6 +500,14 @@ public:
 		return TileAllocator.GetFreeTileCount();
 	}
 
+	/**
+	 * Returns true if tiles recently ran out, emitters should then give back the tiles they don't use.
+	 */
+	bool AreTilesUnderPressure() const
+	{
+		return TileAllocator.IsUnderPressure();
+	}
+
 private:
 
 	/** Allocator for managing particle tiles. */
@@ -3815,12 +3847,13 @@ private:
 	}
 
 	/**
-	 * Release any inactive tiles.
+	 * Release any inactive tiles. Preallocated tiles are kept unless tiles recently ran out, in which case they are
+	 * released too so that other emitters may spawn.
 	 * @returns the number of tiles released.
 	 */
 	int32 FreeInactiveTiles()
 	{
-		const int32 MinTileCount = GetMinTileCount();
+		const int32 MinTileCount = FXSystem->GetParticleSimulationResources()->AreTilesUnderPressure() ? 0 : GetMinTileCount();
 		int32 TilesToFree = 0;
 		TBitArray<>::FConstReverseIterator BitIter(ActiveTiles);
 		while (BitIter && BitIter.GetIndex() >= MinTileCount)
@@ -3934,6 +3967,7 @@ private:
 						UE_LOG(LogParticles,Warning,
 							TEXT("Failed to allocate tiles for %s! %d new particles truncated to %d."),
 							*Component->Template->GetName(), NumNewParticles, ParticleIndex);
+						INC_DWORD_STAT_BY(STAT_GPUSpritesTruncated, NumNewParticles - ParticleIndex);
 						return ParticleIndex;
 					}
 
@@ -4429,11 +4463,34 @@ void FFXSystem::RemoveGPUSimulation(FParticleSimulationGPU* Simulation)
 	}
 }
 
+static float GGPUSortShareViewDistance = 50.0f;
+static FAutoConsoleVariableRef CVarGPUSortShareViewDistance(
+	TEXT("FX.GPUSortShareViewDistance"),
+	GGPUSortShareViewDistance,
+	TEXT("Views whose origins are closer than this distance share the GPU sort of an emitter, e.g. stereo views or close split-screen players.\n")
+	TEXT("0 sorts each emitter once per view."),
+	ECVF_Default);
+
 bool FFXSystem::AddSortedGPUSimulation(FParticleSimulationGPU* Simulation, const FVector& ViewOrigin, bool bIsTranslucent, FGPUSortManager::FAllocationInfo& OutInfo)
 {
 	LLM_SCOPE(ELLMTag::Particles);
 	check(RHISupportsComputeShaders(ShaderPlatform));
 
+	if (bIsTranslucent && GGPUSortShareViewDistance > 0.0f)
+	{
+		// The order of particles hardly changes between close view origins, reuse the sort task of the previous view.
+		const int32* LatestSortTaskIndex = LatestSortTaskBySimulation.Find(Simulation->VertexBuffer.VertexBufferSRV);
+		if (LatestSortTaskIndex)
+		{
+			const FParticleSimulationSortInfo& SortInfo = SimulationsToSort[*LatestSortTaskIndex];
+			if (SortInfo.ParticleCount == (uint32)Simulation->VertexBuffer.ParticleCount && FVector::DistSquared(SortInfo.ViewOrigin, ViewOrigin) <= FMath::Square(GGPUSortShareViewDistance))
+			{
+				OutInfo = SortInfo.AllocationInfo;
+				return true;
+			}
+		}
+	}
+
 	const EGPUSortFlags SortFlags = 
 		EGPUSortFlags::KeyGenAfterPostRenderOpaque |
 		EGPUSortFlags::ValuesAsG16R16F | 
@@ -4443,7 +4500,8 @@ bool FFXSystem::AddSortedGPUSimulation(FParticleSimulationGPU* Simulation, const
 	// Currently opaque materials would need SortAfterPreRender but this is incompatible with KeyGenAfterPostRenderOpaque
 	if (bIsTranslucent && GPUSortManager && GPUSortManager->AddTask(OutInfo, Simulation->VertexBuffer.ParticleCount, SortFlags))
 	{
-		SimulationsToSort.Emplace(Simulation->VertexBuffer.VertexBufferSRV, ViewOrigin, (uint32)Simulation->VertexBuffer.ParticleCount, OutInfo);
+		const int32 SortTaskIndex = SimulationsToSort.Emplace(Simulation->VertexBuffer.VertexBufferSRV, ViewOrigin, (uint32)Simulation->VertexBuffer.ParticleCount, OutInfo);
+		LatestSortTaskBySimulation.Add(Simulation->VertexBuffer.VertexBufferSRV, SortTaskIndex);
 		return true;
 	}
 	else
@@ -4479,6 +4537,7 @@ void FFXSystem::AdvanceGPUParticleFrame(bool bAllowGPUParticleUpdate)
 	// Reset the list of sorted simulations. As PreRenderView is called on GPU simulations we'll
 	// allocate space for them in the sorted index buffer.
 	SimulationsToSort.Reset();
+	LatestSortTaskBySimulation.Reset();
 }
 
 /**
@@ -1936,11 +1936,12 @@ void UParticleModuleRotationOverLifetime::PostEditChangeProperty(FPropertyChange
 
 void UParticleModuleRotationOverLifetime::Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime)
 {
+	const FRawDistribution* FastRotationOverLife = RotationOverLife.GetFastRawDistribution();
 	if (Scale)
 	{
 		BEGIN_UPDATE_LOOP;
 		{
-			float Rotation = RotationOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+			float Rotation = RotationOverLife.GetValueFast(FastRotationOverLife, Particle.RelativeTime, Owner->Component);
 			// For now, we are just using the X-value
 			Particle.Rotation = (Particle.Rotation * (Rotation * (PI/180.f) * 360.0f));
 		}
@@ -1950,7 +1951,7 @@ void UParticleModuleRotationOverLifetime::Update(FParticleEmitterInstance* Owner
 	{
 		BEGIN_UPDATE_LOOP;
 		{
-			float Rotation = RotationOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+			float Rotation = RotationOverLife.GetValueFast(FastRotationOverLife, Particle.RelativeTime, Owner->Component);
 			// For now, we are just using the X-value
 			Particle.Rotation = (Particle.Rotation + (Rotation * (PI/180.f) * 360.0f));
 		}
@@ -2513,18 +2514,17 @@ void UParticleModuleAccelerationConstant::Update(FParticleEmitterInstance* Owner
 	}
 	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
 	check(LODLevel);
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride));
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+	PREFETCH_FIRST_UPDATE_PARTICLE(Owner);
 	if (bAlwaysInWorldSpace && LODLevel->RequiredModule->bUseLocalSpace)
 	{
 		FTransform Mat = Owner->Component->GetComponentTransform();
-		FVector LocalAcceleration = Mat.InverseTransformVector(Acceleration);
+		const FVector VelocityDelta = Mat.InverseTransformVector(Acceleration) * DeltaTime;
+		const VectorRegister VecVelocityDelta = VectorLoadFloat3_W0(&VelocityDelta);
 		BEGIN_UPDATE_LOOP;
 		{
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-			Particle.Velocity		+= LocalAcceleration * DeltaTime;
-			Particle.BaseVelocity	+= LocalAcceleration * DeltaTime;
+			PREFETCH_NEXT_UPDATE_PARTICLE;
+			Particle_AddToRowXYZ(Particle.Velocity, VecVelocityDelta);
+			Particle_AddToRowXYZ(Particle.BaseVelocity, VecVelocityDelta);
 		}
 		END_UPDATE_LOOP;
 	}
@@ -2535,12 +2535,13 @@ void UParticleModuleAccelerationConstant::Update(FParticleEmitterInstance* Owner
 		{
 			LocalAcceleration = Owner->EmitterToSimulation.TransformVector(LocalAcceleration);
 		}
+		const FVector VelocityDelta = LocalAcceleration * DeltaTime;
+		const VectorRegister VecVelocityDelta = VectorLoadFloat3_W0(&VelocityDelta);
 		BEGIN_UPDATE_LOOP;
 		{
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-			Particle.Velocity		+= LocalAcceleration * DeltaTime;
-			Particle.BaseVelocity	+= LocalAcceleration * DeltaTime;
+			PREFETCH_NEXT_UPDATE_PARTICLE;
+			Particle_AddToRowXYZ(Particle.Velocity, VecVelocityDelta);
+			Particle_AddToRowXYZ(Particle.BaseVelocity, VecVelocityDelta);
 		}
 		END_UPDATE_LOOP;
 	}
@@ -2842,8 +2843,8 @@ void UParticleModuleAcceleration::Update(FParticleEmitterInstance* Owner, int32
 	}
 	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
 	check(LODLevel);
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride));
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+	PREFETCH_FIRST_UPDATE_PARTICLE(Owner);
+	const VectorRegister VecDeltaTime = VectorSetFloat1(DeltaTime);
 	if (bAlwaysInWorldSpace && LODLevel->RequiredModule->bUseLocalSpace)
 	{
 		FTransform Mat = Owner->Component->GetComponentTransform();
@@ -2851,10 +2852,10 @@ void UParticleModuleAcceleration::Update(FParticleEmitterInstance* Owner, int32
 		{
 			FVector& UsedAcceleration = *((FVector*)(ParticleBase + CurrentOffset));																\
 			FVector TransformedUsedAcceleration = Mat.InverseTransformVector(UsedAcceleration);
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-			Particle.Velocity		+= TransformedUsedAcceleration * DeltaTime;
-			Particle.BaseVelocity	+= TransformedUsedAcceleration * DeltaTime;
+			PREFETCH_NEXT_UPDATE_PARTICLE;
+			const VectorRegister VecVelocityDelta = VectorMultiply(VectorLoadFloat3_W0(&TransformedUsedAcceleration), VecDeltaTime);
+			Particle_AddToRowXYZ(Particle.Velocity, VecVelocityDelta);
+			Particle_AddToRowXYZ(Particle.BaseVelocity, VecVelocityDelta);
 		}
 		END_UPDATE_LOOP;
 	}
@@ -2863,10 +2864,10 @@ void UParticleModuleAcceleration::Update(FParticleEmitterInstance* Owner, int32
 		BEGIN_UPDATE_LOOP;
 		{
 			FVector& UsedAcceleration = *((FVector*)(ParticleBase + CurrentOffset));																\
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-			Particle.Velocity		+= UsedAcceleration * DeltaTime;
-			Particle.BaseVelocity	+= UsedAcceleration * DeltaTime;
+			PREFETCH_NEXT_UPDATE_PARTICLE;
+			const VectorRegister VecVelocityDelta = VectorMultiply(VectorLoadFloat3_W0(&UsedAcceleration), VecDeltaTime);
+			Particle_AddToRowXYZ(Particle.Velocity, VecVelocityDelta);
+			Particle_AddToRowXYZ(Particle.BaseVelocity, VecVelocityDelta);
 		}
 		END_UPDATE_LOOP;
 	}
@@ -2934,12 +2935,13 @@ void UParticleModuleAccelerationOverLifetime::Update(FParticleEmitterInstance* O
 {
 	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
 	check(LODLevel);
+	const FRawDistribution* FastAccelOverLife = AccelOverLife.GetFastRawDistribution();
 	if (bAlwaysInWorldSpace && LODLevel->RequiredModule->bUseLocalSpace)
 	{
 		FTransform Mat = Owner->Component->GetComponentTransform();
 		BEGIN_UPDATE_LOOP;
 			// Acceleration should always be in world space...
-			FVector Accel = AccelOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+			FVector Accel = AccelOverLife.GetValueFast(FastAccelOverLife, Particle.RelativeTime, Owner->Component);
 			Accel = Mat.InverseTransformVector(Accel);
 			Particle.Velocity		+= Accel * DeltaTime;
 			Particle.BaseVelocity	+= Accel * DeltaTime;
@@ -2949,7 +2951,7 @@ void UParticleModuleAccelerationOverLifetime::Update(FParticleEmitterInstance* O
 	{
 		BEGIN_UPDATE_LOOP;
 		// Acceleration should always be in world space...
-		FVector Accel = AccelOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+		FVector Accel = AccelOverLife.GetValueFast(FastAccelOverLife, Particle.RelativeTime, Owner->Component);
 		Particle.Velocity		+= Accel * DeltaTime;
 		Particle.BaseVelocity	+= Accel * DeltaTime;
 		END_UPDATE_LOOP;
@@ -12,6 +12,7 @@
 #include "Engine/EngineTypes.h"
 #include "GameFramework/Pawn.h"
 #include "CollisionQueryParams.h"
+#include "WorldCollision.h"
 #include "Materials/Material.h"
 #include "ParticleHelper.h"
 #include "Distributions/DistributionFloatConstant.h"
@@ -62,6 +63,7 @@ UParticleModuleCollision::UParticleModuleCollision(const FObjectInitializer& Obj
 	MaxCollisionDistance = 1000.0f;
 	bIgnoreSourceActor = true;
 	bIgnoreTriggerVolumes = true;
+	bUseBatchedCollision = false;
 	CollisionTypes.Add(UEngineTypes::ConvertToObjectType(ECC_WorldStatic));
 }
 
@@ -154,6 +156,8 @@ void UParticleModuleCollision::Spawn(FParticleEmitterInstance* Owner, int32 Offs
 		CollisionPayload.UsedDampingFactorRotation = DampingFactorRotation.GetValue(Owner->EmitterTime, Owner->Component);
 		CollisionPayload.UsedCollisions = FMath::RoundToInt(MaxCollisions.GetValue(Owner->EmitterTime, Owner->Component));
 		CollisionPayload.Delay = DelayAmount.GetValue(Owner->EmitterTime, Owner->Component);
+		CollisionPayload.BatchedQueryIndex = INDEX_NONE;
+		CollisionPayload.BatchedQueryGeneration = 0;
 		if (CollisionPayload.Delay > SpawnTime)
 		{
 			Particle.Flags |= STATE_Particle_DelayCollisions;
@@ -170,6 +174,38 @@ static FAutoConsoleVariableRef ParticleCollisionIgnoreInvisibleTime(
 	ECVF_Default
 	);
 
+/**
+ * Finds the hit of the ray traced for a particle by the previous batched query and carries it over to the segment the
+ * particle covers during this update, treating the surface that was hit as a plane.
+ */
+static bool ExtrapolateBatchedCollision(const FParticleCollisionBatch& Batch, const TArray<FHitResult>* BatchedHits, const FParticleCollisionPayload& CollisionPayload,
+	const FVector& Start, const FVector& End, FHitResult& OutHit)
+{
+	if (!BatchedHits || CollisionPayload.BatchedQueryGeneration != Batch.PendingGeneration || !BatchedHits->IsValidIndex(CollisionPayload.BatchedQueryIndex))
+	{
+		return false;
+	}
+
+	const FHitResult& BatchedHit = (*BatchedHits)[CollisionPayload.BatchedQueryIndex];
+	if (!BatchedHit.bBlockingHit)
+	{
+		return false;
+	}
+
+	const float StartDistance = (Start - BatchedHit.Location) | BatchedHit.Normal;
+	const float EndDistance = (End - BatchedHit.Location) | BatchedHit.Normal;
+	if (EndDistance >= 0.0f)
+	{
+		// The particle doesn't reach the surface during this update
+		return false;
+	}
+
+	OutHit = BatchedHit;
+	OutHit.Time = (StartDistance > 0.0f) ? StartDistance / (StartDistance - EndDistance) : 0.0f;
+	OutHit.Location = FMath::Lerp(Start, End, OutHit.Time);
+	return true;
+}
+
 void UParticleModuleCollision::Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ParticleCollisionTime);
@@ -302,6 +338,25 @@ void UParticleModuleCollision::Update(FParticleEmitterInstance* Owner, int32 Off
 		}
 	}
 
+	// Rays traced for the previous update, and the batch gathering this update's rays
+	FParticleCollisionBatch* CollisionBatch = nullptr;
+	const TArray<FHitResult>* BatchedHits = nullptr;
+	if (bUseBatchedCollision && World->IsGameWorld())
+	{
+		CollisionBatch = &Owner->FindOrAddCollisionBatch(this);
+		CollisionBatch->Starts.Reset();
+		CollisionBatch->Ends.Reset();
+		CollisionBatch->StagedGeneration = FMath::Max<uint32>(CollisionBatch->StagedGeneration + 1, 1);
+
+		UParticleModuleTypeDataMesh* MeshType = Cast<UParticleModuleTypeDataMesh>(LODLevel->TypeDataModule);
+		CollisionBatch->Extent = (MeshType && MeshType->Mesh) ? MeshType->Mesh->GetBounds().BoxExtent : FVector::ZeroVector;
+
+		if (CollisionBatch->PendingQuery.IsValid() && CollisionBatch->PendingQuery->IsComplete())
+		{
+			BatchedHits = &CollisionBatch->PendingQuery->Hits;
+		}
+	}
+
 	float SquaredMaxCollisionDistance = FMath::Square(MaxCollisionDistance);
 	BEGIN_UPDATE_LOOP;
 	{
@@ -381,7 +436,23 @@ void UParticleModuleCollision::Update(FParticleEmitterInstance* Owner, int32 Off
 
 		AActor* IgnoreActor = bIgnoreSourceActor ? Actor : NULL;
 
-		if (PerformCollisionCheck(Owner, &Particle, Hit, IgnoreActor, End, OldLocation, Extent))
+		bool bCollided;
+		if (CollisionBatch)
+		{
+			bCollided = ExtrapolateBatchedCollision(*CollisionBatch, BatchedHits, CollisionPayload, OldLocation, End, Hit);
+
+			// Trace where the particle is heading during the next update
+			const FVector Travel = Location - OldLocation;
+			CollisionPayload.BatchedQueryIndex = CollisionBatch->Starts.Add(Location);
+			CollisionPayload.BatchedQueryGeneration = CollisionBatch->StagedGeneration;
+			CollisionBatch->Ends.Add(End + Travel);
+		}
+		else
+		{
+			bCollided = PerformCollisionCheck(Owner, &Particle, Hit, IgnoreActor, End, OldLocation, Extent);
+		}
+
+		if (bCollided)
 		{
 			bool bDecrementMaxCount = true;
 			bool bIgnoreCollision = false;
@@ -373,15 +373,13 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
 	}
 	const FRawDistribution* FastColorOverLife = ColorOverLife.GetFastRawDistribution();
 	const FRawDistribution* FastAlphaOverLife = AlphaOverLife.GetFastRawDistribution();
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride));
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+	PREFETCH_FIRST_UPDATE_PARTICLE(Owner);
 	if( FastColorOverLife && FastAlphaOverLife )
 	{
 		// fast path
 		BEGIN_UPDATE_LOOP;
 		{
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+			PREFETCH_NEXT_UPDATE_PARTICLE;
 			FastColorOverLife->GetValue3None(Particle.RelativeTime, &Particle.Color.R);
 			FastAlphaOverLife->GetValue1None(Particle.RelativeTime, &Particle.Color.A);
 		}
@@ -395,8 +393,7 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
 		{
 			ColorVec = ColorOverLife.GetValue(Particle.RelativeTime, Owner->Component);
 			fAlpha = AlphaOverLife.GetValue(Particle.RelativeTime, Owner->Component);
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+			PREFETCH_NEXT_UPDATE_PARTICLE;
 			Particle.Color.R = ColorVec.X;
 			Particle.Color.G = ColorVec.Y;
 			Particle.Color.B = ColorVec.Z;
@@ -289,6 +289,18 @@ bool UParticleModuleEventReceiverKillParticles::ProcessParticleEvent(FParticleEm
 	return false;
 }
 
+void UParticleModuleEventReceiverKillParticles::ProcessParticleEvents(FParticleEmitterInstance* Owner, const FParticleEventBatch& InEvents, float DeltaTime)
+{
+	// Particles are killed once whatever the number of events.
+	for (int32 EventIndex = 0; EventIndex < InEvents.Num(); EventIndex++)
+	{
+		if (ProcessParticleEvent(Owner, InEvents[EventIndex], DeltaTime))
+		{
+			break;
+		}
+	}
+}
+
 /*-----------------------------------------------------------------------------
 	UParticleModuleEventReceiver implementation.
 -----------------------------------------------------------------------------*/
@@ -333,43 +345,45 @@ void UParticleModuleEventReceiverSpawn::PostEditChangeProperty(FPropertyChangedE
 }
 #endif // WITH_EDITOR
 
-bool UParticleModuleEventReceiverSpawn::ProcessParticleEvent(FParticleEmitterInstance* Owner, FParticleEventData& InEvent, float DeltaTime)
+int32 UParticleModuleEventReceiverSpawn::GetSpawnCount(const FParticleEventData& InEvent)
 {
-	if ((InEvent.EventName == EventName) && ((EventGeneratorType == EPET_Any) || (EventGeneratorType == InEvent.Type)))
-	{
-		int32 Count = 0;
+	int32 Count = 0;
 
-		switch (InEvent.Type)
+	switch (InEvent.Type)
+	{
+	case EPET_Spawn:
+	case EPET_Burst:
+	case EPET_Blueprint:
+		Count = FMath::RoundToInt(SpawnCount.GetValue(InEvent.EmitterTime));
+		break;
+	case EPET_Death:
 		{
-		case EPET_Spawn:
-		case EPET_Burst:
-			Count = FMath::RoundToInt(SpawnCount.GetValue(InEvent.EmitterTime));
-			break;
-		case EPET_Death:
-			{
-				FParticleEventDeathData* DeathData = (FParticleEventDeathData*)(&InEvent);
-				Count = FMath::RoundToInt(SpawnCount.GetValue(bUseParticleTime ? DeathData->ParticleTime : InEvent.EmitterTime));
-			}
-			break;
-		case EPET_Collision:
-			{
-				FParticleEventCollideData* CollideData = (FParticleEventCollideData*)(&InEvent);
-				UPhysicalMaterial* PhysMat = CollideData->PhysMat;
-				bool bPhysMatIsAllowed = !PhysMat || (PhysicalMaterials.Num() == 0 || PhysicalMaterials.Contains(PhysMat) == !bBanPhysicalMaterials);
+			const FParticleEventDeathData* DeathData = (const FParticleEventDeathData*)(&InEvent);
+			Count = FMath::RoundToInt(SpawnCount.GetValue(bUseParticleTime ? DeathData->ParticleTime : InEvent.EmitterTime));
+		}
+		break;
+	case EPET_Collision:
+		{
+			const FParticleEventCollideData* CollideData = (const FParticleEventCollideData*)(&InEvent);
+			UPhysicalMaterial* PhysMat = CollideData->PhysMat;
+			bool bPhysMatIsAllowed = !PhysMat || (PhysicalMaterials.Num() == 0 || PhysicalMaterials.Contains(PhysMat) == !bBanPhysicalMaterials);
 
-				if (bPhysMatIsAllowed)
-				{
-					Count = FMath::RoundToInt(SpawnCount.GetValue(bUseParticleTime ? CollideData->ParticleTime : InEvent.EmitterTime));
-				}
-			}
-			break;
-		case EPET_Blueprint:
+			if (bPhysMatIsAllowed)
 			{
-				FParticleEventKismetData* KismetData = (FParticleEventKismetData*)(&InEvent);
-				Count = FMath::RoundToInt(SpawnCount.GetValue(InEvent.EmitterTime));
+				Count = FMath::RoundToInt(SpawnCount.GetValue(bUseParticleTime ? CollideData->ParticleTime : InEvent.EmitterTime));
 			}
-			break;
 		}
+		break;
+	}
+
+	return Count;
+}
+
+bool UParticleModuleEventReceiverSpawn::ProcessParticleEvent(FParticleEmitterInstance* Owner, FParticleEventData& InEvent, float DeltaTime)
+{
+	if (IsEventOfInterest(InEvent))
+	{
+		const int32 Count = GetSpawnCount(InEvent);
 
 		if (Count > 0)
 		{
@@ -385,3 +399,30 @@ bool UParticleModuleEventReceiverSpawn::ProcessParticleEvent(FParticleEmitterIns
 
 	return false;
 }
+
+void UParticleModuleEventReceiverSpawn::ProcessParticleEvents(FParticleEmitterInstance* Owner, const FParticleEventBatch& InEvents, float DeltaTime)
+{
+	if (!bUsePSysLocation || bInheritVelocity)
+	{
+		Super::ProcessParticleEvents(Owner, InEvents, DeltaTime);
+		return;
+	}
+
+	// Every particle spawns at the system location without velocity, spawn them all at once.
+	int32 TotalCount = 0;
+	for (int32 EventIndex = 0; EventIndex < InEvents.Num(); EventIndex++)
+	{
+		const FParticleEventData& Event = InEvents[EventIndex];
+		if (IsEventOfInterest(Event))
+		{
+			TotalCount += FMath::Max(GetSpawnCount(Event), 0);
+		}
+	}
+
+	if (TotalCount > 0)
+	{
+		FVector SpawnLocation = Owner->Location;
+		FVector Velocity = FVector::ZeroVector;
+		Owner->ForceSpawn(DeltaTime, 0, TotalCount, SpawnLocation, Velocity);
+	}
+}
@@ -213,8 +213,7 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
 		return;
 	}
 	const FRawDistribution* FastDistribution = LifeMultiplier.GetFastRawDistribution();
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride));
-	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+	PREFETCH_FIRST_UPDATE_PARTICLE(Owner);
 	if (MultiplyX && MultiplyY && MultiplyZ)
 	{
 		if (FastDistribution)
@@ -223,23 +222,17 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
 			// fast path
 			BEGIN_UPDATE_LOOP;
 				FastDistribution->GetValue3None(Particle.RelativeTime, &SizeScale.X);
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-				Particle.Size.X *= SizeScale.X;
-				Particle.Size.Y *= SizeScale.Y;
-				Particle.Size.Z *= SizeScale.Z;
+				PREFETCH_NEXT_UPDATE_PARTICLE;
+				Particle_MultiplyRowXYZ(Particle.Size, VectorLoadFloat3_W0(&SizeScale));
 			END_UPDATE_LOOP;
 		}
 		else
 		{
 			BEGIN_UPDATE_LOOP
 			{
-				FVector SizeScale = LifeMultiplier.GetValue(Particle.RelativeTime, Owner->Component);
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-				Particle.Size.X *= SizeScale.X;
-				Particle.Size.Y *= SizeScale.Y;
-				Particle.Size.Z *= SizeScale.Z;
+				FVector SizeScale = LifeMultiplier.GetValueFast(FastDistribution, Particle.RelativeTime, Owner->Component);
+				PREFETCH_NEXT_UPDATE_PARTICLE;
+				Particle_MultiplyRowXYZ(Particle.Size, VectorLoadFloat3_W0(&SizeScale));
 			}
 			END_UPDATE_LOOP;
 		}
@@ -255,9 +248,8 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
 			int32 Index = MultiplyX ? 0 : (MultiplyY ? 1 : 2);
 			BEGIN_UPDATE_LOOP
 			{
-				FVector SizeScale = LifeMultiplier.GetValue(Particle.RelativeTime, Owner->Component);
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+				FVector SizeScale = LifeMultiplier.GetValueFast(FastDistribution, Particle.RelativeTime, Owner->Component);
+				PREFETCH_NEXT_UPDATE_PARTICLE;
 				Particle.Size[Index] *= SizeScale[Index];
 			}
 			END_UPDATE_LOOP;
@@ -266,9 +258,8 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
 		{
 			BEGIN_UPDATE_LOOP
 			{
-				FVector SizeScale = LifeMultiplier.GetValue(Particle.RelativeTime, Owner->Component);
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+				FVector SizeScale = LifeMultiplier.GetValueFast(FastDistribution, Particle.RelativeTime, Owner->Component);
+				PREFETCH_NEXT_UPDATE_PARTICLE;
 				if(MultiplyX)
 				{
 					Particle.Size.X *= SizeScale.X;
@@ -374,8 +365,9 @@ void UParticleModuleSizeScale::Spawn(FParticleEmitterInstance* Owner, int32 Offs
 
 void UParticleModuleSizeScale::Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime)
 {
+	const FRawDistribution* FastSizeScale = SizeScale.GetFastRawDistribution();
 	BEGIN_UPDATE_LOOP;
-		FVector ScaleFactor = SizeScale.GetValue(Particle.RelativeTime, Owner->Component);
+		FVector ScaleFactor = SizeScale.GetValueFast(FastSizeScale, Particle.RelativeTime, Owner->Component);
 		Particle.Size = GetParticleBaseSize(Particle) * ScaleFactor;
 	END_UPDATE_LOOP;
 }
@@ -252,6 +252,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 	check(Owner && Owner->Component);
 	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
 	check(LODLevel);
+	const FRawDistribution* FastVelOverLife = VelOverLife.GetFastRawDistribution();
 	FVector OwnerScale(1.0f);
 	const FTransform& OwnerTM = Owner->Component->GetAsyncComponentToWorld();
 	if (bApplyOwnerScale == true)
@@ -268,7 +269,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 				const FMatrix LocalToWorld = OwnerTM.ToMatrixNoScale();
 				BEGIN_UPDATE_LOOP;
 				{
-					Vel = VelOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+					Vel = VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component);
 					Particle.Velocity = LocalToWorld.TransformVector(Vel) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
@@ -277,7 +278,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 			{
 				BEGIN_UPDATE_LOOP;
 				{
-					Particle.Velocity = VelOverLife.GetValue(Particle.RelativeTime, Owner->Component) * OwnerScale;
+					Particle.Velocity = VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
 			}
@@ -288,7 +289,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 			{
 				BEGIN_UPDATE_LOOP;
 				{
-					Particle.Velocity = VelOverLife.GetValue(Particle.RelativeTime, Owner->Component) * OwnerScale;
+					Particle.Velocity = VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
 			}
@@ -299,7 +300,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 				const FMatrix InvMat = LocalToWorld.InverseFast();
 				BEGIN_UPDATE_LOOP;
 				{
-					Vel = VelOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+					Vel = VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component);
 					Particle.Velocity = InvMat.TransformVector(Vel) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
@@ -316,7 +317,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 				const FMatrix LocalToWorld = OwnerTM.ToMatrixNoScale();
 				BEGIN_UPDATE_LOOP;
 				{
-					Vel = VelOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+					Vel = VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component);
 					Particle.Velocity *= LocalToWorld.TransformVector(Vel) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
@@ -325,7 +326,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 			{
 				BEGIN_UPDATE_LOOP;
 				{
-					Particle.Velocity *= VelOverLife.GetValue(Particle.RelativeTime, Owner->Component) * OwnerScale;
+					Particle.Velocity *= VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
 			}
@@ -336,7 +337,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 			{
 				BEGIN_UPDATE_LOOP;
 				{
-					Particle.Velocity *= VelOverLife.GetValue(Particle.RelativeTime, Owner->Component) * OwnerScale;
+					Particle.Velocity *= VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
 			}
@@ -347,7 +348,7 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 				const FMatrix InvMat = LocalToWorld.InverseFast();
 				BEGIN_UPDATE_LOOP;
 				{
-					Vel = VelOverLife.GetValue(Particle.RelativeTime, Owner->Component);
+					Vel = VelOverLife.GetValueFast(FastVelOverLife, Particle.RelativeTime, Owner->Component);
 					Particle.Velocity *= InvMat.TransformVector(Vel) * OwnerScale;
 				}
 				END_UPDATE_LOOP;
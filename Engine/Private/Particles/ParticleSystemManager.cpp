@@ -32,6 +32,14 @@ FAutoConsoleVariableRef CVarParticleManagerAsyncBatchSize(
 	ECVF_Scalability
 );
 
+int32 GbParticleManagerBatchByTemplate = 1;
+FAutoConsoleVariableRef CVarParticleManagerBatchByTemplate(
+	TEXT("fx.PSCMan.BatchByTemplate"),
+	GbParticleManagerBatchByTemplate,
+	TEXT("If > 0, PSCs ticked concurrently are grouped by template so each async task ticks instances of the same systems."),
+	ECVF_Scalability
+);
+
 //////////////////////////////////////////////////////////////////////////
 
 class FParticleManagerFinalizeTask
@@ -544,6 +552,7 @@ void FParticleSystemWorldManager::ProcessTickList(float DeltaTime, ELevelTick Ti
 	FTickList& TickList = TickLists[(int32)TickGroup];
 
 	TArray<int32, TInlineAllocator<32>> ToDefer;
+	TArray<int32, TInlineAllocator<64>> ToTickAsync;
 	for (int32 Handle : TickList.Get())
 	{
 		UParticleSystemComponent* PSC = ManagedPSCs[Handle];
@@ -576,7 +585,7 @@ void FParticleSystemWorldManager::ProcessTickList(float DeltaTime, ELevelTick Ti
 				{
 					PSC->TickComponent(DeltaTime * TimeDilation, TickType, nullptr);
 					PSC->MarshalParamsForAsyncTick();
-					QueueAsyncTick(Handle, TickGroupCompletionGraphEvent);
+					ToTickAsync.Add(Handle);
 				}
 				else
 				{
@@ -615,6 +624,19 @@ void FParticleSystemWorldManager::ProcessTickList(float DeltaTime, ELevelTick Ti
 
 	if (bAsync)
 	{
+		if (GbParticleManagerBatchByTemplate)
+		{
+			// Instances of the same system then share batches, so a task runs the same emitters and modules back to back.
+			ToTickAsync.StableSort([this](int32 HandleA, int32 HandleB)
+			{
+				return (UPTRINT)ManagedPSCs[HandleA]->Template < (UPTRINT)ManagedPSCs[HandleB]->Template;
+			});
+		}
+
+		for (int32 Handle : ToTickAsync)
+		{
+			QueueAsyncTick(Handle, TickGroupCompletionGraphEvent);
+		}
 		FlushAsyncTicks(TickGroupCompletionGraphEvent);
 	}
 }
@@ -2602,7 +2602,11 @@ void FDynamicBeam2EmitterData::DoBufferFill(FAsyncBufferFillData& Me) const
 	}
 
 	FillIndexData(Me);
+	DoVertexBufferFill(Me);
+}
 
+void FDynamicBeam2EmitterData::DoVertexBufferFill(FAsyncBufferFillData& Me) const
+{
 	if (Source.bLowFreqNoise_Enabled)
 	{
 		FillData_Noise(Me);
@@ -2696,7 +2700,25 @@ void FDynamicBeam2EmitterData::GetDynamicMeshElementsEmitter(const FParticleSyst
 	BuildViewFillData(Proxy, View, Source.VertexCount, sizeof(FParticleBeamTrailVertex), 0, 
 		Collector.GetDynamicIndexBuffer(), Collector.GetDynamicVertexBuffer(), 
 		DynamicVertexAllocation, DynamicIndexAllocation, &DynamicParameterAllocation, Data);
-	DoBufferFill(Data);
+	if (Collector.ShouldUseTasks())
+	{
+		// The triangle count comes from the indices, only the vertices can be filled along with the other tasks of the collector
+		if (Data.VertexCount > 0 && Data.IndexCount > 0 && Data.VertexData && Data.IndexData)
+		{
+			FillIndexData(Data);
+			Collector.AddTask(
+				[this, Data]() mutable
+				{
+					SCOPE_CYCLE_COUNTER(STAT_ParticlesOverview_RT_CNC);
+					DoVertexBufferFill(Data);
+				}
+			);
+		}
+	}
+	else
+	{
+		DoBufferFill(Data);
+	}
 		OutTriangleCount = Data.OutTriangleCount;
 
 	if (Source.bUseLocalSpace == false)
@@ -5471,11 +5493,28 @@ void FDynamicTrailsEmitterData::GetDynamicMeshElementsEmitter(const FParticleSys
 	const int32 VertexStride = GetDynamicVertexStride(ViewFamily.GetFeatureLevel());
 	const int32 DynamicParameterVertexStride = bUsesDynamicParameter ? GetDynamicParameterVertexStride() : 0;
 
-	DoBufferFill(Data);
 	BuildViewFillData(Proxy, View, SourcePointer->VertexCount, VertexStride, DynamicParameterVertexStride, 
 		Collector.GetDynamicIndexBuffer(), Collector.GetDynamicVertexBuffer(), 
 		DynamicVertexAllocation, DynamicIndexAllocation, &DynamicParameterAllocation, Data);
-	DoBufferFill(Data);
+	if (Collector.ShouldUseTasks())
+	{
+		// The triangle count comes from the indices, only the vertices can be filled along with the other tasks of the collector
+		if (Data.VertexCount > 0 && Data.IndexCount > 0 && Data.VertexData && Data.IndexData)
+		{
+			FillIndexData(Data);
+			Collector.AddTask(
+				[this, Data]() mutable
+				{
+					SCOPE_CYCLE_COUNTER(STAT_ParticlesOverview_RT_CNC);
+					FillVertexData(Data);
+				}
+			);
+		}
+	}
+	else
+	{
+		DoBufferFill(Data);
+	}
 		OutTriangleCount = Data.OutTriangleCount;
 
 	if (SourcePointer->bUseLocalSpace == false)
@@ -27,8 +27,23 @@ static FAutoConsoleVariableRef ParticleSystemPoolingCleanTime(
 	TEXT("How often should the pool be cleaned (in seconds).")
 );
 
+static int32 GParticleSystemPoolMaxFreeMemoryKB = 0;
+static FAutoConsoleVariableRef ParticleSystemPoolMaxFreeMemoryKB(
+	TEXT("FX.ParticleSystemPool.MaxFreeMemoryKB"),
+	GParticleSystemPoolMaxFreeMemoryKB,
+	TEXT("Memory budget for the free components pooled for each particle system, in KB. The least recently used components are destroyed past it. 0 means no budget.")
+);
+
+static int32 GbParticleSystemPoolPrewarm = 1;
+static FAutoConsoleVariableRef ParticleSystemPoolPrewarm(
+	TEXT("FX.ParticleSystemPool.Prewarm"),
+	GbParticleSystemPoolPrewarm,
+	TEXT("If > 0, components are pre-allocated for the particle systems listed in the world settings when a level is brought up for play.")
+);
+
 FPSCPool::FPSCPool()
 	: MaxUsed(0)
+	, FreeMemoryUsage(0)
 {
 
 }
@@ -73,6 +88,19 @@ void FPSCPool::Cleanup()
 	FreeElements.Empty();
 	InUseComponents_Auto.Empty();
 	InUseComponents_Manual.Empty();
+	FreeMemoryUsage = 0;
+}
+
+UParticleSystemComponent* FPSCPool::CreateComponent(UWorld* World, UParticleSystem* Template)
+{
+	UParticleSystemComponent* PSC = NewObject<UParticleSystemComponent>(World);
+	PSC->bAutoDestroy = false;//<<< We don't auto destroy. We'll just periodically clear up the pool.
+	PSC->SecondsBeforeInactive = 0.0f;
+	PSC->bAutoActivate = false;
+	PSC->SetTemplate(Template);
+	PSC->bOverrideLODMethod = false;
+	PSC->bAllowRecycling = true;
+	return PSC;
 }
 
 UParticleSystemComponent* FPSCPool::Acquire(UWorld* World, UParticleSystem* Template, EPSCPoolMethod PoolingMethod)
@@ -84,6 +112,7 @@ UParticleSystemComponent* FPSCPool::Acquire(UWorld* World, UParticleSystem* Temp
 	if (FreeElements.Num())
 	{
 		RetElem = FreeElements.Pop(false);
+		FreeMemoryUsage -= RetElem.ApproxMemoryUsage;
 		check(RetElem.PSC->Template == Template);
 		check(!RetElem.PSC->IsPendingKill());
 
@@ -98,13 +127,7 @@ UParticleSystemComponent* FPSCPool::Acquire(UWorld* World, UParticleSystem* Temp
 	else
 	{
 		//None in the pool so create a new one.
-		RetElem.PSC = NewObject<UParticleSystemComponent>(World);
-		RetElem.PSC->bAutoDestroy = false;//<<< We don't auto destroy. We'll just periodically clear up the pool.
-		RetElem.PSC->SecondsBeforeInactive = 0.0f;
-		RetElem.PSC->bAutoActivate = false;
-		RetElem.PSC->SetTemplate(Template);
-		RetElem.PSC->bOverrideLODMethod = false;
-		RetElem.PSC->bAllowRecycling = true;
+		RetElem.PSC = CreateComponent(World, Template);
 	}
 
 	RetElem.PSC->PoolingMethod = PoolingMethod;
@@ -183,7 +206,10 @@ void FPSCPool::Reclaim(UParticleSystemComponent* PSC, const float CurrentTimeSec
 		PSC->SetCullDistance(FLT_MAX);
 
 		PSC->PoolingMethod = EPSCPoolMethod::FreeInPool;
-		FreeElements.Push(FPSCPoolElem(PSC, CurrentTimeSeconds));
+		const uint32 ApproxMemoryUsage = GParticleSystemPoolMaxFreeMemoryKB > 0 ? PSC->GetApproxMemoryUsage() : 0;
+		FreeElements.Push(FPSCPoolElem(PSC, CurrentTimeSeconds, ApproxMemoryUsage));
+		FreeMemoryUsage += ApproxMemoryUsage;
+		TrimToMemoryBudget();
 	}
 	else
 	{
@@ -195,24 +221,15 @@ void FPSCPool::Reclaim(UParticleSystemComponent* PSC, const float CurrentTimeSec
 
 void FPSCPool::KillUnusedComponents(float KillTime, UParticleSystem* Template)
 {
+	//Free elements are ordered by use so the unused ones are all at the front.
 	int32 i = 0;
-	while (i < FreeElements.Num())
+	while (i < FreeElements.Num() && FreeElements[i].LastUsedTime < KillTime)
 	{
-		if (FreeElements[i].LastUsedTime < KillTime)
-		{
-			UParticleSystemComponent* PSC = FreeElements[i].PSC;
-			if (PSC)
-			{
-				PSC->PoolingMethod = EPSCPoolMethod::None;//Reset so we don't trigger warnings about destroying pooled PSCs.
-				PSC->DestroyComponent();
-			}
-
-			FreeElements.RemoveAtSwap(i, 1, false);
-		}
-		else
-		{
-			++i;
-		}
+		++i;
+	}
+	while (i > 0)
+	{
+		DestroyFreeElement(--i);
 	}
 	FreeElements.Shrink();
 
@@ -250,6 +267,56 @@ void FPSCPool::KillUnusedComponents(float KillTime, UParticleSystem* Template)
 #endif
 }
 
+void FPSCPool::Prewarm(UWorld* World, UParticleSystem* Template, int32 NumComponents, const float CurrentTimeSeconds)
+{
+	check(GbEnableParticleSystemPooling);
+
+	NumComponents = FMath::Min(NumComponents, (int32)Template->MaxPoolSize);
+	while (FreeElements.Num() < NumComponents)
+	{
+		UParticleSystemComponent* PSC = CreateComponent(World, Template);
+
+		// Allocate the emitter instances up front. bAllowRecycling keeps them alive through the unregister.
+		PSC->RegisterComponentWithWorld(World);
+		PSC->InitializeSystem();
+		PSC->UnregisterComponent();
+
+		PSC->PoolingMethod = EPSCPoolMethod::FreeInPool;
+		const uint32 ApproxMemoryUsage = GParticleSystemPoolMaxFreeMemoryKB > 0 ? PSC->GetApproxMemoryUsage() : 0;
+		FreeElements.Push(FPSCPoolElem(PSC, CurrentTimeSeconds, ApproxMemoryUsage));
+		FreeMemoryUsage += ApproxMemoryUsage;
+	}
+	TrimToMemoryBudget();
+}
+
+void FPSCPool::TrimToMemoryBudget()
+{
+	if (GParticleSystemPoolMaxFreeMemoryKB <= 0)
+	{
+		return;
+	}
+
+	// Always keep the most recently used component so a budget smaller than a single component doesn't disable pooling.
+	const uint32 MaxFreeMemory = (uint32)GParticleSystemPoolMaxFreeMemoryKB * 1024;
+	while (FreeMemoryUsage > MaxFreeMemory && FreeElements.Num() > 1)
+	{
+		DestroyFreeElement(0);
+	}
+}
+
+void FPSCPool::DestroyFreeElement(int32 Index)
+{
+	UParticleSystemComponent* PSC = FreeElements[Index].PSC;
+	if (PSC)
+	{
+		PSC->PoolingMethod = EPSCPoolMethod::None;//Reset so we don't trigger warnings about destroying pooled PSCs.
+		PSC->DestroyComponent();
+	}
+
+	FreeMemoryUsage -= FreeElements[Index].ApproxMemoryUsage;
+	FreeElements.RemoveAt(Index, 1, false);
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 FWorldPSCPool::FWorldPSCPool()
@@ -389,6 +456,26 @@ void FWorldPSCPool::ReclaimActiveParticleSystems()
 	}
 }
 
+void FWorldPSCPool::PrewarmPools(UWorld* World, TArrayView<const FPSCPoolPrewarmEntry> Entries)
+{
+	check(IsInGameThread());
+	check(World);
+
+	if (GbEnableParticleSystemPooling == 0 || GbParticleSystemPoolPrewarm == 0 || World->bIsTearingDown || IsRunningDedicatedServer())
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+	for (const FPSCPoolPrewarmEntry& Entry : Entries)
+	{
+		if (Entry.System && Entry.System->CanBePooled())
+		{
+			WorldParticleSystemPools.FindOrAdd(Entry.System).Prewarm(World, Entry.System, Entry.NumComponents, CurrentTime);
+		}
+	}
+}
+
 void FWorldPSCPool::Dump()
 {
 #if ENABLE_PSC_POOL_DEBUGGING
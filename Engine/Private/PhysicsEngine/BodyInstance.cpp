@@ -24,6 +24,8 @@
 #include "PhysicsEngine/SphylElem.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "HAL/LowLevelMemTracker.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 #include "HAL/IConsoleManager.h"
 #include "Logging/TokenizedMessage.h"
 #include "Logging/MessageLog.h"
@@ -66,6 +68,7 @@ DECLARE_CYCLE_STAT(TEXT("Init Body Scene Interaction"), STAT_InitBodySceneIntera
 DECLARE_CYCLE_STAT(TEXT("Init Body Aggregate"), STAT_InitBodyAggregate, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Init Body Add"), STAT_InitBodyAdd, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Init Body Post Add to Scene"), STAT_InitBodyPostAdd, STATGROUP_Physics);
+DECLARE_CYCLE_STAT(TEXT("Init Bodies Batch"), STAT_InitBodiesBatch, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Term Body"), STAT_TermBody, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Update Materials"), STAT_UpdatePhysMats, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Update Materials Scene Interaction"), STAT_UpdatePhysMatsSceneInteraction, STATGROUP_Physics);
@@ -98,6 +101,15 @@ FAutoConsoleVariableRef CVarEnableDeferredPhysicsCreation(
 	ECVF_Default
 );
 
+// Shape and actor creation only touches objects that are not in a scene yet, which PhysX allows from any thread
+static int32 GParallelInitBodiesMinBatchSize = PHYSICS_INTERFACE_PHYSX ? 16 : 0;
+FAutoConsoleVariableRef CVarParallelInitBodiesMinBatchSize(
+	TEXT("p.ParallelInitBodiesMinBatchSize"),
+	GParallelInitBodiesMinBatchSize,
+	TEXT("Minimum number of bodies initialized together (instanced meshes, ragdolls, FScopedBodyInstanceInitBatch) for their shapes and actors to be created on worker threads. 0 creates them on the calling thread."),
+	ECVF_Default
+);
+
 TAutoConsoleVariable<int32> CVarIgnoreAnalyticCollisionsOverride(
 	TEXT("p.IgnoreAnalyticCollisionsOverride"), 
 	0, 
@@ -1089,7 +1101,7 @@ bool FInitBodiesHelperBase::CreateShapes_AssumesLocked(FBodyInstance* Instance)
 	BodySetup->AddShapesToRigidActor_AssumesLocked(Instance, Instance->Scale3D, SimplePhysMat, ComplexPhysMats, ComplexPhysMatMasks, BodyCollisionData, FTransform::Identity);
 
 #if WITH_CHAOS
-	FPhysicsInterface::SetIgnoreAnalyticCollisions_AssumesLocked(Instance->ActorHandle, CVarIgnoreAnalyticCollisionsOverride.GetValueOnGameThread() ? true : Instance->bIgnoreAnalyticCollisions);
+	FPhysicsInterface::SetIgnoreAnalyticCollisions_AssumesLocked(Instance->ActorHandle, CVarIgnoreAnalyticCollisionsOverride.GetValueOnAnyThread() ? true : Instance->bIgnoreAnalyticCollisions);
 #endif
 
 	const int32 NumShapes = FPhysicsInterface::GetNumShapes(Instance->ActorHandle);
@@ -1098,12 +1110,8 @@ bool FInitBodiesHelperBase::CreateShapes_AssumesLocked(FBodyInstance* Instance)
 	return bInitFail;
 }
 
-// Takes actor ref arrays.
-// #PHYS2 this used to return arrays of low-level physics bodies, which would be added to scene in InitBodies. Should it still do that, rather then later iterate over BodyInstances to get phys actor refs?
-bool FInitBodiesHelperBase::CreateShapesAndActors()
+bool FInitBodiesHelperBase::PrepareBodies()
 {
-	SCOPE_CYCLE_COUNTER(STAT_CreatePhysicsShapesAndActors);
-
 	const int32 NumBodies = Bodies.Num();
 
 	// Ensure we have the AggGeom inside the body setup so we can calculate the number of shapes
@@ -1171,10 +1179,52 @@ bool FInitBodiesHelperBase::CreateShapesAndActors()
 
 		// Init user data structure to point back at this instance
 		Instance->PhysicsUserData = FPhysicsUserData(Instance);
+	}
 
-		CreateActor_AssumesLocked(Instance, Transform);
-		const bool bInitFail = CreateShapes_AssumesLocked(Instance);
-		if (bInitFail)
+	// Physics materials are created the first time they are used, which must not happen on several worker threads at once.
+	// Bodies of one helper share their component and body setup, so they use the same materials.
+	if (Bodies.Num() > 0)
+	{
+		FBodyInstance* Instance = Bodies[0];
+		if (UPhysicalMaterial* SimplePhysMat = Instance->GetSimplePhysicalMaterial())
+		{
+			SimplePhysMat->GetPhysicsMaterial();
+		}
+
+#if WITH_CHAOS
+		TArray<FPhysicalMaterialMaskParams> ComplexPhysMatMasks;
+		TArray<UPhysicalMaterial*> ComplexPhysMats = Instance->GetComplexPhysicalMaterials(ComplexPhysMatMasks);
+#else
+		TArray<UPhysicalMaterial*> ComplexPhysMats = Instance->GetComplexPhysicalMaterials();
+#endif
+		for (UPhysicalMaterial* ComplexPhysMat : ComplexPhysMats)
+		{
+			if (ComplexPhysMat)
+			{
+				ComplexPhysMat->GetPhysicsMaterial();
+			}
+		}
+	}
+
+	BodyInitFailed.Reset();
+	BodyInitFailed.SetNumZeroed(Bodies.Num());
+	return true;
+}
+
+void FInitBodiesHelperBase::CreateBody(int32 BodyIdx)
+{
+	FBodyInstance* Instance = Bodies[BodyIdx];
+
+	CreateActor_AssumesLocked(Instance, Transforms[BodyIdx]);
+	BodyInitFailed[BodyIdx] = CreateShapes_AssumesLocked(Instance);
+}
+
+void FInitBodiesHelperBase::FinishBodies()
+{
+	for (int32 BodyIdx = Bodies.Num() - 1; BodyIdx >= 0; BodyIdx--)
+	{
+		FBodyInstance* Instance = Bodies[BodyIdx];
+		if (BodyInitFailed[BodyIdx])
 		{
 #if WITH_EDITOR
 			//In the editor we may have ended up here because of world trace ignoring our EnableCollision. Since we can't get at the data in that function we check for it here
@@ -1195,116 +1245,149 @@ bool FInitBodiesHelperBase::CreateShapesAndActors()
 
 		FPhysicsInterface::SetActorUserData_AssumesLocked(Instance->ActorHandle, &Instance->PhysicsUserData);
 	}
-	return true;
 }
 
-void FInitBodiesHelperBase::InitBodies()
+// Takes actor ref arrays.
+// #PHYS2 this used to return arrays of low-level physics bodies, which would be added to scene in InitBodies. Should it still do that, rather then later iterate over BodyInstances to get phys actor refs?
+bool FInitBodiesHelperBase::CreateShapesAndActors()
 {
-#if WITH_CHAOS
-	LLM_SCOPE(ELLMTag::Chaos);
-#else
-	LLM_SCOPE(ELLMTag::PhysX);
-#endif
+	SCOPE_CYCLE_COUNTER(STAT_CreatePhysicsShapesAndActors);
 
-	//check(IsInGameThread());
+	if (!PrepareBodies())
+	{
+		return false;
+	}
 
-	if (CreateShapesAndActors())
+	// Actors and shapes are created outside of the scene, so large batches such as instanced meshes are created in parallel
+	const int32 NumBodies = Bodies.Num();
+	ParallelFor(NumBodies, [this](int32 BodyIdx)
 	{
-		FPhysicsCommand::ExecuteWrite(PhysScene, [&]()
+		CreateBody(BodyIdx);
+	}, ShouldCreateBodiesInParallel(NumBodies) ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	FinishBodies();
+	return true;
+}
+
+void FInitBodiesHelperBase::CollectActorsToAdd_AssumesLocked(TArray<FPhysicsActorHandle>& OutActorHandles)
+{
+	// If an aggregate present, add to that
+	if (Aggregate.IsValid())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InitBodyAggregate);
+		for (FBodyInstance* BI : Bodies)
 		{
-			// If an aggregate present, add to that
-			if (Aggregate.IsValid())
+			const FPhysicsActorHandle& ActorHandle = BI->GetPhysicsActorHandle();
+			if (FPhysicsInterface::IsValid(ActorHandle))
 			{
-				SCOPE_CYCLE_COUNTER(STAT_InitBodyAggregate);
-				for (FBodyInstance* BI : Bodies)
-				{
-					const FPhysicsActorHandle& ActorHandle = BI->GetPhysicsActorHandle();
-					if (FPhysicsInterface::IsValid(ActorHandle))
-					{
-						FPhysicsInterface::AddActorToAggregate_AssumesLocked(Aggregate, ActorHandle);
-					}
-				}
+				FPhysicsInterface::AddActorToAggregate_AssumesLocked(Aggregate, ActorHandle);
 			}
-			else if (PhysScene)
-			{
-				SCOPE_CYCLE_COUNTER(STAT_InitBodyAdd);
-				TArray<FPhysicsActorHandle> ActorHandles;
-				ActorHandles.Reserve(Bodies.Num());
+		}
+	}
+	else if (PhysScene)
+	{
+		OutActorHandles.Reserve(OutActorHandles.Num() + Bodies.Num());
 
-				for (FBodyInstance* BI : Bodies)
-				{
-					FPhysicsActorHandle& ActorHandle = BI->GetPhysicsActorHandle();
-					if (FPhysicsInterface::IsValid(ActorHandle))
-					{
-						ActorHandles.Add(ActorHandle);
+		for (FBodyInstance* BI : Bodies)
+		{
+			FPhysicsActorHandle& ActorHandle = BI->GetPhysicsActorHandle();
+			if (FPhysicsInterface::IsValid(ActorHandle))
+			{
+				OutActorHandles.Add(ActorHandle);
 
 #if WITH_CHAOS
-							const int32 NumShapes = FPhysicsInterface::GetNumShapes(ActorHandle);
-
-							// If this shape shouldn't collide in the sim we disable it here until we support
-							// a separation of unions for these shapes
-							if(BI->GetCollisionEnabled() == ECollisionEnabled::QueryOnly || BI->GetCollisionEnabled() == ECollisionEnabled::NoCollision)
-							{
-								for(int32 ShapeIndex = 0; ShapeIndex < NumShapes; ++ShapeIndex)
-								{
-									ActorHandle->SetShapeCollisionDisable(ShapeIndex, true);
-								}
-							}
-							if (BI->BodySetup.IsValid())
-							{
-								for (int32 ShapeIndex = 0; ShapeIndex < NumShapes; ++ShapeIndex)
-								{
-									ActorHandle->SetShapeCollisionTraceType(ShapeIndex, ChaosInterface::ConvertCollisionTraceFlag(BI->BodySetup->CollisionTraceFlag)) ;
-								}
-							}
+				const int32 NumShapes = FPhysicsInterface::GetNumShapes(ActorHandle);
 
-#endif
-/*
-						With the implementation of AddActorsToScene_AssumesLocked,
-						this call duplicates the AddToSolver operation and is not necessary
-#ifdef WITH_CHAOS
-						if (BI->bSimulatePhysics)
-						{
-							PhysScene->AddActorToSolver(ActorHandle);
-						}
-#endif
-*/
-					}
-				}
-
-				PhysScene->AddActorsToScene_AssumesLocked(ActorHandles);
-#if WITH_CHAOS
-				for (FBodyInstance* BI : Bodies)
+				// If this shape shouldn't collide in the sim we disable it here until we support
+				// a separation of unions for these shapes
+				if(BI->GetCollisionEnabled() == ECollisionEnabled::QueryOnly || BI->GetCollisionEnabled() == ECollisionEnabled::NoCollision)
 				{
-					FPhysicsActorHandle& ActorHandle = BI->GetPhysicsActorHandle();
-					if (FPhysicsInterface::IsValid(ActorHandle))
+					for(int32 ShapeIndex = 0; ShapeIndex < NumShapes; ++ShapeIndex)
 					{
-
-						PhysScene->AddToComponentMaps(BI->OwnerComponent.Get(), ActorHandle->Proxy);
+						ActorHandle->SetShapeCollisionDisable(ShapeIndex, true);
 					}
-					if (BI->bNotifyRigidBodyCollision)
+				}
+				if (BI->BodySetup.IsValid())
+				{
+					for (int32 ShapeIndex = 0; ShapeIndex < NumShapes; ++ShapeIndex)
 					{
-						if (UPrimitiveComponent* PrimComp = BI->OwnerComponent.Get())
-						{
-							FPhysScene_ChaosInterface* LocalPhysScene = PrimComp->GetWorld()->GetPhysicsScene();
-							FPhysScene_Chaos& Scene = LocalPhysScene->GetScene();
-							Scene.RegisterForCollisionEvents(PrimComp);
-						}
+						ActorHandle->SetShapeCollisionTraceType(ShapeIndex, ChaosInterface::ConvertCollisionTraceFlag(BI->BodySetup->CollisionTraceFlag)) ;
 					}
 				}
+
 #endif
 			}
+		}
+	}
+}
 
-			// Set up dynamic instance data
-			if (!IsStatic())
+void FInitBodiesHelperBase::PostAddToScene_AssumesLocked()
+{
+	if (!Aggregate.IsValid() && PhysScene)
+	{
+#if WITH_CHAOS
+		for (FBodyInstance* BI : Bodies)
+		{
+			FPhysicsActorHandle& ActorHandle = BI->GetPhysicsActorHandle();
+			if (FPhysicsInterface::IsValid(ActorHandle))
 			{
-				SCOPE_CYCLE_COUNTER(STAT_InitBodyPostAdd);
-				for (int32 BodyIdx = 0, NumBodies = Bodies.Num(); BodyIdx < NumBodies; ++BodyIdx)
+
+				PhysScene->AddToComponentMaps(BI->OwnerComponent.Get(), ActorHandle->Proxy);
+			}
+			if (BI->bNotifyRigidBodyCollision)
+			{
+				if (UPrimitiveComponent* PrimComp = BI->OwnerComponent.Get())
 				{
-					FBodyInstance* Instance = Bodies[BodyIdx];
-					Instance->InitDynamicProperties_AssumesLocked();
+					FPhysScene_ChaosInterface* LocalPhysScene = PrimComp->GetWorld()->GetPhysicsScene();
+					FPhysScene_Chaos& Scene = LocalPhysScene->GetScene();
+					Scene.RegisterForCollisionEvents(PrimComp);
 				}
 			}
+		}
+#endif
+	}
+
+	// Set up dynamic instance data
+	if (!IsStatic())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InitBodyPostAdd);
+		for (int32 BodyIdx = 0, NumBodies = Bodies.Num(); BodyIdx < NumBodies; ++BodyIdx)
+		{
+			FBodyInstance* Instance = Bodies[BodyIdx];
+			Instance->InitDynamicProperties_AssumesLocked();
+		}
+	}
+}
+
+bool FInitBodiesHelperBase::ShouldCreateBodiesInParallel(int32 NumBodies)
+{
+	return GParallelInitBodiesMinBatchSize > 0 && NumBodies >= GParallelInitBodiesMinBatchSize && FApp::ShouldUseThreadingForPerformance();
+}
+
+void FInitBodiesHelperBase::InitBodies()
+{
+#if WITH_CHAOS
+	LLM_SCOPE(ELLMTag::Chaos);
+#else
+	LLM_SCOPE(ELLMTag::PhysX);
+#endif
+
+	//check(IsInGameThread());
+
+	if (CreateShapesAndActors())
+	{
+		FPhysicsCommand::ExecuteWrite(PhysScene, [&]()
+		{
+			TArray<FPhysicsActorHandle> ActorHandles;
+			CollectActorsToAdd_AssumesLocked(ActorHandles);
+
+			if (!Aggregate.IsValid() && PhysScene)
+			{
+				SCOPE_CYCLE_COUNTER(STAT_InitBodyAdd);
+				PhysScene->AddActorsToScene_AssumesLocked(ActorHandles);
+			}
+
+			PostAddToScene_AssumesLocked();
 		});
 	}
 }
@@ -1348,6 +1431,14 @@ void FBodyInstance::InitBody(class UBodySetup* Setup, const FTransform& Transfor
 	check(Bodies.Num() == 0);
 	check(Transforms.Num() == 0);
 
+	if (FScopedBodyInstanceInitBatch* Batch = FScopedBodyInstanceInitBatch::GetCurrent())
+	{
+		if (Batch->TryAdd(this, Transform, Setup, PrimComp, InRBScene, SpawnParams))
+		{
+			return;
+		}
+	}
+
 	Bodies.Add(this);
 	Transforms.Add(Transform);
 
@@ -1383,6 +1474,220 @@ void FBodyInstance::InitBody(class UBodySetup* Setup, const FTransform& Transfor
 	UpdateInterpolateWhenSubStepping();
 }
 
+struct FScopedBodyInstanceInitBatch::FPendingBodies
+{
+	FPendingBodies(FBodyInstance* Body, const FTransform& Transform, UBodySetup* Setup, UPrimitiveComponent* PrimComp, FPhysScene* InRBScene, const FInitBodySpawnParams& InSpawnParams)
+	: SpawnParams(InSpawnParams)
+	, Helper(nullptr)
+	{
+		Bodies.Add(Body);
+		Transforms.Add(Transform);
+
+		// The helper keeps references to the arrays and spawn params, which is why they are owned here
+		if (SpawnParams.bStaticPhysics)
+		{
+			StaticHelper = MakeUnique<FInitBodiesHelper<true>>(Bodies, Transforms, Setup, PrimComp, InRBScene, SpawnParams, SpawnParams.Aggregate);
+			Helper = StaticHelper.Get();
+		}
+		else
+		{
+			DynamicHelper = MakeUnique<FInitBodiesHelper<false>>(Bodies, Transforms, Setup, PrimComp, InRBScene, SpawnParams, SpawnParams.Aggregate);
+			Helper = DynamicHelper.Get();
+		}
+	}
+
+	TArray<FBodyInstance*> Bodies;
+	TArray<FTransform> Transforms;
+	FInitBodySpawnParams SpawnParams;
+
+	TUniquePtr<FInitBodiesHelper<true>> StaticHelper;
+	TUniquePtr<FInitBodiesHelper<false>> DynamicHelper;
+	FInitBodiesHelperBase* Helper;
+
+	/** Set once the helper prepared the bodies and they need to be created and added to the scene */
+	bool bPrepared = false;
+};
+
+static FScopedBodyInstanceInitBatch* GCurrentBodyInstanceInitBatch = nullptr;
+
+FScopedBodyInstanceInitBatch::FScopedBodyInstanceInitBatch(bool bInBatchDynamicBodies)
+	: OuterBatch(nullptr)
+	, bBatchDynamicBodies(bInBatchDynamicBodies)
+{
+	// Bodies initialized from other threads are never batched
+	if (IsInGameThread())
+	{
+		OuterBatch = GCurrentBodyInstanceInitBatch;
+		GCurrentBodyInstanceInitBatch = this;
+	}
+}
+
+FScopedBodyInstanceInitBatch::~FScopedBodyInstanceInitBatch()
+{
+	if (GCurrentBodyInstanceInitBatch == this)
+	{
+		GCurrentBodyInstanceInitBatch = OuterBatch;
+	}
+
+	Flush();
+}
+
+FScopedBodyInstanceInitBatch* FScopedBodyInstanceInitBatch::GetCurrent()
+{
+	return IsInGameThread() ? GCurrentBodyInstanceInitBatch : nullptr;
+}
+
+bool FScopedBodyInstanceInitBatch::TryAdd(FBodyInstance* Body, const FTransform& Transform, UBodySetup* Setup, UPrimitiveComponent* PrimComp, FPhysScene* InRBScene, const FInitBodySpawnParams& SpawnParams)
+{
+	for (FScopedBodyInstanceInitBatch* Batch = this; Batch; Batch = Batch->OuterBatch)
+	{
+		if (Batch->PendingBodySet.Contains(Body))
+		{
+			// Same as initializing a body that already has an actor
+			return true;
+		}
+	}
+
+	if (!SpawnParams.bStaticPhysics)
+	{
+		if (Body->bAutoWeld)
+		{
+			// Welding needs the parent's actor, which may still be waiting in a batch
+			FlushAll();
+			return false;
+		}
+
+		if (!bBatchDynamicBodies)
+		{
+			return false;
+		}
+	}
+
+	PendingBodies.Add(MakeUnique<FPendingBodies>(Body, Transform, Setup, PrimComp, InRBScene, SpawnParams));
+	PendingBodySet.Add(Body);
+	return true;
+}
+
+void FScopedBodyInstanceInitBatch::Remove(FBodyInstance* Body)
+{
+	for (FScopedBodyInstanceInitBatch* Batch = this; Batch; Batch = Batch->OuterBatch)
+	{
+		if (Batch->PendingBodySet.Remove(Body) > 0)
+		{
+			Batch->PendingBodies.RemoveAll([Body](const TUniquePtr<FPendingBodies>& Pending) { return Pending->Bodies[0] == Body; });
+		}
+	}
+}
+
+void FScopedBodyInstanceInitBatch::FlushAll()
+{
+	for (FScopedBodyInstanceInitBatch* Batch = this; Batch; Batch = Batch->OuterBatch)
+	{
+		Batch->Flush();
+	}
+}
+
+void FScopedBodyInstanceInitBatch::Flush()
+{
+	if (PendingBodies.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_InitBodiesBatch);
+#if WITH_CHAOS
+	LLM_SCOPE(ELLMTag::Chaos);
+#else
+	LLM_SCOPE(ELLMTag::PhysX);
+#endif
+
+	// Moved out first, initializing a body may start or end another batch
+	TArray<TUniquePtr<FPendingBodies>> ToInit = MoveTemp(PendingBodies);
+	PendingBodySet.Reset();
+
+	struct FBodyToCreate
+	{
+		FInitBodiesHelperBase* Helper;
+		int32 BodyIdx;
+	};
+	TArray<FBodyToCreate> BodiesToCreate;
+	BodiesToCreate.Reserve(ToInit.Num());
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CreatePhysicsShapesAndActors);
+
+		for (TUniquePtr<FPendingBodies>& Pending : ToInit)
+		{
+			Pending->bPrepared = Pending->Helper->PrepareBodies();
+			if (Pending->bPrepared)
+			{
+				for (int32 BodyIdx = 0; BodyIdx < Pending->Helper->Bodies.Num(); ++BodyIdx)
+				{
+					BodiesToCreate.Add({ Pending->Helper, BodyIdx });
+				}
+			}
+		}
+
+		ParallelFor(BodiesToCreate.Num(), [&BodiesToCreate](int32 Index)
+		{
+			BodiesToCreate[Index].Helper->CreateBody(BodiesToCreate[Index].BodyIdx);
+		}, FInitBodiesHelperBase::ShouldCreateBodiesInParallel(BodiesToCreate.Num()) ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+		for (TUniquePtr<FPendingBodies>& Pending : ToInit)
+		{
+			if (Pending->bPrepared)
+			{
+				Pending->Helper->FinishBodies();
+			}
+		}
+	}
+
+	// One scene write and one add per scene, rather than one per body
+	ToInit.RemoveAll([](const TUniquePtr<FPendingBodies>& Pending) { return !Pending->bPrepared; });
+	ToInit.StableSort([](const TUniquePtr<FPendingBodies>& A, const TUniquePtr<FPendingBodies>& B) { return A->Helper->PhysScene < B->Helper->PhysScene; });
+
+	TArray<FPhysicsActorHandle> ActorHandles;
+	for (int32 FirstIdx = 0; FirstIdx < ToInit.Num();)
+	{
+		FPhysScene* PhysScene = ToInit[FirstIdx]->Helper->PhysScene;
+		int32 EndIdx = FirstIdx + 1;
+		while (EndIdx < ToInit.Num() && ToInit[EndIdx]->Helper->PhysScene == PhysScene)
+		{
+			++EndIdx;
+		}
+
+		FPhysicsCommand::ExecuteWrite(PhysScene, [&]()
+		{
+			ActorHandles.Reset();
+			for (int32 Idx = FirstIdx; Idx < EndIdx; ++Idx)
+			{
+				ToInit[Idx]->Helper->CollectActorsToAdd_AssumesLocked(ActorHandles);
+			}
+
+			if (PhysScene && ActorHandles.Num() > 0)
+			{
+				SCOPE_CYCLE_COUNTER(STAT_InitBodyAdd);
+				PhysScene->AddActorsToScene_AssumesLocked(ActorHandles);
+			}
+
+			for (int32 Idx = FirstIdx; Idx < EndIdx; ++Idx)
+			{
+				ToInit[Idx]->Helper->PostAddToScene_AssumesLocked();
+			}
+		});
+
+		FirstIdx = EndIdx;
+	}
+
+	for (const TUniquePtr<FPendingBodies>& Pending : ToInit)
+	{
+		for (FBodyInstance* Body : Pending->Bodies)
+		{
+			Body->UpdateInterpolateWhenSubStepping();
+		}
+	}
+}
+
 FVector GetInitialLinearVelocity(const AActor* OwningActor, bool& bComponentAwake)
 {
 	FVector InitialLinVel(EForceInit::ForceInitToZero);
@@ -1422,6 +1727,11 @@ void FBodyInstance::TermBody(bool bNeverDeferRelease)
 {
 	SCOPE_CYCLE_COUNTER(STAT_TermBody);
 
+	if (FScopedBodyInstanceInitBatch* Batch = FScopedBodyInstanceInitBatch::GetCurrent())
+	{
+		Batch->Remove(this);
+	}
+
 	if (IsValidBodyInstance())
 	{
 		FPhysicsInterface::ReleaseActor(ActorHandle, GetPhysicsScene(), bNeverDeferRelease);
@@ -2928,8 +3238,11 @@ float gPerCm3ToKgPerCm3(float gPerCm3)
 }
 
 #if WITH_PHYSX
-/** Computes and adds the mass properties (inertia, com, etc...) based on the mass settings of the body instance. */
-PxMassProperties ComputeMassProperties(const FBodyInstance* OwningBodyInstance, TArray<FPhysicsShapeHandle> Shapes, const FTransform& MassModifierTransform)
+/**
+ * Computes and adds the mass properties (inertia, com, etc...) based on the mass settings of the body instance.
+ * @param bUseBodySetupCache	Shapes are exactly the body setup's shapes at the body's scale, so the unit density mass properties the body setup cached for that scale can be used
+ */
+PxMassProperties ComputeMassProperties(const FBodyInstance* OwningBodyInstance, TArray<FPhysicsShapeHandle> Shapes, const FTransform& MassModifierTransform, bool bUseBodySetupCache = false)
 {
 	// physical material - nothing can weigh less than hydrogen (0.09 kg/m^3)
 	float DensityKGPerCubicUU = 1.0f;
@@ -2941,7 +3254,34 @@ PxMassProperties ComputeMassProperties(const FBodyInstance* OwningBodyInstance,
 	}
 
 	PxMassProperties MassProps;
-	FPhysicsInterface::CalculateMassPropertiesFromShapeCollection(MassProps, Shapes, DensityKGPerCubicUU);
+	UBodySetup* BodySetup = bUseBodySetupCache ? OwningBodyInstance->BodySetup.Get() : nullptr;
+	FBodySetupScaledMassProperties CachedMassProps;
+	if (BodySetup && BodySetup->FindScaledMassProperties(OwningBodyInstance->Scale3D, Shapes.Num(), CachedMassProps))
+	{
+		MassProps.mass = CachedMassProps.Mass;
+		MassProps.centerOfMass = U2PVector(CachedMassProps.CenterOfMass);
+		MassProps.inertiaTensor = PxMat33(U2PVector(CachedMassProps.InertiaTensor[0]), U2PVector(CachedMassProps.InertiaTensor[1]), U2PVector(CachedMassProps.InertiaTensor[2]));
+		MassProps = MassProps * DensityKGPerCubicUU;
+	}
+	else if (BodySetup)
+	{
+		// Cached at unit density, bodies sharing the setup and scale may use different physical materials
+		FPhysicsInterface::CalculateMassPropertiesFromShapeCollection(MassProps, Shapes, 1.0f);
+
+		CachedMassProps.Mass = MassProps.mass;
+		CachedMassProps.CenterOfMass = P2UVector(MassProps.centerOfMass);
+		CachedMassProps.InertiaTensor[0] = P2UVector(MassProps.inertiaTensor.column0);
+		CachedMassProps.InertiaTensor[1] = P2UVector(MassProps.inertiaTensor.column1);
+		CachedMassProps.InertiaTensor[2] = P2UVector(MassProps.inertiaTensor.column2);
+		CachedMassProps.NumShapes = Shapes.Num();
+		BodySetup->AddScaledMassProperties(OwningBodyInstance->Scale3D, CachedMassProps);
+
+		MassProps = MassProps * DensityKGPerCubicUU;
+	}
+	else
+	{
+		FPhysicsInterface::CalculateMassPropertiesFromShapeCollection(MassProps, Shapes, DensityKGPerCubicUU);
+	}
 
 	float OldMass = MassProps.mass;
 	float NewMass = 0.f;
@@ -3066,7 +3406,7 @@ void FBodyInstance::UpdateMassProperties()
 					{
 						//No children welded so just get this body's mass properties
 						FTransform MassModifierTransform(FQuat::Identity, FVector(0.f, 0.f, 0.f), Scale3D);	//Ensure that any scaling that is done on the component is passed into the mass frame modifiers
-						TotalMassProperties = ComputeMassProperties(this, Shapes, MassModifierTransform);
+						TotalMassProperties = ComputeMassProperties(this, Shapes, MassModifierTransform, /*bUseBodySetupCache=*/true);
 					}
 				}
 
@@ -4012,7 +4352,7 @@ void FBodyInstance::BuildBodyFilterData(FBodyCollisionFilterData& OutFilterData)
 	//        should configure the bodies to reflect this desired behavior.
 	if(USkeletalMeshComponent* SkelMeshComp = Cast<USkeletalMeshComponent>(OwnerComponentInst))
 	{
-		if (CVarEnableDynamicPerBodyFilterHacks.GetValueOnGameThread() && bHACK_DisableCollisionResponse)
+		if (CVarEnableDynamicPerBodyFilterHacks.GetValueOnAnyThread() && bHACK_DisableCollisionResponse)
 		{
 			UseResponse.SetAllChannels(ECR_Ignore);
 			UseCollisionEnabled = ECollisionEnabled::PhysicsOnly;
@@ -4027,7 +4367,7 @@ void FBodyInstance::BuildBodyFilterData(FBodyCollisionFilterData& OutFilterData)
 			UseCollisionEnabled = ECollisionEnabled::PhysicsOnly;		// this will prevent object traces hitting this as well
 		}
 
-		const bool bDisableSkelComponentOverride = CVarEnableDynamicPerBodyFilterHacks.GetValueOnGameThread() && bHACK_DisableSkelComponentFilterOverriding;
+		const bool bDisableSkelComponentOverride = CVarEnableDynamicPerBodyFilterHacks.GetValueOnAnyThread() && bHACK_DisableSkelComponentFilterOverriding;
 		if (bDisableSkelComponentOverride)
 		{
 			// if we are disabling the skeletal component override, we want the original body instance collision response
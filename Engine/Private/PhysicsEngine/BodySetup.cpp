@@ -153,6 +153,13 @@ ENGINE_API TAutoConsoleVariable<float> CVarMaxContactOffset(
 	TEXT("Max value of contact offset, which controls how close objects get before generating contacts. < 0 implies use project settings. Default: 1.0"),
 	ECVF_Default);
 
+static int32 GMaxScaledMassPropertiesPerBodySetup = 16;
+static FAutoConsoleVariableRef CVarMaxScaledMassPropertiesPerBodySetup(
+	TEXT("p.MaxScaledMassPropertiesPerBodySetup"),
+	GMaxScaledMassPropertiesPerBodySetup,
+	TEXT("Number of scales a body setup caches mass properties for, so that bodies sharing the setup and scale don't recompute them. 0 disables the cache."),
+	ECVF_Default);
+
 
 void FBodySetupUVInfo::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) const
 {
@@ -196,6 +203,7 @@ UBodySetup::UBodySetup(const FObjectInitializer& ObjectInitializer)
 void UBodySetup::CopyBodyPropertiesFrom(const UBodySetup* FromSetup)
 {
 	AggGeom = FromSetup->AggGeom;
+	ClearScaledMassProperties();
 
 	// clear pointers copied from other BodySetup, as 
 	for (int32 i = 0; i < AggGeom.ConvexElems.Num(); i++)
@@ -217,6 +225,8 @@ void UBodySetup::CopyBodyPropertiesFrom(const UBodySetup* FromSetup)
 
 void UBodySetup::AddCollisionFrom(const FKAggregateGeom& FromAggGeom)
 {
+	ClearScaledMassProperties();
+
 	// Add shapes from static mesh
 	AggGeom.SphereElems.Append(FromAggGeom.SphereElems);
 	AggGeom.BoxElems.Append(FromAggGeom.BoxElems);
@@ -761,6 +771,8 @@ void UBodySetup::FinishCreatingPhysicsMeshes_Chaos(FChaosDerivedDataReader<float
 
 void UBodySetup::ClearPhysicsMeshes()
 {
+	ClearScaledMassProperties();
+
 #if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX
 
 	FPhysxSharedData::LockAccess();
@@ -1714,33 +1726,14 @@ float FKConvexElem::GetVolume(const FVector& Scale) const
 #if WITH_PHYSX
 	if (ConvexMesh != NULL)
 	{
-		// Preparation for convex mesh scaling implemented in another changelist
-		FTransform ScaleTransform = FTransform(FQuat::Identity, FVector::ZeroVector, Scale);
+		// The mass of the cooked mesh at unit density is its volume. Scaling the hull scales its signed volume by the determinant of the scale,
+		// which is what summing the signed volumes of the scaled triangles gives, without going over every triangle for every scale.
+		PxReal UnitDensityMass;
+		PxMat33 LocalInertia;
+		PxVec3 LocalCenterOfMass;
+		ConvexMesh->getMassInformation(UnitDensityMass, LocalInertia, LocalCenterOfMass);
 
-		int32 NumPolys = ConvexMesh->getNbPolygons();
-		PxHullPolygon PolyData;
-
-		const PxVec3* Vertices = ConvexMesh->getVertices();
-		const PxU8* Indices = ConvexMesh->getIndexBuffer();
-
-		for (int32 PolyIdx = 0; PolyIdx < NumPolys; ++PolyIdx)
-		{
-			if (ConvexMesh->getPolygonData(PolyIdx, PolyData))
-			{
-				for (int32 VertIdx = 2; VertIdx < PolyData.mNbVerts; ++ VertIdx)
-				{
-					// Grab triangle indices that we hit
-					int32 I0 = Indices[PolyData.mIndexBase + 0];
-					int32 I1 = Indices[PolyData.mIndexBase + (VertIdx - 1)];
-					int32 I2 = Indices[PolyData.mIndexBase + VertIdx];
-
-
-					Volume += SignedVolumeOfTriangle(ScaleTransform.TransformPosition(P2UVector(Vertices[I0])), 
-						ScaleTransform.TransformPosition(P2UVector(Vertices[I1])), 
-						ScaleTransform.TransformPosition(P2UVector(Vertices[I2])));
-				}
-			}
-		}
+		Volume = UnitDensityMass * Scale.X * Scale.Y * Scale.Z;
 	}
 #endif // WITH_PHYSX
 
@@ -2203,6 +2196,36 @@ float UBodySetup::GetVolume(const FVector& Scale) const
 	return AggGeom.GetVolume(Scale);
 }
 
+bool UBodySetup::FindScaledMassProperties(const FVector& Scale3D, int32 NumShapes, FBodySetupScaledMassProperties& OutMassProperties) const
+{
+	FRWScopeLock ScopeLock(ScaledMassPropertiesLock, SLT_ReadOnly);
+
+	const FBodySetupScaledMassProperties* Found = ScaledMassProperties.Find(Scale3D);
+	if (Found && Found->NumShapes == NumShapes)
+	{
+		OutMassProperties = *Found;
+		return true;
+	}
+	return false;
+}
+
+void UBodySetup::AddScaledMassProperties(const FVector& Scale3D, const FBodySetupScaledMassProperties& MassProperties)
+{
+	FRWScopeLock ScopeLock(ScaledMassPropertiesLock, SLT_Write);
+
+	// Scales that don't fit anymore are computed by every body, as they were before the cache
+	if (ScaledMassProperties.Num() < GMaxScaledMassPropertiesPerBodySetup || ScaledMassProperties.Contains(Scale3D))
+	{
+		ScaledMassProperties.Add(Scale3D, MassProperties);
+	}
+}
+
+void UBodySetup::ClearScaledMassProperties()
+{
+	FRWScopeLock ScopeLock(ScaledMassPropertiesLock, SLT_Write);
+	ScaledMassProperties.Empty();
+}
+
 TEnumAsByte<enum ECollisionTraceFlag> UBodySetup::GetCollisionTraceFlag() const
 {
 	TEnumAsByte<enum ECollisionTraceFlag> DefaultFlag = UPhysicsSettings::Get()->DefaultShapeComplexity;
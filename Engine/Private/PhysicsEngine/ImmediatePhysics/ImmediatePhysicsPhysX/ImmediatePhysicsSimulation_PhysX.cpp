@@ -16,6 +16,9 @@
 
 #include "PhysicalMaterials/PhysicalMaterial.h"
 
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
 namespace ImmediatePhysics_PhysX
 {
 
@@ -34,6 +37,7 @@ FSimulation::FSimulation()
 	NumJointHeaders = 0;
 	NumActiveJoints = 0;
 	bDirtyJointData = false;
+	ActiveWorkspace = &Workspace;
 }
 
 FSimulation::~FSimulation()
@@ -522,6 +526,33 @@ void FSimulation::Simulate(float DeltaTime, const FVector& Gravity)
 }
 
 void FSimulation::Simulate_AssumesLocked(float DeltaTime, const FVector& Gravity)
+{
+	Simulate_AssumesLocked(DeltaTime, Gravity, Workspace);
+}
+
+DECLARE_CYCLE_STAT(TEXT("FSimulation::SimulateBatch"), STAT_ImmediateSimulateBatch, STATGROUP_ImmediatePhysics);
+
+static int32 GImmediatePhysicsParallelSimulateBatch = 1;
+static FAutoConsoleVariableRef CVarImmediatePhysicsParallelSimulateBatch(TEXT("p.ImmediatePhysics.ParallelSimulateBatch"), GImmediatePhysicsParallelSimulateBatch, TEXT("Whether FSimulation::SimulateBatch steps its simulations in parallel."), ECVF_Default);
+
+void FSimulation::SimulateBatch(TArrayView<const FSimulateBatchItem> Items)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ImmediateSimulateBatch);
+
+	// One lock for the whole batch rather than one per simulation
+	FScopedSharedResourceLock<LockMode::Read> ScopeLock;
+
+	ParallelFor(Items.Num(), [Items](int32 ItemIndex)
+	{
+		// The workspace only holds memory during a step, so every simulation stepped by this thread can reuse the same pages
+		static thread_local FLinearBlockAllocator ThreadWorkspace;
+
+		const FSimulateBatchItem& Item = Items[ItemIndex];
+		Item.Simulation->Simulate_AssumesLocked(Item.DeltaTime, Item.Gravity, ThreadWorkspace);
+	}, GImmediatePhysicsParallelSimulateBatch == 0 || Items.Num() < 2);
+}
+
+void FSimulation::Simulate_AssumesLocked(float DeltaTime, const FVector& Gravity, FLinearBlockAllocator& InWorkspace)
 {
 	SET_DWORD_STAT(STAT_IPNumSimulatedBodies, NumSimulatedBodies);
 	SET_DWORD_STAT(STAT_IPNumActiveSimulatedBodies, NumActiveSimulatedBodies);
@@ -535,6 +566,8 @@ void FSimulation::Simulate_AssumesLocked(float DeltaTime, const FVector& Gravity
 
 		++SimCount;
 
+		ActiveWorkspace = &InWorkspace;
+
 		ConstructSolverBodies(DeltaTime, Gravity);
 	
 		if(bRecreateIterationCache)
@@ -550,7 +583,8 @@ void FSimulation::Simulate_AssumesLocked(float DeltaTime, const FVector& Gravity
 
 		SolveAndIntegrate(DeltaTime);
 
-		Workspace.Reset();
+		ActiveWorkspace->Reset();
+		ActiveWorkspace = &Workspace;
 	}
 
 	//EvictCache();
@@ -562,7 +596,7 @@ void FSimulation::ConstructSolverBodies(float DeltaTime, const FVector& Gravity)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ImmediateConstructSolverBodies);
 	const int32 NumBytes = Actors.Num() * sizeof(PxSolverBody);
-	SolverBodies = (PxSolverBody*)Workspace.Alloc(NumBytes);
+	SolverBodies = (PxSolverBody*)ActiveWorkspace->Alloc(NumBytes);
 
 	for(int32 BodyIdx = 0; BodyIdx < NumActiveSimulatedBodies; ++BodyIdx)
 	{
@@ -697,7 +731,7 @@ void FSimulation::GenerateContacts()
 	ContactPoints.Reset();
 	
 	const int32 NumShapes = ShapeSOA.LocalTMs.Num();
-	PxTransform* ShapeWorldTMs = (PxTransform*)Workspace.Alloc(sizeof(PxTransform) * NumShapes);
+	PxTransform* ShapeWorldTMs = (PxTransform*)ActiveWorkspace->Alloc(sizeof(PxTransform) * NumShapes);
 	for(int32 ShapeIdx = 0; ShapeIdx < NumShapes; ++ShapeIdx)
 	{
 		const immediate::PxRigidBodyData& Body = RigidBodiesData[ShapeSOA.OwningActors[ShapeIdx]];
@@ -804,7 +838,7 @@ void FSimulation::BatchConstraints()
 		NumActiveJoints = 0;
 		if(NumJoints > 0)
 		{
-			PxSolverConstraintDesc* JointDescriptors = (PxSolverConstraintDesc*)Workspace.Alloc(sizeof(PxSolverConstraintDesc) * NumJoints);
+			PxSolverConstraintDesc* JointDescriptors = (PxSolverConstraintDesc*)ActiveWorkspace->Alloc(sizeof(PxSolverConstraintDesc) * NumJoints);
 
 			for (int32 JointIdx = 0; JointIdx < NumJoints; ++JointIdx)
 			{
@@ -873,7 +907,7 @@ void FSimulation::BatchConstraints()
 	if(NumContactPairs > 0)
 	{
 		//Contact constraints
-		PxSolverConstraintDesc* ContactDescriptors = (PxSolverConstraintDesc*)Workspace.Alloc(sizeof(PxSolverConstraintDesc) * NumContactPairs);
+		PxSolverConstraintDesc* ContactDescriptors = (PxSolverConstraintDesc*)ActiveWorkspace->Alloc(sizeof(PxSolverConstraintDesc) * NumContactPairs);
 		for (int32 ContactPairIdx = 0; ContactPairIdx < NumContactPairs; ++ContactPairIdx)
 		{
 			const FContactPair& ContactPair = ContactPairs[ContactPairIdx];
@@ -1070,7 +1104,7 @@ void FSimulation::SolveAndIntegrate(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ImmediateSolveAndIntegrate);
 
-	PxVec3* LinearMotionVelocity = (PxVec3*) Workspace.Alloc(sizeof(PxVec3) * NumActiveSimulatedBodies * 2);
+	PxVec3* LinearMotionVelocity = (PxVec3*) ActiveWorkspace->Alloc(sizeof(PxVec3) * NumActiveSimulatedBodies * 2);
 	PxVec3* AngularMotionVelocity = &LinearMotionVelocity[NumActiveSimulatedBodies];
 
 	//Solve all constraints
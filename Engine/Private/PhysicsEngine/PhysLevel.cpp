@@ -23,6 +23,8 @@
 
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "Misc/CoreDelegates.h"
+#include "InGamePerformanceTracker.h"
+#include "PhysicsEngine/PhysXRuntimeCookCache.h"
 
 #ifndef APEX_STATICALLY_LINKED
 	#define APEX_STATICALLY_LINKED	0
@@ -168,6 +170,7 @@ void UWorld::StartPhysicsSim()
 		return;
 	}
 
+	SCOPE_PERFORMANCE_TRACKING_TIMER(Physics);
 	PhysScene->StartFrame();
 }
 
@@ -179,6 +182,7 @@ void UWorld::FinishPhysicsSim()
 		return;
 	}
 
+	SCOPE_PERFORMANCE_TRACKING_TIMER(Physics);
 	PhysScene->EndFrame(LineBatcher);
 }
 
@@ -331,6 +335,8 @@ void TermGamePhys()
 		delete GPhysCommandHandler;
 		GPhysCommandHandler = NULL;
 	}
+
+	FPhysXRuntimeCookCache::Empty();
 #endif
 
 	TermGamePhysCore();
@@ -454,6 +460,9 @@ void DeferredPhysResourceCleanup()
 		}
 	}
 	GPhysXPendingKillMaterial.Reset();
+
+	// Meshes shared through the runtime cook cache that are no longer used by any body setup
+	FPhysXRuntimeCookCache::Trim();
 #endif
 }
 
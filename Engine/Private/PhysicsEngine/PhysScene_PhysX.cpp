@@ -10,6 +10,7 @@
 #include "UObject/UObjectIterator.h"
 #include "HAL/IConsoleManager.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "Async/ParallelFor.h"
 #include "EngineDefines.h"
 #include "Engine/EngineTypes.h"
 #include "PhysxUserData.h"
@@ -37,6 +38,7 @@
 #include "Components/LineBatchComponent.h"
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/PhysicsAsset.h"
 #include "PhysicsEngine/ConstraintInstance.h"
 #include "PhysicsReplication.h"
 #include "ProfilingDebugging/CsvProfiler.h"
@@ -107,6 +109,29 @@ struct FPhysXRingBuffer
 	int32 Num;
 };
 
+static int32 GParallelSyncComponentsToBodies = 1;
+static FAutoConsoleVariableRef CVarParallelSyncComponentsToBodies(TEXT("p.ParallelSyncComponentsToBodies"), GParallelSyncComponentsToBodies, TEXT("If 1, the world transforms of the active bodies are read in parallel when syncing components to physics, before the components are moved on the game thread."), ECVF_Default);
+
+static int32 GSyncComponentsToBodiesDeferOverlaps = 0;
+static FAutoConsoleVariableRef CVarSyncComponentsToBodiesDeferOverlaps(TEXT("p.SyncComponentsToBodiesDeferOverlaps"), GSyncComponentsToBodiesDeferOverlaps, TEXT("If 1, components moved to match physics update their overlaps once in the batched update after TG_PostPhysics instead of on every move."), ECVF_Default);
+
+static int32 GAsyncFixedStepPhysics = 0;
+static FAutoConsoleVariableRef CVarAsyncFixedStepPhysics(TEXT("p.AsyncFixedStepPhysics"), GAsyncFixedStepPhysics, TEXT("If 1, game world physics scenes simulate fixed steps that run ahead of the game frame instead of a step per frame that the frame waits for. Components are presented in between the last two finished steps, forces and kinematic targets are queued for the next step."), ECVF_Default);
+
+static float GAsyncFixedStepPhysicsStepSeconds = 1.f / 60.f;
+static FAutoConsoleVariableRef CVarAsyncFixedStepPhysicsStepSeconds(TEXT("p.AsyncFixedStepPhysics.StepSeconds"), GAsyncFixedStepPhysicsStepSeconds, TEXT("Length in seconds of a step with p.AsyncFixedStepPhysics."), ECVF_Default);
+
+static int32 GAsyncFixedStepPhysicsMaxStepsPerFrame = 4;
+static FAutoConsoleVariableRef CVarAsyncFixedStepPhysicsMaxStepsPerFrame(TEXT("p.AsyncFixedStepPhysics.MaxStepsPerFrame"), GAsyncFixedStepPhysicsMaxStepsPerFrame, TEXT("Maximum number of steps started in a frame with p.AsyncFixedStepPhysics, game time the steps can't catch up on is dropped."), ECVF_Default);
+
+static int32 GBatchDeferredKinematicUpdates = 1;
+static FAutoConsoleVariableRef CVarBatchDeferredKinematicUpdates(TEXT("p.BatchDeferredKinematicUpdates"), GBatchDeferredKinematicUpdates, TEXT("If 1, the kinematic bodies of skeletal meshes that deferred their update until simulation are updated as one batch: the targets of all of them are computed in parallel, then written under a single scene lock."), ECVF_Default);
+
+static float GetAsyncFixedStepSeconds()
+{
+	return FMath::Max(GAsyncFixedStepPhysicsStepSeconds, 0.001f);
+}
+
 int32 GBatchPhysXTasksSize = 3;	//NOTE: FPhysXRingBuffer::Size should be twice as big as this value
 TAutoConsoleVariable<int32> CVarBatchPhysXTasksSize(TEXT("p.BatchPhysXTasksSize"), GBatchPhysXTasksSize, TEXT("Number of tasks to batch together (max 8). 1 will go as wide as possible, but more overhead on small tasks"), ECVF_Default);
 
@@ -455,6 +480,9 @@ FPhysScene_PhysX::FPhysScene_PhysX(const AWorldSettings* Settings)
 
 	// Also initialize scene data
 	bPhysXSceneExecuting = false;
+	bAsyncFixedStep = false;
+	bApplyingAsyncFixedStepInputs = false;
+	AsyncFixedStepAccumulator = 0.f;
 
 	// Initialize to a value which would be acceptable if FrameTimeSmoothingFactor[i] = 1.0f, i.e. constant simulation substeps
 	AveragedFrameTime = PhysSetting->InitialAverageFrameRate;
@@ -611,7 +639,7 @@ bool FPhysScene_PhysX::GetKinematicTarget_AssumesLocked(const FBodyInstance* Bod
 #if WITH_PHYSX
 	if (PxRigidDynamic * PRigidDynamic = FPhysicsInterface_PhysX::GetPxRigidDynamic_AssumesLocked(BodyInstance->GetPhysicsActorHandle()))
 	{
-		if (IsSubstepping())
+		if (ShouldQueueInput(true))
 		{
 			return PhysSubStepper->GetKinematicTarget_AssumesLocked(BodyInstance, OutTM);
 		}
@@ -641,7 +669,7 @@ void FPhysScene_PhysX::SetKinematicTarget_AssumesLocked(FBodyInstance* BodyInsta
 		const bool bIsKinematicTarget = IsRigidBodyKinematicAndInSimulationScene_AssumesLocked(PRigidDynamic);
 		if(bIsKinematicTarget)
 		{
-			if (bAllowSubstepping && IsSubstepping())
+			if (ShouldQueueInput(bAllowSubstepping))
 			{
 				PhysSubStepper->SetKinematicTarget_AssumesLocked(BodyInstance, TargetTransform);
 			}
@@ -661,7 +689,7 @@ void FPhysScene_PhysX::SetKinematicTarget_AssumesLocked(FBodyInstance* BodyInsta
 void FPhysScene_PhysX::AddCustomPhysics_AssumesLocked(FBodyInstance* BodyInstance, FCalculateCustomPhysics& CalculateCustomPhysics)
 {
 #if WITH_PHYSX
-	if (IsSubstepping())
+	if (ShouldQueueInput(true))
 	{
 		PhysSubStepper->AddCustomPhysics_AssumesLocked(BodyInstance, CalculateCustomPhysics);
 	}
@@ -679,9 +707,9 @@ void FPhysScene_PhysX::AddForce_AssumesLocked(FBodyInstance* BodyInstance, const
 
 	if (PxRigidBody * PRigidBody = FPhysicsInterface_PhysX::GetPxRigidBody_AssumesLocked(BodyInstance->GetPhysicsActorHandle()))
 	{
-		if (bAllowSubstepping && IsSubstepping())
+		if (ShouldQueueInput(bAllowSubstepping))
 		{
-			PhysSubStepper->AddForce_AssumesLocked(BodyInstance, Force, bAccelChange);
+			PhysSubStepper->AddForce_AssumesLocked(BodyInstance, Force * GetQueuedForceScale(), bAccelChange);
 		}
 		else
 		{
@@ -697,9 +725,9 @@ void FPhysScene_PhysX::AddForceAtPosition_AssumesLocked(FBodyInstance* BodyInsta
 
 	if (PxRigidBody * PRigidBody = FPhysicsInterface_PhysX::GetPxRigidBody_AssumesLocked(BodyInstance->GetPhysicsActorHandle()))
 	{
-		if (bAllowSubstepping && IsSubstepping())
+		if (ShouldQueueInput(bAllowSubstepping))
 		{
-			PhysSubStepper->AddForceAtPosition_AssumesLocked(BodyInstance, Force, Position, bIsLocalForce);
+			PhysSubStepper->AddForceAtPosition_AssumesLocked(BodyInstance, Force * GetQueuedForceScale(), Position, bIsLocalForce);
 		}
 		else if (!bIsLocalForce)
 		{
@@ -719,9 +747,9 @@ void FPhysScene_PhysX::AddRadialForceToBody_AssumesLocked(FBodyInstance* BodyIns
 
 	if (PxRigidBody * PRigidBody = FPhysicsInterface_PhysX::GetPxRigidBody_AssumesLocked(BodyInstance->GetPhysicsActorHandle()))
 	{
-		if (bAllowSubstepping && IsSubstepping())
+		if (ShouldQueueInput(bAllowSubstepping))
 		{
-			PhysSubStepper->AddRadialForceToBody_AssumesLocked(BodyInstance, Origin, Radius, Strength, Falloff, bAccelChange);
+			PhysSubStepper->AddRadialForceToBody_AssumesLocked(BodyInstance, Origin, Radius, Strength * GetQueuedForceScale(), Falloff, bAccelChange);
 		}
 		else
 		{
@@ -737,7 +765,7 @@ void FPhysScene_PhysX::ClearForces_AssumesLocked(FBodyInstance* BodyInstance, bo
 	if (PxRigidBody * PRigidBody = FPhysicsInterface_PhysX::GetPxRigidBody_AssumesLocked(BodyInstance->GetPhysicsActorHandle()))
 	{
 		PRigidBody->clearForce();
-		if (bAllowSubstepping && IsSubstepping())
+		if (ShouldQueueInput(bAllowSubstepping))
 		{
 			PhysSubStepper->ClearForces_AssumesLocked(BodyInstance);
 		}
@@ -752,9 +780,9 @@ void FPhysScene_PhysX::AddTorque_AssumesLocked(FBodyInstance* BodyInstance, cons
 
 	if (PxRigidBody * PRigidBody = FPhysicsInterface_PhysX::GetPxRigidBody_AssumesLocked(BodyInstance->GetPhysicsActorHandle()))
 	{
-		if (bAllowSubstepping && IsSubstepping())
+		if (ShouldQueueInput(bAllowSubstepping))
 		{
-			PhysSubStepper->AddTorque_AssumesLocked(BodyInstance, Torque, bAccelChange);
+			PhysSubStepper->AddTorque_AssumesLocked(BodyInstance, Torque * GetQueuedForceScale(), bAccelChange);
 		}
 		else
 		{
@@ -770,7 +798,7 @@ void FPhysScene_PhysX::ClearTorques_AssumesLocked(FBodyInstance* BodyInstance, b
 	if (PxRigidBody * PRigidBody = FPhysicsInterface_PhysX::GetPxRigidBody_AssumesLocked(BodyInstance->GetPhysicsActorHandle()))
 	{
 		PRigidBody->clearTorque();
-		if (bAllowSubstepping && IsSubstepping())
+		if (ShouldQueueInput(bAllowSubstepping))
 		{
 			PhysSubStepper->ClearTorques_AssumesLocked(BodyInstance);
 		}
@@ -802,6 +830,7 @@ void FPhysScene_PhysX::RemoveBodyInstanceFromPendingLists_AssumesLocked(FBodyIns
 	}
 
 	PendingSleepEvents.Remove(BodyInstance);
+	AsyncFixedStepPoses.Remove(BodyInstance);
 #endif // WITH_PHYSX
 }
 
@@ -1021,10 +1050,142 @@ void FPhysScene_PhysX::ClearPreSimKinematicUpdate(USkeletalMeshComponent* InSkel
 }
 
 
+/** Kinematic body of a deferred skeletal mesh, and the world transform of its bone */
+struct FDeferredKinematicBodyTarget
+{
+	FBodyInstance* BodyInstance;
+	const FTransform* ComponentSpaceTransform;
+	FTransform TargetTM;
+	int32 BodyIndex;
+	int32 MeshIndex;
+};
+
+/** Skeletal mesh whose deferred kinematic update is batched */
+struct FDeferredKinematicMesh
+{
+	USkeletalMeshComponent* SkelComp;
+	FTransform LocalToWorld;
+	bool bTeleport;
+};
+
+/** Whether a deferred kinematic update only needs what the batch does, anything else uses UpdateKinematicBonesToAnim */
+static bool CanBatchDeferredKinematicUpdate(const USkeletalMeshComponent* SkelComp)
+{
+	// Non-uniform mesh scale is applied to the bodies differently, it's rare enough to leave it to UpdateKinematicBonesToAnim
+	if (!SkelComp->IsPhysicsStateCreated() || SkelComp->bEnablePerPolyCollision || SkelComp->KinematicBonesUpdateType == EKinematicBonesUpdateToPhysics::SkipAllBones || !SkelComp->GetComponentTransform().GetScale3D().IsUniform())
+	{
+		return false;
+	}
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	if (SkelComp->bShowPrePhysBones)
+	{
+		return false;
+	}
+#endif
+
+	const UPhysicsAsset* const PhysicsAsset = SkelComp->GetPhysicsAsset();
+	return PhysicsAsset && SkelComp->SkeletalMesh && SkelComp->Bodies.Num() > 0 && PhysicsAsset->SkeletalBodySetups.Num() == SkelComp->Bodies.Num() && !SkelComp->GetComponentTransform().ContainsNaN();
+}
+
 void FPhysScene_PhysX::UpdateKinematicsOnDeferredSkelMeshes()
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateKinematicsOnDeferredSkelMeshes);
 
+#if WITH_PHYSX
+	if (GBatchDeferredKinematicUpdates && DeferredKinematicUpdateSkelMeshes.Num() > 1)
+	{
+		TArray<FDeferredKinematicMesh> Meshes;
+		Meshes.Reserve(DeferredKinematicUpdateSkelMeshes.Num());
+
+		TArray<FDeferredKinematicBodyTarget> Targets;
+
+		SCOPED_SCENE_WRITE_LOCK(GetPxScene());
+
+		for (const TPair<USkeletalMeshComponent*, FDeferredKinematicUpdateInfo>& DeferredKinematicUpdate : DeferredKinematicUpdateSkelMeshes)
+		{
+			USkeletalMeshComponent* SkelComp = DeferredKinematicUpdate.Key;
+			const FDeferredKinematicUpdateInfo& Info = DeferredKinematicUpdate.Value;
+
+			ensure(SkelComp->bDeferredKinematicUpdate); // Should be true if in map!
+			SkelComp->bDeferredKinematicUpdate = false;
+
+			if (!CanBatchDeferredKinematicUpdate(SkelComp))
+			{
+				SkelComp->UpdateKinematicBonesToAnim(SkelComp->GetComponentSpaceTransforms(), Info.TeleportType, Info.bNeedsSkinning, EAllowKinematicDeferral::DisallowDeferral);
+				continue;
+			}
+
+			const int32 MeshIndex = Meshes.Add({ SkelComp, SkelComp->GetComponentTransform(), Info.TeleportType == ETeleportType::TeleportPhysics });
+			const TArray<FTransform>& ComponentSpaceTransforms = SkelComp->GetComponentSpaceTransforms();
+
+			// Same bodies as UpdateKinematicBonesToAnim: kinematic ones, or all of them when teleporting
+			for (int32 BodyIndex = 0; BodyIndex < SkelComp->Bodies.Num(); ++BodyIndex)
+			{
+				FBodyInstance* BodyInst = SkelComp->Bodies[BodyIndex];
+				if (!ensure(BodyInst))
+				{
+					continue;
+				}
+
+				const FPhysicsActorHandle& ActorHandle = BodyInst->ActorHandle;
+				if (!FPhysicsInterface::IsValid(ActorHandle) || FPhysicsInterface::IsStatic(ActorHandle) || (!Meshes[MeshIndex].bTeleport && BodyInst->IsInstanceSimulatingPhysics()))
+				{
+					continue;
+				}
+
+				const int32 BoneIndex = BodyInst->InstanceBoneIndex;
+				if (BoneIndex == INDEX_NONE || BoneIndex >= SkelComp->GetNumComponentSpaceTransforms() || BoneIndex >= ComponentSpaceTransforms.Num())
+				{
+					UE_LOG(LogPhysics, Log, TEXT("UpdateRBBones: WARNING: Failed to find bone '%s' need by PhysicsAsset '%s' in SkeletalMesh '%s'."), *SkelComp->GetPhysicsAsset()->SkeletalBodySetups[BodyIndex]->BoneName.ToString(), *SkelComp->GetPhysicsAsset()->GetName(), *SkelComp->SkeletalMesh->GetName());
+					continue;
+				}
+
+				Targets.Add({ BodyInst, &ComponentSpaceTransforms[BoneIndex], FTransform::Identity, BodyIndex, MeshIndex });
+			}
+		}
+
+		// Only the bone transforms are computed wide, the scene is written from this thread
+		ParallelFor(Targets.Num(), [&Targets, &Meshes](int32 Index)
+		{
+			FDeferredKinematicBodyTarget& Target = Targets[Index];
+			Target.TargetTM = *Target.ComponentSpaceTransform * Meshes[Target.MeshIndex].LocalToWorld;
+		}, Targets.Num() < 128);
+
+		for (const FDeferredKinematicBodyTarget& Target : Targets)
+		{
+			const FDeferredKinematicMesh& Mesh = Meshes[Target.MeshIndex];
+			const UPhysicsAsset* const PhysicsAsset = Mesh.SkelComp->GetPhysicsAsset();
+
+			if (!Target.TargetTM.IsValid())
+			{
+				UE_LOG(LogPhysics, Warning, TEXT("UpdateKinematicBonesToAnim: Trying to set transform with bad data %s on PhysicsAsset '%s' in SkeletalMesh '%s' for bone '%s'"), *Target.TargetTM.ToHumanReadableString(), *PhysicsAsset->GetName(), *Mesh.SkelComp->SkeletalMesh->GetName(), *PhysicsAsset->SkeletalBodySetups[Target.BodyIndex]->BoneName.ToString());
+				Target.TargetTM.DiagnosticCheck_IsValid();	//In special nan mode we want to actually ensure
+				continue;
+			}
+
+			// If not teleporting (must be kinematic) set kinematic target, otherwise set global pose
+			if (!Mesh.bTeleport)
+			{
+				SetKinematicTarget_AssumesLocked(Target.BodyInstance, Target.TargetTM, true);
+			}
+			else
+			{
+				FPhysicsInterface::SetGlobalPose_AssumesLocked(Target.BodyInstance->ActorHandle, Target.TargetTM);
+			}
+
+			// Meshes with non-uniform scale aren't batched, so the bone scale is always used
+			if (!PhysicsAsset->SkeletalBodySetups[Target.BodyIndex]->bSkipScaleFromAnimation)
+			{
+				Target.BodyInstance->UpdateBodyScale(Target.TargetTM.GetScale3D());
+			}
+		}
+
+		DeferredKinematicUpdateSkelMeshes.Reset();
+		return;
+	}
+#endif // WITH_PHYSX
+
 	for (const TPair<USkeletalMeshComponent*, FDeferredKinematicUpdateInfo>& DeferredKinematicUpdate : DeferredKinematicUpdateSkelMeshes)
 	{
 		USkeletalMeshComponent* SkelComp = DeferredKinematicUpdate.Key;
@@ -1200,6 +1361,12 @@ void FPhysScene_PhysX::WaitPhysScenes()
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_FPhysScene_WaitPhysScenes);
 		FTaskGraphInterface::Get().WaitUntilTasksComplete(ThingsToComplete, ENamedThreads::GameThread);
 	}
+
+	// A fixed step in flight is fetched as well, the bodies it simulates may be about to be destroyed
+	if (AsyncFixedStepCompletion.GetReference())
+	{
+		FinishAsyncFixedStep();
+	}
 }
 
 void FPhysScene_PhysX::SceneCompletionTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
@@ -1280,6 +1447,39 @@ struct FPhysScenePendingComponentTransform_PhysX
 	{}
 };
 
+/** Moves components to match the transforms of their bodies */
+static void MoveComponentsToPendingTransforms(const TArray<FPhysScenePendingComponentTransform_PhysX>& PendingTransforms)
+{
+	const EMoveComponentFlags MoveFlags = GSyncComponentsToBodiesDeferOverlaps ? (MOVECOMP_SkipPhysicsMove | MOVECOMP_DeferOverlapUpdate) : MOVECOMP_SkipPhysicsMove;
+
+	/// Now actually move components
+	for (const FPhysScenePendingComponentTransform_PhysX& Entry : PendingTransforms)
+	{
+		// Check if still valid (ie not destroyed)
+		UPrimitiveComponent* OwnerComponent = Entry.OwningComp.Get();
+		if (OwnerComponent != nullptr)
+		{
+			AActor* Owner = OwnerComponent->GetOwner();
+
+			// See if the transform is actually different, and if so, move the component to match physics
+			if (!Entry.NewTransform.EqualsNoScale(OwnerComponent->GetComponentTransform()))
+			{
+				const FVector MoveBy = Entry.NewTransform.GetLocation() - OwnerComponent->GetComponentTransform().GetLocation();
+				const FQuat NewRotation = Entry.NewTransform.GetRotation();
+
+				//@warning: do not reference BodyInstance again after calling MoveComponent() - events from the move could have made it unusable (destroying the actor, SetPhysics(), etc)
+				OwnerComponent->MoveComponent(MoveBy, NewRotation, false, NULL, MoveFlags);
+			}
+
+			// Check if we didn't fall out of the world
+			if (Owner != NULL && !Owner->IsPendingKill())
+			{
+				Owner->CheckStillInWorld();
+			}
+		}
+	}
+}
+
 void FPhysScene_PhysX::SyncComponentsToBodies_AssumesLocked()
 {
 	SCOPE_CYCLE_COUNTER(STAT_TotalPhysicsTime);
@@ -1296,6 +1496,7 @@ void FPhysScene_PhysX::SyncComponentsToBodies_AssumesLocked()
 	PxActor** PActiveActors = PScene->getActiveActors(NumActors);
 
 	TArray<FPhysScenePendingComponentTransform_PhysX> PendingTransforms;
+	TArray<FBodyInstance*> PendingBodies;
 
 	for (PxU32 TransformIdx = 0; TransformIdx < NumActors; ++TransformIdx)
 	{
@@ -1310,13 +1511,11 @@ void FPhysScene_PhysX::SyncComponentsToBodies_AssumesLocked()
 			{
 				check(BodyInstance->OwnerComponent->IsRegistered()); // shouldn't have a physics body for a non-registered component!
 
-				const FTransform NewTransform = BodyInstance->GetUnrealWorldTransform_AssumesLocked();
-
-				// Add to set of transforms to process
+				// Add to set of transforms to process, the transforms are read below
 				// We can't actually move the component now (or check for out of world), because that could destroy a body
 				// elsewhere in the PActiveActors array, resulting in a bad pointer
-				FPhysScenePendingComponentTransform_PhysX NewEntry(BodyInstance->OwnerComponent.Get(), NewTransform);
-				PendingTransforms.Add(NewEntry);
+				PendingTransforms.Emplace(BodyInstance->OwnerComponent.Get(), FTransform::Identity);
+				PendingBodies.Add(BodyInstance);
 			}
 		}
 		else if (const FCustomPhysXPayload* CustomPayload = FPhysxUserData::Get<FCustomPhysXPayload>(RigidActor->userData))
@@ -1329,6 +1528,12 @@ void FPhysScene_PhysX::SyncComponentsToBodies_AssumesLocked()
 		}
 	}
 
+	// Reading the poses only reads the scene (which we hold the read lock on) and writes the entry of each body, so it can go wide
+	ParallelFor(PendingTransforms.Num(), [&PendingTransforms, &PendingBodies](int32 Index)
+	{
+		PendingTransforms[Index].NewTransform = PendingBodies[Index]->GetUnrealWorldTransform_AssumesLocked();
+	}, GParallelSyncComponentsToBodies == 0 || PendingTransforms.Num() < 64);
+
 	//Give custom plugins the chance to build the sync data
 	for (FCustomPhysXSyncActors* CustomSync : CustomPhysXSyncActors)
 	{
@@ -1342,34 +1547,192 @@ void FPhysScene_PhysX::SyncComponentsToBodies_AssumesLocked()
 		CustomSync->FinalizeSync();
 	}
 
-	/// Now actually move components
-	for (FPhysScenePendingComponentTransform_PhysX& Entry : PendingTransforms)
+	// In fixed step mode the poses are only kept, PresentAsyncFixedStepPoses moves the components in between them every frame
+	if (bAsyncFixedStep)
 	{
-		// Check if still valid (ie not destroyed)
-		UPrimitiveComponent* OwnerComponent = Entry.OwningComp.Get();
-		if (OwnerComponent != nullptr)
+		// Bodies that don't move in this step rest at their last pose
+		for (TPair<FBodyInstance*, FAsyncFixedStepPose>& Pair : AsyncFixedStepPoses)
 		{
-			AActor* Owner = OwnerComponent->GetOwner();
+			Pair.Value.Previous = Pair.Value.Current;
+		}
 
-			// See if the transform is actually different, and if so, move the component to match physics
-			if (!Entry.NewTransform.EqualsNoScale(OwnerComponent->GetComponentTransform()))
+		for (int32 Index = 0; Index < PendingTransforms.Num(); ++Index)
+		{
+			FAsyncFixedStepPose* Pose = AsyncFixedStepPoses.Find(PendingBodies[Index]);
+			if (!Pose)
 			{
-				const FVector MoveBy = Entry.NewTransform.GetLocation() - OwnerComponent->GetComponentTransform().GetLocation();
-				const FQuat NewRotation = Entry.NewTransform.GetRotation();
-
-				//@warning: do not reference BodyInstance again after calling MoveComponent() - events from the move could have made it unusable (destroying the actor, SetPhysics(), etc)
-				OwnerComponent->MoveComponent(MoveBy, NewRotation, false, NULL, MOVECOMP_SkipPhysicsMove);
+				// Bodies that start moving are blended from where their component is presented
+				Pose = &AsyncFixedStepPoses.Add(PendingBodies[Index]);
+				Pose->OwningComp = PendingTransforms[Index].OwningComp;
+				Pose->Previous = PendingTransforms[Index].OwningComp->GetComponentTransform();
 			}
+			Pose->Current = PendingTransforms[Index].NewTransform;
+		}
+		return;
+	}
 
-			// Check if we didn't fall out of the world
-			if (Owner != NULL && !Owner->IsPendingKill())
+	MoveComponentsToPendingTransforms(PendingTransforms);
+#endif // WITH_PHYSX 
+}
+
+void FPhysScene_PhysX::TickAsyncFixedStep()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TotalPhysicsTime);
+	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(Physics);
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FPhysScene_TickAsyncFixedStep);
+
+	const float StepSeconds = GetAsyncFixedStepSeconds();
+	const int32 MaxSteps = FMath::Max(GAsyncFixedStepPhysicsMaxStepsPerFrame, 1);
+
+	// Like frames longer than MaxPhysicsDeltaTime, time beyond the steps we can catch up on is dropped
+	const float UseDelta = FMath::Min(DeltaSeconds, MaxPhysicsDeltaTime);
+	if (UseDelta > 0.f)
+	{
+		AsyncFixedStepAccumulator = FMath::Min(AsyncFixedStepAccumulator + UseDelta, (MaxSteps + 1) * StepSeconds);
+	}
+
+	int32 NumSteps = 0;
+	for (;;)
+	{
+		if (AsyncFixedStepCompletion.GetReference())
+		{
+			// The step in flight keeps running through the frame, unless the game got more than a step ahead of it
+			if (!AsyncFixedStepCompletion->IsComplete() && AsyncFixedStepAccumulator < 2.f * StepSeconds)
 			{
-				Owner->CheckStillInWorld();
+				break;
 			}
+
+			FinishAsyncFixedStep();
 		}
+
+		if (AsyncFixedStepAccumulator < StepSeconds || NumSteps >= MaxSteps)
+		{
+			break;
+		}
+
+		AsyncFixedStepAccumulator -= StepSeconds;
+		StartAsyncFixedStep(StepSeconds);
+		++NumSteps;
 	}
 
-#endif // WITH_PHYSX 
+	PresentAsyncFixedStepPoses(FMath::Clamp(AsyncFixedStepAccumulator / StepSeconds, 0.f, 1.f));
+}
+
+void FPhysScene_PhysX::StartAsyncFixedStep(float StepSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PhysicsKickOffDynamicsTime);
+
+	check(!AsyncFixedStepCompletion.GetReference());
+
+	GSimStartTime = FPlatformTime::Seconds();
+
+	// Update any skeletal meshes that need their bone transforms sent to physics sim, their targets are queued and applied below
+	UpdateKinematicsOnDeferredSkelMeshes();
+
+#if WITH_PHYSX
+#if !WITH_APEX
+	PxScene* PScene = GetPxScene();
+	if (!PScene)
+	{
+		return;
+	}
+#else
+	apex::Scene* ApexScene = GetApexScene();
+	if (!ApexScene)
+	{
+		return;
+	}
+#endif
+
+	if (PhysicsReplication)
+	{
+		PhysicsReplication->Tick(StepSeconds);
+	}
+
+	OnPhysScenePreTick.Broadcast(this, StepSeconds);
+
+	{
+		// The scene isn't simulating until the step is started, anything applied from the step callbacks goes to the bodies directly
+		TGuardValue<bool> ApplyingInputsGuard(bApplyingAsyncFixedStepInputs, true);
+
+		OnPhysSceneStep.Broadcast(this, StepSeconds);
+		PhysSubStepper->ApplyQueuedTargets(StepSeconds);
+	}
+
+	bPhysXSceneExecuting = true;
+	bIsSceneSimulating = true;
+
+	AsyncFixedStepCompletion = FGraphEvent::CreateGraphEvent();
+
+#if !WITH_APEX
+	PhysXCompletionTask* Task = new PhysXCompletionTask(AsyncFixedStepCompletion, PScene->getTaskManager());
+	PScene->lockWrite();
+	PScene->simulate(StepSeconds, Task, SimScratchBuffer.Buffer, SimScratchBuffer.BufferSize);
+	PScene->unlockWrite();
+#else
+	PhysXCompletionTask* Task = new PhysXCompletionTask(AsyncFixedStepCompletion, ApexScene->getTaskManager());
+	ApexScene->simulate(StepSeconds, true, Task, SimScratchBuffer.Buffer, SimScratchBuffer.BufferSize);
+#endif
+	Task->removeReference();
+#endif // WITH_PHYSX
+}
+
+void FPhysScene_PhysX::FinishAsyncFixedStep()
+{
+	check(IsInGameThread());
+	check(AsyncFixedStepCompletion.GetReference());
+
+	if (!AsyncFixedStepCompletion->IsComplete())
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_FPhysScene_WaitAsyncFixedStep);
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(AsyncFixedStepCompletion, ENamedThreads::GameThread);
+	}
+	AsyncFixedStepCompletion = nullptr;
+
+	// Fetches the results, the new poses are kept by SyncComponentsToBodies_AssumesLocked
+	ProcessPhysScene();
+}
+
+void FPhysScene_PhysX::PresentAsyncFixedStepPoses(float Alpha)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FPhysScene_PresentAsyncFixedStepPoses);
+
+	// Moving the components can destroy bodies, which removes them from AsyncFixedStepPoses
+	TArray<FPhysScenePendingComponentTransform_PhysX> PendingTransforms;
+	PendingTransforms.Reserve(AsyncFixedStepPoses.Num());
+
+	for (TMap<FBodyInstance*, FAsyncFixedStepPose>::TIterator It = AsyncFixedStepPoses.CreateIterator(); It; ++It)
+	{
+		const FAsyncFixedStepPose& Pose = It.Value();
+
+		FTransform PresentedTransform;
+		PresentedTransform.Blend(Pose.Previous, Pose.Current, Alpha);
+		PendingTransforms.Emplace(Pose.OwningComp.Get(), PresentedTransform);
+
+		// Once a body rests its component is at its final pose, the body comes back when it moves again
+		if (Pose.Previous.Equals(Pose.Current))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	MoveComponentsToPendingTransforms(PendingTransforms);
+}
+
+bool FPhysScene_PhysX::ShouldQueueInput(bool bAllowSubstepping) const
+{
+	// In fixed step mode every input waits for the next step, so it applies to a whole step whichever frame it's added in
+	if (bAsyncFixedStep)
+	{
+		return !bApplyingAsyncFixedStepInputs;
+	}
+
+	return bAllowSubstepping && IsSubstepping();
+}
+
+float FPhysScene_PhysX::GetQueuedForceScale() const
+{
+	return bAsyncFixedStep ? FMath::Min(DeltaSeconds, MaxPhysicsDeltaTime) / GetAsyncFixedStepSeconds() : 1.f;
 }
 
 void FPhysScene_PhysX::DispatchPhysNotifications_AssumesLocked()
@@ -1481,6 +1844,33 @@ void FPhysScene_PhysX::StartFrame()
 	//Update the collision disable table before ticking
 	FlushDeferredCollisionDisableTableQueue();
 
+	// The mode only changes while no fixed step is in flight
+	if (!AsyncFixedStepCompletion.GetReference())
+	{
+		const bool bWantsAsyncFixedStep = GAsyncFixedStepPhysics != 0 && OwningWorld && OwningWorld->IsGameWorld();
+		if (bWantsAsyncFixedStep != bAsyncFixedStep)
+		{
+#if WITH_PHYSX
+			// Inputs queued for the next fixed step aren't lost, nothing is simulating
+			if (bAsyncFixedStep && PhysSubStepper)
+			{
+				TGuardValue<bool> ApplyingInputsGuard(bApplyingAsyncFixedStepInputs, true);
+				PhysSubStepper->ApplyQueuedTargets(DeltaSeconds);
+			}
+#endif
+			bAsyncFixedStep = bWantsAsyncFixedStep;
+			AsyncFixedStepAccumulator = 0.f;
+			AsyncFixedStepPoses.Reset();
+		}
+	}
+
+	if (bAsyncFixedStep)
+	{
+		TickAsyncFixedStep();
+		GatherClothingStats(this->OwningWorld);
+		return;
+	}
+
 	// Run the sync scene
 	TickPhysScene(PhysicsSubsceneCompletion);
 	{
@@ -1795,6 +2185,18 @@ bool FPhysScene_PhysX::IsSubstepping() const
 void FPhysScene_PhysX::ApplyWorldOffset(FVector InOffset)
 {
 #if WITH_PHYSX
+	// The origin can't be shifted while a fixed step is simulating
+	if (AsyncFixedStepCompletion.GetReference())
+	{
+		FinishAsyncFixedStep();
+	}
+
+	for (TPair<FBodyInstance*, FAsyncFixedStepPose>& Pair : AsyncFixedStepPoses)
+	{
+		Pair.Value.Previous.AddToTranslation(InOffset);
+		Pair.Value.Current.AddToTranslation(InOffset);
+	}
+
 	if (PxScene* PScene = GetPxScene())
 	{
 		// Lock scene lock, in case it is required
@@ -108,8 +108,12 @@ void FPhysSubstepTask::AddCustomPhysics_AssumesLocked(FBodyInstance* Body, const
 	{
 		FCustomTarget CustomTarget(CalculateCustomPhysics);
 
+		// Callbacks run once per step however often they were added, several frames can queue for the same fixed step
 		FPhysTarget & TargetState = PhysTargetBuffers[External].FindOrAdd(Body);
-		TargetState.CustomPhysics.Add(CustomTarget);
+		if (!TargetState.CustomPhysics.ContainsByPredicate([&CalculateCustomPhysics](const FCustomTarget& Target) { return Target.CalculateCustomPhysics == &CalculateCustomPhysics; }))
+		{
+			TargetState.CustomPhysics.Add(CustomTarget);
+		}
 	}
 #endif
 }
@@ -426,6 +430,12 @@ float FPhysSubstepTask::UpdateTime(float UseDelta)
 	return SubTime;
 }
 
+void FPhysSubstepTask::ApplyQueuedTargets(float DeltaTime)
+{
+	SwapBuffers();
+	SubstepInterpolation(1.f, DeltaTime);
+}
+
 #if WITH_PHYSX
 void FPhysSubstepTask::StepSimulation(PhysXCompletionTask * Task)
 {
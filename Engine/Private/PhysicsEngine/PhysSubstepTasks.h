@@ -182,6 +182,9 @@ public:
 	void SwapBuffers();
 	float UpdateTime(float UseDelta);
 
+	/** Swaps the buffers and applies everything queued since the last swap in one go, used by scenes that step at a fixed rate instead of substepping the frame */
+	void ApplyQueuedTargets(float DeltaTime);
+
 	void SubstepSimulationStart();
 	void SubstepSimulationEnd(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent);
 #if WITH_PHYSX
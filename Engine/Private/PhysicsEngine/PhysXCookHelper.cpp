@@ -4,6 +4,7 @@
 #include "PhysXCookHelper.h"
 #include "PhysXSupport.h"
 #include "IPhysXCookingModule.h"
+#include "PhysXRuntimeCookCache.h"
 
 #if WITH_PHYSX
 
@@ -24,7 +25,24 @@ bool FPhysXCookHelper::CreatePhysicsMeshes_Concurrent()
 	if (CookInfo.bCookTriMesh && !CookInfo.bTriMeshError)
 	{
 		OutTriangleMeshes.AddZeroed();
-		const bool bError = !PhysXCookingModule->GetPhysXCooking()->CreateTriMesh(FPlatformProperties::GetPhysicsFormat(), CookInfo.TriMeshCookFlags, CookInfo.TriangleMeshDesc.Vertices, CookInfo.TriangleMeshDesc.Indices, CookInfo.TriangleMeshDesc.MaterialIndices, CookInfo.TriangleMeshDesc.bFlipNormals, OutTriangleMeshes[0]);
+
+		const bool bUseCache = FPhysXRuntimeCookCache::IsEnabled();
+		const FSHAHash CacheKey = bUseCache ? FPhysXRuntimeCookCache::HashTriMesh(CookInfo.TriMeshCookFlags, CookInfo.TriangleMeshDesc) : FSHAHash();
+
+		bool bError = false;
+		if (PxTriangleMesh* CachedMesh = bUseCache ? FPhysXRuntimeCookCache::FindTriMesh(CacheKey) : nullptr)
+		{
+			OutTriangleMeshes[0] = CachedMesh;
+		}
+		else
+		{
+			bError = !PhysXCookingModule->GetPhysXCooking()->CreateTriMesh(FPlatformProperties::GetPhysicsFormat(), CookInfo.TriMeshCookFlags, CookInfo.TriangleMeshDesc.Vertices, CookInfo.TriangleMeshDesc.Indices, CookInfo.TriangleMeshDesc.MaterialIndices, CookInfo.TriangleMeshDesc.bFlipNormals, OutTriangleMeshes[0]);
+			if (!bError && bUseCache)
+			{
+				OutTriangleMeshes[0] = FPhysXRuntimeCookCache::AddTriMesh(CacheKey, OutTriangleMeshes[0]);
+			}
+		}
+
 		if (bError)
 		{
 			bSuccess = false;
@@ -48,10 +66,24 @@ void FPhysXCookHelper::CreatePhysicsMeshesAsync_Concurrent(FSimpleDelegateGraphT
 void FPhysXCookHelper::CreateConvexElements_Concurrent(const TArray<TArray<FVector>>& Elements, TArray<PxConvexMesh*>& OutConvexMeshes, bool bFlipped)
 {
 	OutMirroredConvexMeshes.Reserve(Elements.Num());
+	const bool bUseCache = FPhysXRuntimeCookCache::IsEnabled();
 	for (int32 ElementIndex = 0; ElementIndex < Elements.Num(); ++ElementIndex)
 	{
 		OutConvexMeshes.AddZeroed();
+
+		const FSHAHash CacheKey = bUseCache ? FPhysXRuntimeCookCache::HashConvex(CookInfo.ConvexCookFlags, Elements[ElementIndex]) : FSHAHash();
+		if (PxConvexMesh* CachedMesh = bUseCache ? FPhysXRuntimeCookCache::FindConvex(CacheKey) : nullptr)
+		{
+			OutConvexMeshes.Last() = CachedMesh;
+			continue;
+		}
+
 		const EPhysXCookingResult Result = PhysXCookingModule->GetPhysXCooking()->CreateConvex(FPlatformProperties::GetPhysicsFormat(), CookInfo.ConvexCookFlags, Elements[ElementIndex], OutConvexMeshes.Last());
+		if (bUseCache && Result != EPhysXCookingResult::Failed)
+		{
+			OutConvexMeshes.Last() = FPhysXRuntimeCookCache::AddConvex(CacheKey, OutConvexMeshes.Last());
+		}
+
 		switch (Result)
 		{
 		case EPhysXCookingResult::Succeeded:
@@ -0,0 +1,167 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "PhysXRuntimeCookCache.h"
+
+#if WITH_PHYSX
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Interface_CollisionDataProviderCore.h"
+#include "PhysXSupport.h"
+
+static int32 GRuntimeCookCache = 1;
+static FAutoConsoleVariableRef CVarRuntimeCookCache(TEXT("p.RuntimeCookCache"), GRuntimeCookCache, TEXT("If 1, convex and triangle meshes cooked at runtime are shared by the body setups that cook the same geometry, instead of being cooked for each of them."), ECVF_Default);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Runtime Cook Cache Meshes"), STAT_RuntimeCookCacheMeshes, STATGROUP_Physics);
+
+namespace PhysXRuntimeCookCache
+{
+	static FCriticalSection CriticalSection;
+	static TMap<FSHAHash, PxConvexMesh*> ConvexMeshes;
+	static TMap<FSHAHash, PxTriangleMesh*> TriMeshes;
+
+	template <typename MeshType>
+	static MeshType* Find(TMap<FSHAHash, MeshType*>& Meshes, const FSHAHash& Key)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		MeshType* Mesh = Meshes.FindRef(Key);
+		if (Mesh)
+		{
+			Mesh->acquireReference();
+		}
+		return Mesh;
+	}
+
+	template <typename MeshType>
+	static MeshType* Add(TMap<FSHAHash, MeshType*>& Meshes, const FSHAHash& Key, MeshType* Mesh)
+	{
+		if (!Mesh)
+		{
+			return nullptr;
+		}
+
+		FScopeLock Lock(&CriticalSection);
+
+		if (MeshType* ExistingMesh = Meshes.FindRef(Key))
+		{
+			// Cooked concurrently by another thread, the caller's mesh isn't used by anything yet
+			Mesh->release();
+			ExistingMesh->acquireReference();
+			return ExistingMesh;
+		}
+
+		// The cache's own reference, the caller keeps the one it cooked
+		Mesh->acquireReference();
+		Meshes.Add(Key, Mesh);
+		SET_DWORD_STAT(STAT_RuntimeCookCacheMeshes, ConvexMeshes.Num() + TriMeshes.Num());
+		return Mesh;
+	}
+
+	template <typename MeshType>
+	static void Trim(TMap<FSHAHash, MeshType*>& Meshes)
+	{
+		for (auto It = Meshes.CreateIterator(); It; ++It)
+		{
+			if (It.Value()->getReferenceCount() == 1)
+			{
+				It.Value()->release();
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	template <typename MeshType>
+	static void Empty(TMap<FSHAHash, MeshType*>& Meshes)
+	{
+		for (const TPair<FSHAHash, MeshType*>& Pair : Meshes)
+		{
+			Pair.Value->release();
+		}
+		Meshes.Empty();
+	}
+
+	template <typename ElementType>
+	static void HashArray(FSHA1& Hash, const TArray<ElementType>& Array)
+	{
+		const int32 Num = Array.Num();
+		Hash.Update((const uint8*)&Num, sizeof(Num));
+		Hash.Update((const uint8*)Array.GetData(), Array.Num() * sizeof(ElementType));
+	}
+}
+
+bool FPhysXRuntimeCookCache::IsEnabled()
+{
+	return GRuntimeCookCache != 0;
+}
+
+FSHAHash FPhysXRuntimeCookCache::HashConvex(EPhysXMeshCookFlags CookFlags, const TArray<FVector>& Vertices)
+{
+	FSHA1 Hash;
+	Hash.Update((const uint8*)&CookFlags, sizeof(CookFlags));
+	PhysXRuntimeCookCache::HashArray(Hash, Vertices);
+	Hash.Final();
+
+	FSHAHash Key;
+	Hash.GetHash(Key.Hash);
+	return Key;
+}
+
+FSHAHash FPhysXRuntimeCookCache::HashTriMesh(EPhysXMeshCookFlags CookFlags, const FTriMeshCollisionData& TriMeshDesc)
+{
+	const uint8 DescFlags = (TriMeshDesc.bFlipNormals ? 1 : 0) | (TriMeshDesc.bDeformableMesh ? 2 : 0) | (TriMeshDesc.bFastCook ? 4 : 0);
+
+	FSHA1 Hash;
+	Hash.Update((const uint8*)&CookFlags, sizeof(CookFlags));
+	Hash.Update(&DescFlags, sizeof(DescFlags));
+	PhysXRuntimeCookCache::HashArray(Hash, TriMeshDesc.Vertices);
+	PhysXRuntimeCookCache::HashArray(Hash, TriMeshDesc.Indices);
+	PhysXRuntimeCookCache::HashArray(Hash, TriMeshDesc.MaterialIndices);
+	Hash.Final();
+
+	FSHAHash Key;
+	Hash.GetHash(Key.Hash);
+	return Key;
+}
+
+PxConvexMesh* FPhysXRuntimeCookCache::FindConvex(const FSHAHash& Key)
+{
+	return PhysXRuntimeCookCache::Find(PhysXRuntimeCookCache::ConvexMeshes, Key);
+}
+
+PxTriangleMesh* FPhysXRuntimeCookCache::FindTriMesh(const FSHAHash& Key)
+{
+	return PhysXRuntimeCookCache::Find(PhysXRuntimeCookCache::TriMeshes, Key);
+}
+
+PxConvexMesh* FPhysXRuntimeCookCache::AddConvex(const FSHAHash& Key, PxConvexMesh* Mesh)
+{
+	return PhysXRuntimeCookCache::Add(PhysXRuntimeCookCache::ConvexMeshes, Key, Mesh);
+}
+
+PxTriangleMesh* FPhysXRuntimeCookCache::AddTriMesh(const FSHAHash& Key, PxTriangleMesh* Mesh)
+{
+	return PhysXRuntimeCookCache::Add(PhysXRuntimeCookCache::TriMeshes, Key, Mesh);
+}
+
+void FPhysXRuntimeCookCache::Trim()
+{
+	using namespace PhysXRuntimeCookCache;
+
+	FScopeLock Lock(&CriticalSection);
+	PhysXRuntimeCookCache::Trim(ConvexMeshes);
+	PhysXRuntimeCookCache::Trim(TriMeshes);
+	SET_DWORD_STAT(STAT_RuntimeCookCacheMeshes, ConvexMeshes.Num() + TriMeshes.Num());
+}
+
+void FPhysXRuntimeCookCache::Empty()
+{
+	using namespace PhysXRuntimeCookCache;
+
+	FScopeLock Lock(&CriticalSection);
+	PhysXRuntimeCookCache::Empty(ConvexMeshes);
+	PhysXRuntimeCookCache::Empty(TriMeshes);
+	SET_DWORD_STAT(STAT_RuntimeCookCacheMeshes, 0);
+}
+
+#endif // WITH_PHYSX
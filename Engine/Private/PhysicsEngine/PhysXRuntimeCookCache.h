@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EngineDefines.h"
+#include "Misc/SecureHash.h"
+
+#if WITH_PHYSX
+
+#include "IPhysXCooking.h"
+
+namespace physx
+{
+	class PxConvexMesh;
+	class PxTriangleMesh;
+}
+
+struct FTriMeshCollisionData;
+
+/**
+ * Meshes cooked at runtime, shared by every body setup that cooks the same geometry with the same flags. Procedural meshes and
+ * their duplicates often build identical collision, with the cache only the first of them is cooked and the others reuse its mesh
+ * (scale is applied by the shapes, so scaled copies share it too).
+ *
+ * Entries are keyed by a hash of the cook input and hold a reference on their mesh. Each lookup acquires a reference for the caller,
+ * released as usual when its body setup clears its meshes, and entries are released once the cache holds the only reference.
+ * Thread safe, the cache is used by the cooking workers.
+ */
+class FPhysXRuntimeCookCache
+{
+public:
+	/** Whether runtime cooks go through the cache, see p.RuntimeCookCache */
+	static bool IsEnabled();
+
+	static FSHAHash HashConvex(EPhysXMeshCookFlags CookFlags, const TArray<FVector>& Vertices);
+	static FSHAHash HashTriMesh(EPhysXMeshCookFlags CookFlags, const FTriMeshCollisionData& TriMeshDesc);
+
+	/** Returns the cached mesh with a reference acquired for the caller, or null if the geometry wasn't cooked yet */
+	static physx::PxConvexMesh* FindConvex(const FSHAHash& Key);
+	static physx::PxTriangleMesh* FindTriMesh(const FSHAHash& Key);
+
+	/**
+	 * Adds a mesh the caller just cooked and owns a reference on. Returns the mesh the caller should use: when another thread
+	 * added the same geometry first, the caller's mesh is released and the cached one is returned instead.
+	 */
+	static physx::PxConvexMesh* AddConvex(const FSHAHash& Key, physx::PxConvexMesh* Mesh);
+	static physx::PxTriangleMesh* AddTriMesh(const FSHAHash& Key, physx::PxTriangleMesh* Mesh);
+
+	/** Releases the meshes that no body setup uses anymore. Runs with the deferred physics resource cleanup. */
+	static void Trim();
+
+	/** Releases every cached mesh, before the physics SDK shuts down */
+	static void Empty();
+};
+
+#endif // WITH_PHYSX
@@ -81,6 +81,76 @@ namespace PhysicsReplicationCVars
 {
 	static int32 SkipSkeletalRepOptimization = 1;
 	static FAutoConsoleVariableRef CVarSkipSkeletalRepOptimization(TEXT("p.SkipSkeletalRepOptimization"), SkipSkeletalRepOptimization, TEXT("If true, we don't move the skeletal mesh component during replication. This is ok because the skeletal mesh already polls physx after its results"));
+
+	static int32 BatchPhysicsReplication = 1;
+	static FAutoConsoleVariableRef CVarBatchPhysicsReplication(TEXT("p.BatchPhysicsReplication"), BatchPhysicsReplication, TEXT("If true, the replicated targets of all bodies are applied together, with one scene read and one scene write per tick."));
+}
+
+DECLARE_CYCLE_STAT(TEXT("Physics Replication Batched"), STAT_PhysicsReplicationBatched, STATGROUP_Physics);
+
+/** Error correction settings with the cvar overrides applied */
+struct FResolvedErrorCorrection
+{
+	FResolvedErrorCorrection(const FRigidBodyErrorCorrection& ErrorCorrection)
+	{
+		// Grab configuration variables from engine config or from CVars if overriding is turned on.
+		NetPingExtrapolation = CharacterMovementCVars::NetPingExtrapolation >= 0.0f ? CharacterMovementCVars::NetPingExtrapolation : ErrorCorrection.PingExtrapolation;
+		NetPingLimit = CharacterMovementCVars::NetPingLimit > 0.0f ? CharacterMovementCVars::NetPingLimit : ErrorCorrection.PingLimit;
+		ErrorPerLinearDiff = CharacterMovementCVars::ErrorPerLinearDifference >= 0.0f ? CharacterMovementCVars::ErrorPerLinearDifference : ErrorCorrection.ErrorPerLinearDifference;
+		ErrorPerAngularDiff = CharacterMovementCVars::ErrorPerAngularDifference >= 0.0f ? CharacterMovementCVars::ErrorPerAngularDifference : ErrorCorrection.ErrorPerAngularDifference;
+		MaxRestoredStateError = CharacterMovementCVars::MaxRestoredStateError >= 0.0f ? CharacterMovementCVars::MaxRestoredStateError : ErrorCorrection.MaxRestoredStateError;
+		ErrorAccumulationSeconds = CharacterMovementCVars::ErrorAccumulationSeconds >= 0.0f ? CharacterMovementCVars::ErrorAccumulationSeconds : ErrorCorrection.ErrorAccumulationSeconds;
+		ErrorAccumulationDistanceSq = CharacterMovementCVars::ErrorAccumulationDistanceSq >= 0.0f ? CharacterMovementCVars::ErrorAccumulationDistanceSq : ErrorCorrection.ErrorAccumulationDistanceSq;
+		ErrorAccumulationSimilarity = CharacterMovementCVars::ErrorAccumulationSimilarity >= 0.0f ? CharacterMovementCVars::ErrorAccumulationSimilarity : ErrorCorrection.ErrorAccumulationSimilarity;
+		PositionLerp = CharacterMovementCVars::PositionLerp >= 0.0f ? CharacterMovementCVars::PositionLerp : ErrorCorrection.PositionLerp;
+		LinearVelocityCoefficient = CharacterMovementCVars::LinearVelocityCoefficient >= 0.0f ? CharacterMovementCVars::LinearVelocityCoefficient : ErrorCorrection.LinearVelocityCoefficient;
+		AngleLerp = CharacterMovementCVars::AngleLerp >= 0.0f ? CharacterMovementCVars::AngleLerp : ErrorCorrection.AngleLerp;
+		AngularVelocityCoefficient = CharacterMovementCVars::AngularVelocityCoefficient >= 0.0f ? CharacterMovementCVars::AngularVelocityCoefficient : ErrorCorrection.AngularVelocityCoefficient;
+		MaxLinearHardSnapDistance = CharacterMovementCVars::MaxLinearHardSnapDistance >= 0.f ? CharacterMovementCVars::MaxLinearHardSnapDistance : ErrorCorrection.MaxLinearHardSnapDistance;
+	}
+
+	float NetPingExtrapolation;
+	float NetPingLimit;
+	float ErrorPerLinearDiff;
+	float ErrorPerAngularDiff;
+	float MaxRestoredStateError;
+	float ErrorAccumulationSeconds;
+	float ErrorAccumulationDistanceSq;
+	float ErrorAccumulationSimilarity;
+	float PositionLerp;
+	float LinearVelocityCoefficient;
+	float AngleLerp;
+	float AngularVelocityCoefficient;
+	float MaxLinearHardSnapDistance;
+};
+
+/** Logs and returns false if the replicated rotation can't be applied */
+static bool IsValidTargetQuaternion(const FRigidBodyState& NewState, const FBodyInstance* BI)
+{
+	const float NewQuatSizeSqr = NewState.Quaternion.SizeSquared();
+	if (NewQuatSizeSqr < KINDA_SMALL_NUMBER)
+	{
+		UE_LOG(LogPhysics, Warning, TEXT("Invalid zero quaternion set for body. (%s)"), *BI->GetBodyDebugName());
+		return false;
+	}
+	else if (FMath::Abs(NewQuatSizeSqr - 1.f) > KINDA_SMALL_NUMBER)
+	{
+		UE_LOG(LogPhysics, Warning, TEXT("Quaternion (%f %f %f %f) with non-unit magnitude detected. (%s)"),
+			NewState.Quaternion.X, NewState.Quaternion.Y, NewState.Quaternion.Z, NewState.Quaternion.W, *BI->GetBodyDebugName());
+		return false;
+	}
+	return true;
+}
+
+/** Extrapolates the replicated rotation by the ping, the same way the position is */
+static FQuat ExtrapolateTargetQuaternion(const FRigidBodyState& NewState, float ExtrapolationDeltaSeconds)
+{
+	float NewStateAngVel;
+	FVector NewStateAngVelAxis;
+	NewState.AngVel.FVector::ToDirectionAndLength(NewStateAngVelAxis, NewStateAngVel);
+	NewStateAngVel = FMath::DegreesToRadians(NewStateAngVel);
+	const FQuat ExtrapolationDeltaQuaternion = FQuat(NewStateAngVelAxis, NewStateAngVel * ExtrapolationDeltaSeconds);
+	return ExtrapolationDeltaQuaternion * NewState.Quaternion;
 }
 
 bool FPhysicsReplication::ApplyRigidBodyState(float DeltaSeconds, FBodyInstance* BI, FReplicatedPhysicsTarget& PhysicsTarget, const FRigidBodyErrorCorrection& ErrorCorrection, const float PingSecondsOneWay)
@@ -127,7 +197,6 @@ bool FPhysicsReplication::ApplyRigidBodyState(float DeltaSeconds, FBodyInstance*
 
 	bool bRestoredState = true;
 	const FRigidBodyState NewState = PhysicsTarget.TargetState;
-	const float NewQuatSizeSqr = NewState.Quaternion.SizeSquared();
 
 	// failure cases
 	if (!BI->IsInstanceSimulatingPhysics())
@@ -135,32 +204,25 @@ bool FPhysicsReplication::ApplyRigidBodyState(float DeltaSeconds, FBodyInstance*
 		UE_LOG(LogPhysics, Warning, TEXT("Physics replicating on non-simulated body. (%s)"), *BI->GetBodyDebugName());
 		return bRestoredState;
 	}
-	else if (NewQuatSizeSqr < KINDA_SMALL_NUMBER)
-	{
-		UE_LOG(LogPhysics, Warning, TEXT("Invalid zero quaternion set for body. (%s)"), *BI->GetBodyDebugName());
-		return bRestoredState;
-	}
-	else if (FMath::Abs(NewQuatSizeSqr - 1.f) > KINDA_SMALL_NUMBER)
+	else if (!IsValidTargetQuaternion(NewState, BI))
 	{
-		UE_LOG(LogPhysics, Warning, TEXT("Quaternion (%f %f %f %f) with non-unit magnitude detected. (%s)"),
-			NewState.Quaternion.X, NewState.Quaternion.Y, NewState.Quaternion.Z, NewState.Quaternion.W, *BI->GetBodyDebugName());
 		return bRestoredState;
 	}
 
-	// Grab configuration variables from engine config or from CVars if overriding is turned on.
-	const float NetPingExtrapolation = CharacterMovementCVars::NetPingExtrapolation >= 0.0f ? CharacterMovementCVars::NetPingExtrapolation : ErrorCorrection.PingExtrapolation;
-	const float NetPingLimit = CharacterMovementCVars::NetPingLimit > 0.0f ? CharacterMovementCVars::NetPingLimit : ErrorCorrection.PingLimit;
-	const float ErrorPerLinearDiff = CharacterMovementCVars::ErrorPerLinearDifference >= 0.0f ? CharacterMovementCVars::ErrorPerLinearDifference : ErrorCorrection.ErrorPerLinearDifference;
-	const float ErrorPerAngularDiff = CharacterMovementCVars::ErrorPerAngularDifference >= 0.0f ? CharacterMovementCVars::ErrorPerAngularDifference : ErrorCorrection.ErrorPerAngularDifference;
-	const float MaxRestoredStateError = CharacterMovementCVars::MaxRestoredStateError >= 0.0f ? CharacterMovementCVars::MaxRestoredStateError : ErrorCorrection.MaxRestoredStateError;
-	const float ErrorAccumulationSeconds = CharacterMovementCVars::ErrorAccumulationSeconds >= 0.0f ? CharacterMovementCVars::ErrorAccumulationSeconds : ErrorCorrection.ErrorAccumulationSeconds;
-	const float ErrorAccumulationDistanceSq = CharacterMovementCVars::ErrorAccumulationDistanceSq >= 0.0f ? CharacterMovementCVars::ErrorAccumulationDistanceSq : ErrorCorrection.ErrorAccumulationDistanceSq;
-	const float ErrorAccumulationSimilarity = CharacterMovementCVars::ErrorAccumulationSimilarity >= 0.0f ? CharacterMovementCVars::ErrorAccumulationSimilarity : ErrorCorrection.ErrorAccumulationSimilarity;
-	const float PositionLerp = CharacterMovementCVars::PositionLerp >= 0.0f ? CharacterMovementCVars::PositionLerp : ErrorCorrection.PositionLerp;
-	const float LinearVelocityCoefficient = CharacterMovementCVars::LinearVelocityCoefficient >= 0.0f ? CharacterMovementCVars::LinearVelocityCoefficient : ErrorCorrection.LinearVelocityCoefficient;
-	const float AngleLerp = CharacterMovementCVars::AngleLerp >= 0.0f ? CharacterMovementCVars::AngleLerp : ErrorCorrection.AngleLerp;
-	const float AngularVelocityCoefficient = CharacterMovementCVars::AngularVelocityCoefficient >= 0.0f ? CharacterMovementCVars::AngularVelocityCoefficient : ErrorCorrection.AngularVelocityCoefficient;
-	const float MaxLinearHardSnapDistance = CharacterMovementCVars::MaxLinearHardSnapDistance >= 0.f ? CharacterMovementCVars::MaxLinearHardSnapDistance : ErrorCorrection.MaxLinearHardSnapDistance;
+	const FResolvedErrorCorrection Resolved(ErrorCorrection);
+	const float NetPingExtrapolation = Resolved.NetPingExtrapolation;
+	const float NetPingLimit = Resolved.NetPingLimit;
+	const float ErrorPerLinearDiff = Resolved.ErrorPerLinearDiff;
+	const float ErrorPerAngularDiff = Resolved.ErrorPerAngularDiff;
+	const float MaxRestoredStateError = Resolved.MaxRestoredStateError;
+	const float ErrorAccumulationSeconds = Resolved.ErrorAccumulationSeconds;
+	const float ErrorAccumulationDistanceSq = Resolved.ErrorAccumulationDistanceSq;
+	const float ErrorAccumulationSimilarity = Resolved.ErrorAccumulationSimilarity;
+	const float PositionLerp = Resolved.PositionLerp;
+	const float LinearVelocityCoefficient = Resolved.LinearVelocityCoefficient;
+	const float AngleLerp = Resolved.AngleLerp;
+	const float AngularVelocityCoefficient = Resolved.AngularVelocityCoefficient;
+	const float MaxLinearHardSnapDistance = Resolved.MaxLinearHardSnapDistance;
 
 	// Get Current state
 	FRigidBodyState CurrentState;
@@ -176,12 +238,7 @@ bool FPhysicsReplication::ApplyRigidBodyState(float DeltaSeconds, FBodyInstance*
 	const float ExtrapolationDeltaSeconds = PingSeconds * NetPingExtrapolation;
 	const FVector ExtrapolationDeltaPos = NewState.LinVel * ExtrapolationDeltaSeconds;
 	const FVector_NetQuantize100 TargetPos = NewState.Position + ExtrapolationDeltaPos;
-	float NewStateAngVel;
-	FVector NewStateAngVelAxis;
-	NewState.AngVel.FVector::ToDirectionAndLength(NewStateAngVelAxis, NewStateAngVel);
-	NewStateAngVel = FMath::DegreesToRadians(NewStateAngVel);
-	const FQuat ExtrapolationDeltaQuaternion = FQuat(NewStateAngVelAxis, NewStateAngVel * ExtrapolationDeltaSeconds);
-	FQuat TargetQuat = ExtrapolationDeltaQuaternion * NewState.Quaternion;
+	FQuat TargetQuat = ExtrapolateTargetQuaternion(NewState, ExtrapolationDeltaSeconds);
 
 	/////// COMPUTE DIFFERENCES ///////
 
@@ -367,6 +424,12 @@ float FPhysicsReplication::GetOwnerPing(const AActor* const Owner, const FReplic
 
 void FPhysicsReplication::OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets)
 {
+	if (PhysicsReplicationCVars::BatchPhysicsReplication && CanBatchRigidBodyStates())
+	{
+		OnTickBatched(DeltaSeconds, ComponentsToTargets);
+		return;
+	}
+
 	const FRigidBodyErrorCorrection& PhysicErrorCorrection = UPhysicsSettings::Get()->PhysicErrorCorrection;
 
 	// Get the ping between this PC & the server
@@ -426,6 +489,355 @@ void FPhysicsReplication::OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimit
 	}
 }
 
+void FPhysicsReplication::FBatchedBodies::SetNumBodies(int32 NumBodies)
+{
+	// Padded so that the last bodies can be processed four at a time too
+	const int32 NumPadded = Align(NumBodies, 4);
+	for (TArray<float>* Lane : { &CurrentPosX, &CurrentPosY, &CurrentPosZ, &TargetPosX, &TargetPosY, &TargetPosZ, &TargetLinVelX, &TargetLinVelY, &TargetLinVelZ,
+		&PrevPosX, &PrevPosY, &PrevPosZ, &PrevPosTargetX, &PrevPosTargetY, &PrevPosTargetZ, &ExtrapolationSeconds,
+		&LinDiffX, &LinDiffY, &LinDiffZ, &LinDiffSize, &PrevProgress, &PrevSimilarity })
+	{
+		Lane->Reset(NumPadded);
+		Lane->SetNumZeroed(NumPadded);
+	}
+
+	CurrentQuats.SetNumUninitialized(NumBodies, false);
+	NewTransforms.SetNumUninitialized(NumBodies, false);
+	NewLinVels.SetNumUninitialized(NumBodies, false);
+	NewAngVels.SetNumUninitialized(NumBodies, false);
+	bWriteState.SetNumUninitialized(NumBodies, false);
+	bShouldSleep.SetNumUninitialized(NumBodies, false);
+	bRestoredState.SetNumUninitialized(NumBodies, false);
+}
+
+void FPhysicsReplication::OnTickBatched(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PhysicsReplicationBatched);
+
+	const FRigidBodyErrorCorrection& PhysicErrorCorrection = UPhysicsSettings::Get()->PhysicErrorCorrection;
+	const FResolvedErrorCorrection Resolved(PhysicErrorCorrection);
+
+	// Get the ping between this PC & the server
+	const float LocalPing = GetLocalPing();
+
+	/** A target that was ticked, and what became of it */
+	struct FTickedTarget
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Key;
+		UPrimitiveComponent* PrimComp;
+		int32 BatchIndex;
+		bool bRestoredState;
+	};
+	TArray<FTickedTarget> TickedTargets;
+	TickedTargets.Reserve(ComponentsToTargets.Num());
+
+	FBatchedBodies& Batch = BatchedBodies;
+	Batch.Bodies.Reset();
+	Batch.Targets.Reset();
+	Batch.PingSecondsOneWay.Reset();
+
+	/////// GATHER ///////
+
+	for (auto Itr = ComponentsToTargets.CreateIterator(); Itr; ++Itr)
+	{
+		UPrimitiveComponent* PrimComp = Itr.Key().Get();
+		FBodyInstance* BI = PrimComp ? PrimComp->GetBodyInstance(Itr.Value().BoneName) : nullptr;
+		AActor* OwningActor = BI ? PrimComp->GetOwner() : nullptr;
+		if (OwningActor == nullptr)
+		{
+			continue;
+		}
+
+		FReplicatedPhysicsTarget& PhysicsTarget = Itr.Value();
+		const ENetRole OwnerRole = OwningActor->GetLocalRole();
+		const bool bIsSimulated = OwnerRole == ROLE_SimulatedProxy;
+		const bool bIsReplicatedAutonomous = OwnerRole == ROLE_AutonomousProxy && PrimComp->bReplicatePhysicsToAutonomousProxy;
+		if (!(bIsSimulated || bIsReplicatedAutonomous) || !(PhysicsTarget.TargetState.Flags & ERigidBodyFlags::NeedsUpdate))
+		{
+			continue;
+		}
+
+		// See OnTick for how the ping is approximated
+		const float OwnerPing = GetOwnerPing(OwningActor, PhysicsTarget);
+		const float PingSecondsOneWay = (LocalPing + OwnerPing) * 0.5f * 0.001f;
+
+		FTickedTarget& Ticked = TickedTargets.AddDefaulted_GetRef();
+		Ticked.Key = Itr.Key();
+		Ticked.PrimComp = PrimComp;
+		Ticked.BatchIndex = INDEX_NONE;
+		Ticked.bRestoredState = false;
+
+		if (CharacterMovementCVars::SkipPhysicsReplication || !BI->IsInstanceSimulatingPhysics())
+		{
+			continue;
+		}
+
+		if (!IsValidTargetQuaternion(PhysicsTarget.TargetState, BI))
+		{
+			Ticked.bRestoredState = true;
+			continue;
+		}
+
+		if (PhysScene == nullptr || BI->GetPhysicsScene() != PhysScene || !FPhysicsInterface::IsValid(BI->GetPhysicsActorHandle()))
+		{
+			Ticked.bRestoredState = ApplyRigidBodyState(DeltaSeconds, BI, PhysicsTarget, PhysicErrorCorrection, PingSecondsOneWay);
+			continue;
+		}
+
+		Ticked.BatchIndex = Batch.Bodies.Add(BI);
+		Batch.Targets.Add(&PhysicsTarget);
+		Batch.PingSecondsOneWay.Add(PingSecondsOneWay);
+	}
+
+	const int32 NumBodies = Batch.Bodies.Num();
+	if (NumBodies > 0)
+	{
+		Batch.SetNumBodies(NumBodies);
+
+		/////// READ CURRENT STATES ///////
+
+		FPhysicsCommand::ExecuteRead(PhysScene, [&]()
+		{
+			for (int32 Index = 0; Index < NumBodies; ++Index)
+			{
+				const FTransform BodyTM = Batch.Bodies[Index]->GetUnrealWorldTransform_AssumesLocked();
+				const FVector CurrentPos = BodyTM.GetTranslation();
+				Batch.CurrentPosX[Index] = CurrentPos.X;
+				Batch.CurrentPosY[Index] = CurrentPos.Y;
+				Batch.CurrentPosZ[Index] = CurrentPos.Z;
+				Batch.CurrentQuats[Index] = BodyTM.GetRotation();
+			}
+		});
+
+		for (int32 Index = 0; Index < NumBodies; ++Index)
+		{
+			const FReplicatedPhysicsTarget& PhysicsTarget = *Batch.Targets[Index];
+			const FRigidBodyState& NewState = PhysicsTarget.TargetState;
+			Batch.TargetPosX[Index] = NewState.Position.X;
+			Batch.TargetPosY[Index] = NewState.Position.Y;
+			Batch.TargetPosZ[Index] = NewState.Position.Z;
+			Batch.TargetLinVelX[Index] = NewState.LinVel.X;
+			Batch.TargetLinVelY[Index] = NewState.LinVel.Y;
+			Batch.TargetLinVelZ[Index] = NewState.LinVel.Z;
+			Batch.PrevPosX[Index] = PhysicsTarget.PrevPos.X;
+			Batch.PrevPosY[Index] = PhysicsTarget.PrevPos.Y;
+			Batch.PrevPosZ[Index] = PhysicsTarget.PrevPos.Z;
+			Batch.PrevPosTargetX[Index] = PhysicsTarget.PrevPosTarget.X;
+			Batch.PrevPosTargetY[Index] = PhysicsTarget.PrevPosTarget.Y;
+			Batch.PrevPosTargetZ[Index] = PhysicsTarget.PrevPosTarget.Z;
+
+			const float PingSeconds = FMath::Clamp(Batch.PingSecondsOneWay[Index], 0.f, Resolved.NetPingLimit);
+			Batch.ExtrapolationSeconds[Index] = PingSeconds * Resolved.NetPingExtrapolation;
+		}
+
+		/////// EXTRAPOLATE TARGETS AND COMPUTE LINEAR DIFFERENCES ///////
+
+		// Same math as ApplyRigidBodyState, four bodies at a time
+		const VectorRegister VecSmallNumber = VectorSetFloat1(SMALL_NUMBER);
+		for (int32 Index = 0; Index < Batch.CurrentPosX.Num(); Index += 4)
+		{
+			const VectorRegister CurrentX = VectorLoad(&Batch.CurrentPosX[Index]);
+			const VectorRegister CurrentY = VectorLoad(&Batch.CurrentPosY[Index]);
+			const VectorRegister CurrentZ = VectorLoad(&Batch.CurrentPosZ[Index]);
+
+			const VectorRegister Extrapolation = VectorLoad(&Batch.ExtrapolationSeconds[Index]);
+			const VectorRegister TargetX = VectorMultiplyAdd(VectorLoad(&Batch.TargetLinVelX[Index]), Extrapolation, VectorLoad(&Batch.TargetPosX[Index]));
+			const VectorRegister TargetY = VectorMultiplyAdd(VectorLoad(&Batch.TargetLinVelY[Index]), Extrapolation, VectorLoad(&Batch.TargetPosY[Index]));
+			const VectorRegister TargetZ = VectorMultiplyAdd(VectorLoad(&Batch.TargetLinVelZ[Index]), Extrapolation, VectorLoad(&Batch.TargetPosZ[Index]));
+			VectorStore(TargetX, &Batch.TargetPosX[Index]);
+			VectorStore(TargetY, &Batch.TargetPosY[Index]);
+			VectorStore(TargetZ, &Batch.TargetPosZ[Index]);
+
+			const VectorRegister DiffX = VectorSubtract(TargetX, CurrentX);
+			const VectorRegister DiffY = VectorSubtract(TargetY, CurrentY);
+			const VectorRegister DiffZ = VectorSubtract(TargetZ, CurrentZ);
+			VectorStore(DiffX, &Batch.LinDiffX[Index]);
+			VectorStore(DiffY, &Batch.LinDiffY[Index]);
+			VectorStore(DiffZ, &Batch.LinDiffZ[Index]);
+
+			const VectorRegister DiffSizeSquared = VectorMultiplyAdd(DiffX, DiffX, VectorMultiplyAdd(DiffY, DiffY, VectorMultiply(DiffZ, DiffZ)));
+			const VectorRegister DiffSize = VectorMultiply(DiffSizeSquared, VectorReciprocalSqrt(DiffSizeSquared));
+			VectorStore(VectorSelect(VectorCompareGT(DiffSizeSquared, VectorZero()), DiffSize, VectorZero()), &Batch.LinDiffSize[Index]);
+
+			// Previous linear error, and how much of it the last physics step corrected
+			const VectorRegister PrevX = VectorLoad(&Batch.PrevPosX[Index]);
+			const VectorRegister PrevY = VectorLoad(&Batch.PrevPosY[Index]);
+			const VectorRegister PrevZ = VectorLoad(&Batch.PrevPosZ[Index]);
+			const VectorRegister PrevErrorX = VectorSubtract(VectorLoad(&Batch.PrevPosTargetX[Index]), PrevX);
+			const VectorRegister PrevErrorY = VectorSubtract(VectorLoad(&Batch.PrevPosTargetY[Index]), PrevY);
+			const VectorRegister PrevErrorZ = VectorSubtract(VectorLoad(&Batch.PrevPosTargetZ[Index]), PrevZ);
+
+			const VectorRegister PrevErrorSizeSquared = VectorMultiplyAdd(PrevErrorX, PrevErrorX, VectorMultiplyAdd(PrevErrorY, PrevErrorY, VectorMultiply(PrevErrorZ, PrevErrorZ)));
+			const VectorRegister PrevErrorInvSize = VectorSelect(VectorCompareGT(PrevErrorSizeSquared, VecSmallNumber), VectorReciprocalSqrt(PrevErrorSizeSquared), VectorZero());
+
+			const VectorRegister ProgressDot = VectorMultiplyAdd(VectorSubtract(CurrentX, PrevX), PrevErrorX,
+				VectorMultiplyAdd(VectorSubtract(CurrentY, PrevY), PrevErrorY,
+				VectorMultiply(VectorSubtract(CurrentZ, PrevZ), PrevErrorZ)));
+			VectorStore(VectorMultiply(ProgressDot, PrevErrorInvSize), &Batch.PrevProgress[Index]);
+
+			const VectorRegister SimilarityDot = VectorMultiplyAdd(DiffX, PrevErrorX, VectorMultiplyAdd(DiffY, PrevErrorY, VectorMultiply(DiffZ, PrevErrorZ)));
+			VectorStore(SimilarityDot, &Batch.PrevSimilarity[Index]);
+		}
+
+		/////// ACCUMULATE ERROR AND COMPUTE NEW STATES ///////
+
+		UWorld* OwningWorld = GetOwningWorld();
+		for (int32 Index = 0; Index < NumBodies; ++Index)
+		{
+			FReplicatedPhysicsTarget& PhysicsTarget = *Batch.Targets[Index];
+			const FRigidBodyState& NewState = PhysicsTarget.TargetState;
+
+			const FVector CurrentPos(Batch.CurrentPosX[Index], Batch.CurrentPosY[Index], Batch.CurrentPosZ[Index]);
+			const FVector TargetPos(Batch.TargetPosX[Index], Batch.TargetPosY[Index], Batch.TargetPosZ[Index]);
+			const FVector LinDiff(Batch.LinDiffX[Index], Batch.LinDiffY[Index], Batch.LinDiffZ[Index]);
+			const float LinDiffSize = Batch.LinDiffSize[Index];
+
+			const FQuat& CurrentQuat = Batch.CurrentQuats[Index];
+			const FQuat TargetQuat = ExtrapolateTargetQuaternion(NewState, Batch.ExtrapolationSeconds[Index]);
+			FVector AngDiffAxis;
+			float AngDiff;
+			const FQuat DeltaQuat = CurrentQuat.Inverse() * TargetQuat;
+			DeltaQuat.ToAxisAndAngle(AngDiffAxis, AngDiff);
+			AngDiff = FMath::RadiansToDegrees(FMath::UnwindRadians(AngDiff));
+			const float AngDiffSize = FMath::Abs(AngDiff);
+
+			Batch.bShouldSleep[Index] = (NewState.Flags & ERigidBodyFlags::Sleeping) != 0;
+			Batch.bWriteState[Index] = false;
+
+			const float Error = (LinDiffSize * Resolved.ErrorPerLinearDiff) + (AngDiffSize * Resolved.ErrorPerAngularDiff);
+			bool bRestoredState = Error < Resolved.MaxRestoredStateError;
+			if (bRestoredState)
+			{
+				PhysicsTarget.AccumulatedErrorSeconds = 0.0f;
+			}
+			else
+			{
+				// See ApplyRigidBodyState for the error accumulation heuristic
+				if (Batch.PrevProgress[Index] < Resolved.ErrorAccumulationDistanceSq &&
+					Batch.PrevSimilarity[Index] > Resolved.ErrorAccumulationSimilarity)
+				{
+					PhysicsTarget.AccumulatedErrorSeconds += DeltaSeconds;
+				}
+				else
+				{
+					PhysicsTarget.AccumulatedErrorSeconds = FMath::Max(PhysicsTarget.AccumulatedErrorSeconds - DeltaSeconds, 0.0f);
+				}
+
+				const bool bHardSnap =
+					LinDiffSize > Resolved.MaxLinearHardSnapDistance ||
+					PhysicsTarget.AccumulatedErrorSeconds > Resolved.ErrorAccumulationSeconds ||
+					CharacterMovementCVars::AlwaysHardSnap;
+				if (bHardSnap)
+				{
+					PhysicsTarget.AccumulatedErrorSeconds = 0.0f;
+					bRestoredState = true;
+				}
+
+				const FVector NewPos = FMath::Lerp(CurrentPos, TargetPos, bHardSnap ? 1.0f : Resolved.PositionLerp);
+				const FQuat NewAng = FQuat::Slerp(CurrentQuat, TargetQuat, bHardSnap ? 1.0f : Resolved.AngleLerp);
+
+				Batch.NewTransforms[Index] = FTransform(NewAng, NewPos);
+				Batch.NewLinVels[Index] = bHardSnap ? FVector(NewState.LinVel) : FVector(NewState.LinVel) + (LinDiff * Resolved.LinearVelocityCoefficient * DeltaSeconds);
+				Batch.NewAngVels[Index] = bHardSnap ? FVector(NewState.AngVel) : FVector(NewState.AngVel) + (AngDiffAxis * AngDiff * Resolved.AngularVelocityCoefficient * DeltaSeconds);
+				Batch.bWriteState[Index] = true;
+
+#if !UE_BUILD_SHIPPING
+				if (CharacterMovementCVars::NetShowCorrections != 0)
+				{
+					PhysicsTarget.ErrorHistory.bAutoAdjustMinMax = false;
+					PhysicsTarget.ErrorHistory.MinValue = 0.0f;
+					PhysicsTarget.ErrorHistory.MaxValue = 1.0f;
+					PhysicsTarget.ErrorHistory.AddSample(PhysicsTarget.AccumulatedErrorSeconds / Resolved.ErrorAccumulationSeconds);
+					if (OwningWorld)
+					{
+						FColor Color = FColor::White;
+						DrawDebugDirectionalArrow(OwningWorld, CurrentPos, TargetPos, 5.0f, Color, true, CharacterMovementCVars::NetCorrectionLifetime, 0, 1.5f);
+						DrawDebugFloatHistory(*OwningWorld, PhysicsTarget.ErrorHistory, NewPos + FVector(0.0f, 0.0f, 100.0f), FVector2D(100.0f, 50.0f), FColor::White);
+					}
+				}
+#endif
+			}
+
+			PhysicsTarget.PrevPosTarget = TargetPos;
+			PhysicsTarget.PrevPos = CurrentPos;
+
+			Batch.bRestoredState[Index] = bRestoredState;
+		}
+
+		for (FTickedTarget& Ticked : TickedTargets)
+		{
+			if (Ticked.BatchIndex != INDEX_NONE)
+			{
+				Ticked.bRestoredState = Batch.bRestoredState[Ticked.BatchIndex];
+			}
+		}
+
+		/////// UPDATE BODIES ///////
+
+		// Same as SetBodyTransform, SetLinearVelocity, SetAngularVelocityInRadians and PutInstanceToSleep on a simulated body, under a single lock
+		FPhysicsCommand::ExecuteWrite(PhysScene, [&]()
+		{
+			for (int32 Index = 0; Index < NumBodies; ++Index)
+			{
+				const FPhysicsActorHandle& Actor = Batch.Bodies[Index]->GetPhysicsActorHandle();
+				if (!FPhysicsInterface::IsValid(Actor))
+				{
+					continue;
+				}
+
+				const bool bIsDynamic = FPhysicsInterface::IsDynamic(Actor);
+				if (Batch.bWriteState[Index])
+				{
+					const FTransform& NewTransform = Batch.NewTransforms[Index];
+					if (ensureMsgf(!NewTransform.ContainsNaN() && NewTransform.IsValid(), TEXT("Physics replication computed an invalid transform (%s)\n%s"), *Batch.Bodies[Index]->GetBodyDebugName(), *NewTransform.ToString()))
+					{
+						if (bIsDynamic && FPhysicsInterface::IsKinematic_AssumesLocked(Actor) && FPhysicsInterface::CanSimulate_AssumesLocked(Actor))
+						{
+							FPhysicsInterface::SetKinematicTarget_AssumesLocked(Actor, NewTransform);
+						}
+						FPhysicsInterface::SetGlobalPose_AssumesLocked(Actor, NewTransform);
+					}
+
+					if (FPhysicsInterface::IsRigidBody(Actor))
+					{
+						FPhysicsInterface::SetLinearVelocity_AssumesLocked(Actor, Batch.NewLinVels[Index]);
+						FPhysicsInterface::SetAngularVelocity_AssumesLocked(Actor, FMath::DegreesToRadians(Batch.NewAngVels[Index]));
+					}
+				}
+
+				if (Batch.bShouldSleep[Index] && bIsDynamic && FPhysicsInterface::IsInScene(Actor) && !FPhysicsInterface::IsKinematic_AssumesLocked(Actor))
+				{
+					FPhysicsInterface::PutToSleep_AssumesLocked(Actor);
+				}
+			}
+		});
+	}
+
+	/////// SYNC COMPONENTS AND REMOVE RESTORED TARGETS ///////
+
+	for (const FTickedTarget& Ticked : TickedTargets)
+	{
+		// Need to update the component to match new position.
+		if (PhysicsReplicationCVars::SkipSkeletalRepOptimization == 0 || Cast<USkeletalMeshComponent>(Ticked.PrimComp) == nullptr)	//simulated skeletal mesh does its own polling of physics results so we don't need to call this as it'll happen at the end of the physics sim
+		{
+			Ticked.PrimComp->SyncComponentToRBPhysics();
+		}
+	}
+
+	// Syncing components may run gameplay code that changes the targets, so they are looked up again
+	for (const FTickedTarget& Ticked : TickedTargets)
+	{
+		if (Ticked.bRestoredState)
+		{
+			if (const FReplicatedPhysicsTarget* Target = ComponentsToTargets.Find(Ticked.Key))
+			{
+				OnTargetRestored(Ticked.Key, *Target);
+				ComponentsToTargets.Remove(Ticked.Key);
+			}
+		}
+	}
+}
+
 void FPhysicsReplication::Tick(float DeltaSeconds)
 {
 	OnTick(DeltaSeconds, ComponentToTargets);
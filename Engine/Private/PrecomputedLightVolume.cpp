@@ -479,6 +479,115 @@ void FPrecomputedLightVolume::InterpolateIncidentRadiancePoint(
 	}
 }
 
+void FPrecomputedLightVolume::InterpolateIncidentRadiancePoints(
+	TArrayView<const FVector> InWorldPositions,
+	TArrayView<FVolumeLightingInterpolation> OutInterpolations) const
+{
+	checkf(this, TEXT("FPrecomputedLightVolume::InterpolateIncidentRadiancePoints() is called on a null volume. Fix the call site."));
+	check(InWorldPositions.Num() == OutInterpolations.Num());
+
+	if (!Data->bInitialized || InWorldPositions.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<64>> Positions;
+	Positions.Reserve(InWorldPositions.Num());
+	for (const FVector& InWorldPosition : InWorldPositions)
+	{
+		Positions.Add(InWorldPosition - WorldOriginOffset); // relocate from world to volume space
+	}
+
+	// Indices of the positions inside each node on the stack, the positions of a node are a range of this array
+	TArray<int32, TInlineAllocator<256>> PositionIndices;
+	PositionIndices.Reserve(Positions.Num() * 2);
+	for (int32 PositionIndex = 0; PositionIndex < Positions.Num(); ++PositionIndex)
+	{
+		PositionIndices.Add(PositionIndex);
+	}
+
+	struct FNodeToVisit
+	{
+		const FLightVolumeOctree::FNode* Node;
+		FOctreeNodeContext Context;
+		int32 FirstPositionIndex;
+		int32 NumPositions;
+	};
+
+	TArray<FNodeToVisit, TInlineAllocator<32>> NodeStack;
+	TArray<FOctreeChildNodeSubset, TInlineAllocator<64>> ChildSubsets;
+	{
+		FLightVolumeOctree::TConstIterator<> RootIt(*OctreeForRendering);
+		NodeStack.Add({ &RootIt.GetCurrentNode(), RootIt.GetCurrentContext(), 0, Positions.Num() });
+	}
+
+	while (NodeStack.Num() > 0)
+	{
+		const FNodeToVisit NodeToVisit = NodeStack.Pop(false);
+
+		// The positions pushed for the children of nodes visited before this one aren't needed anymore
+		PositionIndices.SetNum(NodeToVisit.FirstPositionIndex + NodeToVisit.NumPositions, false);
+
+		for (const FVolumeLightingSample& VolumeSample : NodeToVisit.Node->GetElements())
+		{
+			const float RadiusSquared = FMath::Square(VolumeSample.Radius);
+			const float InvRadiusSquared = 1.0f / RadiusSquared;
+			for (int32 Index = NodeToVisit.FirstPositionIndex; Index < NodeToVisit.FirstPositionIndex + NodeToVisit.NumPositions; ++Index)
+			{
+				const int32 PositionIndex = PositionIndices[Index];
+				const float DistanceSquared = (VolumeSample.Position - Positions[PositionIndex]).SizeSquared();
+
+				if (DistanceSquared < RadiusSquared)
+				{
+					// Same weighting as InterpolateIncidentRadiancePoint
+					const float SampleWeight = (1.0f - DistanceSquared * InvRadiusSquared) * InvRadiusSquared;
+					FVolumeLightingInterpolation& Interpolation = OutInterpolations[PositionIndex];
+					Interpolation.AccumulatedIncidentRadiance += VolumeSample.Lighting * SampleWeight;
+					Interpolation.SkyBentNormal += VolumeSample.GetSkyBentNormalUnpacked() * SampleWeight;
+					Interpolation.AccumulatedDirectionalLightShadowing += VolumeSample.DirectionalLightShadowing * SampleWeight;
+					Interpolation.AccumulatedWeight += SampleWeight;
+				}
+			}
+		}
+
+		if (NodeToVisit.Node->IsLeaf())
+		{
+			continue;
+		}
+
+		// Children are loose, a position can be inside several of them
+		ChildSubsets.Reset();
+		for (int32 Index = NodeToVisit.FirstPositionIndex; Index < NodeToVisit.FirstPositionIndex + NodeToVisit.NumPositions; ++Index)
+		{
+			ChildSubsets.Add(NodeToVisit.Context.GetIntersectingChildren(FBoxCenterAndExtent(Positions[PositionIndices[Index]], FVector::ZeroVector)));
+		}
+
+		FOREACH_OCTREE_CHILD_NODE(ChildRef)
+		{
+			if (!NodeToVisit.Node->HasChild(ChildRef))
+			{
+				continue;
+			}
+
+			const int32 FirstChildPositionIndex = PositionIndices.Num();
+			for (int32 Index = 0; Index < NodeToVisit.NumPositions; ++Index)
+			{
+				if (ChildSubsets[Index].Contains(ChildRef))
+				{
+					const int32 PositionIndex = PositionIndices[NodeToVisit.FirstPositionIndex + Index];
+					PositionIndices.Add(PositionIndex);
+				}
+			}
+
+			const int32 NumChildPositions = PositionIndices.Num() - FirstChildPositionIndex;
+			if (NumChildPositions > 0)
+			{
+				NodeStack.Add({ NodeToVisit.Node->GetChild(ChildRef), NodeToVisit.Context.GetChildContext(ChildRef), FirstChildPositionIndex, NumChildPositions });
+			}
+		}
+	}
+}
+
 /** Interpolates incident radiance to Position. */
 void FPrecomputedLightVolume::InterpolateIncidentRadianceBlock(
 	const FBoxCenterAndExtent& InBoundingBox, 
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/AllocationCountingMalloc.h"
+#include "HAL/PlatformTLS.h"
+
+namespace AllocationCountingMalloc
+{
+	/** Threads counted separately, later threads share the overflow slot */
+	static const int32 MaxThreads = 128;
+
+	/** Only written by its own thread, padded so threads don't share cache lines */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FThreadSlot
+	{
+		volatile int32 ThreadId;
+		volatile uint64 NumAllocs;
+		volatile uint64 NumFrees;
+	};
+
+	static FThreadSlot ThreadSlots[MaxThreads];
+	static FThreadSlot OverflowSlot;
+	static volatile int32 NumThreadSlots = 0;
+
+	static FAllocationCountingMalloc* Instance = nullptr;
+
+	static thread_local FThreadSlot* CurrentThreadSlot = nullptr;
+
+	static FThreadSlot& GetThreadSlot()
+	{
+		if (!CurrentThreadSlot)
+		{
+			const int32 SlotIndex = FPlatformAtomics::InterlockedIncrement(&NumThreadSlots) - 1;
+			if (SlotIndex < MaxThreads)
+			{
+				CurrentThreadSlot = &ThreadSlots[SlotIndex];
+				CurrentThreadSlot->ThreadId = (int32)FPlatformTLS::GetCurrentThreadId();
+			}
+			else
+			{
+				// Counts of the overflow slot are approximate, several threads increment them
+				CurrentThreadSlot = &OverflowSlot;
+			}
+		}
+		return *CurrentThreadSlot;
+	}
+}
+
+bool FAllocationCountingMalloc::Install()
+{
+	using namespace AllocationCountingMalloc;
+
+#if PLATFORM_USES_FIXED_GMalloc_CLASS
+	return false;
+#else
+	check(IsInGameThread());
+
+	if (!Instance && GMalloc)
+	{
+		Instance = new FAllocationCountingMalloc(GMalloc);
+		FPlatformMisc::MemoryBarrier();
+		GMalloc = Instance;
+	}
+	return Instance != nullptr;
+#endif
+}
+
+bool FAllocationCountingMalloc::IsInstalled()
+{
+	return AllocationCountingMalloc::Instance != nullptr;
+}
+
+void FAllocationCountingMalloc::GetThreadCounts(TArray<FThreadCounts>& OutCounts)
+{
+	using namespace AllocationCountingMalloc;
+
+	const int32 NumSlots = FMath::Min<int32>(NumThreadSlots, MaxThreads);
+	for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+	{
+		const FThreadSlot& Slot = ThreadSlots[SlotIndex];
+		OutCounts.Add({ (uint32)Slot.ThreadId, Slot.NumAllocs, Slot.NumFrees });
+	}
+
+	if (NumThreadSlots > MaxThreads)
+	{
+		OutCounts.Add({ 0, OverflowSlot.NumAllocs, OverflowSlot.NumFrees });
+	}
+}
+
+void* FAllocationCountingMalloc::Malloc(SIZE_T Size, uint32 Alignment)
+{
+	++AllocationCountingMalloc::GetThreadSlot().NumAllocs;
+	return UsedMalloc->Malloc(Size, Alignment);
+}
+
+void* FAllocationCountingMalloc::Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment)
+{
+	void* Result = UsedMalloc->Realloc(Ptr, NewSize, Alignment);
+
+	// Resizing a block in place isn't counted, moving it is an allocation and a free
+	AllocationCountingMalloc::FThreadSlot& Slot = AllocationCountingMalloc::GetThreadSlot();
+	if (!Ptr)
+	{
+		++Slot.NumAllocs;
+	}
+	else if (NewSize == 0)
+	{
+		++Slot.NumFrees;
+	}
+	else if (Result != Ptr)
+	{
+		++Slot.NumAllocs;
+		++Slot.NumFrees;
+	}
+	return Result;
+}
+
+void FAllocationCountingMalloc::Free(void* Ptr)
+{
+	if (Ptr)
+	{
+		++AllocationCountingMalloc::GetThreadSlot().NumFrees;
+	}
+	UsedMalloc->Free(Ptr);
+}
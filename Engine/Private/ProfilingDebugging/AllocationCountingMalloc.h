@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+
+/**
+ * Allocator proxy that counts the allocations and frees of every thread, so health snapshots can report the allocation
+ * rate in any build configuration. Each thread only increments its own counters, there is no lock or atomic on the
+ * allocation path.
+ *
+ * The proxy wraps GMalloc the first time it's installed and is never removed, since other threads may be inside it at any
+ * time. Allocations made before it was installed are freed through it like any other.
+ */
+class FAllocationCountingMalloc final : public FMalloc
+{
+public:
+
+	struct FThreadCounts
+	{
+		uint32 ThreadId;
+		uint64 NumAllocs;
+		uint64 NumFrees;
+	};
+
+	/** Wraps GMalloc with the proxy, if it isn't already. Returns false if the platform doesn't allocate through GMalloc. */
+	static bool Install();
+
+	static bool IsInstalled();
+
+	/** Adds the counts of every thread that allocated since the proxy was installed, threads beyond the tracked ones are reported as ThreadId 0 */
+	static void GetThreadCounts(TArray<FThreadCounts>& OutCounts);
+
+	// FMalloc interface.
+	virtual void* Malloc(SIZE_T Size, uint32 Alignment) override;
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override;
+	virtual void Free(void* Ptr) override;
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return UsedMalloc->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return UsedMalloc->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { UsedMalloc->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { UsedMalloc->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void InitializeStatsMetadata() override { UsedMalloc->InitializeStatsMetadata(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { UsedMalloc->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { UsedMalloc->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return UsedMalloc->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return UsedMalloc->ValidateHeap(); }
+	virtual void UpdateStats() override { UsedMalloc->UpdateStats(); }
+	virtual const TCHAR* GetDescriptiveName() override { return UsedMalloc->GetDescriptiveName(); }
+
+private:
+
+	explicit FAllocationCountingMalloc(FMalloc* InMalloc)
+		: UsedMalloc(InMalloc)
+	{
+	}
+
+	/** Wrapped allocator */
+	FMalloc* UsedMalloc;
+};
@@ -5,14 +5,61 @@
 #include "Misc/TimeGuard.h"
 #include "ContentStreaming.h"
 #include "ChartCreation.h"
+#include "ProfilingDebugging/AllocationCountingMalloc.h"
+#include "ProfilingDebugging/MallocLeakReporter.h"
 
 #include "HAL/MemoryMisc.h"
 #include "HAL/LowLevelMemTracker.h"
 #include "HAL/ThreadSafeCounter64.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/IConsoleManager.h"
 #include "Engine/Engine.h"
+#include "Misc/Paths.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHealthSnapshot, Log, All);
 
+static int32 GHealthSnapshotTrackAllocations = 0;
+static FAutoConsoleVariableRef CVarHealthSnapshotTrackAllocations(
+	TEXT("HealthSnapshot.TrackAllocations"),
+	GHealthSnapshotTrackAllocations,
+	TEXT("If 1, health snapshots include the allocations and frees per frame of each thread since the previous snapshot.\n")
+	TEXT("Counting costs an increment per allocation, the allocator proxy that counts is installed by the first snapshot and stays installed."),
+	ECVF_Default);
+
+static int32 GHealthSnapshotNumAllocationStats = 8;
+static FAutoConsoleVariableRef CVarHealthSnapshotNumAllocationStats(
+	TEXT("HealthSnapshot.NumAllocationStats"),
+	GHealthSnapshotNumAllocationStats,
+	TEXT("Number of threads and LLM tags with the most allocations that health snapshots report."),
+	ECVF_Default);
+
+static int32 GHealthSnapshotTopAllocatorsReport = 1;
+static FAutoConsoleVariableRef CVarHealthSnapshotTopAllocatorsReport(
+	TEXT("HealthSnapshot.TopAllocatorsReport"),
+	GHealthSnapshotTopAllocatorsReport,
+	TEXT("If 1 and allocations are tracked with mallocleak.start, health snapshots write the tracked callsites sorted by allocation rate to a report."),
+	ECVF_Default);
+
+namespace HealthSnapshot
+{
+	/** Counts at the previous snapshot, rates are measured between snapshots */
+	static uint64 PreviousAllocationFrame = 0;
+	static TMap<uint32, FAllocationCountingMalloc::FThreadCounts> PreviousThreadCounts;
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	static TArray<int64> PreviousLLMTagAmounts;
+#endif
+
+	/** Keeps the NumStats stats with the most allocated or freed */
+	static void SortAndTrimAllocationStats(TArray<FHealthSnapshot::FAllocationStat>& Stats, int32 NumStats)
+	{
+		Stats.Sort([](const FHealthSnapshot::FAllocationStat& A, const FHealthSnapshot::FAllocationStat& B)
+		{
+			return A.Allocs + A.Frees > B.Allocs + B.Frees;
+		});
+		Stats.SetNum(FMath::Min(Stats.Num(), FMath::Max(NumStats, 0)));
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 // FFortHealthSnapshot
 
@@ -25,12 +72,16 @@ FHealthSnapshot::FHealthSnapshot(const TCHAR* InTitle)
 	, AvgHitchTime(0)
 	, MVP(0)
 	, AvgFPS(0)
+	, AllocationFrames(0)
+	, AllocsPerFrame(0)
+	, FreesPerFrame(0)
 {
 	SCOPE_TIME_GUARD_MS(TEXT("Health Snapshot"), 4);
 
 	Title = InTitle;
 
 	CaptureMemoryStats();
+	CaptureAllocationStats();
 }
 
 FHealthSnapshot::FHealthSnapshot(const TCHAR* InTitle, const FPerformanceTrackingChart* GameplayFPSChart)
@@ -92,6 +143,89 @@ void FHealthSnapshot::CaptureMemoryStats()
 	}
 }
 
+void FHealthSnapshot::CaptureAllocationStats()
+{
+	using namespace HealthSnapshot;
+
+	if (!GHealthSnapshotTrackAllocations)
+	{
+		return;
+	}
+
+	if (!FAllocationCountingMalloc::IsInstalled())
+	{
+		// The first snapshot only starts counting
+		if (!FAllocationCountingMalloc::Install())
+		{
+			UE_LOG(LogHealthSnapshot, Warning, TEXT("Cannot track allocations, PLATFORM_USES_FIXED_GMalloc_CLASS=%d"), PLATFORM_USES_FIXED_GMalloc_CLASS);
+			GHealthSnapshotTrackAllocations = 0;
+			return;
+		}
+		PreviousAllocationFrame = GFrameCounter;
+	}
+
+	AllocationFrames = GFrameCounter - PreviousAllocationFrame;
+	PreviousAllocationFrame = GFrameCounter;
+	const double InvFrames = AllocationFrames > 0 ? 1.0 / AllocationFrames : 0.0;
+
+	TArray<FAllocationCountingMalloc::FThreadCounts> ThreadCounts;
+	FAllocationCountingMalloc::GetThreadCounts(ThreadCounts);
+
+	for (const FAllocationCountingMalloc::FThreadCounts& Counts : ThreadCounts)
+	{
+		FAllocationCountingMalloc::FThreadCounts& Previous = PreviousThreadCounts.FindOrAdd(Counts.ThreadId, { Counts.ThreadId, 0, 0 });
+
+		FAllocationStat& ThreadStat = ThreadAllocations.AddDefaulted_GetRef();
+		ThreadStat.Name = Counts.ThreadId != 0 ? FThreadManager::GetThreadName(Counts.ThreadId) : FString(TEXT("Other threads"));
+		if (ThreadStat.Name.IsEmpty())
+		{
+			ThreadStat.Name = FString::Printf(TEXT("Thread %u"), Counts.ThreadId);
+		}
+		ThreadStat.Allocs = (Counts.NumAllocs - Previous.NumAllocs) * InvFrames;
+		ThreadStat.Frees = (Counts.NumFrees - Previous.NumFrees) * InvFrames;
+
+		AllocsPerFrame += ThreadStat.Allocs;
+		FreesPerFrame += ThreadStat.Frees;
+		Previous = Counts;
+	}
+	SortAndTrimAllocationStats(ThreadAllocations, GHealthSnapshotNumAllocationStats);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	// LLM only tracks sizes, a tag is reported with how much it grew or shrank per frame
+	if (FLowLevelMemTracker::Get().IsEnabled())
+	{
+		const int32 NumTags = (int32)ELLMTag::GenericTagCount;
+		PreviousLLMTagAmounts.SetNumZeroed(NumTags);
+
+		for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+		{
+			const int64 Amount = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, (ELLMTag)TagIndex);
+			const double GrowthKB = (Amount - PreviousLLMTagAmounts[TagIndex]) * InvFrames / 1024.0;
+			PreviousLLMTagAmounts[TagIndex] = Amount;
+
+			if (GrowthKB != 0.0)
+			{
+				FAllocationStat& TagStat = LLMTagGrowthKB.AddDefaulted_GetRef();
+				TagStat.Name = LLMGetTagName((ELLMTag)TagIndex);
+				TagStat.Allocs = FMath::Max(GrowthKB, 0.0);
+				TagStat.Frees = FMath::Max(-GrowthKB, 0.0);
+			}
+		}
+		SortAndTrimAllocationStats(LLMTagGrowthKB, GHealthSnapshotNumAllocationStats);
+	}
+#endif
+
+	// Callsites are only known when the leak reporter is sampling allocations, at the size filter it was started with
+	if (GHealthSnapshotTopAllocatorsReport && AllocationFrames > 0 && FMallocLeakReporter::Get().IsEnabled())
+	{
+		FMallocLeakReportOptions Options;
+		Options.SortBy = FMallocLeakReportOptions::ESortOption::SortRate;
+
+		TopAllocatorsReport = FPaths::MakeValidFileName(FString::Printf(TEXT("HealthSnapshot_%s_Allocators.txt"), *Title));
+		FMallocLeakReporter::Get().WriteReport(*TopAllocatorsReport, Options);
+	}
+}
+
 void FHealthSnapshot::CapturePerformanceStats(const FPerformanceTrackingChart* GameplayFPSChart)
 {
 	if (GameplayFPSChart)
@@ -192,6 +326,23 @@ void FHealthSnapshot::DumpStats(FOutputDevice& Ar, FName CategoryName)
 }
 #endif
 
+	if (AllocationFrames > 0)
+	{
+		Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("Allocations: %.1f/frame, Frees: %.1f/frame over %llu frames"), AllocsPerFrame, FreesPerFrame, AllocationFrames);
+		for (const FAllocationStat& ThreadStat : ThreadAllocations)
+		{
+			Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("  %s: Allocations %.1f/frame, Frees %.1f/frame"), *ThreadStat.Name, ThreadStat.Allocs, ThreadStat.Frees);
+		}
+		for (const FAllocationStat& TagStat : LLMTagGrowthKB)
+		{
+			Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("  LLM %s: %+.2fKB/frame"), *TagStat.Name, TagStat.Allocs - TagStat.Frees);
+		}
+		if (!TopAllocatorsReport.IsEmpty())
+		{
+			Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("  Top allocators written to %s"), *TopAllocatorsReport);
+		}
+	}
+
 #if PLATFORM_PS4
 	Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("Garlic: Used %.2f MB"), GarlicMemoryMB.Used);
 	Ar.CategorizedLogf(CategoryName, ELogVerbosity::Log, TEXT("Onion: Used %.2f MB"), OnionMemoryMB.Used);
@@ -226,20 +377,12 @@ void UHealthSnapshotBlueprintLibrary::StopPerformanceSnapshots()
 
 void UHealthSnapshotBlueprintLibrary::LogPerformanceSnapshot(const FString SnapshotTitle, bool bResetStats)
 {
-	FHealthSnapshot Snapshot(TEXT(""));
-
-	if (PerformanceChart.IsValid())
-	{
-		Snapshot = FHealthSnapshot(*SnapshotTitle, PerformanceChart.Get());
+	// Only capture the snapshot once, allocation rates are measured since the previous capture
+	FHealthSnapshot Snapshot = PerformanceChart.IsValid() ? FHealthSnapshot(*SnapshotTitle, PerformanceChart.Get()) : FHealthSnapshot(*SnapshotTitle);
 
-		if (bResetStats)
-		{
-			PerformanceChart->Reset(FDateTime::Now());
-		}
-	}
-	else
+	if (PerformanceChart.IsValid() && bResetStats)
 	{
-		Snapshot = FHealthSnapshot(*SnapshotTitle);
+		PerformanceChart->Reset(FDateTime::Now());
 	}
 
 	Snapshot.Dump(*GLog);
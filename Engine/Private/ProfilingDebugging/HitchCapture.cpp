@@ -0,0 +1,260 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/HitchCapture.h"
+#include "InGamePerformanceTracker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/RunnableThread.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RHI.h"
+#include "RenderCore.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHitchCapture, Log, All);
+
+static int32 GHitchCapture = 0;
+static FAutoConsoleVariableRef CVarHitchCapture(
+	TEXT("t.HitchCapture"),
+	GHitchCapture,
+	TEXT("If 1, the performance tracking timer scopes of the last frames are kept in memory and written to Saved/Profiling/Hitches when a frame hitches."),
+	ECVF_Default);
+
+static float GHitchCaptureThresholdMS = 100.0f;
+static FAutoConsoleVariableRef CVarHitchCaptureThresholdMS(
+	TEXT("t.HitchCapture.ThresholdMS"),
+	GHitchCaptureThresholdMS,
+	TEXT("Frame time in milliseconds over which t.HitchCapture writes a capture."),
+	ECVF_Default);
+
+static int32 GHitchCaptureNumFrames = 3;
+static FAutoConsoleVariableRef CVarHitchCaptureNumFrames(
+	TEXT("t.HitchCapture.NumFrames"),
+	GHitchCaptureNumFrames,
+	TEXT("Number of frames written by t.HitchCapture, the hitch and the frames before it."),
+	ECVF_Default);
+
+static int32 GHitchCaptureMaxCaptures = 10;
+static FAutoConsoleVariableRef CVarHitchCaptureMaxCaptures(
+	TEXT("t.HitchCapture.MaxCaptures"),
+	GHitchCaptureMaxCaptures,
+	TEXT("Maximum number of captures t.HitchCapture writes per session, recording stops once they are written."),
+	ECVF_Default);
+
+bool FHitchCapture::bEnabled = false;
+
+namespace HitchCapture
+{
+	/** Threads that record events, later threads aren't recorded */
+	static const int32 MaxThreads = 64;
+
+	/** Events kept per thread, a power of two */
+	static const uint32 EventsPerThread = 2048;
+
+	/** Frames kept by the game thread, at least t.HitchCapture.NumFrames */
+	static const uint32 MaxFrames = 16;
+
+	struct FEvent
+	{
+		uint64 StartCycles;
+		uint32 DurationCycles;
+		int32 TimerIndex;
+	};
+
+	/** Only written by its own thread. Read without synchronization when writing a capture, the newest events of other threads may be torn. */
+	struct FThreadBuffer
+	{
+		uint32 ThreadId;
+		volatile uint32 NumEvents;
+		FEvent Events[EventsPerThread];
+	};
+
+	static FThreadBuffer* ThreadBuffers[MaxThreads] = {};
+	static volatile int32 NumThreadBuffers = 0;
+
+	static thread_local FThreadBuffer* CurrentThreadBuffer = nullptr;
+	static thread_local bool bCurrentThreadUntracked = false;
+
+	struct FFrame
+	{
+		uint64 FrameNumber;
+		uint64 StartCycles;
+		uint64 EndCycles;
+		uint32 GameThreadCycles;
+		uint32 RenderThreadCycles;
+		uint32 RHIThreadCycles;
+		uint32 GPUCycles;
+	};
+
+	/** Game thread only */
+	static FFrame Frames[MaxFrames];
+	static uint32 NumFrames = 0;
+	static uint64 LastFrameEndCycles = 0;
+	static int32 NumCaptures = 0;
+
+	static FThreadBuffer* GetThreadBuffer()
+	{
+		if (!CurrentThreadBuffer && !bCurrentThreadUntracked)
+		{
+			const int32 BufferIndex = FPlatformAtomics::InterlockedIncrement(&NumThreadBuffers) - 1;
+			if (BufferIndex < MaxThreads)
+			{
+				FThreadBuffer* Buffer = new FThreadBuffer;
+				Buffer->ThreadId = FPlatformTLS::GetCurrentThreadId();
+				Buffer->NumEvents = 0;
+
+				// Publish the buffer once it's initialized, captures skip buffers that aren't published yet
+				FPlatformMisc::MemoryBarrier();
+				ThreadBuffers[BufferIndex] = Buffer;
+				CurrentThreadBuffer = Buffer;
+			}
+			else
+			{
+				bCurrentThreadUntracked = true;
+			}
+		}
+		return CurrentThreadBuffer;
+	}
+
+	static double CyclesToMicroseconds(uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles) * 1000.0;
+	}
+
+	/** Writes the events of the frames that ended with a hitch as a Chrome trace */
+	static void WriteCapture(double HitchMS)
+	{
+		const uint32 NumCaptureFrames = (uint32)FMath::Clamp<int32>(GHitchCaptureNumFrames, 1, FMath::Min(NumFrames, MaxFrames));
+		const FFrame& FirstFrame = Frames[(NumFrames - NumCaptureFrames) % MaxFrames];
+		const FFrame& HitchFrame = Frames[(NumFrames - 1) % MaxFrames];
+		const uint64 WindowStart = FirstFrame.StartCycles;
+		const uint64 WindowEnd = HitchFrame.EndCycles;
+
+		TArray<FString> TimerNames;
+		for (int32 TimerIndex = 0; TimerIndex < FPerformanceTrackingTimers::GetNumTimers(); ++TimerIndex)
+		{
+			TimerNames.Add(FPerformanceTrackingTimers::GetTimerName(TimerIndex).ToString());
+		}
+
+		FString Trace;
+		Trace.Reserve(256 * 1024);
+		Trace += TEXT("{\"traceEvents\":[\n");
+
+		const TCHAR* Separator = TEXT("");
+		auto AddEvent = [&Trace, &Separator](const FString& Event)
+		{
+			Trace += Separator;
+			Trace += Event;
+			Separator = TEXT(",\n");
+		};
+
+		// Frames on the game thread timeline, with the time of the other threads the engine measures for each of them
+		const double CyclesToMS = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+		for (uint32 FrameIndex = NumFrames - NumCaptureFrames; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			const FFrame& Frame = Frames[FrameIndex % MaxFrames];
+			AddEvent(FString::Printf(TEXT("{\"name\":\"Frame %llu\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"GameThreadMS\":%.3f,\"RenderThreadMS\":%.3f,\"RHIThreadMS\":%.3f,\"GPUMS\":%.3f}}"),
+				Frame.FrameNumber, GGameThreadId, CyclesToMicroseconds(Frame.StartCycles - WindowStart), CyclesToMicroseconds(Frame.EndCycles - Frame.StartCycles),
+				Frame.GameThreadCycles * CyclesToMS, Frame.RenderThreadCycles * CyclesToMS, Frame.RHIThreadCycles * CyclesToMS, Frame.GPUCycles * CyclesToMS));
+		}
+
+		const int32 LocalNumThreadBuffers = FMath::Min<int32>(NumThreadBuffers, MaxThreads);
+		for (int32 BufferIndex = 0; BufferIndex < LocalNumThreadBuffers; ++BufferIndex)
+		{
+			const FThreadBuffer* Buffer = ThreadBuffers[BufferIndex];
+			if (!Buffer)
+			{
+				continue;
+			}
+
+			FString ThreadName = FThreadManager::GetThreadName(Buffer->ThreadId);
+			if (ThreadName.IsEmpty())
+			{
+				ThreadName = FString::Printf(TEXT("Thread %u"), Buffer->ThreadId);
+			}
+			AddEvent(FString::Printf(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}"), Buffer->ThreadId, *ThreadName.ReplaceCharWithEscapedChar()));
+
+			const uint32 LocalNumEvents = Buffer->NumEvents;
+			const uint32 FirstEvent = LocalNumEvents > EventsPerThread ? LocalNumEvents - EventsPerThread : 0;
+			for (uint32 EventIndex = FirstEvent; EventIndex < LocalNumEvents; ++EventIndex)
+			{
+				const FEvent& Event = Buffer->Events[EventIndex & (EventsPerThread - 1)];
+				if (Event.StartCycles + Event.DurationCycles < WindowStart || Event.StartCycles > WindowEnd || !TimerNames.IsValidIndex(Event.TimerIndex))
+				{
+					continue;
+				}
+
+				// Scopes that started before the first frame are clipped to it
+				const uint64 StartCycles = FMath::Max(Event.StartCycles, WindowStart);
+				const uint64 EndCycles = Event.StartCycles + Event.DurationCycles;
+				AddEvent(FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}"),
+					*TimerNames[Event.TimerIndex], Buffer->ThreadId, CyclesToMicroseconds(StartCycles - WindowStart), CyclesToMicroseconds(EndCycles - StartCycles)));
+			}
+		}
+
+		Trace += TEXT("\n]}\n");
+
+		const FString Filename = FPaths::ProfilingDir() / TEXT("Hitches") / FString::Printf(TEXT("Hitch_%s_Frame%llu_%.0fms.json"), *FDateTime::Now().ToString(), HitchFrame.FrameNumber, HitchMS);
+		UE_LOG(LogHitchCapture, Log, TEXT("Frame %llu hitched for %.2f ms, writing the last %u frames to %s"), HitchFrame.FrameNumber, HitchMS, NumCaptureFrames, *Filename);
+
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Filename, Trace = MoveTemp(Trace)]()
+		{
+			FFileHelper::SaveStringToFile(Trace, *Filename);
+		});
+	}
+}
+
+void FHitchCapture::RecordEvent(int32 TimerIndex, uint64 StartCycles, uint64 EndCycles)
+{
+	using namespace HitchCapture;
+
+	if (FThreadBuffer* Buffer = GetThreadBuffer())
+	{
+		FEvent& Event = Buffer->Events[Buffer->NumEvents & (EventsPerThread - 1)];
+		Event.StartCycles = StartCycles;
+		Event.DurationCycles = (uint32)FMath::Min<uint64>(EndCycles - StartCycles, MAX_uint32);
+		Event.TimerIndex = TimerIndex;
+		Buffer->NumEvents = Buffer->NumEvents + 1;
+	}
+}
+
+void FHitchCapture::EndFrame()
+{
+	using namespace HitchCapture;
+
+	check(IsInGameThread());
+
+	bEnabled = GHitchCapture != 0 && NumCaptures < GHitchCaptureMaxCaptures;
+	if (!bEnabled)
+	{
+		LastFrameEndCycles = 0;
+		return;
+	}
+
+	const uint64 CurrentCycles = FPlatformTime::Cycles64();
+	if (LastFrameEndCycles == 0)
+	{
+		LastFrameEndCycles = CurrentCycles;
+		return;
+	}
+
+	FFrame& Frame = Frames[NumFrames++ % MaxFrames];
+	Frame.FrameNumber = GFrameCounter;
+	Frame.StartCycles = LastFrameEndCycles;
+	Frame.EndCycles = CurrentCycles;
+	Frame.GameThreadCycles = GGameThreadTime;
+	Frame.RenderThreadCycles = GRenderThreadTime;
+	Frame.RHIThreadCycles = GRHIThreadTime;
+	Frame.GPUCycles = GGPUFrameTime;
+	LastFrameEndCycles = CurrentCycles;
+
+	const double FrameMS = FPlatformTime::ToMilliseconds64(CurrentCycles - Frame.StartCycles);
+	if (FrameMS > GHitchCaptureThresholdMS)
+	{
+		WriteCapture(FrameMS);
+		++NumCaptures;
+
+		// Don't count the capture in the next frame
+		LastFrameEndCycles = FPlatformTime::Cycles64();
+	}
+}
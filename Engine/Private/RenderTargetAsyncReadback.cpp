@@ -0,0 +1,263 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RenderTargetAsyncReadback.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+#include "RenderingThread.h"
+#include "RenderResource.h"
+#include "RHICommandList.h"
+#include "TextureResource.h"
+#include "Tickable.h"
+#include "Engine/TextureRenderTarget2D.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRenderTargetReadback, Log, All);
+
+static int32 GRenderTargetReadbackMaxPooledStagingTextures = 4;
+static FAutoConsoleVariableRef CVarRenderTargetReadbackMaxPooledStagingTextures(
+	TEXT("r.RenderTargetReadback.MaxPooledStagingTextures"),
+	GRenderTargetReadbackMaxPooledStagingTextures,
+	TEXT("Number of staging textures FRenderTargetAsyncReadback keeps for later reads once their read is done."),
+	ECVF_Default);
+
+namespace RenderTargetAsyncReadback
+{
+	struct FStagingTexture
+	{
+		FTexture2DRHIRef Texture;
+		FIntPoint Size;
+		EPixelFormat Format;
+	};
+
+	struct FPendingRead
+	{
+		FStagingTexture Staging;
+		FGPUFenceRHIRef Fence;
+		FRenderTargetReadbackResult Result;
+		FRenderTargetAsyncReadback::FOnReadbackComplete OnComplete;
+	};
+
+	/** Render thread only. A render resource, so the staging textures are released with the RHI. */
+	class FReadbackResources : public FRenderResource
+	{
+	public:
+		TArray<FStagingTexture> FreeStagingTextures;
+		TArray<TUniquePtr<FPendingRead>> PendingReads;
+
+		virtual void ReleaseDynamicRHI() override
+		{
+			FreeStagingTextures.Empty();
+			PendingReads.Empty();
+		}
+	};
+
+	static TGlobalResource<FReadbackResources> ReadbackResources;
+
+	/** Game thread only */
+	static int32 NumPendingReads = 0;
+
+	static bool IsSupportedFormat(EPixelFormat Format)
+	{
+		return Format == PF_B8G8R8A8 || Format == PF_R8G8B8A8 || Format == PF_FloatRGBA;
+	}
+
+	static FStagingTexture AcquireStagingTexture(FIntPoint Size, EPixelFormat Format)
+	{
+		for (int32 Index = 0; Index < ReadbackResources.FreeStagingTextures.Num(); ++Index)
+		{
+			if (ReadbackResources.FreeStagingTextures[Index].Size == Size && ReadbackResources.FreeStagingTextures[Index].Format == Format)
+			{
+				FStagingTexture Staging = ReadbackResources.FreeStagingTextures[Index];
+				ReadbackResources.FreeStagingTextures.RemoveAt(Index, 1, false);
+				return Staging;
+			}
+		}
+
+		FRHIResourceCreateInfo CreateInfo;
+		FStagingTexture Staging;
+		Staging.Texture = RHICreateTexture2D(Size.X, Size.Y, Format, 1, 1, TexCreate_CPUReadback, CreateInfo);
+		Staging.Size = Size;
+		Staging.Format = Format;
+		return Staging;
+	}
+
+	static void ReleaseStagingTexture(FStagingTexture&& Staging)
+	{
+		// Oldest first, so the textures of sizes that aren't read anymore are the ones dropped
+		ReadbackResources.FreeStagingTextures.Add(MoveTemp(Staging));
+		while (ReadbackResources.FreeStagingTextures.Num() > FMath::Max(GRenderTargetReadbackMaxPooledStagingTextures, 0))
+		{
+			ReadbackResources.FreeStagingTextures.RemoveAt(0, 1, false);
+		}
+	}
+
+	/** Converts the mapped staging texture into the result's pixels, RowPitch in pixels */
+	static bool CopyPixels(const void* Data, int32 RowPitch, FRenderTargetReadbackResult& Result)
+	{
+		const int32 Width = Result.Rect.Width();
+		const int32 Height = Result.Rect.Height();
+
+		switch (Result.Format)
+		{
+		case PF_B8G8R8A8:
+			Result.Pixels.SetNumUninitialized(Width * Height);
+			for (int32 Y = 0; Y < Height; ++Y)
+			{
+				FMemory::Memcpy(&Result.Pixels[Y * Width], (const FColor*)Data + Y * RowPitch, Width * sizeof(FColor));
+			}
+			return true;
+
+		case PF_R8G8B8A8:
+			Result.Pixels.SetNumUninitialized(Width * Height);
+			for (int32 Y = 0; Y < Height; ++Y)
+			{
+				const FColor* Row = (const FColor*)Data + Y * RowPitch;
+				for (int32 X = 0; X < Width; ++X)
+				{
+					// Same layout as FColor with red and blue swapped
+					const FColor& Texel = Row[X];
+					Result.Pixels[Y * Width + X] = FColor(Texel.B, Texel.G, Texel.R, Texel.A);
+				}
+			}
+			return true;
+
+		case PF_FloatRGBA:
+			Result.Pixels.SetNumUninitialized(Width * Height);
+			Result.LinearPixels.SetNumUninitialized(Width * Height);
+			for (int32 Y = 0; Y < Height; ++Y)
+			{
+				const FFloat16Color* Row = (const FFloat16Color*)Data + Y * RowPitch;
+				for (int32 X = 0; X < Width; ++X)
+				{
+					const FLinearColor LinearColor(Row[X]);
+					Result.LinearPixels[Y * Width + X] = LinearColor;
+					Result.Pixels[Y * Width + X] = LinearColor.ToFColor(true);
+				}
+			}
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	static void Deliver(TUniquePtr<FPendingRead> PendingRead)
+	{
+		AsyncTask(ENamedThreads::GameThread, [PendingRead = MoveTemp(PendingRead)]() mutable
+		{
+			--NumPendingReads;
+			PendingRead->OnComplete(MoveTemp(PendingRead->Result));
+		});
+	}
+
+	/** Maps the staging textures of the reads the GPU is done with and hands their pixels to the game thread */
+	static void PollPendingReads(FRHICommandListImmediate& RHICmdList)
+	{
+		for (int32 Index = 0; Index < ReadbackResources.PendingReads.Num(); )
+		{
+			TUniquePtr<FPendingRead>& PendingRead = ReadbackResources.PendingReads[Index];
+			if (!PendingRead->Fence->Poll())
+			{
+				++Index;
+				continue;
+			}
+
+			void* Data = nullptr;
+			int32 RowPitch = 0;
+			int32 MappedHeight = 0;
+			RHICmdList.MapStagingSurface(PendingRead->Staging.Texture, PendingRead->Fence, Data, RowPitch, MappedHeight);
+			PendingRead->Result.bSuccess = Data && CopyPixels(Data, RowPitch, PendingRead->Result);
+			RHICmdList.UnmapStagingSurface(PendingRead->Staging.Texture);
+
+			ReleaseStagingTexture(MoveTemp(PendingRead->Staging));
+			Deliver(MoveTemp(PendingRead));
+			ReadbackResources.PendingReads.RemoveAt(Index, 1, false);
+		}
+	}
+
+	/** Polls the reads once a frame while there are any */
+	class FPollTicker : public FTickableGameObject
+	{
+	public:
+		virtual void Tick(float DeltaTime) override
+		{
+			ENQUEUE_RENDER_COMMAND(PollRenderTargetReadbacks)(
+				[](FRHICommandListImmediate& RHICmdList)
+				{
+					PollPendingReads(RHICmdList);
+				});
+		}
+
+		virtual bool IsTickable() const override { return NumPendingReads > 0; }
+		virtual bool IsTickableWhenPaused() const override { return true; }
+		virtual bool IsTickableInEditor() const override { return true; }
+		virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(FRenderTargetAsyncReadbackPoll, STATGROUP_Tickables); }
+	};
+
+	/** Created with the first read and kept for the lifetime of the process */
+	static FPollTicker* PollTicker = nullptr;
+}
+
+void FRenderTargetAsyncReadback::ReadPixels(UTextureRenderTarget2D* RenderTarget, FOnReadbackComplete OnComplete, FIntRect Rect)
+{
+	using namespace RenderTargetAsyncReadback;
+
+	check(IsInGameThread());
+
+	TUniquePtr<FPendingRead> PendingRead = MakeUnique<FPendingRead>();
+	PendingRead->OnComplete = MoveTemp(OnComplete);
+
+	FTextureRenderTargetResource* RenderTargetResource = RenderTarget ? RenderTarget->GameThread_GetRenderTargetResource() : nullptr;
+	if (!RenderTargetResource || !IsSupportedFormat(RenderTarget->GetFormat()))
+	{
+		UE_CLOG(RenderTargetResource, LogRenderTargetReadback, Warning, TEXT("Can't read %s asynchronously, format %s isn't supported."), *RenderTarget->GetName(), GetPixelFormatString(RenderTarget->GetFormat()));
+		++NumPendingReads;
+		Deliver(MoveTemp(PendingRead));
+		return;
+	}
+
+	const FIntRect FullRect(0, 0, RenderTarget->SizeX, RenderTarget->SizeY);
+	if (Rect.IsEmpty())
+	{
+		Rect = FullRect;
+	}
+	Rect.Clip(FullRect);
+
+	PendingRead->Result.Rect = Rect;
+	PendingRead->Result.Format = RenderTarget->GetFormat();
+
+	if (!PollTicker)
+	{
+		PollTicker = new FPollTicker();
+	}
+	++NumPendingReads;
+
+	ENQUEUE_RENDER_COMMAND(ReadRenderTargetAsync)(
+		[RenderTargetResource, PendingRead = MoveTemp(PendingRead)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			FRHITexture* SourceTexture = RenderTargetResource->TextureRHI;
+			const FIntRect& ReadRect = PendingRead->Result.Rect;
+			if (!SourceTexture || ReadRect.IsEmpty() || SourceTexture->GetFormat() != PendingRead->Result.Format)
+			{
+				Deliver(MoveTemp(PendingRead));
+				return;
+			}
+
+			PendingRead->Staging = AcquireStagingTexture(ReadRect.Size(), PendingRead->Result.Format);
+
+			FRHICopyTextureInfo CopyInfo;
+			CopyInfo.Size = FIntVector(ReadRect.Width(), ReadRect.Height(), 1);
+			CopyInfo.SourcePosition = FIntVector(ReadRect.Min.X, ReadRect.Min.Y, 0);
+			RHICmdList.CopyTexture(SourceTexture, PendingRead->Staging.Texture, CopyInfo);
+			RHICmdList.TransitionResource(EResourceTransitionAccess::EReadable, PendingRead->Staging.Texture);
+
+			PendingRead->Fence = RHICreateGPUFence(TEXT("RenderTargetReadback"));
+			RHICmdList.WriteGPUFence(PendingRead->Fence);
+
+			ReadbackResources.PendingReads.Add(MoveTemp(PendingRead));
+		});
+}
+
+int32 FRenderTargetAsyncReadback::GetNumPendingReads()
+{
+	return RenderTargetAsyncReadback::NumPendingReads;
+}
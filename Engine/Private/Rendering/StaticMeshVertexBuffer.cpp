@@ -142,6 +142,46 @@ void FStaticMeshVertexBuffer::ConvertHalfTexcoordsToFloat(const uint8* InData)
 	OriginalTexcoordData = nullptr;
 }
 
+bool FStaticMeshVertexBuffer::ConvertTexcoordsToHalfIfWithinError(float MaxError)
+{
+	if (!GetUseFullPrecisionUVs() || !TexcoordData || NumVertices == 0 || !GVertexElementTypeSupport.IsSupported(VET_Half2))
+	{
+		return false;
+	}
+
+	const uint32 NumTexcoordsToConvert = NumVertices * GetNumTexCoords();
+	const FVector2D* SourceTexcoordDataPtr = (const FVector2D*)TexcoordDataPtr;
+	for (uint32 i = 0; i < NumTexcoordsToConvert; i++)
+	{
+		const FVector2D HalfTexcoord = FVector2DHalf(SourceTexcoordDataPtr[i]);
+		if (!(FMath::Abs(HalfTexcoord.X - SourceTexcoordDataPtr[i].X) <= MaxError && FMath::Abs(HalfTexcoord.Y - SourceTexcoordDataPtr[i].Y) <= MaxError))
+		{
+			return false;
+		}
+	}
+
+	SetUseFullPrecisionUVs(false);
+
+	FStaticMeshVertexDataInterface* OriginalTexcoordData = TexcoordData;
+
+	typedef TStaticMeshVertexUVsDatum<typename TStaticMeshVertexUVsTypeSelector<EStaticMeshVertexUVType::Default>::UVsTypeT> UVType;
+	TexcoordData = new TStaticMeshVertexData<UVType>(OriginalTexcoordData->GetAllowCPUAccess());
+	TexcoordData->ResizeBuffer(NumTexcoordsToConvert);
+	TexcoordDataPtr = TexcoordData->GetDataPointer();
+	TexcoordStride = sizeof(UVType);
+
+	FVector2DHalf* DestTexcoordDataPtr = (FVector2DHalf*)TexcoordDataPtr;
+	for (uint32 i = 0; i < NumTexcoordsToConvert; i++)
+	{
+		*DestTexcoordDataPtr++ = *SourceTexcoordDataPtr++;
+	}
+
+	delete OriginalTexcoordData;
+	OriginalTexcoordData = nullptr;
+
+	return true;
+}
+
 
 void FStaticMeshVertexBuffer::AppendVertices( const FStaticMeshBuildVertex* Vertices, const uint32 NumVerticesToAppend )
 {
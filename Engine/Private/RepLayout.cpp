@@ -23,11 +23,14 @@
 #include "Templates/AndOrNot.h"
 #include "PushModelPerNetDriverState.h"
 #include "Net/Core/Trace/NetTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Misc/Parse.h"
 
 DECLARE_CYCLE_STAT(TEXT("RepLayout AddPropertyCmd"), STAT_RepLayout_AddPropertyCmd, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("RepLayout InitFromObjectClass"), STAT_RepLayout_InitFromObjectClass, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("RepLayout BuildShadowOffsets"), STAT_RepLayout_BuildShadowOffsets, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("RepLayout DeltaSerializeFastArray"), STAT_RepLayout_DeltaSerializeFastArray, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("PushModel Skipped Compares"), STAT_NetPushModelSkippedCompares, STATGROUP_Game);
 
 // LogRepProperties is very spammy, and the logs are in a very hot code path,
 // so prevent anything less than a warning from even being compiled in on
@@ -47,6 +50,10 @@ static FAutoConsoleVariableRef CVarDoReplicationContextString(TEXT("net.ContextD
 int32 GNetSharedSerializedData = 1;
 static FAutoConsoleVariableRef CVarNetShareSerializedData(TEXT("net.ShareSerializedData"), GNetSharedSerializedData, TEXT(""));
 
+int32 GNetShareSerializedDataOnMiss = 1;
+static FAutoConsoleVariableRef CVarNetShareSerializedDataOnMiss(TEXT("net.ShareSerializedDataOnMiss"), GNetShareSerializedDataOnMiss,
+	TEXT("If true and net.ShareSerializedData is enabled, shareable properties that weren't in the initial shared build (e.g. because a connection fell behind) are added to the shared data the first time they're sent."));
+
 int32 GNetVerifyShareSerializedData = 0;
 static FAutoConsoleVariableRef CVarNetVerifyShareSerializedData(TEXT("net.VerifyShareSerializedData"), GNetVerifyShareSerializedData, TEXT(""));
 
@@ -73,6 +80,308 @@ constexpr bool GbPushModelValidateProperties = false;
 
 #endif
 
+#if WITH_PUSH_MODEL
+
+static bool GbPushModelSkipUndirtiedCompares = true;
+static FAutoConsoleVariableRef CVarPushModelSkipUndirtiedCompares(TEXT("net.PushModelSkipUndirtiedCompares"), GbPushModelSkipUndirtiedCompares,
+	TEXT("When true, objects whose RepLayout has full Push Model support will skip CompareProperties entirely if none of their properties have been marked dirty."));
+
+static bool GbPushModelTrackCompareSkips = false;
+static FAutoConsoleVariableRef CVarPushModelTrackCompareSkips(TEXT("net.PushModelTrackCompareSkips"), GbPushModelTrackCompareSkips,
+	TEXT("When true, track the number of skipped vs. performed property compares per class. Use net.PushModelDumpCompareSkips to print the results."));
+
+namespace UE4_RepLayout_Private
+{
+	struct FPushModelCompareSkipCounts
+	{
+		uint64 NumSkipped = 0;
+		uint64 NumCompared = 0;
+	};
+
+	static TMap<FName, FPushModelCompareSkipCounts> PushModelCompareSkipCounts;
+
+	static void TrackPushModelCompare(const UStruct* Owner, const bool bSkipped)
+	{
+		if (GbPushModelTrackCompareSkips && Owner)
+		{
+			FPushModelCompareSkipCounts& Counts = PushModelCompareSkipCounts.FindOrAdd(Owner->GetFName());
+			++(bSkipped ? Counts.NumSkipped : Counts.NumCompared);
+		}
+	}
+
+	static void DumpPushModelCompareSkips(const TArray<FString>& Args)
+	{
+		if (Args.Contains(TEXT("-reset")))
+		{
+			PushModelCompareSkipCounts.Reset();
+			return;
+		}
+
+		PushModelCompareSkipCounts.ValueSort([](const FPushModelCompareSkipCounts& A, const FPushModelCompareSkipCounts& B)
+		{
+			return (A.NumSkipped + A.NumCompared) > (B.NumSkipped + B.NumCompared);
+		});
+
+		uint64 TotalSkipped = 0;
+		uint64 TotalCompared = 0;
+
+		UE_LOG(LogRep, Display, TEXT("Push Model compare skips (Class, Skipped, Compared, Skip %%):"));
+		for (const TPair<FName, FPushModelCompareSkipCounts>& Pair : PushModelCompareSkipCounts)
+		{
+			const FPushModelCompareSkipCounts& Counts = Pair.Value;
+			const uint64 Total = Counts.NumSkipped + Counts.NumCompared;
+			UE_LOG(LogRep, Display, TEXT("  %s, %llu, %llu, %.2f"), *Pair.Key.ToString(), Counts.NumSkipped, Counts.NumCompared, Total > 0 ? (100.0 * Counts.NumSkipped) / Total : 0.0);
+
+			TotalSkipped += Counts.NumSkipped;
+			TotalCompared += Counts.NumCompared;
+		}
+
+		const uint64 Total = TotalSkipped + TotalCompared;
+		UE_LOG(LogRep, Display, TEXT("Total: Skipped=%llu Compared=%llu Skip %%=%.2f"), TotalSkipped, TotalCompared, Total > 0 ? (100.0 * TotalSkipped) / Total : 0.0);
+	}
+}
+
+static FAutoConsoleCommand PushModelDumpCompareSkipsCommand(
+	TEXT("net.PushModelDumpCompareSkips"),
+	TEXT("Prints the per-class ratio of skipped to performed property compares gathered while net.PushModelTrackCompareSkips is enabled. Pass -reset to clear the counts."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&UE4_RepLayout_Private::DumpPushModelCompareSkips));
+
+#endif // WITH_PUSH_MODEL
+
+static int32 GNetRepLayoutCostTracking = 0;
+static FAutoConsoleVariableRef CVarNetRepLayoutCostTracking(TEXT("net.RepLayoutCostTracking"), GNetRepLayoutCostTracking,
+	TEXT("Gathers CompareProperties / SendProperties time and bits sent per RepLayout, reported in the ReplicationCost CSV category and by net.RepLayoutCost.Dump.\n")
+	TEXT("0: Disabled. 1: Per class / struct. 2: Per class / struct and per property."));
+
+CSV_DEFINE_CATEGORY(ReplicationCost, WITH_SERVER_CODE);
+
+namespace UE4_RepLayout_Private
+{
+	struct FTrackedRepLayoutCost
+	{
+		const FRepLayout* RepLayout;
+		FName OwnerName;
+		TUniquePtr<FRepLayoutCost> Cost;
+	};
+
+	static TArray<FTrackedRepLayoutCost> TrackedRepLayoutCosts;
+	static uint64 RepLayoutCostLastEndFrame = 0;
+
+	static void DumpRepLayoutCost(const TArray<FString>& Args)
+	{
+		if (Args.Contains(TEXT("-reset")))
+		{
+			FRepLayoutCostTracker::Reset();
+			return;
+		}
+
+		int32 MaxLayouts = 50;
+		for (const FString& Arg : Args)
+		{
+			FParse::Value(*Arg, TEXT("Max="), MaxLayouts);
+		}
+
+		FRepLayoutCostTracker::Dump(*GLog, MaxLayouts);
+	}
+}
+
+static FAutoConsoleCommand RepLayoutCostDumpCommand(
+	TEXT("net.RepLayoutCost.Dump"),
+	TEXT("Prints the replication cost gathered while net.RepLayoutCostTracking is enabled, most expensive first. Max=N limits the number of classes printed, -reset clears the counts."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&UE4_RepLayout_Private::DumpRepLayoutCost));
+
+bool FRepLayoutCostTracker::IsEnabled()
+{
+	return GNetRepLayoutCostTracking > 0;
+}
+
+bool FRepLayoutCostTracker::IsPerPropertyEnabled()
+{
+	return GNetRepLayoutCostTracking > 1;
+}
+
+FRepLayoutCost& FRepLayoutCostTracker::FindOrAddCost(const FRepLayout& RepLayout)
+{
+	if (RepLayout.TrackedCost == nullptr)
+	{
+		UE4_RepLayout_Private::FTrackedRepLayoutCost& Tracked = UE4_RepLayout_Private::TrackedRepLayoutCosts.AddDefaulted_GetRef();
+		Tracked.RepLayout = &RepLayout;
+		Tracked.OwnerName = RepLayout.Owner ? RepLayout.Owner->GetFName() : NAME_None;
+		Tracked.Cost = MakeUnique<FRepLayoutCost>();
+
+		FRepLayoutCost& Cost = *Tracked.Cost;
+		Cost.ParentFrame.SetNum(RepLayout.Parents.Num());
+		Cost.ParentTotal.SetNum(RepLayout.Parents.Num());
+
+		const FString OwnerString = Tracked.OwnerName.ToString();
+		Cost.StatNames.CompareMS = FName(*(OwnerString + TEXT("_CompareMS")));
+		Cost.StatNames.SendMS = FName(*(OwnerString + TEXT("_SendMS")));
+		Cost.StatNames.SendBits = FName(*(OwnerString + TEXT("_SendBits")));
+
+		RepLayout.TrackedCost = &Cost;
+	}
+
+	return *RepLayout.TrackedCost;
+}
+
+void FRepLayoutCostTracker::RemoveLayout(const FRepLayout& RepLayout)
+{
+	UE4_RepLayout_Private::TrackedRepLayoutCosts.RemoveAllSwap([&RepLayout](const UE4_RepLayout_Private::FTrackedRepLayoutCost& Tracked)
+	{
+		return Tracked.RepLayout == &RepLayout;
+	});
+
+	RepLayout.TrackedCost = nullptr;
+}
+
+void FRepLayoutCostTracker::Reset()
+{
+	for (UE4_RepLayout_Private::FTrackedRepLayoutCost& Tracked : UE4_RepLayout_Private::TrackedRepLayoutCosts)
+	{
+		Tracked.RepLayout->TrackedCost = nullptr;
+	}
+
+	UE4_RepLayout_Private::TrackedRepLayoutCosts.Reset();
+}
+
+void FRepLayoutCostTracker::EndFrame()
+{
+	using namespace UE4_RepLayout_Private;
+
+	if (RepLayoutCostLastEndFrame == GFrameCounter || TrackedRepLayoutCosts.Num() == 0)
+	{
+		return;
+	}
+
+	RepLayoutCostLastEndFrame = GFrameCounter;
+
+#if CSV_PROFILER
+	FCsvProfiler* Profiler = FCsvProfiler::Get();
+	const bool bRecordCsvStats = Profiler->IsCapturing();
+	const double MSPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+
+	auto RecordStats = [Profiler, MSPerCycle](const FRepLayoutCostStatNames& StatNames, const FRepLayoutCostCounters& Counters)
+	{
+		if (Counters.NumCompares > 0)
+		{
+			Profiler->RecordCustomStat(StatNames.CompareMS, CSV_CATEGORY_INDEX(ReplicationCost), static_cast<float>(Counters.CompareCycles * MSPerCycle), ECsvCustomStatOp::Set);
+		}
+
+		if (Counters.NumSends > 0)
+		{
+			Profiler->RecordCustomStat(StatNames.SendMS, CSV_CATEGORY_INDEX(ReplicationCost), static_cast<float>(Counters.SendCycles * MSPerCycle), ECsvCustomStatOp::Set);
+			Profiler->RecordCustomStat(StatNames.SendBits, CSV_CATEGORY_INDEX(ReplicationCost), static_cast<float>(Counters.SendBits), ECsvCustomStatOp::Set);
+		}
+	};
+#endif
+
+	for (FTrackedRepLayoutCost& Tracked : TrackedRepLayoutCosts)
+	{
+		FRepLayoutCost& Cost = *Tracked.Cost;
+		if (Cost.Frame.IsEmpty())
+		{
+			continue;
+		}
+
+#if CSV_PROFILER
+		if (bRecordCsvStats)
+		{
+			RecordStats(Cost.StatNames, Cost.Frame);
+		}
+#endif
+
+		Cost.Total.Add(Cost.Frame);
+		Cost.Frame = FRepLayoutCostCounters();
+
+		for (int32 ParentIndex = 0; ParentIndex < Cost.ParentFrame.Num(); ++ParentIndex)
+		{
+			FRepLayoutCostCounters& ParentFrame = Cost.ParentFrame[ParentIndex];
+			if (ParentFrame.IsEmpty())
+			{
+				continue;
+			}
+
+#if CSV_PROFILER
+			if (bRecordCsvStats)
+			{
+				if (Cost.ParentStatNames.Num() == 0)
+				{
+					Cost.ParentStatNames.SetNum(Cost.ParentFrame.Num());
+				}
+
+				FRepLayoutCostStatNames& ParentStatNames = Cost.ParentStatNames[ParentIndex];
+				if (ParentStatNames.CompareMS.IsNone())
+				{
+					const FString ParentString = FString::Printf(TEXT("%s.%s"), *Tracked.OwnerName.ToString(), *Tracked.RepLayout->Parents[ParentIndex].CachedPropertyName.ToString());
+					ParentStatNames.CompareMS = FName(*(ParentString + TEXT("_CompareMS")));
+					ParentStatNames.SendMS = FName(*(ParentString + TEXT("_SendMS")));
+					ParentStatNames.SendBits = FName(*(ParentString + TEXT("_SendBits")));
+				}
+
+				RecordStats(ParentStatNames, ParentFrame);
+			}
+#endif
+
+			Cost.ParentTotal[ParentIndex].Add(ParentFrame);
+			ParentFrame = FRepLayoutCostCounters();
+		}
+	}
+}
+
+void FRepLayoutCostTracker::Dump(FOutputDevice& Ar, const int32 MaxLayouts)
+{
+	using namespace UE4_RepLayout_Private;
+
+	// Include anything gathered since the last EndFrame
+	RepLayoutCostLastEndFrame = 0;
+	EndFrame();
+
+	TArray<const FTrackedRepLayoutCost*> SortedCosts;
+	SortedCosts.Reserve(TrackedRepLayoutCosts.Num());
+	for (const FTrackedRepLayoutCost& Tracked : TrackedRepLayoutCosts)
+	{
+		SortedCosts.Add(&Tracked);
+	}
+
+	auto TotalCycles = [](const FRepLayoutCostCounters& Counters) { return Counters.CompareCycles + Counters.SendCycles; };
+	Algo::Sort(SortedCosts, [&TotalCycles](const FTrackedRepLayoutCost* A, const FTrackedRepLayoutCost* B)
+	{
+		return TotalCycles(A->Cost->Total) > TotalCycles(B->Cost->Total);
+	});
+
+	const double MSPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+
+	Ar.Logf(TEXT("RepLayout cost (Name, CompareMS, Compares, SendMS, Sends, SendKBits):"));
+	for (int32 i = 0; i < FMath::Min(MaxLayouts, SortedCosts.Num()); ++i)
+	{
+		const FTrackedRepLayoutCost& Tracked = *SortedCosts[i];
+		const FRepLayoutCostCounters& Total = Tracked.Cost->Total;
+
+		Ar.Logf(TEXT("  %s, %.3f, %u, %.3f, %u, %.2f"), *Tracked.OwnerName.ToString(), Total.CompareCycles * MSPerCycle, Total.NumCompares, Total.SendCycles * MSPerCycle, Total.NumSends, Total.SendBits / 1024.0);
+
+		TArray<int32, TInlineAllocator<32>> SortedParents;
+		for (int32 ParentIndex = 0; ParentIndex < Tracked.Cost->ParentTotal.Num(); ++ParentIndex)
+		{
+			if (!Tracked.Cost->ParentTotal[ParentIndex].IsEmpty())
+			{
+				SortedParents.Add(ParentIndex);
+			}
+		}
+
+		const TArray<FRepLayoutCostCounters>& ParentTotal = Tracked.Cost->ParentTotal;
+		Algo::Sort(SortedParents, [&ParentTotal, &TotalCycles](const int32 A, const int32 B)
+		{
+			return TotalCycles(ParentTotal[A]) > TotalCycles(ParentTotal[B]);
+		});
+
+		for (const int32 ParentIndex : SortedParents)
+		{
+			const FRepLayoutCostCounters& Parent = ParentTotal[ParentIndex];
+			Ar.Logf(TEXT("    %s, %.3f, %u, %.3f, %u, %.2f"), *Tracked.RepLayout->Parents[ParentIndex].CachedPropertyName.ToString(), Parent.CompareCycles * MSPerCycle, Parent.NumCompares, Parent.SendCycles * MSPerCycle, Parent.NumSends, Parent.SendBits / 1024.0);
+		}
+	}
+}
+
 int32 MaxRepArraySize = UNetworkSettings::DefaultMaxRepArraySize;
 int32 MaxRepArrayMemory = UNetworkSettings::DefaultMaxRepArrayMemory;
 
@@ -1077,6 +1386,10 @@ FRepLayout::FRepLayout()
 
 FRepLayout::~FRepLayout()
 {
+	if (TrackedCost)
+	{
+		FRepLayoutCostTracker::RemoveLayout(*this);
+	}
 }
 
 void FRepLayout::UpdateChangelistMgr(
@@ -1150,6 +1463,8 @@ struct FComparePropertiesSharedParams
 	TBitArray<> PropertiesCompared;
 	TBitArray<> PropertiesChanged;
 #endif
+	/** Set when net.RepLayoutCostTracking gathers per property costs. */
+	FRepLayoutCost* ParentCost = nullptr;
 };
 
 struct FComparePropertiesStackParams
@@ -1261,8 +1576,17 @@ namespace UE4_RepLayout_Private
 		const FComparePropertiesSharedParams& SharedParams,
 		FComparePropertiesStackParams& StackParams)
 	{
+		const uint64 StartCycles = SharedParams.ParentCost ? FPlatformTime::Cycles64() : 0;
+
 		const bool bDidPropertyChange = CompareParentProperty(ParentIndex, SharedParams, StackParams);
 
+		if (SharedParams.ParentCost)
+		{
+			FRepLayoutCostCounters& ParentCost = SharedParams.ParentCost->ParentFrame[ParentIndex];
+			ParentCost.CompareCycles += FPlatformTime::Cycles64() - StartCycles;
+			++ParentCost.NumCompares;
+		}
+
 	#if USE_NETWORK_PROFILER
 		if (SharedParams.bIsNetworkProfilerActive)
 		{
@@ -1482,6 +1806,39 @@ bool FRepLayout::CompareProperties(
 		return false;
 	}
 
+#if WITH_PUSH_MODEL
+	UE4PushModelPrivate::FPushModelPerNetDriverState* const PushModelState = UE4_RepLayout_Private::GetPerNetDriverState(RepChangelistState);
+
+	// If every property uses Push Model and nothing has been marked dirty, then there's nothing to compare.
+	// We can skip the compare entirely and leave CompareIndex alone, which lets ReplicateProperties early out too.
+	// Initial and roles only compares may need to consider properties regardless of dirty state, so those still go
+	// through the normal path.
+	const bool bCanSkipUndirtiedCompare = GbPushModelSkipUndirtiedCompares &&
+		PushModelState != nullptr &&
+		EnumHasAnyFlags(Flags, ERepLayoutFlags::FullPushSupport) &&
+		!RepFlags.bNetInitial &&
+		!RepFlags.bRolesOnly &&
+		!GbPushModelValidateProperties;
+
+	if (bCanSkipUndirtiedCompare)
+	{
+		const bool bHasDirtyProperties = PushModelState->GetDirtyProperties().Contains(true);
+		UE4_RepLayout_Private::TrackPushModelCompare(Owner, !bHasDirtyProperties);
+
+		if (!bHasDirtyProperties)
+		{
+			INC_DWORD_STAT_BY(STAT_NetPushModelSkippedCompares, 1);
+			return false;
+		}
+	}
+	else if (!RepFlags.bRolesOnly)
+	{
+		UE4_RepLayout_Private::TrackPushModelCompare(Owner, false);
+	}
+#else
+	UE4PushModelPrivate::FPushModelPerNetDriverState* const PushModelState = nullptr;
+#endif
+
 	RepChangelistState->CompareIndex++;
 
 	check((RepChangelistState->HistoryEnd - RepChangelistState->HistoryStart) < FRepChangelistState::MAX_CHANGE_HISTORY);
@@ -1507,7 +1864,7 @@ bool FRepLayout::CompareProperties(
 		RepState,
 		RepChangelistState,
 		(RepState ? RepState->RepChangedPropertyTracker.Get() : nullptr),
-		/*PushModelState=*/UE4_RepLayout_Private::GetPerNetDriverState(RepChangelistState),
+		/*PushModelState=*/PushModelState,
 		/*PushModelProperties=*/ LocalPushModelProperties,	
 		/*bValidateProperties=*/GbPushModelValidateProperties,
 		/*bIsNetworkProfilerActive=*/UE4_RepLayout_Private::IsNetworkProfilerComparisonTrackingEnabled()
@@ -1530,6 +1887,10 @@ bool FRepLayout::CompareProperties(
 	}
 	else
 	{
+		FRepLayoutCost* const LayoutCost = GetTrackedCost();
+		const uint64 CompareStartCycles = LayoutCost ? FPlatformTime::Cycles64() : 0;
+		SharedParams.ParentCost = FRepLayoutCostTracker::IsPerPropertyEnabled() ? LayoutCost : nullptr;
+
 #if USE_NETWORK_PROFILER 
 		const uint32 ReplicateParentPropertiesStartTime = SharedParams.bIsNetworkProfilerActive ? FPlatformTime::Cycles() : 0;
 		if (SharedParams.bIsNetworkProfilerActive)
@@ -1549,6 +1910,12 @@ bool FRepLayout::CompareProperties(
 	
 		CompareParentProperties(SharedParams, StackParams);
 
+		if (LayoutCost)
+		{
+			LayoutCost->Frame.CompareCycles += FPlatformTime::Cycles64() - CompareStartCycles;
+			++LayoutCost->Frame.NumCompares;
+		}
+
 		if (SharedParams.bIsNetworkProfilerActive)
 		{
 			NETWORK_PROFILER(GNetworkProfiler.TrackCompareProperties(Owner, FPlatformTime::Cycles() - ReplicateParentPropertiesStartTime, SharedParams.PropertiesCompared, SharedParams.PropertiesChanged, Parents, &FPropertyNameHelper::ConvertParentCmdToPropertyName););
@@ -2291,11 +2658,28 @@ void FRepLayout::FilterChangeListToActive(
 	OutProperties.Add(0);
 }
 
+/** Properties that can only ever be sent to a single connection aren't worth writing into the shared buffer. */
+static FORCEINLINE bool IsSharedSerializationUsefulForCondition(const ELifetimeCondition Condition)
+{
+	switch (Condition)
+	{
+		case COND_OwnerOnly:
+		case COND_AutonomousOnly:
+		case COND_ReplayOnly:
+		case COND_Never:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
 void FRepSerializationSharedInfo::CountBytes(FArchive& Ar) const
 {
 	GRANULAR_NETWORK_MEMORY_TRACKING_INIT(Ar, "FRepSerializationSharedInfo::CountBytes");
 
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SharedPropertyInfo", SharedPropertyInfo.CountBytes(Ar));
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SharedPropertyInfoIndex", SharedPropertyInfoIndex.CountBytes(Ar));
 
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("SerializedProperties",
 		if (FNetBitWriter const* const LocalSerializedProperties = SerializedProperties.Get())
@@ -2316,13 +2700,11 @@ const FRepSerializedPropertyInfo* FRepSerializationSharedInfo::WriteSharedProper
 	const bool bDoChecksum)
 {
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	check(!SharedPropertyInfo.ContainsByPredicate([&](const FRepSerializedPropertyInfo& Info)
-	{ 
-		return (Info.Guid == PropertyGuid); 
-	}));
+	check(!SharedPropertyInfoIndex.Contains(PropertyGuid));
 #endif
 
 	int32 InfoIndex = SharedPropertyInfo.Emplace();
+	SharedPropertyInfoIndex.Add(PropertyGuid, InfoIndex);
 
 	FRepSerializedPropertyInfo& SharedPropInfo = SharedPropertyInfo[InfoIndex];
 	SharedPropInfo.Guid = PropertyGuid;
@@ -2363,9 +2745,13 @@ void FRepLayout::SendProperties_r(
 	FRepHandleIterator& HandleIterator,
 	const FConstRepObjectDataBuffer SourceData,
 	const int32 ArrayDepth,
-	const FRepSerializationSharedInfo* const RESTRICT SharedInfo) const
+	FRepSerializationSharedInfo* const RESTRICT SharedInfo) const
 {
 	const bool bDoSharedSerialization = SharedInfo && !!GNetSharedSerializedData;
+	const bool bShareOnMiss = bDoSharedSerialization && SharedInfo->IsValid() && !!GNetShareSerializedDataOnMiss;
+
+	// TrackedCost is set up by SendProperties when cost tracking is enabled
+	FRepLayoutCost* const ParentCost = FRepLayoutCostTracker::IsPerPropertyEnabled() ? TrackedCost : nullptr;
 
 	while (HandleIterator.NextHandle())
 	{
@@ -2429,10 +2815,14 @@ void FRepLayout::SendProperties_r(
 		{
 			FGuid PropertyGuid(HandleIterator.CmdIndex, HandleIterator.ArrayIndex, ArrayDepth, (int32)((PTRINT)Data.Data & 0xFFFFFFFF));
 
-			SharedPropInfo = SharedInfo->SharedPropertyInfo.FindByPredicate([&](const FRepSerializedPropertyInfo& Info) 
-			{ 
-				return (Info.Guid == PropertyGuid); 
-			});
+			SharedPropInfo = SharedInfo->FindSharedProperty(PropertyGuid);
+
+			// This connection needs a property the initial build didn't include (e.g. it's behind on history).
+			// Write it once so any other connection in the same state can copy it.
+			if (!SharedPropInfo && bShareOnMiss && !EnumHasAnyFlags(ParentCmd.Flags, ERepParentFlags::IsCustomDelta) && IsSharedSerializationUsefulForCondition(ParentCmd.Condition))
+			{
+				SharedPropInfo = SharedInfo->WriteSharedProperty(Cmd, PropertyGuid, HandleIterator.CmdIndex, HandleIterator.Handle, Data.Data, true, bDoChecksum);
+			}
 		}
 
 		// Use shared serialization if was found
@@ -2480,6 +2870,13 @@ void FRepLayout::SendProperties_r(
 			}
 
 			NETWORK_PROFILER(GNetworkProfiler.TrackReplicateProperty(ParentCmd.Property, SharedPropInfo->PropBitLength, nullptr));
+
+			if (ParentCost)
+			{
+				FRepLayoutCostCounters& Cost = ParentCost->ParentFrame[Cmd.ParentIndex];
+				Cost.SendBits += SharedPropInfo->PropBitLength;
+				++Cost.NumSends;
+			}
 		}
 		else
 		{
@@ -2489,6 +2886,7 @@ void FRepLayout::SendProperties_r(
 			UE_NET_TRACE_DYNAMIC_NAME_SCOPE(Cmd.Property->GetFName(), Writer, GetTraceCollector(Writer), ENetTraceVerbosity::Trace);
 
 			const int32 NumStartBits = Writer.GetNumBits();
+			const uint64 StartCycles = ParentCost ? FPlatformTime::Cycles64() : 0;
 
 			// This property changed, so send it
 			Cmd.Property->NetSerializeItem(Writer, Writer.PackageMap, const_cast<uint8*>(Data.Data));
@@ -2498,6 +2896,14 @@ void FRepLayout::SendProperties_r(
 
 			NETWORK_PROFILER(GNetworkProfiler.TrackReplicateProperty(ParentCmd.Property, NumEndBits - NumStartBits, nullptr));
 
+			if (ParentCost)
+			{
+				FRepLayoutCostCounters& Cost = ParentCost->ParentFrame[Cmd.ParentIndex];
+				Cost.SendCycles += FPlatformTime::Cycles64() - StartCycles;
+				Cost.SendBits += NumEndBits - NumStartBits;
+				++Cost.NumSends;
+			}
+
 #ifdef ENABLE_PROPERTY_CHECKSUMS
 			if (bDoChecksum)
 			{
@@ -2522,7 +2928,7 @@ void FRepLayout::SendProperties(
 	UClass* ObjectClass,
 	FNetBitWriter& Writer,
 	TArray<uint16>& Changed,
-	const FRepSerializationSharedInfo& SharedInfo) const
+	FRepSerializationSharedInfo& SharedInfo) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetReplicateDynamicPropSendTime);
 
@@ -2549,6 +2955,9 @@ void FRepLayout::SendProperties(
 
 	UE_LOG(LogRepProperties, VeryVerbose, TEXT("SendProperties: Owner=%s, LastChangelistIndex=%d"), *Owner->GetPathName(), RepState->LastChangelistIndex);
 
+	FRepLayoutCost* const LayoutCost = GetTrackedCost();
+	const uint64 SendStartCycles = LayoutCost ? FPlatformTime::Cycles64() : 0;
+
 	FChangelistIterator ChangelistIterator(Changed, 0);
 	FRepHandleIterator HandleIterator(Owner, ChangelistIterator, Cmds, BaseHandleToCmdIndex, 0, 1, 0, Cmds.Num() - 1);
 
@@ -2558,6 +2967,13 @@ void FRepLayout::SendProperties(
 	{
 		// We actually wrote stuff
 		WritePropertyHandle(Writer, 0, bDoChecksum);
+
+		if (LayoutCost)
+		{
+			LayoutCost->Frame.SendCycles += FPlatformTime::Cycles64() - SendStartCycles;
+			LayoutCost->Frame.SendBits += Writer.GetNumBits() - NumBits;
+			++LayoutCost->Frame.NumSends;
+		}
 	}
 	else
 	{
@@ -5835,10 +6251,7 @@ void FRepLayout::SerializeProperties_r(
 		{
 			FGuid PropertyGuid(CmdIndex, ArrayIndex, ArrayDepth, (int32)((PTRINT)(const uint8*)(Data + Cmd) & 0xFFFFFFFF));
 
-			SharedPropInfo = SharedInfo.SharedPropertyInfo.FindByPredicate([&](const FRepSerializedPropertyInfo& Info) 
-			{ 
-				return (Info.Guid == PropertyGuid); 
-			});
+			SharedPropInfo = SharedInfo.FindSharedProperty(PropertyGuid);
 		}
 
 		// Use shared serialization state if it exists
@@ -6015,7 +6428,8 @@ void FRepLayout::BuildSharedSerialization_r(
 			continue;
 		}
 
-		if (EnumHasAnyFlags(Cmd.Flags, ERepLayoutCmdFlags::IsSharedSerialization))
+		// Owner only style conditions go to at most one connection, so there's nothing to share.
+		if (EnumHasAnyFlags(Cmd.Flags, ERepLayoutCmdFlags::IsSharedSerialization) && IsSharedSerializationUsefulForCondition(ParentCmd.Condition))
 		{
 			SharedInfo.WriteSharedProperty(Cmd, FGuid(HandleIterator.CmdIndex, HandleIterator.ArrayIndex, ArrayDepth, (int32)((PTRINT)Data.Data & 0xFFFFFFFF)), HandleIterator.CmdIndex, HandleIterator.Handle, Data.Data, bWriteHandle, bDoChecksum);
 		}
@@ -6787,7 +7201,7 @@ bool FRepLayout::DeltaSerializeFastArrayProperty(FFastArrayDeltaSerializeParams&
 				FDeltaArrayHistoryState& FastArrayState = DeltaChangelistState.ArrayStates[FastArrayNumber];
 
 
-				// Params.WriteBaseState should be valid, and have the most up to date IDToChangelist map for the Fast Array.
+				// Params.WriteBaseState should be valid, and have the most up to date item IDs and keys for the Fast Array.
 				// However, it's ChangelistHistory will be to the last History Number sent to the Fast TArray on the specific
 				// connection we're replicating from.
 				TSharedRef<FNetFastTArrayBaseState> NewArrayDeltaState = StaticCastSharedRef<FNetFastTArrayBaseState>(Params.WriteBaseState->AsShared());
@@ -166,6 +166,14 @@ static FAutoConsoleVariableRef CVarShowShaderWarnings(
 	TEXT("When set to 1, will display all warnings.")
 	);
 
+static int32 GShaderCompilerDeduplicateJobs = 1;
+static FAutoConsoleVariableRef CVarShaderCompilerDeduplicateJobs(
+	TEXT("r.ShaderCompiler.DeduplicateJobs"),
+	GShaderCompilerDeduplicateJobs,
+	TEXT("When set to 1, shader jobs with the same input as a job that is already queued or compiling, e.g. from different materials\n")
+	TEXT("generating the same code, aren't compiled again and get the output of that job. Jobs dumping debug info are always compiled.")
+	);
+
 static int32 GForceAllCoresForShaderCompiling = 0;
 static FAutoConsoleVariableRef CVarForceAllCoresForShaderCompiling(
 	TEXT("r.ForceAllCoresForShaderCompiling"),
@@ -276,7 +284,8 @@ int32 GCreateShadersOnLoad = 0;
 static FAutoConsoleVariableRef CVarCreateShadersOnLoad(
 	TEXT("r.CreateShadersOnLoad"),
 	GCreateShadersOnLoad,
-	TEXT("Whether to create shaders on load, which can reduce hitching, but use more memory.  Otherwise they will be created as needed.")
+	TEXT("Whether to create shaders on load, which can reduce hitching, but use more memory.\n")
+	TEXT("Otherwise each shader of a material shader map is created the first time it is requested, so permutations that are never drawn (e.g. vertex factories a material isn't used with) never create an RHI shader.")
 );
 
 
@@ -1201,9 +1210,7 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 				{
 					for (int32 JobIndex = 0; JobIndex < CurrentWorkerInfo.QueuedJobs.Num(); JobIndex++)
 					{
-						FShaderMapCompileResults& ShaderMapResults = Manager->ShaderMapJobs.FindChecked(CurrentWorkerInfo.QueuedJobs[JobIndex]->Id);
-						ShaderMapResults.FinishedJobs.Add(CurrentWorkerInfo.QueuedJobs[JobIndex]);
-						ShaderMapResults.bAllJobsSucceeded = ShaderMapResults.bAllJobsSucceeded && CurrentWorkerInfo.QueuedJobs[JobIndex]->bSucceeded;
+						Manager->AddFinishedJob(CurrentWorkerInfo.QueuedJobs[JobIndex]);
 					}
 
 					const float ElapsedTime = FPlatformTime::Seconds() - CurrentWorkerInfo.StartTime;
@@ -1981,12 +1988,119 @@ bool FShaderCompilingManager::GetDumpShaderDebugInfo() const
 	return GDumpShaderDebugInfo != 0;
 }
 
+/** Hash of everything that affects the output of a single shader job, or false if it must always be compiled. */
+static bool GetShaderJobInputHash(FShaderCommonCompileJob& Job, FSHAHash& OutHash)
+{
+	FShaderCompileJob* SingleJob = Job.GetSingleShaderJob();
+	if (!SingleJob || SingleJob->Input.DumpDebugInfoPath.Len() > 0)
+	{
+		return false;
+	}
+
+	// The debug names differ between materials but don't affect the compiled code.
+	FShaderCompilerInput& Input = SingleJob->Input;
+	FString DebugGroupName = MoveTemp(Input.DebugGroupName);
+	FString DebugDescription = MoveTemp(Input.DebugDescription);
+
+	TArray<uint8> SerializedInput;
+	FMemoryWriter Ar(SerializedInput);
+	Ar << Input;
+
+	// Includes and environments shared between jobs are serialized separately from the input, like when sent to workers.
+	TMap<FString, FString> ExternalIncludes;
+	TArray<FShaderCompilerEnvironment*> SharedEnvironments;
+	Input.GatherSharedInputs(ExternalIncludes, SharedEnvironments);
+	ExternalIncludes.KeySort(TLess<FString>());
+	for (TPair<FString, FString>& ExternalInclude : ExternalIncludes)
+	{
+		Ar << ExternalInclude.Key;
+		Ar << ExternalInclude.Value;
+	}
+	for (FShaderCompilerEnvironment* SharedEnvironment : SharedEnvironments)
+	{
+		Ar << *SharedEnvironment;
+	}
+
+	Input.DebugGroupName = MoveTemp(DebugGroupName);
+	Input.DebugDescription = MoveTemp(DebugDescription);
+
+	FSHA1::HashBuffer(SerializedInput.GetData(), SerializedInput.Num(), OutHash.Hash);
+	return true;
+}
+
+void FShaderCompilingManager::AddFinishedJob(const TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>& Job)
+{
+	FShaderMapCompileResults& ShaderMapResults = ShaderMapJobs.FindChecked(Job->Id);
+	ShaderMapResults.FinishedJobs.Add(Job);
+	ShaderMapResults.bAllJobsSucceeded = ShaderMapResults.bAllJobsSucceeded && Job->bSucceeded;
+
+	TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> FinishedDuplicateJobs;
+	RemovePendingJob(&Job.Get(), FinishedDuplicateJobs);
+
+	const FShaderCompileJob* SingleJob = Job->GetSingleShaderJob();
+	for (const TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>& DuplicateJob : FinishedDuplicateJobs)
+	{
+		DuplicateJob->GetSingleShaderJob()->Output = SingleJob->Output;
+		DuplicateJob->bSucceeded = Job->bSucceeded;
+
+		FShaderMapCompileResults& DuplicateShaderMapResults = ShaderMapJobs.FindChecked(DuplicateJob->Id);
+		DuplicateShaderMapResults.FinishedJobs.Add(DuplicateJob);
+		DuplicateShaderMapResults.bAllJobsSucceeded = DuplicateShaderMapResults.bAllJobsSucceeded && DuplicateJob->bSucceeded;
+	}
+
+	// Using atomics to update NumOutstandingJobs since it is read outside of the critical section
+	FPlatformAtomics::InterlockedAdd(&NumOutstandingJobs, -FinishedDuplicateJobs.Num());
+}
+
+void FShaderCompilingManager::RemovePendingJob(const FShaderCommonCompileJob* Job, TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& OutDuplicateJobs)
+{
+	FSHAHash InputHash;
+	if (PendingJobInputHashes.RemoveAndCopyValue(Job, InputHash))
+	{
+		PendingJobsByInputHash.Remove(InputHash);
+		DuplicateJobs.MultiFind(Job, OutDuplicateJobs, true);
+		DuplicateJobs.Remove(Job);
+	}
+}
+
 void FShaderCompilingManager::AddJobs(TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& NewJobs, bool bOptimizeForLowLatency, bool bRecreateComponentRenderStateOnCompletion, const FString MaterialBasePath, const FString PermutationString, bool bSkipResultProcessing)
 {
 	check(!FPlatformProperties::RequiresCookedData());
+
+	// Hash the inputs before locking, the compile thread needs the lock to feed workers.
+	TArray<FSHAHash> JobInputHashes;
+	TBitArray<> HasJobInputHash(false, NewJobs.Num());
+	if (GShaderCompilerDeduplicateJobs)
+	{
+		JobInputHashes.SetNum(NewJobs.Num());
+		for (int32 JobIndex = 0; JobIndex < NewJobs.Num(); JobIndex++)
+		{
+			HasJobInputHash[JobIndex] = GetShaderJobInputHash(*NewJobs[JobIndex], JobInputHashes[JobIndex]);
+		}
+	}
+
 	// Lock CompileQueueSection so we can access the input and output queues
 	FScopeLock Lock(&CompileQueueSection);
 
+	// Jobs identical to a pending one wait for its output instead of being queued.
+	TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> JobsToQueue;
+	JobsToQueue.Reserve(NewJobs.Num());
+	for (int32 JobIndex = 0; JobIndex < NewJobs.Num(); JobIndex++)
+	{
+		if (HasJobInputHash[JobIndex])
+		{
+			if (FShaderCommonCompileJob** PendingJob = PendingJobsByInputHash.Find(JobInputHashes[JobIndex]))
+			{
+				DuplicateJobs.Add(*PendingJob, NewJobs[JobIndex]);
+				continue;
+			}
+
+			PendingJobsByInputHash.Add(JobInputHashes[JobIndex], &NewJobs[JobIndex].Get());
+			PendingJobInputHashes.Add(&NewJobs[JobIndex].Get(), JobInputHashes[JobIndex]);
+		}
+		JobsToQueue.Add(NewJobs[JobIndex]);
+	}
+
 	check(GShaderCompilerStats)
 
 	if(NewJobs.Num())
@@ -2016,16 +2130,16 @@ void FShaderCompilingManager::AddJobs(TArray<TSharedRef<FShaderCommonCompileJob,
 		// Insert after the last low latency task, but before all the normal tasks
 		// This is necessary to make sure that jobs from the same material get processed in order
 		// Note: this is assuming that the value of bOptimizeForLowLatency never changes for a certain material
-		CompileQueue.InsertZeroed(InsertIndex, NewJobs.Num());
+		CompileQueue.InsertZeroed(InsertIndex, JobsToQueue.Num());
 
-		for (int32 JobIndex = 0; JobIndex < NewJobs.Num(); JobIndex++)
+		for (int32 JobIndex = 0; JobIndex < JobsToQueue.Num(); JobIndex++)
 		{
-			CompileQueue[InsertIndex + JobIndex] = NewJobs[JobIndex];
+			CompileQueue[InsertIndex + JobIndex] = JobsToQueue[JobIndex];
 		}
 	}
 	else
 	{
-		CompileQueue.Append(NewJobs);
+		CompileQueue.Append(JobsToQueue);
 	}
 
 	// Using atomics to update NumOutstandingJobs since it is read outside of the critical section
@@ -2823,6 +2937,40 @@ void FShaderCompilingManager::CancelCompilation(const TCHAR* MaterialName, const
 					++TotalNumJobsRemoved;
 
 					CompileQueue.RemoveAt(JobIndex, 1, false);
+
+					// Jobs of other shader maps waiting for this one get queued again, the first becoming the pending job of the others.
+					TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> WaitingJobs;
+					FSHAHash InputHash;
+					const bool bHadInputHash = PendingJobInputHashes.RemoveAndCopyValue(&Job.Get(), InputHash);
+					if (bHadInputHash)
+					{
+						PendingJobsByInputHash.Remove(InputHash);
+						DuplicateJobs.MultiFind(&Job.Get(), WaitingJobs, true);
+						DuplicateJobs.Remove(&Job.Get());
+					}
+					WaitingJobs.RemoveAll([&ShaderMapIdsToCancel](const TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>& WaitingJob) { return ShaderMapIdsToCancel.Contains(WaitingJob->Id); });
+					if (WaitingJobs.Num() > 0)
+					{
+						FShaderCommonCompileJob* NewPendingJob = &WaitingJobs[0].Get();
+						PendingJobsByInputHash.Add(InputHash, NewPendingJob);
+						PendingJobInputHashes.Add(NewPendingJob, InputHash);
+						for (int32 WaitingJobIndex = 1; WaitingJobIndex < WaitingJobs.Num(); ++WaitingJobIndex)
+						{
+							DuplicateJobs.Add(NewPendingJob, WaitingJobs[WaitingJobIndex]);
+						}
+						CompileQueue.Add(WaitingJobs[0]);
+					}
+				}
+			}
+
+			// Jobs of this shader map waiting for a pending job of another one
+			for (TMultiMap<const FShaderCommonCompileJob*, TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>::TIterator It(DuplicateJobs); It; ++It)
+			{
+				if (It.Value()->Id == MapIdx)
+				{
+					++NumJobsRemoved;
+					++TotalNumJobsRemoved;
+					It.RemoveCurrent();
 				}
 			}
 
@@ -270,9 +270,7 @@ void FShaderCompileXGEThreadRunnable_XmlInterface::PostCompletedJobsForBatch(FSh
 	FScopeLock Lock(&Manager->CompileQueueSection);
 	for (auto Job : Batch->GetJobs())
 	{
-		FShaderMapCompileResults& ShaderMapResults = Manager->ShaderMapJobs.FindChecked(Job->Id);
-		ShaderMapResults.FinishedJobs.Add(Job);
-		ShaderMapResults.bAllJobsSucceeded = ShaderMapResults.bAllJobsSucceeded && Job->bSucceeded;
+		Manager->AddFinishedJob(Job);
 	}
 
 	// Using atomics to update NumOutstandingJobs since it is read outside of the critical section
@@ -906,9 +904,7 @@ int32 FShaderCompileXGEThreadRunnable_InterceptionInterface::CompilingLoop()
 				FScopeLock Lock(&Manager->CompileQueueSection);
 				for (TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe> Job : Task->ShaderJobs)
 				{
-					FShaderMapCompileResults& ShaderMapResults = Manager->ShaderMapJobs.FindChecked(Job->Id);
-					ShaderMapResults.FinishedJobs.Add(Job);
-					ShaderMapResults.bAllJobsSucceeded = ShaderMapResults.bAllJobsSucceeded && Job->bSucceeded;
+					Manager->AddFinishedJob(Job);
 				}
 			}
 
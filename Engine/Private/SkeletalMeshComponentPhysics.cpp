@@ -686,6 +686,10 @@ void USkeletalMeshComponent::InstantiatePhysicsAsset_Internal(const UPhysicsAsse
 	check(OutBodies.Num() == 0);
 	OutBodies.AddZeroed(NumOutBodies);
 
+	{
+	// The bodies are created together and are only valid once the batch goes out of scope, before the constraints are created
+	FScopedBodyInstanceInitBatch InitBodiesBatch(/*bBatchDynamicBodies=*/true);
+
 	for(int32 BodyIdx = 0; BodyIdx < NumOutBodies; BodyIdx++)
 	{
 		UBodySetup* PhysicsAssetBodySetup = PhysAsset.SkeletalBodySetups[BodyIdx];
@@ -759,6 +763,7 @@ void USkeletalMeshComponent::InstantiatePhysicsAsset_Internal(const UPhysicsAsse
 #endif //WITH_PHYSX
 		}
 	}
+	}
 
 #if WITH_PHYSX
 	if(PhysScene && Aggregate.IsValid())
@@ -61,6 +61,16 @@ static bool UseGPUMorphTargets(const EShaderPlatform Platform)
 	return GUseGPUMorphTargets != 0 && IsFeatureLevelSupported(Platform, ERHIFeatureLevel::SM5);
 }
 
+static int32 GMorphTargetSparseDispatch = 1;
+static FAutoConsoleVariableRef CVarMorphTargetSparseDispatch(
+	TEXT("r.MorphTarget.SparseDispatch"),
+	GMorphTargetSparseDispatch,
+	TEXT("Only dispatch GPU morph target work for morph targets with a weight this frame.\n")
+	TEXT(" 0: Dispatch every morph target of the LOD, inactive ones with a zero weight\n")
+	TEXT(" 1: Skip inactive morph targets and batch runs of active ones (default)\n"),
+	ECVF_RenderThreadSafe
+	);
+
 static float GMorphTargetWeightThreshold = SMALL_NUMBER;
 static FAutoConsoleVariableRef CVarMorphTargetWeightThreshold(
 	TEXT("r.MorphTarget.WeightThreshold"),
@@ -541,9 +551,11 @@ void FSkeletalMeshObjectGPUSkin::ProcessUpdatedDynamicData(FGPUSkinCache* GPUSki
 				MorphTargetWeights.Reserve(LODData.MorphTargetVertexInfoBuffers.GetNumMorphs());
 				for (int i = 0; i < DynamicData->MorphTargetWeights.Num(); i++)
 				{
+					// Morph targets below the blend threshold aren't active, zero them like the CPU path ignores them
+					const float MorphTargetWeight = FMath::Abs(DynamicData->MorphTargetWeights[i]) >= MinMorphTargetBlendWeight ? DynamicData->MorphTargetWeights[i] : 0.0f;
 					for (uint32 j = 0; j < LODData.MorphTargetVertexInfoBuffers.GetNumSplitsPerMorph(i); j++)
 					{
-						MorphTargetWeights.Add(DynamicData->MorphTargetWeights[i]);
+						MorphTargetWeights.Add(MorphTargetWeight);
 					}
 				}
 				LOD.UpdateMorphVertexBufferGPU(RHICmdList, MorphTargetWeights, LODData.MorphTargetVertexInfoBuffers, DynamicData->SectionIdsUseByActiveMorphTargets);
@@ -783,6 +795,12 @@ static void CalculateMorphDeltaBounds(const TArray<float>& MorphTargetWeights, c
 	double MaxScale[4] = { 0, 0, 0, 0 };
 	for (uint32 i = 0; i < MorphTargetVertexInfoBuffers.GetNumMorphs(); i++)
 	{
+		// Inactive morph targets are not scattered when dispatching sparsely, their range doesn't need to fit
+		if (GMorphTargetSparseDispatch && MorphTargetWeights[i] == 0.0f)
+		{
+			continue;
+		}
+
 		FVector4 MinMorphScale = MorphTargetVertexInfoBuffers.GetMinimumMorphScale(i);
 		FVector4 MaxMorphScale = MorphTargetVertexInfoBuffers.GetMaximumMorphScale(i);
 
@@ -857,14 +875,28 @@ void FSkeletalMeshObjectGPUSkin::FSkeletalMeshObjectLOD::UpdateMorphVertexBuffer
 				//the first pass scatters all morph targets into the vertexbuffer using atomics
 				//multiple morph targets can be batched by a single shader where the shader will rely on
 				//binary search to find the correct target weight within the batch.
+				//when dispatching sparsely, morph targets with a zero weight are skipped and a batch only covers
+				//a run of consecutive active morph targets, as the deltas of a batch have to be contiguous.
+				const bool bSparseDispatch = GMorphTargetSparseDispatch != 0;
+				auto IsMorphActive = [bSparseDispatch, &MorphTargetWeights](uint32 MorphIndex)
+				{
+					return !bSparseDispatch || MorphTargetWeights[MorphIndex] != 0.0f;
+				};
+
 				TShaderMapRef<FGPUMorphUpdateCS> GPUMorphUpdateCS(GetGlobalShaderMap(ERHIFeatureLevel::SM5));
 				for (uint32 i = 0; i < MorphTargetVertexInfoBuffers.GetNumMorphs();)
 				{
+					if (!IsMorphActive(i))
+					{
+						i++;
+						continue;
+					}
+
 					uint32 NumMorphDeltas = 0;
 					uint32 j = 0;
 					for (; j < GMorphTargetDispatchBatchSize - 1; j++)
 					{
-						if (i + j < MorphTargetVertexInfoBuffers.GetNumMorphs())
+						if (i + j < MorphTargetVertexInfoBuffers.GetNumMorphs() && IsMorphActive(i + j))
 						{
 							if (NumMorphDeltas + MorphTargetVertexInfoBuffers.GetNumWorkItems(i + j) <= FMorphTargetVertexInfoBuffers::GetMaximumThreadGroupSize())
 							{
@@ -205,85 +205,92 @@ void FConcurrencyGroup::CullSoundsDueToMaxConcurrency()
 		return;
 	}
 
-	// Comparator for sorting group's ActiveSounds according to their dynamic concurrency nature.
-	// Quieter/lower priority sounds will be at the front of the array.
-	struct FCompareActiveSounds
+	const int32 NumActiveSounds = ActiveSounds.Num();
+	const int32 NumSoundsToStop = NumActiveSounds - Settings.MaxCount;
+	check(NumSoundsToStop > 0);
+
+	for (FActiveSound* ActiveSound : ActiveSounds)
+	{
+		check(ActiveSound);
+		ActiveSound->bShouldStopDueToMaxConcurrency = false;
+	}
+
+	const EMaxConcurrentResolutionRule::Type ResolutionRule = Settings.ResolutionRule;
+	if (Settings.IsEvictionSupported())
+	{
+		// Rules supporting eviction have no order to cull by, so stop the first sounds over the limit.
+		for (int32 i = 0; i < NumSoundsToStop; ++i)
+		{
+			ActiveSounds[i]->bShouldStopDueToMaxConcurrency = true;
+		}
+		return;
+	}
+
+	// Sort key of a sound, evaluated once per sound as the highest priority walks every wave instance.
+	struct FCullCandidate
+	{
+		FActiveSound* ActiveSound;
+		float Value;
+		float PlaybackTime;
+	};
+
+	// Quieter/lower priority sounds compare first.
+	struct FCompareCullCandidates
 	{
 		EMaxConcurrentResolutionRule::Type ResolutionRule;
 
-		FCompareActiveSounds(EMaxConcurrentResolutionRule::Type InResolutionRule)
+		FCompareCullCandidates(EMaxConcurrentResolutionRule::Type InResolutionRule)
 			: ResolutionRule(InResolutionRule)
 		{
 		}
 
-		FORCEINLINE bool operator()(const FActiveSound& A, const FActiveSound& B) const
+		FORCEINLINE bool operator()(const FCullCandidate& A, const FCullCandidate& B) const
 		{
-			switch (ResolutionRule)
+			if (ResolutionRule == EMaxConcurrentResolutionRule::StopQuietest)
 			{
-				case EMaxConcurrentResolutionRule::StopQuietest:
+				// If sounds share the same volume, newer sounds will be sorted first to avoid loop realization ping-ponging 
+				if (FMath::IsNearlyEqual(A.Value, B.Value, KINDA_SMALL_NUMBER))
 				{
-					// If sounds share the same volume, newer sounds will be sorted first to avoid loop realization ping-ponging 
-					if (FMath::IsNearlyEqual(A.VolumeConcurrency, B.VolumeConcurrency, KINDA_SMALL_NUMBER))
-					{
-						return A.PlaybackTime > B.PlaybackTime;
-					}
-					return A.VolumeConcurrency < B.VolumeConcurrency;
+					return A.PlaybackTime > B.PlaybackTime;
 				}
-				break;
-
-				case EMaxConcurrentResolutionRule::StopLowestPriority:
-				case EMaxConcurrentResolutionRule::StopLowestPriorityThenPreventNew:
-				{
-					const float APriority = A.GetHighestPriority();
-					const float BPriority = B.GetHighestPriority();
-					if (!FMath::IsNearlyEqual(APriority, BPriority, KINDA_SMALL_NUMBER))
-					{
-						return APriority < BPriority;
-					}
-
-					// Newer sounds pushed forward in sort to make them more likely to be culled if PreventNew
-					return ResolutionRule == EMaxConcurrentResolutionRule::StopLowestPriorityThenPreventNew
-						? A.PlaybackTime < B.PlaybackTime
-						: A.PlaybackTime > B.PlaybackTime;
-				}
-				break;
+				return A.Value < B.Value;
+			}
 
-				default:
-				case EMaxConcurrentResolutionRule::PreventNew:
-				case EMaxConcurrentResolutionRule::StopOldest:
-				case EMaxConcurrentResolutionRule::StopFarthestThenPreventNew:
-				case EMaxConcurrentResolutionRule::StopFarthestThenOldest:
-				{
-					static_assert(static_cast<int32>(EMaxConcurrentResolutionRule::Count) == 7,
-						"Possible Missing EMaxConcurrentResolutionRule switch case coverage");
-					return true;
-				}
-				break;
+			if (!FMath::IsNearlyEqual(A.Value, B.Value, KINDA_SMALL_NUMBER))
+			{
+				return A.Value < B.Value;
 			}
+
+			// Newer sounds pushed forward in sort to make them more likely to be culled if PreventNew
+			return ResolutionRule == EMaxConcurrentResolutionRule::StopLowestPriorityThenPreventNew
+				? A.PlaybackTime < B.PlaybackTime
+				: A.PlaybackTime > B.PlaybackTime;
 		}
 	};
 
-	ActiveSounds.Sort(FCompareActiveSounds(Settings.ResolutionRule));
-
-	const int32 NumActiveSounds = ActiveSounds.Num();
-	const int32 NumSoundsToStop = NumActiveSounds - Settings.MaxCount;
-	check(NumSoundsToStop > 0);
+	static_assert(static_cast<int32>(EMaxConcurrentResolutionRule::Count) == 7,
+		"Possible Missing EMaxConcurrentResolutionRule switch case coverage");
 
-	// Need to make a new list when stopping the sounds since the process of stopping an active sound
-	// will remove the sound from this concurrency group's ActiveSounds array.
-	int32 i = 0;
-	for (; i < NumSoundsToStop; ++i)
+	TArray<FCullCandidate, TInlineAllocator<32>> Candidates;
+	Candidates.Reserve(NumActiveSounds);
+	for (FActiveSound* ActiveSound : ActiveSounds)
 	{
-		FActiveSound* ActiveSound = ActiveSounds[i];
-		check(ActiveSound);
-		ActiveSound->bShouldStopDueToMaxConcurrency = true;
+		const float Value = ResolutionRule == EMaxConcurrentResolutionRule::StopQuietest
+			? ActiveSound->VolumeConcurrency
+			: ActiveSound->GetHighestPriority();
+		Candidates.Add({ ActiveSound, Value, ActiveSound->PlaybackTime });
 	}
 
-	for (; i < NumActiveSounds; ++i)
+	// Only the sounds to stop need ordering, pop them off a heap rather than sorting the whole group.
+	const FCompareCullCandidates Compare(ResolutionRule);
+	Candidates.Heapify(Compare);
+
+	for (int32 i = 0; i < NumSoundsToStop; ++i)
 	{
-		ActiveSounds[i]->bShouldStopDueToMaxConcurrency = false;
+		FCullCandidate Candidate;
+		Candidates.HeapPop(Candidate, Compare, false);
+		Candidate.ActiveSound->bShouldStopDueToMaxConcurrency = true;
 	}
-
 }
 
 FSoundConcurrencyManager::FSoundConcurrencyManager(class FAudioDevice* InAudioDevice)
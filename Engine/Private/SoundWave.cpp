@@ -1525,6 +1525,8 @@ void USoundWave::FreeResources(bool bStopSoundsUsingThisResource)
 {
 	check(IsInAudioThread());
 
+	FAudioDevice::RemoveFromDecodedPCMCache(this);
+
 	// Housekeeping of stats
 	DEC_FLOAT_STAT_BY( STAT_AudioBufferTime, Duration );
 	DEC_FLOAT_STAT_BY( STAT_AudioBufferTimeChannels, NumChannels * Duration );
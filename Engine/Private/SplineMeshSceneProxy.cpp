@@ -53,6 +53,7 @@ FSplineMeshSceneProxy::FSplineMeshSceneProxy(USplineMeshComponent* InComponent)
 
 	// Fill in info about the mesh
 	InComponent->CalculateScaleZAndMinZ(SplineMeshScaleZ, SplineMeshMinZ);
+	UpdateSplineParamData();
 
 	for (int32 LODIndex = 0; LODIndex < LODs.Num(); LODIndex++)
 	{
@@ -64,6 +65,56 @@ FSplineMeshSceneProxy::FSplineMeshSceneProxy(USplineMeshComponent* InComponent)
 	}
 }
 
+void FSplineMeshSceneProxy::UpdateSplineParamData()
+{
+	SplineParamData[0] = FVector4(SplineParams.StartPos, SplineParams.StartRoll);
+	SplineParamData[1] = FVector4(SplineParams.StartTangent, SplineParams.EndRoll);
+	SplineParamData[2] = FVector4(SplineParams.StartScale, SplineParams.StartOffset);
+	SplineParamData[3] = FVector4(SplineParams.EndPos, (float)(int32)bSmoothInterpRollScale);
+	SplineParamData[4] = FVector4(SplineParams.EndTangent, SplineMeshMinZ);
+	SplineParamData[5] = FVector4(SplineParams.EndScale, SplineParams.EndOffset);
+	SplineParamData[6] = FVector4(SplineUpDir, SplineMeshScaleZ);
+
+	FVector DirMask = FVector::ZeroVector;
+	DirMask[ForwardAxis] = 1;
+	SplineParamData[7] = FVector4(DirMask, 0);
+	DirMask = FVector::ZeroVector;
+	DirMask[(ForwardAxis + 1) % 3] = 1;
+	SplineParamData[8] = FVector4(DirMask, 0);
+	DirMask = FVector::ZeroVector;
+	DirMask[(ForwardAxis + 2) % 3] = 1;
+	SplineParamData[9] = FVector4(DirMask, 0);
+}
+
+void FSplineMeshSceneProxy::ApplyUpdate_RenderThread(const FSplineMeshProxyUpdate& Update)
+{
+	check(IsInRenderingThread());
+
+	SplineParams = Update.SplineParams;
+	ForwardAxis = Update.ForwardAxis;
+	SplineUpDir = Update.SplineUpDir;
+	SplineMeshScaleZ = Update.SplineMeshScaleZ;
+	SplineMeshMinZ = Update.SplineMeshMinZ;
+	UpdateSplineParamData();
+}
+
+void FSplineMeshSceneProxy::ApplyUpdates(TArray<FSplineMeshProxyUpdate>&& Updates)
+{
+	if (Updates.Num() == 0)
+	{
+		return;
+	}
+
+	ENQUEUE_RENDER_COMMAND(UpdateSplineParamsRTCommand)(
+		[Updates = MoveTemp(Updates)](FRHICommandList&)
+	{
+		for (const FSplineMeshProxyUpdate& Update : Updates)
+		{
+			Update.SplineProxy->ApplyUpdate_RenderThread(Update);
+		}
+	});
+}
+
 SIZE_T FSplineMeshSceneProxy::GetTypeHash() const
 {
 	static size_t UniquePointer;
@@ -74,6 +74,19 @@ private:
 //////////////////////////////////////////////////////////////////////////
 // SplineMeshSceneProxy
 
+class FSplineMeshSceneProxy;
+
+/** Deformation parameters sent to an existing proxy, instead of recreating it */
+struct FSplineMeshProxyUpdate
+{
+	FSplineMeshSceneProxy* SplineProxy;
+	FSplineMeshParams SplineParams;
+	FVector SplineUpDir;
+	ESplineMeshAxis::Type ForwardAxis;
+	float SplineMeshScaleZ;
+	float SplineMeshMinZ;
+};
+
 /** Scene proxy for SplineMesh instance */
 class FSplineMeshSceneProxy final : public FStaticMeshSceneProxy
 {
@@ -116,6 +129,12 @@ public:
 
 	// 	  virtual uint32 GetMemoryFootprint( void ) const { return 0; }
 
+	/** Applies new deformation parameters on the render thread */
+	void ApplyUpdate_RenderThread(const FSplineMeshProxyUpdate& Update);
+
+	/** Enqueues one render command applying all the updates */
+	static void ApplyUpdates(TArray<FSplineMeshProxyUpdate>&& Updates);
+
 	/** Parameters that define the spline, used to deform mesh */
 	FSplineMeshParams SplineParams;
 	/** Axis (in component space) that is used to determine X axis for co-ordinates along spline */
@@ -130,6 +149,12 @@ public:
 	/** Range of Z values over entire mesh */
 	float SplineMeshScaleZ;
 
+	/** The parameters above packed as the vertex factory's SplineParams, once per change rather than for every mesh batch of every pass */
+	FVector4 SplineParamData[10];
+
+	/** Repacks SplineParamData, call after changing the parameters */
+	void UpdateSplineParamData();
+
 protected:
 	TArray<FLODResources> LODResources;
 };
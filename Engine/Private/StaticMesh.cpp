@@ -2191,6 +2191,13 @@ namespace StaticMeshDerivedDataTimings
 		);
 }
 
+static float GStaticMeshHalfPrecisionUVsMaxError = 0.f;
+static FAutoConsoleVariableRef CVarStaticMeshHalfPrecisionUVsMaxError(
+	TEXT("r.StaticMesh.HalfPrecisionUVsMaxError"),
+	GStaticMeshHalfPrecisionUVsMaxError,
+	TEXT("If greater than zero, the LODs of meshes built with full precision UVs are stored with half precision UVs when no UV moves by more than this once converted.\n")
+	TEXT("Halves the size of their texture coordinates. Changing it rebuilds the meshes that use full precision UVs."));
+
 static FString BuildStaticMeshDerivedDataKeySuffix(const ITargetPlatform* TargetPlatform, UStaticMesh* Mesh, const FStaticMeshLODGroup& LODGroup)
 {
 	FString KeySuffix(TEXT(""));
@@ -2280,6 +2287,11 @@ static FString BuildStaticMeshDerivedDataKeySuffix(const ITargetPlatform* Target
 
 	KeySuffix.AppendChar(Mesh->bSupportUniformlyDistributedSampling ? TEXT('1') : TEXT('0'));
 
+	if (GStaticMeshHalfPrecisionUVsMaxError > 0.f)
+	{
+		KeySuffix += FString::Printf(TEXT("_HUV%g"), GStaticMeshHalfPrecisionUVsMaxError);
+	}
+
 	// Value of this CVar affects index buffer <-> painted vertex color correspondence (see UE-51421).
 	static const TConsoleVariableData<int32>* CVar = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.TriangleOrderOptimization"));
 
@@ -2473,6 +2485,17 @@ void FStaticMeshRenderData::Cache(const ITargetPlatform* TargetPlatform, UStatic
 				return;
 			}
 
+			if (GStaticMeshHalfPrecisionUVsMaxError > 0.f)
+			{
+				for (int32 LODIdx = 0; LODIdx < LODResources.Num(); ++LODIdx)
+				{
+					if (LODResources[LODIdx].VertexBuffers.StaticMeshVertexBuffer.ConvertTexcoordsToHalfIfWithinError(GStaticMeshHalfPrecisionUVsMaxError))
+					{
+						UE_LOG(LogStaticMesh, Verbose, TEXT("Using half precision UVs for LOD%d of %s"), LODIdx, *Owner->GetPathName());
+					}
+				}
+			}
+
 			ComputeUVDensities();
 			if(Owner->bSupportUniformlyDistributedSampling)
 			{
@@ -4408,7 +4431,8 @@ void UStaticMesh::CacheDerivedData()
 		if (IsInGameThread())
 		{
 			// Finish any previous async builds before modifying RenderData
-			// This can happen during import as the mesh is rebuilt redundantly
+			// This can happen during import as the mesh is rebuilt redundantly, builds that haven't started are just dropped
+			GDistanceFieldAsyncQueue->CancelBuild(this);
 			GDistanceFieldAsyncQueue->BlockUntilBuildComplete(this, true);
 		}
 
@@ -163,7 +163,8 @@ void UStaticMesh::BatchBuild(const TArray<UStaticMesh*>& InStaticMeshes, bool bI
 			if (StaticMesh->RenderData)
 			{
 				// Finish any previous async builds before modifying RenderData
-				// This can happen during import as the mesh is rebuilt redundantly
+				// This can happen during import as the mesh is rebuilt redundantly, builds that haven't started are just dropped
+				GDistanceFieldAsyncQueue->CancelBuild(StaticMesh);
 				GDistanceFieldAsyncQueue->BlockUntilBuildComplete(StaticMesh, true);
 			}
 		}
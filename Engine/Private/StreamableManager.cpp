@@ -649,6 +649,41 @@ void FStreamableHandle::StartStalledHandle()
 	OwningManager->StartHandleRequests(AsShared());
 }
 
+void FStreamableHandle::RaisePriority(TAsyncLoadPriority NewPriority)
+{
+	check(IsInGameThread());
+
+	TArray<TSharedRef<FStreamableHandle>> HandlesToRaise;
+
+	HandlesToRaise.Add(AsShared());
+
+	for (int32 i = 0; i < HandlesToRaise.Num(); i++)
+	{
+		TSharedRef<FStreamableHandle> Handle = HandlesToRaise[i];
+
+		if (NewPriority <= Handle->Priority || !Handle->IsLoadingInProgress())
+		{
+			continue;
+		}
+
+		Handle->Priority = NewPriority;
+
+		// Stalled handles request at their priority once started
+		if (!Handle->IsStalled() && !Handle->IsCombinedHandle() && Handle->OwningManager)
+		{
+			Handle->OwningManager->RaiseHandleRequestsPriority(Handle);
+		}
+
+		for (const TSharedPtr<FStreamableHandle>& ChildHandle : Handle->ChildHandles)
+		{
+			if (ChildHandle.IsValid())
+			{
+				HandlesToRaise.Add(ChildHandle.ToSharedRef());
+			}
+		}
+	}
+}
+
 FStreamableHandle::~FStreamableHandle()
 {
 	check(IsInGameThread() || IsInGarbageCollectorThread());
@@ -1125,21 +1160,33 @@ FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetN
 		else
 		{
 			// We always queue a new request in case the existing one gets cancelled
-			FString Package = TargetName.ToString();
-			int32 FirstDot = Package.Find(TEXT("."), ESearchCase::CaseSensitive);
-			if (FirstDot != INDEX_NONE)
-			{
-				Package.LeftInline(FirstDot,false);
-			}
-
 			Existing->bAsyncLoadRequestOutstanding = true;
 			Existing->bLoadFailed = false;
-			int32 RequestId = LoadPackageAsync(Package, FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, TargetName), Priority);
+			int32 RequestId = LoadPackageAsync(TargetName.GetLongPackageName(), FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, TargetName), Priority);
 		}
 	}
 	return Existing;
 }
 
+void FStreamableManager::RaiseHandleRequestsPriority(TSharedRef<FStreamableHandle> Handle)
+{
+	check(IsInGameThread());
+
+	for (const FSoftObjectPath& RequestedAsset : Handle->RequestedAssets)
+	{
+		FSoftObjectPath TargetName = ResolveRedirects(RequestedAsset);
+		FStreamable* Existing = StreamableItems.FindRef(TargetName);
+
+		if (Existing && Existing->bAsyncLoadRequestOutstanding && !Existing->Target)
+		{
+			UE_LOG(LogStreamableManager, Verbose, TEXT("Raising priority of %s to %d"), *TargetName.ToString(), Handle->Priority);
+
+			// The async loader merges this with the in flight request for the package and keeps the highest priority
+			LoadPackageAsync(TargetName.GetLongPackageName(), FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, TargetName), Handle->Priority);
+		}
+	}
+}
+
 TSharedPtr<FStreamableHandle> FStreamableManager::RequestAsyncLoad(TArray<FSoftObjectPath> TargetsToStream, FStreamableDelegate DelegateToCall, TAsyncLoadPriority Priority, bool bManageActiveHandle, bool bStartStalled, FString DebugName)
 {
 	LLM_SCOPE(ELLMTag::StreamingManager);
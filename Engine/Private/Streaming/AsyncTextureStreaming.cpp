@@ -6,6 +6,7 @@ AsyncTextureStreaming.cpp: Definitions of classes used for texture streaming asy
 
 #include "Streaming/AsyncTextureStreaming.h"
 #include "Misc/App.h"
+#include "Async/ParallelFor.h"
 #include "Streaming/StreamingManagerTexture.h"
 #include "Engine/World.h"
 
@@ -79,10 +80,17 @@ void FAsyncRenderAssetStreamingData::ComputeViewInfoExtras(const FRenderAssetStr
 
 void FAsyncRenderAssetStreamingData::UpdateBoundSizes_Async(const FRenderAssetStreamingSettings& Settings)
 {
+	// Each level view only touches its own bounds, the dynamic one is processed along the last level.
+	const int32 NumViews = StaticInstancesViews.Num() + 1;
+	ParallelFor(NumViews, [this, &Settings](int32 Index)
+	{
+		FRenderAssetInstanceAsyncView& InstancesView = StaticInstancesViews.IsValidIndex(Index) ? StaticInstancesViews[Index] : DynamicInstancesView;
+		InstancesView.UpdateBoundSizes_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings);
+	}, Settings.ParallelChunkSize == 0 || NumViews == 1);
+
 	for (int32 StaticViewIndex = 0; StaticViewIndex < StaticInstancesViews.Num(); ++StaticViewIndex)
 	{
-		FRenderAssetInstanceAsyncView& StaticInstancesView = StaticInstancesViews[StaticViewIndex];
-		StaticInstancesView.UpdateBoundSizes_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings);
+		const FRenderAssetInstanceAsyncView& StaticInstancesView = StaticInstancesViews[StaticViewIndex];
 
 		// Skip levels that can not contribute to resolution.
 		if (StaticInstancesView.GetMaxLevelRenderAssetScreenSize() > Settings.MinLevelRenderAssetScreenSize
@@ -101,8 +109,6 @@ void FAsyncRenderAssetStreamingData::UpdateBoundSizes_Async(const FRenderAssetSt
 	{
 		StaticInstancesViewIndices.Sort([&](int32 LHS, int32 RHS) { return StaticInstancesViews[LHS].GetMaxLevelRenderAssetScreenSize() > StaticInstancesViews[RHS].GetMaxLevelRenderAssetScreenSize(); });
 	}
-
-	DynamicInstancesView.UpdateBoundSizes_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings);
 }
 
 void FAsyncRenderAssetStreamingData::UpdatePerfectWantedMips_Async(FStreamingRenderAsset& StreamingRenderAsset, const FRenderAssetStreamingSettings& Settings, bool bOutputToLog) const
@@ -330,29 +336,74 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 
 	TArray<int32> PrioritizedRenderAssets;
 
-	int64 MemoryBudgeted = 0;
-	int64 MemoryUsedByNonTextures = 0;
-	MemoryUsed = 0;
-	TempMemoryUsed = 0;
+	// With a separate mesh pool, meshes are budgeted on their own and the budget below only covers textures.
+	const bool bUseSeparatePoolForMeshes = MeshPoolSize >= 0;
+	const bool bPrioritizeMeshLODRetention = Settings.bPrioritizeMeshLODRetention && !bUseSeparatePoolForMeshes;
 
-	for (FStreamingRenderAsset& StreamingRenderAsset : StreamingRenderAssets)
+	struct FChunkMemory
 	{
-		if (IsAborted()) break;
+		int64 MemoryBudgeted = 0;
+		int64 MeshMemoryBudgeted = 0;
+		int64 MemoryUsedByNonTextures = 0;
+		int64 MemoryUsed = 0;
+		int64 TempMemoryUsed = 0;
+	};
+
+	// Each chunk accumulates its own totals, merged in chunk order once all are done.
+	const int32 ChunkSize = Settings.ParallelChunkSize > 0 ? Settings.ParallelChunkSize : FMath::Max(StreamingRenderAssets.Num(), 1);
+	const int32 NumChunks = FMath::DivideAndRoundUp(StreamingRenderAssets.Num(), ChunkSize);
+	TArray<FChunkMemory> ChunkMemories;
+	ChunkMemories.SetNum(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		FChunkMemory& ChunkMemory = ChunkMemories[ChunkIndex];
+		const int32 EndIndex = FMath::Min((ChunkIndex + 1) * ChunkSize, StreamingRenderAssets.Num());
+		for (int32 AssetIndex = ChunkIndex * ChunkSize; AssetIndex < EndIndex; ++AssetIndex)
+		{
+			if (IsAborted()) break;
 
-		MemoryBudgeted += StreamingRenderAsset.UpdateRetentionPriority_Async(Settings.bPrioritizeMeshLODRetention);
-		const int32 AssetMemUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.ResidentMips);
-		MemoryUsed += AssetMemUsed;
+			FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
 
-		// TODO: Use RHI metrics
-		if (!StreamingRenderAsset.IsTexture())
-		{
-			MemoryUsedByNonTextures += AssetMemUsed;
-		}
+			const int64 AssetMemBudgeted = StreamingRenderAsset.UpdateRetentionPriority_Async(bPrioritizeMeshLODRetention);
+			if (bUseSeparatePoolForMeshes && StreamingRenderAsset.IsMesh())
+			{
+				ChunkMemory.MeshMemoryBudgeted += AssetMemBudgeted;
+			}
+			else
+			{
+				ChunkMemory.MemoryBudgeted += AssetMemBudgeted;
+			}
 
-		if (StreamingRenderAsset.ResidentMips != StreamingRenderAsset.RequestedMips)
-		{
-			TempMemoryUsed += StreamingRenderAsset.GetSize(StreamingRenderAsset.RequestedMips);
+			const int32 AssetMemUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.ResidentMips);
+			ChunkMemory.MemoryUsed += AssetMemUsed;
+
+			// TODO: Use RHI metrics
+			if (!StreamingRenderAsset.IsTexture())
+			{
+				ChunkMemory.MemoryUsedByNonTextures += AssetMemUsed;
+			}
+
+			if (StreamingRenderAsset.ResidentMips != StreamingRenderAsset.RequestedMips)
+			{
+				ChunkMemory.TempMemoryUsed += StreamingRenderAsset.GetSize(StreamingRenderAsset.RequestedMips);
+			}
 		}
+	}, NumChunks <= 1);
+
+	int64 MemoryBudgeted = 0;
+	int64 MeshMemoryBudgeted = 0;
+	int64 MemoryUsedByNonTextures = 0;
+	MemoryUsed = 0;
+	TempMemoryUsed = 0;
+
+	for (const FChunkMemory& ChunkMemory : ChunkMemories)
+	{
+		MemoryBudgeted += ChunkMemory.MemoryBudgeted;
+		MeshMemoryBudgeted += ChunkMemory.MeshMemoryBudgeted;
+		MemoryUsedByNonTextures += ChunkMemory.MemoryUsedByNonTextures;
+		MemoryUsed += ChunkMemory.MemoryUsed;
+		TempMemoryUsed += ChunkMemory.TempMemoryUsed;
 	}
 
 	//*************************************
@@ -391,6 +442,9 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 		}
 	}
 
+	// Fragmented memory might not fit the next mips, so only part of it is counted as available.
+	AvailableMemoryForStreaming -= (int64)(FragmentedMemory * Settings.FragmentationReserve);
+
 	// Update EffectiveStreamingPoolSize, trying to stabilize it independently of temp memory, allocator overhead and non-streaming resources normal variation.
 	// It's hard to know how much temp memory and allocator overhead is actually in AllocatedMemorySize as it is platform specific.
 	// We handle it by not using all memory available. If temp memory and memory margin values are effectively bigger than the actual used values, the pool will stabilize.
@@ -407,6 +461,16 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 		bResetMipBias = true;
 	}
 
+	const int64 MeshMemoryBudget = bUseSeparatePoolForMeshes ? MeshPoolSize : 0;
+
+	// Which of the two budgets an asset is counted in.
+	auto IsInMeshPool = [bUseSeparatePoolForMeshes](const FStreamingRenderAsset& StreamingRenderAsset)
+	{
+		return bUseSeparatePoolForMeshes && StreamingRenderAsset.IsMesh();
+	};
+	auto IsOverBudget = [&]() { return MemoryBudgeted > MemoryBudget || MeshMemoryBudgeted > MeshMemoryBudget; };
+	auto IsUnderBudget = [&]() { return MemoryBudgeted < MemoryBudget || (bUseSeparatePoolForMeshes && MeshMemoryBudgeted < MeshMemoryBudget); };
+
 	//*******************************************
 	// Reset per mip bias if not required anymore.
 	//*******************************************
@@ -435,7 +499,7 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 	//*************************************
 
 	// If the budget is taking too much, drop some mips.
-	if (MemoryBudgeted > MemoryBudget && !IsAborted())
+	if (IsOverBudget() && !IsAborted())
 	{
 		//*************************************
 		// Get texture/mesh list in order of reduction
@@ -471,15 +535,15 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 			//*************************************
 
 			// When using mip bias per texture/mesh, we first reduce the maximum resolutions (if used) in order to fit.
-			for (int32 NumDroppedMips = 0; NumDroppedMips < Settings.GlobalMipBias && MemoryBudgeted > MemoryBudget && !IsAborted(); ++NumDroppedMips)
+			for (int32 NumDroppedMips = 0; NumDroppedMips < Settings.GlobalMipBias && IsOverBudget() && !IsAborted(); ++NumDroppedMips)
 			{
-				const int64 PreviousMemoryBudgeted = MemoryBudgeted;
+				const int64 PreviousMemoryBudgeted = MemoryBudgeted + MeshMemoryBudgeted;
 
 				// Heuristic: Only consider dropping max resolution for a mesh if it has reasonable impact on memory reduction.
 				// Currently, reasonable impact is defined as MemDeltaOfDroppingOneLOD >= MinTextureMemDelta in this pass.
 				int64 MinTextureMemDelta = MAX_int64;
 
-				for (int32 PriorityIndex = PrioritizedRenderAssets.Num() - 1; PriorityIndex >= 0 && MemoryBudgeted > MemoryBudget && !IsAborted(); --PriorityIndex)
+				for (int32 PriorityIndex = PrioritizedRenderAssets.Num() - 1; PriorityIndex >= 0 && IsOverBudget() && !IsAborted(); --PriorityIndex)
 				{
 					int32 AssetIndex = PrioritizedRenderAssets[PriorityIndex];
 					if (AssetIndex == INDEX_NONE) continue;
@@ -493,6 +557,13 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 						continue;
 					}
 
+					const bool bInMeshPool = IsInMeshPool(StreamingRenderAsset);
+					int64& PoolMemoryBudgeted = bInMeshPool ? MeshMemoryBudgeted : MemoryBudgeted;
+					if (PoolMemoryBudgeted <= (bInMeshPool ? MeshMemoryBudget : MemoryBudget))
+					{
+						continue;
+					}
+
 					// If the texture/mesh requires a high resolution mip, consider dropping it. 
 					// When considering dropping the first mip, only textures/meshes using the first mip will drop their resolution, 
 					// But when considering dropping the second mip, textures/meshes using their first and second mips will loose it.
@@ -500,7 +571,7 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 					{
 						const int32 NumMipsToDrop = NumDroppedMips + 1 - StreamingRenderAsset.BudgetMipBias;
 
-						if (Settings.bPrioritizeMeshLODRetention)
+						if (bPrioritizeMeshLODRetention)
 						{
 							const bool bIsTexture = StreamingRenderAsset.IsTexture();
 							const int64 MemDeltaFromMaxResDrop = StreamingRenderAsset.GetDropMaxResMemDelta(NumMipsToDrop);
@@ -513,12 +584,12 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 							MinTextureMemDelta = bIsTexture ? FMath::Min(MinTextureMemDelta, MemDeltaFromMaxResDrop) : MinTextureMemDelta;
 						}
 
-						MemoryBudgeted -= StreamingRenderAsset.DropMaxResolution_Async(NumMipsToDrop);
+						PoolMemoryBudgeted -= StreamingRenderAsset.DropMaxResolution_Async(NumMipsToDrop);
 					}
 				}
 
 				// Break when memory does not change anymore
-				if (PreviousMemoryBudgeted == MemoryBudgeted)
+				if (PreviousMemoryBudgeted == MemoryBudgeted + MeshMemoryBudgeted)
 				{
 					break;
 				}
@@ -529,15 +600,15 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 		// Drop WantedMip until in budget.
 		//*************************************
 
-		while (MemoryBudgeted > MemoryBudget && !IsAborted())
+		while (IsOverBudget() && !IsAborted())
 		{
-			const int64 PreviousMemoryBudgeted = MemoryBudgeted;
+			const int64 PreviousMemoryBudgeted = MemoryBudgeted + MeshMemoryBudgeted;
 
 			// Heuristic: only start considering dropping mesh LODs if it has reasonable impact on memory reduction.
 			int64 MinTextureMemDelta = MAX_int64;
 
 			// Drop from the lowest priority first (starting with last elements)
-			for (int32 PriorityIndex = PrioritizedRenderAssets.Num() - 1; PriorityIndex >= 0 && MemoryBudgeted > MemoryBudget && !IsAborted(); --PriorityIndex)
+			for (int32 PriorityIndex = PrioritizedRenderAssets.Num() - 1; PriorityIndex >= 0 && IsOverBudget() && !IsAborted(); --PriorityIndex)
 			{
 				int32 AssetIndex = PrioritizedRenderAssets[PriorityIndex];
 				if (AssetIndex == INDEX_NONE) continue;
@@ -551,9 +622,16 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 					continue;
 				}
 
+				const bool bInMeshPool = IsInMeshPool(StreamingRenderAsset);
+				int64& PoolMemoryBudgeted = bInMeshPool ? MeshMemoryBudgeted : MemoryBudgeted;
+				if (PoolMemoryBudgeted <= (bInMeshPool ? MeshMemoryBudget : MemoryBudget))
+				{
+					continue;
+				}
+
 				const bool bIsTexture = StreamingRenderAsset.IsTexture();
 				const bool bIsMesh = !bIsTexture;
-				if (Settings.bPrioritizeMeshLODRetention && bIsMesh)
+				if (bPrioritizeMeshLODRetention && bIsMesh)
 				{
 					const int64 PredictedMemDelta = StreamingRenderAsset.GetDropOneMipMemDelta();
 					if (PredictedMemDelta < MinTextureMemDelta && MinTextureMemDelta != MAX_int64)
@@ -570,15 +648,15 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 				}
 
 				const int64 MemDelta = StreamingRenderAsset.DropOneMip_Async();
-				MemoryBudgeted -= MemDelta;
-				if (Settings.bPrioritizeMeshLODRetention && bIsTexture && MemDelta > 0)
+				PoolMemoryBudgeted -= MemDelta;
+				if (bPrioritizeMeshLODRetention && bIsTexture && MemDelta > 0)
 				{
 					MinTextureMemDelta = FMath::Min(MinTextureMemDelta, MemDelta);
 				}
 			}
 
 			// Break when memory does not change anymore
-			if (PreviousMemoryBudgeted == MemoryBudgeted)
+			if (PreviousMemoryBudgeted == MemoryBudgeted + MeshMemoryBudgeted)
 			{
 				break;
 			}
@@ -591,10 +669,11 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 
 	// If there is some room left, try to keep as much as long as it won't bust budget.
 	// This will run even after sacrificing to fit in budget since some small unwanted mips could still be kept.
-	if (MemoryBudgeted < MemoryBudget && !IsAborted())
+	if (IsUnderBudget() && !IsAborted())
 	{
 		PrioritizedRenderAssets.Empty(StreamingRenderAssets.Num());
 		const int64 MaxMipSize = MemoryBudget - MemoryBudgeted;
+		const int64 MaxMeshMipSize = MeshMemoryBudget - MeshMemoryBudgeted;
 		for (int32 AssetIndex = 0; AssetIndex < StreamingRenderAssets.Num() && !IsAborted(); ++AssetIndex)
 		{
 			FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
@@ -603,7 +682,7 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 
 			// Only consider textures/meshes that won't bust budget nor generate new I/O requests
 			if (StreamingRenderAsset.BudgetedMips < StreamingRenderAsset.ResidentMips &&
-				StreamingRenderAsset.GetSize(StreamingRenderAsset.BudgetedMips + 1) - StreamingRenderAsset.GetSize(StreamingRenderAsset.BudgetedMips) <= MaxMipSize)
+				StreamingRenderAsset.GetSize(StreamingRenderAsset.BudgetedMips + 1) - StreamingRenderAsset.GetSize(StreamingRenderAsset.BudgetedMips) <= (IsInMeshPool(StreamingRenderAsset) ? MaxMeshMipSize : MaxMipSize))
 			{
 				PrioritizedRenderAssets.Add(AssetIndex);
 			}
@@ -613,24 +692,32 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 		PrioritizedRenderAssets.Sort(FCompareRenderAssetByRetentionPriority(StreamingRenderAssets));
 
 		bool bBudgetIsChanging = true;
-		while (MemoryBudgeted < MemoryBudget && bBudgetIsChanging && !IsAborted())
+		while (IsUnderBudget() && bBudgetIsChanging && !IsAborted())
 		{
 			bBudgetIsChanging = false;
 
 			// Keep from highest priority first.
-			for (int32 PriorityIndex = 0; PriorityIndex < PrioritizedRenderAssets.Num() && MemoryBudgeted < MemoryBudget && !IsAborted(); ++PriorityIndex)
+			for (int32 PriorityIndex = 0; PriorityIndex < PrioritizedRenderAssets.Num() && IsUnderBudget() && !IsAborted(); ++PriorityIndex)
 			{
 				int32 AssetIndex = PrioritizedRenderAssets[PriorityIndex];
 				if (AssetIndex == INDEX_NONE) continue;
 
 				FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+				const bool bInMeshPool = IsInMeshPool(StreamingRenderAsset);
+				int64& PoolMemoryBudgeted = bInMeshPool ? MeshMemoryBudgeted : MemoryBudgeted;
+				const int64 PoolMemoryBudget = bInMeshPool ? MeshMemoryBudget : MemoryBudget;
+				if (PoolMemoryBudgeted >= PoolMemoryBudget)
+				{
+					continue;
+				}
+
 				int64 TakenMemory = StreamingRenderAsset.KeepOneMip_Async();
 
 				if (TakenMemory > 0)
 				{
-					if (MemoryBudgeted + TakenMemory <= MemoryBudget)
+					if (PoolMemoryBudgeted + TakenMemory <= PoolMemoryBudget)
 					{
-						MemoryBudgeted += TakenMemory;
+						PoolMemoryBudgeted += TakenMemory;
 						bBudgetIsChanging = true;
 					}
 					else // Cancel keeping this mip
@@ -781,15 +868,25 @@ void FRenderAssetStreamingMipCalcTask::DoWork()
 		}
 	}
 
-	for (FStreamingRenderAsset& StreamingRenderAsset : StreamingRenderAssets)
+	// Assets only read the instance views and write their own state, so they are processed in parallel chunks.
+	// The stress test picks random mips and stays on this thread to remain reproducible.
+	const int32 ChunkSize = (Settings.ParallelChunkSize > 0 && !Settings.bStressTest) ? Settings.ParallelChunkSize : FMath::Max(StreamingRenderAssets.Num(), 1);
+	const int32 NumChunks = FMath::DivideAndRoundUp(StreamingRenderAssets.Num(), ChunkSize);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
 	{
-		if (IsAborted()) break;
+		const int32 EndIndex = FMath::Min((ChunkIndex + 1) * ChunkSize, StreamingRenderAssets.Num());
+		for (int32 AssetIndex = ChunkIndex * ChunkSize; AssetIndex < EndIndex; ++AssetIndex)
+		{
+			if (IsAborted()) break;
 
-		StreamingRenderAsset.UpdateOptionalMipsState_Async();
-		
-		StreamingData.UpdatePerfectWantedMips_Async(StreamingRenderAsset, Settings);
-		StreamingRenderAsset.DynamicBoostFactor = 1.f; // Reset after every computation.
-	}
+			FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+			StreamingRenderAsset.UpdateOptionalMipsState_Async();
+
+			StreamingData.UpdatePerfectWantedMips_Async(StreamingRenderAsset, Settings);
+			StreamingRenderAsset.DynamicBoostFactor = 1.f; // Reset after every computation.
+		}
+	}, NumChunks <= 1);
 
 	int64 MemoryUsed, TempMemoryUsed;
 	// According to budget, make relevant sacrifices and keep possible unwanted mips
@@ -822,6 +919,7 @@ void FRenderAssetStreamingMipCalcTask::UpdateStats_Async()
 	Stats.UsedStreamingPool = 0;
 
 	Stats.SafetyPool = MemoryMargin; 
+	Stats.FragmentedPool = FragmentedMemory;
 	Stats.TemporaryPool = TempMemoryBudget;
 	Stats.StreamingPool = MemoryBudget;
 	Stats.NonStreamingMips = AllocatedMemory;
@@ -129,17 +129,19 @@ public:
 	:	StreamingManager( *InStreamingManager )
 	,	bAbort( false )
 	{
-		Reset(0, 0, 0, 0, 0);
+		Reset(0, 0, 0, 0, 0, -1, 0);
 		MemoryBudget = 0;
 		PerfectWantedMipsBudgetResetThresold = 0;
 	}
 
 	/** Resets the state to start a new async job. */
-	void Reset(int64 InTotalGraphicsMemory, int64 InAllocatedMemory, int64 InPoolSize, int64 InTempMemoryBudget, int64 InMemoryMargin)
+	void Reset(int64 InTotalGraphicsMemory, int64 InAllocatedMemory, int64 InPoolSize, int64 InTempMemoryBudget, int64 InMemoryMargin, int64 InMeshPoolSize, int64 InFragmentedMemory)
 	{
+		FragmentedMemory = InFragmentedMemory;
 		TotalGraphicsMemory = InTotalGraphicsMemory;
 		AllocatedMemory = InAllocatedMemory;
 		PoolSize = InPoolSize;
+		MeshPoolSize = InMeshPoolSize;
 		TempMemoryBudget = InTempMemoryBudget;
 		MemoryMargin = InMemoryMargin;
 
@@ -224,6 +226,12 @@ private:
 	/** How much memory is available for textures/meshes. */
 	int64 MemoryBudget;
 
+	/** Size of the separate mesh LOD budget, or -1 if meshes are budgeted with textures. */
+	int64 MeshPoolSize;
+
+	/** Free pool memory outside of the largest free block, which can not hold the bigger reallocations. */
+	int64 FragmentedMemory;
+
 	/**
 	 * The value of all required mips (without memory constraint) used to trigger a budget reset. 
 	 * Whenever the perfect wanted mips drops significantly, we reset the budget to avoid keeping 
@@ -55,11 +55,11 @@ void FDynamicRenderAssetInstanceManager::IncrementalUpdate(FRemovedRenderAssetAr
 	}
 	
 	// Because PendingComponents could have duplicates, we first do a pass to remove everything.
+	State->RemoveComponents(PendingComponents, &RemovedRenderAssets);
 	for (const UPrimitiveComponent* Component : PendingComponents)
 	{
 		check(Component);
 
-		State->RemoveComponent(Component, &RemovedRenderAssets);
 		Component->bAttachedToStreamingManagerAsDynamic = false;
 		// Re-enable updates now that the component is out of the pending list.
 		Component->bIgnoreStreamingManagerUpdate = false;
@@ -219,6 +219,38 @@ void FDynamicRenderAssetInstanceManager::Remove(const UPrimitiveComponent* Compo
 	}
 }
 
+void FDynamicRenderAssetInstanceManager::Remove(TArrayView<const UPrimitiveComponent* const> Components, FRemovedRenderAssetArray* RemovedRenderAssets)
+{
+	TSet<const UPrimitiveComponent*> AttachedComponents;
+	TArray<const UPrimitiveComponent*> ReferencedComponents;
+	for (const UPrimitiveComponent* Component : Components)
+	{
+		check(!Component || Component->IsValidLowLevelFast());
+		if (Component && Component->bAttachedToStreamingManagerAsDynamic)
+		{
+			AttachedComponents.Add(Component);
+			Component->bIgnoreStreamingManagerUpdate = false;
+
+			if (StateSync.GetState()->HasComponentReferences(Component))
+			{
+				ReferencedComponents.Add(Component);
+			}
+			Component->bAttachedToStreamingManagerAsDynamic = false;
+		}
+	}
+
+	if (AttachedComponents.Num())
+	{
+		PendingComponents.RemoveAllSwap([&AttachedComponents](const UPrimitiveComponent* Component) { return AttachedComponents.Contains(Component); }, false);
+	}
+
+	// If the components are used, stop any task possibly indirecting them, and clear references.
+	if (ReferencedComponents.Num())
+	{
+		StateSync.SyncAndGetState()->RemoveComponents(ReferencedComponents, RemovedRenderAssets);
+	}
+}
+
 void FDynamicRenderAssetInstanceManager::PrepareAsyncView()
 {
 	// Terminate any pending work as we are about to create a new task.
@@ -30,6 +30,9 @@ public:
 	// Get all (non removed) components refered by the manager. Debug only.
 	void GetReferencedComponents(TArray<const UPrimitiveComponent*>& Components) { StateSync.SyncAndGetState()->GetReferencedComponents(Components); }
 
+	/** Remove many components at once, e.g. all components of an actor. Same as calling Remove() for each, without the per component searches. */
+	void Remove(TArrayView<const UPrimitiveComponent* const> Components, FRemovedRenderAssetArray* RemovedRenderAssets);
+
 	/** Remove all pending components that are marked for delete. This prevents searching in the pending list for each entry. */
 	void OnPreGarbageCollect(FRemovedRenderAssetArray& RemovedRenderAssets);
 
@@ -239,6 +239,9 @@ void FLevelRenderAssetManager::IncrementalBuild(FDynamicRenderAssetInstanceManag
 
 			PendingComponents.Empty(); // Free the memory.
 			TextureGuidToLevelIndex.Empty();
+
+			// Now that the bounds are final, compile the cell bounds used to skip textures with many instances.
+			NumStepsLeft -= (int64)StaticInstances.CompileCellBounds(CVarStreamingStaticCellGridSize.GetValueOnAnyThread(), CVarStreamingStaticCellMinElements.GetValueOnAnyThread());
 			BuildStep = EStaticBuildStep::Done;
 		}
 		break;
@@ -14,12 +14,45 @@ SkeletalMeshUpdate.cpp: Helpers to stream in and out skeletal mesh LODs.
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Components/SkinnedMeshComponent.h"
 #include "Streaming/RenderAssetUpdate.inl"
+#include "HAL/IConsoleManager.h"
 
 template class TRenderAssetUpdate<FSkelMeshUpdateContext>;
 
 static constexpr uint32 GSkelMeshMaxNumResourceUpdatesPerLOD = 16;
 static constexpr uint32 GSkelMeshMaxNumResourceUpdatesPerBatch = (MAX_MESH_LOD_COUNT - 1) * GSkelMeshMaxNumResourceUpdatesPerLOD;
 
+static int32 GSkelMeshMaxRenderThreadBufferKBPerFrame = 4096;
+static FAutoConsoleVariableRef CVarSkelMeshMaxRenderThreadBufferKBPerFrame(
+	TEXT("r.Streaming.SkeletalMesh.MaxRenderThreadBufferKBPerFrame"),
+	GSkelMeshMaxRenderThreadBufferKBPerFrame,
+	TEXT("When the RHI can't create buffers asynchronously, how many KB of streamed in LOD buffers the rendering thread creates per frame.\n")
+	TEXT("Stream-ins over the budget are deferred to the next frames, so many skeletal meshes streaming in at once don't stall a single frame.\n")
+	TEXT("The first stream-in of a frame is never deferred. 0 for no limit."),
+	ECVF_Default);
+
+/** Accounts for LOD buffers created on the rendering thread, returns false if they don't fit in this frame's budget. */
+static bool ReserveRenderThreadBufferCreation(uint32 SizeInBytes)
+{
+	check(IsInRenderingThread());
+
+	static uint32 BudgetFrameNumber = 0;
+	static int64 SizeCreatedThisFrame = 0;
+	if (BudgetFrameNumber != GFrameNumberRenderThread)
+	{
+		BudgetFrameNumber = GFrameNumberRenderThread;
+		SizeCreatedThisFrame = 0;
+	}
+
+	const int64 Budget = (int64)GSkelMeshMaxRenderThreadBufferKBPerFrame * 1024;
+	if (Budget > 0 && SizeCreatedThisFrame > 0 && SizeCreatedThisFrame + SizeInBytes > Budget)
+	{
+		return false;
+	}
+
+	SizeCreatedThisFrame += SizeInBytes;
+	return true;
+}
+
 FSkelMeshUpdateContext::FSkelMeshUpdateContext(USkeletalMesh* InMesh, EThreadType InCurrentThread)
 	: Mesh(InMesh)
 	, CurrentThread(InCurrentThread)
@@ -166,10 +199,27 @@ void FSkeletalMeshStreamIn::CreateBuffers_Internal(const FContext& Context)
 	}
 }
 
-void FSkeletalMeshStreamIn::CreateBuffers_RenderThread(const FContext& Context)
+bool FSkeletalMeshStreamIn::CreateBuffers_RenderThread(const FContext& Context)
 {
 	check(Context.CurrentThread == TT_Render);
+
+	FSkeletalMeshRenderData* RenderData = Context.RenderData;
+	if (!IsCancelled() && Context.Mesh && RenderData)
+	{
+		uint32 NewLODsSize = 0;
+		for (int32 LODIdx = PendingFirstMip; LODIdx < CurrentFirstLODIdx; ++LODIdx)
+		{
+			NewLODsSize += RenderData->LODRenderData[LODIdx].BuffersSize;
+		}
+
+		if (!ReserveRenderThreadBufferCreation(NewLODsSize))
+		{
+			return false;
+		}
+	}
+
 	CreateBuffers_Internal<true>(Context);
+	return true;
 }
 
 void FSkeletalMeshStreamIn::CreateBuffers_Async(const FContext& Context)
@@ -518,7 +568,13 @@ void TSkeletalMeshStreamIn_IO<bRenderThread>::DoCreateBuffers(const FContext& Co
 {
 	if (bRenderThread)
 	{
-		CreateBuffers_RenderThread(Context);
+		if (!CreateBuffers_RenderThread(Context))
+		{
+			// Over this frame's budget, try again next frame.
+			bDeferExecution = true;
+			PushTask(Context, TT_Render, SRA_UPDATE_CALLBACK(DoCreateBuffers), TT_Render, SRA_UPDATE_CALLBACK(DoCancel));
+			return;
+		}
 	}
 	else
 	{
@@ -572,7 +628,13 @@ void TSkeletalMeshStreamIn_DDC<bRenderThread>::DoCreateBuffers(const FContext& C
 {
 	if (bRenderThread)
 	{
-		CreateBuffers_RenderThread(Context);
+		if (!CreateBuffers_RenderThread(Context))
+		{
+			// Over this frame's budget, try again next frame.
+			bDeferExecution = true;
+			PushTask(Context, TT_Render, SRA_UPDATE_CALLBACK(DoCreateBuffers), TT_Render, SRA_UPDATE_CALLBACK(DoCancel));
+			return;
+		}
 	}
 	else
 	{
@@ -103,8 +103,11 @@ protected:
 		void CheckIsNull() const;
 	};
 
-	/** Create buffers with new LOD data on render or pooled thread */
-	void CreateBuffers_RenderThread(const FContext& Context);
+	/**
+	 * Create buffers with new LOD data on render or pooled thread.
+	 * On the render thread, returns false without creating anything once the frame's creation budget is spent.
+	 */
+	bool CreateBuffers_RenderThread(const FContext& Context);
 	void CreateBuffers_Async(const FContext& Context);
 
 	/** Discard newly streamed-in CPU data */
@@ -28,6 +28,7 @@ public:
 
 	FORCEINLINE int32 CompileElements() { return StateSync.SyncAndGetState()->CompileElements(); }
 	FORCEINLINE int32 CheckRegistrationAndUnpackBounds(TArray<const UPrimitiveComponent*>& RemovedComponents) { return StateSync.SyncAndGetState()->CheckRegistrationAndUnpackBounds(RemovedComponents); }
+	FORCEINLINE int32 CompileCellBounds(int32 NumCellsPerAxis, int32 MinNumElements) { return StateSync.SyncAndGetState()->CompileCellBounds(NumCellsPerAxis, MinNumElements); }
 	FORCEINLINE FRenderAssetInstanceState::FRenderAssetIterator GetRenderAssetIterator( ) {  return StateSync.SyncAndGetState()->GetRenderAssetIterator(); }
 
 	FORCEINLINE bool HasRenderAssetReferences() const { return StateSync.GetState()->NumBounds() > 0; }
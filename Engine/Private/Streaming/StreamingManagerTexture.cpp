@@ -78,6 +78,7 @@ FRenderAssetStreamingManager::FRenderAssetStreamingManager()
 ,	bPauseRenderAssetStreaming(false)
 ,	LastWorldUpdateTime(GIsEditor ? -FLT_MAX : 0) // In editor, visibility is not taken into consideration.
 ,	LastWorldUpdateTime_MipCalcTask(LastWorldUpdateTime)
+,	LastViewOriginsTime(0)
 {
 	// Read settings from ini file.
 	int32 TempInt;
@@ -606,23 +607,73 @@ void FRenderAssetStreamingManager::PrepareAsyncTask(bool bProcessEverything)
 
 	// TODO: Track memory allocated by mesh LODs
 
+	// Free memory outside of the largest free block can only be used by allocations smaller than that block.
+	// Not all RHIs track the largest block, in which case the pool is considered unfragmented.
+	int64 FragmentedMemory = 0;
+	if (Stats.IsUsingLimitedPoolSize() && Stats.LargestContiguousAllocation > 0)
+	{
+		const int64 FreeMemory = Stats.TexturePoolSize - Stats.AllocatedMemorySize;
+		FragmentedMemory = FMath::Max<int64>(FreeMemory - Stats.LargestContiguousAllocation, 0);
+	}
+
 	// When processing all textures, we need unlimited budget so that textures get all at their required states.
 	// Same when forcing stream-in, for which we want all used textures to be fully loaded 
 	if (Stats.IsUsingLimitedPoolSize() && !bProcessEverything && !Settings.bFullyLoadUsedTextures)
 	{
 		const int64 TempMemoryBudget = static_cast<int64>(Settings.MaxTempMemoryAllowed) * 1024 * 1024;
-		AsyncTask.Reset(Stats.TotalGraphicsMemory, Stats.AllocatedMemorySize, Stats.TexturePoolSize, TempMemoryBudget, MemoryMargin);
+		const int64 MeshPoolSize = Settings.MeshPoolSize >= 0 ? static_cast<int64>(Settings.MeshPoolSize) * 1024 * 1024 : -1;
+		AsyncTask.Reset(Stats.TotalGraphicsMemory, Stats.AllocatedMemorySize, Stats.TexturePoolSize, TempMemoryBudget, MemoryMargin, MeshPoolSize, FragmentedMemory);
 	}
 	else
 	{
 		// Temp must be smaller since membudget only updates if it has a least temp memory available.
-		AsyncTask.Reset(0, Stats.AllocatedMemorySize, MAX_int64, MAX_int64 / 2, 0);
+		AsyncTask.Reset(0, Stats.AllocatedMemorySize, MAX_int64, MAX_int64 / 2, 0, -1, 0);
 	}
-	AsyncTask.StreamingData.Init(CurrentViewInfos, LastWorldUpdateTime, LevelRenderAssetManagers, DynamicComponentManager);
+
+	TArray<FStreamingViewInfo> ViewInfos = CurrentViewInfos;
+	AddPredictedViewInfos(ViewInfos);
+	AsyncTask.StreamingData.Init(ViewInfos, LastWorldUpdateTime, LevelRenderAssetManagers, DynamicComponentManager);
 
 	LastWorldUpdateTime_MipCalcTask = LastWorldUpdateTime;
 }
 
+void FRenderAssetStreamingManager::AddPredictedViewInfos(TArray<FStreamingViewInfo>& ViewInfos)
+{
+	// Predictions closer than this are already covered by the view itself, further ones are most likely camera cuts.
+	const float MinPredictedDistance = 500.f;
+	const float MaxViewMoveDistance = 20000.f;
+
+	const double CurrentTime = FApp::GetCurrentTime();
+	const float DeltaTime = (float)(CurrentTime - LastViewOriginsTime);
+	const int32 NumViews = ViewInfos.Num();
+
+	// Views are matched by index, which only holds while the number of views doesn't change.
+	if (Settings.ViewPredictionTime > 0 && DeltaTime > 0 && LastViewOrigins.Num() == NumViews)
+	{
+		ViewInfos.Reserve(NumViews * 2);
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			const FStreamingViewInfo& ViewInfo = ViewInfos[ViewIndex];
+			const FVector ViewMove = ViewInfo.ViewOrigin - LastViewOrigins[ViewIndex];
+			const FVector PredictedOffset = ViewMove * (Settings.ViewPredictionTime / DeltaTime);
+
+			if (!ViewInfo.bOverrideLocation
+				&& ViewMove.SizeSquared() < FMath::Square(MaxViewMoveDistance)
+				&& PredictedOffset.SizeSquared() > FMath::Square(MinPredictedDistance))
+			{
+				ViewInfos.Emplace(ViewInfo.ViewOrigin + PredictedOffset, ViewInfo.ScreenSize, ViewInfo.FOVScreenSize, ViewInfo.BoostFactor, false, 0.f, TWeakObjectPtr<AActor>());
+			}
+		}
+	}
+
+	LastViewOrigins.Reset(NumViews);
+	for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+	{
+		LastViewOrigins.Add(ViewInfos[ViewIndex].ViewOrigin);
+	}
+	LastViewOriginsTime = CurrentTime;
+}
+
 /**
  * Temporarily boosts the streaming distance factor by the specified number.
  * This factor is automatically reset to 1.0 after it's been used for mip-calculations.
@@ -841,11 +892,11 @@ void FRenderAssetStreamingManager::NotifyActorDestroyed( AActor* Actor )
 		}
 	}
 
+	// Remove any references in the dynamic component manager.
+	DynamicComponentManager.Remove(TArrayView<const UPrimitiveComponent* const>(Components.GetData(), Components.Num()), &RemovedRenderAssets);
+
 	for (UPrimitiveComponent* Component : Components)
 	{
-		// Remove any references in the dynamic component manager.
-		DynamicComponentManager.Remove(Component, &RemovedRenderAssets);
-
 		// Reset this now as we have finished iterating over the levels
 		Component->bAttachedToStreamingManagerAsStatic = false;
 	}
@@ -1475,6 +1526,7 @@ void FRenderAssetStreamingManager::UpdateResourceStreaming( float DeltaTime, boo
 
 	CSV_CUSTOM_STAT(TextureStreaming, StreamingPool, ((float)(DisplayedStats.RequiredPool + (GPoolSizeVRAMPercentage > 0 ? 0 : DisplayedStats.NonStreamingMips))) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT(TextureStreaming, SafetyPool, ((float)DisplayedStats.SafetyPool) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(TextureStreaming, FragmentedPool, ((float)DisplayedStats.FragmentedPool) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT(TextureStreaming, TemporaryPool, ((float)DisplayedStats.TemporaryPool) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT(TextureStreaming, CachedMips, ((float)DisplayedStats.CachedMips) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT(TextureStreaming, WantedMips, ((float)DisplayedStats.WantedMips) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
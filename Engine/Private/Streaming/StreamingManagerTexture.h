@@ -203,6 +203,9 @@ private:
 		/** Adds new textures/meshes and level data on the gamethread (while the worker thread isn't active). */
 		void PrepareAsyncTask( bool bProcessEverything );
 
+		/** Adds a view ahead of each fast moving view, extrapolated from its location at the previous async task. */
+		void AddPredictedViewInfos( TArray<FStreamingViewInfo>& ViewInfos );
+
 		/** Checks for updates in the user settings (CVars, etc). */
 		void CheckUserSettings();
 
@@ -402,6 +405,10 @@ private:
 	/** LastWorldUpdateTime seen by the async task. */
 	float LastWorldUpdateTime_MipCalcTask;
 
+	/** View locations given to the previous async task and when, to predict where the views are heading. */
+	TArray<FVector> LastViewOrigins;
+	double LastViewOriginsTime;
+
 	FRenderAssetStreamingStats DisplayedStats;
 	FRenderAssetStreamingStats GatheredStats;
 
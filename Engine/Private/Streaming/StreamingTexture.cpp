@@ -25,6 +25,10 @@ FStreamingRenderAsset::FStreamingRenderAsset(
 
 	InstanceRemovedTimestamp = FApp::GetCurrentTime();
 	DynamicBoostFactor = 1.f;
+	MaxSizeHistory = 0.f;
+	MaxSizeHistory_VisibleOnly = 0.f;
+	MaxSizeHistoryTimestamp = 0.0;
+	MaxSizeHistoryTimestamp_VisibleOnly = 0.0;
 
 	bHasUpdatePending = InRenderAsset && InRenderAsset->bHasStreamingUpdatePending;
 
@@ -322,6 +326,20 @@ int32 FStreamingRenderAsset::GetWantedMipsFromSize(float Size, float MaxScreenSi
 }
 
 /** Set the wanted mips from the async task data */
+/** Raises InOutSize to the highest size seen recently, unless it has been lower for longer than Delay. */
+static void ApplyScreenSizeHistory(float& InOutSize, float& History, double& HistoryTimestamp, double CurrentTime, float Delay)
+{
+	if (InOutSize >= History || CurrentTime - HistoryTimestamp > Delay)
+	{
+		History = InOutSize;
+		HistoryTimestamp = CurrentTime;
+	}
+	else
+	{
+		InOutSize = History;
+	}
+}
+
 void FStreamingRenderAsset::SetPerfectWantedMips_Async(
 	float MaxSize,
 	float MaxSize_VisibleOnly,
@@ -333,6 +351,13 @@ void FStreamingRenderAsset::SetPerfectWantedMips_Async(
 	bForceFullyLoadHeuristic = (MaxSize == FLT_MAX || MaxSize_VisibleOnly == FLT_MAX);
 	bLooksLowRes = InLooksLowRes; // Things like lightmaps, HLOD and close instances.
 
+	if (IsMesh() && Settings.MeshLODStreamOutDelay > 0 && !bForceFullyLoadHeuristic)
+	{
+		const double CurrentTime = FApp::GetCurrentTime();
+		ApplyScreenSizeHistory(MaxSize, MaxSizeHistory, MaxSizeHistoryTimestamp, CurrentTime, Settings.MeshLODStreamOutDelay);
+		ApplyScreenSizeHistory(MaxSize_VisibleOnly, MaxSizeHistory_VisibleOnly, MaxSizeHistoryTimestamp_VisibleOnly, CurrentTime, Settings.MeshLODStreamOutDelay);
+	}
+
 	if (MaxNumForcedLODs >= MaxAllowedMips)
 	{
 		VisibleWantedMips = HiddenWantedMips = NumForcedMips = MaxAllowedMips;
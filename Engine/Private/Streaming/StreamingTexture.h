@@ -255,6 +255,11 @@ struct FStreamingRenderAsset
 	double			InstanceRemovedTimestamp;
 	/** (3) Extra gameplay boost factor. Reset after every update. */
 	float			DynamicBoostFactor;
+	/** (3) Highest recent screen sizes of a mesh and when they were reached, so its wanted LODs only drop once the screen size stays lower. */
+	float			MaxSizeHistory;
+	float			MaxSizeHistory_VisibleOnly;
+	double			MaxSizeHistoryTimestamp;
+	double			MaxSizeHistoryTimestamp_VisibleOnly;
 
 	/** (4) How many mips are missing to satisfy ideal quality because of max size limitation. Used to prevent sacrificing mips that are already visually sacrificed. */
 	int32			NumMissingMips;
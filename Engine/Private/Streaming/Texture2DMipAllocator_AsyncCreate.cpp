@@ -8,6 +8,9 @@ Texture2DStreamIn_AsyncCreate.cpp: Implementation of FTextureMipAllocator using
 #include "RenderUtils.h"
 #include "Containers/ResourceArray.h"
 
+// Alignment of each mip within the allocation, large enough for platform IO to read straight into it.
+static const uint32 MipDataAlignment = 16;
+
 FTexture2DMipAllocator_AsyncCreate::FTexture2DMipAllocator_AsyncCreate()
 	: FTextureMipAllocator(ETickState::AllocateMips, ETickThread::Async)
 {
@@ -15,7 +18,7 @@ FTexture2DMipAllocator_AsyncCreate::FTexture2DMipAllocator_AsyncCreate()
 
 FTexture2DMipAllocator_AsyncCreate::~FTexture2DMipAllocator_AsyncCreate()
 {
-	check(!FinalMipData.Num());
+	check(!FinalMipData.Num() && !FinalMipDataAllocation);
 }
 
 bool FTexture2DMipAllocator_AsyncCreate::AllocateMips(
@@ -36,7 +39,9 @@ bool FTexture2DMipAllocator_AsyncCreate::AllocateMips(
 	OutMipInfos.AddDefaulted(Context.CurrentFirstMipIndex);
 
 	// Allocate the mip memory as temporary buffers so that the FTextureMipDataProvider implementation can write to it.
+	// All mips share one allocation, each starting aligned so that IO can read directly into it.
 	const TIndirectArray<FTexture2DMipMap>& OwnerMips = Texture2D->GetPlatformMips();
+	SIZE_T TotalDataSize = 0;
 	for (int32 MipIndex = Context.PendingFirstMipIndex; MipIndex < Context.CurrentFirstMipIndex; ++MipIndex)
 	{
 		const FTexture2DMipMap& OwnerMip = OwnerMips[MipIndex];
@@ -46,10 +51,21 @@ bool FTexture2DMipAllocator_AsyncCreate::AllocateMips(
 		MipInfo.SizeX = OwnerMip.SizeX;
 		MipInfo.SizeY = OwnerMip.SizeY;
 		MipInfo.DataSize = CalcTextureMipMapSize(MipInfo.SizeX, MipInfo.SizeY, MipInfo.Format, 0);
-		// Allocate the mip in main memory. It will later be used to create the mips with proper initial states (without going through lock/unlock).
-		MipInfo.DestData = FMemory::Malloc(MipInfo.DataSize);
+		TotalDataSize += Align(MipInfo.DataSize, MipDataAlignment);
+	}
+
+	// Allocate the mips in main memory. It will later be used to create the mips with proper initial states (without going through lock/unlock).
+	check(!FinalMipDataAllocation);
+	FinalMipDataAllocation = TotalDataSize ? FMemory::Malloc(TotalDataSize, MipDataAlignment) : nullptr;
+
+	uint8* NextMipData = (uint8*)FinalMipDataAllocation;
+	for (int32 MipIndex = Context.PendingFirstMipIndex; MipIndex < Context.CurrentFirstMipIndex; ++MipIndex)
+	{
+		FTextureMipInfo& MipInfo = OutMipInfos[MipIndex];
+		MipInfo.DestData = NextMipData;
+		NextMipData += Align(MipInfo.DataSize, MipDataAlignment);
 
-		// Backup the allocated memory so that it can safely be freed.
+		// Backup the mip memory so that it can be given to the RHI.
 		FinalMipData.Add(MipInfo.DestData);
 	}
 
@@ -150,12 +166,10 @@ int32 FTexture2DMipAllocator_AsyncCreate::GetCurrentFirstMip(UTexture* Texture)
 void FTexture2DMipAllocator_AsyncCreate::ReleaseAllocatedMipData()
 {
 	// Release the temporary mip data.
-	for (void* NewData : FinalMipData)
+	if (FinalMipDataAllocation)
 	{
-		if (NewData)
-		{
-			FMemory::Free(NewData);
-		}
+		FMemory::Free(FinalMipDataAllocation);
+		FinalMipDataAllocation = nullptr;
 	}
 	FinalMipData.Empty();
 }
@@ -48,7 +48,9 @@ protected:
 	int32 FinalSizeY = 0;
 	// The initial and final format of the texture.
 	EPixelFormat FinalFormat = EPixelFormat::PF_Unknown;
-	// The temporary main memory allocations holding the mip data
+	// The temporary main memory holding the mip data, for each mip, all within FinalMipDataAllocation.
 	TArray<void*, TInlineAllocator<MAX_TEXTURE_MIP_COUNT>> FinalMipData;
+	// The single allocation holding all new mips, so that streaming a texture costs one allocation whatever its mip count.
+	void* FinalMipDataAllocation = nullptr;
 };
 
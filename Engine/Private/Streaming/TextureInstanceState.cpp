@@ -70,6 +70,11 @@ void FRenderAssetInstanceState::RemoveBounds(int32 BoundsIndex)
 		BoundsToUnpack[BoundsToUnpackIndex] = INDEX_NONE;
 	}
 
+	FreeBounds(BoundsIndex);
+}
+
+void FRenderAssetInstanceState::FreeBounds(int32 BoundsIndex)
+{
 	// If the BoundsIndex is out of range, the next code will crash.	
 	if (!ensure(Bounds4Components.IsValidIndex(BoundsIndex)))
 	{
@@ -465,6 +470,93 @@ void FRenderAssetInstanceState::RemoveComponent(const UPrimitiveComponent* Compo
 	}
 }
 
+void FRenderAssetInstanceState::RemoveComponents(TArrayView<const UPrimitiveComponent* const> Components, FRemovedRenderAssetArray* RemovedTextures)
+{
+	TArray<int32> RemovedBoundsIndices;
+	TSet<const UStreamableRenderAsset*> RemovedTextureSet;
+
+	for (const UPrimitiveComponent* Component : Components)
+	{
+		int32 ElementIndex = INDEX_NONE;
+		if (!ComponentMap.RemoveAndCopyValue(Component, ElementIndex))
+		{
+			continue;
+		}
+
+		int32 IterationCount_DebuggingOnly = 0;
+		while (ElementIndex != INDEX_NONE)
+		{
+			int32 BoundsIndex = INDEX_NONE;
+			const UStreamableRenderAsset* Texture = nullptr;
+
+			RemoveElement(ElementIndex, ElementIndex, BoundsIndex, Texture, IterationCount_DebuggingOnly++);
+
+			if (BoundsIndex != INDEX_NONE)
+			{
+				RemovedBoundsIndices.Add(BoundsIndex);
+			}
+
+			if (Texture && RemovedTextures)
+			{
+				RemovedTextureSet.Add(Texture);
+			}
+		}
+	}
+
+	if (RemovedTextureSet.Num())
+	{
+		for (const UStreamableRenderAsset* Texture : *RemovedTextures)
+		{
+			RemovedTextureSet.Remove(Texture);
+		}
+		RemovedTextures->Append(RemovedTextureSet.Array());
+	}
+
+	if (!RemovedBoundsIndices.Num())
+	{
+		return;
+	}
+
+	// Elements of a component share their bounds.
+	RemovedBoundsIndices.Sort();
+	int32 NumUniqueBounds = 0;
+	for (int32 BoundsIndex : RemovedBoundsIndices)
+	{
+		if (NumUniqueBounds == 0 || RemovedBoundsIndices[NumUniqueBounds - 1] != BoundsIndex)
+		{
+			RemovedBoundsIndices[NumUniqueBounds++] = BoundsIndex;
+		}
+	}
+	RemovedBoundsIndices.SetNum(NumUniqueBounds, false);
+
+	// Invalidate the removed bounds in BoundsToUnpack with a single pass, see RemoveBounds().
+	if (BoundsToUnpack.Num())
+	{
+		TBitArray<> RemovedBounds(false, Bounds4Components.Num());
+		for (int32 BoundsIndex : RemovedBoundsIndices)
+		{
+			if (ensure(RemovedBounds.IsValidIndex(BoundsIndex)))
+			{
+				RemovedBounds[BoundsIndex] = true;
+			}
+		}
+
+		for (int32& BoundsIndex : BoundsToUnpack)
+		{
+			if (BoundsIndex != INDEX_NONE && RemovedBounds.IsValidIndex(BoundsIndex) && RemovedBounds[BoundsIndex])
+			{
+				BoundsIndex = INDEX_NONE;
+			}
+		}
+	}
+
+	for (int32 BoundsIndex : RemovedBoundsIndices)
+	{
+		checkSlow(!FreeBoundIndices.Contains(BoundsIndex));
+		FreeBounds(BoundsIndex);
+	}
+}
+
 bool FRenderAssetInstanceState::RemoveComponentReferences(const UPrimitiveComponent* Component) 
 { 
 	// Because the async streaming task could be running, we can't change the async view state. 
@@ -667,6 +759,112 @@ int32 FRenderAssetInstanceState::CompileElements()
 	return CompiledRenderAssetMap.Num();
 }
 
+int32 FRenderAssetInstanceState::CompileCellBounds(int32 NumCellsPerAxis, int32 MinNumElements)
+{
+	CompiledCellBoundsMap.Empty();
+	CellGridNumCells = 0;
+
+	if (NumCellsPerAxis <= 0)
+	{
+		return 0;
+	}
+
+	// The grid only covers XY, distances along Z are ignored which keeps the cell bounds conservative.
+	FBox2D GridBox(ForceInit);
+	for (int32 BoundIndex = 0; BoundIndex < Bounds4Components.Num(); ++BoundIndex)
+	{
+		const FBounds4& Bounds = Bounds4[BoundIndex / 4];
+		const int32 SubIndex = BoundIndex % 4;
+		if (Bounds4Components[BoundIndex] && Bounds.PackedRelativeBox[SubIndex])
+		{
+			GridBox += FVector2D(Bounds.OriginX[SubIndex], Bounds.OriginY[SubIndex]);
+		}
+	}
+
+	if (!GridBox.bIsValid)
+	{
+		return 0;
+	}
+
+	CellGridNumCells = NumCellsPerAxis;
+	CellGridOrigin = GridBox.Min;
+	CellGridCellSize.X = FMath::Max((GridBox.Max.X - GridBox.Min.X) / NumCellsPerAxis, 1.f);
+	CellGridCellSize.Y = FMath::Max((GridBox.Max.Y - GridBox.Min.Y) / NumCellsPerAxis, 1.f);
+
+	// Distance along one axis from a location to a cell, cells on the edges extend infinitely outward.
+	auto GetAxisDistanceToCell = [NumCellsPerAxis](float Location, float GridOrigin, float CellSize, int32 Cell) -> float
+	{
+		const float CellMin = GridOrigin + Cell * CellSize;
+		const float CellMax = CellMin + CellSize;
+		const float DistanceBelow = Cell > 0 ? CellMin - Location : 0.f;
+		const float DistanceAbove = Cell < NumCellsPerAxis - 1 ? Location - CellMax : 0.f;
+		return FMath::Max3(DistanceBelow, DistanceAbove, 0.f);
+	};
+
+	const int32 NumCells = NumCellsPerAxis * NumCellsPerAxis;
+	int32 NumSteps = 0;
+
+	for (TMap<const UStreamableRenderAsset*, TArray<FCompiledElement> >::TConstIterator It(CompiledRenderAssetMap); It; ++It)
+	{
+		const UStreamableRenderAsset* Asset = It.Key();
+		const TArray<FCompiledElement>& CompiledElements = It.Value();
+		if (CompiledElements.Num() < MinNumElements || !Asset || !Asset->IsA<UTexture>())
+		{
+			continue;
+		}
+
+		// Forced loads and fixed resolutions don't depend on the distance, never skip those.
+		const bool bHasDistanceIndependentElements = CompiledElements.ContainsByPredicate([](const FCompiledElement& Element)
+		{
+			return Element.bForceLoad || Element.TexelFactor < 0 || Element.TexelFactor == FLT_MAX;
+		});
+		if (bHasDistanceIndependentElements)
+		{
+			continue;
+		}
+
+		TArray<float>& CellBounds = CompiledCellBoundsMap.Add(Asset);
+		CellBounds.AddZeroed(NumCells);
+
+		for (const FCompiledElement& Element : CompiledElements)
+		{
+			const FBounds4& Bounds = Bounds4[Element.BoundsIndex / 4];
+			const int32 SubIndex = Element.BoundsIndex % 4;
+			if (!Bounds.PackedRelativeBox[SubIndex])
+			{
+				continue;
+			}
+
+			const float OriginX = Bounds.OriginX[SubIndex];
+			const float OriginY = Bounds.OriginY[SubIndex];
+			const float ExtentX = Bounds.ExtentX[SubIndex];
+			const float ExtentY = Bounds.ExtentY[SubIndex];
+			const float RadiusSq = FMath::Square(Bounds.Radius[SubIndex]);
+
+			for (int32 CellY = 0; CellY < NumCellsPerAxis; ++CellY)
+			{
+				const float DistanceY = GetAxisDistanceToCell(OriginY, CellGridOrigin.Y, CellGridCellSize.Y, CellY);
+				for (int32 CellX = 0; CellX < NumCellsPerAxis; ++CellX)
+				{
+					const float DistanceX = GetAxisDistanceToCell(OriginX, CellGridOrigin.X, CellGridCellSize.X, CellX);
+
+					// The smallest of both metrics (distance to the box, or squared distance minus squared radius) as used by UpdateBoundSizes_Async().
+					const float BoxDistSq = FMath::Square(FMath::Max(DistanceX - ExtentX, 0.f)) + FMath::Square(FMath::Max(DistanceY - ExtentY, 0.f));
+					const float SphereDistSq = FMath::Square(DistanceX) + FMath::Square(DistanceY) - RadiusSq;
+					const float ClampedDistSq = FMath::Max(FMath::Min(BoxDistSq, SphereDistSq), 1.f);
+
+					float& CellBound = CellBounds[CellY * NumCellsPerAxis + CellX];
+					CellBound = FMath::Max(CellBound, Element.TexelFactor * FMath::InvSqrt(ClampedDistSq));
+				}
+			}
+		}
+
+		NumSteps += CompiledElements.Num();
+	}
+
+	return NumSteps;
+}
+
 int32 FRenderAssetInstanceState::CheckRegistrationAndUnpackBounds(TArray<const UPrimitiveComponent*>& RemovedComponents)
 {
 	for (int32 BoundIndex : BoundsToUnpack)
@@ -813,4 +1011,6 @@ void FRenderAssetInstanceState::OffsetBounds(const FVector& Offset)
 			Bounds4[BoundIndex / 4].OffsetBounds(BoundIndex % 4, Offset);
 		}
 	}
+	CellGridOrigin.X += Offset.X;
+	CellGridOrigin.Y += Offset.Y;
 }
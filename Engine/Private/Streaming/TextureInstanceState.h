@@ -37,6 +37,8 @@ public:
 
 	FORCEINLINE bool HasComponentReferences(const UPrimitiveComponent* Component) const { return ComponentMap.Contains(Component); }
 	void RemoveComponent(const UPrimitiveComponent* Component, FRemovedRenderAssetArray* RemovedTextures);
+	// Same as RemoveComponent for many components, e.g. all components of an actor, without the per component searches.
+	void RemoveComponents(TArrayView<const UPrimitiveComponent* const> Components, FRemovedRenderAssetArray* RemovedTextures);
 	bool RemoveComponentReferences(const UPrimitiveComponent* Component);
 
 	void GetReferencedComponents(TArray<const UPrimitiveComponent*>& Components) const;
@@ -51,6 +53,8 @@ public:
 	// Generate the compiled elements.
 	int32 CompileElements();
 	int32 CheckRegistrationAndUnpackBounds(TArray<const UPrimitiveComponent*>& RemovedComponents);
+	// Generate the compiled cell bounds of textures having at least MinNumElements compiled elements. Requires the compiled elements and unpacked bounds.
+	int32 CompileCellBounds(int32 NumCellsPerAxis, int32 MinNumElements);
 
 	/** Move around one bound to free the last bound indices. This allows to keep the number of dynamic bounds low. */
 	bool MoveBound(int32 SrcBoundIndex, int32 DstBoundIndex);
@@ -69,6 +73,8 @@ private:
 	int32 AddBounds(const FBoxSphereBounds& Bounds, uint32 PackedRelativeBox, const UPrimitiveComponent* Component, float LastRenderTime, const FVector4& RangeOrigin, float MinDistanceSq, float MinRangeSq, float MaxRangeSq);
 	FORCEINLINE int32 AddBounds(const UPrimitiveComponent* Component);
 	void RemoveBounds(int32 Index);
+	// Release the bound entry, once it has been removed from BoundsToUnpack.
+	void FreeBounds(int32 Index);
 
 	void AddRenderAssetElements(const UPrimitiveComponent* Component, const TArrayView<FStreamingRenderAssetPrimitiveInfo>& RenderAssetInstanceInfos, int32 BoundsIndex, int32*& ComponentLink);
 
@@ -223,6 +223,14 @@ TRefCountPtr<FRenderAssetInstanceView> FRenderAssetInstanceView::CreateViewWithU
 	return NewView;
 }
 
+int32 FRenderAssetInstanceView::GetCellIndex(const FVector& Location) const
+{
+	check(CellGridNumCells > 0);
+	const int32 CellX = FMath::Clamp<int32>(FMath::FloorToInt((Location.X - CellGridOrigin.X) / CellGridCellSize.X), 0, CellGridNumCells - 1);
+	const int32 CellY = FMath::Clamp<int32>(FMath::FloorToInt((Location.Y - CellGridOrigin.Y) / CellGridCellSize.Y), 0, CellGridNumCells - 1);
+	return CellY * CellGridNumCells + CellX;
+}
+
 float FRenderAssetInstanceView::GetMaxDrawDistSqWithLODParent(const FVector& Origin, const FVector& ParentOrigin, float ParentMinDrawDist, float ParentBoundingSphereRadius)
 {
 	const float Result = ParentMinDrawDist + ParentBoundingSphereRadius + (Origin - ParentOrigin).Size();
@@ -328,6 +336,16 @@ void FRenderAssetInstanceView::OnVerifyElementIdxFailed(int32 Idx, bool bInRange
 		*CompLinkStr, *AssetLinkStr, bFoundInFreeIndices, IterationCount);
 }
 
+/** The view values used by the bounds evaluation, splatted once per update instead of once per bounds. */
+struct FRenderAssetInstanceAsyncView::FViewVectors
+{
+	VectorRegister ScreenSize;
+	VectorRegister ExtraBoostForVisiblePrimitive;
+	VectorRegister ViewOriginX;
+	VectorRegister ViewOriginY;
+	VectorRegister ViewOriginZ;
+};
+
 void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 	const TArray<FStreamingViewInfo>& ViewInfos,
 	const FStreamingViewInfoExtraArray& ViewInfoExtras,
@@ -341,11 +359,57 @@ void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 	const int32 NumViews = ViewInfos.Num();
 	const int32 NumBounds4 = View->NumBounds4();
 
-	const VectorRegister LastUpdateTime4 = VectorSet(LastUpdateTime, LastUpdateTime, LastUpdateTime, LastUpdateTime);
+	TArray<FViewVectors, TInlineAllocator<4>> ViewVectors;
+	ViewVectors.AddUninitialized(NumViews);
+	for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+	{
+		const FStreamingViewInfo& ViewInfo = ViewInfos[ViewIndex];
+		const FStreamingViewInfoExtra& ViewInfoExtra = ViewInfoExtras[ViewIndex];
+
+		ViewVectors[ViewIndex].ScreenSize = VectorLoadFloat1( &ViewInfoExtra.ScreenSizeFloat );
+		ViewVectors[ViewIndex].ExtraBoostForVisiblePrimitive = VectorLoadFloat1( &ViewInfoExtra.ExtraBoostForVisiblePrimitiveFloat );
+		ViewVectors[ViewIndex].ViewOriginX = VectorLoadFloat1( &ViewInfo.ViewOrigin.X );
+		ViewVectors[ViewIndex].ViewOriginY = VectorLoadFloat1( &ViewInfo.ViewOrigin.Y );
+		ViewVectors[ViewIndex].ViewOriginZ = VectorLoadFloat1( &ViewInfo.ViewOrigin.Z );
+	}
 
 	BoundsViewInfo.Empty(NumBounds4 * 4);
 	BoundsViewInfo.AddUninitialized(NumBounds4 * 4);
 
+	ViewCells.Reset();
+	if (View->HasCompiledCellBounds())
+	{
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			FViewCell& ViewCell = ViewCells.AddDefaulted_GetRef();
+			ViewCell.CellIndex = View->GetCellIndex(ViewInfos[ViewIndex].ViewOrigin);
+			ViewCell.ScreenSize = ViewInfoExtras[ViewIndex].ScreenSizeFloat * FMath::Max(ViewInfoExtras[ViewIndex].ExtraBoostForVisiblePrimitiveFloat, 1.f);
+		}
+	}
+
+	// The metric is selected once for all bounds, so that the inner loop has no branch.
+	const VectorRegister ViewMaxNormalizedSize = Settings.bUseNewMetrics
+		? UpdateBoundSizes_Async<true>(ViewVectors, LastUpdateTime)
+		: UpdateBoundSizes_Async<false>(ViewVectors, LastUpdateTime);
+
+	if (Settings.MinLevelRenderAssetScreenSize > 0)
+	{
+		float ViewMaxNormalizedSizeResult = VectorGetComponent(ViewMaxNormalizedSize, 0);
+		for (int32 SubIndex = 1; SubIndex < 4; ++SubIndex)
+		{
+			ViewMaxNormalizedSizeResult = FMath::Max(ViewMaxNormalizedSizeResult, VectorGetComponent(ViewMaxNormalizedSize, SubIndex));
+		}
+		MaxLevelRenderAssetScreenSize = View->GetMaxTexelFactor() * ViewMaxNormalizedSizeResult;
+	}
+}
+
+template <bool bUseNewMetrics>
+VectorRegister FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(TArrayView<const FViewVectors> ViewVectors, float LastUpdateTime)
+{
+	const int32 NumBounds4 = View->NumBounds4();
+
+	const VectorRegister LastUpdateTime4 = VectorSet(LastUpdateTime, LastUpdateTime, LastUpdateTime, LastUpdateTime);
+
 	// Max normalized size from all elements
 	VectorRegister ViewMaxNormalizedSize = VectorZero();
 
@@ -363,44 +427,39 @@ void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 		const VectorRegister ExtentX = VectorLoadAligned( &CurrentBounds4.ExtentX );
 		const VectorRegister ExtentY = VectorLoadAligned( &CurrentBounds4.ExtentY );
 		const VectorRegister ExtentZ = VectorLoadAligned( &CurrentBounds4.ExtentZ );
-		const VectorRegister Radius = VectorLoadAligned( &CurrentBounds4.Radius );
+		const VectorRegister RadiusSq = VectorMultiply( VectorLoadAligned( &CurrentBounds4.Radius ), VectorLoadAligned( &CurrentBounds4.Radius ) );
 		const VectorRegister PackedRelativeBox = VectorLoadAligned( reinterpret_cast<const FVector4*>(&CurrentBounds4.PackedRelativeBox) );
 		const VectorRegister MinDistanceSq = VectorLoadAligned( &CurrentBounds4.MinDistanceSq );
 		const VectorRegister MinRangeSq = VectorLoadAligned( &CurrentBounds4.MinRangeSq );
 		const VectorRegister MaxRangeSq = VectorLoadAligned(&CurrentBounds4.MaxRangeSq);
 		const VectorRegister LastRenderTime = VectorLoadAligned(&CurrentBounds4.LastRenderTime);
 
+		// Those are the same for every view. When PackedRelativeBox == 0, the entry is not valid and must not affect the view max.
+		const VectorRegister ValidMask = VectorCompareNE(PackedRelativeBox, VectorZero());
+		const VectorRegister SeenRecentlyMask = VectorCompareGT(LastRenderTime, LastUpdateTime4);
+
 		VectorRegister MaxNormalizedSize = VectorZero();
 		VectorRegister MaxNormalizedSize_VisibleOnly = VectorZero();
 
-		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		for (const FViewVectors& ViewVector : ViewVectors)
 		{
-			const FStreamingViewInfo& ViewInfo = ViewInfos[ViewIndex];
-			const FStreamingViewInfoExtra& ViewInfoExtra = ViewInfoExtras[ViewIndex];
-
-			const VectorRegister ScreenSize = VectorLoadFloat1( &ViewInfoExtra.ScreenSizeFloat );
-			const VectorRegister ExtraBoostForVisiblePrimitive = VectorLoadFloat1( &ViewInfoExtra.ExtraBoostForVisiblePrimitiveFloat );
-			const VectorRegister ViewOriginX = VectorLoadFloat1( &ViewInfo.ViewOrigin.X );
-			const VectorRegister ViewOriginY = VectorLoadFloat1( &ViewInfo.ViewOrigin.Y );
-			const VectorRegister ViewOriginZ = VectorLoadFloat1( &ViewInfo.ViewOrigin.Z );
-
-			VectorRegister DistSqMinusRadiusSq = VectorZero();
-			if (Settings.bUseNewMetrics)
+			VectorRegister DistSqMinusRadiusSq;
+			if (bUseNewMetrics)
 			{
 				// In this case DistSqMinusRadiusSq will contain the distance to the box^2
-				VectorRegister Temp = VectorSubtract( ViewOriginX, OriginX );
+				VectorRegister Temp = VectorSubtract( ViewVector.ViewOriginX, OriginX );
 				Temp = VectorAbs( Temp );
 				VectorRegister BoxRef = VectorMin( Temp, ExtentX );
 				Temp = VectorSubtract( Temp, BoxRef );
 				DistSqMinusRadiusSq = VectorMultiply( Temp, Temp );
 
-				Temp = VectorSubtract( ViewOriginY, OriginY );
+				Temp = VectorSubtract( ViewVector.ViewOriginY, OriginY );
 				Temp = VectorAbs( Temp );
 				BoxRef = VectorMin( Temp, ExtentY );
 				Temp = VectorSubtract( Temp, BoxRef );
 				DistSqMinusRadiusSq = VectorMultiplyAdd( Temp, Temp, DistSqMinusRadiusSq );
 
-				Temp = VectorSubtract( ViewOriginZ, OriginZ );
+				Temp = VectorSubtract( ViewVector.ViewOriginZ, OriginZ );
 				Temp = VectorAbs( Temp );
 				BoxRef = VectorMin( Temp, ExtentZ );
 				Temp = VectorSubtract( Temp, BoxRef );
@@ -408,15 +467,14 @@ void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 			}
 			else
 			{
-				VectorRegister Temp = VectorSubtract( ViewOriginX, OriginX );
+				VectorRegister Temp = VectorSubtract( ViewVector.ViewOriginX, OriginX );
 				VectorRegister DistSq = VectorMultiply( Temp, Temp );
-				Temp = VectorSubtract( ViewOriginY, OriginY );
+				Temp = VectorSubtract( ViewVector.ViewOriginY, OriginY );
 				DistSq = VectorMultiplyAdd( Temp, Temp, DistSq );
-				Temp = VectorSubtract( ViewOriginZ, OriginZ );
+				Temp = VectorSubtract( ViewVector.ViewOriginZ, OriginZ );
 				DistSq = VectorMultiplyAdd( Temp, Temp, DistSq );
 
-				DistSqMinusRadiusSq = VectorMultiply( Radius, Radius );
-				DistSqMinusRadiusSq = VectorSubtract( DistSq, DistSqMinusRadiusSq );
+				DistSqMinusRadiusSq = VectorSubtract( DistSq, RadiusSq );
 				// This can be negative here!!!
 			}
 
@@ -426,11 +484,11 @@ void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 			// Compute in range  Squared distance between range.
 			VectorRegister InRangeMask;
 			{
-				VectorRegister Temp = VectorSubtract( ViewOriginX, RangeOriginX );
+				VectorRegister Temp = VectorSubtract( ViewVector.ViewOriginX, RangeOriginX );
 				VectorRegister RangeDistSq = VectorMultiply( Temp, Temp );
-				Temp = VectorSubtract( ViewOriginY, RangeOriginY );
+				Temp = VectorSubtract( ViewVector.ViewOriginY, RangeOriginY );
 				RangeDistSq = VectorMultiplyAdd( Temp, Temp, RangeDistSq );
-				Temp = VectorSubtract( ViewOriginZ, RangeOriginZ );
+				Temp = VectorSubtract( ViewVector.ViewOriginZ, RangeOriginZ );
 				RangeDistSq = VectorMultiplyAdd( Temp, Temp, RangeDistSq );
 
 				VectorRegister ClampedRangeDistSq = VectorMax( MinRangeSq, RangeDistSq );
@@ -440,40 +498,35 @@ void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 
 			ClampedDistSq = VectorMax(ClampedDistSq, VectorOne()); // Prevents / 0
 			VectorRegister ScreenSizeOverDistance = VectorReciprocalSqrt(ClampedDistSq);
-			ScreenSizeOverDistance = VectorMultiply(ScreenSizeOverDistance, ScreenSize);
+			ScreenSizeOverDistance = VectorMultiply(ScreenSizeOverDistance, ViewVector.ScreenSize);
 
 			MaxNormalizedSize = VectorMax(ScreenSizeOverDistance, MaxNormalizedSize);
 
-			// Accumulate the view max amongst all. When PackedRelativeBox == 0, the entry is not valid and must not affet the max.
-			const VectorRegister CulledMaxNormalizedSize = VectorSelect(VectorCompareNE(PackedRelativeBox, VectorZero()), MaxNormalizedSize, VectorZero());
-			ViewMaxNormalizedSize = VectorMax(ViewMaxNormalizedSize, CulledMaxNormalizedSize);
-
 			// Now mask to zero if not in range, or not seen recently.
-			ScreenSizeOverDistance = VectorMultiply(ScreenSizeOverDistance, ExtraBoostForVisiblePrimitive);
-			ScreenSizeOverDistance = VectorSelect(InRangeMask, ScreenSizeOverDistance, VectorZero());
-			ScreenSizeOverDistance = VectorSelect(VectorCompareGT(LastRenderTime, LastUpdateTime4), ScreenSizeOverDistance, VectorZero());
+			ScreenSizeOverDistance = VectorMultiply(ScreenSizeOverDistance, ViewVector.ExtraBoostForVisiblePrimitive);
+			ScreenSizeOverDistance = VectorSelect(VectorBitwiseAnd(InRangeMask, SeenRecentlyMask), ScreenSizeOverDistance, VectorZero());
 
 			MaxNormalizedSize_VisibleOnly = VectorMax(ScreenSizeOverDistance, MaxNormalizedSize_VisibleOnly);
 		}
 
+		// Accumulate the view max amongst all, MaxNormalizedSize only grows over the views so masking once is enough.
+		ViewMaxNormalizedSize = VectorMax(ViewMaxNormalizedSize, VectorSelect(ValidMask, MaxNormalizedSize, VectorZero()));
+
 		// Store results
+		MS_ALIGN(16) float MaxNormalizedSizes[4] GCC_ALIGN(16);
+		MS_ALIGN(16) float MaxNormalizedSizes_VisibleOnly[4] GCC_ALIGN(16);
+		VectorStoreAligned(MaxNormalizedSize, MaxNormalizedSizes);
+		VectorStoreAligned(MaxNormalizedSize_VisibleOnly, MaxNormalizedSizes_VisibleOnly);
+
 		FBoundsViewInfo* BoundsVieWInfo = &BoundsViewInfo[Bounds4Index * 4];
 		for (int32 SubIndex = 0; SubIndex < 4; ++SubIndex)
 		{
-			BoundsVieWInfo[SubIndex].MaxNormalizedSize = VectorGetComponent(MaxNormalizedSize, SubIndex);
-			BoundsVieWInfo[SubIndex].MaxNormalizedSize_VisibleOnly = VectorGetComponent(MaxNormalizedSize_VisibleOnly, SubIndex);
+			BoundsVieWInfo[SubIndex].MaxNormalizedSize = MaxNormalizedSizes[SubIndex];
+			BoundsVieWInfo[SubIndex].MaxNormalizedSize_VisibleOnly = MaxNormalizedSizes_VisibleOnly[SubIndex];
 		}
 	}
 
-	if (Settings.MinLevelRenderAssetScreenSize > 0)
-	{
-		float ViewMaxNormalizedSizeResult = VectorGetComponent(ViewMaxNormalizedSize, 0);
-		for (int32 SubIndex = 1; SubIndex < 4; ++SubIndex)
-		{
-			ViewMaxNormalizedSizeResult = FMath::Max(ViewMaxNormalizedSizeResult, VectorGetComponent(ViewMaxNormalizedSize, SubIndex));
-		}
-		MaxLevelRenderAssetScreenSize = View->GetMaxTexelFactor() * ViewMaxNormalizedSizeResult;
-	}
+	return ViewMaxNormalizedSize;
 }
 
 void FRenderAssetInstanceAsyncView::ProcessElement(
@@ -547,6 +600,22 @@ void FRenderAssetInstanceAsyncView::GetRenderAssetScreenSize(
 			const TArray<FRenderAssetInstanceView::FCompiledElement>* CompiledElements = View->GetCompiledElements(InAsset);
 			if (CompiledElements)
 			{
+				// When the sizes found so far in other views are already bigger than what any element could give from the cells of the views, skip the elements.
+				const TArray<float>* CellBounds = ViewCells.Num() && MaxSize > 0 && MaxSize_VisibleOnly > 0 ? View->GetCompiledCellBounds(InAsset) : nullptr;
+				if (CellBounds)
+				{
+					float MaxCellSize = 0;
+					for (const FViewCell& ViewCell : ViewCells)
+					{
+						MaxCellSize = FMath::Max(MaxCellSize, (*CellBounds)[ViewCell.CellIndex] * ViewCell.ScreenSize);
+					}
+
+					if (MaxCellSize <= MaxSize && MaxCellSize <= MaxSize_VisibleOnly)
+					{
+						return;
+					}
+				}
+
 				const int32 NumCompiledElements = CompiledElements->Num();
 				const FRenderAssetInstanceView::FCompiledElement* CompiledElementData = CompiledElements->GetData();
 
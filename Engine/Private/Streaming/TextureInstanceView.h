@@ -179,7 +179,7 @@ public:
 		TMap<const UStreamableRenderAsset*, FRenderAssetDesc>::TConstIterator MapIt;
 	};
 
-	FRenderAssetInstanceView() : MaxTexelFactor(FLT_MAX) {}
+	FRenderAssetInstanceView() : MaxTexelFactor(FLT_MAX), CellGridOrigin(ForceInitToZero), CellGridCellSize(ForceInitToZero), CellGridNumCells(0) {}
 
 	FORCEINLINE int32 NumBounds4() const { return Bounds4.Num(); }
 	FORCEINLINE const FBounds4& GetBounds4(int32 Bounds4Index ) const {  return Bounds4[Bounds4Index]; }
@@ -193,6 +193,13 @@ public:
 	// If this has compiled elements, return the array relate to a given texture or mesh.
 	const TArray<FCompiledElement>* GetCompiledElements(const UStreamableRenderAsset* Asset) const { return CompiledRenderAssetMap.Find(Asset); }
 
+	// Whether or not this state has compiled cell bounds.
+	bool HasCompiledCellBounds() const { return CompiledCellBoundsMap.Num() != 0; }
+	// If this has compiled cell bounds, return the upper bound of TexelFactor / Distance for each cell of the grid, for a given texture.
+	const TArray<float>* GetCompiledCellBounds(const UStreamableRenderAsset* Asset) const { return CompiledCellBoundsMap.Find(Asset); }
+	// The cell of the grid containing a location. Cells on the edges extend infinitely outward, so any location has one.
+	int32 GetCellIndex(const FVector& Location) const;
+
 	bool HasComponentWithForcedLOD(const UStreamableRenderAsset* Asset) const { return !!CompiledNumForcedLODCompMap.Find(Asset); }
 	bool HasAnyComponentWithForcedLOD() const { return !!CompiledNumForcedLODCompMap.Num(); }
 
@@ -235,6 +242,14 @@ protected:
 	/** Max texel factor across all elements. Used for early culling */
 	float MaxTexelFactor;
 
+	/** Coarse XY grid over the bounds, used by CompiledCellBoundsMap. */
+	FVector2D CellGridOrigin;
+	FVector2D CellGridCellSize;
+	int32 CellGridNumCells;
+
+	/** For textures with many elements, the biggest TexelFactor / Distance of any element as seen from anywhere in each cell. Used to skip iterating the elements. */
+	TMap<const UStreamableRenderAsset*, TArray<float> > CompiledCellBoundsMap;
+
 private:
 	FORCENOINLINE void OnVerifyElementIdxFailed(int32 Idx, bool bInRange, int32 IterationCount, TMap<const UPrimitiveComponent*, int32>* ComponentMapPtr, TArray<int32>* FreeIndicesPtr) const;
 };
@@ -310,6 +325,23 @@ private:
 	/** The max possible size (conservative) across all elements of this view. */
 	float MaxLevelRenderAssetScreenSize;
 
+	struct FViewCell
+	{
+		/** The cell containing the view origin */
+		int32 CellIndex;
+		/** The view screen size, including the boost for visible primitives */
+		float ScreenSize;
+	};
+
+	/** The cell of each view, when the view has compiled cell bounds */
+	TArray<FViewCell, TInlineAllocator<4>> ViewCells;
+
+	struct FViewVectors;
+
+	/** Computes BoundsViewInfo for every bounds and returns the max normalized size of the valid ones, 4 wide. */
+	template <bool bUseNewMetrics>
+	VectorRegister UpdateBoundSizes_Async(TArrayView<const FViewVectors> ViewVectors, float LastUpdateTime);
+
 	void ProcessElement(
 		typename FStreamingRenderAsset::EAssetType AssetType,
 		const FBoundsViewInfo& BoundsVieWInfo,
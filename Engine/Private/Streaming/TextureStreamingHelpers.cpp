@@ -26,6 +26,7 @@ DECLARE_MEMORY_STAT_POOL(TEXT("Cached Mips"), STAT_Streaming11_CachedMips, STATG
 DECLARE_MEMORY_STAT_POOL(TEXT("Wanted Mips"), STAT_Streaming12_WantedMips, STATGROUP_Streaming, FPlatformMemory::MCR_UsedStreamingPool);
 DECLARE_MEMORY_STAT_POOL(TEXT("Inflight Requests"), STAT_Streaming13_InflightRequests, STATGROUP_Streaming, FPlatformMemory::MCR_UsedStreamingPool);
 DECLARE_MEMORY_STAT_POOL(TEXT("IO Bandwidth"), STAT_Streaming14_MipIOBandwidth, STATGROUP_Streaming, FPlatformMemory::MCR_UsedStreamingPool);
+DECLARE_MEMORY_STAT_POOL(TEXT("Fragmented Pool"), STAT_Streaming15_FragmentedPool, STATGROUP_Streaming, FPlatformMemory::MCR_TexturePool);
 
 DECLARE_CYCLE_STAT(TEXT("Setup Async Task"), STAT_Streaming01_SetupAsyncTask, STATGROUP_Streaming);
 DECLARE_CYCLE_STAT(TEXT("Update Streaming Data"), STAT_Streaming02_UpdateStreamingData, STATGROUP_Streaming);
@@ -241,6 +242,20 @@ TAutoConsoleVariable<float> CVarStreamingMaxTextureUVDensity(
 	TEXT("Component with bigger entries become handled as dynamic component.\n"),
 	ECVF_Default);
 
+TAutoConsoleVariable<int32> CVarStreamingStaticCellGridSize(
+	TEXT("r.Streaming.StaticCellGridSize"),
+	8,
+	TEXT("Number of cells per axis of the coarse grid built over the static instances of each level, 0 to disable.\n")
+	TEXT("Each cell holds a conservative max size of the textures with many instances, as seen from anywhere in the cell,\n")
+	TEXT("so that their instances are not iterated when other levels already require a bigger size. Applies to levels added afterward."),
+	ECVF_Default);
+
+TAutoConsoleVariable<int32> CVarStreamingStaticCellMinElements(
+	TEXT("r.Streaming.StaticCellMinElements"),
+	32,
+	TEXT("Minimal number of instances a texture must have in a level to get cell bounds, see r.Streaming.StaticCellGridSize."),
+	ECVF_Default);
+
 TAutoConsoleVariable<int32> CVarStreamingMipCalculationEnablePerLevelList(
 	TEXT("r.Streaming.MipCalculationEnablePerLevelList"),
 	1,
@@ -258,6 +273,40 @@ static TAutoConsoleVariable<int32> CVarPrioritizeMeshLODRetention(
 	TEXT("Whether to prioritize retaining mesh LODs"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarStreamingPoolSizeForMeshes(
+	TEXT("r.Streaming.PoolSizeForMeshes"),
+	-1,
+	TEXT("-1: Mesh LODs share the texture pool, otherwise the size in MB of a separate budget for mesh LODs."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarStreamingMeshLODStreamOutDelay(
+	TEXT("r.Streaming.MeshLODStreamOutDelay"),
+	2.f,
+	TEXT("How long in seconds the screen size of a mesh must stay lower before its wanted LODs drop.\n")
+	TEXT("Avoids streaming LODs in and out for meshes moving back and forth across a LOD boundary. 0 drops them immediately."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamingViewPredictionTime(
+	TEXT("r.Streaming.ViewPredictionTime"),
+	0.5f,
+	TEXT("For fast moving views, an extra view is streamed at the location predicted this many seconds ahead from the view velocity.\n")
+	TEXT("Gives mesh LODs and textures time to stream in before the camera gets there. 0 disables the prediction."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStreamingParallelChunkSize(
+	TEXT("r.Streaming.ParallelChunkSize"),
+	512,
+	TEXT("Number of streaming textures and meshes processed per task when the async streaming update computes wanted mips and budgets in parallel.\n")
+	TEXT("0 processes everything on the streaming thread."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamingFragmentationReserve(
+	TEXT("r.Streaming.FragmentationReserve"),
+	0.5f,
+	TEXT("Fraction of the fragmented texture pool memory (free memory outside of the largest free block) that is left out of the streaming budget.\n")
+	TEXT("Keeps the budget from counting on memory that bigger mip reallocations can not use. Only applies to RHIs reporting their largest free block."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarStreamingStressTest(
 	TEXT("r.Streaming.StressTest"),
 	0,
@@ -306,6 +355,11 @@ void FRenderAssetStreamingSettings::Update()
 	bMipCalculationEnablePerLevelList = CVarStreamingMipCalculationEnablePerLevelList.GetValueOnAnyThread() != 0;
 	bPrioritizeMeshLODRetention = CVarPrioritizeMeshLODRetention.GetValueOnAnyThread() != 0;
 	VRAMPercentageClamp = CVarStreamingVRAMPercentageClamp.GetValueOnAnyThread();
+	MeshPoolSize = CVarStreamingPoolSizeForMeshes.GetValueOnAnyThread();
+	MeshLODStreamOutDelay = FMath::Max(CVarStreamingMeshLODStreamOutDelay.GetValueOnAnyThread(), 0.f);
+	ViewPredictionTime = FMath::Max(CVarStreamingViewPredictionTime.GetValueOnAnyThread(), 0.f);
+	ParallelChunkSize = FMath::Max(CVarStreamingParallelChunkSize.GetValueOnAnyThread(), 0);
+	FragmentationReserve = FMath::Clamp(CVarStreamingFragmentationReserve.GetValueOnAnyThread(), 0.f, 1.f);
 
 	MaterialQualityLevel = (int32)GetCachedScalabilityCVars().MaterialQualityLevel;
 
@@ -389,6 +443,7 @@ void FRenderAssetStreamingStats::Apply()
 	SET_MEMORY_STAT(STAT_Streaming12_WantedMips, WantedMips);
 	SET_MEMORY_STAT(STAT_Streaming13_InflightRequests, PendingRequests);	
 	SET_MEMORY_STAT(STAT_Streaming14_MipIOBandwidth, MipIOBandwidth);
+	SET_MEMORY_STAT(STAT_Streaming15_FragmentedPool, FragmentedPool);
 
 	SET_CYCLE_COUNTER(STAT_Streaming01_SetupAsyncTask, SetupAsyncTaskCycles);
 	SET_CYCLE_COUNTER(STAT_Streaming02_UpdateStreamingData, UpdateStreamingDataCycles);
@@ -59,6 +59,8 @@ extern TAutoConsoleVariable<int32> CVarStreamingUseMaterialData;
 extern TAutoConsoleVariable<int32> CVarStreamingNumStaticComponentsProcessedPerFrame;
 extern TAutoConsoleVariable<int32> CVarStreamingDefragDynamicBounds;
 extern TAutoConsoleVariable<float> CVarStreamingMaxTextureUVDensity;
+extern TAutoConsoleVariable<int32> CVarStreamingStaticCellGridSize;
+extern TAutoConsoleVariable<int32> CVarStreamingStaticCellMinElements;
 
 struct FRenderAssetStreamingSettings
 {
@@ -98,6 +100,11 @@ struct FRenderAssetStreamingSettings
 	bool bMipCalculationEnablePerLevelList;
 	bool bPrioritizeMeshLODRetention;
 	int32 VRAMPercentageClamp;
+	int32 MeshPoolSize;
+	float MeshLODStreamOutDelay;
+	float ViewPredictionTime;
+	int32 ParallelChunkSize;
+	float FragmentationReserve;
 
 	bool bStressTest;
 	static int32 ExtraIOLatency;
@@ -157,6 +164,7 @@ struct FRenderAssetStreamingStats
 	int64 NewRequests;			// Estimated memory in bytes required by new requests (TODO)
 	int64 PendingRequests;		// Estimated memory in bytes waiting to be loaded for previous requests
 	int64 MipIOBandwidth;		// Estimated IO bandwidth in bytes/sec
+	int64 FragmentedPool;		// Free pool memory in bytes outside of the largest free block, as reported by the RHI
 
 	int64 OverBudget;			// RequiredPool - StreamingPool
 
@@ -21,6 +21,15 @@
 #include "Matinee/MatineeActor.h"
 #include "StereoRendering.h"
 #include "Misc/PackageName.h"
+#include "Misc/App.h"
+#include "ChartCreation.h"
+#include "EngineUtils.h"
+#include "Camera/CameraActor.h"
+#include "Components/SplineComponent.h"
+#include "Engine/DemoNetDriver.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 
 #if WITH_AUTOMATION_TESTS
 
@@ -498,4 +507,257 @@ bool FWaitForShadersToFinishCompilingInGame::Update()
 	}
 	return true;
 }
+/** Returns the world of the game, or of the play in editor session */
+static UWorld* GetAutomationGameWorld()
+{
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+		{
+			return Context.World();
+		}
+	}
+	return nullptr;
+}
+
+FAutomationPerformanceBenchmark::FAutomationPerformanceBenchmark(const FPerformanceBenchmarkDefinition& InDefinition)
+	: Definition(InDefinition)
+	, bWasUsingFixedTimeStep(false)
+	, PreviousFixedDeltaTime(0.0)
+	, bStartedCsvCapture(false)
+{
+}
+
+void FAutomationPerformanceBenchmark::Start()
+{
+	UE_LOG(LogEngineAutomationLatentCommand, Log, TEXT("Starting performance benchmark '%s' at %.0f fixed FPS."), *Definition.Name, Definition.FixedFrameRate);
+
+	// Simulate the same frames on every run, the charts still measure the real time each frame takes
+	bWasUsingFixedTimeStep = FApp::UseFixedTimeStep();
+	PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / FMath::Max(Definition.FixedFrameRate, 1.0f));
+
+	const FDateTime CaptureStartTime = FDateTime::Now();
+	Chart = MakeShareable(new FPerformanceTrackingChart(CaptureStartTime, Definition.Name));
+	GEngine->AddPerformanceDataConsumer(Chart);
+
+#if CSV_PROFILER
+	if (Definition.bCaptureCsvProfile && !FCsvProfiler::Get()->IsCapturing())
+	{
+		bStartedCsvCapture = true;
+		const FString OutputDirectory = FPerformanceTrackingSystem::CreateOutputDirectory(CaptureStartTime);
+		const FString CsvProfileFilename = FString::Printf(TEXT("Benchmark-%s-%s-%s.csv"), *Definition.Name, *CaptureStartTime.ToString(), FPlatformProperties::PlatformName());
+		FCsvProfiler::Get()->BeginCapture(-1, OutputDirectory, CsvProfileFilename);
+	}
+#endif
+}
+
+void FAutomationPerformanceBenchmark::Stop()
+{
+	if (!Chart.IsValid())
+	{
+		return;
+	}
+
+	GEngine->RemovePerformanceDataConsumer(Chart);
+
+#if CSV_PROFILER
+	if (bStartedCsvCapture && FCsvProfiler::Get()->IsCapturing())
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+	bStartedCsvCapture = false;
+#endif
+
+	FApp::SetUseFixedTimeStep(bWasUsingFixedTimeStep);
+	FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+
+	UWorld* World = GetAutomationGameWorld();
+	Chart->DumpFPSChart(World ? World->GetMapName() : Definition.Name);
+
+	CheckThresholds();
+	Chart.Reset();
+}
+
+/** Reports a measure of a benchmark to the current test, as an error if it is over its threshold */
+static void CheckBenchmarkThreshold(const FString& Measure, double Value, float MaxValue, const TCHAR* Units)
+{
+	const FString Result = FString::Printf(TEXT("%s: %.2f %s"), *Measure, Value, Units);
+	FAutomationTestBase* CurrentTest = FAutomationTestFramework::Get().GetCurrentTest();
+
+	if (MaxValue > 0.0f && Value > MaxValue)
+	{
+		const FString Error = FString::Printf(TEXT("%s, over the %.2f %s threshold"), *Result, MaxValue, Units);
+		if (CurrentTest)
+		{
+			CurrentTest->AddError(Error);
+		}
+		else
+		{
+			UE_LOG(LogEngineAutomationLatentCommand, Error, TEXT("%s"), *Error);
+		}
+	}
+	else if (CurrentTest)
+	{
+		CurrentTest->AddInfo(Result);
+	}
+	else
+	{
+		UE_LOG(LogEngineAutomationLatentCommand, Log, TEXT("%s"), *Result);
+	}
+}
+
+void FAutomationPerformanceBenchmark::CheckThresholds() const
+{
+	if (Chart->GetNumFrames() == 0)
+	{
+		if (FAutomationTestBase* CurrentTest = FAutomationTestFramework::Get().GetCurrentTest())
+		{
+			CurrentTest->AddError(FString::Printf(TEXT("No frame was captured by performance benchmark '%s'."), *Definition.Name));
+		}
+		return;
+	}
+
+	const double MSPerSecond = 1000.0;
+	const double BytesPerMB = 1024.0 * 1024.0;
+
+	CheckBenchmarkThreshold(TEXT("Average frame time"), MSPerSecond * Chart->GetTotalTime() / Chart->GetNumFrames(), Definition.MaxAverageFrameTimeMS, TEXT("ms"));
+	CheckBenchmarkThreshold(TEXT("Hitches per minute"), Chart->GetAvgHitchesPerMinute(), Definition.MaxHitchesPerMinute, TEXT(""));
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	CheckBenchmarkThreshold(TEXT("Peak used physical memory"), MemoryStats.PeakUsedPhysical / BytesPerMB, Definition.MaxPeakUsedMemoryMB, TEXT("MB"));
+
+	for (const TPair<FName, float>& Threshold : Definition.MaxSubsystemTimeP99MS)
+	{
+		double P99TimeMS = 0.0;
+		for (int32 TimerIndex = 0; TimerIndex < Chart->SubsystemTimeHistograms.Num(); ++TimerIndex)
+		{
+			if (FPerformanceTrackingTimers::GetTimerName(TimerIndex) == Threshold.Key)
+			{
+				P99TimeMS = MSPerSecond * FPerformanceTrackingChart::GetHistogramPercentile(Chart->SubsystemTimeHistograms[TimerIndex], 0.99);
+				break;
+			}
+		}
+		CheckBenchmarkThreshold(FString::Printf(TEXT("%s P99 time"), *Threshold.Key.ToString()), P99TimeMS, Threshold.Value, TEXT("ms"));
+	}
+}
+
+bool FStartPerformanceBenchmarkCommand::Update()
+{
+	Benchmark->Start();
+	return true;
+}
+
+bool FStopPerformanceBenchmarkCommand::Update()
+{
+	Benchmark->Stop();
+	return true;
+}
+
+bool FPlayReplayLatentCommand::Update()
+{
+	UWorld* World = GetAutomationGameWorld();
+	UDemoNetDriver* DemoNetDriver = World ? World->GetDemoNetDriver() : nullptr;
+
+	if (!bRequestedPlayback)
+	{
+		if (!World || !World->GetGameInstance())
+		{
+			return false;
+		}
+
+		UE_LOG(LogEngineAutomationLatentCommand, Log, TEXT("Playing replay '%s'."), *ReplayName);
+		bRequestedPlayback = true;
+		if (!World->GetGameInstance()->PlayReplay(ReplayName))
+		{
+			UE_LOG(LogEngineAutomationLatentCommand, Error, TEXT("Failed to play replay '%s'."), *ReplayName);
+			return true;
+		}
+		return false;
+	}
+
+	// Replays load their map before playing
+	if (!DemoNetDriver || !DemoNetDriver->IsPlaying())
+	{
+		const double MaxReplayStartTime = 120.0;
+		if (GetCurrentRunTime() > MaxReplayStartTime)
+		{
+			UE_LOG(LogEngineAutomationLatentCommand, Error, TEXT("Replay '%s' didn't start playing after %.0f seconds."), *ReplayName, MaxReplayStartTime);
+			return true;
+		}
+		return false;
+	}
+
+	return !DemoNetDriver->IsLoadingCheckpoint() && !DemoNetDriver->IsFastForwarding();
+}
+
+bool FWaitForReplayToFinishLatentCommand::Update()
+{
+	UWorld* World = GetAutomationGameWorld();
+	UDemoNetDriver* DemoNetDriver = World ? World->GetDemoNetDriver() : nullptr;
+
+	// The replay is done once it reached its end or the demo driver went away
+	return !DemoNetDriver || !DemoNetDriver->IsPlaying() || DemoNetDriver->GetDemoCurrentTime() >= DemoNetDriver->GetDemoTotalTime();
+}
+
+bool FSplineFlythroughLatentCommand::Update()
+{
+	UWorld* World = GetAutomationGameWorld();
+	APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PlayerController)
+	{
+		UE_LOG(LogEngineAutomationLatentCommand, Error, TEXT("Can't fly through, there is no player."));
+		return true;
+	}
+
+	if (FlythroughStartTime < 0.0)
+	{
+		for (TActorIterator<AActor> It(World); It && !Spline.IsValid(); ++It)
+		{
+			if (It->ActorHasTag(SplineActorTag))
+			{
+				Spline = It->FindComponentByClass<USplineComponent>();
+			}
+		}
+
+		if (!Spline.IsValid())
+		{
+			UE_LOG(LogEngineAutomationLatentCommand, Error, TEXT("Can't fly through, no actor tagged '%s' has a spline component."), *SplineActorTag.ToString());
+			return true;
+		}
+
+		Camera = World->SpawnActor<ACameraActor>();
+		if (!Camera.IsValid())
+		{
+			return true;
+		}
+		PlayerController->SetViewTarget(Camera.Get());
+
+		FlythroughStartTime = World->GetTimeSeconds();
+	}
+
+	const float Alpha = (Duration > 0.0f) ? FMath::Clamp((float)(World->GetTimeSeconds() - FlythroughStartTime) / Duration, 0.0f, 1.0f) : 1.0f;
+	if (Spline.IsValid() && Camera.IsValid())
+	{
+		const float Distance = Alpha * Spline->GetSplineLength();
+		Camera->SetActorLocationAndRotation(Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World), Spline->GetRotationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World));
+	}
+
+	if (Alpha < 1.0f && Spline.IsValid() && Camera.IsValid())
+	{
+		return false;
+	}
+
+	if (Camera.IsValid())
+	{
+		if (PlayerController->GetPawn())
+		{
+			PlayerController->SetViewTarget(PlayerController->GetPawn());
+		}
+		Camera->Destroy();
+	}
+	return true;
+}
+
 #endif //WITH_DEV_AUTOMATION_TESTS
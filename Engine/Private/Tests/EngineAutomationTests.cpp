@@ -399,6 +399,63 @@ bool FCinematicFPSPerfTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+/**
+ * Automation test running the performance benchmarks of the automation test settings, failing on regressions
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FPerformanceBenchmarkTest, "Project.Performance.Benchmarks", (EAutomationTestFlags::ClientContext | EAutomationTestFlags::NonNullRHI | EAutomationTestFlags::PerfFilter));
+
+void FPerformanceBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray <FString>& OutTestCommands) const
+{
+	const UAutomationTestSettings* AutomationTestSettings = GetDefault<UAutomationTestSettings>();
+	for (int32 BenchmarkIndex = 0; BenchmarkIndex < AutomationTestSettings->PerformanceBenchmarks.Num(); ++BenchmarkIndex)
+	{
+		const FPerformanceBenchmarkDefinition& Definition = AutomationTestSettings->PerformanceBenchmarks[BenchmarkIndex];
+		OutBeautifiedNames.Add(Definition.Name.IsEmpty() ? FString::Printf(TEXT("Benchmark %d"), BenchmarkIndex) : Definition.Name);
+		OutTestCommands.Add(FString::FromInt(BenchmarkIndex));
+	}
+}
+
+bool FPerformanceBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UAutomationTestSettings* AutomationTestSettings = GetDefault<UAutomationTestSettings>();
+	const int32 BenchmarkIndex = FCString::Atoi(*Parameters);
+	if (!AutomationTestSettings->PerformanceBenchmarks.IsValidIndex(BenchmarkIndex))
+	{
+		AddError(FString::Printf(TEXT("Unknown performance benchmark '%s'."), *Parameters));
+		return false;
+	}
+
+	TSharedRef<FAutomationPerformanceBenchmark> Benchmark = MakeShareable(new FAutomationPerformanceBenchmark(AutomationTestSettings->PerformanceBenchmarks[BenchmarkIndex]));
+	const FPerformanceBenchmarkDefinition& Definition = Benchmark->GetDefinition();
+
+	if (!Definition.ReplayName.IsEmpty())
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FPlayReplayLatentCommand(Definition.ReplayName));
+		ADD_LATENT_AUTOMATION_COMMAND(FStartPerformanceBenchmarkCommand(Benchmark));
+		ADD_LATENT_AUTOMATION_COMMAND(FWaitForReplayToFinishLatentCommand());
+		ADD_LATENT_AUTOMATION_COMMAND(FStopPerformanceBenchmarkCommand(Benchmark));
+	}
+	else
+	{
+		if (Definition.Map.IsNull() || Definition.FlythroughSplineActorTag.IsNone())
+		{
+			AddError(FString::Printf(TEXT("Performance benchmark '%s' needs either a replay, or a map and a flythrough spline actor tag."), *Definition.Name));
+			return false;
+		}
+
+		//Load the map and let its resources stream in so they don't count against the benchmark
+		ADD_LATENT_AUTOMATION_COMMAND(FLoadGameMapCommand(Definition.Map.GetLongPackageName()));
+		ADD_LATENT_AUTOMATION_COMMAND(FWaitForMapToLoadCommand());
+		ADD_LATENT_AUTOMATION_COMMAND(FStreamAllResourcesLatentCommand(10.0f));
+
+		ADD_LATENT_AUTOMATION_COMMAND(FStartPerformanceBenchmarkCommand(Benchmark));
+		ADD_LATENT_AUTOMATION_COMMAND(FSplineFlythroughLatentCommand(Definition.FlythroughSplineActorTag, Definition.FlythroughDuration));
+		ADD_LATENT_AUTOMATION_COMMAND(FStopPerformanceBenchmarkCommand(Benchmark));
+	}
+
+	return true;
+}
+
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAutomationLogAddMessage, "System.Automation.Log.Add Log Message", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
 
@@ -111,6 +111,15 @@ static FAutoConsoleVariableRef CVarUseGenericStreamingPath(
 	ECVF_Default
 );
 
+static int32 GStreamMipsIntoLockedTextures = 0;
+static FAutoConsoleVariableRef CVarStreamMipsIntoLockedTextures(
+	TEXT("r.Streaming.StreamMipsIntoLockedTextures"),
+	GStreamMipsIntoLockedTextures,
+	TEXT("If non zero, cooked mips are read directly into the locked mips of the reallocated texture, even when the RHI supports async texture creation.\n")
+	TEXT("Async creation reads the mips in main memory before the RHI copies them in the new texture, which can be the bottleneck with fast IO\n")
+	TEXT("on unified memory platforms. Locking instead runs the allocation on the renderthread."),
+	ECVF_Default
+);
 
 static int32 MobileReduceLoadedMips(int32 NumTotalMips)
 {
@@ -1534,6 +1543,23 @@ void UTexture2D::RefreshSamplerStates()
 		});
 }
 
+void UTexture2D::UpdateResourceSettings()
+{
+	const int32 PreviousLODBias = GetCachedLODBias();
+	UpdateCachedLODBias();
+
+	// The resident mips of non streamable textures depend on the LOD bias, and virtual textures bake it into their producer.
+	const bool bCanKeepResource = Resource && !IsCurrentlyVirtualTextured() && !HasPendingUpdate() && (bIsStreamable || GetCachedLODBias() == PreviousLODBias);
+	if (bCanKeepResource)
+	{
+		RefreshSamplerStates();
+	}
+	else
+	{
+		UpdateResource();
+	}
+}
+
 /*-----------------------------------------------------------------------------
 	FTexture2DResource implementation.
 -----------------------------------------------------------------------------*/
@@ -2276,7 +2302,7 @@ bool UTexture2D::StreamIn(int32 NewMipCount, bool bHighPrio)
 					PendingUpdate = new FTexture2DStreamIn_IO_Virtual(this, NewMipCount, bHighPrio);
 				}
 				// If the platform supports creating the new texture on an async thread, use that path.
-				else if (GRHISupportsAsyncTextureCreation)
+				else if (GRHISupportsAsyncTextureCreation && !GStreamMipsIntoLockedTextures)
 				{
 					PendingUpdate = new FTexture2DStreamIn_IO_AsyncCreate(this, NewMipCount,bHighPrio);
 				}
@@ -2304,7 +2330,7 @@ bool UTexture2D::StreamIn(int32 NewMipCount, bool bHighPrio)
 			}
 
 			// FTexture2DMipAllocator_Virtual?
-			if (GRHISupportsAsyncTextureCreation)
+			if (GRHISupportsAsyncTextureCreation && !GStreamMipsIntoLockedTextures)
 			{
 				MipAllocator = new FTexture2DMipAllocator_AsyncCreate();
 			}
@@ -72,6 +72,25 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncTickCleanup(
 	0,
 	TEXT("If true, ticks are cleaned up in a task thread."));
 
+static TAutoConsoleVariable<int32> CVarAllowBatchedTicks(
+	TEXT("tick.AllowBatchedTicks"),
+	0,
+	TEXT("If true, tick functions with bAllowTickBatching and no prerequisites are grouped by class and tick group, and each group runs as a single task. ")
+	TEXT("Only used when ticks are queued serially (single threaded mode or tick.AllowConcurrentTickQueue 0)."));
+
+static TAutoConsoleVariable<int32> CVarAllowDeclaredAccessParallelTicks(
+	TEXT("tick.AllowDeclaredAccessParallelTicks"),
+	0,
+	TEXT("If true, tick functions that declared their reads and writes with SetTickAccess run on worker threads, ordered only against conflicting declared ticks. ")
+	TEXT("Requires tick.AllowAsyncComponentTicks and ticks queued serially (tick.AllowConcurrentTickQueue 0 or a platform without concurrent queueing)."));
+
+static int32 GSpreadIntervalTicks = 0;
+static FAutoConsoleVariableRef CVarSpreadIntervalTicks(
+	TEXT("tick.SpreadIntervalTicks"),
+	GSpreadIntervalTicks,
+	TEXT("If true, tick functions that start ticking at an interval get a stable per-function phase offset on their first cooldown, ")
+	TEXT("so functions with the same TickInterval that were enabled on the same frame don't all tick on the same frames."));
+
 static float GTimeguardThresholdMS = 0.0f;
 static FAutoConsoleVariableRef CVarLightweightTimeguardThresholdMS(
 	TEXT("tick.LightweightTimeguardThresholdMS"), 
@@ -264,6 +283,12 @@ public:
 		*	However, MyCompletionGraphEvent can be useful for passing to other routines or when it is handy to set up subsequents before you actually do work.
 		**/
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		ExecuteTickFunction(Target, Context, bLogTick, bLogTicksShowPrerequistes, CurrentThread, MyCompletionGraphEvent);
+	}
+
+	/** Ticks a single function, shared with FTickFunctionBatchTask **/
+	static FORCEINLINE void ExecuteTickFunction(FTickFunction* Target, const FTickContext& Context, bool bLogTick, bool bLogTicksShowPrerequistes, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
 		if (bLogTick)
 		{
@@ -284,6 +309,64 @@ public:
 			LIGHTWEIGHT_TIME_GUARD_END(FTickFunctionTask, Target->DiagnosticMessage());
 		}
 		Target->InternalData->TaskPointer = nullptr;  // This is stale and a good time to clear it for safety
+		Target->InternalData->bTaskIsBatched = false;
+	}
+};
+
+/** Tick functions of the same class and tick groups that run back to back in one task, see tick.AllowBatchedTicks **/
+struct FTickFunctionBatch
+{
+	/** DiagnosticContext of the batched functions, usually their native class **/
+	FName ContextName;
+	/** Tick groups the batched functions actually start and end in **/
+	ETickingGroup StartTickGroup;
+	ETickingGroup EndTickGroup;
+	bool bHighPriority;
+	/** tick context, here thread is desired execution thread **/
+	FTickContext Context;
+	/** Functions to tick, in queue order **/
+	TArray<FTickFunction*> TickFunctions;
+	/** Held task that ticks the batch, stale once dispatched **/
+	TGraphTask<class FTickFunctionBatchTask>* Task;
+	/** Set once the batch task has been unlocked, after which no more functions may be added **/
+	bool bDispatched;
+};
+
+/** Helper class define the task of ticking a batch of tick functions **/
+class FTickFunctionBatchTask
+{
+	/** Batch to tick, owned by the sequencer until the end of the frame **/
+	FTickFunctionBatch*		Batch;
+	/** If true, log each tick **/
+	bool					bLogTick;
+	/** If true, log prereqs **/
+	bool					bLogTicksShowPrerequistes;
+public:
+	FORCEINLINE FTickFunctionBatchTask(FTickFunctionBatch* InBatch, bool InbLogTick, bool bInLogTicksShowPrerequistes)
+		: Batch(InBatch)
+		, bLogTick(InbLogTick)
+		, bLogTicksShowPrerequistes(bInLogTicksShowPrerequistes)
+	{
+	}
+	static FORCEINLINE TStatId GetStatId()
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FTickFunctionBatchTask, STATGROUP_TaskGraphTasks);
+	}
+	/** return the thread for this task **/
+	FORCEINLINE ENamedThreads::Type GetDesiredThread()
+	{
+		return Batch->Context.Thread;
+	}
+	static FORCEINLINE ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		for (FTickFunction* Target : Batch->TickFunctions)
+		{
+			FTickFunctionTask::ExecuteTickFunction(Target, Batch->Context, bLogTick, bLogTicksShowPrerequistes, CurrentThread, MyCompletionGraphEvent);
+		}
 	}
 };
 
@@ -375,6 +458,32 @@ class FTickTaskSequencer
 	/** LowPri Held tasks for each tick group. */
 	TArrayWithThreadsafeAdd<TGraphTask<FTickFunctionTask>*> TickTasks[TG_MAX][TG_MAX];
 
+	/** HiPri and LowPri batches waiting to be dispatched, for each start tick group. */
+	TArray<FTickFunctionBatch*> HiPriTickBatches[TG_MAX];
+	TArray<FTickFunctionBatch*> HeldTickBatches[TG_MAX];
+
+	/** Batches queued this frame, the first NumTickBatches are in use. Kept across frames to reuse their allocations. */
+	TArray<TUniquePtr<FTickFunctionBatch>> TickBatches;
+	int32 NumTickBatches;
+
+	/** If true, allow ticks to be batched this frame **/
+	bool				bAllowBatchedTicks;
+
+	/** A queued tick function that declared its access, see FTickFunction::SetTickAccess */
+	struct FDeclaredAccessTick
+	{
+		ETickAccess Reads;
+		ETickAccess Writes;
+		ETickingGroup StartTickGroup;
+		FGraphEventRef CompletionHandle;
+	};
+
+	/** Declared ticks queued this frame, by access scope. Ticks touching World are also listed under nullptr. */
+	TMap<const UObject*, TArray<FDeclaredAccessTick, TInlineAllocator<4>>> DeclaredAccessTicks;
+
+	/** If true, declared ticks run on worker threads this frame **/
+	bool				bAllowDeclaredAccessTicks;
+
 	/** These are waited for at the end of the frame; they are not on the critical path, but they have to be done before we leave the frame. */
 	FGraphEventArray CleanupTasks;
 
@@ -424,26 +533,33 @@ public:
 		checkSlow(TickFunction->InternalData->ActualStartTickGroup >=0 && TickFunction->InternalData->ActualStartTickGroup < TG_MAX);
 
 		FTickContext UseContext = TickContext;
+		UseContext.Thread = GetTickThread(TickFunction);
 
+		TickFunction->InternalData->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
+		TickFunction->InternalData->bTaskIsBatched = false;
+	}
+
+	/** Return the thread a tick function should execute on, given its settings and the tick group it was queued in **/
+	FORCEINLINE ENamedThreads::Type GetTickThread(const FTickFunction* TickFunction) const
+	{
 		bool bIsOriginalTickGroup = (TickFunction->InternalData->ActualStartTickGroup == TickFunction->TickGroup);
+		bool bRunOnAnyThread = TickFunction->bRunOnAnyThread || (bAllowDeclaredAccessTicks && TickFunction->HasDeclaredTickAccess());
 
-		if (TickFunction->bRunOnAnyThread && bAllowConcurrentTicks && bIsOriginalTickGroup)
+		if (bRunOnAnyThread && bAllowConcurrentTicks && bIsOriginalTickGroup)
 		{
 			if (TickFunction->bHighPriority)
 			{
-				UseContext.Thread = CPrio_HiPriAsyncTickTaskPriority.Get();
+				return CPrio_HiPriAsyncTickTaskPriority.Get();
 			}
 			else
 			{
-				UseContext.Thread = CPrio_NormalAsyncTickTaskPriority.Get();
+				return CPrio_NormalAsyncTickTaskPriority.Get();
 			}
 		}
 		else
 		{
-			UseContext.Thread = ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+			return ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
 		}
-
-		TickFunction->InternalData->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
 	}
 
 	/** Add a completion handle to a tick group **/
@@ -519,6 +635,165 @@ public:
 		AddTickTaskCompletionParallel(TickFunction->InternalData->ActualStartTickGroup, TickFunction->InternalData->ActualEndTickGroup, Task, TickFunction->bHighPriority);
 	}
 
+	/**
+	 * Enables declared access ticks for the frame. Conflicts are resolved while queueing, so this may only be enabled when ticks are queued serially
+	 * @param bSerialQueue - true if all ticks this frame are queued with QueueTickFunction
+	 */
+	void SetAllowDeclaredAccessTicks(bool bSerialQueue)
+	{
+		bAllowDeclaredAccessTicks = bSerialQueue && bAllowConcurrentTicks && !!CVarAllowDeclaredAccessParallelTicks.GetValueOnGameThread();
+	}
+
+	/** Whether declared ticks run on worker threads this frame **/
+	FORCEINLINE bool AllowDeclaredAccessTicks() const
+	{
+		return bAllowDeclaredAccessTicks;
+	}
+
+	/** Returns the access of a declared tick, with actor access promoted to World if the tick has no scope **/
+	static void GetEffectiveTickAccess(const FTickFunction* TickFunction, const UObject*& OutScope, ETickAccess& OutReads, ETickAccess& OutWrites)
+	{
+		const ETickAccess ActorAccess = ETickAccess::ActorTransform | ETickAccess::ActorMovement | ETickAccess::ActorState;
+
+		OutScope = TickFunction->GetTickAccessScope();
+		OutReads = TickFunction->GetTickReads();
+		OutWrites = TickFunction->GetTickWrites();
+
+		if (OutScope == nullptr)
+		{
+			if (EnumHasAnyFlags(OutReads, ActorAccess))
+			{
+				OutReads |= ETickAccess::World;
+			}
+			if (EnumHasAnyFlags(OutWrites, ActorAccess))
+			{
+				OutWrites |= ETickAccess::World;
+			}
+		}
+	}
+
+	/** Adds the completion handles of previously queued declared ticks in the same start tick group that conflict with this one **/
+	void AddDeclaredAccessPrerequisites(const FTickFunction* TickFunction, FGraphEventArray& OutPrerequisites) const
+	{
+		const UObject* Scope;
+		ETickAccess Reads, Writes;
+		GetEffectiveTickAccess(TickFunction, Scope, Reads, Writes);
+
+		const ETickingGroup StartTickGroup = TickFunction->InternalData->ActualStartTickGroup;
+
+		auto AddConflicts = [&OutPrerequisites, StartTickGroup, Reads, Writes](const TArray<FDeclaredAccessTick, TInlineAllocator<4>>* Queued, ETickAccess Mask)
+		{
+			if (Queued)
+			{
+				for (const FDeclaredAccessTick& Other : *Queued)
+				{
+					if (Other.StartTickGroup == StartTickGroup && (EnumHasAnyFlags(Writes & Mask, Other.Reads) || EnumHasAnyFlags(Other.Writes & Mask, Reads)))
+					{
+						OutPrerequisites.Add(Other.CompletionHandle);
+					}
+				}
+			}
+		};
+
+		if (Scope)
+		{
+			AddConflicts(DeclaredAccessTicks.Find(Scope), ~ETickAccess::World);
+		}
+		if (EnumHasAnyFlags(Reads, ETickAccess::World))
+		{
+			AddConflicts(DeclaredAccessTicks.Find(nullptr), ETickAccess::World);
+		}
+	}
+
+	/** Remembers a queued declared tick so later conflicting ticks wait for it **/
+	void RecordDeclaredAccessTick(const FTickFunction* TickFunction)
+	{
+		const UObject* Scope;
+		FDeclaredAccessTick Declared;
+		GetEffectiveTickAccess(TickFunction, Scope, Declared.Reads, Declared.Writes);
+		Declared.StartTickGroup = TickFunction->InternalData->ActualStartTickGroup;
+		Declared.CompletionHandle = TickFunction->GetCompletionHandle();
+
+		if (Scope)
+		{
+			DeclaredAccessTicks.FindOrAdd(Scope).Add(Declared);
+		}
+		if (EnumHasAnyFlags(Declared.Reads, ETickAccess::World))
+		{
+			DeclaredAccessTicks.FindOrAdd(nullptr).Add(Declared);
+		}
+	}
+
+	/** Whether QueueBatchedTickTask may be used this frame **/
+	FORCEINLINE bool AllowBatchedTicks() const
+	{
+		return bAllowBatchedTicks;
+	}
+
+	/**
+	 * Add a tick function without prerequisites to the batch matching its class, tick groups and thread, starting a new batch task if there is none
+	 *
+	 * @param	TickFunction - the tick function to queue
+	 * @param	Context - tick context to tick in. Thread here is the current thread.
+	 */
+	void QueueBatchedTickTask(FTickFunction* TickFunction, const FTickContext& TickContext)
+	{
+		checkSlow(TickFunction->InternalData);
+		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+
+		FTickContext UseContext = TickContext;
+		UseContext.Thread = GetTickThread(TickFunction);
+
+		const FName ContextName = TickFunction->DiagnosticContext(false);
+		const ETickingGroup StartTickGroup = TickFunction->InternalData->ActualStartTickGroup;
+		const ETickingGroup EndTickGroup = TickFunction->InternalData->ActualEndTickGroup;
+		const bool bHighPriority = TickFunction->bHighPriority;
+
+		// Only a handful of classes tick in each group, so a linear search is fine
+		FTickFunctionBatch* Batch = nullptr;
+		for (int32 BatchIndex = 0; BatchIndex < NumTickBatches; BatchIndex++)
+		{
+			FTickFunctionBatch* Candidate = TickBatches[BatchIndex].Get();
+			if (!Candidate->bDispatched && Candidate->ContextName == ContextName && Candidate->StartTickGroup == StartTickGroup && Candidate->EndTickGroup == EndTickGroup
+				&& Candidate->bHighPriority == bHighPriority && Candidate->Context.Thread == UseContext.Thread)
+			{
+				Batch = Candidate;
+				break;
+			}
+		}
+
+		if (!Batch)
+		{
+			if (NumTickBatches == TickBatches.Num())
+			{
+				TickBatches.Add(MakeUnique<FTickFunctionBatch>());
+			}
+			Batch = TickBatches[NumTickBatches++].Get();
+			Batch->ContextName = ContextName;
+			Batch->StartTickGroup = StartTickGroup;
+			Batch->EndTickGroup = EndTickGroup;
+			Batch->bHighPriority = bHighPriority;
+			Batch->Context = UseContext;
+			Batch->TickFunctions.Reset();
+			Batch->bDispatched = false;
+
+			Batch->Task = TGraphTask<FTickFunctionBatchTask>::CreateTask(nullptr, TickContext.Thread).ConstructAndHold(Batch, bLogTicks, bLogTicksShowPrerequistes);
+			if (bHighPriority)
+			{
+				HiPriTickBatches[StartTickGroup].Add(Batch);
+			}
+			else
+			{
+				HeldTickBatches[StartTickGroup].Add(Batch);
+			}
+			new (TickCompletionEvents[EndTickGroup]) FGraphEventRef(Batch->Task->GetCompletionEvent());
+		}
+
+		Batch->TickFunctions.Add(TickFunction);
+		TickFunction->InternalData->TaskPointer = Batch->Task;
+		TickFunction->InternalData->bTaskIsBatched = true;
+	}
+
 	/**
 	 * Release the queued ticks for a given tick group and process them.
 	 * @param WorldTickGroup - tick group to release
@@ -598,6 +873,10 @@ public:
 			bAllowConcurrentTicks = !!CVarAllowAsyncComponentTicks.GetValueOnGameThread();
 		}
 
+		bAllowBatchedTicks = !!CVarAllowBatchedTicks.GetValueOnGameThread();
+		bAllowDeclaredAccessTicks = false;
+		DeclaredAccessTicks.Reset();
+
 		WaitForCleanup();
 
 		for (int32 Index = 0; Index < TG_MAX; Index++)
@@ -610,7 +889,10 @@ public:
 				TickTasks[Index][IndexInner].Reset();
 				HiPriTickTasks[Index][IndexInner].Reset();
 			}
+			check(!HeldTickBatches[Index].Num() && !HiPriTickBatches[Index].Num());  // batches are always dispatched with their start tick group
 		}
+		// all batch tasks from the previous frame have completed, so the batches can be reused
+		NumTickBatches = 0;
 		WaitForTickGroup = (ETickingGroup)0;
 	}
 	/**
@@ -626,7 +908,10 @@ public:
 private:
 
 	FTickTaskSequencer()
-		: bAllowConcurrentTicks(false)
+		: NumTickBatches(0)
+		, bAllowBatchedTicks(false)
+		, bAllowDeclaredAccessTicks(false)
+		, bAllowConcurrentTicks(false)
 		, bLogTicks(false)
 		, bLogTicksShowPrerequistes(false)
 	{
@@ -657,6 +942,18 @@ private:
 		TickCompletionEvents[WorldTickGroup].Reset();
 	}
 
+	void DispatchTickBatches(ENamedThreads::Type CurrentThread, TArray<FTickFunctionBatch*>& BatchArray)
+	{
+		for (int32 Index = 0; Index < BatchArray.Num(); Index++)
+		{
+			// mark it first, the task may complete as soon as it is unlocked
+			FTickFunctionBatch* Batch = BatchArray[Index];
+			Batch->bDispatched = true;
+			Batch->Task->Unlock(CurrentThread);
+		}
+		BatchArray.Reset();
+	}
+
 	void DispatchTickGroup(ENamedThreads::Type CurrentThread, ETickingGroup WorldTickGroup)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_DispatchTickGroup);
@@ -676,6 +973,7 @@ private:
 			}
 			TickArray.Reset();
 		}
+		DispatchTickBatches(CurrentThread, HiPriTickBatches[WorldTickGroup]);
 		for (int32 IndexInner = 0; IndexInner < TG_MAX; IndexInner++)
 		{
 			TArray<TGraphTask<FTickFunctionTask>*>& TickArray = TickTasks[WorldTickGroup][IndexInner];
@@ -692,6 +990,7 @@ private:
 			}
 			TickArray.Reset();
 		}
+		DispatchTickBatches(CurrentThread, HeldTickBatches[WorldTickGroup]);
 	}
 
 };
@@ -821,10 +1120,22 @@ public:
 		bool bDeferredRemove;
 	};
 
+	/** Cooldown for a tick function moving from the enabled list to the cooldown list, see tick.SpreadIntervalTicks */
+	static float GetInitialIntervalCooldown(const FTickFunction* TickFunction)
+	{
+		if (GSpreadIntervalTicks)
+		{
+			// Phase in [0.5, 1.5) of the interval, so the average first wait is unchanged and later cooldowns keep the offset
+			const float Phase = (PointerHash(TickFunction) & 0xFFFF) / 65536.f;
+			return TickFunction->TickInterval * (0.5f + Phase);
+		}
+		return TickFunction->TickInterval;
+	}
+
 	void RescheduleForIntervalParallel(FTickFunction* TickFunction)
 	{
 		// note we do the remove later!
-		TickFunctionsToReschedule.AddThreadsafe(FTickScheduleDetails(TickFunction, TickFunction->TickInterval, true));
+		TickFunctionsToReschedule.AddThreadsafe(FTickScheduleDetails(TickFunction, GetInitialIntervalCooldown(TickFunction), true));
 	}
 	/* Helper to presize reschedule array */
 	void ReserveTickFunctionCooldowns(int32 NumToReserve)
@@ -931,7 +1242,7 @@ public:
 			if (TickFunction->TickInterval > 0.f)
 			{
 				It.RemoveCurrent();
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, GetInitialIntervalCooldown(TickFunction)));
 			}
 		}
 		int32 EnabledCooldownTicks = 0;
@@ -971,7 +1282,7 @@ public:
 			if (TickFunction->TickInterval > 0.f)
 			{
 				AllEnabledTickFunctions.Remove(TickFunction);
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, GetInitialIntervalCooldown(TickFunction)));
 			}
 		}
 		ScheduleTickFunctionCooldowns();
@@ -993,7 +1304,7 @@ public:
 			if (TickFunction->TickInterval > 0.f)
 			{
 				AllEnabledTickFunctions.Remove(TickFunction);
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, GetInitialIntervalCooldown(TickFunction)));
 			}
 		}
 		ScheduleTickFunctionCooldowns();
@@ -1065,7 +1376,7 @@ public:
 				if (TickFunction->TickInterval > 0.f)
 				{
 					It.RemoveCurrent();
-					TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+					TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, GetInitialIntervalCooldown(TickFunction)));
 				}
 			}
 		}
@@ -1441,6 +1752,8 @@ public:
 		}
 #endif
 
+		TickTaskSequencer.SetAllowDeclaredAccessTicks(!bConcurrentQueue);
+
 		if (!bConcurrentQueue)
 		{
 			int32 TotalTickFunctions = 0;
@@ -1747,7 +2060,11 @@ FTickFunction::FTickFunction()
 	, bAllowTickOnDedicatedServer(true)
 	, bHighPriority(false)
 	, bRunOnAnyThread(false)
+	, bAllowTickBatching(false)
 	, TickState(ETickState::Enabled)
+	, bHasDeclaredTickAccess(false)
+	, TickReads(ETickAccess::None)
+	, TickWrites(ETickAccess::None)
 	, TickInterval(0.f)
 {
 }
@@ -1755,6 +2072,7 @@ FTickFunction::FTickFunction()
 FTickFunction::FInternalData::FInternalData()
 	: bRegistered(false)
 	, bWasInterval(false)
+	, bTaskIsBatched(false)
 	, ActualStartTickGroup(TG_PrePhysics)
 	, ActualEndTickGroup(TG_PrePhysics)
 	, TickVisitedGFrameCounter(0)
@@ -1881,6 +2199,11 @@ void FTickFunction::ShowPrerequistes(int32 Indent)
 FGraphEventRef FTickFunction::GetCompletionHandle() const
 {
 	check(InternalData->TaskPointer);
+	if (InternalData->bTaskIsBatched)
+	{
+		TGraphTask<FTickFunctionBatchTask>* BatchTask = (TGraphTask<FTickFunctionBatchTask>*)InternalData->TaskPointer;
+		return BatchTask->GetCompletionEvent();
+	}
 	TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)InternalData->TaskPointer;
 	return Task->GetCompletionEvent();
 }
@@ -1956,7 +2279,22 @@ void FTickFunction::QueueTickFunction(FTickTaskSequencer& TTS, const struct FTic
 
 			if (TickState == FTickFunction::ETickState::Enabled)
 			{
-				TTS.QueueTickTask(&TaskPrerequisites, this, TickContext);
+				if (bHasDeclaredTickAccess && TTS.AllowDeclaredAccessTicks())
+				{
+					// conflicts are only resolved within a tick group, so declared ticks may not overlap later groups
+					InternalData->ActualEndTickGroup = InternalData->ActualStartTickGroup;
+					TTS.AddDeclaredAccessPrerequisites(this, TaskPrerequisites);
+					TTS.QueueTickTask(&TaskPrerequisites, this, TickContext);
+					TTS.RecordDeclaredAccessTick(this);
+				}
+				else if (bAllowTickBatching && TaskPrerequisites.Num() == 0 && TTS.AllowBatchedTicks())
+				{
+					TTS.QueueBatchedTickTask(this, TickContext);
+				}
+				else
+				{
+					TTS.QueueTickTask(&TaskPrerequisites, this, TickContext);
+				}
 			}
 		}
 		InternalData->TickQueuedGFrameCounter = GFrameCounter;
@@ -24,6 +24,9 @@ CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, Basic);
 /** Track the last assigned handle globally */
 uint64 FTimerManager::LastAssignedSerialNumber = 0;
 
+/** Resolution of the finest timing wheel level. Timers that land in the same slot are still fired in ExpireTime order. */
+static const double TimerWheelSlotsPerSecond = 64.0;
+
 static float DumpTimerLogsThreshold = 0.f;
 static FAutoConsoleVariableRef CVarDumpTimerLogsThreshold(
 	TEXT("TimerManager.DumpTimerLogsThreshold"), DumpTimerLogsThreshold,
@@ -223,9 +226,9 @@ namespace
 	}
 }
 
-struct FTimerHeapOrder
+struct FTimerExpiryOrder
 {
-	explicit FTimerHeapOrder(const TSparseArray<FTimerData>& InTimers)
+	explicit FTimerExpiryOrder(const TSparseArray<FTimerData>& InTimers)
 		: Timers(InTimers)
 		, NumTimers(InTimers.Num())
 	{
@@ -246,11 +249,24 @@ struct FTimerHeapOrder
 	int32 NumTimers;
 };
 
+static FORCEINLINE int64 GetTimerWheelSlot(double Time)
+{
+	return (int64)FMath::FloorToDouble(Time * TimerWheelSlotsPerSecond);
+}
+
 FTimerManager::FTimerManager(UGameInstance* GameInstance)
-	: InternalTime(0.0)
+	: TimerWheelCursor(0)
+	, NumTimersInWheel(0)
+	, InternalTime(0.0)
 	, LastTickedFrame(static_cast<uint64>(-1))
 	, OwningGameInstance(nullptr)
 {
+	for (int32& Head : TimerWheelHeads)
+	{
+		Head = INDEX_NONE;
+	}
+	FMemory::Memzero(TimerWheelOccupancy);
+
 	if (IsRunningDedicatedServer())
 	{
 		// Off by default, renable if needed
@@ -275,21 +291,14 @@ void FTimerManager::OnCrash()
 {
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p on crashing delegate called, dumping extra information"), this);
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers (including expired) -------"), ActiveTimerHeap.Num());
-	int32 ExpiredActiveTimerCount = 0;
-	for (FTimerHandle Handle : ActiveTimerHeap)
+	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers -------"), NumTimersInWheel);
+	for (const FTimerData& Timer : Timers)
 	{
-		const FTimerData& Timer = GetTimer(Handle);
-		if (Timer.Status == ETimerStatus::ActivePendingRemoval)
-		{
-			++ExpiredActiveTimerCount;
-		}
-		else
+		if (Timer.WheelBucket != INDEX_NONE)
 		{
 			DescribeFTimerDataSafely(*GLog, Timer);
 		}
 	}
-	UE_LOG(LogEngine, Log, TEXT("------- %d Expired Active Timers -------"), ExpiredActiveTimerCount);
 
 	UE_LOG(LogEngine, Log, TEXT("------- %d Paused Timers -------"), PausedTimerSet.Num());
 	for (FTimerHandle Handle : PausedTimerSet)
@@ -305,7 +314,7 @@ void FTimerManager::OnCrash()
 		DescribeFTimerDataSafely(*GLog, Timer);
 	}
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerSet.Num() + PausedTimerSet.Num() + ActiveTimerHeap.Num() - ExpiredActiveTimerCount);
+	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), Timers.Num());
 
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p dump ended"), this);
 }
@@ -489,7 +498,7 @@ void FTimerManager::InternalSetTimer(FTimerHandle& InOutHandle, FTimerUnifiedDel
 			NewTimerData.ExpireTime = InternalTime + FirstDelay;
 			NewTimerData.Status = ETimerStatus::Active;
 			NewTimerHandle = AddTimer(MoveTemp(NewTimerData));
-			ActiveTimerHeap.HeapPush(NewTimerHandle, FTimerHeapOrder(Timers));
+			LinkTimerToWheel(NewTimerHandle.GetIndex());
 		}
 		else
 		{
@@ -531,7 +540,7 @@ FTimerHandle FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate&&
 	}
 
 	FTimerHandle NewTimerHandle = AddTimer(MoveTemp(NewTimerData));
-	ActiveTimerHeap.HeapPush(NewTimerHandle, FTimerHeapOrder(Timers));
+	LinkTimerToWheel(NewTimerHandle.GetIndex());
 
 	return NewTimerHandle;
 }
@@ -555,7 +564,8 @@ void FTimerManager::InternalClearTimer(FTimerHandle InHandle)
 			break;
 
 		case ETimerStatus::Active:
-			Data.Status = ETimerStatus::ActivePendingRemoval;
+			// RemoveTimer unlinks it from the wheel. If it is waiting in this frame's expired batch instead, the stale handle is skipped there.
+			RemoveTimer(InHandle);
 			break;
 
 		case ETimerStatus::ActivePendingRemoval:
@@ -675,11 +685,7 @@ void FTimerManager::PauseTimer(FTimerHandle InHandle)
 			break;
 
 		case ETimerStatus::Active:
-			{
-				int32 IndexIndex = ActiveTimerHeap.Find(InHandle);
-				check(IndexIndex != INDEX_NONE);
-				ActiveTimerHeap.HeapRemoveAt(IndexIndex, FTimerHeapOrder(Timers), /*bAllowShrinking=*/ false);
-			}
+			UnlinkTimerFromWheel(InHandle.GetIndex());
 			break;
 
 		case ETimerStatus::Pending:
@@ -737,7 +743,7 @@ void FTimerManager::UnPauseTimer(FTimerHandle InHandle)
 		// Convert from time remaining back to a valid ExpireTime
 		TimerToUnPause->ExpireTime += InternalTime;
 		TimerToUnPause->Status = ETimerStatus::Active;
-		ActiveTimerHeap.HeapPush(InHandle, FTimerHeapOrder(Timers));
+		LinkTimerToWheel(InHandle.GetIndex());
 	}
 	else
 	{
@@ -753,7 +759,7 @@ void FTimerManager::UnPauseTimer(FTimerHandle InHandle)
 // Public members
 // ---------------------------------
 
-DECLARE_DWORD_COUNTER_STAT(TEXT("TimerManager Heap Size"),STAT_NumHeapEntries,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TimerManager Wheel Size"),STAT_NumWheelEntries,STATGROUP_Game);
 
 void FTimerManager::Tick(float DeltaTime)
 {
@@ -779,7 +785,7 @@ void FTimerManager::Tick(float DeltaTime)
 	// @todo, might need to handle long-running case
 	// (e.g. every X seconds, renormalize to InternalTime = 0)
 
-	INC_DWORD_STAT_BY(STAT_NumHeapEntries, ActiveTimerHeap.Num());
+	INC_DWORD_STAT_BY(STAT_NumWheelEntries, NumTimersInWheel);
 
 	if (HasBeenTickedThisFrame())
 	{
@@ -810,129 +816,127 @@ void FTimerManager::Tick(float DeltaTime)
 	UWorld* const OwningWorld = OwningGameInstance ? OwningGameInstance->GetWorld() : nullptr;
 	UWorld* const LevelCollectionWorld = OwningWorld;
 
-	while (ActiveTimerHeap.Num() > 0)
+	// Everything that expires this frame is pulled out of the wheel up front and run as one batch, in expiry order.
+	TArray<FTimerHandle> ExpiredTimers = MoveTemp(ExpiredTimerBatch);
+	AdvanceTimerWheel(ExpiredTimers);
+	if (ExpiredTimers.Num() > 1)
 	{
-		FTimerHandle TopHandle = ActiveTimerHeap.HeapTop();
+		ExpiredTimers.Sort(FTimerExpiryOrder(Timers));
+	}
 
-		// Test for expired timers
-		int32 TopIndex = TopHandle.GetIndex();
-		FTimerData* Top = &Timers[TopIndex];
+	for (FTimerHandle ExpiredHandle : ExpiredTimers)
+	{
+		FTimerData* Top = FindTimer(ExpiredHandle);
 
-		if (Top->Status == ETimerStatus::ActivePendingRemoval)
+		// Skip timers cleared or paused by a delegate that ran earlier in this batch
+		if (!Top || Top->Status != ETimerStatus::Active)
 		{
-			ActiveTimerHeap.HeapPop(TopHandle, FTimerHeapOrder(Timers), /*bAllowShrinking=*/ false);
-			RemoveTimer(TopHandle);
 			continue;
 		}
 
-		if (InternalTime > Top->ExpireTime)
-		{
-			// Timer has expired! Fire the delegate, then handle potential looping.
+		// Timer has expired! Fire the delegate, then handle potential looping.
 
-			if (bDumpTimerLogsThresholdExceeded)
+		if (bDumpTimerLogsThresholdExceeded)
+		{
+			++NbExpiredTimers;
+			if (NbExpiredTimers <= MaxExpiredTimersToLog)
 			{
-				++NbExpiredTimers;
-				if (NbExpiredTimers <= MaxExpiredTimersToLog)
-				{
-					DescribeFTimerDataSafely(*GLog, *Top);
-				}
+				DescribeFTimerDataSafely(*GLog, *Top);
 			}
+		}
 
-			// Set the relevant level context for this timer
-			const int32 LevelCollectionIndex = OwningWorld ? OwningWorld->FindCollectionIndexByType(Top->LevelCollection) : INDEX_NONE;
-			
-			FScopedLevelCollectionContextSwitch LevelContext(LevelCollectionIndex, LevelCollectionWorld);
+		// Set the relevant level context for this timer
+		const int32 LevelCollectionIndex = OwningWorld ? OwningWorld->FindCollectionIndexByType(Top->LevelCollection) : INDEX_NONE;
+		
+		FScopedLevelCollectionContextSwitch LevelContext(LevelCollectionIndex, LevelCollectionWorld);
 
-			// Remove it from the heap and store it while we're executing
-			ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer, FTimerHeapOrder(Timers), /*bAllowShrinking=*/ false);
-			Top->Status = ETimerStatus::Executing;
+		// Store it while we're executing
+		CurrentlyExecutingTimer = ExpiredHandle;
+		Top->Status = ETimerStatus::Executing;
 
-			// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
-			int32 const CallCount = Top->bLoop ? 
-				FMath::TruncToInt( (InternalTime - Top->ExpireTime) / Top->Rate ) + 1
-				: 1;
+		// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
+		int32 const CallCount = Top->bLoop ? 
+			FMath::TruncToInt( (InternalTime - Top->ExpireTime) / Top->Rate ) + 1
+			: 1;
 
 #if UE_ENABLE_TRACKING_TIMER_SOURCES
-			if (TimerSourceList.IsValid())
-			{
-				//@TODO: The actual call count may be less, e.g., if the delegate clears itself during the loop below
-				TimerSourceList->AddEntry(*Top, CallCount);
-			}
+		if (TimerSourceList.IsValid())
+		{
+			//@TODO: The actual call count may be less, e.g., if the delegate clears itself during the loop below
+			TimerSourceList->AddEntry(*Top, CallCount);
+		}
 #endif
 
-			// Now call the function
-			for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
-			{ 
+		// Now call the function
+		for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
+		{ 
 #if DO_TIMEGUARD && 0
-				FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda([&] { 
-						return FString::Printf(TEXT("FTimerManager slowtick from delegate %s "), *Top->TimerDelegate.ToString());
-					});
-				// no delegate should take longer then 2ms to run 
-				SCOPE_TIME_GUARD_DELEGATE_MS(NameFunction, 2);
+			FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda([&] { 
+					return FString::Printf(TEXT("FTimerManager slowtick from delegate %s "), *Top->TimerDelegate.ToString());
+				});
+			// no delegate should take longer then 2ms to run 
+			SCOPE_TIME_GUARD_DELEGATE_MS(NameFunction, 2);
 #endif
 #if DO_TIMEGUARD && 0
-				RunTimerDelegates.Add(Top->TimerDelegate);
+			RunTimerDelegates.Add(Top->TimerDelegate);
 #endif
 
-				checkf(!WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail before Execute()"));
-				Top->TimerDelegate.Execute();
+			checkf(!WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail before Execute()"));
+			Top->TimerDelegate.Execute();
 
-				// Update Top pointer, in case it has been invalidated by the Execute call
-				Top = FindTimer(CurrentlyExecutingTimer);
-				checkf(!Top || !WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail after Execute()"));
-				if (!Top || Top->Status != ETimerStatus::Executing)
-				{
-					break;
-				}
+			// Update Top pointer, in case it has been invalidated by the Execute call
+			Top = FindTimer(CurrentlyExecutingTimer);
+			checkf(!Top || !WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail after Execute()"));
+			if (!Top || Top->Status != ETimerStatus::Executing)
+			{
+				break;
 			}
+		}
 
-			if (DumpTimerLogsThreshold > 0.f && !bDumpTimerLogsThresholdExceeded)
+		if (DumpTimerLogsThreshold > 0.f && !bDumpTimerLogsThresholdExceeded)
+		{
+			// help us hunt down outliers that cause our timer manager times to spike.  Recommended that users set meaningful DumpTimerLogsThresholds in appropriate ini files if they are seeing spikes in the timer manager.
+			const double DeltaT = (FPlatformTime::Seconds() - StartTime) * 1000.f;
+			if (DeltaT >= DumpTimerLogsThreshold)
 			{
-				// help us hunt down outliers that cause our timer manager times to spike.  Recommended that users set meaningful DumpTimerLogsThresholds in appropriate ini files if they are seeing spikes in the timer manager.
-				const double DeltaT = (FPlatformTime::Seconds() - StartTime) * 1000.f;
-				if (DeltaT >= DumpTimerLogsThreshold)
-				{
-					bDumpTimerLogsThresholdExceeded = true;
+				bDumpTimerLogsThresholdExceeded = true;
                     ++NbExpiredTimers;
-					UE_LOG(LogEngine, Log, TEXT("TimerManager's time threshold of %.2fms exceeded with a deltaT of %.4f, dumping current timer data."), DumpTimerLogsThreshold, DeltaT);
-
-					if (Top)
-					{
-						DescribeFTimerDataSafely(*GLog, *Top);
-					}
-					else
-					{
-						UE_LOG(LogEngine, Log, TEXT("There was no timer data for the first timer after exceeding the time threshold!"));
-					}
-				}
-			}
+				UE_LOG(LogEngine, Log, TEXT("TimerManager's time threshold of %.2fms exceeded with a deltaT of %.4f, dumping current timer data."), DumpTimerLogsThreshold, DeltaT);
 
-			// test to ensure it didn't get cleared during execution
-			if (Top)
-			{
-				// if timer requires a delegate, make sure it's still validly bound (i.e. the delegate's object didn't get deleted or something)
-				if (Top->bLoop && (!Top->bRequiresDelegate || Top->TimerDelegate.IsBound()))
+				if (Top)
 				{
-					// Put this timer back on the heap
-					Top->ExpireTime += CallCount * Top->Rate;
-					Top->Status = ETimerStatus::Active;
-					ActiveTimerHeap.HeapPush(CurrentlyExecutingTimer, FTimerHeapOrder(Timers));
+					DescribeFTimerDataSafely(*GLog, *Top);
 				}
 				else
 				{
-					RemoveTimer(CurrentlyExecutingTimer);
+					UE_LOG(LogEngine, Log, TEXT("There was no timer data for the first timer after exceeding the time threshold!"));
 				}
-
-				CurrentlyExecutingTimer.Invalidate();
 			}
 		}
-		else
+
+		// test to ensure it didn't get cleared during execution
+		if (Top)
 		{
-			// no need to go further down the heap, we can be finished
-			break;
+			// if timer requires a delegate, make sure it's still validly bound (i.e. the delegate's object didn't get deleted or something)
+			if (Top->bLoop && (!Top->bRequiresDelegate || Top->TimerDelegate.IsBound()))
+			{
+				// Put this timer back in the wheel
+				Top->ExpireTime += CallCount * Top->Rate;
+				Top->Status = ETimerStatus::Active;
+				LinkTimerToWheel(CurrentlyExecutingTimer.GetIndex());
+			}
+			else
+			{
+				RemoveTimer(CurrentlyExecutingTimer);
+			}
+
+			CurrentlyExecutingTimer.Invalidate();
 		}
 	}
 
+	ExpiredTimers.Reset();
+	ExpiredTimerBatch = MoveTemp(ExpiredTimers);
+
 	if (NbExpiredTimers > MaxExpiredTimersToLog)
 	{
 		UE_LOG(LogEngine, Log, TEXT("TimerManager's caught %d Timers exceeding the time threshold. Only the first %d were logged."), NbExpiredTimers, MaxExpiredTimersToLog);
@@ -951,7 +955,7 @@ void FTimerManager::Tick(float DeltaTime)
 			// Convert from time remaining back to a valid ExpireTime
 			TimerToActivate.ExpireTime += InternalTime;
 			TimerToActivate.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush( Handle, FTimerHeapOrder(Timers) );
+			LinkTimerToWheel(Handle.GetIndex());
 		}
 		PendingTimerSet.Reset();
 	}
@@ -980,12 +984,12 @@ void FTimerManager::ListTimers() const
 	check(IsInGameThread());
 
 	TArray<const FTimerData*> ValidActiveTimers;
-	ValidActiveTimers.Reserve(ActiveTimerHeap.Num());
-	for (FTimerHandle Handle : ActiveTimerHeap)
+	ValidActiveTimers.Reserve(NumTimersInWheel);
+	for (const FTimerData& Data : Timers)
 	{
-		if (const FTimerData* Data = FindTimer(Handle))
+		if (Data.WheelBucket != INDEX_NONE)
 		{
-			ValidActiveTimers.Add(Data);
+			ValidActiveTimers.Add(&Data);
 		}
 	}
 
@@ -1037,6 +1041,8 @@ FTimerHandle FTimerManager::AddTimer(FTimerData&& TimerData)
 
 void FTimerManager::RemoveTimer(FTimerHandle Handle)
 {
+	UnlinkTimerFromWheel(Handle.GetIndex());
+
 	const FTimerData& Data = GetTimer(Handle);
 
 	// Remove TimerIndicesByObject entry if necessary
@@ -1080,6 +1086,158 @@ bool FTimerManager::WillRemoveTimerAssert(FTimerHandle Handle) const
 	return false;
 }
 
+void FTimerManager::LinkTimerToWheel(int32 Index)
+{
+	FTimerData& Data = Timers[Index];
+	checkSlow(Data.WheelBucket == INDEX_NONE);
+
+	// Timers beyond the wheel's horizon are parked in the coarsest level and re-filed as it cascades
+	const int64 MaxSlotDelta = (int64(1) << (TimerWheelLevelBits * TimerWheelNumLevels)) - 1;
+	const int64 SlotDelta = FMath::Clamp<int64>(GetTimerWheelSlot(Data.ExpireTime) - TimerWheelCursor, 0, MaxSlotDelta);
+	const int64 TargetSlot = TimerWheelCursor + SlotDelta;
+
+	int32 Level = 0;
+	while (Level < TimerWheelNumLevels - 1 && SlotDelta >= (int64(1) << (TimerWheelLevelBits * (Level + 1))))
+	{
+		++Level;
+	}
+
+	const int32 LevelBucket = (int32)(TargetSlot >> (TimerWheelLevelBits * Level)) & (TimerWheelBucketsPerLevel - 1);
+	const int32 Bucket = Level * TimerWheelBucketsPerLevel + LevelBucket;
+
+	const int32 OldHead = TimerWheelHeads[Bucket];
+	if (OldHead != INDEX_NONE)
+	{
+		Timers[OldHead].WheelPrev = Index;
+	}
+
+	Data.WheelBucket = Bucket;
+	Data.WheelPrev = INDEX_NONE;
+	Data.WheelNext = OldHead;
+	TimerWheelHeads[Bucket] = Index;
+	TimerWheelOccupancy[Level] |= (uint64(1) << LevelBucket);
+	++NumTimersInWheel;
+}
+
+void FTimerManager::UnlinkTimerFromWheel(int32 Index)
+{
+	FTimerData& Data = Timers[Index];
+	const int32 Bucket = Data.WheelBucket;
+	if (Bucket == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (Data.WheelPrev != INDEX_NONE)
+	{
+		Timers[Data.WheelPrev].WheelNext = Data.WheelNext;
+	}
+	else
+	{
+		TimerWheelHeads[Bucket] = Data.WheelNext;
+		if (Data.WheelNext == INDEX_NONE)
+		{
+			TimerWheelOccupancy[Bucket / TimerWheelBucketsPerLevel] &= ~(uint64(1) << (Bucket % TimerWheelBucketsPerLevel));
+		}
+	}
+
+	if (Data.WheelNext != INDEX_NONE)
+	{
+		Timers[Data.WheelNext].WheelPrev = Data.WheelPrev;
+	}
+
+	Data.WheelBucket = INDEX_NONE;
+	Data.WheelPrev = INDEX_NONE;
+	Data.WheelNext = INDEX_NONE;
+	--NumTimersInWheel;
+}
+
+void FTimerManager::CascadeTimerWheelBucket(int32 Bucket)
+{
+	// Detach the whole list first so timers re-filed into this bucket (only possible beyond the horizon) aren't revisited
+	int32 Index = TimerWheelHeads[Bucket];
+	TimerWheelHeads[Bucket] = INDEX_NONE;
+	TimerWheelOccupancy[Bucket / TimerWheelBucketsPerLevel] &= ~(uint64(1) << (Bucket % TimerWheelBucketsPerLevel));
+
+	while (Index != INDEX_NONE)
+	{
+		FTimerData& Data = Timers[Index];
+		const int32 NextIndex = Data.WheelNext;
+
+		Data.WheelBucket = INDEX_NONE;
+		Data.WheelPrev = INDEX_NONE;
+		Data.WheelNext = INDEX_NONE;
+		--NumTimersInWheel;
+
+		LinkTimerToWheel(Index);
+		Index = NextIndex;
+	}
+}
+
+void FTimerManager::AdvanceTimerWheel(TArray<FTimerHandle>& OutExpiredTimers)
+{
+	const int64 TargetSlot = FMath::Max(GetTimerWheelSlot(InternalTime), TimerWheelCursor);
+
+	if (NumTimersInWheel == 0)
+	{
+		TimerWheelCursor = TargetSlot;
+		return;
+	}
+
+	for (int64 Slot = TimerWheelCursor; ; ++Slot)
+	{
+		if (Slot != TimerWheelCursor)
+		{
+			TimerWheelCursor = Slot;
+
+			// Entering a new span of a coarser level: cascade its bucket down, coarsest first
+			int32 CascadeLevel = 0;
+			while (CascadeLevel < TimerWheelNumLevels - 1 && (Slot & ((int64(1) << (TimerWheelLevelBits * (CascadeLevel + 1))) - 1)) == 0)
+			{
+				++CascadeLevel;
+			}
+
+			for (int32 Level = CascadeLevel; Level > 0; --Level)
+			{
+				const int32 LevelBucket = (int32)(Slot >> (TimerWheelLevelBits * Level)) & (TimerWheelBucketsPerLevel - 1);
+				if (TimerWheelOccupancy[Level] & (uint64(1) << LevelBucket))
+				{
+					CascadeTimerWheelBucket(Level * TimerWheelBucketsPerLevel + LevelBucket);
+				}
+			}
+		}
+
+		const int32 Bucket = (int32)(Slot & (TimerWheelBucketsPerLevel - 1));
+		if (TimerWheelOccupancy[0] & (uint64(1) << Bucket))
+		{
+			// Slots we've moved past are fully expired. The slot InternalTime is in may still hold timers due later this slot.
+			const bool bSlotElapsed = Slot < TargetSlot;
+
+			int32 Index = TimerWheelHeads[Bucket];
+			while (Index != INDEX_NONE)
+			{
+				const FTimerData& Data = Timers[Index];
+				const int32 NextIndex = Data.WheelNext;
+
+				if (bSlotElapsed || InternalTime > Data.ExpireTime)
+				{
+					OutExpiredTimers.Add(Data.Handle);
+					UnlinkTimerFromWheel(Index);
+				}
+
+				Index = NextIndex;
+			}
+		}
+
+		if (Slot == TargetSlot || NumTimersInWheel == 0)
+		{
+			break;
+		}
+	}
+
+	TimerWheelCursor = TargetSlot;
+}
+
 FTimerHandle FTimerManager::GenerateHandle(int32 Index)
 {
 	uint64 NewSerialNumber = ++LastAssignedSerialNumber;
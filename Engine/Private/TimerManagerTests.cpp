@@ -266,6 +266,72 @@ bool TimerManagerTest_LoopingTimers_DifferentHandles(UWorld* World, FAutomationT
 	return true;
 }
 
+struct FClearOtherTestFunc
+{
+	static FTimerManager* TimerManager;
+	static FTimerHandle* OtherHandle;
+	static void TimerExecute()
+	{
+		TimerManager->ClearTimer(*OtherHandle);
+	}
+};
+
+FTimerManager* FClearOtherTestFunc::TimerManager = nullptr;
+FTimerHandle* FClearOtherTestFunc::OtherHandle = nullptr;
+
+// Timers far enough out to be filed in the coarser wheel levels, and timers expiring in the same frame
+bool TimerManagerTest_WheelLevelsAndSameFrameExpiry(UWorld* World, FAutomationTestBase* Test)
+{
+	FTimerManager& TimerManager = World->GetTimerManager();
+
+	FDummy Dummy;
+	FTimerDelegate Delegate;
+	Delegate.BindRaw(&Dummy, &FDummy::Callback);
+
+	FTimerHandle LongHandle;
+	TimerManager.SetTimer(LongHandle, Delegate, 75.f, false);
+	TimerTest_TickWorld(World, KINDA_SMALL_NUMBER);
+
+	TimerTest_TickWorld(World, 74.5f);
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer has not fired early"), Dummy.Count == 0);
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer is still active"), TimerManager.IsTimerActive(LongHandle));
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer remaining time survives cascading"), FMath::IsNearlyEqual(TimerManager.GetTimerRemaining(LongHandle), 0.5f, 1e-2f));
+
+	TimerTest_TickWorld(World, 1.f);
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer fired once"), Dummy.Count == 1);
+	Test->TestFalse(TIMER_TEST_TEXT("Long timer is gone after firing"), TimerManager.TimerExists(LongHandle));
+
+	// Both timers expire in the same frame, the first one to run clears the second
+	Dummy.Reset();
+	FTimerHandle FirstHandle, SecondHandle;
+	FClearOtherTestFunc::TimerManager = &TimerManager;
+	FClearOtherTestFunc::OtherHandle = &SecondHandle;
+	TimerManager.SetTimer(FirstHandle, FTimerDelegate::CreateStatic(FClearOtherTestFunc::TimerExecute), 0.5f, false);
+	TimerManager.SetTimer(SecondHandle, Delegate, 0.55f, false);
+	TimerTest_TickWorld(World, KINDA_SMALL_NUMBER);
+
+	World->Tick(ELevelTick::LEVELTICK_All, 1.f);
+	GFrameCounter++;
+
+	Test->TestTrue(TIMER_TEST_TEXT("Timer cleared earlier in the same batch did not fire"), Dummy.Count == 0);
+	Test->TestFalse(TIMER_TEST_TEXT("Cleared timer no longer exists"), TimerManager.TimerExists(SecondHandle));
+
+	// Pausing and clearing an active timer before it comes due
+	FTimerHandle PausedHandle;
+	TimerManager.SetTimer(PausedHandle, Delegate, 0.5f, false);
+	TimerManager.SetTimer(SecondHandle, Delegate, 0.5f, false);
+	TimerTest_TickWorld(World, KINDA_SMALL_NUMBER);
+	TimerManager.PauseTimer(PausedHandle);
+	TimerManager.ClearTimer(SecondHandle);
+	TimerTest_TickWorld(World, 1.f);
+
+	Test->TestTrue(TIMER_TEST_TEXT("Paused and cleared timers did not fire"), Dummy.Count == 0);
+	Test->TestTrue(TIMER_TEST_TEXT("Paused timer still exists"), TimerManager.IsTimerPaused(PausedHandle));
+	TimerManager.ClearTimer(PausedHandle);
+
+	return true;
+}
+
 bool FTimerManagerTest::RunTest(const FString& Parameters)
 {
 	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
@@ -281,6 +347,7 @@ bool FTimerManagerTest::RunTest(const FString& Parameters)
 	TimerManagerTest_ValidTimer_HandleWithDelegate(World, this);
 	TimerManagerTest_ValidTimer_HandleLoopingSetDuringExecute(World, this);
 	TimerManagerTest_LoopingTimers_DifferentHandles(World, this);
+	TimerManagerTest_WheelLevelsAndSameFrameExpiry(World, this);
 
 	GEngine->DestroyWorldContext(World);
 	World->DestroyWorld(false);
@@ -233,6 +233,7 @@ UnrealEngine.cpp: Implements the UEngine class and helpers.
 #include "ObjectTrace.h"
 #include "StudioAnalytics.h"
 #include "TraceFilter.h"
+#include "ShaderPipelineCache.h"
 
 DEFINE_LOG_CATEGORY(LogEngine);
 IMPLEMENT_MODULE( FEngineModule, Engine );
@@ -373,6 +374,15 @@ static FAutoConsoleVariableRef GSupressWarningsInOnScreenDisplayCVar(
 	ECVF_Default
 );
 
+static int32 GShaderPipelineCacheFastBatchDuringLoadMap = 1;
+static FAutoConsoleVariableRef CVarShaderPipelineCacheFastBatchDuringLoadMap(
+	TEXT("r.ShaderPipelineCache.FastBatchDuringLoadMap"),
+	GShaderPipelineCacheFastBatchDuringLoadMap,
+	TEXT("If 1, the shader pipeline cache precompiles its recorded pipeline states in fast batch mode while a map loads, then returns to background batching.\n")
+	TEXT("This moves the pipeline state creation that would otherwise hitch the first frames drawing new content into the loading screen."),
+	ECVF_Default
+);
+
 /** Whether texture memory has been corrupted because we ran out of memory in the pool. */
 bool GIsTextureMemoryCorrupted = false;
 
@@ -1956,6 +1966,50 @@ static FAutoConsoleCommand SetTimedMemReport(TEXT("TimedMemReport.Delay"), TEXT(
 
 #endif
 
+static int32 GLowLatencyFramePacing = 0;
+static FAutoConsoleVariableRef CVarLowLatencyFramePacing(
+	TEXT("r.LowLatencyFramePacing"),
+	GLowLatencyFramePacing,
+	TEXT("If 1, when the rendering thread, RHI thread or GPU is the bottleneck the game thread waits at the start of the frame, before input is sampled,\n")
+	TEXT("instead of on the frame end fence once the frame is simulated. Frames are then simulated from later input and don't queue behind the previous one.\n")
+	TEXT("Games only, not used with a fixed frame rate or while dumping a movie."),
+	ECVF_Default);
+
+static float GLowLatencyFramePacingMarginMS = 2.0f;
+static FAutoConsoleVariableRef CVarLowLatencyFramePacingMarginMS(
+	TEXT("r.LowLatencyFramePacing.MarginMS"),
+	GLowLatencyFramePacingMarginMS,
+	TEXT("Milliseconds r.LowLatencyFramePacing leaves in the wait it predicts, so frame time variations don't starve the rendering thread."),
+	ECVF_Default);
+
+static float GLowLatencyFramePacingMaxWaitMS = 30.0f;
+static FAutoConsoleVariableRef CVarLowLatencyFramePacingMaxWaitMS(
+	TEXT("r.LowLatencyFramePacing.MaxWaitMS"),
+	GLowLatencyFramePacingMaxWaitMS,
+	TEXT("Longest wait in milliseconds r.LowLatencyFramePacing adds to a frame."),
+	ECVF_Default);
+
+/**
+ * The game thread simulates a frame while the previous one renders, and waits on the frame end fence when rendering is slower.
+ * That wait happens after input was sampled, predict it from the last frame and wait beforehand instead.
+ */
+static float GetLowLatencyFramePacingWaitTime()
+{
+	if (!GLowLatencyFramePacing || GIsEditor || GIsDumpingMovie || IsRunningDedicatedServer() || !GIsThreadedRendering)
+	{
+		return 0.0f;
+	}
+
+	const uint32 BottleneckCycles = FMath::Max3(GRenderThreadTime, GRHIThreadTime, GGPUFrameTime);
+	if (BottleneckCycles <= GGameThreadTime)
+	{
+		return 0.0f;
+	}
+
+	const float WaitTime = FPlatformTime::ToSeconds(BottleneckCycles - GGameThreadTime) - GLowLatencyFramePacingMarginMS / 1000.0f;
+	return FMath::Clamp(WaitTime, 0.0f, GLowLatencyFramePacingMaxWaitMS / 1000.0f);
+}
+
 double UEngine::CorrectNegativeTimeDelta(double DeltaRealTime)
 {
 #if PLATFORM_ANDROID
@@ -2050,6 +2104,11 @@ void UEngine::UpdateTimeAndHandleMaxTickRate()
 			WaitTime = FMath::Max( 1.f / MaxTickRate - DeltaRealTime, 0.f );
 		}
 
+		if (!bUseFixedFrameRate)
+		{
+			WaitTime = FMath::Max(WaitTime, GetLowLatencyFramePacingWaitTime());
+		}
+
 		// Enforce maximum framerate and smooth framerate by waiting.
 		double ActualWaitTime = 0.f;
 		if( WaitTime > 0 )
@@ -12414,6 +12473,31 @@ bool UEngine::LoadMap( FWorldContext& WorldContext, FURL URL, class UPendingNetG
 
 	} PostLoadMapCaller;
 
+	// Precompile recorded pipeline states as fast as possible while nothing is drawn
+	struct FShaderPipelineCacheLoadMapScope
+	{
+		FShaderPipelineCacheLoadMapScope()
+			: bFastBatch(GShaderPipelineCacheFastBatchDuringLoadMap != 0)
+		{
+			if (bFastBatch)
+			{
+				FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Fast);
+			}
+		}
+
+		~FShaderPipelineCacheLoadMapScope()
+		{
+			if (bFastBatch)
+			{
+				FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Background);
+			}
+		}
+
+	private:
+		bool bFastBatch;
+
+	} ShaderPipelineCacheLoadMapScope;
+
 	// Cancel any pending texture streaming requests.  This avoids a significant delay on consoles 
 	// when loading a map and there are a lot of outstanding texture streaming requests from the previous map.
 	UTexture2D::CancelPendingTextureStreaming();
@@ -12447,6 +12531,13 @@ bool UEngine::LoadMap( FWorldContext& WorldContext, FURL URL, class UPendingNetG
 	UE_LOG(LogLoad, Log,  TEXT("LoadMap: %s"), *URL.ToString() );
 	GInitRunaway();
 
+	// Keep what the new map shares with the current one loaded through the teardown below, until the new map has loaded
+	FWorldTransitionAssetRetainer RetainedAssets;
+	if (WorldContext.World() && FWorldTransitionAssetRetainer::IsEnabled())
+	{
+		RetainedAssets.Retain(URL.Map);
+	}
+
 #if !UE_BUILD_SHIPPING
 	const bool bOldWorldWasShowingCollisionForHiddenComponents = WorldContext.World() && WorldContext.World()->bCreateRenderStateForHiddenComponentsWithCollsion;
 #endif
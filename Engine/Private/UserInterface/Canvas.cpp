@@ -19,6 +19,7 @@
 #include "EngineFontServices.h"
 #include "Internationalization/BreakIterator.h"
 #include "Misc/CoreDelegates.h"
+#include "HAL/IConsoleManager.h"
 #include "OneColorShader.h"
 #include "PipelineStateCache.h"
 #include "ClearQuad.h"
@@ -41,6 +42,20 @@ DEFINE_STAT(STAT_Canvas_AddTileRenderTime);
 DEFINE_STAT(STAT_Canvas_AddTriangleRenderTime);
 DEFINE_STAT(STAT_Canvas_NumBatchesCreated);
 
+static int32 GCanvasBatchMergeLookback = 0;
+static FAutoConsoleVariableRef CVarCanvasBatchMergeLookback(
+	TEXT("Canvas.BatchMergeLookback"),
+	GCanvasBatchMergeLookback,
+	TEXT("Number of batches before the last one of a depth sort key that new canvas items can be merged into, 0 only merges into the last batch.\n")
+	TEXT("Merging into an earlier batch draws the item before the batches added since, so items sharing a sort key must not overlap."),
+	ECVF_Default);
+
+/** Returns the number of batches at the end of a sort element that new items may be merged into */
+static int32 GetNumBatchesToMergeInto(const TArray<FCanvasBaseRenderItem*>& RenderBatchArray)
+{
+	return FMath::Min(RenderBatchArray.Num(), 1 + FMath::Max(GCanvasBatchMergeLookback, 0));
+}
+
 FCanvasWordWrapper::FCanvasWordWrapper()
 	: GraphemeBreakIterator(FBreakIterator::CreateCharacterBoundaryIterator())
 	, LineBreakIterator(FBreakIterator::CreateLineBreakIterator())
@@ -546,16 +561,21 @@ FBatchedElements* FCanvas::GetBatchedElements(EElementType InElementType, FBatch
 		FinalTransform = FTransformEntry(FScaleMatrix(1/GetDPIScale()) * FinalTransform.GetMatrix());
 	}
 
-	// try to use the current top entry in the render batch array
-	if( SortElement.RenderBatchArray.Num() > 0 )
+	// try to use the current top entry in the render batch array, or a previous one if merging is allowed
+	const int32 NumBatchesToSearch = GetNumBatchesToMergeInto(SortElement.RenderBatchArray);
+	for (int32 SearchIndex = 0; SearchIndex < NumBatchesToSearch && RenderBatch == NULL; SearchIndex++)
 	{
-		checkSlow( SortElement.RenderBatchArray.Last() );
-		RenderBatch = SortElement.RenderBatchArray.Last()->GetCanvasBatchedElementRenderItem();
-	}	
+		FCanvasBaseRenderItem* RenderItem = SortElement.RenderBatchArray[SortElement.RenderBatchArray.Num() - 1 - SearchIndex];
+		checkSlow( RenderItem );
+		FCanvasBatchedElementRenderItem* Candidate = RenderItem->GetCanvasBatchedElementRenderItem();
+		if (Candidate && Candidate->IsMatch(InBatchedElementParameters, InTexture, InBlendMode, InElementType, FinalTransform, GlowInfo))
+		{
+			RenderBatch = Candidate;
+		}
+	}
 
 	// if a matching entry for this batch doesn't exist then allocate a new entry
-	if( RenderBatch == NULL ||		
-		!RenderBatch->IsMatch(InBatchedElementParameters, InTexture, InBlendMode, InElementType, FinalTransform, GlowInfo) )
+	if( RenderBatch == NULL )
 	{
 		INC_DWORD_STAT(STAT_Canvas_NumBatchesCreated);
 
@@ -577,15 +597,20 @@ void FCanvas::AddTileRenderItem(float X, float Y, float SizeX, float SizeY, floa
 	// get the current transform entry from top of transform stack
 	const FTransformEntry& TopTransformEntry = TransformStack.Top();	
 
-	// try to use the current top entry in the render batch array
-	if( SortElement.RenderBatchArray.Num() > 0 )
+	// try to use the current top entry in the render batch array, or a previous one if merging is allowed
+	const int32 NumBatchesToSearch = GetNumBatchesToMergeInto(SortElement.RenderBatchArray);
+	for (int32 SearchIndex = 0; SearchIndex < NumBatchesToSearch && RenderBatch == NULL; SearchIndex++)
 	{
-		checkSlow( SortElement.RenderBatchArray.Last() );
-		RenderBatch = SortElement.RenderBatchArray.Last()->GetCanvasTileRendererItem();
-	}	
+		FCanvasBaseRenderItem* RenderItem = SortElement.RenderBatchArray[SortElement.RenderBatchArray.Num() - 1 - SearchIndex];
+		checkSlow( RenderItem );
+		FCanvasTileRendererItem* Candidate = RenderItem->GetCanvasTileRendererItem();
+		if (Candidate && Candidate->IsMatch(MaterialRenderProxy, TopTransformEntry))
+		{
+			RenderBatch = Candidate;
+		}
+	}
 	// if a matching entry for this batch doesn't exist then allocate a new entry
-	if( RenderBatch == NULL ||		
-		!RenderBatch->IsMatch(MaterialRenderProxy,TopTransformEntry) )
+	if( RenderBatch == NULL )
 	{
 		INC_DWORD_STAT(STAT_Canvas_NumBatchesCreated);
 
@@ -608,14 +633,20 @@ void FCanvas::AddTriangleRenderItem(const FCanvasUVTri& Tri, const FMaterialRend
 	// get the current transform entry from top of transform stack
 	const FTransformEntry& TopTransformEntry = TransformStack.Top();
 	
-	// try to use the current top entry in the render batch array
-	if (SortElement.RenderBatchArray.Num() > 0)
-	{
-		checkSlow(SortElement.RenderBatchArray.Last());
-		RenderBatch = SortElement.RenderBatchArray.Last()->GetCanvasTriangleRendererItem();
+	// try to use the current top entry in the render batch array, or a previous one if merging is allowed
+	const int32 NumBatchesToSearch = GetNumBatchesToMergeInto(SortElement.RenderBatchArray);
+	for (int32 SearchIndex = 0; SearchIndex < NumBatchesToSearch && RenderBatch == nullptr; SearchIndex++)
+	{
+		FCanvasBaseRenderItem* RenderItem = SortElement.RenderBatchArray[SortElement.RenderBatchArray.Num() - 1 - SearchIndex];
+		checkSlow(RenderItem);
+		FCanvasTriangleRendererItem* Candidate = RenderItem->GetCanvasTriangleRendererItem();
+		if (Candidate && Candidate->IsMatch(MaterialRenderProxy, TopTransformEntry))
+		{
+			RenderBatch = Candidate;
+		}
 	}
 	// if a matching entry for this batch doesn't exist then allocate a new entry
-	if (RenderBatch == nullptr || !RenderBatch->IsMatch(MaterialRenderProxy, TopTransformEntry))
+	if (RenderBatch == nullptr)
 	{
 		INC_DWORD_STAT(STAT_Canvas_NumBatchesCreated);
 	
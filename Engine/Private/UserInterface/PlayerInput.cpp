@@ -931,11 +931,14 @@ float UPlayerInput::DetermineAxisValue(const FInputAxisBinding& AxisBinding, con
 		for (int32 AxisIndex = 0; AxisIndex < KeyDetails->KeyMappings.Num(); ++AxisIndex)
 		{
 			const FInputAxisKeyMapping& KeyMapping = (KeyDetails->KeyMappings)[AxisIndex];
-			if ( !IsKeyConsumed(KeyMapping.Key) )
+
+			// Look the key state up once for both the consumed test and the value
+			const FKeyState* KeyState = (KeyMapping.Key != EKeys::AnyKey) ? KeyStateMap.Find(KeyMapping.Key) : nullptr;
+			if ( !IsKeyConsumed(KeyMapping.Key, KeyState) )
 			{
 				if (!bGamePaused || AxisBinding.bExecuteWhenPaused)
 				{
-					AxisValue += GetKeyValue(KeyMapping.Key) * KeyMapping.Scale;
+					AxisValue += (KeyState ? KeyState->Value.X : GetKeyValue(KeyMapping.Key)) * KeyMapping.Scale;
 				}
 
 				if (AxisBinding.bConsumeInput)
@@ -1095,6 +1098,13 @@ void UPlayerInput::ProcessInputStack(const TArray<UInputComponent*>& InputCompon
 		}
 	};
 
+	// Key states don't change while walking the stack, only whether they're consumed
+	FKeyState* TouchKeyStates[EKeys::NUM_TOUCH_KEYS];
+	for (int32 TouchIndex = 0; TouchIndex < EKeys::NUM_TOUCH_KEYS; TouchIndex++)
+	{
+		TouchKeyStates[TouchIndex] = KeyStateMap.Find(EKeys::TouchKeys[TouchIndex]);
+	}
+
 	int32 StackIndex = InputComponentStack.Num()-1;
 
 	// Walk the stack, top to bottom
@@ -1169,7 +1179,7 @@ void UPlayerInput::ProcessInputStack(const TArray<UInputComponent*>& InputCompon
 				for (int32 TouchIndex = 0; TouchIndex < EKeys::NUM_TOUCH_KEYS; TouchIndex++)
 				{
 					const FKey& TouchKey = EKeys::TouchKeys[TouchIndex];
-					FKeyState* KeyState = KeyStateMap.Find(TouchKey);
+					FKeyState* KeyState = TouchKeyStates[TouchIndex];
 					if (KeyEventOccurred(TouchKey, TB.KeyEvent, EventIndices, KeyState) && !IsKeyConsumed(TouchKey, KeyState))
 					{
 						if (TB.bExecuteWhenPaused || !bGamePaused)
@@ -1230,11 +1240,12 @@ void UPlayerInput::ProcessInputStack(const TArray<UInputComponent*>& InputCompon
 			}
 			for (FInputAxisKeyBinding& AxisKeyBinding : IC->AxisKeyBindings)
 			{
-				if (!IsKeyConsumed(AxisKeyBinding.AxisKey))
+				const FKeyState* KeyState = (AxisKeyBinding.AxisKey != EKeys::AnyKey) ? KeyStateMap.Find(AxisKeyBinding.AxisKey) : nullptr;
+				if (!IsKeyConsumed(AxisKeyBinding.AxisKey, KeyState))
 				{
 					if (!bGamePaused || AxisKeyBinding.bExecuteWhenPaused)
 					{
-						AxisKeyBinding.AxisValue = GetKeyValue(AxisKeyBinding.AxisKey);
+						AxisKeyBinding.AxisValue = KeyState ? KeyState->Value.X : GetKeyValue(AxisKeyBinding.AxisKey);
 					}
 					else
 					{
@@ -1254,11 +1265,12 @@ void UPlayerInput::ProcessInputStack(const TArray<UInputComponent*>& InputCompon
 			}
 			for (FInputVectorAxisBinding& VectorAxisBinding : IC->VectorAxisBindings)
 			{
-				if (!IsKeyConsumed(VectorAxisBinding.AxisKey))
+				const FKeyState* KeyState = (VectorAxisBinding.AxisKey != EKeys::AnyKey) ? KeyStateMap.Find(VectorAxisBinding.AxisKey) : nullptr;
+				if (!IsKeyConsumed(VectorAxisBinding.AxisKey, KeyState))
 				{
 					if (!bGamePaused || VectorAxisBinding.bExecuteWhenPaused)
 					{
-						VectorAxisBinding.AxisValue = GetProcessedVectorKeyValue(VectorAxisBinding.AxisKey);
+						VectorAxisBinding.AxisValue = KeyState ? KeyState->Value : GetProcessedVectorKeyValue(VectorAxisBinding.AxisKey);
 					}
 					else
 					{
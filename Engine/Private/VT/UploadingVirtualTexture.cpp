@@ -378,6 +378,12 @@ FVTDataAndStatus FUploadingVirtualTexture::ReadData(FGraphEventArray& OutComplet
 		{
 			return EVTRequestPageStatus::Saturated;
 		}
+
+		IMemoryReadStreamRef MappedData = GetVirtualTextureChunkDDCCache()->ReadMappedChunk(&Chunk, Offset, Size);
+		if (MappedData)
+		{
+			return FVTDataAndStatus(EVTRequestPageStatus::Available, MappedData);
+		}
 		ChunkFileName = ChunkFileNameDCC;
 	}
 #else // WITH_EDITOR
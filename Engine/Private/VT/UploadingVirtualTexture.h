@@ -71,6 +71,7 @@ public:
 	// End IVirtualTexture interface
 
 	inline const FVirtualTextureBuiltData* GetVTData() const { return Data; }
+	inline int32 GetFirstMipOffset() const { return FirstMipOffset; }
 
 	// gets the codec for the given chunk, data is not valid until returned OutCompletionEvents are complete
 	FVTCodecAndStatus GetCodecForChunk(FGraphEventArray& OutCompletionEvents, uint32 ChunkIndex, EVTRequestPagePriority Priority);
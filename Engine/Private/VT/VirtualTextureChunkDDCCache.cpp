@@ -23,6 +23,15 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogVTDiskCache, Log, All);
 DEFINE_LOG_CATEGORY(LogVTDiskCache);
 
+static int32 GVirtualTextureDDCCacheMemoryMapped = 0;
+static FAutoConsoleVariableRef CVarVirtualTextureDDCCacheMemoryMapped(
+	TEXT("r.VT.DDCCache.MemoryMapped"),
+	GVirtualTextureDDCCacheMemoryMapped,
+	TEXT("If 1, tiles of VT chunks cached from the DDC are read straight from a memory mapping of the cached file instead of going through the file cache.\n")
+	TEXT("Recently used chunks then stay resident in the OS page cache, but reading a cold page blocks the rendering thread on disk."),
+	ECVF_Default
+);
+
 class FVirtualTextureDCCCacheCleanup final : public FRunnable
 {
 	/** Singleton instance */
@@ -234,12 +243,23 @@ void FVirtualTextureChunkDDCCache::Initialize()
 		IFileManager::Get().Delete(*TempFilename, false, false, true);
 	}
 
+	// List the cache folder once rather than probing every chunk file on its first request
+	TArray<FString> CachedFileNames;
+	IFileManager::Get().FindFiles(CachedFileNames, *(AbsoluteCachePath / TEXT("*")), true, false);
+	ResidentChunkFiles.Reserve(CachedFileNames.Num());
+	for (FString& CachedFileName : CachedFileNames)
+	{
+		ResidentChunkFiles.Add(MoveTemp(CachedFileName));
+	}
+
 	FVirtualTextureDCCCacheCleanup::Startup(AbsoluteCachePath);
 }
 
 void FVirtualTextureChunkDDCCache::ShutDown()
 {
 	ActiveChunks.Empty();
+	ResidentChunkFiles.Empty();
+	MappedChunkFiles.Empty();
 	FVirtualTextureDCCCacheCleanup::Shutdown();
 }
 
@@ -259,6 +279,14 @@ bool FVirtualTextureChunkDDCCache::MakeChunkAvailable(FVirtualTextureDataChunk*
 		return true;
 	}
 
+	// Cached by a previous session?
+	if (ResidentChunkFiles.Contains(Chunk->ShortDerivedDataKey))
+	{
+		Chunk->bFileAvailableInVTDDCDache = true;
+		ChunkFileName = CachedFilePath;
+		return true;
+	}
+
 	// Are we already processing this chunk ?
 	const int32 ChunkInProgressIdx = ActiveChunks.Find(Chunk);
 	if (ChunkInProgressIdx != -1)
@@ -286,5 +314,39 @@ bool FVirtualTextureChunkDDCCache::MakeChunkAvailable(FVirtualTextureDataChunk*
 	return false;
 }
 
+IMemoryReadStreamRef FVirtualTextureChunkDDCCache::ReadMappedChunk(const FVirtualTextureDataChunk* Chunk, int64 Offset, int64 Size)
+{
+	if (GVirtualTextureDDCCacheMemoryMapped == 0 || !Chunk->bFileAvailableInVTDDCDache)
+	{
+		return IMemoryReadStreamRef();
+	}
+
+	FMappedChunkFile* MappedFile = MappedChunkFiles.Find(Chunk->ShortDerivedDataKey);
+	if (MappedFile == nullptr)
+	{
+		MappedFile = &MappedChunkFiles.Add(Chunk->ShortDerivedDataKey);
+
+		const FString CachedFilePath = AbsoluteCachePath / Chunk->ShortDerivedDataKey;
+		MappedFile->Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*CachedFilePath));
+		if (MappedFile->Handle)
+		{
+			MappedFile->Region.Reset(MappedFile->Handle->MapRegion());
+		}
+		if (!MappedFile->Region)
+		{
+			// Keep the failed entry, the chunk is then read through the file cache without trying to map it again
+			UE_LOG(LogVTDiskCache, Verbose, TEXT("Failed to map %s, reading it through the file cache"), *CachedFilePath);
+			MappedFile->Handle.Reset();
+		}
+	}
+
+	const IMappedFileRegion* Region = MappedFile->Region.Get();
+	if (Region == nullptr || Offset + Size > Region->GetMappedSize())
+	{
+		return IMemoryReadStreamRef();
+	}
+
+	return IMemoryReadStream::CreateFromCopy(Region->GetMappedPtr() + Offset, Size);
+}
 
-#endif
\ No newline at end of file
+#endif
@@ -5,6 +5,8 @@
 #if WITH_EDITOR
 
 #include "CoreMinimal.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/MemoryReadStream.h"
 
 class FVirtualTextureChunkDDCCache
 {
@@ -15,9 +17,27 @@ public:
 
 	bool MakeChunkAvailable(struct FVirtualTextureDataChunk* Chunk, FString& ChunkFileName, bool bAsync);
 
+	/**
+	 * Reads a range of an available chunk straight from a memory mapping of its cached file, see r.VT.DDCCache.MemoryMapped.
+	 * Returns null if mapping is disabled or not supported, the caller should then read the file through the file cache.
+	 */
+	IMemoryReadStreamRef ReadMappedChunk(const struct FVirtualTextureDataChunk* Chunk, int64 Offset, int64 Size);
+
 private:
+	struct FMappedChunkFile
+	{
+		TUniquePtr<IMappedFileHandle> Handle;
+		TUniquePtr<IMappedFileRegion> Region;
+	};
+
 	TArray<struct FVirtualTextureDataChunk*> ActiveChunks;
 	FString AbsoluteCachePath;
+
+	/** Files found in the cache folder at startup, lets chunks cached by previous sessions skip probing the disk */
+	TSet<FString> ResidentChunkFiles;
+
+	/** Mapped cached files, keyed by chunk short derived data key. Only accessed from the rendering thread. */
+	TMap<FString, FMappedChunkFile> MappedChunkFiles;
 };
 
 FVirtualTextureChunkDDCCache* GetVirtualTextureChunkDDCCache();
@@ -23,6 +23,15 @@ static FAutoConsoleVariableRef CVarNumTranscodeRequests(
 	TEXT("Number of transcode request that can be in flight. default 32\n"),
 	ECVF_Default);
 
+static int32 NumPrefetchTranscodeRequests = 0;
+static FAutoConsoleVariableRef CVarNumPrefetchTranscodeRequests(
+	TEXT("r.VT.NumPrefetchTranscodeRequests"),
+	NumPrefetchTranscodeRequests,
+	TEXT("Number of transcoded tiles of the next finer mip that can be prefetched ahead of the renderer's requests, 0 disables prefetching. default 0\n")
+	TEXT("When a tile is requested, its children are transcoded at background priority so they are ready when the camera moves closer.\n")
+	TEXT("Prefetched tiles hold staging memory until they are requested or retired after r.VT.TranscodeRetireAge frames."),
+	ECVF_Default);
+
 FVirtualTextureChunkStreamingManager::FVirtualTextureChunkStreamingManager()
 {
 #if WITH_EDITOR
@@ -104,6 +113,19 @@ FVTRequestPageResult FVirtualTextureChunkStreamingManager::RequestTile(FUploadin
 		return EVTRequestPageStatus::Saturated;
 	}
 
+	const FVTRequestPageResult Result = SubmitTranscode(VTexture, TranscodeKey, ChunkIndex, LayerMask, vLevel, vAddress, Priority, false);
+	if (Result.Status == EVTRequestPageStatus::Pending && NumPrefetchTranscodeRequests > 0)
+	{
+		PrefetchFinerTiles(VTexture, ProducerHandle, LayerMask, vLevel, vAddress);
+	}
+	return Result;
+}
+
+FVTRequestPageResult FVirtualTextureChunkStreamingManager::SubmitTranscode(FUploadingVirtualTexture* VTexture, const FVTTranscodeKey& TranscodeKey, int32 ChunkIndex, uint8 LayerMask, uint8 vLevel, uint32 vAddress, EVTRequestPagePriority Priority, bool bPrefetch)
+{
+	const FVirtualTextureBuiltData* VTData = VTexture->GetVTData();
+	const uint32 TileIndex = VTData->GetTileIndex(vLevel, vAddress);
+
 	FGraphEventArray GraphCompletionEvents;
 	const FVTCodecAndStatus CodecResult = VTexture->GetCodecForChunk(GraphCompletionEvents, ChunkIndex, Priority);
 	if (!VTRequestPageStatus_HasData(CodecResult.Status))
@@ -143,10 +165,47 @@ FVTRequestPageResult FVirtualTextureChunkStreamingManager::RequestTile(FUploadin
 	TranscodeParams.vLevel = vLevel;
 	TranscodeParams.LayerMask = LayerMask;
 	TranscodeParams.Codec = CodecResult.Codec;
-	TranscodeHandle = TranscodeCache.SubmitTask(UploadCache, TranscodeKey, TranscodeParams, &GraphCompletionEvents);
+	TranscodeParams.bPrefetch = bPrefetch;
+	const FVTTranscodeTileHandle TranscodeHandle = TranscodeCache.SubmitTask(UploadCache, TranscodeKey, TranscodeParams, &GraphCompletionEvents);
 	return FVTRequestPageResult(EVTRequestPageStatus::Pending, TranscodeHandle.PackedData);
 }
 
+void FVirtualTextureChunkStreamingManager::PrefetchFinerTiles(FUploadingVirtualTexture* VTexture, const FVirtualTextureProducerHandle& ProducerHandle, uint8 LayerMask, uint8 vLevel, uint32 vAddress)
+{
+	// The renderer requests the next finer mip as soon as the camera moves closer or a cut lands nearer to the surface,
+	// so the children of a requested tile are the most likely tiles to be requested next
+	if ((int32)vLevel <= VTexture->GetFirstMipOffset())
+	{
+		return;
+	}
+
+	const FVirtualTextureBuiltData* VTData = VTexture->GetVTData();
+	const uint8 ChildLevel = vLevel - 1u;
+	for (uint32 ChildIndex = 0u; ChildIndex < 4u; ++ChildIndex)
+	{
+		// Prefetches only use the staging memory left over by the renderer's own requests
+		if (TranscodeCache.GetNumPendingPrefetchTasks() >= (uint32)NumPrefetchTranscodeRequests ||
+			UploadCache.GetNumPendingTiles() >= (uint32)NumTranscodeRequests / 2u)
+		{
+			return;
+		}
+
+		// vAddress is morton encoded, the four children of a tile follow each other in the finer mip
+		const uint32 ChildAddress = (vAddress << 2) + ChildIndex;
+		const int32 ChildChunkIndex = VTData->GetChunkIndex(VTData->GetTileIndex(ChildLevel, ChildAddress));
+		if (ChildChunkIndex == -1)
+		{
+			continue;
+		}
+
+		const FVTTranscodeKey ChildKey = FVirtualTextureTranscodeCache::GetKey(ProducerHandle, LayerMask, ChildLevel, ChildAddress);
+		if (!TranscodeCache.FindTask(ChildKey).IsValid())
+		{
+			SubmitTranscode(VTexture, ChildKey, ChildChunkIndex, LayerMask, ChildLevel, ChildAddress, EVTRequestPagePriority::Normal, true);
+		}
+	}
+}
+
 IVirtualTextureFinalizer* FVirtualTextureChunkStreamingManager::ProduceTile(FRHICommandListImmediate& RHICmdList, uint32 SkipBorderSize, uint8 NumLayers, uint8 LayerMask, uint64 RequestHandle, const FVTProduceTargetLayer* TargetLayers)
 {
 	SCOPE_CYCLE_COUNTER(STAT_VTP_ProduceTile);
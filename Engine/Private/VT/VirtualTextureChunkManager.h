@@ -22,6 +22,8 @@ DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num generates"), STAT_VTP_NumGenerate, STAT
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num transcodes"), STAT_VTP_NumTranscode, STATGROUP_VTP);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num transcodes dropped"), STAT_VTP_NumTranscodeDropped, STATGROUP_VTP);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num transcodes retired"), STAT_VTP_NumTranscodeRetired, STATGROUP_VTP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num transcodes prefetched"), STAT_VTP_NumTranscodePrefetched, STATGROUP_VTP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num prefetched transcodes used"), STAT_VTP_NumTranscodePrefetchHits, STATGROUP_VTP);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Intraframe upload flushes"), STAT_VTP_NumIntraFrameFlush, STATGROUP_VTP);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num uploads"), STAT_VTP_NumUploads, STATGROUP_VTP);
 
@@ -47,6 +49,9 @@ public:
 	void WaitTasksFinished() const;
 
 private:
+	FVTRequestPageResult SubmitTranscode(FUploadingVirtualTexture* VTexture, const FVTTranscodeKey& TranscodeKey, int32 ChunkIndex, uint8 LayerMask, uint8 vLevel, uint32 vAddress, EVTRequestPagePriority Priority, bool bPrefetch);
+	void PrefetchFinerTiles(FUploadingVirtualTexture* VTexture, const FVirtualTextureProducerHandle& ProducerHandle, uint8 LayerMask, uint8 vLevel, uint32 vAddress);
+
 	FVirtualTextureUploadCache UploadCache;
 	FVirtualTextureTranscodeCache TranscodeCache;
 };
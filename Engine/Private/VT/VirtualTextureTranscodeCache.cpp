@@ -192,7 +192,7 @@ struct FTranscodeTask
 	}
 
 	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
-	ENamedThreads::Type GetDesiredThread() { return ENamedThreads::AnyNormalThreadNormalTask; }
+	ENamedThreads::Type GetDesiredThread() { return Params.bPrefetch ? ENamedThreads::AnyBackgroundThreadNormalTask : ENamedThreads::AnyNormalThreadNormalTask; }
 
 	FORCEINLINE TStatId GetStatId() const
 	{
@@ -201,6 +201,7 @@ struct FTranscodeTask
 };
 
 FVirtualTextureTranscodeCache::FVirtualTextureTranscodeCache()
+	: NumPendingPrefetchTasks(0u)
 {
 	Tasks.AddDefaulted(LIST_COUNT);
 	for (int i = 0; i < LIST_COUNT; ++i)
@@ -283,6 +284,13 @@ const FVTUploadTileHandle* FVirtualTextureTranscodeCache::AcquireTaskResult(FVTT
 	}
 	TaskEntry.GraphEvent.SafeRelease();
 
+	if (TaskEntry.bPrefetch)
+	{
+		INC_DWORD_STAT(STAT_VTP_NumTranscodePrefetchHits);
+		check(NumPendingPrefetchTasks > 0u);
+		--NumPendingPrefetchTasks;
+	}
+
 	RemoveFromList(TaskIndex);
 	AddToList(LIST_FREE, TaskIndex);
 
@@ -319,8 +327,15 @@ FVTTranscodeTileHandle FVirtualTextureTranscodeCache::SubmitTask(FVirtualTexture
 	TaskEntry.Key = InKey.Key;
 	TaskEntry.Hash = InKey.Hash;
 	TaskEntry.FrameSubmitted = GFrameNumberRenderThread;
+	TaskEntry.bPrefetch = InParams.bPrefetch;
 	FMemory::Memzero(TaskEntry.StageTileHandle);
 
+	if (InParams.bPrefetch)
+	{
+		INC_DWORD_STAT(STAT_VTP_NumTranscodePrefetched);
+		++NumPendingPrefetchTasks;
+	}
+
 	const uint32 TilePixelSize = InParams.VTData->GetPhysicalTileSize();
 	FVTUploadTileBuffer StagingBuffer[VIRTUALTEXTURE_SPACE_MAXLAYERS];
 	for (uint32 LayerIndex = 0u; LayerIndex < InParams.VTData->GetNumLayers(); ++LayerIndex)
@@ -362,6 +377,12 @@ void FVirtualTextureTranscodeCache::RetireOldTasks(FVirtualTextureUploadCache& I
 
 		INC_DWORD_STAT(STAT_VTP_NumTranscodeRetired);
 
+		if (TaskEntry.bPrefetch)
+		{
+			check(NumPendingPrefetchTasks > 0u);
+			--NumPendingPrefetchTasks;
+		}
+
 		++TaskEntry.Magic;
 		TaskEntry.GraphEvent.SafeRelease();
 
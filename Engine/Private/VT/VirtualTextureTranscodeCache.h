@@ -20,6 +20,8 @@ struct FVTTranscodeParams
 	uint32 vAddress;
 	uint8 vLevel;
 	uint8 LayerMask;
+	/** Transcode speculatively requested ahead of the renderer, runs at background priority */
+	bool bPrefetch;
 };
 
 union FVTTranscodeTileHandle
@@ -76,6 +78,9 @@ public:
 
 	void RetireOldTasks(FVirtualTextureUploadCache& InUploadCache);
 
+	/** Number of prefetched transcodes whose result hasn't been acquired or retired yet */
+	uint32 GetNumPendingPrefetchTasks() const { return NumPendingPrefetchTasks; }
+
 private:
 	enum ListType
 	{
@@ -95,6 +100,7 @@ private:
 		uint16 Hash;
 		int16 NextIndex;
 		int16 PrevIndex;
+		bool bPrefetch;
 	};
 
 	void RemoveFromList(int32 Index)
@@ -125,4 +131,5 @@ private:
 
 	TArray<FTaskEntry> Tasks;
 	FHashTable TileIDToTaskIndex;
+	uint32 NumPendingPrefetchTasks;
 };
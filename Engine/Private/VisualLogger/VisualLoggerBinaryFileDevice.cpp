@@ -4,11 +4,39 @@
 #include "Misc/Paths.h"
 #include "Misc/ConfigCacheIni.h"
 #include "VisualLogger/VisualLogger.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+#include "Serialization/MemoryWriter.h"
 
 #if ENABLE_VISUAL_LOG
 
+static int32 GVisualLoggerBinaryFileAsyncWrite = 1;
+static FAutoConsoleVariableRef CVarVisualLoggerBinaryFileAsyncWrite(
+	TEXT("vislog.BinaryFile.AsyncWrite"),
+	GVisualLoggerBinaryFileAsyncWrite,
+	TEXT("If 1, the binary vislog device serializes, compresses and writes recorded frames on a background thread instead of the game thread."),
+	ECVF_Default);
+
+static float GVisualLoggerBinaryFileRingBufferSeconds = 0.0f;
+static FAutoConsoleVariableRef CVarVisualLoggerBinaryFileRingBufferSeconds(
+	TEXT("vislog.BinaryFile.RingBufferSeconds"),
+	GVisualLoggerBinaryFileRingBufferSeconds,
+	TEXT("If above 0, recording to file only keeps the last seconds of logs in memory, written when recording stops or by vislog.BinaryFile.Dump.\n")
+	TEXT("Read when recording starts."),
+	ECVF_Default);
+
+static FAutoConsoleCommand CmdVisualLoggerBinaryFileDump(
+	TEXT("vislog.BinaryFile.Dump"),
+	TEXT("Writes the logs kept in memory by vislog.BinaryFile.RingBufferSeconds to a file without stopping the recording."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FVisualLoggerBinaryFileDevice::Get().DumpRingBuffer();
+	}));
+
 FVisualLoggerBinaryFileDevice::FVisualLoggerBinaryFileDevice()
-	: FileArchive(nullptr)
+	: bUseRingBuffer(false)
+	, RingBufferSeconds(0.0f)
+	, FileArchive(nullptr)
 {
 	Cleanup();
 
@@ -39,14 +67,21 @@ void FVisualLoggerBinaryFileDevice::StartRecordingToFile(float TimeStamp)
 	StartRecordingTime = TimeStamp;
 	LastLogTimeStamp = StartRecordingTime;
 	TempFileName = FVisualLoggerHelpers::GenerateTemporaryFilename(VISLOG_FILENAME_EXT);
-	
-	const FString FullFilename = FPaths::Combine(*FPaths::ProjectLogDir(), *TempFileName);
-	FileArchive = IFileManager::Get().CreateFileWriter(*FullFilename);
+
+	RingBufferSeconds = GVisualLoggerBinaryFileRingBufferSeconds;
+	bUseRingBuffer = RingBufferSeconds > 0.0f;
+
+	// In ring buffer mode the file is only created once the frames are saved
+	if (!bUseRingBuffer)
+	{
+		const FString FullFilename = FPaths::Combine(*FPaths::ProjectLogDir(), *TempFileName);
+		FileArchive = IFileManager::Get().CreateFileWriter(*FullFilename);
+	}
 }
 
 void FVisualLoggerBinaryFileDevice::StopRecordingToFile(float TimeStamp)
 {
-	if (FileArchive == nullptr)
+	if (FileArchive == nullptr && !bUseRingBuffer)
 	{
 		return;
 	}
@@ -54,16 +89,27 @@ void FVisualLoggerBinaryFileDevice::StopRecordingToFile(float TimeStamp)
 	const int32 NumEntries = FrameCache.Num();
 	if (NumEntries> 0)
 	{
-		FVisualLoggerHelpers::Serialize(*FileArchive, FrameCache);
-		FrameCache.Reset();
+		FlushFrameCache();
 	}
-
-	const int64 TotalSize = FileArchive->TotalSize();
-	FileArchive->Close();
-	delete FileArchive;
-	FileArchive = nullptr;
+	WaitForPendingWrites();
 
 	const FString TempFullFilename = FPaths::Combine(*FPaths::ProjectLogDir(), *TempFileName);
+
+	int64 TotalSize = 0;
+	if (bUseRingBuffer)
+	{
+		TotalSize = SaveFrames(RingBuffer, TempFullFilename);
+		RingBuffer.Empty();
+		bUseRingBuffer = false;
+	}
+	else
+	{
+		TotalSize = FileArchive->TotalSize();
+		FileArchive->Close();
+		delete FileArchive;
+		FileArchive = nullptr;
+	}
+
 	const FString NewFileName = FString::Printf(TEXT("%u_%s"), GetShortSessionID(), *FVisualLoggerHelpers::GenerateFilename(TempFileName, FileName, StartRecordingTime, LastLogTimeStamp));
 	const FString NewFullFileName = FPaths::Combine(*FPaths::ProjectLogDir(), *NewFileName);
 
@@ -83,6 +129,10 @@ void FVisualLoggerBinaryFileDevice::StopRecordingToFile(float TimeStamp)
 
 void FVisualLoggerBinaryFileDevice::DiscardRecordingToFile()
 {
+	WaitForPendingWrites();
+	RingBuffer.Empty();
+	bUseRingBuffer = false;
+
 	if (FileArchive)
 	{
 		FileArchive->Close();
@@ -102,13 +152,131 @@ void FVisualLoggerBinaryFileDevice::SetFileName(const FString& InFileName)
 void FVisualLoggerBinaryFileDevice::Serialize(const UObject* LogOwner, FName OwnerName, FName OwnerClassName, const FVisualLogEntry& LogEntry)
 {
 	const int32 NumEntries = FrameCache.Num();
-	if (NumEntries> 0 && LastLogTimeStamp + FrameCacheLenght <= LogEntry.TimeStamp && FileArchive)
+	if (NumEntries> 0 && LastLogTimeStamp + FrameCacheLenght <= LogEntry.TimeStamp && (FileArchive || bUseRingBuffer))
 	{
-		FVisualLoggerHelpers::Serialize(*FileArchive, FrameCache);
-		FrameCache.Reset();
+		FlushFrameCache();
 	}
 
 	LastLogTimeStamp = LogEntry.TimeStamp;
 	FrameCache.Add(FVisualLogEntryItem(OwnerName, OwnerClassName, LogEntry));
 }
+
+void FVisualLoggerBinaryFileDevice::FlushFrameCache()
+{
+	const float TimeStamp = LastLogTimeStamp;
+	if (!GVisualLoggerBinaryFileAsyncWrite)
+	{
+		WaitForPendingWrites();
+		WriteFrame(FrameCache, TimeStamp);
+		FrameCache.Reset();
+		return;
+	}
+
+	// The tasks share the file, each one waits for the previous one
+	FGraphEventArray Prerequisites;
+	if (LastWriteTask.IsValid())
+	{
+		Prerequisites.Add(LastWriteTask);
+	}
+
+	LastWriteTask = FFunctionGraphTask::CreateAndDispatchWhenReady([this, Entries = MoveTemp(FrameCache), TimeStamp]() mutable
+		{
+			WriteFrame(Entries, TimeStamp);
+		},
+		TStatId(), &Prerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+
+	FrameCache.Reset();
+}
+
+void FVisualLoggerBinaryFileDevice::WriteFrame(TArray<FVisualLogEntryItem>& Entries, float TimeStamp)
+{
+	FSerializedFrame Frame;
+	Frame.TimeStamp = TimeStamp;
+
+	FMemoryWriter Writer(Frame.Data);
+	if (bUseCompression)
+	{
+		FVisualLoggerHelpers::SerializeCompressed(Writer, Entries);
+	}
+	else
+	{
+		FVisualLoggerHelpers::Serialize(Writer, Entries);
+	}
+
+	if (bUseRingBuffer)
+	{
+		FScopeLock Lock(&RingBufferCS);
+
+		RingBuffer.Add(MoveTemp(Frame));
+
+		int32 NumExpiredFrames = 0;
+		while (NumExpiredFrames < RingBuffer.Num() - 1 && RingBuffer[NumExpiredFrames].TimeStamp < TimeStamp - RingBufferSeconds)
+		{
+			++NumExpiredFrames;
+		}
+		RingBuffer.RemoveAt(0, NumExpiredFrames, false);
+	}
+	else if (FileArchive)
+	{
+		FileArchive->Serialize(Frame.Data.GetData(), Frame.Data.Num());
+	}
+}
+
+void FVisualLoggerBinaryFileDevice::WaitForPendingWrites()
+{
+	if (LastWriteTask.IsValid())
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(LastWriteTask);
+		LastWriteTask = nullptr;
+	}
+}
+
+int64 FVisualLoggerBinaryFileDevice::SaveFrames(const TArray<FSerializedFrame>& Frames, const FString& TempFullFilename)
+{
+	FArchive* Archive = Frames.Num() > 0 ? IFileManager::Get().CreateFileWriter(*TempFullFilename) : nullptr;
+	if (Archive == nullptr)
+	{
+		return 0;
+	}
+
+	for (const FSerializedFrame& Frame : Frames)
+	{
+		Archive->Serialize(const_cast<uint8*>(Frame.Data.GetData()), Frame.Data.Num());
+	}
+
+	const int64 TotalSize = Archive->TotalSize();
+	Archive->Close();
+	delete Archive;
+	return TotalSize;
+}
+
+void FVisualLoggerBinaryFileDevice::DumpRingBuffer()
+{
+	if (!bUseRingBuffer)
+	{
+		UE_LOG(LogVisual, Warning, TEXT("Vislog isn't recording to a ring buffer, see vislog.BinaryFile.RingBufferSeconds"));
+		return;
+	}
+
+	// Frames are copied so recording goes on while the file is written
+	TArray<FSerializedFrame> Frames;
+	{
+		FScopeLock Lock(&RingBufferCS);
+		Frames = RingBuffer;
+	}
+
+	const float StartTime = Frames.Num() > 0 ? Frames[0].TimeStamp : LastLogTimeStamp;
+	const float EndTime = Frames.Num() > 0 ? Frames.Last().TimeStamp : LastLogTimeStamp;
+	const FString DumpTempFileName = FVisualLoggerHelpers::GenerateTemporaryFilename(VISLOG_FILENAME_EXT);
+	const FString DumpFileName = FString::Printf(TEXT("%u_%s"), GetShortSessionID(), *FVisualLoggerHelpers::GenerateFilename(DumpTempFileName, FileName, StartTime, EndTime));
+	const FString DumpFullFileName = FPaths::Combine(*FPaths::ProjectLogDir(), *DumpFileName);
+
+	Async(EAsyncExecution::ThreadPool, [Frames = MoveTemp(Frames), DumpFullFileName]()
+	{
+		if (SaveFrames(Frames, DumpFullFileName) > 0)
+		{
+			UE_LOG(LogVisual, Display, TEXT("Vislog ring buffer saved: %s"), *DumpFullFileName);
+		}
+	});
+}
 #endif
@@ -3,6 +3,9 @@
 #include "VisualLogger/VisualLoggerTypes.h"
 #include "Engine/World.h"
 #include "Misc/Paths.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "VisualLogger/VisualLoggerDebugSnapshotInterface.h"
 
 namespace
@@ -19,6 +22,7 @@ UVisualLoggerDebugSnapshotInterface::UVisualLoggerDebugSnapshotInterface(const F
 
 #define DEPRECATED_VISUAL_LOGGER_MAGIC_NUMBER 0xFAFAAFAF
 #define VISUAL_LOGGER_MAGIC_NUMBER 0xAFAFFAFA
+#define COMPRESSED_VISUAL_LOGGER_MAGIC_NUMBER 0xAFAFFAFB
 
 //----------------------------------------------------------------------//
 // FVisualLogShapeElement 
@@ -529,11 +533,36 @@ FArchive& FVisualLoggerHelpers::Serialize(FArchive& Ar, TArray<FVisualLogDevice:
 		{
 			int32 FrameTag = VISUAL_LOGGER_MAGIC_NUMBER;
 			Ar << FrameTag;
-			if (FrameTag != DEPRECATED_VISUAL_LOGGER_MAGIC_NUMBER && FrameTag != VISUAL_LOGGER_MAGIC_NUMBER)
+			if (FrameTag != DEPRECATED_VISUAL_LOGGER_MAGIC_NUMBER && FrameTag != VISUAL_LOGGER_MAGIC_NUMBER && FrameTag != COMPRESSED_VISUAL_LOGGER_MAGIC_NUMBER)
 			{
 				break;
 			}
 
+			if (FrameTag == COMPRESSED_VISUAL_LOGGER_MAGIC_NUMBER)
+			{
+				int32 ArchiveVer = -1;
+				int32 UncompressedSize = 0;
+				TArray<uint8> CompressedData;
+				Ar << ArchiveVer;
+				Ar << UncompressedSize;
+				Ar << CompressedData;
+				check(ArchiveVer >= EVisualLoggerVersion::Initial);
+
+				TArray<uint8> UncompressedData;
+				UncompressedData.SetNumUninitialized(UncompressedSize);
+				if (Ar.IsError() || !FCompression::UncompressMemory(NAME_Zlib, UncompressedData.GetData(), UncompressedSize, CompressedData.GetData(), CompressedData.Num()))
+				{
+					break;
+				}
+
+				FMemoryReader Reader(UncompressedData);
+				Reader.SetCustomVersion(EVisualLoggerVersion::GUID, ArchiveVer, TEXT("VisualLogger"));
+				Reader << CurrentFrame;
+				RecordedLogs.Append(CurrentFrame);
+				CurrentFrame.Reset();
+				continue;
+			}
+
 			if (FrameTag == DEPRECATED_VISUAL_LOGGER_MAGIC_NUMBER)
 			{
 				Ar.SetCustomVersion(EVisualLoggerVersion::GUID, EVisualLoggerVersion::Initial, TEXT("VisualLogger"));
@@ -567,6 +596,32 @@ FArchive& FVisualLoggerHelpers::Serialize(FArchive& Ar, TArray<FVisualLogDevice:
 	return Ar;
 }
 
+FArchive& FVisualLoggerHelpers::SerializeCompressed(FArchive& Ar, TArray<FVisualLogDevice::FVisualLogEntryItem>& RecordedLogs)
+{
+	check(Ar.IsSaving());
+
+	TArray<uint8> UncompressedData;
+	FMemoryWriter Writer(UncompressedData);
+	Writer.UsingCustomVersion(EVisualLoggerVersion::GUID);
+	Writer << RecordedLogs;
+
+	int32 UncompressedSize = UncompressedData.Num();
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize);
+	TArray<uint8> CompressedData;
+	CompressedData.SetNumUninitialized(CompressedSize);
+	verify(FCompression::CompressMemory(NAME_Zlib, CompressedData.GetData(), CompressedSize, UncompressedData.GetData(), UncompressedSize));
+	CompressedData.SetNum(CompressedSize, false);
+
+	int32 FrameTag = COMPRESSED_VISUAL_LOGGER_MAGIC_NUMBER;
+	int32 ArchiveVer = Writer.CustomVer(EVisualLoggerVersion::GUID);
+	Ar << FrameTag;
+	Ar << ArchiveVer;
+	Ar << UncompressedSize;
+	Ar << CompressedData;
+
+	return Ar;
+}
+
 void FVisualLoggerHelpers::GetCategories(const FVisualLogEntry& EntryItem, TArray<FVisualLoggerCategoryVerbosityPair>& OutCategories)
 {
 	for (const auto& Element : EntryItem.Events)
@@ -78,6 +78,7 @@
 #include "Components/ModelComponent.h"
 #include "GlobalShader.h"
 #include "ShaderCompiler.h"
+#include "Engine/ActorRegistrySubsystem.h"
 #include "Engine/LevelScriptBlueprint.h"
 #include "Engine/DemoNetDriver.h"
 #include "Modules/ModuleManager.h"
@@ -121,6 +122,7 @@
 #include "Net/PerfCountersHelpers.h"
 #include "InGamePerformanceTracker.h"
 #include "Engine/AssetManager.h"
+#include "AssetRegistryModule.h"
 #include "Engine/HLODProxy.h"
 #include "ProfilingDebugging/CsvProfiler.h"
 #include "ObjectTrace.h"
@@ -1787,6 +1789,11 @@ void UWorld::RemoveActor(AActor* Actor, bool bShouldModifyLevel) const
 		CheckLevel->Actors[ActorListIndex] = nullptr;
 	}
 
+	if (UActorRegistrySubsystem* ActorRegistry = GetSubsystem<UActorRegistrySubsystem>())
+	{
+		ActorRegistry->RemoveActor(Actor);
+	}
+
 	// Remove actor from network list
 	RemoveNetworkActor( Actor );
 }
@@ -2299,6 +2306,18 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 
 		// Add to the UWorld's array of levels, which causes it to be rendered et al.
 		Levels.AddUnique( Level );
+
+		// Prepare navigation data chunks on workers while the rest of the level is made visible, they're attached once it's added to the world.
+		if (bConsiderTimeLimit && GLevelStreamingAsyncPrepareNavigationData)
+		{
+			FNavigationSystem::BeginPrepareNavigationDataChunks(*Level);
+		}
+
+		// Actors of an associating level are visible to actor queries, e.g. from their own BeginPlay
+		if (UActorRegistrySubsystem* ActorRegistry = GetSubsystem<UActorRegistrySubsystem>())
+		{
+			ActorRegistry->AddLevelActors(Level);
+		}
 		
 #if PERF_TRACK_DETAILED_ASYNC_STATS
 		MoveActorTime = 0.0;
@@ -2416,19 +2435,61 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 			bRerunConstructionScript = !(IsGameWorld() && (Level->bHasRerunConstructionScripts || !bRerunConstructionDuringEditorStreaming));
 		}
 		
+		// Leave physics state to its own time-sliced step below. Once set this stays set until that step has run, even if the time limit stops applying.
+		if (bConsiderTimeLimit && GLevelStreamingDeferPhysicsStateCreation)
+		{
+			Level->bDeferComponentPhysicsState = true;
+		}
+
+		// Collect render proxies and add them to the scene in one batch at the end of this frame's slice.
+		TOptional<FRegisterComponentContext> RegisterContext;
+		if (bConsiderTimeLimit && GLevelStreamingBatchRenderStateCreation)
+		{
+			RegisterContext.Emplace(this);
+		}
+
 		// Incrementally update components.
 		int32 NumComponentsToUpdate = (!bConsiderTimeLimit || !IsGameWorld() || IsRunningCommandlet() ? 0 : GLevelStreamingComponentsRegistrationGranularity);
 		do
 		{
-			Level->IncrementalUpdateComponents( NumComponentsToUpdate, bRerunConstructionScript );
+			Level->IncrementalUpdateComponents( NumComponentsToUpdate, bRerunConstructionScript, RegisterContext.GetPtrOrNull() );
 		}
 		while (!Level->bAreComponentsCurrentlyRegistered && !IsTimeLimitExceeded(TEXT("updating components"), StartTime, Level, TimeLimit));
 
+		if (RegisterContext.IsSet())
+		{
+			RegisterContext->Process();
+		}
+
 		// We are done once all components are attached.
 		Level->bAlreadyUpdatedComponents	= Level->bAreComponentsCurrentlyRegistered;
 		bExecuteNextStep					= Level->bAreComponentsCurrentlyRegistered && (!bConsiderTimeLimit || !IsTimeLimitExceeded(TEXT("updating components"), StartTime, Level, TimeLimit));
 	}
 
+	// Create the physics state skipped during component registration, with its own time budget.
+	if( bExecuteNextStep && Level->bDeferComponentPhysicsState )
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_AddToWorldTime_CreatePhysicsState);
+		SCOPE_TIME_TO_VAR(&InitActorPhysTime);
+
+		const double StepStartTime = FPlatformTime::Seconds();
+		const double StepTimeLimit = (GLevelStreamingPhysicsStateTimeLimit > 0.f ? FMath::Min<double>(GLevelStreamingPhysicsStateTimeLimit, TimeLimit) : TimeLimit);
+		bool bCreatedPhysicsState = false;
+		do
+		{
+			bCreatedPhysicsState = Level->IncrementalCreatePhysicsState();
+		}
+		while (!bCreatedPhysicsState && (!bConsiderTimeLimit || !IsTimeLimitExceeded(TEXT("creating physics state"), StepStartTime, Level, StepTimeLimit)));
+
+		bExecuteNextStep = bCreatedPhysicsState && (!bConsiderTimeLimit || !IsTimeLimitExceeded(TEXT("creating physics state"), StartTime, Level, TimeLimit));
+	}
+
+	// Don't go on until the navigation data chunks are prepared, checked again next frame within the time limit.
+	if( bExecuteNextStep )
+	{
+		bExecuteNextStep = FNavigationSystem::AreNavigationDataChunksPrepared(*Level, /*bWait=*/!bConsiderTimeLimit);
+	}
+
 	if( IsGameWorld() && AreActorsInitialized() )
 	{
 		// Initialize all actors and start execution.
@@ -2459,6 +2520,13 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 		{
 			QUICK_SCOPE_CYCLE_COUNTER(STAT_AddToWorldTime_RouteActorInitialize);
 			SCOPE_TIME_TO_VAR(&RouteActorInitializeTime);
+
+			// Leave initial overlaps to their own time-sliced step below
+			if (bConsiderTimeLimit && GLevelStreamingDeferInitialOverlaps)
+			{
+				Level->bDeferInitialOverlaps = true;
+			}
+
 			bStartup = 1;
 			Level->RouteActorInitialize();
 			Level->bAlreadyRoutedActorInitialize = true;
@@ -2467,6 +2535,24 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 			bExecuteNextStep = (!bConsiderTimeLimit || !IsTimeLimitExceeded( TEXT("routing Initialize on actors"), StartTime, Level, TimeLimit ));
 		}
 
+		// Update the initial overlaps skipped by actors beginning play, with their own time budget.
+		if( bExecuteNextStep && Level->bDeferInitialOverlaps )
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_AddToWorldTime_UpdateInitialOverlaps);
+			SCOPE_TIME_TO_VAR(&RouteActorInitializeTime);
+
+			const double StepStartTime = FPlatformTime::Seconds();
+			const double StepTimeLimit = (GLevelStreamingInitialOverlapsTimeLimit > 0.f ? FMath::Min<double>(GLevelStreamingInitialOverlapsTimeLimit, TimeLimit) : TimeLimit);
+			bool bUpdatedInitialOverlaps = false;
+			do
+			{
+				bUpdatedInitialOverlaps = Level->IncrementalUpdateInitialOverlaps();
+			}
+			while (!bUpdatedInitialOverlaps && (!bConsiderTimeLimit || !IsTimeLimitExceeded(TEXT("updating initial overlaps"), StepStartTime, Level, StepTimeLimit)));
+
+			bExecuteNextStep = bUpdatedInitialOverlaps && (!bConsiderTimeLimit || !IsTimeLimitExceeded(TEXT("updating initial overlaps"), StartTime, Level, TimeLimit));
+		}
+
 		// Sort the actor list; can't do this on save as the relevant properties for sorting might have been changed by code
 		if( bExecuteNextStep && !Level->bAlreadySortedActorList )
 		{
@@ -4165,6 +4251,14 @@ void UWorld::InitializeActorsForPlay(const FURL& InURL, bool bResetTime, FRegist
 
 	CheckTextureStreamingBuildValidity(this);
 
+	if (IsGameWorld())
+	{
+		if (AWorldSettings* WorldSettings = GetWorldSettings())
+		{
+			PSCPool.PrewarmPools(this, WorldSettings->ParticleSystemPoolPrewarm);
+		}
+	}
+
 	if(IsPreviewWorld())
 	{
 		UE_LOG(LogWorld, Verbose, TEXT("Bringing up preview level for play took: %f"), FPlatformTime::Seconds() - StartTime );
@@ -4345,6 +4439,7 @@ void UWorld::CleanupWorldInternal(bool bSessionEnded, bool bCleanupResources, UW
 	}
 
 	PSCPool.Cleanup();
+	ActorPool.Cleanup();
 
 	FWorldDelegates::OnPostWorldCleanup.Broadcast(this, bSessionEnded, bCleanupResources);
 
@@ -4515,6 +4610,15 @@ FConstCameraActorIterator UWorld::GetAutoActivateCameraIterator() const
 	return (const FConstCameraActorIterator&)Result;
 }
 
+FStaticCollisionStore& UWorld::GetOrCreateStaticCollisionStore()
+{
+	if (!StaticCollisionStore.IsValid())
+	{
+		StaticCollisionStore = MakeUnique<FStaticCollisionStore>();
+	}
+	return *StaticCollisionStore;
+}
+
 
 void UWorld::AddNetworkActor(AActor* Actor)
 {
@@ -5649,6 +5753,81 @@ void UWorld::GetMatineeActors(TArray<class AMatineeActor*>& OutMatineeActors)
 	Seamless world traveling
 -----------------------------------------------------------------------------*/
 
+static int32 GRetainReferencedAssets = 0;
+static FAutoConsoleVariableRef CVarRetainReferencedAssets(
+	TEXT("travel.RetainReferencedAssets"),
+	GRetainReferencedAssets,
+	TEXT("If non-zero, LoadMap and seamless travel keep the loaded assets the destination map depends on alive while the old world is torn down, instead of unloading and loading them again."),
+	ECVF_Default);
+
+bool FWorldTransitionAssetRetainer::IsEnabled()
+{
+	return GRetainReferencedAssets != 0;
+}
+
+int32 FWorldTransitionAssetRetainer::Retain(const FString& MapPackageName)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_WorldTransitionAssetRetainer_Retain);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+
+	TSet<FName> VisitedPackages;
+	TArray<FName> PackagesToVisit;
+	PackagesToVisit.Add(FName(*MapPackageName));
+	VisitedPackages.Add(PackagesToVisit[0]);
+
+	int32 NumRetainedPackages = 0;
+	TArray<FName> Dependencies;
+	while (PackagesToVisit.Num() > 0)
+	{
+		const FName PackageName = PackagesToVisit.Pop(false);
+
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(PackageName, Dependencies, EAssetRegistryDependencyType::Hard);
+		for (const FName& Dependency : Dependencies)
+		{
+			bool bAlreadyVisited = false;
+			VisitedPackages.Add(Dependency, &bAlreadyVisited);
+			if (!bAlreadyVisited)
+			{
+				PackagesToVisit.Add(Dependency);
+			}
+		}
+
+		// Worlds, including sublevels shared with the old map, must still be torn down
+		UPackage* Package = FindObjectFast<UPackage>(nullptr, PackageName);
+		if (Package == nullptr || Package->HasAnyPackageFlags(PKG_ContainsMap | PKG_PlayInEditor) || UWorld::FindWorldInPackage(Package) != nullptr)
+		{
+			continue;
+		}
+
+		// Private objects are kept through the references of the public ones
+		const int32 NumObjectsBefore = RetainedObjects.Num();
+		ForEachObjectWithOuter(Package, [this](UObject* Object)
+		{
+			if (Object->HasAnyFlags(RF_Public) && !Object->IsPendingKill())
+			{
+				RetainedObjects.Add(Object);
+			}
+		}, /*bIncludeNestedObjects=*/ false);
+
+		NumRetainedPackages += RetainedObjects.Num() > NumObjectsBefore ? 1 : 0;
+	}
+
+	UE_LOG(LogWorld, Log, TEXT("Retaining %d objects from %d loaded packages %s depends on"), RetainedObjects.Num(), NumRetainedPackages, *MapPackageName);
+	return NumRetainedPackages;
+}
+
+void FWorldTransitionAssetRetainer::Release()
+{
+	RetainedObjects.Empty();
+}
+
+void FWorldTransitionAssetRetainer::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(RetainedObjects);
+}
+
 void FSeamlessTravelHandler::SetHandlerLoadedData(UObject* InLevelPackage, UWorld* InLoadedWorld)
 {
 	LoadedPackage = InLevelPackage;
@@ -5783,6 +5962,13 @@ bool FSeamlessTravelHandler::StartTravel(UWorld* InCurrentWorld, const FURL& InU
 			bPauseAtMidpoint = false;
 			bNeedCancelCleanUp = false;
 
+			// Keep what the destination shares with the current map through the transition map's garbage collection
+			if (FWorldTransitionAssetRetainer::IsEnabled())
+			{
+				RetainedAssets = MakeShared<FWorldTransitionAssetRetainer>();
+				RetainedAssets->Retain(PendingTravelURL.Map);
+			}
+
 			FName CurrentMapName = CurrentWorld->GetOutermost()->GetFName();
 			FName DestinationMapName = FName(*PendingTravelURL.Map);
 
@@ -5860,6 +6046,7 @@ bool FSeamlessTravelHandler::StartTravel(UWorld* InCurrentWorld, const FURL& InU
 /** cancels transition in progress */
 void FSeamlessTravelHandler::CancelTravel()
 {
+	RetainedAssets.Reset();
 	LoadedPackage = NULL;
 	if (LoadedWorld != NULL)
 	{
@@ -6438,6 +6625,9 @@ UWorld* FSeamlessTravelHandler::Tick()
 				// allows for chaining of maps.
 
 				bTransitionInProgress = false;
+
+				// The destination holds its own references now
+				RetainedAssets.Reset();
 				
 				double TotalSeamlessTravelTime = FPlatformTime::Seconds() - SeamlessTravelStartTime;
 				UE_LOG(LogWorld, Log, TEXT("----SeamlessTravel finished in %.2f seconds ------"), TotalSeamlessTravelTime );
@@ -0,0 +1,193 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WorldActorPool.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Interfaces/PoolableActorInterface.h"
+#include "TimerManager.h"
+
+static int32 GActorPoolMaxPerTemplate = 32;
+static FAutoConsoleVariableRef CVarActorPoolMaxPerTemplate(
+	TEXT("world.ActorPool.MaxPerTemplate"),
+	GActorPoolMaxPerTemplate,
+	TEXT("Maximum number of free actors the world keeps around for each pooled actor template. Destroying more than this destroys them normally. 0 disables actor pooling.")
+);
+
+UPoolableActorInterface::UPoolableActorInterface(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+FWorldActorPool::FWorldActorPool()
+{
+}
+
+AActor* FWorldActorPool::Acquire(AActor* Template, ULevel* Level, const FTransform& SpawnTransform, const FActorSpawnParameters& SpawnParameters)
+{
+	check(Template);
+
+	TArray<TWeakObjectPtr<AActor>>* Free = FreeActors.Find(Template);
+	if (!Free)
+	{
+		return nullptr;
+	}
+
+	for (int32 Index = Free->Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Actor = (*Free)[Index].Get();
+		if (!Actor || Actor->IsPendingKillPending())
+		{
+			// Destroyed for real or collected along with its level while it was pooled
+			PooledActors.Remove((*Free)[Index]);
+			Free->RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		if (Actor->GetLevel() != Level)
+		{
+			continue;
+		}
+
+		Free->RemoveAtSwap(Index, 1, false);
+		PooledActors.Remove(Actor);
+
+		// Place the root the same way a fresh spawn does, with the template root's relative transform applied on top of the spawn transform
+		USceneComponent* const TemplateRootComponent = Template->GetRootComponent();
+		const FTransform RootTransform = TemplateRootComponent
+			? FTransform(TemplateRootComponent->GetRelativeRotation(), TemplateRootComponent->GetRelativeLocation(), TemplateRootComponent->GetRelativeScale3D()) * SpawnTransform
+			: SpawnTransform;
+
+		if (USceneComponent* RootComponent = Actor->GetRootComponent())
+		{
+			RootComponent->SetWorldTransform(RootTransform, false, nullptr, ETeleportType::ResetPhysics);
+		}
+
+		Actor->SetOwner(SpawnParameters.Owner);
+		Actor->SetInstigator(SpawnParameters.Instigator);
+
+		Actor->SetActorHiddenInGame(Template->IsHidden());
+		Actor->SetActorEnableCollision(Template->GetActorEnableCollision());
+		Actor->SetActorTickEnabled(Template->PrimaryActorTick.bStartWithTickEnabled);
+
+		TInlineComponentArray<UActorComponent*> Components(Actor);
+		for (UActorComponent* Component : Components)
+		{
+			Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+		}
+
+		CastChecked<IPoolableActorInterface>(Actor)->OnTakenFromPool();
+
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+bool FWorldActorPool::Reclaim(AActor* Actor)
+{
+	check(Actor);
+
+	if (GActorPoolMaxPerTemplate <= 0)
+	{
+		return false;
+	}
+
+	if (PooledActors.Contains(Actor))
+	{
+		// Already out of play
+		return true;
+	}
+
+	IPoolableActorInterface* const PoolableActor = Cast<IPoolableActorInterface>(Actor);
+	if (!PoolableActor || !PoolableActor->CanReturnToPool())
+	{
+		return false;
+	}
+
+	UWorld* const World = Actor->GetWorld();
+	if (!World || World->bIsTearingDown || !World->IsGameWorld() || !Actor->HasActorBegunPlay())
+	{
+		return false;
+	}
+
+	// A pooled replicated actor would stay open on every client, so those go through the normal destroy path in networked games
+	if (Actor->GetIsReplicated() && World->GetNetMode() != NM_Standalone)
+	{
+		return false;
+	}
+
+	AActor* const Template = CastChecked<AActor>(Actor->GetArchetype());
+	TArray<TWeakObjectPtr<AActor>>& Free = FreeActors.FindOrAdd(Template);
+	if (Free.Num() >= GActorPoolMaxPerTemplate)
+	{
+		return false;
+	}
+
+	PoolableActor->OnReturnedToPool();
+
+	// Take the actor out of play, leaving its components registered
+	TArray<AActor*> AttachedActors;
+	Actor->GetAttachedActors(AttachedActors);
+	for (AActor* AttachedActor : AttachedActors)
+	{
+		AttachedActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	}
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	Actor->SetOwner(nullptr);
+	World->GetTimerManager().ClearAllTimersForObject(Actor);
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->ClearComponentOverlaps();
+	Actor->SetActorTickEnabled(false);
+
+	TInlineComponentArray<UActorComponent*> Components(Actor);
+	for (UActorComponent* Component : Components)
+	{
+		Component->SetComponentTickEnabled(false);
+	}
+
+	Free.Add(Actor);
+	PooledActors.Add(Actor);
+
+	return true;
+}
+
+bool FWorldActorPool::IsPooled(const AActor* Actor) const
+{
+	return PooledActors.Contains(TWeakObjectPtr<AActor>(const_cast<AActor*>(Actor)));
+}
+
+void FWorldActorPool::Cleanup()
+{
+	FreeActors.Empty();
+	PooledActors.Empty();
+}
+
+void FWorldActorPool::Dump() const
+{
+	UE_LOG(LogSpawn, Log, TEXT("------- %d Pooled Actors -------"), PooledActors.Num());
+	for (const TPair<TObjectKey<AActor>, TArray<TWeakObjectPtr<AActor>>>& Pair : FreeActors)
+	{
+		const AActor* Template = Pair.Key.ResolveObjectPtr();
+		UE_LOG(LogSpawn, Log, TEXT("%s: %d free"), Template ? *Template->GetPathName() : TEXT("<collected template>"), Pair.Value.Num());
+	}
+}
+
+static void OnDumpActorPool(UWorld* World)
+{
+	if (World != nullptr)
+	{
+		World->GetActorPool().Dump();
+	}
+}
+
+FAutoConsoleCommandWithWorld DumpActorPoolConsoleCommand(
+	TEXT("world.ActorPool.Dump"),
+	TEXT("Dumps the number of free pooled actors per template for the current world."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(OnDumpActorPool)
+	);
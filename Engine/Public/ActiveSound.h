@@ -6,6 +6,7 @@
 #include "WorldCollision.h"
 #include "Sound/SoundAttenuation.h"
 #include "HAL/ThreadSafeBool.h"
+#include "HAL/CriticalSection.h"
 #include "Audio.h"
 #include "Audio/AudioDebug.h"
 #include "AudioDynamicParameter.h"
@@ -512,6 +513,13 @@ public:
 	/** Last time we checked for occlusion */
 	float LastOcclusionCheckTime;
 
+	/** Last time an occlusion trace was issued, checks in between may reuse its result */
+	float LastOcclusionTraceTime;
+
+	/** Sound and listener locations of the last occlusion trace */
+	FVector LastOcclusionSoundLocation;
+	FVector LastOcclusionListenerLocation;
+
 	/** The max distance this sound will be audible. */
 	float MaxDistance;
 
@@ -661,6 +669,9 @@ public:
 	/** Delegate callback function when an async occlusion trace completes */
 	static void OcclusionTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
 
+	/** Issues the occlusion traces requested by active sounds since the last flush, with a single game thread command. Called once per audio device update. */
+	static void FlushOcclusionTraces();
+
 	/** Applies the active sound's attenuation settings to the input parse params using the given listener */
 	UE_DEPRECATED(4.25, "Use ParseAttenuation that passes a ListenerIndex instead")
 	void ParseAttenuation(FSoundParseParameters& OutParseParams, const FListener& InListener, const FSoundAttenuationSettings& InAttenuationSettings);
@@ -695,7 +706,24 @@ private:
 		FActiveSound* ActiveSound;
 	};
 
-	static TMap<FTraceHandle, FAsyncTraceDetails> TraceToActiveSoundMap;
+	/** An occlusion trace requested by an active sound, queued until the next FlushOcclusionTraces */
+	struct FOcclusionTraceRequest
+	{
+		TWeakObjectPtr<UWorld> World;
+		FVector SoundLocation;
+		FVector ListenerLocation;
+		ECollisionChannel TraceChannel;
+		FSoundOwnerObjectID OwnerID;
+		bool bUseComplexCollision;
+		FAsyncTraceDetails TraceDetails;
+	};
+
+	/** Active sounds waiting on each async trace, sounds close enough to each other share a trace */
+	static TMap<FTraceHandle, TArray<FAsyncTraceDetails>> TraceToActiveSoundMap;
+
+	/** Requests may be queued by wave instance gather workers, see au.ParallelGatherWaveInstances */
+	static TArray<FOcclusionTraceRequest> PendingOcclusionTraces;
+	static FCriticalSection PendingOcclusionTracesCritSec;
 
 	static FTraceDelegate ActiveSoundTraceDelegate;
 
@@ -314,14 +314,21 @@ struct FBaseBlendedCurve
 	/** Initialize Curve Data from following data */
 	void InitFrom(const FBoneContainer& RequiredBones)
 	{
-		InitFrom(&RequiredBones.GetUIDToArrayLookupTable());
+		// The container counted its curves when it built the look up table
+		InitFrom(&RequiredBones.GetUIDToArrayLookupTable(), RequiredBones.GetUIDToArrayLookupTableValidCount());
 	}
 
 	void InitFrom(TArray<uint16> const * InUIDToArrayIndexLUT)
+	{
+		InitFrom(InUIDToArrayIndexLUT, GetValidElementCount(InUIDToArrayIndexLUT));
+	}
+
+	void InitFrom(TArray<uint16> const * InUIDToArrayIndexLUT, int32 InNumValidCurveCount)
 	{
 		check(InUIDToArrayIndexLUT != nullptr);
+		checkSlow(InNumValidCurveCount == GetValidElementCount(InUIDToArrayIndexLUT));
 		UIDToArrayIndexLUT = InUIDToArrayIndexLUT;
-		NumValidCurveCount = GetValidElementCount(UIDToArrayIndexLUT);
+		NumValidCurveCount = InNumValidCurveCount;
 		Elements.Reset();
 		Elements.AddZeroed(NumValidCurveCount);
 		// no name, means no curve
@@ -334,7 +341,7 @@ struct FBaseBlendedCurve
 		// make sure this doesn't happen
 		check(InCurveToInitFrom.UIDToArrayIndexLUT != nullptr);
 		UIDToArrayIndexLUT = InCurveToInitFrom.UIDToArrayIndexLUT;
-		NumValidCurveCount = GetValidElementCount(UIDToArrayIndexLUT);
+		NumValidCurveCount = GetValidElementCount(InCurveToInitFrom);
 
 		Elements.Reset();
 		Elements.AddZeroed(NumValidCurveCount);
@@ -348,7 +355,7 @@ struct FBaseBlendedCurve
 		{
 			check(InCurveToInitFrom.UIDToArrayIndexLUT != nullptr);
 			UIDToArrayIndexLUT = InCurveToInitFrom.UIDToArrayIndexLUT;
-			NumValidCurveCount = GetValidElementCount(UIDToArrayIndexLUT);
+			NumValidCurveCount = GetValidElementCount(InCurveToInitFrom);
 			Elements.Reset();
 			Elements.AddZeroed(NumValidCurveCount);
 			bInitialized = true;
@@ -417,7 +424,15 @@ struct FBaseBlendedCurve
 		}
 
 		return Count;
-	}	
+	}
+
+	/** Get Valid Element Count of the look up table of another curve. A valid curve already counted it, the table isn't scanned again. */
+	template <typename OtherAllocator>
+	static int32 GetValidElementCount(const FBaseBlendedCurve<OtherAllocator>& InCurve)
+	{
+		return InCurve.IsValid() ? InCurve.NumValidCurveCount : GetValidElementCount(InCurve.UIDToArrayIndexLUT);
+	}
+
 	/**
 	 * Blend (A, B) using Alpha, same as Lerp
 	 */
@@ -438,10 +453,15 @@ struct FBaseBlendedCurve
 		else
 		{
 			InitFrom(A);
-			for (int32 CurveId = 0; CurveId < A.Elements.Num(); ++CurveId)
+
+			// Plain pointers and no early branches so the loops vectorize, poses with many curves spend most of their curve time here
+			FCurveElement* RESTRICT Dest = Elements.GetData();
+			const FCurveElement* RESTRICT ElementsA = A.Elements.GetData();
+			const FCurveElement* RESTRICT ElementsB = B.Elements.GetData();
+			for (int32 CurveId = 0, NumCurves = A.Elements.Num(); CurveId < NumCurves; ++CurveId)
 			{
-				Elements[CurveId].bValid = A.Elements[CurveId].bValid || B.Elements[CurveId].bValid;
-				Elements[CurveId].Value = FMath::Lerp(A.Elements[CurveId].Value, B.Elements[CurveId].Value, Alpha);
+				Dest[CurveId].bValid = ElementsA[CurveId].bValid | ElementsB[CurveId].bValid;
+				Dest[CurveId].Value = FMath::Lerp(ElementsA[CurveId].Value, ElementsB[CurveId].Value, Alpha);
 			}
 		}
 	}
@@ -463,10 +483,12 @@ struct FBaseBlendedCurve
 		}
 		else
 		{
-			for (int32 CurveId = 0; CurveId < Elements.Num(); ++CurveId)
+			FCurveElement* RESTRICT Dest = Elements.GetData();
+			const FCurveElement* RESTRICT Source = Other.Elements.GetData();
+			for (int32 CurveId = 0, NumCurves = Elements.Num(); CurveId < NumCurves; ++CurveId)
 			{
-				Elements[CurveId].bValid = Elements[CurveId].bValid || Other.Elements[CurveId].bValid;
-				Elements[CurveId].Value = FMath::Lerp(Elements[CurveId].Value, Other.Elements[CurveId].Value, Alpha);
+				Dest[CurveId].bValid |= Source[CurveId].bValid;
+				Dest[CurveId].Value = FMath::Lerp(Dest[CurveId].Value, Source[CurveId].Value, Alpha);
 			}
 		}
 	}
@@ -478,10 +500,12 @@ struct FBaseBlendedCurve
 		check(bInitialized);
 		check(Num() == BaseCurve.Num());
 
-		for (int32 CurveId = 0; CurveId < Elements.Num(); ++CurveId)
+		FCurveElement* RESTRICT Dest = Elements.GetData();
+		const FCurveElement* RESTRICT Base = BaseCurve.Elements.GetData();
+		for (int32 CurveId = 0, NumCurves = Elements.Num(); CurveId < NumCurves; ++CurveId)
 		{
-			Elements[CurveId].bValid = Elements[CurveId].bValid || BaseCurve.Elements[CurveId].bValid;
-			Elements[CurveId].Value -= BaseCurve.Elements[CurveId].Value;
+			Dest[CurveId].bValid |= Base[CurveId].bValid;
+			Dest[CurveId].Value -= Base[CurveId].Value;
 		}
 	}
 	/**
@@ -494,10 +518,12 @@ struct FBaseBlendedCurve
 
 		if (FAnimWeight::IsRelevant(Weight))
 		{
-			for (int32 CurveId = 0; CurveId < Elements.Num(); ++CurveId)
+			FCurveElement* RESTRICT Dest = Elements.GetData();
+			const FCurveElement* RESTRICT Additive = AdditiveCurve.Elements.GetData();
+			for (int32 CurveId = 0, NumCurves = Elements.Num(); CurveId < NumCurves; ++CurveId)
 			{
-				Elements[CurveId].bValid = Elements[CurveId].bValid || AdditiveCurve.Elements[CurveId].bValid;
-				Elements[CurveId].Value += AdditiveCurve.Elements[CurveId].Value * Weight;
+				Dest[CurveId].bValid |= Additive[CurveId].bValid;
+				Dest[CurveId].Value += Additive[CurveId].Value * Weight;
 			}
 		}
 	}
@@ -596,10 +622,12 @@ struct FBaseBlendedCurve
 		}
 		else
 		{
-			for (int32 CurveId = 0; CurveId < CurveToOverrideFrom.Elements.Num(); ++CurveId)
+			FCurveElement* RESTRICT Dest = Elements.GetData();
+			const FCurveElement* RESTRICT Source = CurveToOverrideFrom.Elements.GetData();
+			for (int32 CurveId = 0, NumCurves = CurveToOverrideFrom.Elements.Num(); CurveId < NumCurves; ++CurveId)
 			{
-				Elements[CurveId].bValid = CurveToOverrideFrom.Elements[CurveId].bValid;
-				Elements[CurveId].Value = CurveToOverrideFrom.Elements[CurveId].Value * Weight;
+				Dest[CurveId].bValid = Source[CurveId].bValid;
+				Dest[CurveId].Value = Source[CurveId].Value * Weight;
 			}
 		}
 	}
@@ -614,7 +642,7 @@ struct FBaseBlendedCurve
 		{
 			check(CurveToOverrideFrom.UIDToArrayIndexLUT != nullptr);
 			UIDToArrayIndexLUT = CurveToOverrideFrom.UIDToArrayIndexLUT;
-			NumValidCurveCount = GetValidElementCount(UIDToArrayIndexLUT);
+			NumValidCurveCount = GetValidElementCount(CurveToOverrideFrom);
 			Elements.Reset();
 			Elements.Append(CurveToOverrideFrom.Elements);
 			bInitialized = true;
@@ -630,9 +658,9 @@ struct FBaseBlendedCurve
 		if (ensure(&CurveToOverrideFrom != this))
 		{
 			check(CurveToOverrideFrom.UIDToArrayIndexLUT != nullptr);
+			NumValidCurveCount = GetValidElementCount(CurveToOverrideFrom);
 			UIDToArrayIndexLUT = CurveToOverrideFrom.UIDToArrayIndexLUT;
 			CurveToOverrideFrom.UIDToArrayIndexLUT = nullptr;
-			NumValidCurveCount = GetValidElementCount(UIDToArrayIndexLUT);
 			CurveToOverrideFrom.NumValidCurveCount = 0;
 			Elements = MoveTemp(CurveToOverrideFrom.Elements);
 			bInitialized = true;
@@ -651,7 +679,7 @@ struct FBaseBlendedCurve
 		UIDToArrayIndexLUT = CurveToCopyFrom.UIDToArrayIndexLUT;
 		Elements.Reset();
 		Elements.Append(CurveToCopyFrom.Elements);
-		NumValidCurveCount = GetValidElementCount(UIDToArrayIndexLUT);
+		NumValidCurveCount = CurveToCopyFrom.NumValidCurveCount;
 		bInitialized = true;
 	}
 
@@ -663,7 +691,7 @@ struct FBaseBlendedCurve
 			UIDToArrayIndexLUT = CurveToCopyFrom.UIDToArrayIndexLUT;
 			Elements.Reset();
 			Elements.Append(CurveToCopyFrom.Elements);
-			NumValidCurveCount = GetValidElementCount(UIDToArrayIndexLUT);
+			NumValidCurveCount = CurveToCopyFrom.NumValidCurveCount;
 			bInitialized = true;
 		}
 	}
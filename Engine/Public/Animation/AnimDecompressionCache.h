@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimTypes.h"
+
+struct FCompressedAnimSequence;
+
+/** A sequence to decompress keys of, see FAnimDecompressionCache::PrefetchKeys */
+struct FAnimDecompressionRequest
+{
+	const FCompressedAnimSequence* CompressedData;
+	float SequenceLength;
+	EAnimInterpolationType Interpolation;
+	FName SourceName;
+	float Time;
+};
+
+/** Every track of a sequence decompressed at one key, tracks are indexed like the compressed tracks of the sequence */
+struct FAnimDecompressedKey
+{
+	TArray<FTransform> Atoms;
+
+	/** False if the sequence has no scale keys, codecs then leave the scale of the pose untouched */
+	bool bHasScale;
+};
+
+/** The two decompressed keys of a sequence around a sampling time */
+struct FAnimDecompressedKeys
+{
+	TSharedPtr<const FAnimDecompressedKey, ESPMode::ThreadSafe> Key0;
+	TSharedPtr<const FAnimDecompressedKey, ESPMode::ThreadSafe> Key1;
+	float Alpha;
+
+	bool HasScale() const { return Key0->bHasScale; }
+
+	FQuat GetRotation(int32 TrackIndex) const
+	{
+		FQuat Rotation = FQuat::FastLerp(Key0->Atoms[TrackIndex].GetRotation(), Key1->Atoms[TrackIndex].GetRotation(), Alpha);
+		Rotation.Normalize();
+		return Rotation;
+	}
+
+	FVector GetTranslation(int32 TrackIndex) const
+	{
+		return FMath::Lerp(Key0->Atoms[TrackIndex].GetTranslation(), Key1->Atoms[TrackIndex].GetTranslation(), Alpha);
+	}
+
+	FVector GetScale3D(int32 TrackIndex) const
+	{
+		return FMath::Lerp(Key0->Atoms[TrackIndex].GetScale3D(), Key1->Atoms[TrackIndex].GetScale3D(), Alpha);
+	}
+};
+
+/**
+ * Per-frame cache of decompressed sequence keys, shared by every pose sampled from the same sequence during a frame.
+ * Each entry holds every track of one key of a sequence, so nodes and instances sampling a sequence anywhere between
+ * the same two keys only interpolate the cached keys instead of running the codec again.
+ *
+ * The first sampling of a key interval in a frame decompresses as usual and only records the interval, so sequences that
+ * are sampled once cost a lookup. Later samplings of the interval fill the cache. Enabled with a.AnimDecompressionCache.
+ */
+class ENGINE_API FAnimDecompressionCache
+{
+public:
+
+	/** Returns true if poses are sampled through the cache */
+	static bool IsEnabled();
+
+	/**
+	 * Finds the cached keys around Time, decompressing them if the interval was already sampled this frame.
+	 * @return false if the caller should decompress the pose itself
+	 */
+	static bool FindOrDecompressKeys(const FCompressedAnimSequence& CompressedData, float SequenceLength, EAnimInterpolationType Interpolation, FName SourceName, float Time, FAnimDecompressedKeys& OutKeys);
+
+	/**
+	 * Decompresses the keys needed to sample each request into the cache, in parallel. Call it before sampling many
+	 * sequences, e.g. every sample of a blend space, so that sampling only interpolates.
+	 */
+	static void PrefetchKeys(TArrayView<const FAnimDecompressionRequest> Requests);
+
+	/** Drops every cached key, e.g. before compressed data is freed or replaced */
+	static void Flush();
+};
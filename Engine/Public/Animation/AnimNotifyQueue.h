@@ -97,6 +97,16 @@ struct FAnimNotifyQueue
 
 	/** Append one queue to another */
 	void Append(const FAnimNotifyQueue& Queue);
+
+	/**
+	 * Returns an empty array to gather notifies into before adding them, so ticking assets doesn't allocate every frame.
+	 * The array is kept across frames and emptied by the next call, it can't be passed to AddAnimNotifies while gathering into another.
+	 */
+	TArray<FAnimNotifyEventReference>& GetScratchNotifies()
+	{
+		ScratchNotifies.Reset();
+		return ScratchNotifies;
+	}
 	
 	/** 
 	 *	Best LOD that was 'predicted' by UpdateSkelPose. Copied form USkeletalMeshComponent.
@@ -118,9 +128,15 @@ struct FAnimNotifyQueue
 	/** Takes the cached notifies from playing montages and adds them if they pass a slot weight check */
 	void ApplyMontageNotifies(const FAnimInstanceProxy& Proxy);
 private:
+	/** Storage returned by GetScratchNotifies */
+	TArray<FAnimNotifyEventReference> ScratchNotifies;
+
 	/** Implementation for adding notifies*/
 	void AddAnimNotifiesToDest(bool bSrcIsLeader, const TArray<FAnimNotifyEventReference>& NewNotifies, TArray<FAnimNotifyEventReference>& DestArray, const float InstanceWeight);
 
+	/** Empties the montage notifies of every slot, keeping their storage */
+	void ResetMontageAnimNotifies();
+
 	/** Adds the contents of the NewNotifies array to the DestArray (maintaining uniqueness of notify states*/
 	void AddAnimNotifiesToDestNoFiltering(const TArray<FAnimNotifyEventReference>& NewNotifies, TArray<FAnimNotifyEventReference>& DestArray) const;
 };
@@ -46,6 +46,14 @@ struct FLoadedAnimationChunk
 	void CleanUpIORequest();
 };
 
+/** A chunk kept loaded ahead of playback, see IAnimationStreamingManager::PrefetchChunk */
+struct FPrefetchedAnimationChunk
+{
+	uint32 Index;
+	float Priority;
+	double LastRequestTime;
+};
+
 /**
  * Contains everything that will be needed by a Streamable Anim that's streaming in data
  */
@@ -83,8 +91,10 @@ struct FStreamingAnimationData final
 
 	/**
 	 * Kicks off any pending requests
+	 *
+	 * @param NumPlaybackRequestedChunks	Number of leading RequestedChunks that playback needs, the others are only prefetched
 	 */
-	void BeginPendingRequests(const TArray<uint32>& IndicesToLoad, const TArray<uint32>& IndicesToFree);
+	void BeginPendingRequests(const TArray<uint32>& IndicesToLoad, const TArray<uint32>& IndicesToFree, int32 NumPlaybackRequestedChunks);
 
 	/**
 	* Blocks till all pending requests are fulfilled.
@@ -123,6 +133,9 @@ public:
 
 	TArray<uint32> LoadFailedChunks;
 
+	/** Chunks requested ahead of playback, kept loaded until the streaming manager evicts them */
+	TArray<FPrefetchedAnimationChunk> PrefetchedChunks;
+
 	/** Ptr to owning audio streaming manager. */
 	FAnimationStreamingManager* AnimationStreamingManager;
 };
@@ -154,6 +167,7 @@ struct FAnimationStreamingManager : public IAnimationStreamingManager
 	virtual bool RemoveStreamingAnim(UAnimStreamable* Anim) override;
 	virtual SIZE_T GetMemorySizeForAnim(const UAnimStreamable* Anim) override;
 	virtual const FCompressedAnimSequence* GetLoadedChunk(const UAnimStreamable* Anim, uint32 ChunkIndex, bool bTrackAsRequested) const override;
+	virtual void PrefetchChunk(const UAnimStreamable* Anim, uint32 ChunkIndex, float Priority) override;
 	// End IAudioStreamingManager interface
 
 	/** Called when an async callback is made on an async loading audio chunk request. */
@@ -161,6 +175,9 @@ struct FAnimationStreamingManager : public IAnimationStreamingManager
 
 protected:
 
+	/** Drops expired prefetched chunks and evicts the least important ones until they fit in the prefetch budget */
+	void EvictPrefetchedChunks();
+
 	/** Sound Waves being managed. */
 	TMap<UAnimStreamable*, FStreamingAnimationData*> StreamingAnimations;
 
@@ -595,6 +595,12 @@ public:
 	 */
 	bool ShouldUseRealtimeDecompression(bool bForceFullDecompression, const FSoundGroup &SoundGroup, USoundWave* SoundWave, float CompressedDurationThreshold) const;
 
+	/** Returns true if the sound wave is kept fully decoded by the decoded PCM cache, see au.DecodedPCMCache.BudgetKB. */
+	static bool IsInDecodedPCMCache(const USoundWave* SoundWave);
+
+	/** Called when the resources of a sound wave are freed, so that the decoded PCM cache stops accounting for it. */
+	static void RemoveFromDecodedPCMCache(const USoundWave* SoundWave);
+
 	/**
 	 * Precaches all existing sounds. Called when audio setup is complete
 	 */
@@ -659,7 +665,7 @@ public:
 	/** Removes a listener attenuation override for the specified listener. */
 	void ClearListenerAttenuationOverride(int32 ListenerIndex);
 
-	const TArray<FListener>& GetListeners() const { check(IsInAudioThread()); return Listeners; }
+	const TArray<FListener>& GetListeners() const { check(IsInAudioThreadOrWaveInstanceGather()); return Listeners; }
 
 	/**
 	 * Returns the currently applied reverb effect if there is one.
@@ -1303,6 +1309,15 @@ protected:
 	 */
 	void StartSources(TArray<FWaveInstance*>& WaveInstances, int32 FirstActiveIndex, bool bGameTicking);
 
+	/** Counts the plays of short realtime decompressed waves, marking the ones played often for the decoded PCM cache */
+	void NotifyDecodedPCMCacheWavesStarted(const TArray<USoundWave*>& StartingSoundWaves);
+
+	/** Fully decodes the waves marked for the decoded PCM cache that no source is playing, evicting less played waves to stay in budget */
+	void PromoteDecodedPCMCacheWaves();
+
+	/** Returns true if a source of any audio device is playing the sound wave */
+	static bool IsSoundWaveUsedBySource(const USoundWave* SoundWave);
+
 	/**
 	 * This is overridden in Audio::FMixerDevice to propogate listener information to the audio thread.
 	 */
@@ -1563,6 +1578,9 @@ public:
 	 */
 	void AddSoundToStop(FActiveSound* SoundToStop);
 
+	/** Returns true on the audio thread, or in a task updating wave instances for it, see au.ParallelGatherWaveInstances. */
+	static bool IsInAudioThreadOrWaveInstanceGather();
+
 	/**
 	 * Whether the provided ActiveSound is currently pending to stop
 	 */
@@ -1918,6 +1936,10 @@ private:
 	/** Set of sounds which will be stopped next audio frame update */
 	TSet<FActiveSound*> PendingSoundsToStop;
 
+	/** Sounds stopped while updating wave instances in parallel, added to PendingSoundsToStop once the update completes */
+	TArray<FActiveSound*> GatherSoundsToStop;
+	FCriticalSection GatherSoundsToStopCritSec;
+
 	/** Pending active sounds waiting to be added. */
 	TQueue<FActiveSound*> PendingAddedActiveSounds;
 
@@ -57,6 +57,9 @@ public:
 	// Returns the chunk asked for, or an empty TArrayView if that chunk is not loaded.
 	TArrayView<uint8> GetChunk(const FChunkKey& InKey, bool bBlockForLoadCompletion, bool bNeededForPlayback);
 
+	// Marks a cached chunk as the next one a playing stream will need. It is then only evicted if no other chunk can be, until it is retrieved with GetChunk.
+	void PrioritizeChunkForPlayback(const FChunkKey& InKey);
+
 	// add an additional reference for a chunk.
 	void AddNewReferenceToChunk(const FChunkKey& InKey);
 	void RemoveReferenceToChunk(const FChunkKey& InKey);
@@ -156,6 +159,9 @@ private:
 		uint32 CacheIndex;
 
 		FThreadSafeBool bIsLoaded;
+
+		// Set by PrioritizeChunkForPlayback when a playing stream is about to need this chunk.
+		FThreadSafeBool bNeededSoonForPlayback;
 		
 		// How many disparate consumers have called GetLoadedChunk.
 		FThreadSafeCounter NumConsumers;
@@ -177,6 +183,7 @@ private:
 			, LessRecentElement(nullptr)
 			, CacheIndex(InCacheIndex)
 			, bIsLoaded(false)
+			, bNeededSoonForPlayback(false)
 		{
 		}
 
@@ -233,6 +240,9 @@ private:
 	FCacheElement* MostRecentElement;
 	FCacheElement* LeastRecentElement;
 
+	// Elements of CachePool by key, so that lookups don't have to walk the recency list while holding CacheMutationCriticalSection.
+	TMap<FChunkKey, FCacheElement*> ElementsByKey;
+
 	// This is incremented on every call of InsertChunk until we hit CachePool.Num() or MemoryCounterBytes hits MemoryLimitBytes.
 	int32 ChunksInUse;
 
@@ -281,6 +291,9 @@ private:
 	// Returns the least recent chunk and fixes up the linked list accordingly.
 	FCacheElement* EvictLeastRecentChunk();
 
+	// Returns the least recent chunk that can be evicted before ElementToStopAt, or nullptr if there are none.
+	FCacheElement* FindEvictableChunk(const FCacheElement* ElementToStopAt, bool bEvictNeededSoonForPlayback) const;
+
 	void KickOffAsyncLoad(FCacheElement* CacheElement, const FChunkKey& InKey, TFunction<void(EAudioChunkLoadResult)> OnLoadCompleted, ENamedThreads::Type CallbackThread, bool bNeededForPlayback);
 	EAsyncIOPriorityAndFlags GetAsyncPriorityForChunk(const FChunkKey& InKey, bool bNeededForPlayback);
 
@@ -390,5 +403,5 @@ protected:
 
 inline int32 GetTypeHash(const FAudioChunkCache::FChunkKey& InKey)
 {
-	return HashCombine(InKey.SoundWaveName.GetNumber(), InKey.ChunkIndex);
+	return HashCombine(GetTypeHash(InKey.SoundWaveName), InKey.ChunkIndex);
 }
@@ -80,6 +80,32 @@ public:
 /** The simple element vertex declaration. */
 extern ENGINE_API TGlobalResource<FSimpleElementVertexDeclaration> GSimpleElementVertexDeclaration;
 
+/**
+ * Lines uploaded once to a static vertex buffer, for large line sets that rarely change such as debug visualizations.
+ * Drawn with FBatchedElements::AddLineSet, which only costs a transform per frame instead of copying every line.
+ * Like any render resource it must be initialized before it is drawn, and released after the last batch that draws it.
+ */
+class ENGINE_API FBatchedLineSet : public FVertexBuffer
+{
+public:
+
+	FBatchedLineSet() {}
+
+	/** Adds a line, only valid before the resource is initialized */
+	void AddLine(const FVector& Start, const FVector& End, const FLinearColor& Color, FHitProxyId HitProxyId);
+
+	int32 GetNumLines() const { return NumLines; }
+
+	// FRenderResource interface
+	virtual void InitRHI() override;
+	virtual FString GetFriendlyName() const override { return TEXT("FBatchedLineSet"); }
+
+private:
+	/** Pairs of line vertices, kept so the buffer can be recreated with the RHI */
+	TArray<FSimpleElementVertex> Vertices;
+	int32 NumLines = 0;
+};
+
 
 
 /** Custom parameters for batched element shaders.  Derive from this class to implement your shader bindings. */
@@ -118,6 +144,9 @@ public:
 	/** Adds a translucent line to the batch. */
 	void AddTranslucentLine(const FVector& Start, const FVector& End, const FLinearColor& Color, FHitProxyId HitProxyId, float Thickness = 0.0f, float DepthBias = 0.0f, bool bScreenSpace = false);
 
+	/** Adds a set of static lines drawn with LocalToWorld. Lines sets are always opaque and the set must stay initialized until the batch is drawn */
+	void AddLineSet(const FBatchedLineSet* LineSet, const FMatrix& LocalToWorld);
+
 	/** Adds a point to the batch. Note only SE_BLEND_Opaque will be used for batched point rendering. */
 	void AddPoint(const FVector& Position,float Size,const FLinearColor& Color,FHitProxyId HitProxyId);
 
@@ -224,7 +253,7 @@ public:
 
 	FORCEINLINE bool HasPrimsToDraw() const
 	{
-		return( LineVertices.Num() || Points.Num() || Sprites.Num() || MeshElements.Num() || ThickLines.Num() || WireTris.Num() > 0 );
+		return( LineVertices.Num() || LineSets.Num() || Points.Num() || Sprites.Num() || MeshElements.Num() || ThickLines.Num() || WireTris.Num() > 0 );
 	}
 
 	/** Adds a triangle to the batch. Extensive version where all parameters can be passed in. */
@@ -240,7 +269,7 @@ public:
 	 */
 	FORCEINLINE uint32 GetAllocatedSize( void ) const
 	{
-		return sizeof(*this) + Points.GetAllocatedSize() + WireTris.GetAllocatedSize() + WireTriVerts.GetAllocatedSize() + ThickLines.GetAllocatedSize()
+		return sizeof(*this) + LineSets.GetAllocatedSize() + Points.GetAllocatedSize() + WireTris.GetAllocatedSize() + WireTriVerts.GetAllocatedSize() + ThickLines.GetAllocatedSize()
 			+ Sprites.GetAllocatedSize() + MeshElements.GetAllocatedSize() + MeshVertices.GetAllocatedSize();
 	}
 
@@ -264,6 +293,13 @@ private:
 
 	TArray<FSimpleElementVertex> LineVertices;
 
+	struct FBatchedLineSetElement
+	{
+		const FBatchedLineSet* LineSet;
+		FMatrix LocalToWorld;
+	};
+	TArray<FBatchedLineSetElement> LineSets;
+
 	struct FBatchedPoint
 	{
 		FVector Position;
@@ -155,6 +155,9 @@ private:
 	/** Look up table of UID to FAnimCurveType UIDToNameLUT[InUID] = FAnimCurveType of curve. */
 	TArray<FAnimCurveType> UIDToCurveTypeLUT;
 
+	/** Number of valid entries of UIDToArrayIndexLUT, i.e. the number of curves a pose of this container has */
+	int32 UIDToArrayIndexLUTValidCount;
+
 	/** For debugging. */
 	/** Disable Retargeting. Extract animation, but do not retarget it. */
 	bool bDisableRetargeting;
@@ -321,6 +324,12 @@ public:
 		return UIDToArrayIndexLUT;
 	}
 
+	/** Get the number of valid entries of the UID To Array look up table */
+	int32 GetUIDToArrayLookupTableValidCount() const
+	{
+		return UIDToArrayIndexLUTValidCount;
+	}
+
 	/** Get UID To Name look up table */
 	TArray<FName> const& GetUIDToNameLookupTable() const
 	{
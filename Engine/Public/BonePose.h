@@ -381,6 +381,78 @@ struct ENGINE_API FCompactHeapPose : public FBaseCompactPose<FDefaultAllocator>
 	void NormalizeRotations();
 };
 
+/**
+ * Compact pose stored as separate rotation, translation and scale streams, one entry per compact pose bone.
+ * Blending, additive and normalize operations run over whole streams, which vectorizes much better than
+ * going through the FTransform of every bone. Convert from and to FCompactPose at the edges of a sequence of
+ * operations rather than around each of them.
+ */
+struct ENGINE_API FCompactPoseSoA
+{
+	TArray<FQuat, FAnimStackAllocator> Rotations;
+	TArray<FVector, FAnimStackAllocator> Translations;
+	TArray<FVector, FAnimStackAllocator> Scales;
+
+	int32 GetNumBones() const { return Rotations.Num(); }
+
+	void SetNumBones(int32 NumBones)
+	{
+		Rotations.SetNumUninitialized(NumBones, false);
+		Translations.SetNumUninitialized(NumBones, false);
+		Scales.SetNumUninitialized(NumBones, false);
+	}
+
+	template <typename InAllocator>
+	void CopyFrom(const FBaseCompactPose<InAllocator>& Pose)
+	{
+		const TArray<FTransform, InAllocator>& Bones = Pose.GetBones();
+		SetNumBones(Bones.Num());
+		for (int32 BoneIndex = 0; BoneIndex < Bones.Num(); ++BoneIndex)
+		{
+			Rotations[BoneIndex] = Bones[BoneIndex].GetRotation();
+			Translations[BoneIndex] = Bones[BoneIndex].GetTranslation();
+			Scales[BoneIndex] = Bones[BoneIndex].GetScale3D();
+		}
+	}
+
+	/** Pose must already be initialized with the same bone container as the pose this was copied from */
+	template <typename InAllocator>
+	void CopyTo(FBaseCompactPose<InAllocator>& Pose) const
+	{
+		check(Pose.GetNumBones() == GetNumBones());
+		for (FCompactPoseBoneIndex BoneIndex : Pose.ForEachBoneIndex())
+		{
+			const int32 Index = BoneIndex.GetInt();
+			Pose[BoneIndex] = FTransform(Rotations[Index], Translations[Index], Scales[Index]);
+		}
+	}
+
+	// Sets every bone to the additive identity: no rotation, no translation and a scale delta of zero
+	void ResetToAdditiveIdentity();
+
+	// Normalizes all rotations in this pose
+	void NormalizeRotations();
+
+	/** Sets this pose to SourcePose scaled by BlendWeight, the first step of a weighted blend */
+	void BlendOverwrite(const FCompactPoseSoA& SourcePose, float BlendWeight);
+
+	/** Adds SourcePose scaled by BlendWeight to this pose, rotations taking the shortest path */
+	void BlendAccumulate(const FCompactPoseSoA& SourcePose, float BlendWeight);
+
+	/** Applies an additive pose to this pose, same as FTransform::BlendFromIdentityAndAccumulate for every bone */
+	void AccumulateAdditive(const FCompactPoseSoA& AdditivePose, float BlendWeight);
+
+	/**
+	 * Converts local space rotations to mesh space and back. Translations and scales are left in local space, as for
+	 * mesh space rotation blending. Every bone depends on its parent, so these walk the hierarchy one bone at a time.
+	 */
+	void ConvertToMeshRotation(const FBoneContainer& BoneContainer);
+	void ConvertMeshRotationToLocalSpace(const FBoneContainer& BoneContainer);
+
+	/** Sets ResultPose to the weighted sum of SourcePoses with normalized rotations, see FAnimationRuntime::BlendPosesTogether */
+	static void BlendPosesTogether(TArrayView<const FCompactPoseSoA* const> SourcePoses, TArrayView<const float> SourceWeights, FCompactPoseSoA& ResultPose);
+};
+
 struct FMeshPose : public FBasePose<FMeshPoseBoneIndex, FDefaultAllocator>
 {
 public:
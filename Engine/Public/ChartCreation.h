@@ -11,6 +11,7 @@
 #include "ProfilingDebugging/Histogram.h"
 #include "Scalability.h"
 #include "Delegates/IDelegateInstance.h"
+#include "InGamePerformanceTracker.h"
 
 //////////////////////////////////////////////////////////////////////
 
@@ -80,6 +81,9 @@ public:
 		/** The number of sync loads performed in this frame. */
 		uint32 SyncLoadCount;
 
+		/** Time spent in each FPerformanceTrackingTimers timer this frame, indexed like the timers. */
+		TArray<double, TInlineAllocator<FPerformanceTrackingTimers::MaxTimers>> SubsystemTimeSeconds;
+
 		// Should this frame be considered for histogram generation (controlled by t.FPSChart.MaxFrameDeltaSecsBeforeDiscarding)
 		bool bBinThisFrame;
 
@@ -148,6 +152,9 @@ public:
 	// Hitch time histogram (in seconds)
 	FHistogram DynamicResHistogram;
 
+	// Time histogram of each FPerformanceTrackingTimers timer (in seconds), indexed like the timers
+	TArray<FHistogram> SubsystemTimeHistograms;
+
 	/** Number of frames for each time of <boundtype> **/
 	uint32 NumFramesBound_GameThread;
 	uint32 NumFramesBound_RenderThread;
@@ -280,6 +287,9 @@ public:
 		ChartLabel = NewLabel;
 	}
 
+	/** Estimates the value below which the given fraction (0..1) of the measurements of a histogram fall */
+	static double GetHistogramPercentile(const FHistogram& Histogram, double Percentile);
+
 	void DumpFPSChart(const FString& InMapName);
 
 	// Dumps the FPS chart information to an analytic event param array.
@@ -472,5 +482,6 @@ protected:
 	virtual void HandleHitchSummary(int32 TotalHitchCount, double TotalTimeSpentInHitchBuckets);
 	virtual void HandleFPSThreshold(int32 TargetFPS, float PctMissedFrames);
 	virtual void HandleDynamicResThreshold(int32 TargetScreenPercentage, float PctTimeAbove);
+	virtual void HandleSubsystemTimer(FName TimerName, const FHistogram& TimeHistogram);
 	virtual void HandleBasicStats();
 };
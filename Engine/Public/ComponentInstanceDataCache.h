@@ -8,6 +8,7 @@
 #include "ComponentInstanceDataCache.generated.h"
 
 class AActor;
+class FProperty;
 class UActorComponent;
 class USceneComponent;
 enum class EComponentCreationMethod : uint8;
@@ -58,6 +59,48 @@ struct TStructOpsTypeTraits<FActorComponentDuplicatedObjectData> : public TStruc
 	};
 };
 
+/**
+ * Values of component properties that hold no object references, copied as they are instead of going through tagged
+ * property serialization. Owns a copy of each value, destroyed with the property that copied it.
+ */
+class ENGINE_API FActorComponentInstanceDirectProperties
+{
+public:
+	FActorComponentInstanceDirectProperties() = default;
+	FActorComponentInstanceDirectProperties(const FActorComponentInstanceDirectProperties& Other);
+	FActorComponentInstanceDirectProperties(FActorComponentInstanceDirectProperties&& Other);
+	FActorComponentInstanceDirectProperties& operator=(const FActorComponentInstanceDirectProperties& Other);
+	FActorComponentInstanceDirectProperties& operator=(FActorComponentInstanceDirectProperties&& Other);
+	~FActorComponentInstanceDirectProperties();
+
+	/** Whether values of the property can be copied as they are, without object references to remap or members that tagged serialization would skip */
+	static bool CanCopyDirectly(const FProperty* Property);
+
+	/** Copies all the elements of the property, Value points to the first one */
+	void Add(const FProperty* Property, const void* Value);
+
+	/** Copies the values to the component, except those of the properties to skip */
+	void ApplyTo(UActorComponent* Component, const TSet<const FProperty*>& PropertiesToSkip) const;
+
+	/** Serializes the values by property name, the properties are found again in ComponentClass when loading */
+	void Serialize(FArchive& Ar, const UClass* ComponentClass);
+
+	void Reset();
+
+	int32 Num() const { return Values.Num(); }
+
+private:
+	struct FValue
+	{
+		const FProperty* Property;
+		void* Data;
+	};
+
+	FValue& AddInitialized(const FProperty* Property);
+
+	TArray<FValue> Values;
+};
+
 /** Base class for component instance cached data of a particular type. */
 USTRUCT()
 struct ENGINE_API FActorComponentInstanceData
@@ -73,7 +116,10 @@ public:
 	bool MatchesComponent(const UActorComponent* Component, const UObject* ComponentTemplate, const TMap<UActorComponent*, const UObject*>& ComponentToArchetypeMap) const;
 
 	/** Determines if any instance data was actually saved. */
-	virtual bool ContainsData() const { return SavedProperties.Num() > 0; }
+	virtual bool ContainsData() const { return HasSavedProperties(); }
+
+	/** Determines if any property was saved, either serialized or copied directly. */
+	bool HasSavedProperties() const { return SavedProperties.Num() > 0 || DirectProperties.Num() > 0; }
 
 	/** Applies this component instance data to the supplied component */
 	virtual void ApplyToComponent(UActorComponent* Component, const ECacheApplyPhase CacheApplyPhase);
@@ -90,6 +136,7 @@ public:
 protected:
 	friend class FComponentPropertyWriter;
 	friend class FComponentPropertyReader;
+	friend class FComponentInstanceDataCache;
 
 	/** The template used to create the source component */
 	UPROPERTY()
@@ -118,6 +165,10 @@ protected:
 	// Referenced names in component instance saved properties
 	UPROPERTY()
 	TArray<FName> ReferencedNames;
+
+	// Saved properties of native components that don't need tagged serialization, copied directly and left out of SavedProperties.
+	// Not a UPROPERTY, FComponentInstanceDataCache::Serialize serializes them.
+	FActorComponentInstanceDirectProperties DirectProperties;
 };
 
 /** 
@@ -589,6 +589,16 @@ struct IAnimationStreamingManager : public IStreamingManager
 	 * @return Either the desired chunk or NULL if it's not loaded
 	 */
 	virtual const FCompressedAnimSequence* GetLoadedChunk(const UAnimStreamable* Anim, uint32 ChunkIndex, bool bRequestNextChunk) const = 0;
+
+	/**
+	 * Requests a chunk ahead of playback, e.g. for an animation a character is likely to play next. Prefetched chunks
+	 * stay loaded within a memory budget, the least recently requested chunks of the lowest priority are evicted first.
+	 *
+	 * @param Anim			AnimStreamable we want a chunk from
+	 * @param ChunkIndex	Index of the chunk we want
+	 * @param Priority		Importance of the request, e.g. the significance of the character that may play the animation
+	 */
+	virtual void PrefetchChunk(const UAnimStreamable* Anim, uint32 ChunkIndex, float Priority) = 0;
 };
 
 /**
@@ -102,6 +102,28 @@ public:
 	 */
 	bool IntersectBox(const FVector& Origin,const FVector& Translation,const FVector& Extent) const;
 
+	/**
+	 * Intersection test of many axis-aligned boxes at once, four boxes per SIMD register.
+	 * The bounds are passed as structure of arrays, one stream per component, so they can be loaded without shuffling.
+	 * Bit (i % 32) of OutVisible[i / 32] is set if box i intersects the volume, the caller provides (NumBoxes + 31) / 32 words.
+	 *
+	 * @param NumBoxes - Number of boxes in each stream.
+	 * @param OriginX, OriginY, OriginZ - Origins of the boxes.
+	 * @param ExtentX, ExtentY, ExtentZ - Extents of the boxes along each axis.
+	 * @param OutVisible - Receives the intersection bitmask.
+	 */
+	void IntersectBoxes(int32 NumBoxes, const float* OriginX, const float* OriginY, const float* OriginZ, const float* ExtentX, const float* ExtentY, const float* ExtentZ, uint32* OutVisible) const;
+
+	/**
+	 * Same as IntersectBoxes, also reporting the boxes fully inside the volume so hierarchical culling can skip testing their children.
+	 * OutFullyContained has the same layout as OutVisible, its bits are only set for visible boxes.
+	 */
+	void IntersectBoxes(int32 NumBoxes, const float* OriginX, const float* OriginY, const float* OriginZ, const float* ExtentX, const float* ExtentY, const float* ExtentZ, uint32* OutVisible, uint32* OutFullyContained) const;
+
+	/** Intersection test of many spheres at once, see IntersectBoxes for the layout of the streams and of the bitmask. */
+	void IntersectSpheres(int32 NumSpheres, const float* OriginX, const float* OriginY, const float* OriginZ, const float* Radius, uint32* OutVisible) const;
+	void IntersectSpheres(int32 NumSpheres, const float* OriginX, const float* OriginY, const float* OriginZ, const float* Radius, uint32* OutVisible, uint32* OutFullyContained) const;
+
 	/** Determines whether the given point lies inside the convex volume */
 	bool IntersectPoint(const FVector& Point) const
 	{
@@ -28,6 +28,9 @@ public:
 	{
 		TimeRemaining -= Response.ElapsedTime();
 		Response.FinishAndTriggerIf(TimeRemaining <= 0.0f, ExecutionFunction, OutputLink, CallbackTarget);
+
+		// Nothing to do until the time is up
+		Response.WaitFor(TimeRemaining);
 	}
 
 #if WITH_EDITOR
@@ -379,6 +379,15 @@ public:
 	bool bGenerateDistanceFieldAsIfTwoSided;
 	FString DDCKey;
 	FDistanceFieldVolumeData* GeneratedVolumeData;
+
+	/** Build order, the highest first. Last time a component using the mesh was rendered on screen. */
+	float Priority;
+
+	/** Handle of the async DDC fetch issued when the task was queued, 0 once the results were retrieved */
+	uint32 DDCRequestHandle;
+
+	/** Whether GeneratedVolumeData came from the DDC and doesn't need to be built nor put back there */
+	bool bLoadedFromDDC;
 };
 
 /** Class that manages asynchronous building of mesh distance fields. */
@@ -396,6 +405,9 @@ public:
 	/** Blocks the main thread until the async build of the specified mesh is complete. */
 	ENGINE_API void BlockUntilBuildComplete(UStaticMesh* StaticMesh, bool bWarnIfBlocked);
 
+	/** Drops the builds of the specified mesh that have not started yet, the ones in progress still have to be waited for. */
+	ENGINE_API void CancelBuild(UStaticMesh* StaticMesh);
+
 	/** Blocks the main thread until all async builds complete. */
 	ENGINE_API void BlockUntilAllBuildsComplete();
 
@@ -421,15 +433,23 @@ private:
 	/** Builds a single task with the given threadpool.  Called from the worker thread. */
 	void Build(FAsyncDistanceFieldTask* Task, class FQueuedThreadPool& ThreadPool);
 
+	/** Removes the pending task with the highest priority, ties going to the last one queued. (Thread-Safe) */
+	FAsyncDistanceFieldTask* PopHighestPriorityTask();
+
+	/** Raises the priority of pending tasks whose mesh was rendered recently.  Called from the game thread. */
+	void UpdateTaskPriorities();
+
+	/** Time of the last UpdateTaskPriorities */
+	double LastPriorityUpdateTime;
+
 	/** Thread that will build any tasks in TaskQueue and exit when there are no more. */
 	class TUniquePtr<class FBuildDistanceFieldThreadRunnable> ThreadRunnable;
 
 	/** Game-thread managed list of tasks in the async system. */
 	TArray<FAsyncDistanceFieldTask*> ReferencedTasks;
 
-	/** Tasks that have not yet started processing yet. */
-	// consider changing this from FIFO to Unordered, which may be faster
-	TLockFreePointerListLIFO<FAsyncDistanceFieldTask> TaskQueue;
+	/** Tasks that have not yet started processing yet, in the order they were added. Protected by CriticalSection. */
+	TArray<FAsyncDistanceFieldTask*> PendingTasks;
 
 	/** Tasks that have completed processing. */
 	// consider changing this from FIFO to Unordered, which may be faster
@@ -107,6 +107,9 @@ private:
 	// Number of frame remaining to ignore.
 	int32 IgnoreFrameRemainingCount;
 
+	// Number of refreshes remaining that can't increase resolution after a GPU over budget panic.
+	int32 PanicIncreaseHoldRemainingCount;
+
 	// Current frame's view fraction.
 	float CurrentFrameResolutionFraction;
 
@@ -232,6 +232,21 @@ public:
 			return CalculateRequiredMemory(NumVertices, WithTangents);
 		}
 
+		uint32 GetNumVertices() const
+		{
+			return NumVertices;
+		}
+
+		bool HasTangents() const
+		{
+			return WithTangents;
+		}
+
+		bool HasIntermediateTangents() const
+		{
+			return WithTangents && IntermediateTangents.Buffer.IsValid();
+		}
+
 		FRWBuffer* GetTangentBuffer()
 		{
 			return WithTangents ? &Tangents : nullptr;
@@ -356,7 +371,22 @@ protected:
 
 	TArray<FRWBuffersAllocation*> Allocations;
 	TArray<FGPUSkinCacheEntry*> Entries;
+
+	// Allocation of a released entry, kept to be reused by the next entry of about the same size
+	struct FFreeAllocation
+	{
+		FRWBuffersAllocation* Allocation;
+		uint32 ReleasedFrame;
+	};
+	// Oldest first. Their memory is part of UsedMemoryInBytes until they are freed.
+	TArray<FFreeAllocation> FreeAllocations;
+
 	FRWBuffersAllocation* TryAllocBuffer(uint32 NumVertices, bool WithTangnents);
+	// Keeps the allocation of a released entry for reuse, or frees it
+	void ReleaseAllocation(FRWBuffersAllocation* Allocation);
+	// Frees the free allocations released more than r.SkinCache.FreeAllocationLifetime frames ago, or all of them
+	void FreeUnusedAllocations(bool bFreeAll);
+	void FreeAllocation(int32 FreeAllocationIndex);
 	void DoDispatch(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* SkinCacheEntry, int32 Section, int32 RevisionNumber);
 	void DispatchUpdateSkinTangents(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* Entry, int32 SectionIndex);
 	void DispatchUpdateSkinning(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* Entry, int32 Section, uint32 RevisionNumber);
@@ -382,6 +412,8 @@ DECLARE_STATS_GROUP(TEXT("GPU Skin Cache"), STATGROUP_GPUSkinCache, STATCAT_Adva
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Sections Skinned"), STAT_GPUSkinCache_TotalNumChunks, STATGROUP_GPUSkinCache,);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Vertices Skinned"), STAT_GPUSkinCache_TotalNumVertices, STATGROUP_GPUSkinCache,);
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Total Memory Bytes Used"), STAT_GPUSkinCache_TotalMemUsed, STATGROUP_GPUSkinCache, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Free Memory Bytes Kept For Reuse"), STAT_GPUSkinCache_FreeMemKept, STATGROUP_GPUSkinCache, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Allocations Reused"), STAT_GPUSkinCache_NumAllocationsReused, STATGROUP_GPUSkinCache, );
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Intermediate buffer for Recompute Tangents"), STAT_GPUSkinCache_TangentsIntermediateMemUsed, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Triangles for Recompute Tangents"), STAT_GPUSkinCache_NumTrianglesForRecomputeTangents, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Sections Processed"), STAT_GPUSkinCache_NumSectionsProcessed, STATGROUP_GPUSkinCache, );
@@ -167,6 +167,8 @@ public:
 			, PreviousRevisionNumber(0)
 			, CurrentRevisionNumber(0)
 		{
+			BoneBufferHash[0] = BoneBufferHash[1] = 0;
+
 			// BoneDataOffset and BoneTextureSize are not set as they are only valid if IsValidRef(BoneTexture)
 			MaxGPUSkinBones = GetMaxGPUSkinBones();
 			check(MaxGPUSkinBones <= GHardwareMaxGPUSkinBones);
@@ -189,6 +191,7 @@ public:
 					BoneBufferPool.ReleasePooledResource(BoneBuffer[i]);
 				}
 				BoneBuffer[i].SafeRelease();
+				BoneBufferHash[i] = 0;
 			}
 		}
 		
@@ -240,6 +243,8 @@ public:
 	private:
 		// double buffered bone positions+orientations to support normal rendering and velocity (new-old position) rendering
 		FVertexBufferAndSRV BoneBuffer[2];
+		// hash of the bones last written to each BoneBuffer, 0 if unknown
+		uint64 BoneBufferHash[2];
 		// 0 / 1 to index into BoneBuffer
 		uint32 CurrentBuffer;
 		// RevisionNumber Tracker
@@ -267,6 +272,13 @@ public:
 		// @param bPrevious true:previous, false:current
 		// @return might not pass the IsValid() 
 		const FVertexBufferAndSRV& GetBoneBufferInternal(bool bPrevious) const
+		{
+			const FVertexBufferAndSRV& Ret = BoneBuffer[GetBoneBufferIndex(bPrevious)];
+			return Ret;
+		}
+		// @param bPrevious true:previous, false:current
+		// @return index into BoneBuffer
+		uint32 GetBoneBufferIndex(bool bPrevious) const
 		{
 			check(IsInParallelRenderingThread());
 
@@ -275,10 +287,7 @@ public:
 				bPrevious = false;
 			}
 
-			uint32 BufferIndex = CurrentBuffer ^ (uint32)bPrevious;
-
-			const FVertexBufferAndSRV& Ret = BoneBuffer[BufferIndex];
-			return Ret;
+			return CurrentBuffer ^ (uint32)bPrevious;
 		}
 	};
 
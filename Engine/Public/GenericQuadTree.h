@@ -17,6 +17,12 @@ public:
 
 	TQuadTree(const FBox2D& InBox, float InMinimumQuadSize = 100.f);
 
+	/**
+	 * Builds the tree from all of its elements at once, top down, instead of splitting leaves as elements are inserted (n log n).
+	 * The resulting tree is the same as inserting the elements one at a time, with the elements of each node in Morton order of their box centers.
+	 */
+	TQuadTree(const FBox2D& InBox, TArrayView<const ElementType> Elements, TArrayView<const FBox2D> Boxes, float InMinimumQuadSize = 100.f);
+
 	/** Gets the TreeBox so systems can test insertions before trying to do so with invalid regions */
 	const FBox2D& GetTreeBox() const { return TreeBox; }
 
@@ -27,6 +33,17 @@ public:
 	template<typename ElementAllocatorType>
 	void GetElements(const FBox2D& Box, TArray<ElementType, ElementAllocatorType>& ElementsOut) const;
 
+	/** Given a 2D box, calls Func(const ElementType&) for every element within the box, without gathering them in an array. */
+	template<typename FuncType>
+	void ForEachElement(const FBox2D& Box, FuncType&& Func) const;
+
+	/**
+	 * Given many 2D boxes, returns the elements within each of them, traversing the tree once for all boxes.
+	 * The elements within Boxes[i] are ElementsOut[QueryOffsetsOut[i]] to ElementsOut[QueryOffsetsOut[i + 1] - 1], without duplicates for a box.
+	 */
+	template<typename ElementAllocatorType>
+	void GetElementsForBoxes(TArrayView<const FBox2D> Boxes, TArray<ElementType, ElementAllocatorType>& ElementsOut, TArray<int32>& QueryOffsetsOut) const;
+
 	/** Removes an object of type ElementType with an associated 2D box of size Box (log n). Does not cleanup tree*/
 	bool Remove(const ElementType& Instance, const FBox2D& Box);
 
@@ -86,6 +103,12 @@ private:
 	/** Internal recursive implementation of @see Insert */
 	void InsertElementRecursive(const ElementType& Element, const FBox2D& Box, const TCHAR* DebugContext);
 
+	/** Internal recursive implementation of the bulk build constructor, Indices are the elements that end up in this tree or its subtrees */
+	void BuildRecursive(TArrayView<const ElementType> Elements, TArrayView<const FBox2D> Boxes, TArrayView<int32> Indices);
+
+	/** Internal recursive implementation of @see GetElementsForBoxes, QueryIndices are the boxes that touch this tree */
+	void GetElementsForBoxesRecursive(TArrayView<const FBox2D> Boxes, TArrayView<const int32> QueryIndices, TArray<TPair<int32, ElementType>>& HitsOut) const;
+
 private:
 
 	/**
@@ -154,6 +177,54 @@ TQuadTree<ElementType, NodeCapacity>::TQuadTree(const FBox2D& Box, float InMinim
 	SubTrees[0] = SubTrees[1] = SubTrees[2] = SubTrees[3] = nullptr;
 }
 
+template <typename ElementType, int32 NodeCapacity>
+TQuadTree<ElementType, NodeCapacity>::TQuadTree(const FBox2D& Box, TArrayView<const ElementType> Elements, TArrayView<const FBox2D> Boxes, float InMinimumQuadSize)
+	: TQuadTree(Box, InMinimumQuadSize)
+{
+	check(Elements.Num() == Boxes.Num());
+
+	// Sort by the Morton code of the box centers, so elements close to each other are close in each node
+	const FVector2D TreeSize = TreeBox.GetSize();
+	const FVector2D MortonScale(TreeSize.X > 0.f ? 65535.f / TreeSize.X : 0.f, TreeSize.Y > 0.f ? 65535.f / TreeSize.Y : 0.f);
+
+	TArray<TPair<uint32, int32>> MortonOrder;
+	MortonOrder.SetNumUninitialized(Elements.Num());
+	int32 NumOutside = 0;
+	for (int32 Index = 0; Index < Boxes.Num(); ++Index)
+	{
+		const FBox2D& ElementBox = Boxes[Index];
+		if (!ElementBox.Intersect(TreeBox))
+		{
+			++NumOutside;
+		}
+
+		const FVector2D Center = (ElementBox.GetCenter() - TreeBox.Min) * MortonScale;
+		const uint32 X = (uint32)FMath::Clamp(Center.X, 0.f, 65535.f);
+		const uint32 Y = (uint32)FMath::Clamp(Center.Y, 0.f, 65535.f);
+		MortonOrder[Index] = TPair<uint32, int32>(FMath::MortonCode2(X) | (FMath::MortonCode2(Y) << 1), Index);
+	}
+
+	if (NumOutside > 0)
+	{
+		// Elements shouldn't be added outside the bounds of the top-level quad
+		UE_LOG(LogQuadTree, Warning, TEXT("Building quadtree with %d elements that are outside the bounds of the quadtree root (%s). Consider resizing."), NumOutside, *TreeBox.ToString());
+	}
+
+	MortonOrder.Sort([](const TPair<uint32, int32>& A, const TPair<uint32, int32>& B)
+	{
+		return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+	});
+
+	TArray<int32> Indices;
+	Indices.SetNumUninitialized(MortonOrder.Num());
+	for (int32 Index = 0; Index < MortonOrder.Num(); ++Index)
+	{
+		Indices[Index] = MortonOrder[Index].Value;
+	}
+
+	BuildRecursive(Elements, Boxes, Indices);
+}
+
 template <typename ElementType, int32 NodeCapacity>
 TQuadTree<ElementType, NodeCapacity>::TQuadTree()
 {
@@ -285,6 +356,85 @@ void TQuadTree<ElementType, NodeCapacity>::InsertElementRecursive(const ElementT
 	}
 }
 
+template <typename ElementType, int32 NodeCapacity>
+void TQuadTree<ElementType, NodeCapacity>::BuildRecursive(TArrayView<const ElementType> Elements, TArrayView<const FBox2D> Boxes, TArrayView<int32> Indices)
+{
+	check(!bInternal && Nodes.Num() == 0);
+
+	// Same rule as InsertElementRecursive, a leaf splits once more than NodeCapacity elements reach it
+	const bool bCanSplitTree = TreeBox.GetSize().SizeSquared() > FMath::Square(MinimumQuadSize);
+	if (!bCanSplitTree || Indices.Num() <= NodeCapacity)
+	{
+		Nodes.Reserve(Indices.Num());
+		for (int32 Index : Indices)
+		{
+			Nodes.Add(FNode(Elements[Index], Boxes[Index]));
+		}
+
+		if (!bCanSplitTree && Indices.Num() > NodeCapacity)
+		{
+			UE_LOG(LogQuadTree, Verbose, TEXT("Minimum size %f reached for quadtree at %s. Filling beyond capacity %d to %d"), MinimumQuadSize, *Position.ToString(), NodeCapacity, Nodes.Num());
+		}
+		return;
+	}
+
+	Split();
+
+	// Stable partition of the elements by the subtree they fit in, elements overlapping several subtrees stay here
+	const int32 OverlappingSlot = 4;
+	TArray<uint8, TInlineAllocator<64>> Slots;
+	Slots.SetNumUninitialized(Indices.Num());
+	int32 SlotCounts[5] = { 0, 0, 0, 0, 0 };
+	for (int32 SortedIndex = 0; SortedIndex < Indices.Num(); ++SortedIndex)
+	{
+		TreeType* Quads[4];
+		const int32 NumQuads = GetQuads(Boxes[Indices[SortedIndex]], Quads);
+		check(NumQuads > 0);
+
+		uint8 Slot = OverlappingSlot;
+		if (NumQuads == 1)
+		{
+			for (uint8 QuadIndex = 0; QuadIndex < 4; ++QuadIndex)
+			{
+				if (SubTrees[QuadIndex] == Quads[0])
+				{
+					Slot = QuadIndex;
+					break;
+				}
+			}
+		}
+		Slots[SortedIndex] = Slot;
+		++SlotCounts[Slot];
+	}
+
+	int32 SlotStarts[5];
+	SlotStarts[0] = 0;
+	for (int32 Slot = 1; Slot < 5; ++Slot)
+	{
+		SlotStarts[Slot] = SlotStarts[Slot - 1] + SlotCounts[Slot - 1];
+	}
+
+	TArray<int32, TInlineAllocator<64>> Partitioned;
+	Partitioned.SetNumUninitialized(Indices.Num());
+	int32 SlotEnds[5] = { SlotStarts[0], SlotStarts[1], SlotStarts[2], SlotStarts[3], SlotStarts[4] };
+	for (int32 SortedIndex = 0; SortedIndex < Indices.Num(); ++SortedIndex)
+	{
+		Partitioned[SlotEnds[Slots[SortedIndex]]++] = Indices[SortedIndex];
+	}
+	FMemory::Memcpy(Indices.GetData(), Partitioned.GetData(), Indices.Num() * sizeof(int32));
+
+	Nodes.Reserve(SlotCounts[OverlappingSlot]);
+	for (int32 SortedIndex = SlotStarts[OverlappingSlot]; SortedIndex < Indices.Num(); ++SortedIndex)
+	{
+		Nodes.Add(FNode(Elements[Indices[SortedIndex]], Boxes[Indices[SortedIndex]]));
+	}
+
+	for (int32 QuadIndex = 0; QuadIndex < 4; ++QuadIndex)
+	{
+		SubTrees[QuadIndex]->BuildRecursive(Elements, Boxes, Indices.Slice(SlotStarts[QuadIndex], SlotCounts[QuadIndex]));
+	}
+}
+
 template <typename ElementType, int32 NodeCapacity>
 bool TQuadTree<ElementType, NodeCapacity>::RemoveNodeForElement(const ElementType& Element)
 {
@@ -344,6 +494,113 @@ void TQuadTree<ElementType, NodeCapacity>::GetElements(const FBox2D& Box, TArray
 	}
 }
 
+template <typename ElementType, int32 NodeCapacity>
+template <typename FuncType>
+void TQuadTree<ElementType, NodeCapacity>::ForEachElement(const FBox2D& Box, FuncType&& Func) const
+{
+	for (const FNode& Node : Nodes)
+	{
+		if (Box.Intersect(Node.Box))
+		{
+			Func(Node.Element);
+		}
+	}
+
+	TreeType* Quads[4];
+	const int32 NumQuads = GetQuads(Box, Quads);
+	for (int32 QuadIndex = 0; QuadIndex < NumQuads; QuadIndex++)
+	{
+		Quads[QuadIndex]->ForEachElement(Box, Func);
+	}
+}
+
+template <typename ElementType, int32 NodeCapacity>
+template <typename ElementAllocatorType>
+void TQuadTree<ElementType, NodeCapacity>::GetElementsForBoxes(TArrayView<const FBox2D> Boxes, TArray<ElementType, ElementAllocatorType>& ElementsOut, TArray<int32>& QueryOffsetsOut) const
+{
+	TArray<int32> QueryIndices;
+	QueryIndices.SetNumUninitialized(Boxes.Num());
+	for (int32 QueryIndex = 0; QueryIndex < Boxes.Num(); ++QueryIndex)
+	{
+		QueryIndices[QueryIndex] = QueryIndex;
+	}
+
+	TArray<TPair<int32, ElementType>> Hits;
+	GetElementsForBoxesRecursive(Boxes, QueryIndices, Hits);
+
+	// Group the hits by query, keeping the order they were found in
+	QueryOffsetsOut.Reset(Boxes.Num() + 1);
+	QueryOffsetsOut.AddZeroed(Boxes.Num() + 1);
+	for (const TPair<int32, ElementType>& Hit : Hits)
+	{
+		++QueryOffsetsOut[Hit.Key + 1];
+	}
+	for (int32 QueryIndex = 0; QueryIndex < Boxes.Num(); ++QueryIndex)
+	{
+		QueryOffsetsOut[QueryIndex + 1] += QueryOffsetsOut[QueryIndex];
+	}
+
+	const int32 FirstOutput = ElementsOut.Num();
+	ElementsOut.AddUninitialized(Hits.Num());
+	TArray<int32, TInlineAllocator<64>> QueryEnds(QueryOffsetsOut.GetData(), Boxes.Num());
+	for (TPair<int32, ElementType>& Hit : Hits)
+	{
+		new(&ElementsOut[FirstOutput + QueryEnds[Hit.Key]++]) ElementType(MoveTemp(Hit.Value));
+	}
+
+	for (int32& QueryOffset : QueryOffsetsOut)
+	{
+		QueryOffset += FirstOutput;
+	}
+}
+
+template <typename ElementType, int32 NodeCapacity>
+void TQuadTree<ElementType, NodeCapacity>::GetElementsForBoxesRecursive(TArrayView<const FBox2D> Boxes, TArrayView<const int32> QueryIndices, TArray<TPair<int32, ElementType>>& HitsOut) const
+{
+	for (const FNode& Node : Nodes)
+	{
+		for (int32 QueryIndex : QueryIndices)
+		{
+			if (Boxes[QueryIndex].Intersect(Node.Box))
+			{
+				HitsOut.Emplace(QueryIndex, Node.Element);
+			}
+		}
+	}
+
+	if (!bInternal)
+	{
+		return;
+	}
+
+	// Only the boxes touching a subtree go down into it
+	TArray<int32, TInlineAllocator<64>> SubTreeQueries[4];
+	for (int32 QueryIndex : QueryIndices)
+	{
+		TreeType* Quads[4];
+		const int32 NumQuads = GetQuads(Boxes[QueryIndex], Quads);
+		for (int32 Quad = 0; Quad < NumQuads; ++Quad)
+		{
+			for (int32 SubTreeIndex = 0; SubTreeIndex < 4; ++SubTreeIndex)
+			{
+				if (SubTrees[SubTreeIndex] == Quads[Quad])
+				{
+					SubTreeQueries[SubTreeIndex].Add(QueryIndex);
+					break;
+				}
+			}
+		}
+	}
+
+	for (int32 SubTreeIndex = 0; SubTreeIndex < 4; ++SubTreeIndex)
+	{
+		if (SubTreeQueries[SubTreeIndex].Num())
+		{
+			SubTrees[SubTreeIndex]->GetElementsForBoxesRecursive(Boxes, SubTreeQueries[SubTreeIndex], HitsOut);
+		}
+	}
+}
+
 template <typename ElementType, int32 NodeCapacity>
 template <typename ElementAllocatorType>
 void TQuadTree<ElementType, NodeCapacity>::GetIntersectingElements(const FBox2D& Box, TArray<ElementType, ElementAllocatorType>& ElementsOut) const
@@ -9,12 +9,21 @@ ImageUtils.h: Image utility functions.
 #include "CoreMinimal.h"
 #include "Misc/Guid.h"
 #include "Engine/Texture.h"
+#include "Async/Future.h"
 
 class UTexture2D;
 class UTextureCube;
 class UTextureRenderTarget2D;
 class UTextureRenderTargetCube;
 
+/** Formats FImageUtils::CompressImageAsync can compress to */
+enum class EImageCompressionFormat : uint8
+{
+	PNG,
+	JPEG,
+	EXR,
+};
+
 /**
  *	Parameters used for creating a Texture2D frmo a simple color buffer.
  */
@@ -122,6 +131,19 @@ public:
 	 */
 	ENGINE_API static void CompressImageArray( int32 ImageWidth, int32 ImageHeight, const TArray<FColor> &SrcData, TArray<uint8> &DstData );
 
+	/**
+	 * Compresses an image on a thread pool worker, so large images (screenshots, captures) don't stall the calling thread.
+	 * Several images compressed at once are compressed in parallel. Must be called on the game thread.
+	 *
+	 * @param ImageWidth		Source image width.
+	 * @param ImageHeight		Source image height.
+	 * @param SrcData			Raw image array, BGRA. Moved to the worker.
+	 * @param Format			Format to compress to.
+	 * @param Quality			Quality passed to the image wrapper, 0 for the format's default.
+	 * @return					The compressed image once done, empty if it couldn't be compressed.
+	 */
+	ENGINE_API static TFuture<TArray64<uint8>> CompressImageAsync(int32 ImageWidth, int32 ImageHeight, TArray<FColor>&& SrcData, EImageCompressionFormat Format = EImageCompressionFormat::PNG, int32 Quality = 0);
+
 	/**
 	 * Creates a new UTexture2D with a checkerboard pattern.
 	 *
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/HitchCapture.h"
 
 struct ENGINE_API FInGameCycleHistory
 {
@@ -205,3 +206,75 @@ public:
 		return InGamePerformanceTrackers[Tracker][Thread];
 	}
 };
+
+/**
+ * Named timers of the time spent per frame in each subsystem (replication, animation, physics, streaming, audio...),
+ * recorded by the performance tracking charts. Timers accumulate from any thread while performance data is being
+ * consumed (e.g. during an FPS chart) and are handed to the consumers every frame, see IPerformanceDataConsumer.
+ */
+struct ENGINE_API FPerformanceTrackingTimers
+{
+	/** Maximum number of timers that can be registered */
+	static const int32 MaxTimers = 32;
+
+	/** Registers a timer, or returns the existing timer with that name. Returns INDEX_NONE once MaxTimers are registered. Thread safe. */
+	static int32 RegisterTimer(FName TimerName);
+
+	static int32 GetNumTimers() { return NumTimers; }
+	static FName GetTimerName(int32 TimerIndex);
+
+	/** Whether timers accumulate, only while performance data is consumed */
+	FORCEINLINE static bool IsEnabled() { return bEnabled; }
+	static void SetEnabled(bool bInEnabled);
+
+	/** Adds cycles to a timer for the current frame. Thread safe. */
+	FORCEINLINE static void AddCycles(int32 TimerIndex, uint32 Cycles)
+	{
+		checkSlow(TimerIndex >= 0 && TimerIndex < MaxTimers);
+		FPlatformAtomics::InterlockedAdd(&FrameCycles[TimerIndex], (int64)Cycles);
+	}
+
+	/** Gets the time accumulated by every timer since the last call, in seconds, and restarts the timers. */
+	static void ConsumeFrameTimes(TArray<double, TInlineAllocator<MaxTimers>>& OutSeconds);
+
+private:
+	static bool bEnabled;
+	static volatile int32 NumTimers;
+	static volatile int64 FrameCycles[MaxTimers];
+};
+
+/** Times a scope for a performance tracking timer, and records it for FHitchCapture */
+class FScopedPerformanceTrackingTimer
+{
+private:
+	int32 TimerIndex;
+	uint64 BeginCycles;
+
+public:
+	FORCEINLINE FScopedPerformanceTrackingTimer(int32 InTimerIndex)
+	: TimerIndex((FPerformanceTrackingTimers::IsEnabled() || FHitchCapture::IsEnabled()) ? InTimerIndex : INDEX_NONE)
+	, BeginCycles(TimerIndex != INDEX_NONE ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	FORCEINLINE ~FScopedPerformanceTrackingTimer()
+	{
+		if (TimerIndex != INDEX_NONE)
+		{
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+			if (FPerformanceTrackingTimers::IsEnabled())
+			{
+				FPerformanceTrackingTimers::AddCycles(TimerIndex, (uint32)(EndCycles - BeginCycles));
+			}
+			if (FHitchCapture::IsEnabled())
+			{
+				FHitchCapture::RecordEvent(TimerIndex, BeginCycles, EndCycles);
+			}
+		}
+	}
+};
+
+/** Adds the time spent in the enclosing scope to the performance tracking timer TimerName, e.g. SCOPE_PERFORMANCE_TRACKING_TIMER(Physics) */
+#define SCOPE_PERFORMANCE_TRACKING_TIMER(TimerName) \
+	static const int32 PREPROCESSOR_JOIN(PerformanceTrackingTimer_, TimerName) = FPerformanceTrackingTimers::RegisterTimer(TEXT(#TimerName)); \
+	FScopedPerformanceTrackingTimer PREPROCESSOR_JOIN(ScopedPerformanceTrackingTimer_, TimerName)(PREPROCESSOR_JOIN(PerformanceTrackingTimer_, TimerName));
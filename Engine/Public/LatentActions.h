@@ -34,12 +34,14 @@ protected:
 	TArray< FExecutionInfo, TInlineAllocator<4> > LinksToExecute;
 	bool bRemoveAction;
 	float DeltaTime;
+	float WaitTime;
 
 	friend struct FLatentActionManager;
 public:
 	FLatentResponse(float InDeltaTime)
 		: bRemoveAction(false)
 		, DeltaTime(InDeltaTime)
+		, WaitTime(0.f)
 	{
 	}
 
@@ -65,6 +67,16 @@ public:
 		return *this;
 	}
 
+	/**
+	 * Tells the manager the action has nothing to do for the next Seconds, e.g. because it is only counting down.
+	 * It is not updated again until then, and ElapsedTime() on that update covers the whole wait.
+	 */
+	FLatentResponse& WaitFor(float Seconds)
+	{
+		WaitTime = Seconds;
+		return *this;
+	}
+
 	float ElapsedTime() const { return DeltaTime; }
 };
 
@@ -98,4 +110,13 @@ public:
 	// Returns a human readable description of the latent operation's current state
 	virtual FString GetDescription() const;
 #endif
+
+private:
+	friend struct FLatentActionManager;
+
+	// Time on the owning object's latent clock when this action was last updated
+	double LastUpdateTime = 0.0;
+
+	// Time on the owning object's latent clock before which this action is not updated, 0 if it is updated every frame
+	double NextUpdateTime = 0.0;
 };
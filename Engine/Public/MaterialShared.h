@@ -2297,6 +2297,11 @@ public:
 
 	ENGINE_API virtual FString GetMaterialUsageDescription() const override;
 
+#if WITH_EDITOR
+	/** Drops the shader map IDs shared between equivalent material instances, see r.Material.InstanceShaderMapIdCache */
+	ENGINE_API static void EmptyInstanceShaderMapIdCache();
+#endif
+
 	// FMaterial interface.
 	ENGINE_API virtual void GetShaderMapId(EShaderPlatform Platform, const ITargetPlatform* TargetPlatform, FMaterialShaderMapId& OutId) const override;
 #if WITH_EDITORONLY_DATA
@@ -2468,6 +2473,8 @@ class FMaterialUpdateContext
 	EShaderPlatform ShaderPlatform;
 	/** True if the SyncWithRenderingThread option was specified. */
 	bool bSyncWithRenderingThread;
+	/** Context of the active FMaterialUpdateContextBatchScope this context adds its materials to, if any. */
+	FMaterialUpdateContext* BatchContext;
 
 public:
 
@@ -2507,6 +2514,22 @@ public:
 	ENGINE_API void AddMaterialInterface(UMaterialInterface* Instance);
 };
 
+/**
+ * Batches every FMaterialUpdateContext created on the game thread within its scope for the same shader platform.
+ * Those contexts add their materials to the scope's own context instead of updating anything themselves, so updating
+ * many materials in sequence, e.g. reloading a material library, flushes rendering, recaches instances and recreates
+ * render states once when the scope ends rather than once per material. Nested scopes join the outermost one.
+ */
+class FMaterialUpdateContextBatchScope
+{
+public:
+	explicit ENGINE_API FMaterialUpdateContextBatchScope(uint32 Options = FMaterialUpdateContext::EOptions::Default, EShaderPlatform InShaderPlatform = GMaxRHIShaderPlatform);
+	ENGINE_API ~FMaterialUpdateContextBatchScope();
+
+private:
+	TUniquePtr<FMaterialUpdateContext> Context;
+};
+
 /**
  * Check whether the specified texture is needed to render the material instance.
  * @param Texture	The texture to check.
@@ -261,6 +261,9 @@ public:
 	/** Whether or not we've already replicated properties this frame. */
 	uint32 bHasReplicatedProperties : 1;
 
+	/** Dirty key of the registered subobject entry last sent through this replicator, 0 if it needs to be compared again. See FReplicatedSubObjectInfo */
+	uint32 LastSentSubObjectDirtyKey;
+
 private:
 
 	/** Whether or not we are going to use Fast Array Delta Struct Delta Serialization. See FFastArraySerializer::FastArrayDeltaSerialize_DeltaSerializeStructs. */
@@ -293,6 +293,69 @@ private:
 	uint32 CurrentRunOfSaturatedReplications;
 };
 
+/**
+ * Struct wrapping Per Net Connection replication starvation analytics.
+ * Tracks how long actors waited to replicate after being skipped because the connection was saturated
+ * or ran out of its replication budget (see net.ConnectionReplicationByteBudget).
+ */
+struct ENGINE_API FNetConnectionStarvationAnalytics
+{
+public:
+
+	enum { NumberOfBuckets = 6 };
+
+	FNetConnectionStarvationAnalytics()
+	{
+		Reset();
+	}
+
+	/** The upper bound (in seconds) of the given histogram bucket. The last bucket has no upper bound. */
+	static float GetBucketUpperBoundSeconds(const int32 BucketIndex);
+
+	/** The number of starved actor updates whose starvation time fell into the given histogram bucket. */
+	const uint32 GetBucketCount(const int32 BucketIndex) const
+	{
+		return StarvationHistogram[BucketIndex];
+	}
+
+	/** The total number of actor updates that were sent after having been starved. */
+	const uint32 GetNumberOfStarvedUpdates() const
+	{
+		return NumberOfStarvedUpdates;
+	}
+
+	/** The longest time (in seconds) an actor was starved before it was sent. */
+	const float GetLongestStarvationSeconds() const
+	{
+		return LongestStarvationSeconds;
+	}
+
+	/** The number of replication attempts that stopped early because the connection ran out of its byte or CPU budget. */
+	const uint32 GetNumberOfBudgetLimitedReplications() const
+	{
+		return NumberOfBudgetLimitedReplications;
+	}
+
+	/** Resets the state of tracking. */
+	void Reset();
+
+private:
+
+	friend class UNetConnection;
+
+	void TrackStarvation(const float StarvationSeconds);
+
+	void TrackBudgetLimitedReplication()
+	{
+		++NumberOfBudgetLimitedReplications;
+	}
+
+	uint32 StarvationHistogram[NumberOfBuckets];
+	uint32 NumberOfStarvedUpdates;
+	float LongestStarvationSeconds;
+	uint32 NumberOfBudgetLimitedReplications;
+};
+
 /** Struct wrapper Per Net Connection analytics for things like packet loss and jitter. */
 struct ENGINE_API FNetConnectionPacketAnalytics
 {
@@ -249,6 +249,7 @@ struct FRepSerializationSharedInfo
 		if (bIsValid)
 		{
 			SharedPropertyInfo.Reset();
+			SharedPropertyInfoIndex.Reset();
 			SerializedProperties->Reset();
 
 			bIsValid = false;
@@ -275,9 +276,26 @@ struct FRepSerializationSharedInfo
 		const bool bWriteHandle,
 		const bool bDoChecksum);
 
+	/**
+	 * Finds the shared data for a property, if it has been written.
+	 *
+	 * @param PropertyGuid		The guid used when the property was written.
+	 *
+	 * @return The shared property info, or nullptr if this property hasn't been shared.
+	 *			The pointer is only valid until the next call to WriteSharedProperty.
+	 */
+	const FRepSerializedPropertyInfo* FindSharedProperty(const FGuid& PropertyGuid) const
+	{
+		const int32* InfoIndex = SharedPropertyInfoIndex.Find(PropertyGuid);
+		return InfoIndex ? &SharedPropertyInfo[*InfoIndex] : nullptr;
+	}
+
 	/** Metadata for properties in the shared data blob. */
 	TArray<FRepSerializedPropertyInfo> SharedPropertyInfo;
 
+	/** Maps property guids to their index in SharedPropertyInfo, so per connection lookups don't need a linear search. */
+	TMap<FGuid, int32> SharedPropertyInfoIndex;
+
 	/** Binary blob of net serialized data to be shared */
 	TUniquePtr<FNetBitWriter> SerializedProperties;
 
@@ -1014,6 +1032,96 @@ enum class ERepLayoutFlags : uint8
 };
 ENUM_CLASS_FLAGS(ERepLayoutFlags);
 
+/** Replication cost counters gathered while net.RepLayoutCostTracking is enabled. */
+struct FRepLayoutCostCounters
+{
+	/** Cycles spent comparing properties against the shadow state. */
+	uint64 CompareCycles = 0;
+
+	/** Cycles spent serializing changed properties. */
+	uint64 SendCycles = 0;
+
+	/** Bits written for changed properties, including shared serialization copies. */
+	uint64 SendBits = 0;
+
+	uint32 NumCompares = 0;
+	uint32 NumSends = 0;
+
+	void Add(const FRepLayoutCostCounters& Other)
+	{
+		CompareCycles += Other.CompareCycles;
+		SendCycles += Other.SendCycles;
+		SendBits += Other.SendBits;
+		NumCompares += Other.NumCompares;
+		NumSends += Other.NumSends;
+	}
+
+	bool IsEmpty() const
+	{
+		return NumCompares == 0 && NumSends == 0;
+	}
+};
+
+/** CSV stat names for a set of FRepLayoutCostCounters, cached so reporting doesn't build strings every frame. */
+struct FRepLayoutCostStatNames
+{
+	FName CompareMS;
+	FName SendMS;
+	FName SendBits;
+};
+
+/**
+ * Replication cost of a single FRepLayout. Frame counters are folded into the totals by
+ * FRepLayoutCostTracker::EndFrame, after being reported as CSV stats.
+ */
+struct FRepLayoutCost
+{
+	FRepLayoutCostCounters Frame;
+	FRepLayoutCostCounters Total;
+
+	/** Per FRepParentCmd counters, only gathered when net.RepLayoutCostTracking is 2. */
+	TArray<FRepLayoutCostCounters> ParentFrame;
+	TArray<FRepLayoutCostCounters> ParentTotal;
+
+	FRepLayoutCostStatNames StatNames;
+
+	/** Per FRepParentCmd stat names, created the first time a property is reported. */
+	TArray<FRepLayoutCostStatNames> ParentStatNames;
+};
+
+/**
+ * Aggregates replication CPU and bandwidth cost per FRepLayout (and optionally per property) while
+ * net.RepLayoutCostTracking is enabled. Costs are reported every frame in the ReplicationCost CSV category,
+ * and can be dumped to the log with net.RepLayoutCost.Dump.
+ */
+class ENGINE_API FRepLayoutCostTracker
+{
+public:
+
+	/** @return True if per layout costs should be gathered. */
+	static bool IsEnabled();
+
+	/** @return True if per property costs should be gathered as well. */
+	static bool IsPerPropertyEnabled();
+
+	/** Reports the costs gathered during the current frame and folds them into the totals. Only does work once per engine frame. */
+	static void EndFrame();
+
+	/** Logs the accumulated totals, most expensive layouts first. */
+	static void Dump(FOutputDevice& Ar, const int32 MaxLayouts);
+
+	/** Clears all accumulated costs. */
+	static void Reset();
+
+private:
+
+	friend class FRepLayout;
+
+	static FRepLayoutCost& FindOrAddCost(const FRepLayout& RepLayout);
+
+	static void RemoveLayout(const FRepLayout& RepLayout);
+};
+
 
 /**
  * This class holds all replicated properties for a given type (either a UClass, UStruct, or UFunction).
@@ -1478,6 +1586,8 @@ private:
 	 * @param Writer			Writer used to store / write out the replicated properties.
 	 * @param Changed			Aggregate list of property handles that need to be written.
 	 * @param SharedInfo		Shared Serialization state for properties.
+	 *							If valid, shareable properties missing from it are added the first time they're sent,
+	 *							so other connections receiving the same history can copy them.
 	 */
 	void SendProperties(
 		FSendingRepState* RESTRICT RepState,
@@ -1486,7 +1596,7 @@ private:
 		UClass* ObjectClass,
 		FNetBitWriter& Writer,
 		TArray<uint16>& Changed,
-		const FRepSerializationSharedInfo& SharedInfo) const;
+		FRepSerializationSharedInfo& SharedInfo) const;
 
 	/**
 	 * Clamps a changelist so that it conforms to the current size of either an array, or arrays within structs/arrays.
@@ -1544,7 +1654,7 @@ private:
 		FRepHandleIterator& HandleIterator,
 		const FConstRepObjectDataBuffer SourceData,
 		const int32	 ArrayDepth,
-		const FRepSerializationSharedInfo* const RESTRICT SharedInfo) const;
+		FRepSerializationSharedInfo* const RESTRICT SharedInfo) const;
 
 	void BuildSharedSerialization(
 		const FConstRepObjectDataBuffer Data,
@@ -1759,6 +1869,15 @@ private:
 
 	const ELifetimeCondition GetLifetimeCustomDeltaPropertyCondition(const uint16 RepIndCustomDeltaPropertyIndexex) const;
 
+	/** @return The cost entry to gather into, or nullptr if net.RepLayoutCostTracking is disabled. */
+	FRepLayoutCost* GetTrackedCost() const
+	{
+		return FRepLayoutCostTracker::IsEnabled() ? &FRepLayoutCostTracker::FindOrAddCost(*this) : nullptr;
+	}
+
+	friend class FRepLayoutCostTracker;
+	friend class FRepLayoutBenchmark;
+
 	ERepLayoutFlags Flags;
 
 	/** Size (in bytes) needed to allocate a single instance of a Shadow buffer for this RepLayout. */
@@ -1792,4 +1911,7 @@ private:
 	/** Properties that have push model enabled. */
 	TBitArray<> PushModelProperties;
 #endif
+
+	/** Replication cost gathered for this layout, see FRepLayoutCostTracker. Owned by the tracker. */
+	mutable FRepLayoutCost* TrackedCost = nullptr;
 };
\ No newline at end of file
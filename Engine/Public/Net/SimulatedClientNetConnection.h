@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Engine/NetConnection.h"
+#include "Math/RandomStream.h"
+
+#include "SimulatedClientNetConnection.generated.h"
+
+/**
+ * In-process client connection used to load a server without real clients, see the Net.LoadSim commands.
+ * Everything replicated to the connection is serialized as for a real client and then discarded, and the connection
+ * acks its own packets so it never saturates or times out. Its pawn is moved by the simulation instead of by ServerMove RPCs.
+ */
+UCLASS(transient)
+class ENGINE_API USimulatedClientNetConnection : public UNetConnection
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Seeds the movement of the simulated client, so runs with the same number of clients move the same way */
+	void InitSimulatedMovement(int32 Seed);
+
+	/** Sends the move of the simulated client for this frame straight to the movement component of its character */
+	void TickSimulatedMovement(float DeltaSeconds);
+
+	/** Bytes sent to the connection since it was opened */
+	int64 GetSimulatedBytesSent() const { return SimulatedBytesSent; }
+
+	// UNetConnection interface.
+	virtual void InitConnection(class UNetDriver* InDriver, EConnectionState InState, const FURL& InURL, int32 InConnectionSpeed = 0, int32 InMaxPacket = 0) override;
+	virtual FString LowLevelGetRemoteAddress(bool bAppendPort = false) override;
+	virtual FString LowLevelDescribe() override;
+	virtual void LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
+	virtual int32 IsNetReady(bool Saturate) override;
+	virtual TSharedPtr<const FInternetAddr> GetRemoteAddr() override { return nullptr; }
+	virtual bool ClientHasInitializedLevelFor(const AActor* TestActor) const override { return true; }
+
+private:
+	FRandomStream MovementStream;
+
+	/** Client time stamp of the last move, as the client would send it */
+	float MoveTimeStamp;
+
+	/** Direction the client is walking towards and how long until it picks another one */
+	FRotator MoveHeading;
+	float MoveHeadingTimeLeft;
+
+	int64 SimulatedBytesSent;
+};
@@ -304,5 +304,8 @@ private:
 
 	/** The magic header which is prepended to all packets */
 	TBitArray<> MagicHeader;
+
+	/** Buffer the next outgoing packet is written to, swapped with the packet being sent so neither is reallocated per packet */
+	FBitWriter OutgoingPacketBuffer;
 };
 
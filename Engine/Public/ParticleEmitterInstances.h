@@ -58,6 +58,28 @@ class UParticleModuleTrailSource;
 class UParticleModuleSpawnPerUnit;
 
 class UParticleModuleOrientationAxisLock;
+class UParticleModuleCollision;
+struct FBatchedTraceQuery;
+
+/**
+ * Collision rays of the particles of an emitter instance, traced as one batched query whose results are used during the next update.
+ * See UParticleModuleCollision::bUseBatchedCollision.
+ */
+struct FParticleCollisionBatch
+{
+	/** The module the rays are traced for */
+	const UParticleModuleCollision* Module = nullptr;
+	/** Rays gathered during the current update, in world space */
+	TArray<FVector> Starts;
+	TArray<FVector> Ends;
+	/** Half extent of the sweeps, zero for line traces */
+	FVector Extent = FVector::ZeroVector;
+	/** Generation the rays gathered during the current update are tagged with */
+	uint32 StagedGeneration = 0;
+	/** Query tracing the rays of the previous update, and the generation they were tagged with */
+	TSharedPtr<FBatchedTraceQuery, ESPMode::ThreadSafe> PendingQuery;
+	uint32 PendingGeneration = 0;
+};
 
 class UParticleLODLevel;
 
@@ -326,6 +348,8 @@ public:
 	float CurrentDelay;
 	/** true if the emitter has no active particles and will no longer spawn any in the future */
 	bool bEmitterIsDone;
+	/** Batched collision rays of each collision module that uses them. */
+	TArray<FParticleCollisionBatch> CollisionBatches;
 
 	/** The number of triangles to render								*/
 	int32	TrianglesToRender;
@@ -483,6 +507,12 @@ public:
 	virtual void ForceSpawn(float DeltaTime, int32 InSpawnCount, int32 InBurstCount, FVector& InLocation, FVector& InVelocity);
 	void CheckSpawnCount(int32 InNewCount, int32 InMaxCount);
 
+	/** Returns the batched collision rays of a collision module, creating them on first use. */
+	FParticleCollisionBatch& FindOrAddCollisionBatch(const UParticleModuleCollision* Module);
+
+	/** Traces the collision rays gathered during the update, for the next update to use. Game thread only. */
+	void SubmitCollisionBatches();
+
 	/**
 	 * Handle any pre-spawning actions required for particles
 	 *
@@ -98,6 +98,16 @@ const int32 PDM_DefaultValue = 0xFFFF;
 		CurrentOffset = Offset;																							\
 		continue;
 
+/** Prefetches the first particle visited by BEGIN_UPDATE_LOOP, update loops run from the last active particle down. */
+#define PREFETCH_FIRST_UPDATE_PARTICLE(Owner)																			\
+	FPlatformMisc::Prefetch((Owner)->ParticleData, ((Owner)->ParticleIndices[(Owner)->ActiveParticles - 1] * (Owner)->ParticleStride));	\
+	FPlatformMisc::Prefetch((Owner)->ParticleData, ((Owner)->ParticleIndices[(Owner)->ActiveParticles - 1] * (Owner)->ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+
+/** Prefetches the particle visited after the current one, only valid inside BEGIN_UPDATE_LOOP / END_UPDATE_LOOP. */
+#define PREFETCH_NEXT_UPDATE_PARTICLE																					\
+	FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[FMath::Max(i - 1, 0)] * ParticleStride));					\
+	FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[FMath::Max(i - 1, 0)] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+
 #define SPAWN_INIT																										\
 	check((Owner != NULL) && (Owner->Component != NULL));																\
 	const int32		ActiveParticles	= Owner->ActiveParticles;															\
@@ -120,6 +130,22 @@ const int32 PDM_DefaultValue = 0xFFFF;
 	Helper functions.
 -----------------------------------------------------------------------------*/
 
+/**
+ * FBaseParticle is laid out in 16 byte rows of a vector followed by a scalar, e.g. Velocity and BaseRotationRate.
+ * These update the vector of such a row with single SIMD operations, leaving the scalar sharing the row untouched.
+ */
+FORCEINLINE void Particle_AddToRowXYZ(FVector& RowXYZ, const VectorRegister& Delta)
+{
+	const VectorRegister Row = VectorLoad(&RowXYZ);
+	VectorStore(VectorMergeVecXYZ_VecW(VectorAdd(Row, Delta), Row), &RowXYZ);
+}
+
+FORCEINLINE void Particle_MultiplyRowXYZ(FVector& RowXYZ, const VectorRegister& Scale)
+{
+	const VectorRegister Row = VectorLoad(&RowXYZ);
+	VectorStore(VectorMergeVecXYZ_VecW(VectorMultiply(Row, Scale), Row), &RowXYZ);
+}
+
 inline void Particle_SetColorFromVector(const FVector& InColorVec, const float InAlpha, FLinearColor& OutColor)
 {
 	OutColor.R = InColorVec.X;
@@ -323,6 +349,7 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("DynUntracked Mem Max"),STAT_DynamicUntra
 // GPU Particle stats.
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sprites"),STAT_GPUSpriteParticles,STATGROUP_GPUParticles, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sprites Spawned"),STAT_GPUSpritesSpawned,STATGROUP_GPUParticles, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sprites Truncated"),STAT_GPUSpritesTruncated,STATGROUP_GPUParticles, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sorted Emitters"),STAT_SortedGPUEmitters,STATGROUP_GPUParticles, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sorted Particles"),STAT_SortedGPUParticles,STATGROUP_GPUParticles, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Free Tiles"),STAT_FreeGPUTiles,STATGROUP_GPUParticles, );
@@ -968,6 +995,10 @@ struct FParticleCollisionPayload
 	FVector	UsedDampingFactorRotation;
 	int32		UsedCollisions;
 	float	Delay;
+	/** Index of the particle's ray in the batched collision query of its emitter, see UParticleModuleCollision::bUseBatchedCollision */
+	int32	BatchedQueryIndex;
+	/** Generation of the batch the ray was traced in, 0 if none */
+	uint32	BatchedQueryGeneration;
 };
 
 /** Collision module per instance payload */
@@ -2159,6 +2190,9 @@ struct FDynamicBeam2EmitterData : public FDynamicSpriteEmitterDataBase
 	/** Perform the actual work of filling the buffer */
 	virtual void DoBufferFill(FAsyncBufferFillData& Me) const override;
 
+	/** Fills the vertices only, they don't depend on the indices */
+	void DoVertexBufferFill(FAsyncBufferFillData& Me) const;
+
 	/**
 	 *	Get the vertex stride for the dynamic rendering data
 	 */
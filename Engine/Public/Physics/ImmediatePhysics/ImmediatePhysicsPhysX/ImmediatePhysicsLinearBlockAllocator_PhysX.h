@@ -31,10 +31,11 @@ namespace ImmediatePhysics_PhysX
 		FPageStruct* FreePage;
 		FPageStruct* FirstPage;
 
+		/** The first page is allocated on first use, allocators that are never used (see FSimulation::SimulateBatch) don't cost a page */
 		FLinearBlockAllocator()
+			: FreePage(nullptr)
+			, FirstPage(nullptr)
 		{
-			FreePage = AllocPage();
-			FirstPage = FreePage;
 		}
 
 		FPageStruct* AllocPage()
@@ -57,6 +58,12 @@ namespace ImmediatePhysics_PhysX
 			check(Bytes < PageBufferSize);	//Page size needs to be increased since we don't allow spillover
 			if (Bytes)
 			{
+				if (!FirstPage)
+				{
+					FreePage = AllocPage();
+					FirstPage = FreePage;
+				}
+
 				//Assumes 16 byte alignment
 				int32 BytesLeft = PageBufferSize - FreePage->SeekPosition;	//don't switch to uint because negative implies we're out of 16 byte aligned space
 				if (BytesLeft < Bytes)
@@ -98,6 +105,11 @@ namespace ImmediatePhysics_PhysX
 
 		void Empty()
 		{
+			if (!FirstPage)
+			{
+				return;
+			}
+
 			FPageStruct* CurrentPage = FirstPage->NextPage;
 			while (CurrentPage)
 			{
@@ -115,7 +127,10 @@ namespace ImmediatePhysics_PhysX
 		~FLinearBlockAllocator()
 		{
 			Empty();
-			ReleasePage(FirstPage);
+			if (FirstPage)
+			{
+				ReleasePage(FirstPage);
+			}
 		}
 
 	private:
@@ -102,6 +102,20 @@ namespace ImmediatePhysics_PhysX
 		void Simulate(float DeltaTime, const FVector& Gravity);
 		void Simulate_AssumesLocked(float DeltaTime, const FVector& Gravity);
 
+		/** A simulation to advance with SimulateBatch, and how far */
+		struct FSimulateBatchItem
+		{
+			FSimulation* Simulation;
+			float DeltaTime;
+			FVector Gravity;
+		};
+
+		/**
+		 * Advance many simulations in one call, spread over the task graph workers. The simulations share the per step workspace memory
+		 * of the thread that steps them, so hundreds of small simulations don't each need their own.
+		 */
+		static void SimulateBatch(TArrayView<const FSimulateBatchItem> Items);
+
 		/** Whether or not an entity is simulated */
 		bool IsSimulated(int32 ActorDataIndex) const
 		{
@@ -154,6 +168,9 @@ namespace ImmediatePhysics_PhysX
 		/** Ensure arrays are valid */
 		void ValidateArrays() const;
 
+		/** Advance the simulation by DeltaTime, using the given memory for the per step allocations */
+		void Simulate_AssumesLocked(float DeltaTime, const FVector& Gravity, FLinearBlockAllocator& InWorkspace);
+
 		/** Constructs solver bodies */
 		void ConstructSolverBodies(float DeltaTime, const FVector& Gravity);
 
@@ -186,9 +203,12 @@ namespace ImmediatePhysics_PhysX
 		TArray<FActor> Actors;
 		TArray<FJoint> Joints;
 
-		/** Workspace memory that we use for per frame allocations */
+		/** Workspace memory that we use for per frame allocations, unless the simulation is stepped by SimulateBatch */
 		FLinearBlockAllocator Workspace;
 
+		/** Workspace used by the step in progress */
+		FLinearBlockAllocator* ActiveWorkspace;
+
 		/** Low level rigid body data */
 		TArray<immediate::PxRigidBodyData> RigidBodiesData;
 
@@ -291,6 +291,29 @@ private:
 	/** Completion events (task) for the physics scenes	(both apex and non-apex). This is a "join" of the above. */
 	FGraphEventRef PhysicsSceneCompletion;
 
+	/** Whether the scene steps at a fixed rate ahead of the game frame (see p.AsyncFixedStepPhysics) instead of simulating each frame */
+	bool bAsyncFixedStep;
+
+	/** Set while a fixed step is starting, inputs are then applied to the bodies instead of being queued for the next step */
+	bool bApplyingAsyncFixedStepInputs;
+
+	/** Game time that no fixed step has been started for yet */
+	float AsyncFixedStepAccumulator;
+
+	/** Completion event (not task) of the fixed step in flight, fired by the physics system when it is done */
+	FGraphEventRef AsyncFixedStepCompletion;
+
+	/** Poses of a body at the end of the last two fixed steps, its component is presented in between */
+	struct FAsyncFixedStepPose
+	{
+		TWeakObjectPtr<UPrimitiveComponent> OwningComp;
+		FTransform Previous;
+		FTransform Current;
+	};
+
+	/** Bodies that moved in the last two fixed steps */
+	TMap<FBodyInstance*, FAsyncFixedStepPose> AsyncFixedStepPoses;
+
 	// Data for scene scratch buffers, these will be allocated once on FPhysScene construction and used
 	// for the calls to PxScene::simulate to save it calling into the OS to allocate during simulation
 	FSimulationScratchBuffer SimScratchBuffer;
@@ -371,6 +394,24 @@ private:
 	/** Task created from TickPhysScene so we can substep without blocking */
 	bool SubstepSimulation(FGraphEventRef& InOutCompletionEvent);
 
+	/** Used by StartFrame instead of TickPhysScene in fixed step mode: finishes the step in flight once it's done, starts the steps that are due and presents the components in between the last two steps */
+	void TickAsyncFixedStep();
+
+	/** Applies the queued inputs and starts simulating the next fixed step */
+	void StartAsyncFixedStep(float StepSeconds);
+
+	/** Waits for the fixed step in flight and fetches its results */
+	void FinishAsyncFixedStep();
+
+	/** Moves the components of the bodies that moved in the last two fixed steps to their poses blended by Alpha */
+	void PresentAsyncFixedStepPoses(float Alpha);
+
+	/** @return Whether inputs to bodies are queued for the next (sub)step instead of being applied now */
+	bool ShouldQueueInput(bool bAllowSubstepping) const;
+
+	/** @return Scale for the forces added this frame, so forces added every frame sum up to the same impulse whatever the frame rate is in fixed step mode */
+	float GetQueuedForceScale() const;
+
 	/** Set whether we're doing a static load and want to stall, or are during gameplay and want to distribute over many frames */
 	void SetIsStaticLoading(bool bStaticLoading);
 
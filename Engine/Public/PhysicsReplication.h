@@ -69,6 +69,16 @@ protected:
 	/** Called when a dynamic rigid body receives a physics update */
 	virtual bool ApplyRigidBodyState(float DeltaSeconds, FBodyInstance* BI, FReplicatedPhysicsTarget& PhysicsTarget, const FRigidBodyErrorCorrection& ErrorCorrection, const float PingSecondsOneWay);
 
+	/**
+	 * Same as OnTick, but applies the targets of every body in the physics scene together: current states are read under one scene lock,
+	 * the linear error correction is computed four bodies at a time and the new states are written under one scene write lock.
+	 * Bodies that don't have their own actor in the scene, e.g. welded ones, still go through ApplyRigidBodyState.
+	 */
+	void OnTickBatched(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets);
+
+	/** Whether OnTick may use OnTickBatched, see p.BatchPhysicsReplication. Subclasses overriding ApplyRigidBodyState should return false to keep it called for every body. */
+	virtual bool CanBatchRigidBodyStates() const { return true; }
+
 	UWorld* GetOwningWorld();
 	const UWorld* GetOwningWorld() const;
 
@@ -80,8 +90,46 @@ private:
 	/** Get the ping from  */
 	float GetOwnerPing(const AActor* const Owner, const FReplicatedPhysicsTarget& Target) const;
 
+	/** Per body data of OnTickBatched, kept between ticks to avoid reallocating it */
+	struct FBatchedBodies
+	{
+		/** Sizes the arrays below for the gathered bodies */
+		void SetNumBodies(int32 NumBodies);
+
+		/** Gathered bodies, with their targets and ping */
+		TArray<FBodyInstance*> Bodies;
+		TArray<FReplicatedPhysicsTarget*> Targets;
+		TArray<float> PingSecondsOneWay;
+
+		/** Linear state, one float per body and padded to a multiple of four bodies. TargetPos is extrapolated in place. */
+		TArray<float> CurrentPosX, CurrentPosY, CurrentPosZ;
+		TArray<float> TargetPosX, TargetPosY, TargetPosZ;
+		TArray<float> TargetLinVelX, TargetLinVelY, TargetLinVelZ;
+		TArray<float> PrevPosX, PrevPosY, PrevPosZ;
+		TArray<float> PrevPosTargetX, PrevPosTargetY, PrevPosTargetZ;
+		TArray<float> ExtrapolationSeconds;
+
+		/** Results of the linear error computation */
+		TArray<float> LinDiffX, LinDiffY, LinDiffZ;
+		TArray<float> LinDiffSize;
+		TArray<float> PrevProgress;
+		TArray<float> PrevSimilarity;
+
+		TArray<FQuat> CurrentQuats;
+
+		/** New state of each body, only written to the body if bWriteState is set */
+		TArray<FTransform> NewTransforms;
+		TArray<FVector> NewLinVels;
+		TArray<FVector> NewAngVels;
+		TArray<bool> bWriteState;
+		TArray<bool> bShouldSleep;
+		TArray<bool> bRestoredState;
+	};
+
 private:
 	TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget> ComponentToTargets;
 	FPhysScene* PhysScene;
 
+	FBatchedBodies BatchedBodies;
+
 };
\ No newline at end of file
@@ -92,6 +92,15 @@ struct FLightVolumeOctreeSemantics
 
 typedef TOctree<FVolumeLightingSample, FLightVolumeOctreeSemantics> FLightVolumeOctree;
 
+/** Lighting accumulated for one position by FPrecomputedLightVolume::InterpolateIncidentRadiancePoints, to be normalized by the weight once every volume has been interpolated. */
+struct FVolumeLightingInterpolation
+{
+	float AccumulatedWeight = 0.0f;
+	float AccumulatedDirectionalLightShadowing = 0.0f;
+	FSHVectorRGB3 AccumulatedIncidentRadiance;
+	FVector SkyBentNormal = FVector::ZeroVector;
+};
+
 /** Set of volume lighting samples belonging to one streaming level, which can be queried about the lighting at a given position. */
 class FPrecomputedLightVolumeData
 {
@@ -166,6 +175,15 @@ public:
 		float& AccumulatedDirectionalLightShadowing,
 		FSHVectorRGB3& AccumulatedIncidentRadiance,
 		FVector& SkyBentNormal) const;
+
+	/**
+	 * Interpolates incident radiance to many positions at once, accumulating into the matching entries of OutInterpolations.
+	 * Same results as InterpolateIncidentRadiancePoint for each position, but the octree is walked once for the whole batch
+	 * and each node's samples are only read once for all the positions inside it, the faster path when updating the lighting of many primitives.
+	 */
+	ENGINE_API void InterpolateIncidentRadiancePoints(
+		TArrayView<const FVector> Positions,
+		TArrayView<FVolumeLightingInterpolation> OutInterpolations) const;
 	
 	/** Interpolates incident radiance to Position. */
 	ENGINE_API void InterpolateIncidentRadianceBlock(
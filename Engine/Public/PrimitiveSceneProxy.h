@@ -464,6 +464,9 @@ public:
 	}	
 	inline float GetMinDrawDistance() const { return MinDrawDistance; }
 	inline float GetMaxDrawDistance() const { return MaxDrawDistance; }
+
+	/** Changes the min draw distance without recreating the proxy, the scene picks it up when the primitive's transform is next updated */
+	void SetMinDrawDistance_RenderThread(float InMinDrawDistance) { MinDrawDistance = InMinDrawDistance; }
 	inline int32 GetVisibilityId() const { return VisibilityId; }
 	inline int16 GetTranslucencySortPriority() const { return TranslucencySortPriority; }
 	inline bool HasMotionBlurVelocityMeshes() const { return bHasMotionBlurVelocityMeshes; }
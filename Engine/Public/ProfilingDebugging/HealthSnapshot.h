@@ -87,6 +87,9 @@ protected:
 	/** Snapshots performance stats if the given tracking chart is filled with FPS charting data (MeasuredPerfTime > 0)*/
 	virtual void CapturePerformanceStats(const FPerformanceTrackingChart* GameplayFPSChart);
 
+	/** Snapshots allocation rates since the previous snapshot if HealthSnapshot.TrackAllocations is enabled (AllocationFrames > 0) */
+	virtual void CaptureAllocationStats();
+
 	/* Dump a text blob describing all stats captured by the snapshot to the given output device with the given log category. */
 	virtual void DumpStats(FOutputDevice& Ar, FName CategoryName);
 
@@ -120,6 +123,19 @@ public:
 		float AvgTime;
 	};
 
+	// Allocation rate of a thread or growth of an LLM tag, per frame
+	struct FAllocationStat
+	{
+		FAllocationStat()
+			: Allocs(0)
+			, Frees(0)
+		{}
+
+		FString Name;
+		double Allocs;
+		double Frees;
+	};
+
 	template <typename T>
 	struct FMmaStat
 	{
@@ -146,6 +162,14 @@ public:
 #endif //PLATFORM_PS4
 	float LLMTotalMemoryMB;
 
+	/** Allocation data */
+	uint64 AllocationFrames; // Number of frames the following allocation values are averaged over
+	double AllocsPerFrame;
+	double FreesPerFrame;
+	TArray<FAllocationStat> ThreadAllocations; // Busiest threads, allocations and frees per frame
+	TArray<FAllocationStat> LLMTagGrowthKB; // LLM tags whose size changed the most, KB allocated (Allocs) or freed (Frees) per frame
+	FString TopAllocatorsReport; // Callsites tracked by FMallocLeakReporter sorted by allocation rate, if it's running
+
 	/** Performance data */
 	double MeasuredPerfTime; // Duration of time the following performance values came from
 	FThreadStat GameThread;
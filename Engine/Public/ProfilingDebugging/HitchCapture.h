@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Always-on capture of the frames around a hitch. While t.HitchCapture is enabled, every performance tracking timer scope
+ * (see FPerformanceTrackingTimers) is recorded into a small ring buffer of its thread, and the time of each thread is kept
+ * for the last few frames. When a frame takes longer than t.HitchCapture.ThresholdMS, the events of the last
+ * t.HitchCapture.NumFrames frames of every thread are written to Saved/Profiling/Hitches as a Chrome trace
+ * (chrome://tracing, Perfetto), timelines of the game thread, task graph workers and any other thread that recorded events.
+ *
+ * Recording an event is a couple of stores into memory only its thread writes, with no lock or allocation.
+ */
+struct ENGINE_API FHitchCapture
+{
+	/** Whether scopes are being recorded */
+	FORCEINLINE static bool IsEnabled() { return bEnabled; }
+
+	/** Records a scope of a performance tracking timer on the current thread */
+	static void RecordEvent(int32 TimerIndex, uint64 StartCycles, uint64 EndCycles);
+
+	/** Marks the end of a game thread frame, and writes a capture if the frame was a hitch. Called by the engine every frame. */
+	static void EndFrame();
+
+private:
+	static bool bEnabled;
+};
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+
+class UTextureRenderTarget2D;
+
+/** Pixels read back from a render target by FRenderTargetAsyncReadback */
+struct FRenderTargetReadbackResult
+{
+	/** False if the render target couldn't be read, its resource was released or its format isn't supported */
+	bool bSuccess = false;
+
+	/** Area of the render target that was read */
+	FIntRect Rect;
+
+	/** Format of the render target */
+	EPixelFormat Format = PF_Unknown;
+
+	/** Rect.Width() * Rect.Height() pixels, 8-bit BGRA in sRGB space. HDR render targets are converted from linear space. */
+	TArray<FColor> Pixels;
+
+	/** The pixels as-is, only filled for HDR render targets */
+	TArray<FLinearColor> LinearPixels;
+};
+
+/**
+ * Reads render targets back to the CPU without stalling the game thread, unlike FRenderTarget::ReadPixels which flushes rendering
+ * and waits for the GPU. The render thread copies the render target into a staging texture and writes a GPU fence behind the copy,
+ * the fence is polled every frame and the pixels are delivered on the game thread once the GPU is done, usually a frame or two later.
+ * Staging textures are pooled and reused by later reads of the same size and format.
+ *
+ * Supports PF_B8G8R8A8, PF_R8G8B8A8 and PF_FloatRGBA render targets.
+ */
+class ENGINE_API FRenderTargetAsyncReadback
+{
+public:
+	typedef TFunction<void(FRenderTargetReadbackResult&& Result)> FOnReadbackComplete;
+
+	/**
+	 * Reads Rect of the render target, the whole render target if Rect is empty. OnComplete is called on the game thread,
+	 * with the contents the render target has once the rendering commands enqueued before this call are done.
+	 */
+	static void ReadPixels(UTextureRenderTarget2D* RenderTarget, FOnReadbackComplete OnComplete, FIntRect Rect = FIntRect());
+
+	/** Number of reads whose results haven't been delivered yet */
+	static int32 GetNumPendingReads();
+};
@@ -473,6 +473,13 @@ public:
 
 	ENGINE_API int GetTexCoordSize();
 
+	/**
+	 * Converts full precision texture coordinates to half precision, if none of them moves by more than MaxError once converted.
+	 * Must be called before the RHI resources are initialized.
+	 * @return Whether the texture coordinates were converted
+	 */
+	ENGINE_API bool ConvertTexcoordsToHalfIfWithinError(float MaxError);
+
 	FORCEINLINE_DEBUGGABLE bool GetAllowCPUAccess()
 	{
 		if (!TangentsData || !TexcoordData)
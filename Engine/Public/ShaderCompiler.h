@@ -447,6 +447,12 @@ private:
 	/** Number of jobs currently being compiled.  This includes CompileQueue and any jobs that have been assigned to workers but aren't complete yet. */
 	int32 NumOutstandingJobs;
 
+	/** Input hash of the single shader jobs that are queued or being compiled, see r.ShaderCompiler.DeduplicateJobs. */
+	TMap<FSHAHash, FShaderCommonCompileJob*> PendingJobsByInputHash;
+	TMap<const FShaderCommonCompileJob*, FSHAHash> PendingJobInputHashes;
+	/** Jobs with the same input as a pending job, which get its output instead of being compiled. Keyed by the pending job. */
+	TMultiMap<const FShaderCommonCompileJob*, TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> DuplicateJobs;
+
 	/** Number of jobs currently being compiled.  This includes CompileQueue and any jobs that have been assigned to workers but aren't complete yet. */
 	int32 NumExternalJobs;
 
@@ -524,6 +530,12 @@ private:
 	/** Recompiles shader jobs with errors if requested, and returns true if a retry was needed. */
 	bool HandlePotentialRetryOnError(TMap<int32, FShaderMapFinalizeResults>& CompletedShaderMaps);
 
+	/** Adds a compiled job to the results of its shader map, along with the jobs it was compiled for. CompileQueueSection must be locked. */
+	void AddFinishedJob(const TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>& Job);
+
+	/** Stops tracking the input hash of a pending job. Its duplicates are returned so they can be compiled or finished. CompileQueueSection must be locked. */
+	void RemovePendingJob(const FShaderCommonCompileJob* Job, TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& OutDuplicateJobs);
+
 public:
 	
 	ENGINE_API FShaderCompilingManager();
@@ -0,0 +1,151 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "Engine/EngineTypes.h"
+#include "PhysicsEngine/BoxElem.h"
+#include "PhysicsEngine/SphereElem.h"
+#include "PhysicsEngine/SphylElem.h"
+
+class AActor;
+class UPrimitiveComponent;
+class UBodySetup;
+class UPhysicalMaterial;
+struct FCollisionQueryParams;
+struct FCollisionResponseParams;
+struct FCollisionObjectQueryParams;
+
+/**
+ * Per-world store of query-only static collision that lives outside of the physics scene.
+ * Components with bUseStaticCollisionStore register their simple collision here instead of creating physics bodies:
+ * every instance is a transform referencing the shapes of its body setup, and instances are found through a bounding
+ * volume hierarchy built over their world bounds. This is much cheaper than a physics actor per instance for large
+ * numbers of static props, at the price of only answering raycasts.
+ *
+ * The store is consulted by FGenericPhysicsInterface's raycasts alongside the physics scene. Sweeps and overlaps don't see it.
+ */
+class ENGINE_API FStaticCollisionStore : public FNoncopyable
+{
+public:
+
+	FStaticCollisionStore();
+	~FStaticCollisionStore();
+
+	/** Returns true if components may register with the store, see p.StaticCollisionStore */
+	static bool IsEnabled();
+
+	/** Returns true if the body setup only uses shapes the store can trace against: boxes, spheres and capsules */
+	static bool CanStoreBodySetup(const UBodySetup* BodySetup);
+
+	/**
+	 * Adds the instances returned by Component->GetStaticCollisionStoreInstances, all using the simple collision of BodySetup.
+	 * Added instances are seen by raycasts once the hierarchy is rebuilt, at the start of the next world tick or by the next game thread raycast.
+	 * @return false if the body setup can't be stored, in which case the component should create physics bodies as usual.
+	 */
+	bool AddComponent(UPrimitiveComponent* Component, UBodySetup* BodySetup);
+
+	/** Removes every instance of Component. Removed instances are no longer hit, even before the hierarchy is rebuilt. */
+	void RemoveComponent(const UPrimitiveComponent* Component);
+
+	/** Re-reads the instances of a registered component, for when they were added, removed or moved. Applied by the next rebuild. */
+	void MarkComponentDirty(UPrimitiveComponent* Component);
+
+	/** Applies pending component updates and rebuilds the hierarchy if anything changed. Game thread only. */
+	void Flush();
+
+	/**
+	 * Traces a line against the stored instances. Only blocking hits are reported: stored components can't generate touches.
+	 * Complex traces are answered with the simple collision, which is all the store keeps.
+	 * @param MaxTime	Only hits closer than this fraction of the line are reported, e.g. the time of the physics scene's blocking hit
+	 * @param bAnyHit	Stop at the first blocking hit found rather than at the closest one
+	 * @return true if a blocking hit was found, in which case OutHit is overwritten
+	 */
+	bool Raycast(FHitResult& OutHit, const FVector& Start, const FVector& End, float MaxTime, ECollisionChannel TraceChannel, const FCollisionQueryParams& Params, const FCollisionResponseParams& ResponseParams, const FCollisionObjectQueryParams& ObjectParams, bool bAnyHit);
+
+	/** Returns the number of live stored instances */
+	int32 GetNumInstances() const { return NumLiveInstances; }
+
+	/** Logs the contents of the store */
+	void Dump() const;
+
+private:
+
+	/** Simple collision of a body setup, shared by every instance using it */
+	struct FShapeSet
+	{
+		UBodySetup* BodySetup;
+		TArray<FKBoxElem> BoxElems;
+		TArray<FKSphereElem> SphereElems;
+		TArray<FKSphylElem> SphylElems;
+		FBox LocalBounds;
+		int32 NumUsers;
+	};
+
+	/** A registered component. Its instances are contiguous in the instance arrays. */
+	struct FSource
+	{
+		UPrimitiveComponent* Component;
+		AActor* Owner;
+		uint32 ComponentId;
+		uint32 OwnerId;
+		FCollisionResponseContainer Responses;
+		ECollisionChannel ObjectType;
+		UPhysicalMaterial* PhysMaterial;
+		int32 ShapeSetIndex;
+		int32 FirstInstance;
+		int32 NumInstances;
+	};
+
+	/** Node of the bounding volume hierarchy. Leaves cover NumInstances entries of NodeInstances, inner nodes have their first child right after them. */
+	struct FNode
+	{
+		FBox Bounds;
+		int32 FirstInstance;
+		int32 NumInstances;
+		int32 SecondChild;
+	};
+
+	int32 BuildNode(int32 FirstInstance, int32 NumInstances, int32 Depth);
+
+	int32 FindOrAddShapeSet(UBodySetup* BodySetup);
+	void ReleaseShapeSet(int32 ShapeSetIndex);
+
+	void AddComponentInternal(UPrimitiveComponent* Component, UBodySetup* BodySetup);
+	void RemoveComponentInternal(const UPrimitiveComponent* Component);
+
+	/** Drops dead instances and rebuilds the hierarchy over the live ones. Write lock must be held. */
+	void Rebuild();
+
+	bool PassesFilter(const FSource& Source, ECollisionChannel TraceChannel, const FCollisionQueryParams& Params, const FCollisionResponseParams& ResponseParams, const FCollisionObjectQueryParams& ObjectParams) const;
+
+	/** Intersects a line with the shapes of an instance. Returns the hit time along the line and the world space normal. */
+	bool RaycastInstance(int32 InstanceIndex, const FVector& Start, const FVector& Delta, float MaxTime, float& OutTime, FVector& OutNormal) const;
+
+	/** Guards everything below. Raycasts take it for reading, they may run on task threads through async traces. */
+	mutable FRWLock Lock;
+
+	TSparseArray<FShapeSet> ShapeSets;
+	TMap<const UBodySetup*, int32> ShapeSetIndexByBodySetup;
+
+	TSparseArray<FSource> Sources;
+	TMap<const UPrimitiveComponent*, int32> SourceIndexByComponent;
+
+	/** One entry per instance in each array. Instances of removed sources have a source index of INDEX_NONE until the next rebuild. */
+	TArray<FTransform> InstanceTransforms;
+	TArray<FBox> InstanceBounds;
+	TArray<int32> InstanceSources;
+	TArray<int32> InstanceItems;
+
+	TArray<FNode> Nodes;
+	TArray<int32> NodeInstances;
+
+	/** Components to re-read on the next flush */
+	TSet<UPrimitiveComponent*> DirtyComponents;
+
+	int32 NumLiveInstances;
+
+	/** Set when instances were added or removed since the last rebuild */
+	bool bNeedsRebuild;
+};
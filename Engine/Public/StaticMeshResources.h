@@ -1362,6 +1362,38 @@ public:
 	{
 		SetInstanceCustomDataInternal(InstanceIndex, Index, CustomData);
 	}
+
+	/** Replaces the transform of an instance, keeping its random ID, editor, light map and custom data */
+	FORCEINLINE_DEBUGGABLE void SetInstanceTransform(int32 InstanceIndex, const FMatrix& Transform)
+	{
+		FVector4 Origin;
+		GetInstanceOriginInternal(InstanceIndex, Origin);
+		SetInstanceOriginInternal(InstanceIndex, FVector4(Transform.M[3][0], Transform.M[3][1], Transform.M[3][2], Origin.W));
+
+		FVector4 InstanceTransform[3];
+		if (bUseHalfFloat)
+		{
+			GetInstanceTransformInternal<FFloat16>(InstanceIndex, InstanceTransform);
+		}
+		else
+		{
+			GetInstanceTransformInternal<float>(InstanceIndex, InstanceTransform);
+		}
+
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			InstanceTransform[Row] = FVector4(Transform.M[Row][0], Transform.M[Row][1], Transform.M[Row][2], InstanceTransform[Row].W);
+		}
+
+		if (bUseHalfFloat)
+		{
+			SetInstanceTransformInternal<FFloat16>(InstanceIndex, InstanceTransform);
+		}
+		else
+		{
+			SetInstanceTransformInternal<float>(InstanceIndex, InstanceTransform);
+		}
+	}
 	
 	FORCEINLINE_DEBUGGABLE void NullifyInstance(int32 InstanceIndex)
 	{
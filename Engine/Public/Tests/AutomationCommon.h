@@ -4,9 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
+#include "Tests/AutomationTestSettings.h"
 
 class AMatineeActor;
 class SWindow;
+class ACameraActor;
+class USplineComponent;
+class FPerformanceTrackingChart;
 
 #if WITH_AUTOMATION_TESTS
 
@@ -166,4 +170,89 @@ DEFINE_ENGINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FExecWorldStringLatentComm
 */
 DEFINE_ENGINE_LATENT_AUTOMATION_COMMAND(FWaitForShadersToFinishCompilingInGame);
 
+/**
+ * A performance benchmark run by latent commands: captures an FPS chart, and optionally a CSV profile, with the game
+ * running at a fixed time step between FStartPerformanceBenchmarkCommand and FStopPerformanceBenchmarkCommand.
+ * Stopping dumps the chart and fails the current test when a measure is over the thresholds of the definition.
+ */
+class ENGINE_API FAutomationPerformanceBenchmark
+{
+public:
+	FAutomationPerformanceBenchmark(const FPerformanceBenchmarkDefinition& InDefinition);
+
+	void Start();
+	void Stop();
+
+	const FPerformanceBenchmarkDefinition& GetDefinition() const { return Definition; }
+
+private:
+	void CheckThresholds() const;
+
+	FPerformanceBenchmarkDefinition Definition;
+	TSharedPtr<FPerformanceTrackingChart> Chart;
+
+	bool bWasUsingFixedTimeStep;
+	double PreviousFixedDeltaTime;
+	bool bStartedCsvCapture;
+};
+
+/**
+* Starts capturing a performance benchmark
+*/
+DEFINE_ENGINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FStartPerformanceBenchmarkCommand, TSharedRef<FAutomationPerformanceBenchmark>, Benchmark);
+
+/**
+* Stops capturing a performance benchmark and checks its results
+*/
+DEFINE_ENGINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FStopPerformanceBenchmarkCommand, TSharedRef<FAutomationPerformanceBenchmark>, Benchmark);
+
+/**
+* Starts playing a replay and waits until the playback has started
+*/
+class ENGINE_API FPlayReplayLatentCommand : public IAutomationLatentCommand
+{
+public:
+	FPlayReplayLatentCommand(const FString& InReplayName)
+		: ReplayName(InReplayName)
+		, bRequestedPlayback(false)
+	{
+	}
+
+	virtual bool Update() override;
+
+private:
+	FString ReplayName;
+	bool bRequestedPlayback;
+};
+
+/**
+* Waits until the replay being played reaches its end
+*/
+DEFINE_ENGINE_LATENT_AUTOMATION_COMMAND(FWaitForReplayToFinishLatentCommand);
+
+/**
+* Flies the view of the first player along the spline component of the actor with the given tag, over Duration
+* seconds of game time so that a fixed time step renders the same frames on every run.
+*/
+class ENGINE_API FSplineFlythroughLatentCommand : public IAutomationLatentCommand
+{
+public:
+	FSplineFlythroughLatentCommand(FName InSplineActorTag, float InDuration)
+		: SplineActorTag(InSplineActorTag)
+		, Duration(InDuration)
+		, FlythroughStartTime(-1.0)
+	{
+	}
+
+	virtual bool Update() override;
+
+private:
+	FName SplineActorTag;
+	float Duration;
+
+	TWeakObjectPtr<USplineComponent> Spline;
+	TWeakObjectPtr<ACameraActor> Camera;
+	double FlythroughStartTime;
+};
+
 #endif
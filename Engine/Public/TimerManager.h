@@ -138,6 +138,13 @@ struct FTimerData
 	/** The level collection that was active when this timer was created. Used to set the correct context before executing the timer's delegate. */
 	ELevelCollectionType LevelCollection;
 
+	/** Timing wheel bucket this timer is linked into, or INDEX_NONE if it is not in the wheel (paused, pending or being executed). */
+	int32 WheelBucket;
+
+	/** Previous and next timer indices in the WheelBucket list, INDEX_NONE at either end. */
+	int32 WheelPrev;
+	int32 WheelNext;
+
 	FTimerData()
 		: bLoop(false)
 		, bRequiresDelegate(false)
@@ -145,6 +152,9 @@ struct FTimerData
 		, Rate(0)
 		, ExpireTime(0)
 		, LevelCollection(ELevelCollectionType::DynamicSourceLevels)
+		, WheelBucket(INDEX_NONE)
+		, WheelPrev(INDEX_NONE)
+		, WheelNext(INDEX_NONE)
 	{}
 
 	// Movable only
@@ -430,10 +440,32 @@ private:
 	void RemoveTimer(FTimerHandle Handle);
 	bool WillRemoveTimerAssert(FTimerHandle Handle) const;
 
+	/** Timing wheel layout: each level has 2^TimerWheelLevelBits buckets and is that many times coarser than the level below it. */
+	static constexpr int32 TimerWheelLevelBits = 6;
+	static constexpr int32 TimerWheelBucketsPerLevel = 1 << TimerWheelLevelBits;
+	static constexpr int32 TimerWheelNumLevels = 4;
+
+	/** Links an active timer into the wheel bucket matching its ExpireTime. */
+	void LinkTimerToWheel(int32 Index);
+	/** Unlinks a timer from its wheel bucket, if it is in one. */
+	void UnlinkTimerFromWheel(int32 Index);
+	/** Moves the wheel cursor up to InternalTime, cascading coarse buckets down and collecting every timer that has expired. */
+	void AdvanceTimerWheel(TArray<FTimerHandle>& OutExpiredTimers);
+	/** Re-files every timer in a coarse bucket now that the cursor has reached it. */
+	void CascadeTimerWheelBucket(int32 Bucket);
+
 	/** The array of timers - all other arrays will index into this */
 	TSparseArray<FTimerData> Timers;
-	/** Heap of actively running timers. */
-	TArray<FTimerHandle> ActiveTimerHeap;
+	/** Head timer index of each timing wheel bucket, level-major. */
+	int32 TimerWheelHeads[TimerWheelNumLevels * TimerWheelBucketsPerLevel];
+	/** Per-level bitmask of non-empty buckets. */
+	uint64 TimerWheelOccupancy[TimerWheelNumLevels];
+	/** Wheel slot that InternalTime falls in as of the last tick. */
+	int64 TimerWheelCursor;
+	/** Number of timers currently linked into the wheel. */
+	int32 NumTimersInWheel;
+	/** Scratch storage for timers that expire in the same tick, kept around to avoid reallocating every frame. */
+	TArray<FTimerHandle> ExpiredTimerBatch;
 	/** Set of paused timers. */
 	TSet<FTimerHandle> PausedTimerSet;
 	/** Set of timers added this frame, to be added after timer has been ticked */
@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class ULevel;
+struct FActorSpawnParameters;
+
+/**
+ * Per-world pool of out-of-play actors, keyed by the template (or class default object) they were spawned from.
+ * Only actors implementing IPoolableActorInterface are pooled: UWorld::DestroyActor parks them here and
+ * UWorld::SpawnActor hands them back out, skipping construction and component registration.
+ */
+struct ENGINE_API FWorldActorPool
+{
+	FWorldActorPool();
+
+	/**
+	 * Takes a free actor spawned from Template into Level out of the pool and puts it back in play at SpawnTransform.
+	 * @return The recycled actor, or nullptr if there is no free one.
+	 */
+	AActor* Acquire(AActor* Template, ULevel* Level, const FTransform& SpawnTransform, const FActorSpawnParameters& SpawnParameters);
+
+	/**
+	 * Takes Actor out of play and parks it in the pool instead of destroying it.
+	 * @return true if the actor is now in the pool, false if it should be destroyed normally.
+	 */
+	bool Reclaim(AActor* Actor);
+
+	/** Returns true if Actor is currently parked in the pool. */
+	bool IsPooled(const AActor* Actor) const;
+
+	/** Forgets every pooled actor. The actors themselves go away with their levels. */
+	void Cleanup();
+
+	/** Dumps the current state of the pool to the log. */
+	void Dump() const;
+
+private:
+	/** Free actors for each template. */
+	TMap<TObjectKey<AActor>, TArray<TWeakObjectPtr<AActor>>> FreeActors;
+
+	/** Every actor currently in FreeActors, so repeated destroys of a pooled actor are no-ops. */
+	TSet<TWeakObjectPtr<AActor>> PooledActors;
+};
@@ -219,6 +219,69 @@ struct FOverlapDatum : FBaseTraceDatum
 	}
 };
 
+/** When the results of a batched trace are available, see UWorld::AsyncBatchTraceByChannel */
+enum class EBatchedTraceCompletion : uint8
+{
+	/**
+	 * The batch starts on worker threads as soon as it is requested. Results can be waited for later in the same frame
+	 * with FBatchedTraceQuery::WaitForCompletion, and the world completes the batch at the end of the frame at the latest.
+	 */
+	SameFrame,
+	/** The batch starts along with the other async traces at the end of the frame, and its results are available at the start of the next frame */
+	NextFrame
+};
+
+struct FBatchedTraceQuery;
+
+/** Called on the game thread when a batched trace has completed */
+DECLARE_DELEGATE_OneParam( FBatchedTraceDelegate, const FBatchedTraceQuery& );
+
+/**
+ * A batch of traces or sweeps that share a shape, a channel and query parameters, see UWorld::AsyncBatchTraceByChannel.
+ * The batch is split in chunks that run as separate tasks, and every query writes its result to the same contiguous array.
+ */
+struct ENGINE_API FBatchedTraceQuery : public TSharedFromThis<FBatchedTraceQuery, ESPMode::ThreadSafe>, public FNoncopyable
+{
+	/** Input of the batch, one entry per query. Must not change until the batch has completed. */
+	TArray<FVector> Starts;
+	TArray<FVector> Ends;
+
+	/** Shared by every query of the batch */
+	FCollisionParameters CollisionParams;
+	ECollisionChannel TraceChannel;
+	EAsyncTraceType TraceType;
+	EBatchedTraceCompletion Completion;
+
+	/** Delegate run on the game thread once the batch has completed */
+	FBatchedTraceDelegate Delegate;
+
+	/** Output of the batch, one entry per query in request order. Test traces only set bBlockingHit. Valid once the batch has completed. */
+	TArray<FHitResult> Hits;
+
+	FBatchedTraceQuery();
+
+	/** Returns true once every query of the batch has run */
+	bool IsComplete() const;
+
+	/** Blocks until every query of the batch has run, then runs the delegate if it has not run yet. Game thread only. */
+	void WaitForCompletion();
+
+private:
+
+	friend class UWorld;
+
+	/** Starts the tasks running the batch, or runs it right away when async traces don't use worker threads */
+	void Dispatch(UWorld* World, bool bUseWorkerThreads);
+
+	/** Runs the queries [FirstIndex, FirstIndex + Count) */
+	void RunQueries(int32 FirstIndex, int32 Count);
+
+	TWeakObjectPtr<UWorld> PhysWorld;
+	FGraphEventArray CompletionEvents;
+	bool bDispatched;
+	bool bDelegateExecuted;
+};
+
 #define ASYNC_TRACE_BUFFER_SIZE 64
 
 /**
@@ -268,6 +331,9 @@ struct AsyncTraceData : FNoncopyable
 	/**  Thread completion event for batch **/
 	FGraphEventArray		AsyncTraceCompletionEvent;
 
+	/** Batched traces requested during this frame, completed at the end of the frame (SameFrame) or at the start of the next one (NextFrame) */
+	TArray<TSharedRef<FBatchedTraceQuery, ESPMode::ThreadSafe>> BatchedTraces;
+
 	AsyncTraceData() 
 		: NumQueuedTraceData(0)
 		, NumQueuedOverlapData(0)